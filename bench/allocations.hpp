@@ -0,0 +1,41 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+// Allocation tracking of the benchmark executables, implemented in benchmark-main.cpp by replacing the global operator new and
+// delete. Every benchmark gets the "allocs_per_iter" and "max_bytes_used" of Google Benchmark's memory manager in the JSON
+// output. AllocationCounters adds the allocations of a single benchmark as counters, which are also shown in the console.
+
+namespace bench {
+struct AllocationTotals {
+    std::int64_t count;
+    std::int64_t bytes;
+};
+
+// The amount of allocations and the amount of bytes allocated since the start of the program, over all threads
+AllocationTotals allocationTotals() noexcept;
+
+// Sets the "allocs/iter" and "bytes/iter" counters of `state` to the allocations between its construction and destruction,
+// divided by the amount of iterations. Construct it right before the benchmark loop, so that the setup is not counted.
+class AllocationCounters {
+    benchmark::State& _state;
+    AllocationTotals _start;
+
+public:
+    explicit AllocationCounters(benchmark::State& state) : _state(state), _start(allocationTotals()) {
+    }
+
+    AllocationCounters(const AllocationCounters&) = delete;
+    AllocationCounters& operator=(const AllocationCounters&) = delete;
+
+    ~AllocationCounters() {
+        const AllocationTotals end = allocationTotals();
+        const auto iterations = static_cast<double>(_state.iterations());
+        if (iterations > 0) {
+            _state.counters["allocs/iter"] = static_cast<double>(end.count - _start.count) / iterations;
+            _state.counters["bytes/iter"] = static_cast<double>(end.bytes - _start.bytes) / iterations;
+        }
+    }
+};
+} // namespace bench
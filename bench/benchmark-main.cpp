@@ -0,0 +1,123 @@
+#include "allocations.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// The main of every benchmark executable. It registers a memory manager that reports the allocations of every benchmark, which
+// are counted by the global operator new and delete below. Every block is prefixed with its size, so that delete knows how many
+// bytes are freed, for the peak memory use. The aligned versions are not replaced, as their defaults don't use these.
+
+namespace {
+constexpr std::size_t headerSize = alignof(std::max_align_t);
+
+std::atomic<std::int64_t> allocationCount{ 0 };
+std::atomic<std::int64_t> allocatedBytes{ 0 };
+std::atomic<std::int64_t> bytesInUse{ 0 };
+std::atomic<std::int64_t> peakBytesInUse{ 0 };
+
+void raisePeak(const std::int64_t inUse) noexcept {
+    std::int64_t peak = peakBytesInUse.load(std::memory_order_relaxed);
+    while (inUse > peak && !peakBytesInUse.compare_exchange_weak(peak, inUse, std::memory_order_relaxed)) {
+    }
+}
+
+void* countedAllocate(const std::size_t size) noexcept {
+    auto* block = static_cast<unsigned char*>(std::malloc(size + headerSize));
+    if (block == nullptr) {
+        return nullptr;
+    }
+    *reinterpret_cast<std::size_t*>(block) = size;
+    const auto bytes = static_cast<std::int64_t>(size);
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+    raisePeak(bytesInUse.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+    return block + headerSize;
+}
+
+void countedFree(void* pointer) noexcept {
+    if (pointer == nullptr) {
+        return;
+    }
+    auto* block = static_cast<unsigned char*>(pointer) - headerSize;
+    bytesInUse.fetch_sub(static_cast<std::int64_t>(*reinterpret_cast<std::size_t*>(block)), std::memory_order_relaxed);
+    std::free(block);
+}
+
+class AllocationManager final : public benchmark::MemoryManager {
+    std::int64_t _startCount{};
+    std::int64_t _startBytesInUse{};
+
+public:
+    void Start() override {
+        _startCount = allocationCount.load(std::memory_order_relaxed);
+        _startBytesInUse = bytesInUse.load(std::memory_order_relaxed);
+        peakBytesInUse.store(_startBytesInUse, std::memory_order_relaxed);
+    }
+
+    void Stop(Result* result) override {
+        result->num_allocs = allocationCount.load(std::memory_order_relaxed) - _startCount;
+        result->max_bytes_used = peakBytesInUse.load(std::memory_order_relaxed) - _startBytesInUse;
+    }
+};
+} // namespace
+
+void* operator new(const std::size_t size) {
+    if (void* pointer = countedAllocate(size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](const std::size_t size) {
+    return operator new(size);
+}
+
+void* operator new(const std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size);
+}
+
+void* operator new[](const std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size);
+}
+
+void operator delete(void* pointer) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+    countedFree(pointer);
+}
+
+bench::AllocationTotals bench::allocationTotals() noexcept {
+    return { allocationCount.load(std::memory_order_relaxed), allocatedBytes.load(std::memory_order_relaxed) };
+}
+
+int main(int argc, char** argv) {
+    AllocationManager allocationManager;
+    benchmark::RegisterMemoryManager(&allocationManager);
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::RegisterMemoryManager(nullptr);
+    return 0;
+}
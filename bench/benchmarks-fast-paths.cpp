@@ -0,0 +1,162 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <Lz/Lz.hpp>
+#include <Lz/Random.hpp>
+
+// Throughput of the fast paths next to the generic path that the same values take in a std::list, on the same random input
+// (or, for splitting, next to a std::find loop). Before timing, the results of both paths are compared and a benchmark of which
+// they differ reports an error instead of a time. The benchmarks are named Operation/Path/Size, so that both paths are listed
+// next to each other. See tests/differential-tests.cpp for the randomized tests of the same paths.
+
+namespace {
+std::vector<int> randomInts(const std::size_t size, const int maxValue) {
+    lz::SplitMix64 engine(size);
+    std::vector<int> ints(size);
+    for (int& i : ints) {
+        i = static_cast<int>(engine() % (static_cast<std::uint64_t>(maxValue) + 1));
+    }
+    return ints;
+}
+
+std::string randomText(const std::size_t size) {
+    lz::SplitMix64 engine(size);
+    std::string text(size, ' ');
+    for (char& c : text) {
+        c = engine() % 16 == 0 ? ',' : static_cast<char>('a' + engine() % 26);
+    }
+    return text;
+}
+
+bool isBelowHalf(const int i) {
+    return i < 500;
+}
+
+template<class Fast, class Generic>
+void runPath(benchmark::State& state, const bool isFast, Fast fast, Generic generic) {
+    if (fast() != generic()) {
+        state.SkipWithError("the fast path differs from the generic path");
+        return;
+    }
+
+    long long checksum = 0;
+    for (auto _ : state) {
+        checksum = isFast ? fast() : generic();
+        benchmark::DoNotOptimize(checksum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["checksum"] = static_cast<double>(checksum);
+}
+
+// Selection vector over random access input
+void Filter(benchmark::State& state, const bool isFast) {
+    const auto values = randomInts(static_cast<std::size_t>(state.range(0)), 1000);
+    const std::list<int> list(values.begin(), values.end());
+    runPath(
+        state, isFast, [&] { return lz::reduce(lz::filter(values, isBelowHalf), 0LL, std::plus<long long>()); },
+        [&] { return lz::reduce(lz::filter(list, isBelowHalf), 0LL, std::plus<long long>()); });
+}
+
+// Several accumulators over random access input
+void Sum(benchmark::State& state, const bool isFast) {
+    const auto values = randomInts(static_cast<std::size_t>(state.range(0)), 1000);
+    const std::list<int> list(values.begin(), values.end());
+    runPath(
+        state, isFast, [&] { return lz::reduce(values, 0LL, std::plus<long long>()); },
+        [&] { return lz::reduce(list, 0LL, std::plus<long long>()); });
+}
+
+// A cache line at a time over contiguous input, for a value that isn't there
+void Contains(benchmark::State& state, const bool isFast) {
+    const auto values = randomInts(static_cast<std::size_t>(state.range(0)), 1000);
+    const std::list<int> list(values.begin(), values.end());
+    runPath(
+        state, isFast, [&] { return static_cast<long long>(lz::contains(values, -1)); },
+        [&] { return static_cast<long long>(lz::contains(list, -1)); });
+}
+
+// Word at a time case insensitive comparison of contiguous characters
+void CaseInsensitiveEqual(benchmark::State& state, const bool isFast) {
+    const std::string a = randomText(static_cast<std::size_t>(state.range(0)));
+    const std::string b = lz::map(a, [](char c) { return c == ',' ? c : static_cast<char>(c - 'a' + 'A'); }).toString();
+    const std::list<char> listA(a.begin(), a.end());
+    const std::list<char> listB(b.begin(), b.end());
+    runPath(
+        state, isFast, [&] { return static_cast<long long>(lz::equal(a, b, lz::CaseInsensitiveEqual())); },
+        [&] { return static_cast<long long>(lz::equal(listA, listB, lz::CaseInsensitiveEqual())); });
+}
+
+// Bloom filter prefilter before the binary search of except
+void Except(benchmark::State& state, const bool isFast) {
+    const auto values = randomInts(static_cast<std::size_t>(state.range(0)), 1 << 20);
+    auto toExcept = randomInts(1000, 1 << 20);
+    std::sort(toExcept.begin(), toExcept.end());
+    const std::list<int> list(values.begin(), values.end());
+    runPath(
+        state, isFast, [&] { return lz::reduce(lz::exceptPrefiltered(values, toExcept), 0LL, std::plus<long long>()); },
+        [&] { return lz::reduce(lz::except(list, toExcept), 0LL, std::plus<long long>()); });
+}
+
+// Contiguous fixed size arrays flattened as one block
+void Flatten(benchmark::State& state, const bool isFast) {
+    const auto values = randomInts(static_cast<std::size_t>(state.range(0)), 1000);
+    std::vector<std::array<int, 4>> quads(values.size() / 4);
+    for (std::size_t i = 0; i != quads.size(); ++i) {
+        std::copy_n(values.begin() + static_cast<std::ptrdiff_t>(i * 4), 4, quads[i].begin());
+    }
+    const std::list<std::array<int, 4>> list(quads.begin(), quads.end());
+    runPath(
+        state, isFast, [&] { return lz::reduce(lz::flatten(quads), 0LL, std::plus<long long>()); },
+        [&] { return lz::reduce(lz::flatten(list), 0LL, std::plus<long long>()); });
+}
+
+// memchr and match masks, against looking for every delimiter with std::find
+void Split(benchmark::State& state, const bool isFast) {
+    const std::string text = randomText(static_cast<std::size_t>(state.range(0)));
+    runPath(
+        state, isFast,
+        [&] {
+            long long lengths = 0;
+            for (const auto part : lz::split(text, ',')) {
+                lengths += static_cast<long long>(part.size()) + 1;
+            }
+            return lengths;
+        },
+        [&] {
+            long long lengths = 0;
+            for (auto begin = text.begin();; ++begin) {
+                const auto end = std::find(begin, text.end(), ',');
+                lengths += (end - begin) + 1;
+                if (end == text.end()) {
+                    return lengths;
+                }
+                begin = end;
+            }
+        });
+}
+
+void sizes(benchmark::internal::Benchmark* b) {
+    b->RangeMultiplier(32)->Range(1 << 10, 1 << 20)->Unit(benchmark::kMicrosecond);
+}
+} // namespace
+
+BENCHMARK_CAPTURE(Filter, Fast, true)->Apply(sizes);
+BENCHMARK_CAPTURE(Filter, Generic, false)->Apply(sizes);
+BENCHMARK_CAPTURE(Sum, Fast, true)->Apply(sizes);
+BENCHMARK_CAPTURE(Sum, Generic, false)->Apply(sizes);
+BENCHMARK_CAPTURE(Contains, Fast, true)->Apply(sizes);
+BENCHMARK_CAPTURE(Contains, Generic, false)->Apply(sizes);
+BENCHMARK_CAPTURE(CaseInsensitiveEqual, Fast, true)->Apply(sizes);
+BENCHMARK_CAPTURE(CaseInsensitiveEqual, Generic, false)->Apply(sizes);
+BENCHMARK_CAPTURE(Except, Fast, true)->Apply(sizes);
+BENCHMARK_CAPTURE(Except, Generic, false)->Apply(sizes);
+BENCHMARK_CAPTURE(Flatten, Fast, true)->Apply(sizes);
+BENCHMARK_CAPTURE(Flatten, Generic, false)->Apply(sizes);
+BENCHMARK_CAPTURE(Split, Fast, true)->Apply(sizes);
+BENCHMARK_CAPTURE(Split, Generic, false)->Apply(sizes);
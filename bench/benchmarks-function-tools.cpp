@@ -0,0 +1,237 @@
+// <execution> must be included before cpp-lazy, otherwise the LZ_HAS_EXECUTION overloads are not available
+#include <execution>
+
+#include <benchmark/benchmark.h>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <Lz/Lz.hpp>
+
+#include "allocations.hpp"
+
+// Benchmarks the FunctionTools algorithms and the IterView chain API over large inputs. Algorithms that have an execution
+// overload are run with seq, par and par_unseq, so it's visible where the parallel overloads scale and where they lose to
+// the sequential version. Note that libstdc++ only runs the parallel algorithms in parallel when linked against TBB.
+
+struct Seq {
+    static const std::execution::sequenced_policy& policy() {
+        return std::execution::seq;
+    }
+};
+
+struct Par {
+    static const std::execution::parallel_policy& policy() {
+        return std::execution::par;
+    }
+};
+
+struct ParUnseq {
+    static const std::execution::parallel_unsequenced_policy& policy() {
+        return std::execution::par_unseq;
+    }
+};
+
+static std::vector<int> makeInts(const std::size_t size) {
+    std::vector<int> input(size);
+    // Pseudo random but deterministic, so sorting and nth_element have actual work to do
+    std::uint32_t state = 2463534242u;
+    for (auto& value : input) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        value = static_cast<int>(state % 1000000u);
+    }
+    return input;
+}
+
+template<class Policy>
+static void Mean(benchmark::State& state) {
+    const auto input = makeInts(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lz::mean(input, std::plus<>(), Policy::policy()));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Policy>
+static void Median(benchmark::State& state) {
+    const auto input = makeInts(static_cast<std::size_t>(state.range(0)));
+    std::vector<int> copy;
+    for (auto _ : state) {
+        state.PauseTiming();
+        copy = input;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(lz::median(copy, std::less<>(), Policy::policy()));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Policy>
+static void FilterMap(benchmark::State& state) {
+    const auto input = makeInts(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto filterMap = lz::filterMap(
+            input, [](int i) { return i % 2 == 0; }, [](int i) { return i * 2; }, Policy::policy());
+        for (int i : filterMap) {
+            benchmark::DoNotOptimize(i);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Policy>
+static void Select(benchmark::State& state) {
+    const auto input = makeInts(static_cast<std::size_t>(state.range(0)));
+    std::vector<bool> selectors(input.size());
+    std::transform(input.begin(), input.end(), selectors.begin(), [](int i) { return i % 3 == 0; });
+    for (auto _ : state) {
+        for (int i : lz::select(input, selectors, Policy::policy())) {
+            benchmark::DoNotOptimize(i);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Policy>
+static void Trim(benchmark::State& state) {
+    const auto padding = static_cast<std::size_t>(state.range(0)) / 4;
+    const std::string input = std::string(padding, ' ') + std::string(padding * 2, 'x') + std::string(padding, '\t');
+    for (auto _ : state) {
+        auto trimmed = lz::trimString(input, Policy::policy());
+        benchmark::DoNotOptimize(trimmed.begin());
+        benchmark::DoNotOptimize(trimmed.end());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Policy>
+static void IterViewSort(benchmark::State& state) {
+    const auto input = makeInts(static_cast<std::size_t>(state.range(0)));
+    std::vector<int> copy;
+    for (auto _ : state) {
+        state.PauseTiming();
+        copy = input;
+        state.ResumeTiming();
+        lz::toIter(copy).sort(std::less<>(), Policy::policy());
+        benchmark::DoNotOptimize(copy.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Policy>
+static void IterViewFoldl(benchmark::State& state) {
+    const auto input = makeInts(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lz::toIter(input).foldl(0LL, std::plus<>(), Policy::policy()));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Policy>
+static void IterViewMapSum(benchmark::State& state) {
+    const auto input = makeInts(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto chain = lz::toIter(input).map([](int i) { return static_cast<long long>(i) * 3; });
+        benchmark::DoNotOptimize(chain.foldl(0LL, std::plus<>(), Policy::policy()));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// The functions below have no execution overload and are only benchmarked sequentially
+
+static void Lines(benchmark::State& state) {
+    std::string input;
+    const auto lineCount = static_cast<std::size_t>(state.range(0)) / 16;
+    for (std::size_t i = 0; i < lineCount; ++i) {
+        input += "a line of text\r\n";
+    }
+    for (auto _ : state) {
+        for (auto&& line : lz::lines(input)) {
+            benchmark::DoNotOptimize(line);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(input.size()));
+}
+
+static void Pairwise(benchmark::State& state) {
+    const auto input = makeInts(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (auto&& pair : lz::pairwise(input)) {
+            benchmark::DoNotOptimize(pair);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void ZipWith(benchmark::State& state) {
+    const auto a = makeInts(static_cast<std::size_t>(state.range(0)));
+    const auto b = makeInts(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (int sum : lz::zipWith([](int x, int y) { return x + y; }, a, b)) {
+            benchmark::DoNotOptimize(sum);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Mostly bound by allocations, of which the "allocs/iter" and "bytes/iter" counters tell how many there are
+
+static void StrJoin(benchmark::State& state) {
+    const auto words = lz::map(lz::range(static_cast<int>(state.range(0))), [](int i) { return std::to_string(i); }).toVector();
+    std::int64_t joinedSize = 0;
+    bench::AllocationCounters allocations(state);
+    for (auto _ : state) {
+        const std::string joined = lz::strJoin(words, ", ");
+        joinedSize = static_cast<std::int64_t>(joined.size());
+        benchmark::DoNotOptimize(joined.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * joinedSize);
+}
+
+static void ToVector(benchmark::State& state) {
+    const auto input = makeInts(static_cast<std::size_t>(state.range(0)));
+    bench::AllocationCounters allocations(state);
+    for (auto _ : state) {
+        const std::vector<int> even = lz::filter(input, [](int i) { return i % 2 == 0; }).toVector();
+        benchmark::DoNotOptimize(even.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(int)));
+}
+
+static void AggregateBy(benchmark::State& state) {
+    const auto input = makeInts(static_cast<std::size_t>(state.range(0)));
+    bench::AllocationCounters allocations(state);
+    for (auto _ : state) {
+        auto sums = lz::aggregateBy(input, [](int i) { return i % 1024; }, 0LL, [](long long sum, int i) { return sum + i; });
+        benchmark::DoNotOptimize(sums.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void Sizes(benchmark::internal::Benchmark* b) {
+    b->RangeMultiplier(16)->Range(1 << 10, 1 << 24)->Unit(benchmark::kMicrosecond)->UseRealTime();
+}
+
+#define LZ_POLICY_BENCHMARK(Name)                                                                                               \
+    BENCHMARK_TEMPLATE(Name, Seq)->Apply(Sizes);                                                                               \
+    BENCHMARK_TEMPLATE(Name, Par)->Apply(Sizes);                                                                               \
+    BENCHMARK_TEMPLATE(Name, ParUnseq)->Apply(Sizes)
+
+LZ_POLICY_BENCHMARK(Mean);
+LZ_POLICY_BENCHMARK(Median);
+LZ_POLICY_BENCHMARK(FilterMap);
+LZ_POLICY_BENCHMARK(Select);
+LZ_POLICY_BENCHMARK(Trim);
+LZ_POLICY_BENCHMARK(IterViewSort);
+LZ_POLICY_BENCHMARK(IterViewFoldl);
+LZ_POLICY_BENCHMARK(IterViewMapSum);
+
+BENCHMARK(Lines)->Apply(Sizes);
+BENCHMARK(Pairwise)->Apply(Sizes);
+BENCHMARK(ZipWith)->Apply(Sizes);
+BENCHMARK(StrJoin)->Apply(Sizes);
+BENCHMARK(ToVector)->Apply(Sizes);
+BENCHMARK(AggregateBy)->Apply(Sizes);
@@ -4,6 +4,8 @@
 
 #include <Lz/Lz.hpp>
 
+#include "allocations.hpp"
+
 
 constexpr static size_t SizePolicy = 32;
 
@@ -319,22 +321,26 @@ static void JoinInt(benchmark::State& state) {
     std::array<int, SizePolicy> arr = lz::range<int>(SizePolicy).toArray<SizePolicy>();
     auto join = lz::join(arr, ",");
 
+    bench::AllocationCounters allocations(state);
     for (auto _ : state) {
         for (const std::string s : join) {
             benchmark::DoNotOptimize(s);
         }
     }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(arr.size()));
 }
 
 static void JoinString(benchmark::State& state) {
     std::array<std::string, SizePolicy> arr = lz::repeat(std::string("hello"), SizePolicy).toArray<SizePolicy>();
     auto join = lz::join(arr, ",");
 
+    bench::AllocationCounters allocations(state);
     for (auto _ : state) {
         for (const std::string& s : join) {
             benchmark::DoNotOptimize(s);
         }
     }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(arr.size()));
 }
 
 BENCHMARK(CartesianProduct);
@@ -364,5 +370,3 @@ BENCHMARK(Unique);
 BENCHMARK(Zip4);
 BENCHMARK(Zip3);
 BENCHMARK(Zip2);
-
-BENCHMARK_MAIN();
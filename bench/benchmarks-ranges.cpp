@@ -0,0 +1,243 @@
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <Lz/Lz.hpp>
+
+#include "allocations.hpp"
+
+#if defined(__cpp_lib_ranges)
+#include <ranges>
+#endif
+
+#if defined(LZ_BENCHMARK_RANGE_V3)
+#include <range/v3/view/chunk.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/zip.hpp>
+#endif
+
+// The same pipelines, written with cpp-lazy, with std::views (where the standard library has the adaptor) and with range-v3
+// (when configured with -DBENCHMARK_RANGE_V3=ON). The benchmarks are named Pipeline/Library/Size, so that the results of the
+// libraries are listed next to each other. Every version consumes its pipeline with the same plain loop and reports the result
+// as the "checksum" counter, which must be equal for all libraries.
+
+namespace {
+std::vector<int> makeInts(const std::size_t size) {
+    return lz::range(static_cast<int>(size)).toVector();
+}
+
+std::vector<std::vector<int>> makeNested(const std::size_t size) {
+    constexpr std::size_t innerSize = 16;
+    std::vector<std::vector<int>> nested(size / innerSize);
+    int value = 0;
+    for (auto& inner : nested) {
+        for (std::size_t i = 0; i < innerSize; ++i) {
+            inner.push_back(value++);
+        }
+    }
+    return nested;
+}
+
+std::vector<std::string> makeWords(const std::size_t size) {
+    return lz::map(lz::range(static_cast<int>(size)), [](int i) { return std::to_string(i); }).toVector();
+}
+
+int timesThree(const int i) {
+    return i * 3 + 1;
+}
+
+bool isEven(const int i) {
+    return i % 2 == 0;
+}
+
+template<class Range>
+long long sumOf(Range&& range) {
+    long long sum = 0;
+    for (auto&& value : range) {
+        sum += value;
+    }
+    return sum;
+}
+
+template<class Range>
+long long sumOfPairs(Range&& range) {
+    long long sum = 0;
+    for (auto&& pair : range) {
+        auto&& [a, b] = pair;
+        sum += static_cast<long long>(b) - a;
+    }
+    return sum;
+}
+
+template<class Range>
+long long sumOfChunks(Range&& range) {
+    long long sum = 0;
+    for (auto&& chunk : range) {
+        for (auto&& value : chunk) {
+            sum += value;
+        }
+        ++sum;
+    }
+    return sum;
+}
+
+template<class Range>
+long long joinedLength(Range&& range) {
+    std::string joined;
+    for (const char c : range) {
+        joined += c;
+    }
+    return static_cast<long long>(joined.size());
+}
+
+using Ints = std::vector<int>;
+using IntPair = std::pair<Ints, Ints>;
+using Nested = std::vector<Ints>;
+using Words = std::vector<std::string>;
+constexpr std::size_t chunkSize = 8;
+
+long long lzMap(const Ints& in) {
+    return sumOf(lz::map(in, timesThree));
+}
+
+long long lzFilter(const Ints& in) {
+    return sumOf(lz::filter(in, isEven));
+}
+
+long long lzZip(const IntPair& in) {
+    return sumOfPairs(lz::zip(in.first, in.second));
+}
+
+long long lzFlatten(const Nested& in) {
+    return sumOf(lz::flatten(in));
+}
+
+long long lzChunks(const Ints& in) {
+    return sumOfChunks(lz::chunks(in, chunkSize));
+}
+
+// Builds the joined string, which is what lz::strJoin is for
+long long lzJoin(const Words& in) {
+    return static_cast<long long>(lz::strJoin(in, ",").size());
+}
+
+// Average time of the cpp-lazy version in nanoseconds, measured outside of the benchmark timing, see benchmarks-scaling.cpp
+template<class Input>
+double lzNanos(long long (*lzFn)(const Input&), const Input& input) {
+    using Nanos = std::chrono::duration<double, std::nano>;
+    constexpr double minimumNanos = 1e7;
+
+    benchmark::DoNotOptimize(lzFn(input));
+    for (long long repetitions = 1;; repetitions *= 2) {
+        const auto start = std::chrono::steady_clock::now();
+        for (long long i = 0; i < repetitions; ++i) {
+            benchmark::DoNotOptimize(lzFn(input));
+        }
+        const Nanos elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() >= minimumNanos) {
+            return elapsed.count() / static_cast<double>(repetitions);
+        }
+    }
+}
+
+// Runs `fn` over `input`. If `fn` is not the cpp-lazy version itself, the "vsLz" counter tells how much slower (> 1) or faster
+// (< 1) it is than `lzFn`
+template<class Input, class Fn>
+void runPipeline(benchmark::State& state, const Input& input, Fn fn, long long (*lzFn)(const Input&)) {
+    constexpr bool isLz = std::is_same<Fn, long long (*)(const Input&)>::value;
+    const double lz = isLz ? 0 : lzNanos(lzFn, input);
+
+    long long checksum = 0;
+    bench::AllocationCounters allocations(state);
+    const auto start = std::chrono::steady_clock::now();
+    for (auto _ : state) {
+        checksum = fn(input);
+        benchmark::DoNotOptimize(checksum);
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["checksum"] = static_cast<double>(checksum);
+    if (lz > 0 && state.iterations() > 0) {
+        state.counters["vsLz"] = (elapsed.count() / static_cast<double>(state.iterations())) / lz;
+    }
+}
+
+template<class Fn>
+void Map(benchmark::State& state, Fn fn) {
+    runPipeline(state, makeInts(static_cast<std::size_t>(state.range(0))), fn, lzMap);
+}
+
+template<class Fn>
+void Filter(benchmark::State& state, Fn fn) {
+    runPipeline(state, makeInts(static_cast<std::size_t>(state.range(0))), fn, lzFilter);
+}
+
+template<class Fn>
+void Zip(benchmark::State& state, Fn fn) {
+    const auto input = makeInts(static_cast<std::size_t>(state.range(0)));
+    runPipeline(state, std::make_pair(input, lz::map(input, timesThree).toVector()), fn, lzZip);
+}
+
+template<class Fn>
+void Flatten(benchmark::State& state, Fn fn) {
+    runPipeline(state, makeNested(static_cast<std::size_t>(state.range(0))), fn, lzFlatten);
+}
+
+template<class Fn>
+void Chunks(benchmark::State& state, Fn fn) {
+    runPipeline(state, makeInts(static_cast<std::size_t>(state.range(0))), fn, lzChunks);
+}
+
+template<class Fn>
+void Join(benchmark::State& state, Fn fn) {
+    runPipeline(state, makeWords(static_cast<std::size_t>(state.range(0))), fn, lzJoin);
+}
+
+void sizes(benchmark::internal::Benchmark* b) {
+    b->RangeMultiplier(64)->Range(1 << 10, 1 << 22)->Unit(benchmark::kMicrosecond);
+}
+} // namespace
+
+BENCHMARK_CAPTURE(Map, Lz, lzMap)->Apply(sizes);
+BENCHMARK_CAPTURE(Filter, Lz, lzFilter)->Apply(sizes);
+BENCHMARK_CAPTURE(Zip, Lz, lzZip)->Apply(sizes);
+BENCHMARK_CAPTURE(Flatten, Lz, lzFlatten)->Apply(sizes);
+BENCHMARK_CAPTURE(Chunks, Lz, lzChunks)->Apply(sizes);
+BENCHMARK_CAPTURE(Join, Lz, lzJoin)->Apply(sizes);
+
+#if defined(__cpp_lib_ranges)
+BENCHMARK_CAPTURE(Map, StdRanges, [](const Ints& in) { return sumOf(in | std::views::transform(timesThree)); })->Apply(sizes);
+BENCHMARK_CAPTURE(Filter, StdRanges, [](const Ints& in) { return sumOf(in | std::views::filter(isEven)); })->Apply(sizes);
+BENCHMARK_CAPTURE(Flatten, StdRanges, [](const Nested& in) { return sumOf(in | std::views::join); })->Apply(sizes);
+#endif
+
+#if defined(__cpp_lib_ranges_zip)
+BENCHMARK_CAPTURE(Zip, StdRanges, [](const IntPair& in) { return sumOfPairs(std::views::zip(in.first, in.second)); })
+    ->Apply(sizes);
+#endif
+
+#if defined(__cpp_lib_ranges_chunk)
+BENCHMARK_CAPTURE(Chunks, StdRanges, [](const Ints& in) { return sumOfChunks(in | std::views::chunk(chunkSize)); })
+    ->Apply(sizes);
+#endif
+
+#if defined(__cpp_lib_ranges_join_with)
+BENCHMARK_CAPTURE(Join, StdRanges, [](const Words& in) { return joinedLength(in | std::views::join_with(',')); })
+    ->Apply(sizes);
+#endif
+
+#if defined(LZ_BENCHMARK_RANGE_V3)
+BENCHMARK_CAPTURE(Map, RangeV3, [](const Ints& in) { return sumOf(in | ranges::views::transform(timesThree)); })->Apply(sizes);
+BENCHMARK_CAPTURE(Filter, RangeV3, [](const Ints& in) { return sumOf(in | ranges::views::filter(isEven)); })->Apply(sizes);
+BENCHMARK_CAPTURE(Zip, RangeV3, [](const IntPair& in) { return sumOfPairs(ranges::views::zip(in.first, in.second)); })
+    ->Apply(sizes);
+BENCHMARK_CAPTURE(Flatten, RangeV3, [](const Nested& in) { return sumOf(in | ranges::views::join); })->Apply(sizes);
+BENCHMARK_CAPTURE(Chunks, RangeV3, [](const Ints& in) { return sumOfChunks(in | ranges::views::chunk(chunkSize)); })
+    ->Apply(sizes);
+BENCHMARK_CAPTURE(Join, RangeV3, [](const Words& in) { return joinedLength(in | ranges::views::join(',')); })->Apply(sizes);
+#endif
@@ -0,0 +1,236 @@
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <Lz/Lz.hpp>
+
+#if defined(__cpp_lib_ranges)
+#include <ranges>
+#endif
+
+// Measures cpp-lazy chains of increasing depth over growing inputs of different element types. Every chain has a
+// hand-written loop (and a std::ranges pipeline when available) doing exactly the same work, so the "vsRawLoop" counter
+// tells how much slower (> 1) or faster (< 1) the lazy version is compared to the raw loop of the same size.
+
+template<class T>
+struct Workload;
+
+template<>
+struct Workload<int> {
+    static int make(std::size_t i) {
+        return static_cast<int>(i);
+    }
+
+    static int first(int i) {
+        return i * 3 + 1;
+    }
+
+    static bool keep(int i) {
+        return i % 2 == 0;
+    }
+
+    static int second(int i) {
+        return i / 2;
+    }
+};
+
+template<>
+struct Workload<double> {
+    static double make(std::size_t i) {
+        return static_cast<double>(i) * 0.5;
+    }
+
+    static double first(double d) {
+        return d * 1.5 + 0.25;
+    }
+
+    static bool keep(double d) {
+        return static_cast<long long>(d) % 2 == 0;
+    }
+
+    static double second(double d) {
+        return d / 3.0;
+    }
+};
+
+template<>
+struct Workload<std::string> {
+    static std::string make(std::size_t i) {
+        return std::to_string(i);
+    }
+
+    static std::size_t first(const std::string& s) {
+        return s.size() + static_cast<std::size_t>(s.back());
+    }
+
+    static bool keep(std::size_t i) {
+        return i % 2 == 0;
+    }
+
+    static std::size_t second(std::size_t i) {
+        return i / 2;
+    }
+};
+
+template<class T>
+std::vector<T> makeInput(const std::size_t size) {
+    std::vector<T> input;
+    input.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        input.push_back(Workload<T>::make(i));
+    }
+    return input;
+}
+
+template<class T, int Depth>
+auto rawLoop(const std::vector<T>& input) {
+    using W = Workload<T>;
+    decltype(W::first(input.front())) sum{};
+    for (const auto& value : input) {
+        auto mapped = W::first(value);
+        if constexpr (Depth == 1) {
+            sum += mapped;
+        }
+        else {
+            if (!W::keep(mapped)) {
+                continue;
+            }
+            if constexpr (Depth == 2) {
+                sum += mapped;
+            }
+            else {
+                sum += W::second(mapped);
+            }
+        }
+    }
+    return sum;
+}
+
+template<class T, int Depth>
+auto lazyChain(const std::vector<T>& input) {
+    using W = Workload<T>;
+    auto mapped = lz::toIter(input).map([](const T& value) { return W::first(value); });
+    using Result = decltype(W::first(input.front()));
+    if constexpr (Depth == 1) {
+        return mapped.foldl(Result{}, [](Result acc, Result v) { return acc + v; });
+    }
+    else if constexpr (Depth == 2) {
+        return mapped.filter([](Result v) { return W::keep(v); }).foldl(Result{}, [](Result acc, Result v) { return acc + v; });
+    }
+    else {
+        return mapped.filter([](Result v) { return W::keep(v); })
+            .map([](Result v) { return W::second(v); })
+            .foldl(Result{}, [](Result acc, Result v) { return acc + v; });
+    }
+}
+
+#if defined(__cpp_lib_ranges)
+template<class T, int Depth>
+auto rangesPipeline(const std::vector<T>& input) {
+    using W = Workload<T>;
+    using Result = decltype(W::first(input.front()));
+    auto mapped = input | std::views::transform([](const T& value) { return W::first(value); });
+    Result sum{};
+    if constexpr (Depth == 1) {
+        for (Result v : mapped) {
+            sum += v;
+        }
+    }
+    else if constexpr (Depth == 2) {
+        for (Result v : mapped | std::views::filter([](Result r) { return W::keep(r); })) {
+            sum += v;
+        }
+    }
+    else {
+        for (Result v : mapped | std::views::filter([](Result r) { return W::keep(r); }) |
+                            std::views::transform([](Result r) { return W::second(r); })) {
+            sum += v;
+        }
+    }
+    return sum;
+}
+#endif
+
+// Average time of the raw loop in nanoseconds, measured outside of the benchmark timing so it can be used as a ratio. The
+// batch of repetitions doubles until it takes at least 10ms, so the clock reads don't dominate small inputs.
+template<class T, int Depth>
+double rawLoopNanos(const std::vector<T>& input) {
+    using Nanos = std::chrono::duration<double, std::nano>;
+    constexpr double minimumNanos = 1e7;
+
+    benchmark::DoNotOptimize(rawLoop<T, Depth>(input));
+    for (long long repetitions = 1;; repetitions *= 2) {
+        const auto start = std::chrono::steady_clock::now();
+        for (long long i = 0; i < repetitions; ++i) {
+            benchmark::DoNotOptimize(rawLoop<T, Depth>(input));
+        }
+        const Nanos elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() >= minimumNanos) {
+            return elapsed.count() / static_cast<double>(repetitions);
+        }
+    }
+}
+
+template<class T, int Depth, class Fn>
+void runScaling(benchmark::State& state, Fn fn) {
+    const auto input = makeInput<T>(static_cast<std::size_t>(state.range(0)));
+    const auto raw = rawLoopNanos<T, Depth>(input);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fn(input));
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    if (raw > 0 && state.iterations() > 0) {
+        state.counters["vsRawLoop"] = (elapsed.count() / static_cast<double>(state.iterations())) / raw;
+    }
+}
+
+template<class T, int Depth>
+static void RawLoop(benchmark::State& state) {
+    runScaling<T, Depth>(state, [](const std::vector<T>& input) { return rawLoop<T, Depth>(input); });
+}
+
+template<class T, int Depth>
+static void LazyChain(benchmark::State& state) {
+    runScaling<T, Depth>(state, [](const std::vector<T>& input) { return lazyChain<T, Depth>(input); });
+}
+
+#if defined(__cpp_lib_ranges)
+template<class T, int Depth>
+static void RangesPipeline(benchmark::State& state) {
+    runScaling<T, Depth>(state, [](const std::vector<T>& input) { return rangesPipeline<T, Depth>(input); });
+}
+#endif
+
+static void ArithmeticSizes(benchmark::internal::Benchmark* b) {
+    b->RangeMultiplier(10)->Range(100, 100000000)->Unit(benchmark::kMicrosecond);
+}
+
+static void StringSizes(benchmark::internal::Benchmark* b) {
+    b->RangeMultiplier(10)->Range(100, 1000000)->Unit(benchmark::kMicrosecond);
+}
+
+#if defined(__cpp_lib_ranges)
+#define LZ_SCALING_BENCHMARK(T, Depth, Sizes)                                                                                   \
+    BENCHMARK_TEMPLATE(RawLoop, T, Depth)->Apply(Sizes);                                                                       \
+    BENCHMARK_TEMPLATE(LazyChain, T, Depth)->Apply(Sizes);                                                                     \
+    BENCHMARK_TEMPLATE(RangesPipeline, T, Depth)->Apply(Sizes)
+#else
+#define LZ_SCALING_BENCHMARK(T, Depth, Sizes)                                                                                   \
+    BENCHMARK_TEMPLATE(RawLoop, T, Depth)->Apply(Sizes);                                                                       \
+    BENCHMARK_TEMPLATE(LazyChain, T, Depth)->Apply(Sizes)
+#endif
+
+LZ_SCALING_BENCHMARK(int, 1, ArithmeticSizes);
+LZ_SCALING_BENCHMARK(int, 2, ArithmeticSizes);
+LZ_SCALING_BENCHMARK(int, 3, ArithmeticSizes);
+LZ_SCALING_BENCHMARK(double, 1, ArithmeticSizes);
+LZ_SCALING_BENCHMARK(double, 2, ArithmeticSizes);
+LZ_SCALING_BENCHMARK(double, 3, ArithmeticSizes);
+LZ_SCALING_BENCHMARK(std::string, 1, StringSizes);
+LZ_SCALING_BENCHMARK(std::string, 2, StringSizes);
+LZ_SCALING_BENCHMARK(std::string, 3, StringSizes);
@@ -0,0 +1,4 @@
+// The chain of chain-iter-view.cpp with LZ_MINIMAL_INCLUDES, which leaves out <execution>
+#define LZ_MINIMAL_INCLUDES
+
+#include "chain-iter-view.cpp"
@@ -0,0 +1,24 @@
+// A longer chain with the member functions of lz::IterView, the way most code that includes Lz.hpp is written
+
+// Whether cpp-lazy uses <execution> depends on the standard headers that are included before it. With libstdc++ that is only
+// the case after <version>, which most code includes indirectly
+#ifdef __has_include
+#    if __has_include(<version>)
+#        include <version>
+#    endif
+#endif
+
+#include <Lz/Lz.hpp>
+
+#include <string>
+#include <vector>
+
+std::string iterViewChain(const std::vector<int>& input) {
+    return lz::toIter(input)
+        .map([](int i) { return i * 3; })
+        .filter([](int i) { return i % 2 == 0; })
+        .take(100)
+        .enumerate()
+        .map([](const std::pair<int, int>& pair) { return pair.first + pair.second; })
+        .toString(" ");
+}
@@ -0,0 +1,16 @@
+// A map and a filter over a vector, instantiated for three element types, using only the headers of these adaptors
+#include <Lz/Filter.hpp>
+#include <Lz/Map.hpp>
+
+#include <string>
+#include <vector>
+
+template<class T>
+std::vector<T> mapFilter(const std::vector<T>& input) {
+    auto doubled = lz::map(input, [](const T& value) { return value + value; });
+    return lz::filter(doubled, [](const T& value) { return !(value < value); }).toVector();
+}
+
+template std::vector<int> mapFilter(const std::vector<int>&);
+template std::vector<double> mapFilter(const std::vector<double>&);
+template std::vector<std::string> mapFilter(const std::vector<std::string>&);
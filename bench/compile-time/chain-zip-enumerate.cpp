@@ -0,0 +1,16 @@
+// Zips and enumerates several containers, which instantiates the tuple machinery of the multi-input adaptors
+#include <Lz/Enumerate.hpp>
+#include <Lz/Zip.hpp>
+
+#include <list>
+#include <string>
+#include <vector>
+
+double zipEnumerate(const std::vector<int>& ints, const std::list<double>& doubles, const std::vector<std::string>& strings) {
+    double sum = 0;
+    for (auto&& pair : lz::enumerate(lz::zip(ints, doubles, strings))) {
+        sum += static_cast<double>(pair.first) * std::get<1>(pair.second);
+        sum += static_cast<double>(std::get<0>(pair.second) + static_cast<int>(std::get<2>(pair.second).size()));
+    }
+    return sum;
+}
@@ -0,0 +1,11 @@
+// Only includes Lz.hpp, which is the baseline cost of every translation unit that includes it
+
+// Whether cpp-lazy uses <execution> depends on the standard headers that are included before it. With libstdc++ that is only
+// the case after <version>, which most code includes indirectly
+#ifdef __has_include
+#    if __has_include(<version>)
+#        include <version>
+#    endif
+#endif
+
+#include <Lz/Lz.hpp>
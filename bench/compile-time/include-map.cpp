@@ -0,0 +1,2 @@
+// Only includes the header of a single adaptor, to compare against include-lz.cpp
+#include <Lz/Map.hpp>
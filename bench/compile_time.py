@@ -0,0 +1,78 @@
+"""Measures the compile time and object size of the translation units in compile-time/.
+
+Every translation unit is compiled --repetitions times, of which the fastest is reported, as the others mostly measure the
+noise of the machine. With --time-trace, Clang writes a -ftime-trace JSON file next to every object, which can be opened in
+chrome://tracing, or aggregated over all translation units with ClangBuildAnalyzer:
+
+    ClangBuildAnalyzer --all <output directory> trace.bin && ClangBuildAnalyzer --analyze trace.bin
+
+Example:
+
+    python3 compile_time.py --compiler clang++ --flags="-std=c++17 -O2" --time-trace
+"""
+import argparse
+import csv
+import glob
+import os
+import shlex
+import subprocess
+import sys
+import time
+
+script_directory = os.path.dirname(os.path.abspath(__file__))
+
+
+def parse_arguments():
+    parser = argparse.ArgumentParser(description='Measures the compile time and object size of cpp-lazy chains')
+    parser.add_argument('--compiler', default=os.environ.get('CXX', 'c++'), help='The C++ compiler to measure')
+    parser.add_argument('--flags', default='-std=c++17 -O2', help='The flags to compile with')
+    parser.add_argument('--include', default=os.path.join(script_directory, '..', 'include'),
+                        help='The include directory of cpp-lazy')
+    parser.add_argument('--sources', default=os.path.join(script_directory, 'compile-time'),
+                        help='The directory with the translation units to measure')
+    parser.add_argument('--output', default='compile-time-results', help='The directory to write the objects to')
+    parser.add_argument('--repetitions', type=int, default=3, help='The amount of times every translation unit is compiled')
+    parser.add_argument('--time-trace', action='store_true', help='Let Clang write a -ftime-trace file per object')
+    parser.add_argument('--csv', help='Also write the results to this CSV file')
+    return parser.parse_args()
+
+
+def compile_once(command):
+    start = time.perf_counter()
+    result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    elapsed = time.perf_counter() - start
+    if result.returncode != 0:
+        sys.exit('{} failed:\n{}'.format(' '.join(command), result.stdout))
+    return elapsed
+
+
+def measure(arguments, source):
+    name = os.path.splitext(os.path.basename(source))[0]
+    obj = os.path.join(arguments.output, name + '.o')
+    command = [arguments.compiler] + shlex.split(arguments.flags) + ['-I', arguments.include, '-c', source, '-o', obj]
+    if arguments.time_trace:
+        command.append('-ftime-trace')
+    seconds = min(compile_once(command) for _ in range(arguments.repetitions))
+    return name, seconds, os.path.getsize(obj)
+
+
+def main():
+    arguments = parse_arguments()
+    os.makedirs(arguments.output, exist_ok=True)
+    sources = sorted(glob.glob(os.path.join(arguments.sources, '*.cpp')))
+    results = [measure(arguments, source) for source in sources]
+
+    name_width = max(len(name) for name, _, _ in results)
+    print('{:<{}} {:>12} {:>14}'.format('translation unit', name_width, 'time (s)', 'object (KiB)'))
+    for name, seconds, size in results:
+        print('{:<{}} {:>12.3f} {:>14.1f}'.format(name, name_width, seconds, size / 1024))
+
+    if arguments.csv:
+        with open(arguments.csv, 'w', newline='') as file:
+            writer = csv.writer(file)
+            writer.writerow(['name', 'seconds', 'bytes'])
+            writer.writerows(results)
+
+
+if __name__ == '__main__':
+    main()
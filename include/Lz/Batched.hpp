@@ -0,0 +1,88 @@
+#pragma once
+
+#ifndef LZ_BATCHED_HPP
+#    define LZ_BATCHED_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/BatchedIterator.hpp"
+
+namespace lz {
+template<class BatchIterator>
+class Batched final : public internal::BasicIteratorView<BatchIterator> {
+public:
+    using iterator = BatchIterator;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    LZ_CONSTEXPR_CXX_20 Batched(BatchIterator begin, BatchIterator end) :
+        internal::BasicIteratorView<iterator>(std::move(begin), std::move(end)) {
+    }
+
+    constexpr Batched() = default;
+};
+
+namespace internal {
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 Batched<BatchedIterType<Iterator>>
+batchedImpl(std::true_type /* isContiguous */, const Iterator& begin, const Iterator& end, const std::size_t batchSize) {
+    const auto first = contiguousData(begin, end);
+    const auto last = first + (end - begin);
+    return { { first, last, batchSize }, { last, last, batchSize } };
+}
+
+template<class Iterator>
+Batched<BatchedIterType<Iterator>>
+batchedImpl(std::false_type /* isContiguous */, Iterator begin, Iterator end, const std::size_t batchSize) {
+    auto state = std::make_shared<BatchedState<Iterator>>(std::move(begin), std::move(end), batchSize);
+    return { BatchedIterator<Iterator>(std::move(state)), BatchedIterator<Iterator>() };
+}
+} // namespace internal
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Yields the elements of [begin, end) in batches of `batchSize` contiguous elements, as a view of two `const T*`, so that any
+ * sequence can be passed to functions that take a pointer and a length, such as BLAS routines, SIMD kernels or `std::span`.
+ * If [begin, end) is contiguous memory, the views point into it directly. Otherwise, the elements are copied into a buffer that
+ * is allocated once, aligned to a cache line, and reused for every batch, so that the views are only valid until the next
+ * batch; the iterators are then input iterators. Example:
+ * ```cpp
+ * for (auto batch : lz::batched(lz::map(samples, normalize), 256)) {
+ *     kernel(batch.begin(), batch.size()); // Or std::span<const float>(batch.begin(), batch.end())
+ * }
+ * ```
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param batchSize The size of the batches, except for the last one, which can be smaller. Must be larger than 0.
+ * @return A Batched view, of which the `value_type` is `lz::internal::BasicIteratorView<const T*>`.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Batched<internal::BatchedIterType<Iterator>>
+batchedRange(Iterator begin, Iterator end, const std::size_t batchSize) {
+    return internal::batchedImpl(internal::IsContiguousIterator<Iterator>(), std::move(begin), std::move(end), batchSize);
+}
+
+/**
+ * Yields the elements of `iterable` in batches of `batchSize` contiguous elements. Iterables with a `data()` pointer, such as
+ * `std::vector`, are never copied. See `lz::batchedRange`.
+ * @param iterable The sequence to batch.
+ * @param batchSize The size of the batches, except for the last one, which can be smaller. Must be larger than 0.
+ * @return A Batched view, of which the `value_type` is `lz::internal::BasicIteratorView<const T*>`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Source = internal::BatchedSource<typename std::remove_reference<Iterable>::type>>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Batched<internal::BatchedIterType<typename Source::type>>
+batched(Iterable&& iterable, const std::size_t batchSize) {
+    return batchedRange(Source::begin(iterable), Source::end(iterable), batchSize);
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_BATCHED_HPP
@@ -0,0 +1,82 @@
+#pragma once
+
+#ifndef LZ_BINARY_RECORDS_HPP
+#    define LZ_BINARY_RECORDS_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/BinaryRecordIterator.hpp"
+
+namespace lz {
+template<class T, ByteOrder Order>
+class BinaryRecords final : public internal::BasicIteratorView<internal::BinaryRecordIterator<T, Order>> {
+public:
+    using iterator = internal::BinaryRecordIterator<T, Order>;
+    using const_iterator = iterator;
+    using value_type = T;
+
+    constexpr BinaryRecords(const char* data, const std::size_t count, const std::size_t stride) :
+        internal::BasicIteratorView<iterator>(iterator(data, 0, stride), iterator(data, count, stride)) {
+    }
+
+    constexpr BinaryRecords() = default;
+};
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Reads the bytes [begin, end) as a sequence of records of `stride` bytes, e.g. the packed structs of a file or a network
+ * buffer, and yields every record as a `T`, read from its first `sizeof(T)` bytes. Nothing is copied up front: a record is
+ * read when it is dereferenced, with a memcpy that compiles to plain loads, so the bytes don't have to be aligned for `T`.
+ * Records are returned by value rather than by reference, as the bytes generally are neither aligned for `T` nor a `T` object.
+ * If `Order` is not `lz::ByteOrder::native`, the bytes of every record are reversed, which requires `T` to be an arithmetic or
+ * enum type. Bytes at the end that don't make up a full record are ignored. Example:
+ * ```cpp
+ * #pragma pack(push, 1)
+ * struct Trade { std::uint64_t time; double price; std::uint32_t size; };
+ * #pragma pack(pop)
+ * lz::MappedFile file("trades.bin");
+ * auto large = lz::filter(lz::records<Trade>(file), [](const Trade& t) { return t.size > 1000; });
+ * // Every price, which is at offset 8 of a trade
+ * auto prices = lz::recordsRange<double>(file.data() + 8, file.data() + file.size(), sizeof(Trade));
+ * ```
+ * @tparam T The trivially copyable type of the records.
+ * @tparam Order The byte order of the records.
+ * @param begin The beginning of the bytes.
+ * @param end The ending of the bytes.
+ * @param stride The distance in bytes between the starts of two records. Must be at least `sizeof(T)`.
+ * @return A random access view of the records.
+ */
+template<class T, ByteOrder Order = ByteOrder::native>
+LZ_NODISCARD BinaryRecords<T, Order> recordsRange(const char* begin, const char* end, const std::size_t stride = sizeof(T)) {
+    LZ_ASSERT(stride >= sizeof(T), "the stride must be at least the size of a record");
+    const auto size = static_cast<std::size_t>(end - begin);
+    return { begin, size < sizeof(T) ? 0 : (size - sizeof(T)) / stride + 1, stride };
+}
+
+/**
+ * Reads `bytes` as a sequence of records of `stride` bytes, and yields every record as a `T`. See `lz::recordsRange`.
+ * @tparam T The trivially copyable type of the records.
+ * @tparam Order The byte order of the records.
+ * @param bytes The bytes, of which `data()` must point to contiguous bytes, e.g. a `std::vector<std::uint8_t>`, a `std::string`
+ * or an `lz::MappedFile`. The bytes are not copied, so they must outlive the view.
+ * @param stride The distance in bytes between the starts of two records. Must be at least `sizeof(T)`.
+ * @return A random access view of the records.
+ */
+template<class T, ByteOrder Order = ByteOrder::native, class Bytes>
+LZ_NODISCARD BinaryRecords<T, Order> records(const Bytes& bytes, const std::size_t stride = sizeof(T)) {
+    static_assert(internal::HasByteData<Bytes>::value, "bytes must have a data() that points to contiguous bytes, and a size()");
+    const char* data = reinterpret_cast<const char*>(bytes.data());
+    return recordsRange<T, Order>(data, data + bytes.size(), stride);
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_BINARY_RECORDS_HPP
@@ -0,0 +1,159 @@
+#pragma once
+
+#ifndef LZ_BIT_MASK_HPP
+#    define LZ_BIT_MASK_HPP
+
+#    include "Map.hpp"
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/BitMaskIterator.hpp"
+
+namespace lz {
+template<LZ_CONCEPT_ITERATOR Iterator>
+class SetBits final : public internal::BasicIteratorView<internal::SetBitsIterator<Iterator>> {
+public:
+    using iterator = internal::SetBitsIterator<Iterator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    LZ_CONSTEXPR_CXX_20 SetBits(Iterator begin, Iterator end) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(begin), end), iterator(end, end)) {
+    }
+
+    constexpr SetBits() = default;
+};
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Packs the results of `predicate` for every element of [begin, end) into a bit mask: bit `i % 64` of word `i / 64` is set if
+ * the predicate holds for the i-th element. The predicate is evaluated for every element without branching on its result. A
+ * mask takes one bit per element, so it is 8 times smaller than a `std::vector<bool>`-like mask of bytes, and
+ * `lz::setBits` and `lz::selectBits` skip 64 unselected elements at once. Example:
+ * ```cpp
+ * std::vector<int> prices = { 3, 12, 8, 20 };
+ * auto mask = lz::toBitMask(prices, [](int p) { return p > 5; }); // { 0b1110 }
+ * ```
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param predicate The predicate of which the results are packed.
+ * @return The words of the bit mask, of which the bits past the length of the sequence are zero.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class UnaryPredicate>
+std::vector<std::uint64_t> toBitMaskRange(Iterator begin, Iterator end, UnaryPredicate predicate) {
+    std::vector<std::uint64_t> words;
+    internal::packBits(internal::IsRandomAccess<Iterator>(), std::move(begin), end, predicate, words);
+    return words;
+}
+
+/**
+ * Packs the results of `predicate` for every element of `iterable` into a bit mask. See `lz::toBitMaskRange`.
+ * @param iterable The sequence.
+ * @param predicate The predicate of which the results are packed.
+ * @return The words of the bit mask, of which the bits past the length of the sequence are zero.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class UnaryPredicate>
+std::vector<std::uint64_t> toBitMask(Iterable&& iterable, UnaryPredicate predicate) {
+    return toBitMaskRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                          std::move(predicate));
+}
+
+/**
+ * Packs a sequence of flags, e.g. `bool`s, into a bit mask: bit `i % 64` of word `i / 64` is set if the i-th flag is `true` or
+ * converts to `true`. Flags of one byte that are contiguous in memory, e.g. a `std::vector<char>`, are packed 8 at a time.
+ * @param begin The beginning of the flags.
+ * @param end The ending of the flags.
+ * @return The words of the bit mask, of which the bits past the length of the sequence are zero.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+std::vector<std::uint64_t> toBitMaskRange(Iterator begin, Iterator end) {
+    std::vector<std::uint64_t> words;
+    internal::packFlags(internal::IsByteFlags<Iterator>(), begin, end, words);
+    return words;
+}
+
+/**
+ * Packs a sequence of flags into a bit mask. See `lz::toBitMaskRange`.
+ * @param iterable The flags.
+ * @return The words of the bit mask, of which the bits past the length of the sequence are zero.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+std::vector<std::uint64_t> toBitMask(Iterable&& iterable) {
+    return toBitMaskRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)));
+}
+
+/**
+ * Returns the indices of the set bits of a bit mask, in ascending order. Bit j of the i-th word has index
+ * `i * (bits per word) + j`. The words may be any unsigned integer type of at most 64 bits, e.g. the `std::uint64_t`s of
+ * `lz::toBitMask`. Every word is scanned with a count trailing zeros instruction, so words without set bits are skipped at once,
+ * and `size()` counts the set bits with a population count per word. Example:
+ * ```cpp
+ * std::vector<std::uint8_t> mask = { 0b00000101, 0, 0b10000000 };
+ * auto indices = lz::setBits(mask); // { 0, 2, 23 }
+ * ```
+ * @param begin The beginning of the words.
+ * @param end The ending of the words.
+ * @return A forward view of the indices.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SetBits<Iterator> setBitsRange(Iterator begin, Iterator end) {
+    return { std::move(begin), std::move(end) };
+}
+
+/**
+ * Returns the indices of the set bits of a bit mask, in ascending order. See `lz::setBitsRange`.
+ * @param iterable The words of the bit mask.
+ * @return A forward view of the indices.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SetBits<internal::IterTypeFromIterable<Iterable>> setBits(Iterable&& iterable) {
+    return setBitsRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)));
+}
+
+/**
+ * Selects the elements of a random access sequence of which the bit in a bit mask is set, like `lz::select` does for a sequence
+ * of flags. Instead of testing a flag per element, the set bits are found with a count trailing zeros instruction per selected
+ * element, so 64 elements that are not selected cost one comparison of a word with zero. The mask must not have bits set past
+ * the length of the sequence, which holds for the masks of `lz::toBitMask` of a sequence of the same length. Example:
+ * ```cpp
+ * std::vector<int> prices = { 3, 12, 8, 20 };
+ * auto mask = lz::toBitMask(prices, [](int p) { return p > 5; });
+ * auto selected = lz::selectBits(prices, mask); // { 12, 8, 20 }
+ * ```
+ * @param begin The beginning of the sequence to select from.
+ * @param wordsBegin The beginning of the words of the bit mask.
+ * @param wordsEnd The ending of the words of the bit mask.
+ * @return A forward map view of the selected elements, by reference if the sequence is.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, LZ_CONCEPT_ITERATOR WordIterator>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Map<internal::SetBitsIterator<WordIterator>, internal::IndexInto<Iterator>>
+selectBitsRange(Iterator begin, WordIterator wordsBegin, WordIterator wordsEnd) {
+    static_assert(internal::IsRandomAccess<Iterator>::value, "the sequence to select from must be random access");
+    return { internal::SetBitsIterator<WordIterator>(std::move(wordsBegin), wordsEnd),
+             internal::SetBitsIterator<WordIterator>(wordsEnd, wordsEnd), internal::IndexInto<Iterator>(std::move(begin)) };
+}
+
+/**
+ * Selects the elements of `iterable` of which the bit in `mask` is set. See `lz::selectBitsRange`.
+ * @param iterable The random access sequence to select from.
+ * @param mask The words of the bit mask.
+ * @return A forward map view of the selected elements, by reference if `iterable` is.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, LZ_CONCEPT_ITERABLE Mask>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Map<internal::SetBitsIterator<internal::IterTypeFromIterable<Mask>>,
+                                     internal::IndexInto<internal::IterTypeFromIterable<Iterable>>>
+selectBits(Iterable&& iterable, Mask&& mask) {
+    return selectBitsRange(internal::begin(std::forward<Iterable>(iterable)), internal::begin(std::forward<Mask>(mask)),
+                           internal::end(std::forward<Mask>(mask)));
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_BIT_MASK_HPP
@@ -0,0 +1,71 @@
+#pragma once
+
+#ifndef LZ_CACHED_HPP
+#    define LZ_CACHED_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/CachedIterator.hpp"
+
+namespace lz {
+template<LZ_CONCEPT_ITERATOR Iterator>
+class Cached final : public internal::BasicIteratorView<internal::CachedIterator<Iterator>> {
+public:
+    using iterator = internal::CachedIterator<Iterator>;
+    using const_iterator = iterator;
+    using value_type = internal::ValueType<Iterator>;
+
+    Cached(Iterator begin, Iterator end, const std::size_t chunkSize) :
+        internal::BasicIteratorView<iterator>(
+            iterator(std::make_shared<internal::CacheState<Iterator>>(std::move(begin), std::move(end), chunkSize)),
+            iterator()) {
+    }
+
+    Cached() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Returns a view that evaluates [begin, end) only once. The elements are copied into a buffer the first time they are iterated
+ * over, after which every iteration replays them from the buffer. The input is read in chunks of `chunkSize` elements when an
+ * iterator reaches them, so if only a prefix is iterated over, only that prefix (rounded up to whole chunks) is evaluated and
+ * stored. All copies of the view and of its iterators share the buffer, which may be filled by several threads at once.
+ * Example:
+ * ```cpp
+ * auto records = lz::cached(lz::map(lines, parse));
+ * auto total = lz::sum(records); // parses every line
+ * auto largest = lz::max(records); // doesn't parse again
+ * ```
+ * @param begin The beginning of the sequence, which may be an input iterator.
+ * @param end The ending of the sequence.
+ * @param chunkSize The amount of elements that is read from the input at once. Cannot be 0.
+ * @return A Cached iterator view object, of which the references stay valid as long as the view or one of its iterators lives.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD Cached<Iterator>
+cachedRange(Iterator begin, Iterator end, const std::size_t chunkSize = internal::defaultCacheChunkSize) {
+    return { std::move(begin), std::move(end), chunkSize };
+}
+
+/**
+ * Returns a view that evaluates `iterable` only once. See `lz::cachedRange`.
+ * @param iterable The sequence to cache, which may be an input iterable.
+ * @param chunkSize The amount of elements that is read from the input at once. Cannot be 0.
+ * @return A Cached iterator view object, of which the references stay valid as long as the view or one of its iterators lives.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Iterator = internal::IterTypeFromIterable<Iterable>>
+LZ_NODISCARD Cached<Iterator> cached(Iterable&& iterable, const std::size_t chunkSize = internal::defaultCacheChunkSize) {
+    return cachedRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                       chunkSize);
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_CACHED_HPP
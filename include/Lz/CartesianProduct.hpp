@@ -27,10 +27,12 @@ public:
 
 /**
  * Creates an iterator view object that, when iterated over, gets all possible combinations of all its values of the iterators.
- * @attention Please note that this is not an actual random access iterator. It uses the 'strongest' operator to increase/decrease
- * the iterators with. If the current iterator is bidirectional, it uses ++/--. If it is random access, it uses +/-. So if all
- * the iterators passed are random access, then this iterator is also true random access. If one of the iterators is bidirectional
- * then that iterator is incremented/decremented using the ++ and -- operators.
+ * The combinations are numbered as a mixed radix number, of which the last sequence is the least significant digit. If all
+ * iterators are random access, this is a true random access range of which the size is known: `begin() + k` goes to the k-th
+ * combination and the distance between two iterators is computed in O(1), so the product can be split into shards by index,
+ * e.g. with `lz::slice`, or iterated over by several threads.
+ * @attention If one of the iterators is not random access, jumping to a combination and computing distances take a time that
+ * is linear in the lengths of those sequences.
  * @param begin The tuple containing all the beginnings of the sequences.
  * @param end The ending containing all the endings of the sequences.
  * @return A cartesian product view object.
@@ -43,11 +45,12 @@ cartesianRange(std::tuple<Iterators...> begin, std::tuple<Iterators...> end) {
 
 /**
  * Creates an iterator view object that, when iterated over, gets all possible combinations of all its values of the iterables.
- * @attention Please note that this is not an actual random access iterator. It uses the 'strongest' operator to increase/decrease
- * the iterators with. If the current iterator is bidirectional, it uses ++/--. If it is random access, it uses +/-. So if all
- * the iterators passed are random access, then this iterator is also true random access. If one of the iterators is bidirectional
- * then that iterator is incremented/decremented using the ++ and -- operators, and in that case this iterator wouldn't be true
- * random access.
+ * The combinations are numbered as a mixed radix number, of which the last sequence is the least significant digit. If all
+ * iterators are random access, this is a true random access range of which the size is known: `begin() + k` goes to the k-th
+ * combination and the distance between two iterators is computed in O(1), so the product can be split into shards by index,
+ * e.g. with `lz::slice`, or iterated over by several threads.
+ * @attention If one of the iterators is not random access, jumping to a combination and computing distances take a time that
+ * is linear in the lengths of those sequences.
  * @param iterables The iterables to make all of the possible combinations with.
  * @return A cartesian product view object.
  */
@@ -3,6 +3,7 @@
 #ifndef LZ_CHUNK_IF_HPP
 #define LZ_CHUNK_IF_HPP
 
+#include "InlineBuffer.hpp"
 #include "detail/ChunkIfIterator.hpp"
 
 namespace lz {
@@ -93,6 +94,39 @@ ChunkIf<internal::IterTypeFromIterable<Iterable>, UnaryPredicate> chunkIf(Iterab
 }
 #endif // LZ_HAS_EXECUTION
 
+/**
+ * Returns a predicate that is true for the elements that are equal to `value`, to chop a sequence on a delimiter with
+ * `lz::chunkIf`, e.g. `lz::chunkIf(csvLine, lz::equalTo(','))`. Unlike a lambda, `lz::chunkIf` recognizes it if `value` is a
+ * number, and then searches for the delimiter like `lz::find` does: with memchr for characters, and a cache line at a time for
+ * other contiguous numbers of the same type as `value`.
+ * @param value The value of the delimiter.
+ * @return A predicate that returns `element == value`.
+ */
+template<class T>
+LZ_NODISCARD constexpr internal::EqualTo<T> equalTo(T value) {
+    return { std::move(value) };
+}
+
+/**
+ * Chops the sequence into pieces like `lz::chunkIf` does, and calls `function` with every piece, copied into a
+ * `lz::InlineBuffer<T, N>`. The same buffer is reused for all pieces, so pieces of at most `N` elements don't allocate, and
+ * larger pieces only allocate if they are larger than every piece before them. See `lz::chunksInto` for an example.
+ * @tparam N The amount of elements the buffer stores inline.
+ * @param iterable The iterable to chop up.
+ * @param unaryPredicate The predicate that must return a boolean, to indicate whether or not to make a new chunk.
+ * @param function Called in order with a `lz::InlineBuffer<T, N>&` for every piece. The elements may be modified or moved
+ * from, the buffer is cleared before every call.
+ */
+template<std::size_t N, LZ_CONCEPT_ITERABLE Iterable, class UnaryPredicate, class Function>
+void chunkIfInto(Iterable&& iterable, UnaryPredicate unaryPredicate, Function function) {
+    using Iterator = internal::IterTypeFromIterable<Iterable>;
+    InlineBuffer<internal::ValueType<Iterator>, N> buffer;
+    for (const internal::BasicIteratorView<Iterator>& piece : chunkIf(iterable, std::move(unaryPredicate))) {
+        buffer.assign(piece.begin(), piece.end());
+        function(buffer);
+    }
+}
+
 // End of group
 /**
  * @}
@@ -3,12 +3,50 @@
 #ifndef LZ_CHUNKS_HPP
 #    define LZ_CHUNKS_HPP
 
+#    include "InlineBuffer.hpp"
 #    include "detail/ChunksIterator.hpp"
+#    include "detail/Parallel.hpp"
 
 namespace lz {
 template<class, bool>
 class Chunks;
 
+//! A chunk of a sequence of `Iterator`s, as yielded by `lz::chunks` and passed to the function of `lz::parallelForEachChunk`.
+template<class Iterator>
+using Chunk = internal::BasicIteratorView<Iterator>;
+
+namespace internal {
+template<class Iterator, class Function>
+void parallelForEachChunk(std::true_type /* isRandomAccess */, const Iterator begin, const Iterator end,
+                          const std::size_t chunkSize, const Function& function, ThreadPool& pool) {
+    const auto length = static_cast<std::size_t>(end - begin);
+    const std::size_t chunkCount = length / chunkSize + (length % chunkSize != 0);
+    pool.parallelFor(chunkCount, [&](const std::size_t index) {
+        const std::size_t from = index * chunkSize;
+        const std::size_t to = (std::min)(from + chunkSize, length);
+        function(BasicIteratorView<Iterator>(begin + static_cast<DiffType<Iterator>>(from),
+                                             begin + static_cast<DiffType<Iterator>>(to)));
+    });
+}
+
+template<class Iterator, class Function>
+void parallelForEachChunk(std::false_type /* isRandomAccess */, Iterator begin, const Iterator end, const std::size_t chunkSize,
+                          const Function& function, ThreadPool& pool) {
+    // Chunk i is [boundaries[i], boundaries[i + 1])
+    std::vector<Iterator> boundaries;
+    boundaries.push_back(begin);
+    while (begin != end) {
+        for (std::size_t count = 0; count < chunkSize && begin != end; ++count, ++begin) {
+        }
+        boundaries.push_back(begin);
+    }
+    const std::size_t chunkCount = boundaries.size() - 1;
+    pool.parallelFor(chunkCount, [&](const std::size_t index) {
+        function(BasicIteratorView<Iterator>(boundaries[index], boundaries[index + 1]));
+    });
+}
+} // namespace internal
+
 template<class Iterator>
 class Chunks<Iterator, true> final : public internal::BasicIteratorView<internal::ChunksIterator<Iterator, true>> {
 public:
@@ -72,6 +110,83 @@ chunks(Iterable&& iterable, const std::size_t chunkSize) {
                        chunkSize);
 }
 
+/**
+ * Chops a sequence into chunks of `chunkSize` and calls `function` for every chunk on the threads of a pool, the calling
+ * thread included, returning after all chunks have been processed. Threads that are done with their own chunks steal chunks
+ * from the others, so chunks that take longer than others do not leave threads idle. The chunk boundaries of a random access
+ * sequence are computed in O(1), other sequences are walked once up front. Example:
+ * ```cpp
+ * std::vector<float> records = ...;
+ * std::vector<float> scores(records.size());
+ * lz::parallelForEachChunk(records, 4096, [&](lz::Chunk<std::vector<float>::iterator> chunk) {
+ *     const auto offset = chunk.begin() - records.begin();
+ *     std::transform(chunk.begin(), chunk.end(), scores.begin() + offset, score);
+ * });
+ * ```
+ * @param iterable The sequence to be chopped into chunks.
+ * @param chunkSize The size of the chunks, except for the last chunk, which can be smaller. Must be larger than 0.
+ * @param function Called with a `lz::Chunk` of every chunk. It is called from multiple threads at the same time, and in
+ * no particular order.
+ * @param policy The pool to run on, for instance `lz::execution::pool(4)`.
+ * @throws Anything `function` throws. After an exception, no new chunks are started and the first exception is rethrown once
+ * all threads are done.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Function>
+void parallelForEachChunk(Iterable&& iterable, const std::size_t chunkSize, Function function,
+                          const execution::PoolPolicy& policy) {
+    using Iterator = internal::IterTypeFromIterable<Iterable>;
+    LZ_ASSERT(chunkSize > 0, "chunk size must be larger than 0");
+    internal::parallelForEachChunk(internal::IsRandomAccess<Iterator>(), internal::begin(std::forward<Iterable>(iterable)),
+                                   internal::end(std::forward<Iterable>(iterable)), chunkSize, function, policy.pool());
+}
+
+/**
+ * Chops a sequence into chunks of `chunkSize` and calls `function` for every chunk on `threadCount` threads, the calling
+ * thread included. Runs on the pool that `lz::execution::pool(threadCount)` returns, so threads are only started the first
+ * time. See the overload taking an execution policy for details.
+ * @param iterable The sequence to be chopped into chunks.
+ * @param chunkSize The size of the chunks, except for the last chunk, which can be smaller. Must be larger than 0.
+ * @param function Called with a `lz::Chunk` of every chunk, from multiple threads at the same time.
+ * @param threadCount The amount of threads to use, or 0 to use all hardware threads.
+ * @throws Anything `function` throws.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Function>
+void parallelForEachChunk(Iterable&& iterable, const std::size_t chunkSize, Function function,
+                          const std::size_t threadCount = 0) {
+    parallelForEachChunk(std::forward<Iterable>(iterable), chunkSize, std::move(function), execution::pool(threadCount));
+}
+
+/**
+ * Chops a sequence into chunks of `chunkSize` and calls `function` with every chunk, copied into a `lz::InlineBuffer<T, N>`.
+ * The same buffer is reused for all chunks, so if `chunkSize` is at most `N`, no chunk allocates, unlike calling `toVector()`
+ * on every chunk of `lz::chunks`. If `chunkSize` is larger than `N`, the buffer allocates once and reuses that memory. The
+ * sequence is iterated only once, so this works for input iterators as well. Example:
+ * ```cpp
+ * lz::chunksInto<64>(records, 64, [](lz::InlineBuffer<Record, 64>& batch) { score(batch.data(), batch.size()); });
+ * ```
+ * @tparam N The amount of elements the buffer stores inline, ideally `chunkSize`.
+ * @param iterable The sequence to be chopped into chunks.
+ * @param chunkSize The size of the chunks, except for the last chunk, which can be smaller. Must be larger than 0.
+ * @param function Called in order with a `lz::InlineBuffer<T, N>&` for every chunk. The elements may be modified or moved
+ * from, the buffer is cleared after every call.
+ */
+template<std::size_t N, LZ_CONCEPT_ITERABLE Iterable, class Function>
+void chunksInto(Iterable&& iterable, const std::size_t chunkSize, Function function) {
+    LZ_ASSERT(chunkSize > 0, "chunk size must be larger than 0");
+    InlineBuffer<internal::ValueType<internal::IterTypeFromIterable<Iterable>>, N> buffer;
+    buffer.reserve(chunkSize);
+    for (auto&& value : iterable) {
+        buffer.emplaceBack(std::forward<decltype(value)>(value));
+        if (buffer.size() == chunkSize) {
+            function(buffer);
+            buffer.clear();
+        }
+    }
+    if (!buffer.empty()) {
+        function(buffer);
+    }
+}
+
 // End of group
 /**
  * @}
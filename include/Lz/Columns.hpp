@@ -0,0 +1,261 @@
+#pragma once
+
+#ifndef LZ_COLUMNS_HPP
+#    define LZ_COLUMNS_HPP
+
+#    include "Zip.hpp"
+
+#    include <vector>
+
+namespace lz {
+namespace internal {
+template<class... Ts, std::size_t... Is>
+void pushBackColumns(std::tuple<std::vector<Ts>...>& columns, IndexSequence<Is...>, Ts&&... values) {
+    const int expander[] = { (std::get<Is>(columns).push_back(std::move(values)), 0)... };
+    static_cast<void>(expander);
+}
+
+template<class... Ts, std::size_t... Is>
+void reserveColumns(std::tuple<std::vector<Ts>...>& columns, IndexSequence<Is...>, const std::size_t capacity) {
+    const int expander[] = { (std::get<Is>(columns).reserve(capacity), 0)... };
+    static_cast<void>(expander);
+}
+
+template<class... Ts, std::size_t... Is>
+void resizeColumns(std::tuple<std::vector<Ts>...>& columns, IndexSequence<Is...>, const std::size_t size) {
+    const int expander[] = { (std::get<Is>(columns).resize(size), 0)... };
+    static_cast<void>(expander);
+}
+
+template<class... Ts, std::size_t... Is>
+void clearColumns(std::tuple<std::vector<Ts>...>& columns, IndexSequence<Is...>) noexcept {
+    const int expander[] = { (std::get<Is>(columns).clear(), 0)... };
+    static_cast<void>(expander);
+}
+
+template<class Pointers, class Columns, std::size_t... Is>
+Pointers columnPointers(Columns& columns, IndexSequence<Is...>) noexcept {
+    return Pointers(std::get<Is>(columns).data()...);
+}
+
+template<class Result, class Tuple, std::size_t... Is>
+void pushBackTuple(Result& result, Tuple&& tuple, IndexSequence<Is...>) {
+    result.pushBack(std::get<Is>(std::forward<Tuple>(tuple))...);
+}
+
+template<class Tuple, class = MakeIndexSequence<std::tuple_size<Tuple>::value>>
+struct ColumnsFromTuple;
+
+template<class... Ts>
+struct HasBoolColumn : std::false_type {};
+
+template<class T, class... Ts>
+struct HasBoolColumn<T, Ts...> : std::integral_constant<bool, std::is_same<T, bool>::value || HasBoolColumn<Ts...>::value> {};
+} // namespace internal
+
+/**
+ * A record container that stores every field in its own contiguous array (a structure of arrays), instead of storing whole
+ * records next to each other. Scanning a single field then only reads the memory of that field. Every column is a view that
+ * can be passed to all adaptors, for e.g. `lz::filter(columns.column<1>(), isExpensive)`, and the rows are zipped over a single
+ * shared index with `lz::zipContiguous`, which is what iterating the container itself does. Example:
+ * ```cpp
+ * lz::Columns<int, double> trades;  // id, price
+ * trades.pushBack(1, 10.5);
+ * trades.pushBack(2, 11.25);
+ * double total = std::accumulate(trades.column<1>().begin(), trades.column<1>().end(), 0.);
+ * for (std::tuple<int&, double&> row : trades) {
+ *     std::get<1>(row) *= 2;
+ * }
+ * ```
+ * @tparam Ts The types of the fields. `bool` is not supported, as `std::vector<bool>` stores bits, use e.g. `char` instead.
+ */
+template<class... Ts>
+class Columns {
+    static_assert(sizeof...(Ts) > 1, "Columns requires more than 1 column, use a std::vector instead");
+    static_assert(!internal::HasBoolColumn<Ts...>::value,
+                  "Columns cannot store bool, as std::vector<bool> has no contiguous storage, use char instead");
+
+    using MakeIndexSequenceForThis = internal::MakeIndexSequence<sizeof...(Ts)>;
+    std::tuple<std::vector<Ts>...> _columns;
+
+public:
+    //! The row view, which zips all columns over a single index.
+    using Rows = ZipContiguous<Ts*...>;
+    //! The row view of a const container.
+    using ConstRows = ZipContiguous<const Ts*...>;
+    //! The view of column `I`.
+    template<std::size_t I>
+    using Column = internal::BasicIteratorView<internal::TupleElement<I, std::tuple<Ts...>>*>;
+    //! The view of column `I` of a const container.
+    template<std::size_t I>
+    using ConstColumn = internal::BasicIteratorView<const internal::TupleElement<I, std::tuple<Ts...>>*>;
+
+    using iterator = typename Rows::iterator;
+    using const_iterator = typename ConstRows::iterator;
+    using value_type = std::tuple<Ts...>;
+
+    Columns() = default;
+
+    /**
+     * Creates a container of `size` default constructed rows.
+     * @param size The amount of rows.
+     */
+    explicit Columns(const std::size_t size) {
+        resize(size);
+    }
+
+    LZ_NODISCARD std::size_t size() const noexcept {
+        return std::get<0>(_columns).size();
+    }
+
+    LZ_NODISCARD bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    //! Reserves room for `capacity` rows in every column.
+    void reserve(const std::size_t capacity) {
+        internal::reserveColumns(_columns, MakeIndexSequenceForThis(), capacity);
+    }
+
+    //! Resizes every column to `size` rows.
+    void resize(const std::size_t size) {
+        internal::resizeColumns(_columns, MakeIndexSequenceForThis(), size);
+    }
+
+    void clear() noexcept {
+        internal::clearColumns(_columns, MakeIndexSequenceForThis());
+    }
+
+    //! Appends a row, of which every value is appended to its column.
+    void pushBack(Ts... values) {
+        internal::pushBackColumns(_columns, MakeIndexSequenceForThis(), std::move(values)...);
+    }
+
+    //! Row `index`, as references to its fields.
+    LZ_NODISCARD std::tuple<Ts&...> operator[](const std::size_t index) {
+        return rows().begin()[static_cast<std::ptrdiff_t>(index)];
+    }
+
+    //! Row `index`, as references to its fields.
+    LZ_NODISCARD std::tuple<const Ts&...> operator[](const std::size_t index) const {
+        return rows().begin()[static_cast<std::ptrdiff_t>(index)];
+    }
+
+    //! The values of field `I` of all rows, as a contiguous view.
+    template<std::size_t I>
+    LZ_NODISCARD Column<I> column() noexcept {
+        auto& values = std::get<I>(_columns);
+        return { values.data(), values.data() + values.size() };
+    }
+
+    //! The values of field `I` of all rows, as a contiguous view.
+    template<std::size_t I>
+    LZ_NODISCARD ConstColumn<I> column() const noexcept {
+        const auto& values = std::get<I>(_columns);
+        return { values.data(), values.data() + values.size() };
+    }
+
+    //! The underlying storage of field `I`, for e.g. to pass it to an API that expects a `std::vector`.
+    template<std::size_t I>
+    LZ_NODISCARD const std::vector<internal::TupleElement<I, std::tuple<Ts...>>>& columnVector() const noexcept {
+        return std::get<I>(_columns);
+    }
+
+    //! All rows, zipped over a single index.
+    LZ_NODISCARD Rows rows() noexcept {
+        return { internal::columnPointers<std::tuple<Ts*...>>(_columns, MakeIndexSequenceForThis()),
+                 static_cast<std::ptrdiff_t>(size()) };
+    }
+
+    //! All rows, zipped over a single index.
+    LZ_NODISCARD ConstRows rows() const noexcept {
+        return { internal::columnPointers<std::tuple<const Ts*...>>(_columns, MakeIndexSequenceForThis()),
+                 static_cast<std::ptrdiff_t>(size()) };
+    }
+
+    LZ_NODISCARD iterator begin() noexcept {
+        return rows().begin();
+    }
+
+    LZ_NODISCARD iterator end() noexcept {
+        return rows().end();
+    }
+
+    LZ_NODISCARD const_iterator begin() const noexcept {
+        return rows().begin();
+    }
+
+    LZ_NODISCARD const_iterator end() const noexcept {
+        return rows().end();
+    }
+};
+
+namespace internal {
+template<class Tuple, std::size_t... Is>
+struct ColumnsFromTuple<Tuple, IndexSequence<Is...>> {
+    using type = Columns<Decay<TupleElement<Is, Tuple>>...>;
+};
+
+template<class Iterator, class... Projections>
+using ProjectedColumns = Columns<Decay<FunctionReturnType<Projections, RefType<Iterator>>>...>;
+
+template<class Iterator>
+using TupleColumns = typename ColumnsFromTuple<ValueType<Iterator>>::type;
+
+template<class Result, class Iterable>
+Result reservedColumns(const Iterable& iterable) {
+    Result result;
+    const SizeHint hint = sizeHint(std::begin(iterable), std::end(iterable));
+    result.reserve(hint.lower);
+    return result;
+}
+} // namespace internal
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Splits the records of `iterable` into columns. Every projection is called once per record and its result becomes a column,
+ * for e.g. `lz::toColumns(trades, [](const Trade& t) { return t.id; }, [](const Trade& t) { return t.price; })`.
+ * @param iterable The records.
+ * @param projection The function that extracts the first field of a record.
+ * @param projections The functions that extract the other fields of a record.
+ * @return A `lz::Columns` with a column for every projection, of which the rows have the same order as `iterable`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Projection, class... Projections>
+LZ_NODISCARD internal::ProjectedColumns<internal::IterTypeFromIterable<Iterable>, Projection, Projections...>
+toColumns(Iterable&& iterable, Projection projection, Projections... projections) {
+    using Result = internal::ProjectedColumns<internal::IterTypeFromIterable<Iterable>, Projection, Projections...>;
+    auto result = internal::reservedColumns<Result>(iterable);
+    for (auto&& record : iterable) {
+        result.pushBack(projection(record), projections(record)...);
+    }
+    return result;
+}
+
+/**
+ * Splits an iterable of tuples (or pairs) into columns, one per tuple element, for e.g. to store the result of `lz::zip` or
+ * `lz::toVector` as a structure of arrays.
+ * @param iterable The tuples.
+ * @return A `lz::Columns` with a column for every tuple element, of which the rows have the same order as `iterable`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD internal::TupleColumns<internal::IterTypeFromIterable<Iterable>> toColumns(Iterable&& iterable) {
+    auto result = internal::reservedColumns<internal::TupleColumns<internal::IterTypeFromIterable<Iterable>>>(iterable);
+    for (auto&& record : iterable) {
+        using Tuple = internal::Decay<decltype(record)>;
+        internal::pushBackTuple(result, record, internal::MakeIndexSequence<std::tuple_size<Tuple>::value>());
+    }
+    return result;
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_COLUMNS_HPP
@@ -8,9 +8,9 @@
 
 namespace lz {
 template<class... Iterators>
-class Concatenate final : public internal::BasicIteratorView<internal::ConcatenateIterator<Iterators...>> {
+class Concatenate final : public internal::BasicIteratorView<internal::ConcatenateIteratorFor<Iterators...>> {
 public:
-    using iterator = internal::ConcatenateIterator<Iterators...>;
+    using iterator = internal::ConcatenateIteratorFor<Iterators...>;
     using const_iterator = iterator;
     using value_type = typename iterator::value_type;
 
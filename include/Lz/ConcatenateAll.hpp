@@ -0,0 +1,66 @@
+#pragma once
+
+#ifndef LZ_CONCATENATE_ALL_HPP
+#    define LZ_CONCATENATE_ALL_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/ConcatenateAllIterator.hpp"
+
+namespace lz {
+template<LZ_CONCEPT_ITERATOR Iterator>
+class ConcatenateAll final : public internal::BasicIteratorView<internal::ConcatenateAllIterator<Iterator>> {
+public:
+    using iterator = internal::ConcatenateAllIterator<Iterator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    explicit ConcatenateAll(const std::shared_ptr<const internal::ConcatenateAllSegments<Iterator>>& segments) :
+        internal::BasicIteratorView<iterator>(iterator(segments, false), iterator(segments, true)) {
+    }
+
+    ConcatenateAll() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Concatenates a runtime amount of ranges, for e.g. a `std::vector` of views, where `lz::concat` only concatenates a fixed
+ * amount. The beginnings and endings of the ranges are copied once into a buffer that is shared by the iterators. If the ranges
+ * are sized, the amount of elements before every range is stored as well, so that a random access iterator can jump to any
+ * element with a binary search over the ranges, in O(log k). Iterating with `lz::forEach` and the like runs a loop per range.
+ * @param begin The beginning of the sequence of ranges.
+ * @param end The ending of the sequence of ranges.
+ * @return A concatenate all view object, which has the iterator category of the ranges.
+ */
+template<LZ_CONCEPT_ITERATOR OuterIterator>
+LZ_NODISCARD ConcatenateAll<internal::IterTypeFromIterable<internal::RefType<OuterIterator>>>
+concatAllRange(OuterIterator begin, OuterIterator end) {
+    using Iterator = internal::IterTypeFromIterable<internal::RefType<OuterIterator>>;
+    return ConcatenateAll<Iterator>(
+        std::make_shared<const internal::ConcatenateAllSegments<Iterator>>(std::move(begin), std::move(end)));
+}
+
+/**
+ * Concatenates a runtime amount of ranges, for e.g. a `std::vector` of views, where `lz::concat` only concatenates a fixed
+ * amount. The beginnings and endings of the ranges are copied once into a buffer that is shared by the iterators. If the ranges
+ * are sized, the amount of elements before every range is stored as well, so that a random access iterator can jump to any
+ * element with a binary search over the ranges, in O(log k). Iterating with `lz::forEach` and the like runs a loop per range.
+ * @param ranges The sequence of ranges, of which the ranges must outlive the returned view.
+ * @return A concatenate all view object, which has the iterator category of the ranges.
+ */
+template<LZ_CONCEPT_ITERABLE Iterables>
+LZ_NODISCARD ConcatenateAll<internal::IterTypeFromIterable<internal::RefType<internal::IterTypeFromIterable<Iterables>>>>
+concatAll(Iterables&& ranges) {
+    return concatAllRange(internal::begin(std::forward<Iterables>(ranges)), internal::end(std::forward<Iterables>(ranges)));
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_CONCATENATE_ALL_HPP
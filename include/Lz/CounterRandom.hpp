@@ -0,0 +1,94 @@
+#pragma once
+
+#ifndef LZ_COUNTER_RANDOM_HPP
+#    define LZ_COUNTER_RANDOM_HPP
+
+#    include "Random.hpp"
+#    include "detail/CounterRandomIterator.hpp"
+
+namespace lz {
+template<LZ_CONCEPT_ARITHMETIC Arithmetic>
+class CounterRandom final : public internal::BasicIteratorView<internal::CounterRandomIterator<Arithmetic>> {
+public:
+    using iterator = internal::CounterRandomIterator<Arithmetic>;
+    using const_iterator = iterator;
+    using value_type = Arithmetic;
+
+    constexpr CounterRandom(const std::uint64_t key, const Arithmetic min, const Arithmetic max, const std::ptrdiff_t amount) :
+        internal::BasicIteratorView<iterator>(iterator(key, 0, min, max), iterator(key, amount, min, max)) {
+    }
+
+    constexpr CounterRandom() = default;
+
+    /**
+     * Writes the elements [`offset`, `offset` + distance(`first`, `last`)) of the view to [`first`, `last`). This computes
+     * two elements per Philox block and is faster than copying from the iterators. Because every element only depends on its
+     * index, a large buffer can be filled in parts by different threads, using the offset of each part. Example:
+     * ```cpp
+     * std::vector<float> buffer(1024);
+     * lz::counterRandom(0.f, 1.f, 1'000'000, 42).fillTo(buffer.begin(), buffer.end(), 4096); // Elements [4096, 5120)
+     * ```
+     * @param first The start of the range to write to.
+     * @param last The end of the range to write to.
+     * @param offset The index of the first element to write.
+     */
+    template<class Iterator>
+    void fillTo(Iterator first, Iterator last, const std::ptrdiff_t offset = 0) const {
+        LZ_ASSERT(offset >= 0 && offset + std::distance(first, last) <= this->distance(), "cannot fill past the end of the view");
+        this->begin().fill(std::move(first), std::move(last), offset);
+    }
+
+    /**
+     * Writes the first `size(range)` elements of the view to `range`, e.g. a `std::vector` or `std::span`. See
+     * `fillTo(Iterator, Iterator, std::ptrdiff_t)`.
+     * @param range The range to write to.
+     * @param offset The index of the first element to write.
+     */
+    template<class Range>
+    void fillTo(Range&& range, const std::ptrdiff_t offset = 0) const {
+        fillTo(std::begin(range), std::end(range), offset);
+    }
+};
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Returns a random access view of `amount` random numbers in [`min`, `max`] for integers, or [`min`, `max`) for
+ * floating point numbers, in which element `i` only depends on `key` and `i`.
+ * @details Unlike `lz::random`, no generator is advanced: every element is computed with the counter based Philox4x32-10
+ * generator, using `i` as counter. So `view[i]` costs the same for every `i`, the same key always gives the same sequence on
+ * every platform, regardless of the order in which the elements are computed, and the view can be split among threads or
+ * materialized in parallel without changing the result. Integers are mapped onto the range with a multiplication, for a
+ * bias of at most (`max` - `min`) / 2^64. Example:
+ * ```cpp
+ * auto dice = lz::counterRandom(1, 6, 1'000'000'000, 42);
+ * int last = dice.begin()[999'999'999]; // Computed directly
+ * ```
+ * @param min The minimum value, included.
+ * @param max The maximum value, included for integers, excluded for floating point numbers.
+ * @param amount The amount of numbers in the view.
+ * @param key Identifies the sequence. Defaults to `lz::randomSeed()`, use a fixed key to get reproducible results.
+ * @return A CounterRandom object that can be converted to an arbitrary container or can be iterated over using
+ * `for (auto... lz::counterRandom(...))`.
+ */
+template<LZ_CONCEPT_ARITHMETIC Arithmetic>
+LZ_NODISCARD CounterRandom<Arithmetic>
+counterRandom(const Arithmetic min, const Arithmetic max, const std::size_t amount, const std::uint64_t key = randomSeed()) {
+#    ifndef LZ_HAS_CONCEPTS
+    static_assert(std::is_arithmetic<Arithmetic>::value, "min/max type should be arithmetic");
+#    endif // LZ_HAS_CONCEPTS
+    LZ_ASSERT(min <= max, "min cannot be larger than max");
+    return { key, min, max, static_cast<std::ptrdiff_t>(amount) };
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_COUNTER_RANDOM_HPP
@@ -0,0 +1,105 @@
+#pragma once
+
+#ifndef LZ_CSV_SPLITTER_HPP
+#define LZ_CSV_SPLITTER_HPP
+
+#include "detail/BasicIteratorView.hpp"
+#include "detail/CsvIterator.hpp"
+#include "detail/SplitIterator.hpp"
+
+namespace lz {
+template<class SubString>
+class CsvSplitter final : public internal::BasicIteratorView<internal::CsvIterator<SubString>> {
+public:
+    using iterator = internal::CsvIterator<SubString>;
+    using const_iterator = iterator;
+    using value_type = SubString;
+
+    CsvSplitter(const char* data, const std::size_t size, const char separator, const char quote, const bool isRecords) :
+        internal::BasicIteratorView<iterator>(iterator(data, size, separator, quote, isRecords, false),
+                                              iterator(data, size, separator, quote, isRecords, true)) {
+    }
+
+    CsvSplitter() = default;
+};
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Splits CSV text (RFC 4180) into its records. Records are separated by `'\n'`, except when the `'\n'` is between
+ * quotes, lose a trailing `'\r'`, and a trailing `'\n'` does not start an empty record. Only a pointer to the characters is
+ * kept, so they must outlive the returned view. The records can be split into fields using `lz::csvFields`, for instance by
+ * using `lz::map`.
+ * @tparam SubString The string type of the records. If C++17, this will default to `std::string_view`. If `LZ_STANDALONE` is
+ * not defined and C++17 is not defined, this will default to `std::string`. Otherwise it will default to `fmt::string_view`.
+ * @tparam CharRange A type with `data()` and `size()` members that refers to contiguous characters, such as `std::string`.
+ * @param text The CSV text to split.
+ * @param quote The character that quotes fields.
+ * @return A CsvSplitter object that can be converted to an arbitrary container or can be iterated over using
+ * `for (auto... lz::csvRecords(...))`.
+ */
+template<class SubString = StringView, class CharRange, class = internal::EnableIf<internal::HasCharData<CharRange>::value>>
+LZ_NODISCARD CsvSplitter<SubString> csvRecords(const CharRange& text, const char quote = '"') {
+    return { text.data(), text.size(), '\n', quote, true };
+}
+
+template<class SubString = StringView, class CharRange,
+         class = internal::EnableIf<internal::HasCharData<CharRange>::value && !std::is_lvalue_reference<CharRange>::value &&
+                                    !internal::IsView<CharRange>::value>>
+CsvSplitter<SubString> csvRecords(CharRange&& text, char quote = '"') = delete;
+
+/**
+ * @brief Splits a CSV record (RFC 4180) into its fields. Delimiters between quotes are part of the field. Fields are returned
+ * without their surrounding quotes, but escaped quotes (`""`) are left as is, so that no field has to be copied; use
+ * `lz::unescapeCsv` on fields that may contain them. As long as no quote is found, splitting is as fast as `lz::split`. Only
+ * a pointer to the characters is kept, so they must outlive the returned view.
+ * @tparam SubString The string type of the fields. If C++17, this will default to `std::string_view`. If `LZ_STANDALONE` is
+ * not defined and C++17 is not defined, this will default to `std::string`. Otherwise it will default to `fmt::string_view`.
+ * @tparam CharRange A type with `data()` and `size()` members that refers to contiguous characters, such as `std::string`.
+ * @param record The CSV record to split.
+ * @param delimiter The character that separates the fields, `','` for CSV, `'\t'` for TSV.
+ * @param quote The character that quotes fields.
+ * @return A CsvSplitter object that can be converted to an arbitrary container or can be iterated over using
+ * `for (auto... lz::csvFields(...))`.
+ */
+template<class SubString = StringView, class CharRange, class = internal::EnableIf<internal::HasCharData<CharRange>::value>>
+LZ_NODISCARD CsvSplitter<SubString> csvFields(const CharRange& record, const char delimiter = ',', const char quote = '"') {
+    return { record.data(), record.size(), delimiter, quote, false };
+}
+
+template<class SubString = StringView, class CharRange,
+         class = internal::EnableIf<internal::HasCharData<CharRange>::value && !std::is_lvalue_reference<CharRange>::value &&
+                                    !internal::IsView<CharRange>::value>>
+CsvSplitter<SubString> csvFields(CharRange&& record, char delimiter = ',', char quote = '"') = delete;
+
+/**
+ * @brief Replaces the escaped quotes (`""`) of a field returned by `lz::csvFields` by a single quote.
+ * @param field The field to unescape.
+ * @param quote The character that quotes fields.
+ * @return The unescaped field.
+ */
+template<class CharRange, class = internal::EnableIf<internal::HasCharData<CharRange>::value>>
+LZ_NODISCARD std::string unescapeCsv(const CharRange& field, const char quote = '"') {
+    std::string result;
+    result.reserve(field.size());
+    const char* data = field.data();
+    for (std::size_t i = 0; i < field.size(); ++i) {
+        result.push_back(data[i]);
+        if (data[i] == quote && i + 1 < field.size() && data[i + 1] == quote) {
+            ++i;
+        }
+    }
+    return result;
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_CSV_SPLITTER_HPP
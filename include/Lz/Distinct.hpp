@@ -0,0 +1,87 @@
+#pragma once
+
+#ifndef LZ_DISTINCT_HPP
+#    define LZ_DISTINCT_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/DistinctIterator.hpp"
+
+namespace lz {
+template<LZ_CONCEPT_ITERATOR Iterator, class Hash, class KeyEqual, class Allocator>
+class Distinct final : public internal::BasicIteratorView<internal::DistinctIterator<Iterator, Hash, KeyEqual, Allocator>> {
+    using Index = internal::DistinctIndex<internal::Decay<internal::ValueType<Iterator>>, Hash, KeyEqual, Allocator>;
+
+public:
+    using iterator = internal::DistinctIterator<Iterator, Hash, KeyEqual, Allocator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    Distinct(Iterator begin, Iterator end, const std::size_t capacityHint, const Hash& hash, const KeyEqual& keyEqual,
+             const Allocator& allocator) :
+        Distinct(std::move(begin), std::move(end), std::make_shared<Index>(capacityHint, hash, keyEqual, allocator)) {
+    }
+
+    Distinct() = default;
+
+private:
+    Distinct(Iterator begin, Iterator end, const std::shared_ptr<Index>& index) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(begin), end, index), iterator(end, end, index)) {
+    }
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Returns a view of the first occurrence of every distinct value in [begin, end), in the order of [begin, end). Unlike
+ * `lz::uniqueRange`, [begin, end) does not have to be sorted: the values that have been seen are kept in a hash map that is
+ * filled lazily while iterating, and shared by all iterators of this view.
+ * @attention Every distinct value is copied into the hash map, so for large values consider `lz::unique` on a sorted range.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param capacityHint The expected amount of distinct values, used to reserve the hash map up front. 0 does not reserve.
+ * @param hash The hash function for the values of [begin, end).
+ * @param keyEqual The equality function for the values of [begin, end).
+ * @param allocator The allocator for the hash map. Is rebound to the node type of the map.
+ * @return A Distinct iterator view object, which can be used to iterate over in a `(for ... : distinctRange(...))` fashion.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Hash = std::hash<internal::Decay<internal::ValueType<Iterator>>>,
+         class KeyEqual = std::equal_to<internal::Decay<internal::ValueType<Iterator>>>,
+         class Allocator = std::allocator<internal::Decay<internal::ValueType<Iterator>>>>
+LZ_NODISCARD Distinct<Iterator, Hash, KeyEqual, Allocator>
+distinctRange(Iterator begin, Iterator end, const std::size_t capacityHint = 0, const Hash& hash = {},
+              const KeyEqual& keyEqual = {}, const Allocator& allocator = {}) {
+    return { std::move(begin), std::move(end), capacityHint, hash, keyEqual, allocator };
+}
+
+/**
+ * @brief Returns a view of the first occurrence of every distinct value in `iterable`, in the order of `iterable`. Unlike
+ * `lz::unique`, `iterable` does not have to be sorted: the values that have been seen are kept in a hash map that is filled
+ * lazily while iterating, and shared by all iterators of this view.
+ * @attention Every distinct value is copied into the hash map, so for large values consider `lz::unique` on a sorted range.
+ * @param iterable The iterable sequence.
+ * @param capacityHint The expected amount of distinct values, used to reserve the hash map up front. 0 does not reserve.
+ * @param hash The hash function for the values of `iterable`.
+ * @param keyEqual The equality function for the values of `iterable`.
+ * @param allocator The allocator for the hash map. Is rebound to the node type of the map.
+ * @return A Distinct iterator view object, which can be used to iterate over in a `(for ... : distinct(...))` fashion.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Hash = std::hash<internal::Decay<internal::ValueTypeIterable<Iterable>>>,
+         class KeyEqual = std::equal_to<internal::Decay<internal::ValueTypeIterable<Iterable>>>,
+         class Allocator = std::allocator<internal::Decay<internal::ValueTypeIterable<Iterable>>>>
+LZ_NODISCARD Distinct<internal::IterTypeFromIterable<Iterable>, Hash, KeyEqual, Allocator>
+distinct(Iterable&& iterable, const std::size_t capacityHint = 0, const Hash& hash = {}, const KeyEqual& keyEqual = {},
+         const Allocator& allocator = {}) {
+    return distinctRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                         capacityHint, hash, keyEqual, allocator);
+}
+
+// End of group
+/**
+ * @}
+ */
+} // end namespace lz
+
+#endif // end LZ_DISTINCT_HPP
@@ -15,13 +15,27 @@ public:
 
     using value_type = typename iterator::value_type;
 
+private:
+    // Random access iterators derive their index from the distance to begin, so they do not need the distance
+    LZ_CONSTEXPR_CXX_20 Enumerate(Iterator begin, Iterator end, internal::DiffType<iterator>, const IntType start,
+                                  std::true_type /* isRandomAccess */) :
+        internal::BasicIteratorView<iterator>(iterator(start, begin, begin), iterator(start, begin, end)) {
+    }
+
+    LZ_CONSTEXPR_CXX_20 Enumerate(Iterator begin, Iterator end, const internal::DiffType<iterator> distance,
+                                  const IntType start, std::false_type /* isRandomAccess */) :
+        internal::BasicIteratorView<iterator>(iterator(start, std::move(begin)),
+                                              iterator(static_cast<IntType>(start + distance), std::move(end))) {
+    }
+
+public:
     LZ_CONSTEXPR_CXX_20 Enumerate(Iterator begin, Iterator end, const IntType start = 0) :
-        Enumerate(begin, end, static_cast<IntType>(internal::getIterLength(begin, end), start)) {
+        Enumerate(begin, end, internal::getIterLength(begin, end), start) {
     }
 
     LZ_CONSTEXPR_CXX_20
     Enumerate(Iterator begin, Iterator end, const internal::DiffType<iterator> distance, const IntType start = 0) :
-        internal::BasicIteratorView<iterator>(iterator(start, begin), iterator(static_cast<IntType>(distance), end)) {
+        Enumerate(std::move(begin), std::move(end), distance, start, internal::IsRandomAccess<Iterator>()) {
     }
 
     constexpr Enumerate() = default;
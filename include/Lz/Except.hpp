@@ -3,8 +3,11 @@
 #ifndef LZ_EXCEPT_HPP
 #define LZ_EXCEPT_HPP
 
+#include "Filter.hpp"
 #include "detail/BasicIteratorView.hpp"
 #include "detail/ExceptIterator.hpp"
+#include "detail/ExclusionSet.hpp"
+#include "detail/KeyFilter.hpp"
 
 namespace lz {
 #ifdef LZ_HAS_EXECUTION
@@ -87,6 +90,125 @@ LZ_NODISCARD LZ_CONSTEXPR_CXX_20
                        internal::end(std::forward<IterableToExcept>(toExcept)), std::move(comparer), execPolicy);
 }
 
+/**
+ * @brief Skips elements in [begin, end) that are contained by [toExceptBegin, toExceptEnd). Unlike `exceptRange`, the
+ * sequence to except does not have to be sorted: it's put in a hash set once (or scanned linearly if it has only a handful of
+ * elements), making every lookup O(1).
+ * @param begin The beginning of the sequence to skip elements in.
+ * @param end The ending of the sequence to skip elements in.
+ * @param toExceptBegin The beginning of the sequence that may not be contained in [begin, end).
+ * @param toExceptEnd The ending of the sequence that may not be contained in [begin, end).
+ * @param hash The hash function for the values of IteratorToExcept.
+ * @param keyEqual The equality function for the values of IteratorToExcept.
+ * @param execPolicy The std::execution::* policy.
+ * @return A Filter view object.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, LZ_CONCEPT_ITERATOR IteratorToExcept,
+         class Hash = std::hash<internal::ValueType<IteratorToExcept>>,
+         class KeyEqual = std::equal_to<internal::ValueType<IteratorToExcept>>,
+         class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD Filter<Iterator, internal::HashedExclusionPredicate<IteratorToExcept, Hash, KeyEqual>, Execution>
+exceptHashedRange(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd, Hash hash = {},
+                  KeyEqual keyEqual = {}, Execution execPolicy = std::execution::seq) {
+    return filterRange(std::move(begin), std::move(end),
+                       internal::makeHashedExclusionPredicate(std::move(toExceptBegin), std::move(toExceptEnd), hash, keyEqual),
+                       execPolicy);
+}
+
+/**
+ * @brief Skips elements in `iterable` that are contained by `toExcept`. Unlike `except`, `toExcept` does not have to be
+ * sorted: it's put in a hash set once (or scanned linearly if it has only a handful of elements), making every lookup O(1).
+ * @param iterable Sequence to iterate over.
+ * @param toExcept Sequence that contains items that must be skipped in `iterable`.
+ * @param hash The hash function for the values of IterableToExcept.
+ * @param keyEqual The equality function for the values of IterableToExcept.
+ * @param execPolicy The std::execution::* policy.
+ * @return A Filter view object.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, LZ_CONCEPT_ITERABLE IterableToExcept,
+         class Hash = std::hash<internal::ValueTypeIterable<IterableToExcept>>,
+         class KeyEqual = std::equal_to<internal::ValueTypeIterable<IterableToExcept>>,
+         class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD Filter<internal::IterTypeFromIterable<Iterable>,
+                    internal::HashedExclusionPredicate<internal::IterTypeFromIterable<IterableToExcept>, Hash, KeyEqual>,
+                    Execution>
+exceptHashed(Iterable&& iterable, IterableToExcept&& toExcept, Hash hash = {}, KeyEqual keyEqual = {},
+             Execution execPolicy = std::execution::seq) {
+    return exceptHashedRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                             internal::begin(std::forward<IterableToExcept>(toExcept)),
+                             internal::end(std::forward<IterableToExcept>(toExcept)), std::move(hash), std::move(keyEqual),
+                             execPolicy);
+}
+
+/**
+ * @brief Skips elements in `iterable` that are contained by the caller provided set `toExcept`, for e.g. a
+ * `std::unordered_set` that is reused across multiple views. Only the member function `count(value)` of the set is used.
+ * @attention `toExcept` is not copied and must outlive this view.
+ * @param iterable Sequence to iterate over.
+ * @param toExcept The set that contains items that must be skipped in `iterable`.
+ * @param execPolicy The std::execution::* policy.
+ * @return A Filter view object.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Set, class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20
+Filter<internal::IterTypeFromIterable<Iterable>, internal::NotContainedIn<const Set*>, Execution>
+exceptIn(Iterable&& iterable, const Set& toExcept, Execution execPolicy = std::execution::seq) {
+    return filter(std::forward<Iterable>(iterable), internal::NotContainedIn<const Set*>{ std::addressof(toExcept) }, execPolicy);
+}
+
+/**
+ * @brief Skips elements in [begin, end) that are contained by [toExceptBegin, toExceptEnd), like `exceptRange`, but for integral
+ * values. An `lz::KeyFilter` is built once from [toExceptBegin, toExceptEnd), which rejects most values that aren't in it
+ * before the binary search is done. Use this when most values of [begin, end) are not in [toExceptBegin, toExceptEnd).
+ * @attention [toExceptBegin, toExceptEnd) must be sorted manually before creating this view.
+ * @param begin The beginning of the sequence to skip elements in.
+ * @param end The ending of the sequence to skip elements in.
+ * @param toExceptBegin The beginning of the sequence that may not be contained in [begin, end).
+ * @param toExceptEnd The ending of the sequence that may not be contained in [begin, end).
+ * @param falsePositiveRate The false positive rate of the key filter, in (0, 1). Lower is faster but uses more memory.
+ * @param comparer Comparer for binary search (operator < is default) in IteratorToExcept.
+ * @param execPolicy The std::execution::* policy.
+ * @return A Filter view object.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, LZ_CONCEPT_ITERATOR IteratorToExcept, class Comparer = std::less<>,
+         class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD Filter<Iterator, internal::PrefilteredExclusionPredicate<IteratorToExcept, Comparer>, Execution>
+exceptPrefilteredRange(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd,
+                       const double falsePositiveRate = internal::defaultFalsePositiveRate, Comparer comparer = {},
+                       Execution execPolicy = std::execution::seq) {
+    return filterRange(std::move(begin), std::move(end),
+                       internal::makePrefilteredExclusionPredicate(std::move(toExceptBegin), std::move(toExceptEnd),
+                                                                   std::move(comparer), falsePositiveRate),
+                       execPolicy);
+}
+
+/**
+ * @brief Skips elements in `iterable` that are contained by `toExcept`, like `except`, but for integral values. An
+ * `lz::KeyFilter` is built once from `toExcept`, which rejects most values that aren't in it before the binary search is
+ * done. Use this when most values of `iterable` are not in `toExcept`.
+ * @attention ToExcept must be sorted manually before creating this view.
+ * @param iterable Sequence to iterate over.
+ * @param toExcept Sequence that contains items that must be skipped in `iterable`.
+ * @param falsePositiveRate The false positive rate of the key filter, in (0, 1). Lower is faster but uses more memory.
+ * @param comparer Comparer for binary search (operator < is default) in IterableToExcept
+ * @param execPolicy The std::execution::* policy.
+ * @return A Filter view object.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, LZ_CONCEPT_ITERABLE IterableToExcept, class Comparer = std::less<>,
+         class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD Filter<internal::IterTypeFromIterable<Iterable>,
+                    internal::PrefilteredExclusionPredicate<internal::IterTypeFromIterable<IterableToExcept>, Comparer>,
+                    Execution>
+exceptPrefiltered(Iterable&& iterable, IterableToExcept&& toExcept,
+                  const double falsePositiveRate = internal::defaultFalsePositiveRate, Comparer comparer = {},
+                  Execution execPolicy = std::execution::seq) {
+    return exceptPrefilteredRange(internal::begin(std::forward<Iterable>(iterable)),
+                                  internal::end(std::forward<Iterable>(iterable)),
+                                  internal::begin(std::forward<IterableToExcept>(toExcept)),
+                                  internal::end(std::forward<IterableToExcept>(toExcept)), falsePositiveRate,
+                                  std::move(comparer), execPolicy);
+}
+
 #else // ^^^ has execution vvv ! has execution
 /**
  * @brief Skips elements in [begin, end) that is contained by [toExceptBegin, toExceptEnd). [toExceptBegin, toExceptEnd) must be
@@ -128,6 +250,113 @@ except(Iterable&& iterable, IterableToExcept&& toExcept, Comparer comparer = {})
                        internal::begin(std::forward<IterableToExcept>(toExcept)),
                        internal::end(std::forward<IterableToExcept>(toExcept)), std::move(comparer));
 }
+
+/**
+ * @brief Skips elements in [begin, end) that are contained by [toExceptBegin, toExceptEnd). Unlike `exceptRange`, the
+ * sequence to except does not have to be sorted: it's put in a hash set once (or scanned linearly if it has only a handful of
+ * elements), making every lookup O(1).
+ * @param begin The beginning of the sequence to skip elements in.
+ * @param end The ending of the sequence to skip elements in.
+ * @param toExceptBegin The beginning of the sequence that may not be contained in [begin, end).
+ * @param toExceptEnd The ending of the sequence that may not be contained in [begin, end).
+ * @param hash The hash function for the values of IteratorToExcept.
+ * @param keyEqual The equality function for the values of IteratorToExcept.
+ * @return A Filter view object.
+ */
+template<class Iterator, class IteratorToExcept, class Hash = std::hash<internal::ValueType<IteratorToExcept>>,
+         class KeyEqual = std::equal_to<internal::ValueType<IteratorToExcept>>>
+Filter<Iterator, internal::HashedExclusionPredicate<IteratorToExcept, Hash, KeyEqual>>
+exceptHashedRange(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd, Hash hash = {},
+                  KeyEqual keyEqual = {}) {
+    return filterRange(std::move(begin), std::move(end),
+                       internal::makeHashedExclusionPredicate(std::move(toExceptBegin), std::move(toExceptEnd), hash, keyEqual));
+}
+
+/**
+ * @brief Skips elements in `iterable` that are contained by `toExcept`. Unlike `except`, `toExcept` does not have to be
+ * sorted: it's put in a hash set once (or scanned linearly if it has only a handful of elements), making every lookup O(1).
+ * @param iterable Sequence to iterate over.
+ * @param toExcept Sequence that contains items that must be skipped in `iterable`.
+ * @param hash The hash function for the values of IterableToExcept.
+ * @param keyEqual The equality function for the values of IterableToExcept.
+ * @return A Filter view object.
+ */
+template<class Iterable, class IterableToExcept, class Hash = std::hash<internal::ValueTypeIterable<IterableToExcept>>,
+         class KeyEqual = std::equal_to<internal::ValueTypeIterable<IterableToExcept>>>
+Filter<internal::IterTypeFromIterable<Iterable>,
+       internal::HashedExclusionPredicate<internal::IterTypeFromIterable<IterableToExcept>, Hash, KeyEqual>>
+exceptHashed(Iterable&& iterable, IterableToExcept&& toExcept, Hash hash = {}, KeyEqual keyEqual = {}) {
+    return exceptHashedRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                             internal::begin(std::forward<IterableToExcept>(toExcept)),
+                             internal::end(std::forward<IterableToExcept>(toExcept)), std::move(hash), std::move(keyEqual));
+}
+
+/**
+ * @brief Skips elements in `iterable` that are contained by the caller provided set `toExcept`, for e.g. a
+ * `std::unordered_set` that is reused across multiple views. Only the member function `count(value)` of the set is used.
+ * @attention `toExcept` is not copied and must outlive this view.
+ * @param iterable Sequence to iterate over.
+ * @param toExcept The set that contains items that must be skipped in `iterable`.
+ * @return A Filter view object.
+ */
+template<class Iterable, class Set>
+Filter<internal::IterTypeFromIterable<Iterable>, internal::NotContainedIn<const Set*>>
+exceptIn(Iterable&& iterable, const Set& toExcept) {
+    return filter(std::forward<Iterable>(iterable), internal::NotContainedIn<const Set*>{ std::addressof(toExcept) });
+}
+/**
+ * @brief Skips elements in [begin, end) that are contained by [toExceptBegin, toExceptEnd), like `exceptRange`, but for integral
+ * values. An `lz::KeyFilter` is built once from [toExceptBegin, toExceptEnd), which rejects most values that aren't in it
+ * before the binary search is done. Use this when most values of [begin, end) are not in [toExceptBegin, toExceptEnd).
+ * @attention [toExceptBegin, toExceptEnd) must be sorted manually before creating this view.
+ * @param begin The beginning of the sequence to skip elements in.
+ * @param end The ending of the sequence to skip elements in.
+ * @param toExceptBegin The beginning of the sequence that may not be contained in [begin, end).
+ * @param toExceptEnd The ending of the sequence that may not be contained in [begin, end).
+ * @param falsePositiveRate The false positive rate of the key filter, in (0, 1). Lower is faster but uses more memory.
+ * @param comparer Comparer for binary search (operator < is default) in IteratorToExcept.
+ * @return A Filter view object.
+ */
+#ifdef LZ_HAS_CXX_11
+template<class Iterator, class IteratorToExcept, class Comparer = std::less<internal::ValueType<Iterator>>>
+#else
+template<class Iterator, class IteratorToExcept, class Comparer = std::less<>>
+#endif // LZ_HAS_CXX_11
+Filter<Iterator, internal::PrefilteredExclusionPredicate<IteratorToExcept, Comparer>>
+exceptPrefilteredRange(Iterator begin, Iterator end, IteratorToExcept toExceptBegin, IteratorToExcept toExceptEnd,
+                       const double falsePositiveRate = internal::defaultFalsePositiveRate, Comparer comparer = {}) {
+    return filterRange(std::move(begin), std::move(end),
+                       internal::makePrefilteredExclusionPredicate(std::move(toExceptBegin), std::move(toExceptEnd),
+                                                                   std::move(comparer), falsePositiveRate));
+}
+
+/**
+ * @brief Skips elements in `iterable` that are contained by `toExcept`, like `except`, but for integral values. An
+ * `lz::KeyFilter` is built once from `toExcept`, which rejects most values that aren't in it before the binary search is
+ * done. Use this when most values of `iterable` are not in `toExcept`.
+ * @attention ToExcept must be sorted manually before creating this view.
+ * @param iterable Sequence to iterate over.
+ * @param toExcept Sequence that contains items that must be skipped in `iterable`.
+ * @param falsePositiveRate The false positive rate of the key filter, in (0, 1). Lower is faster but uses more memory.
+ * @param comparer Comparer for binary search (operator < is default) in IterableToExcept
+ * @return A Filter view object.
+ */
+#ifdef LZ_HAS_CXX_11
+template<class Iterable, class IterableToExcept, class Comparer = std::less<internal::ValueTypeIterable<Iterable>>>
+#else
+template<class Iterable, class IterableToExcept, class Comparer = std::less<>>
+#endif // LZ_HAS_CXX_11
+Filter<internal::IterTypeFromIterable<Iterable>,
+       internal::PrefilteredExclusionPredicate<internal::IterTypeFromIterable<IterableToExcept>, Comparer>>
+exceptPrefiltered(Iterable&& iterable, IterableToExcept&& toExcept,
+                  const double falsePositiveRate = internal::defaultFalsePositiveRate, Comparer comparer = {}) {
+    return exceptPrefilteredRange(internal::begin(std::forward<Iterable>(iterable)),
+                                  internal::end(std::forward<Iterable>(iterable)),
+                                  internal::begin(std::forward<IterableToExcept>(toExcept)),
+                                  internal::end(std::forward<IterableToExcept>(toExcept)), falsePositiveRate,
+                                  std::move(comparer));
+}
+
 #endif // LZ_HAS_EXECUTION
 
 // End of group
@@ -17,7 +17,9 @@ public:
 
     LZ_CONSTEXPR_CXX_20
     Exclude(Iterator begin, Iterator end, const internal::DiffType<Iterator> from, const internal::DiffType<Iterator> to) :
-        internal::BasicIteratorView<iterator>(iterator(begin, begin, end, from, to), iterator(end, begin, end, from, to)) {
+        internal::BasicIteratorView<iterator>(
+            iterator(begin, 0, from, to),
+            iterator(end, internal::excludeEndIndex(internal::IsRandomAccess<Iterator>(), begin, end), from, to)) {
     }
 };
 
@@ -30,7 +30,7 @@ public:
                                               iterator(end, begin, end, function, execution)) {
     }
 #else
-    Filter(Iterator begin, Iterator end, UnaryPredicate function) :
+    LZ_CONSTEXPR_CXX_20 Filter(Iterator begin, Iterator end, UnaryPredicate function) :
         internal::BasicIteratorView<iterator>(iterator(begin, begin, end, function), iterator(end, begin, end, function)) {
     }
 #endif
@@ -83,7 +83,8 @@ filter(Iterable&& iterable, UnaryPredicate predicate, Execution execPolicy = std
  * over.
  */
 template<class Iterator, class UnaryPredicate>
-Filter<Iterator, UnaryPredicate> filterRange(Iterator begin, Iterator end, UnaryPredicate predicate) {
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Filter<Iterator, UnaryPredicate>
+filterRange(Iterator begin, Iterator end, UnaryPredicate predicate) {
     static_assert(std::is_convertible<decltype(predicate(*begin)), bool>::value,
                   "function return type must be convertible to a bool");
     return { std::move(begin), std::move(end), std::move(predicate) };
@@ -99,7 +100,8 @@ Filter<Iterator, UnaryPredicate> filterRange(Iterator begin, Iterator end, Unary
  * over using `for (auto... lz::filter(...))`.
  */
 template<class Iterable, class UnaryPredicate>
-Filter<internal::IterTypeFromIterable<Iterable>, UnaryPredicate> filter(Iterable&& iterable, UnaryPredicate predicate) {
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Filter<internal::IterTypeFromIterable<Iterable>, UnaryPredicate>
+filter(Iterable&& iterable, UnaryPredicate predicate) {
     return filterRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
                        std::move(predicate));
 }
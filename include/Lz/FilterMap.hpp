@@ -0,0 +1,67 @@
+#pragma once
+
+#ifndef LZ_FILTER_MAP_HPP
+#    define LZ_FILTER_MAP_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/FilterMapIterator.hpp"
+
+namespace lz {
+template<LZ_CONCEPT_ITERATOR Iterator, class Function>
+class FilterMap final : public internal::BasicIteratorView<internal::FilterMapIterator<Iterator, Function>> {
+public:
+    using iterator = internal::FilterMapIterator<Iterator, Function>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    LZ_CONSTEXPR_CXX_20 FilterMap(Iterator begin, Iterator end, Function function) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(begin), end, function), iterator(end, end, function)) {
+    }
+
+    constexpr FilterMap() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Calls `function` for every element of [begin, end) and yields the values of the results that are engaged. `function` must
+ * return an optional-like type, that is contextually convertible to `bool` and dereferenceable, such as `std::optional` or a
+ * pointer. Unlike the `filterMap` overload that takes a filter and a map function, `function` is called exactly once per element,
+ * so a predicate that depends on an expensive transformation (parse-then-validate) does not compute it twice. Example:
+ * ```cpp
+ * std::vector<std::string> lines = { "1", "x", "3" };
+ * auto numbers = lz::filterMap(lines, [](const std::string& s) { return tryParseInt(s); }); // { 1, 3 }
+ * ```
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param function The function that returns an optional-like value for every element.
+ * @return A FilterMap iterator view object, whose `value_type` is the type of the engaged values.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Function>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 FilterMap<Iterator, Function> filterMapRange(Iterator begin, Iterator end, Function function) {
+    return { std::move(begin), std::move(end), std::move(function) };
+}
+
+/**
+ * Calls `function` for every element of `iterable` and yields the values of the results that are engaged. See
+ * `lz::filterMapRange`.
+ * @param iterable The sequence to filter and map.
+ * @param function The function that returns an optional-like value for every element.
+ * @return A FilterMap iterator view object, whose `value_type` is the type of the engaged values.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Function, class Iterator = internal::IterTypeFromIterable<Iterable>>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 FilterMap<Iterator, Function> filterMap(Iterable&& iterable, Function function) {
+    return filterMapRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                          std::move(function));
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_FILTER_MAP_HPP
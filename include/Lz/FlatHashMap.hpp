@@ -0,0 +1,452 @@
+#pragma once
+
+#ifndef LZ_FLAT_HASH_MAP_HPP
+#    define LZ_FLAT_HASH_MAP_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/ByteMask.hpp"
+#    include "detail/FunctionContainer.hpp"
+
+#    include <cstdint>
+#    include <functional>
+#    include <memory>
+#    include <stdexcept>
+#    include <utility>
+
+namespace lz {
+namespace internal {
+// Every slot of a flat hash map has a control byte. Slots that hold a value store the upper 7 bits of the hash of the key, so
+// that a lookup compares 8 control bytes at once (see ByteMask.hpp) and only compares the keys of the slots of which the bytes
+// match. Free slots have their high bit set
+constexpr LZ_INLINE_VAR unsigned char emptyControl = 0x80;
+constexpr LZ_INLINE_VAR unsigned char deletedControl = 0xFE;
+constexpr LZ_INLINE_VAR std::size_t controlGroupSize = 8;
+constexpr LZ_INLINE_VAR std::uint64_t highBits = 0x8080808080808080ULL;
+
+LZ_NODISCARD constexpr std::uint64_t xorShift(const std::uint64_t x, const unsigned shift) noexcept {
+    return x ^ (x >> shift);
+}
+
+// std::hash is the identity for integers, so the hash is mixed with the splitmix64 finalizer before its bits are used. Every bit
+// of the result depends on every bit of the hash, so the group can be taken from the low bits and the control byte from the
+// high bits, even for keys that only differ in their high bits, such as multiples of a power of two
+LZ_NODISCARD constexpr std::uint64_t mixHash(const std::uint64_t hash) noexcept {
+    return xorShift(xorShift(xorShift(hash, 30u) * 0xBF58476D1CE4E5B9ULL, 27u) * 0x94D049BB133111EBULL, 31u);
+}
+
+LZ_NODISCARD constexpr unsigned char hashControl(const std::uint64_t mixed) noexcept {
+    return static_cast<unsigned char>(mixed >> 57u);
+}
+
+LZ_NODISCARD inline std::uint64_t matchControl(const unsigned char* group, const unsigned char control) noexcept {
+    return gatherHighBits(zeroBytes(loadWord(reinterpret_cast<const char*>(group)) ^ broadcastByte(control)));
+}
+
+LZ_NODISCARD inline std::uint64_t matchFree(const unsigned char* group) noexcept {
+    return gatherHighBits(loadWord(reinterpret_cast<const char*>(group)) & highBits);
+}
+} // namespace internal
+
+/**
+ * A hash map that stores its values in one array instead of in separately allocated nodes, with open addressing. Next to the
+ * values, a byte of the hash of every key is stored, so that a lookup compares the control bytes of 8 slots at once and only
+ * compares keys of which the byte matches. Looking up and inserting therefore touch one or two cache lines, instead of
+ * following a linked list. Unlike `std::unordered_map`, inserting or erasing (may) invalidate all iterators and references, as
+ * the values are moved when the map grows. Use `lz::toFlatHashMap` to create one from a view, which reserves room for all
+ * elements up front so that the values are placed without ever growing the table.
+ * @tparam Key The key type.
+ * @tparam Value The mapped type.
+ * @tparam Hash The hash function, `std::hash<Key>` by default.
+ * @tparam KeyEqual The key comparer, `std::equal_to<Key>` by default.
+ */
+template<class Key, class Value, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+class FlatHashMap {
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<const Key, Value>;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+
+private:
+    union Slot {
+        value_type value;
+
+        Slot() noexcept {
+        }
+
+        ~Slot() {
+        }
+    };
+
+    std::unique_ptr<unsigned char[]> _control;
+    std::unique_ptr<Slot[]> _slots;
+    std::size_t _capacity{ 0 };
+    std::size_t _size{ 0 };
+    std::size_t _deleted{ 0 };
+    internal::FunctionContainer<Hash> _hash;
+    internal::FunctionContainer<KeyEqual> _equal;
+
+    template<class Map, class Reference>
+    class Iterator {
+        friend class FlatHashMap;
+        template<class, class>
+        friend class Iterator;
+
+        Map* _map{ nullptr };
+        std::size_t _index{ 0 };
+
+        void skipFree() noexcept {
+            while (_index != _map->_capacity && (_map->_control[_index] & internal::emptyControl) != 0) {
+                ++_index;
+            }
+        }
+
+        Iterator(Map* map, const std::size_t index) noexcept : _map(map), _index(index) {
+            skipFree();
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = FlatHashMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = Reference&;
+        using pointer = Reference*;
+
+        Iterator() = default;
+
+        // A const iterator can be created from a mutable one
+        template<class M, class R, class = internal::EnableIf<std::is_convertible<R*, Reference*>::value>>
+        Iterator(const Iterator<M, R>& other) noexcept : _map(other._map), _index(other._index) { // NOLINT
+        }
+
+        reference operator*() const noexcept {
+            return _map->_slots[_index].value;
+        }
+
+        pointer operator->() const noexcept {
+            return std::addressof(**this);
+        }
+
+        Iterator& operator++() noexcept {
+            ++_index;
+            skipFree();
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            Iterator tmp(*this);
+            ++*this;
+            return tmp;
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) noexcept {
+            return a._index == b._index;
+        }
+
+        friend bool operator!=(const Iterator& a, const Iterator& b) noexcept {
+            return !(a == b); // NOLINT
+        }
+    };
+
+public:
+    using iterator = Iterator<FlatHashMap, value_type>;
+    using const_iterator = Iterator<const FlatHashMap, const value_type>;
+
+private:
+    std::uint64_t mixedHash(const Key& key) const {
+        return internal::mixHash(static_cast<std::uint64_t>(_hash(key)));
+    }
+
+    std::size_t groupMask() const noexcept {
+        return _capacity / internal::controlGroupSize - 1;
+    }
+
+    // The groups are visited in triangular order, which visits every group once as the amount of groups is a power of two
+    std::size_t find(const Key& key, const std::uint64_t mixed) const {
+        if (_capacity == 0) {
+            return _capacity;
+        }
+        const unsigned char control = internal::hashControl(mixed);
+        std::size_t group = static_cast<std::size_t>(mixed) & groupMask();
+        for (std::size_t step = 1;; ++step) {
+            const unsigned char* controls = _control.get() + group * internal::controlGroupSize;
+            for (std::uint64_t matches = internal::matchControl(controls, control); matches != 0; matches &= matches - 1) {
+                const std::size_t index = group * internal::controlGroupSize + internal::countTrailingZeros(matches);
+                if (_equal(_slots[index].value.first, key)) {
+                    return index;
+                }
+            }
+            if (internal::matchControl(controls, internal::emptyControl) != 0 || step > groupMask()) {
+                return _capacity;
+            }
+            group = (group + step) & groupMask();
+        }
+    }
+
+    std::size_t freeSlot(const std::uint64_t mixed) const noexcept {
+        std::size_t group = static_cast<std::size_t>(mixed) & groupMask();
+        for (std::size_t step = 1;; ++step) {
+            const std::uint64_t free = internal::matchFree(_control.get() + group * internal::controlGroupSize);
+            if (free != 0) {
+                return group * internal::controlGroupSize + internal::countTrailingZeros(free);
+            }
+            group = (group + step) & groupMask();
+        }
+    }
+
+    template<class... Args>
+    std::size_t place(const std::uint64_t mixed, Args&&... args) {
+        const std::size_t index = freeSlot(mixed);
+        ::new (static_cast<void*>(std::addressof(_slots[index].value))) value_type(std::forward<Args>(args)...);
+        if (_control[index] == internal::deletedControl) {
+            --_deleted;
+        }
+        _control[index] = internal::hashControl(mixed);
+        ++_size;
+        return index;
+    }
+
+    void destroy() noexcept {
+        for (std::size_t i = 0; i != _capacity; ++i) {
+            if ((_control[i] & internal::emptyControl) == 0) {
+                _slots[i].value.~value_type();
+            }
+        }
+    }
+
+    // At most 7 / 8 of the slots are used (or deleted), so that every probe sequence reaches a free slot quickly
+    static std::size_t capacityFor(const std::size_t size) noexcept {
+        std::size_t capacity = internal::controlGroupSize;
+        while (capacity - capacity / 8 < size) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    void rehash(const std::size_t capacity) {
+        FlatHashMap other(_hash, _equal);
+        other._control.reset(new unsigned char[capacity]);
+        std::fill(other._control.get(), other._control.get() + capacity, internal::emptyControl);
+        other._slots.reset(new Slot[capacity]);
+        other._capacity = capacity;
+        for (std::size_t i = 0; i != _capacity; ++i) {
+            if ((_control[i] & internal::emptyControl) == 0) {
+                value_type& value = _slots[i].value;
+                other.place(other.mixedHash(value.first), std::move(value));
+            }
+        }
+        swap(other);
+    }
+
+    void growFor(const std::size_t extra) {
+        if (_size + _deleted + extra > _capacity - _capacity / 8) {
+            rehash(capacityFor(_size + extra));
+        }
+    }
+
+    FlatHashMap(const internal::FunctionContainer<Hash>& hash, const internal::FunctionContainer<KeyEqual>& equal) :
+        _hash(hash),
+        _equal(equal) {
+    }
+
+public:
+    /**
+     * Creates an empty map.
+     * @param capacity The amount of elements that can be inserted without growing the table.
+     * @param hash The hash function.
+     * @param equal The key comparer.
+     */
+    explicit FlatHashMap(const std::size_t capacity = 0, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual()) :
+        _hash(hash),
+        _equal(equal) {
+        reserve(capacity);
+    }
+
+    FlatHashMap(const FlatHashMap& other) : FlatHashMap(other._hash, other._equal) {
+        reserve(other._size);
+        for (const value_type& value : other) {
+            place(mixedHash(value.first), value);
+        }
+    }
+
+    FlatHashMap(FlatHashMap&& other) noexcept : _hash(other._hash), _equal(other._equal) {
+        swap(other);
+    }
+
+    FlatHashMap& operator=(FlatHashMap other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    ~FlatHashMap() {
+        destroy();
+    }
+
+    void swap(FlatHashMap& other) noexcept {
+        using std::swap;
+        swap(_control, other._control);
+        swap(_slots, other._slots);
+        swap(_capacity, other._capacity);
+        swap(_size, other._size);
+        swap(_deleted, other._deleted);
+        swap(_hash, other._hash);
+        swap(_equal, other._equal);
+    }
+
+    LZ_NODISCARD std::size_t size() const noexcept {
+        return _size;
+    }
+
+    LZ_NODISCARD bool empty() const noexcept {
+        return _size == 0;
+    }
+
+    //! Makes room for `capacity` elements, so that they can be inserted without growing the table.
+    void reserve(const std::size_t capacity) {
+        if (capacity > _capacity - _capacity / 8) {
+            rehash(capacityFor(capacity));
+        }
+    }
+
+    void clear() noexcept {
+        destroy();
+        std::fill(_control.get(), _control.get() + _capacity, internal::emptyControl);
+        _size = 0;
+        _deleted = 0;
+    }
+
+    /**
+     * Inserts `value` if there is no element with the same key yet.
+     * @return The element with the key of `value`, and whether it was inserted.
+     */
+    std::pair<iterator, bool> insert(value_type value) {
+        return tryEmplace(value.first, std::move(value.second));
+    }
+
+    /**
+     * Inserts an element with `key`, of which the value is constructed from `args`, if there is no element with `key` yet.
+     * Otherwise, `args` are left untouched.
+     * @return The element with `key`, and whether it was inserted.
+     */
+    template<class... Args>
+    std::pair<iterator, bool> tryEmplace(const Key& key, Args&&... args) {
+        const std::uint64_t mixed = mixedHash(key);
+        const std::size_t index = find(key, mixed);
+        if (index != _capacity) {
+            return { iterator(this, index), false };
+        }
+        growFor(1);
+        const std::size_t placed = place(mixed, std::piecewise_construct, std::forward_as_tuple(key),
+                                         std::forward_as_tuple(std::forward<Args>(args)...));
+        return { iterator(this, placed), true };
+    }
+
+    //! Same as `insert(value)`, for `std::inserter`. The hint is ignored.
+    iterator insert(const_iterator /* hint */, value_type value) {
+        return insert(std::move(value)).first;
+    }
+
+    //! Returns the value of `key`, which is value initialized and inserted if there is no element with `key` yet.
+    Value& operator[](const Key& key) {
+        return tryEmplace(key).first->second;
+    }
+
+    //! Erases the element of `key`, if there is one. Returns the amount of erased elements.
+    std::size_t erase(const Key& key) {
+        const std::size_t index = find(key, mixedHash(key));
+        if (index == _capacity) {
+            return 0;
+        }
+        _slots[index].value.~value_type();
+        // If the group still has an empty slot, no probe sequence ever went past it, so the slot can become empty again
+        const std::size_t group = index - index % internal::controlGroupSize;
+        const bool canBeEmpty = internal::matchControl(_control.get() + group, internal::emptyControl) != 0;
+        _control[index] = canBeEmpty ? internal::emptyControl : internal::deletedControl;
+        _deleted += canBeEmpty ? 0 : 1;
+        --_size;
+        return 1;
+    }
+
+    LZ_NODISCARD iterator find(const Key& key) {
+        return iterator(this, find(key, mixedHash(key)));
+    }
+
+    LZ_NODISCARD const_iterator find(const Key& key) const {
+        return const_iterator(this, find(key, mixedHash(key)));
+    }
+
+    LZ_NODISCARD bool contains(const Key& key) const {
+        return find(key, mixedHash(key)) != _capacity;
+    }
+
+    LZ_NODISCARD std::size_t count(const Key& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    //! Returns the value of `key`. Throws `std::out_of_range` if there is no element with `key`.
+    LZ_NODISCARD Value& at(const Key& key) {
+        const std::size_t index = find(key, mixedHash(key));
+        if (index == _capacity) {
+            throw std::out_of_range("key not found in FlatHashMap");
+        }
+        return _slots[index].value.second;
+    }
+
+    //! Returns the value of `key`. Throws `std::out_of_range` if there is no element with `key`.
+    LZ_NODISCARD const Value& at(const Key& key) const {
+        return const_cast<FlatHashMap&>(*this).at(key);
+    }
+
+    LZ_NODISCARD iterator begin() noexcept {
+        return iterator(this, 0);
+    }
+
+    LZ_NODISCARD iterator end() noexcept {
+        return iterator(this, _capacity);
+    }
+
+    LZ_NODISCARD const_iterator begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    LZ_NODISCARD const_iterator end() const noexcept {
+        return const_iterator(this, _capacity);
+    }
+};
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Creates a `lz::FlatHashMap` of which the keys are created by `keyGen`, and the values are the elements of `iterable`. Room
+ * for all elements is reserved first, if the size of `iterable` is known, after which every element is placed without ever
+ * growing the table. If several elements have the same key, the first one is kept, just like `toUnorderedMap`.
+ * @param iterable The sequence to create the map of.
+ * @param keyGen The function that creates the key of an element.
+ * @return The map.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelectorFunc, class Key = internal::KeyTypeIterable<KeySelectorFunc, Iterable>,
+         class Value = internal::ValueType<internal::IterTypeFromIterable<Iterable>>>
+LZ_NODISCARD FlatHashMap<Key, Value> toFlatHashMap(Iterable&& iterable, KeySelectorFunc keyGen) {
+    auto begin = std::begin(iterable);
+    const auto end = std::end(iterable);
+    FlatHashMap<Key, Value> map(internal::sizeHint(begin, end).lower);
+    for (; begin != end; ++begin) {
+        auto&& value = *begin;
+        map.tryEmplace(keyGen(value), value);
+    }
+    return map;
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_FLAT_HASH_MAP_HPP
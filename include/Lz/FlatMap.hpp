@@ -0,0 +1,224 @@
+#pragma once
+
+#ifndef LZ_FLAT_MAP_HPP
+#    define LZ_FLAT_MAP_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/FunctionContainer.hpp"
+
+#    include <algorithm>
+#    include <functional>
+#    include <stdexcept>
+#    include <utility>
+#    include <vector>
+
+namespace lz {
+/**
+ * A map that stores its elements in a `std::vector`, sorted by key. Lookups are binary searches over contiguous memory, and
+ * iterating is iterating a vector, which are both a lot faster than following the nodes of a `std::map`. Inserting or erasing
+ * a single element moves all elements after it, so a flat map is meant to be built at once, for e.g. with `lz::toFlatMap`,
+ * which sorts all elements in one go, instead of one by one.
+ * @tparam Key The key type.
+ * @tparam Value The mapped type.
+ * @tparam Compare The key comparer, `std::less<Key>` by default.
+ */
+template<class Key, class Value, class Compare = std::less<Key>>
+class FlatMap {
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<Key, Value>;
+    using size_type = std::size_t;
+    using key_compare = Compare;
+    using iterator = typename std::vector<value_type>::iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+private:
+    std::vector<value_type> _values;
+    internal::FunctionContainer<Compare> _compare;
+
+    struct KeyCompare {
+        const internal::FunctionContainer<Compare>& compare;
+
+        bool operator()(const value_type& a, const value_type& b) const {
+            return compare(a.first, b.first);
+        }
+
+        bool operator()(const value_type& a, const Key& b) const {
+            return compare(a.first, b);
+        }
+    };
+
+    bool isKey(const_iterator it, const Key& key) const {
+        return it != _values.end() && !_compare(key, it->first);
+    }
+
+public:
+    /**
+     * Creates an empty map.
+     * @param compare The key comparer.
+     */
+    explicit FlatMap(const Compare& compare = Compare()) : _compare(compare) {
+    }
+
+    /**
+     * Creates a map of `values`, which are sorted at once. If several elements have the same key, the first one is kept.
+     * @param values The elements of the map, in any order.
+     * @param compare The key comparer.
+     */
+    explicit FlatMap(std::vector<value_type> values, const Compare& compare = Compare()) :
+        _values(std::move(values)),
+        _compare(compare) {
+        const KeyCompare keyCompare{ _compare };
+        std::stable_sort(_values.begin(), _values.end(), keyCompare);
+        const auto last = std::unique(_values.begin(), _values.end(), [&keyCompare](const value_type& a, const value_type& b) {
+            return !keyCompare(a, b);
+        });
+        _values.erase(last, _values.end());
+    }
+
+    LZ_NODISCARD std::size_t size() const noexcept {
+        return _values.size();
+    }
+
+    LZ_NODISCARD bool empty() const noexcept {
+        return _values.empty();
+    }
+
+    void reserve(const std::size_t capacity) {
+        _values.reserve(capacity);
+    }
+
+    void clear() noexcept {
+        _values.clear();
+    }
+
+    //! The sorted elements.
+    LZ_NODISCARD const std::vector<value_type>& values() const noexcept {
+        return _values;
+    }
+
+    LZ_NODISCARD iterator lowerBound(const Key& key) {
+        return std::lower_bound(_values.begin(), _values.end(), key, KeyCompare{ _compare });
+    }
+
+    LZ_NODISCARD const_iterator lowerBound(const Key& key) const {
+        return std::lower_bound(_values.begin(), _values.end(), key, KeyCompare{ _compare });
+    }
+
+    LZ_NODISCARD iterator find(const Key& key) {
+        const iterator it = lowerBound(key);
+        return isKey(it, key) ? it : _values.end();
+    }
+
+    LZ_NODISCARD const_iterator find(const Key& key) const {
+        const const_iterator it = lowerBound(key);
+        return isKey(it, key) ? it : _values.end();
+    }
+
+    LZ_NODISCARD bool contains(const Key& key) const {
+        return isKey(lowerBound(key), key);
+    }
+
+    LZ_NODISCARD std::size_t count(const Key& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    //! Returns the value of `key`. Throws `std::out_of_range` if there is no element with `key`.
+    LZ_NODISCARD Value& at(const Key& key) {
+        const iterator it = find(key);
+        if (it == _values.end()) {
+            throw std::out_of_range("key not found in FlatMap");
+        }
+        return it->second;
+    }
+
+    //! Returns the value of `key`. Throws `std::out_of_range` if there is no element with `key`.
+    LZ_NODISCARD const Value& at(const Key& key) const {
+        return const_cast<FlatMap&>(*this).at(key);
+    }
+
+    /**
+     * Inserts `value` at its sorted position, if there is no element with the same key yet. This moves all elements after it.
+     * @return The element with the key of `value`, and whether it was inserted.
+     */
+    std::pair<iterator, bool> insert(value_type value) {
+        const iterator it = lowerBound(value.first);
+        if (isKey(it, value.first)) {
+            return { it, false };
+        }
+        return { _values.insert(it, std::move(value)), true };
+    }
+
+    //! Same as `insert(value)`, for `std::inserter`. The hint is ignored.
+    iterator insert(const_iterator /* hint */, value_type value) {
+        return insert(std::move(value)).first;
+    }
+
+    //! Returns the value of `key`, which is value initialized and inserted if there is no element with `key` yet.
+    Value& operator[](const Key& key) {
+        return insert(value_type(key, Value())).first->second;
+    }
+
+    //! Erases the element of `key`, if there is one. Returns the amount of erased elements.
+    std::size_t erase(const Key& key) {
+        const iterator it = find(key);
+        if (it == _values.end()) {
+            return 0;
+        }
+        _values.erase(it);
+        return 1;
+    }
+
+    LZ_NODISCARD iterator begin() noexcept {
+        return _values.begin();
+    }
+
+    LZ_NODISCARD iterator end() noexcept {
+        return _values.end();
+    }
+
+    LZ_NODISCARD const_iterator begin() const noexcept {
+        return _values.begin();
+    }
+
+    LZ_NODISCARD const_iterator end() const noexcept {
+        return _values.end();
+    }
+};
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Creates a `lz::FlatMap` of which the keys are created by `keyGen`, and the values are the elements of `iterable`. All
+ * elements are collected in a vector first, which is then sorted at once. If several elements have the same key, the first one
+ * is kept, just like `toMap`.
+ * @param iterable The sequence to create the map of.
+ * @param keyGen The function that creates the key of an element.
+ * @return The map.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelectorFunc, class Key = internal::KeyTypeIterable<KeySelectorFunc, Iterable>,
+         class Value = internal::ValueType<internal::IterTypeFromIterable<Iterable>>>
+LZ_NODISCARD FlatMap<Key, Value> toFlatMap(Iterable&& iterable, KeySelectorFunc keyGen) {
+    auto begin = std::begin(iterable);
+    const auto end = std::end(iterable);
+    std::vector<std::pair<Key, Value>> values;
+    values.reserve(internal::sizeHint(begin, end).lower);
+    for (; begin != end; ++begin) {
+        auto&& value = *begin;
+        values.emplace_back(keyGen(value), value);
+    }
+    return FlatMap<Key, Value>(std::move(values));
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_FLAT_MAP_HPP
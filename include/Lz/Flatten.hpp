@@ -6,19 +6,28 @@
 
 namespace lz {
 template<class Iterator, int Dims>
-class Flatten final : public internal::BasicIteratorView<internal::FlattenIterator<Iterator, Dims>> {
+class Flatten final : public internal::BasicIteratorView<internal::FlattenIteratorFor<Iterator, Dims>> {
 public:
-    using iterator = internal::FlattenIterator<Iterator, Dims>;
+    using iterator = internal::FlattenIteratorFor<Iterator, Dims>;
     using const_iterator = iterator;
-    using value_type = typename internal::FlattenIterator<Iterator, 0>::value_type;
+    using value_type = typename std::iterator_traits<iterator>::value_type;
 
 private:
     using Base = internal::BasicIteratorView<iterator>;
 
+    LZ_CONSTEXPR_CXX_20 Flatten(Iterator begin, Iterator end, std::false_type /* isBlock */) :
+        Base(iterator(begin, begin, end), iterator(end, begin, end)) {
+    }
+
+    LZ_CONSTEXPR_CXX_20 Flatten(Iterator begin, Iterator end, std::true_type /* isBlock */) :
+        Base(iterator(begin, end, false), iterator(begin, end, true)) {
+    }
+
 public:
     constexpr Flatten() = default;
 
-    LZ_CONSTEXPR_CXX_20 Flatten(Iterator begin, Iterator end) : Base(iterator(begin, begin, end), iterator(end, begin, end)) {
+    LZ_CONSTEXPR_CXX_20 Flatten(Iterator begin, Iterator end) :
+        Flatten(std::move(begin), std::move(end), internal::IsFlattenBlock<Iterator, Dims>()) {
     }
 };
 
@@ -28,10 +37,12 @@ public:
  */
 
 /**
- * This function returns a view object that flattens an n-dimensional array.
+ * This function returns a view object that flattens an n-dimensional array. A contiguous sequence of fixed size arrays, such as
+ * `std::vector<std::array<T, M>>` or `std::array<std::array<T, M>, N>`, is flattened as the single block of memory that it is,
+ * with a random access iterator.
  * @param begin The beginning of the iterable.
  * @param end The ending of the iterable.
- * @return A flatten view object, where its iterator is a forward iterator.
+ * @return A flatten view object, where its iterator is a bidirectional iterator, or a random access iterator for a block.
  */
 template<LZ_CONCEPT_ITERATOR Iterator, int Dims = internal::CountDims<std::iterator_traits<Iterator>>::value - 1>
 LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Flatten<Iterator, Dims> flattenRange(Iterator begin, Iterator end) {
@@ -40,9 +51,11 @@ LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Flatten<Iterator, Dims> flattenRange(Iterator b
 }
 
 /**
- * This function returns a view object that flattens an n-dimensional array.
+ * This function returns a view object that flattens an n-dimensional array. A contiguous sequence of fixed size arrays, such as
+ * `std::vector<std::array<T, M>>` or `std::array<std::array<T, M>, N>`, is flattened as the single block of memory that it is,
+ * with a random access iterator.
  * @param iterable The iterable to flatten.
- * @return A flatten view object, where its iterator is a forward iterator.
+ * @return A flatten view object, where its iterator is a bidirectional iterator, or a random access iterator for a block.
  */
 template<LZ_CONCEPT_ITERABLE Iterable, class Iterator = internal::IterTypeFromIterable<Iterable>,
          int Dims = internal::CountDims<std::iterator_traits<Iterator>>::value - 1>
@@ -7,21 +7,21 @@
 #    include "Filter.hpp"
 #    include "Join.hpp"
 #    include "Map.hpp"
+#    include "Random.hpp"
 #    include "StringSplitter.hpp"
 #    include "Take.hpp"
 #    include "Zip.hpp"
+#    include "detail/ByteMask.hpp"
+#    include "detail/RadixSort.hpp"
+#    include "detail/Reduce.hpp"
+#    include "detail/Sample.hpp"
+#    include "detail/TopK.hpp"
 
 #    include <algorithm>
 #    include <cctype>
 #    include <iterator>
 #    include <numeric>
 
-#    ifdef LZ_HAS_CXX_17
-#        define LZ_INLINE_VAR inline
-#    else // ^^^ has cxx 17 vvv !has cxx 17
-#        define LZ_INLINE_VAR
-#    endif // LZ_HAS_CXX_17
-
 namespace lz {
 namespace internal {
 template<class To>
@@ -37,16 +37,9 @@ struct ConvertFn {
     }
 };
 
-template<std::size_t I>
-struct GetFn {
-    template<class T>
-    LZ_CONSTEXPR_CXX_20 auto operator()(T&& gettable) noexcept -> decltype(std::get<I>(std::forward<T>(gettable))) {
-        return std::get<I>(std::forward<T>(gettable));
-    }
-};
-
 template<class Fn, std::size_t... I>
 struct TupleExpand {
+    LZ_NO_UNIQUE_ADDRESS
     FunctionContainer<Fn> fn{};
 
     constexpr TupleExpand() = default;
@@ -64,6 +57,42 @@ template<class Fn, std::size_t... I>
 constexpr TupleExpand<Fn, I...> makeExpandFn(Fn fn, IndexSequence<I...>) {
     return TupleExpand<Fn, I...>(std::move(fn));
 }
+
+struct TrimCarriageReturn {
+    template<class SubString>
+    LZ_NODISCARD SubString operator()(SubString line) const {
+        if (line.size() != 0 && line.data()[line.size() - 1] == '\r') {
+            return SubString(line.data(), line.size() - 1);
+        }
+        return line;
+    }
+};
+
+// Removes the ASCII whitespace at the front and end of a string or string view, without copying the characters of a view
+struct TrimSpaces {
+    template<class SubString>
+    LZ_NODISCARD SubString operator()(const SubString& string) const {
+        const std::size_t size = string.size();
+        const std::size_t first = leadingSpaces(string.data(), size);
+        const std::size_t last = size - trailingSpaces(string.data() + first, size - first);
+        return SubString(string.data() + first, last - first);
+    }
+};
+
+using TrimmedString = BasicIteratorView<std::reverse_iterator<std::reverse_iterator<std::string::const_iterator>>>;
+
+inline TrimmedString trimSpaces(const std::string::const_iterator begin, const std::string::const_iterator end) {
+    using Reverse = std::reverse_iterator<std::string::const_iterator>;
+    using ReverseReverse = std::reverse_iterator<Reverse>;
+    if (begin == end) {
+        return { ReverseReverse(Reverse(begin)), ReverseReverse(Reverse(end)) };
+    }
+    const auto size = static_cast<std::size_t>(end - begin);
+    const std::size_t first = leadingSpaces(&*begin, size);
+    const std::size_t last = size - trailingSpaces(&*begin + first, size - first);
+    return { ReverseReverse(Reverse(begin + static_cast<std::ptrdiff_t>(first))),
+             ReverseReverse(Reverse(begin + static_cast<std::ptrdiff_t>(last))) };
+}
 } // namespace internal
 
 /**
@@ -72,7 +101,9 @@ constexpr TupleExpand<Fn, I...> makeExpandFn(Fn fn, IndexSequence<I...>) {
 constexpr LZ_INLINE_VAR std::size_t npos = (std::numeric_limits<std::size_t>::max)();
 
 /**
- * Returns a StringSplitter iterator, that splits the string on `'\n'`.
+ * Returns a StringSplitter iterator, that splits the string on `'\n'`. Visiting the lines with a parallel `forEach`, e.g.
+ * `lz::toIter(lz::lines(text)).forEach(f, std::execution::par)`, splits the string into one part per thread, of which the edges
+ * are moved forward to the start of the next line, so `f` is called for every line exactly once, but not in order.
  * @tparam SubString The string type that the `StringSplitter::value_type` must return. Must either be std::string or
  * std::string_view.
  * @tparam String The string type. `std::string` is assumed but can be specified.
@@ -84,6 +115,19 @@ LZ_NODISCARD StringSplitter<SubString, String, char> lines(const String& string)
     return split<SubString>(string, '\n');
 }
 
+/**
+ * Returns a view that splits the string on `'\n'`, and removes the `'\r'` of lines that end with `"\r\n"`. So lines ending with
+ * either `"\n"` or `"\r\n"` are both returned without their line ending.
+ * @tparam SubString The string type that the view must return. Must either be std::string or std::string_view.
+ * @tparam String The string type. `std::string` is assumed but can be specified.
+ * @param string The string to split on.
+ * @return Returns a Map view over the lines of `string`.
+ */
+template<class SubString = std::string, class String = std::string>
+LZ_NODISCARD Map<internal::SplitIterator<SubString, String, char>, internal::TrimCarriageReturn> crlfLines(const String& string) {
+    return map(lines<SubString>(string), internal::TrimCarriageReturn());
+}
+
 /**
  * Sums all the values from [from, upToAndIncluding]
  * @tparam T An integral value.
@@ -303,6 +347,38 @@ LZ_NODISCARD LZ_CONSTEXPR_CXX_20 internal::ValueTypeIterable<Iterable> backOr(co
     return backOr(std::begin(iterable), std::end(iterable), value);
 }
 
+/**
+ * Checks whether [begin, end) contains any of the values in [needlesBegin, needlesEnd). If [begin, end) is contiguous memory of
+ * numbers, and the needles have the same type, up to 8 needles are compared a cache line at a time, and more needles are sorted
+ * and binary searched. Otherwise, this is `std::find_first_of`, which compares every element to every needle; for many needles
+ * of other types, use `containsIf` with a lookup in a hash set.
+ * @param begin The beginning of the sequence to search.
+ * @param end The ending of the sequence to search.
+ * @param needlesBegin The beginning of the values to find.
+ * @param needlesEnd The ending of the values to find.
+ * @return True if any element of [begin, end) is equal to any of the needles, false otherwise.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, LZ_CONCEPT_ITERATOR NeedleIterator>
+LZ_NODISCARD bool containsAny(Iterator begin, Iterator end, NeedleIterator needlesBegin, NeedleIterator needlesEnd) {
+    using IsBlockSearchable = internal::IsBlockSearchable<Iterator, internal::ValueType<NeedleIterator>>;
+    return internal::containsAnyImpl(IsBlockSearchable(), begin, end, std::move(needlesBegin), needlesEnd);
+}
+
+/**
+ * Checks whether `iterable` contains any of the values in `needles`. See
+ * `lz::containsAny(Iterator, Iterator, NeedleIterator, NeedleIterator)`. Example:
+ * ```cpp
+ * bool isBlocked = lz::containsAny(requestIds, blockedIds);
+ * ```
+ * @param iterable The iterable to search.
+ * @param needles The values to find.
+ * @return True if any element of `iterable` is equal to any of the needles, false otherwise.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, LZ_CONCEPT_ITERABLE Needles>
+LZ_NODISCARD bool containsAny(const Iterable& iterable, const Needles& needles) {
+    return containsAny(std::begin(iterable), std::end(iterable), std::begin(needles), std::end(needles));
+}
+
 /**
  * Returns an iterator that accesses two adjacent elements of one container in a std::tuple<T, T> like fashion.
  * @param begin The beginning of the sequence.
@@ -531,7 +607,8 @@ trim(Iterable&& iterable, UnaryPredicateFirst first, UnaryPredicateLast last, Ex
 }
 
 /**
- * Trims a string and returns an iterator that skips whitespaces at the front and end.
+ * Trims a string and returns an iterator that skips whitespaces at the front and end. With `std::execution::seq`, the
+ * whitespace is searched right away, and runs of whitespace are skipped 8 characters at a time.
  * @param begin The beginning of the string to trim.
  * @param end The ending of the string to trim.
  * @param execution The execution policy. Must be of `std::execution::*` tags.
@@ -541,10 +618,15 @@ template<class Execution = std::execution::sequenced_policy>
 LZ_NODISCARD LZ_CONSTEXPR_CXX_20
 internal::BasicIteratorView<std::reverse_iterator<std::reverse_iterator<std::string::const_iterator>>>
 trimString(std::string::const_iterator begin, std::string::const_iterator end, Execution execution = std::execution::seq) {
-    const auto isSpaceFn = [](const char c) {
-        return std::isspace(static_cast<unsigned char>(c));
-    };
-    return trim(begin, end, isSpaceFn, isSpaceFn, execution);
+    if constexpr (internal::IsSequencedPolicyV<Execution>) {
+        return internal::trimSpaces(begin, end);
+    }
+    else {
+        const auto isSpaceFn = [](const char c) {
+            return std::isspace(static_cast<unsigned char>(c));
+        };
+        return trim(begin, end, isSpaceFn, isSpaceFn, execution);
+    }
 }
 
 /**
@@ -631,7 +713,7 @@ findFirstOrDefault(Iterator begin, Iterator end, const T& toFind, const U& defau
     using ValueType = internal::ValueType<Iterator>;
     if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
         static_cast<void>(execution);
-        return static_cast<ValueType>(std::find(std::move(begin), end, toFind) == end ? defaultValue : toFind);
+        return static_cast<ValueType>(internal::findValue(std::move(begin), end, toFind) == end ? defaultValue : toFind);
     }
     else {
         return static_cast<ValueType>(std::find(execution, std::move(begin), end, toFind) == end ? defaultValue : toFind);
@@ -776,7 +858,7 @@ LZ_NODISCARD LZ_CONSTEXPR_CXX_20 std::size_t
 indexOf(Iterator begin, Iterator end, const T& val, Execution execution = std::execution::seq) {
     if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
         static_cast<void>(execution);
-        const Iterator pos = std::find(begin, end, val);
+        const Iterator pos = internal::findValue(begin, end, val);
         return pos == end ? npos : static_cast<std::size_t>(internal::getIterLength(begin, pos));
     }
     else {
@@ -890,13 +972,12 @@ template<class IteratorA, class IteratorB, class BinaryPredicate = std::equal_to
 bool startsWith(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, BinaryPredicate compare = {},
                 Execution execution = std::execution::seq) {
     if constexpr (internal::checkForwardAndPolicies<Execution, IteratorA>()) {
-        return std::search(std::move(beginA), std::move(endA), std::move(beginB), std::move(endB), std::move(compare)) != endA;
+        return internal::startsWithRange(std::move(beginA), endA, std::move(beginB), endB, std::move(compare));
     }
     else {
         static_assert(internal::IsForwardOrStrongerV<IteratorB>,
                       "The iterator type must be forward iterator or stronger. Prefer using std::execution::seq");
-        return std::search(execution, std::move(beginA), std::move(endA), std::move(beginB), std::move(endB),
-                           std::move(compare)) != endA;
+        return std::mismatch(execution, std::move(beginA), std::move(endA), beginB, endB, std::move(compare)).second == endB;
     }
 }
 
@@ -910,12 +991,17 @@ template<class IteratorA, class IteratorB, class BinaryPredicate = std::equal_to
          class Execution = std::execution::sequenced_policy>
 bool endsWith(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, BinaryPredicate compare = {},
               Execution execution = std::execution::seq) {
-    std::reverse_iterator<IteratorA> revEndA(std::move(beginA));
-    std::reverse_iterator<IteratorA> revBegA(std::move(endA));
-    std::reverse_iterator<IteratorB> revEndB(std::move(beginB));
-    std::reverse_iterator<IteratorB> revBegB(std::move(endB));
-    return startsWith(std::move(revBegA), std::move(revEndA), std::move(revBegB), std::move(revEndB), std::move(compare),
-                      execution);
+    if constexpr (internal::checkForwardAndPolicies<Execution, IteratorA>()) {
+        return internal::endsWithRange(beginA, endA, beginB, endB, std::move(compare));
+    }
+    else {
+        std::reverse_iterator<IteratorA> revEndA(std::move(beginA));
+        std::reverse_iterator<IteratorA> revBegA(std::move(endA));
+        std::reverse_iterator<IteratorB> revEndB(std::move(beginB));
+        std::reverse_iterator<IteratorB> revBegB(std::move(endB));
+        return startsWith(std::move(revBegA), std::move(revEndA), std::move(revBegB), std::move(revEndB), std::move(compare),
+                          execution);
+    }
 }
 
 template<class IterableA, class IterableB, class BinaryPredicate = std::equal_to<>,
@@ -939,7 +1025,7 @@ template<class Iterator, class BinaryOp = std::plus<>>
 double mean(Iterator begin, Iterator end, BinaryOp binOp = {}) {
     using ValueType = internal::ValueType<Iterator>;
     const internal::DiffType<Iterator> dist = internal::getIterLength(begin, end);
-    const ValueType sum = std::accumulate(begin, end, ValueType{ 0 }, std::move(binOp));
+    const ValueType sum = internal::sumFold(begin, end, ValueType{ 0 }, std::move(binOp));
     return static_cast<double>(sum) / dist;
 }
 
@@ -1013,7 +1099,7 @@ double median(Iterable& iterable, Comparer comparer = {}) {
  */
 template<class Iterator, class T, class U>
 internal::ValueType<Iterator> findFirstOrDefault(Iterator begin, Iterator end, const T& toFind, const U& defaultValue) {
-    return static_cast<internal::ValueType<Iterator>>(std::find(std::move(begin), end, toFind) == end ? defaultValue : toFind);
+    return static_cast<internal::ValueType<Iterator>>(internal::findValue(std::move(begin), end, toFind) == end ? defaultValue : toFind);
 }
 
 /**
@@ -1129,7 +1215,7 @@ findLastOrDefaultIf(const Iterable& iterable, UnaryPredicate predicate, const T&
  */
 template<class Iterator, class T>
 std::size_t indexOf(Iterator begin, Iterator end, const T& val) {
-    const Iterator pos = std::find(begin, end, val);
+    const Iterator pos = internal::findValue(begin, end, val);
     return pos == end ? npos : static_cast<std::size_t>(internal::getIterLength(begin, pos));
 }
 
@@ -1178,7 +1264,7 @@ std::size_t indexOfIf(const Iterable& iterable, UnaryFunc predicate) {
  */
 template<class Iterator, class T>
 bool contains(Iterator begin, Iterator end, const T& value) {
-    return std::find(std::move(begin), end, value) != end;
+    return internal::findValue(std::move(begin), end, value) != end;
 }
 
 /**
@@ -1224,7 +1310,7 @@ template<class IteratorA, class IteratorB, class BinaryPredicate = std::equal_to
 template<class IteratorA, class IteratorB, class BinaryPredicate = std::equal_to<>>
 #        endif
 bool startsWith(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, BinaryPredicate compare = {}) {
-    return std::search(std::move(beginA), std::move(endA), std::move(beginB), std::move(endB), std::move(compare)) != endA;
+    return internal::startsWithRange(std::move(beginA), endA, std::move(beginB), endB, std::move(compare));
 }
 
 #        ifdef LZ_HAS_CXX_11
@@ -1243,11 +1329,7 @@ template<class IteratorA, class IteratorB, class BinaryPredicate = std::equal_to
 template<class IteratorA, class IteratorB, class BinaryPredicate = std::equal_to<>>
 #        endif
 bool endsWith(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, BinaryPredicate compare = {}) {
-    std::reverse_iterator<IteratorA> revEndA(std::move(beginA));
-    std::reverse_iterator<IteratorA> revBegA(std::move(endA));
-    std::reverse_iterator<IteratorB> revEndB(std::move(beginB));
-    std::reverse_iterator<IteratorB> revBegB(std::move(endB));
-    return startsWith(std::move(revBegA), std::move(revEndA), std::move(revBegB), std::move(revEndB), std::move(compare));
+    return internal::endsWithRange(beginA, endA, beginB, endB, std::move(compare));
 }
 
 #        ifdef LZ_HAS_CXX_11
@@ -1334,7 +1416,7 @@ select(Iterable&& iterable, SelectorIterable&& selectors) {
  * @return An iterator view object.
  */
 template<class Iterator, class UnaryPredicateFirst, class UnaryPredicateLast>
-internal::BasicIteratorView<std::reverse_iterator<std::reverse_iterator<Iterator>>>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 internal::BasicIteratorView<std::reverse_iterator<std::reverse_iterator<Iterator>>>
 trim(Iterator begin, Iterator end, UnaryPredicateFirst first, UnaryPredicateLast last) {
     auto takenFirst = dropWhileRange(std::move(begin), std::move(end), std::move(first));
     auto takenLast = dropWhile(lz::reverse(std::move(takenFirst)), std::move(last));
@@ -1350,25 +1432,22 @@ trim(Iterator begin, Iterator end, UnaryPredicateFirst first, UnaryPredicateLast
  * @return An iterator view object.
  */
 template<class Iterable, class UnaryPredicateFirst, class UnaryPredicateLast>
-internal::BasicIteratorView<std::reverse_iterator<std::reverse_iterator<internal::IterTypeFromIterable<Iterable>>>>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 internal::BasicIteratorView<std::reverse_iterator<std::reverse_iterator<internal::IterTypeFromIterable<Iterable>>>>
 trim(Iterable&& iterable, UnaryPredicateFirst first, UnaryPredicateLast last) {
     return trim(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
                 std::move(first), std::move(last));
 }
 
 /**
- * Trims a string and returns an iterator that skips whitespaces at the front and end.
+ * Trims a string and returns an iterator that skips whitespaces at the front and end. The whitespace is searched right away,
+ * and runs of whitespace are skipped 8 characters at a time.
  * @param begin The beginning of the string to trim.
  * @param end The ending of the string to trim.
  * @return The string, with trimmed spaces/tabs/newlines at the front and end.
  */
-LZ_NODISCARD
-LZ_CONSTEXPR_CXX_20 internal::BasicIteratorView<std::reverse_iterator<std::reverse_iterator<std::string::const_iterator>>>
+LZ_NODISCARD inline internal::BasicIteratorView<std::reverse_iterator<std::reverse_iterator<std::string::const_iterator>>>
 trimString(std::string::const_iterator begin, std::string::const_iterator end) {
-    const auto isSpaceFn = [](const char c) {
-        return static_cast<bool>(std::isspace(static_cast<unsigned char>(c)));
-    };
-    return trim(begin, end, isSpaceFn, isSpaceFn);
+    return internal::trimSpaces(begin, end);
 }
 
 /**
@@ -1376,13 +1455,441 @@ trimString(std::string::const_iterator begin, std::string::const_iterator end) {
  * @param s The string to trim.
  * @return The string, with trimmed spaces/tabs/newlines at the front and end.
  */
-LZ_NODISCARD
-LZ_CONSTEXPR_CXX_20 internal::BasicIteratorView<std::reverse_iterator<std::reverse_iterator<std::string::const_iterator>>>
+LZ_NODISCARD inline internal::BasicIteratorView<std::reverse_iterator<std::reverse_iterator<std::string::const_iterator>>>
 trimString(const std::string& s) {
     return trimString(s.begin(), s.end());
 }
 
 #    endif // End LZ_HAS_EXECUTION
+
+#    ifdef LZ_HAS_STRING_VIEW
+/**
+ * Trims the whitespace (`' '`, `'\t'`, `'\n'`, `'\v'`, `'\f'` and `'\r'`) at the front and end of a string view. Unlike the
+ * `std::string` overloads, this returns a `std::string_view` of the trimmed characters right away instead of a lazy view, so
+ * it is as cheap as two comparisons if there is no whitespace, and runs of whitespace are skipped 8 characters at a time. Use
+ * this to trim e.g. the fields of `lz::csvFields`:
+ * ```cpp
+ * for (std::string_view field : lz::csvFields(record)) {
+ *     std::string_view value = lz::trimString(field);
+ * }
+ * ```
+ * @param string The string to trim.
+ * @return A view of the characters of `string`, without the whitespace at the front and end.
+ */
+LZ_NODISCARD inline std::string_view trimString(const std::string_view string) noexcept {
+    return internal::TrimSpaces()(string);
+}
+
+/**
+ * Trims the whitespace at the front and end of a null terminated string. See `lz::trimString(std::string_view)`.
+ * @param string The string to trim.
+ * @return A view of the characters of `string`, without the whitespace at the front and end.
+ */
+LZ_NODISCARD inline std::string_view trimString(const char* string) noexcept {
+    return trimString(std::string_view(string));
+}
+#    endif // LZ_HAS_STRING_VIEW
+
+/**
+ * Selects `k` random elements from `iterable`, without replacement, every element being equally likely. If the iterable is
+ * random access, only the `k` picked elements are visited and they keep their relative order. Otherwise the iterable is read
+ * once, using reservoir sampling (Algorithm L), which calls the generator far less often than once per element, and the order
+ * of the picked elements is unspecified. If the iterable has `k` or less elements, all of them are returned.
+ * @param iterable The iterable to sample from.
+ * @param k The amount of elements to pick.
+ * @param generator The random number generator that must produce 32 or 64 random bits per call, for e.g. `lz::Pcg32`.
+ * @return A vector with the `k` picked elements.
+ */
+template<class Iterable, class Generator>
+LZ_NODISCARD std::vector<internal::ValueTypeIterable<Iterable>>
+sample(Iterable&& iterable, const std::size_t k, Generator& generator) {
+    using Iterator = internal::IterTypeFromIterable<Iterable>;
+    return internal::sampleImpl(internal::IsRandomAccess<Iterator>(), internal::begin(std::forward<Iterable>(iterable)),
+                                internal::end(std::forward<Iterable>(iterable)), k, generator);
+}
+
+/**
+ * Selects `k` random elements from `iterable`, without replacement, using a `lz::ThreadLocalEngine<lz::Xoshiro256StarStar>`.
+ * See `lz::sample(Iterable&&, std::size_t, Generator&)`.
+ * @param iterable The iterable to sample from.
+ * @param k The amount of elements to pick.
+ * @return A vector with the `k` picked elements.
+ */
+template<class Iterable>
+LZ_NODISCARD std::vector<internal::ValueTypeIterable<Iterable>> sample(Iterable&& iterable, const std::size_t k) {
+    ThreadLocalEngine<Xoshiro256StarStar> generator;
+    return sample(std::forward<Iterable>(iterable), k, generator);
+}
+
+/**
+ * Selects `k` random elements from `iterable`, without replacement, where the chance that an element is picked is proportional
+ * to `weightFunc(element)`. Elements with a weight of zero or less are never picked. The iterable is read once, using weighted
+ * reservoir sampling with exponential jumps (A-ExpJ), which calls the generator far less often than once per element. The
+ * order of the picked elements is unspecified.
+ * @param iterable The iterable to sample from.
+ * @param k The amount of elements to pick.
+ * @param weightFunc Returns the weight of an element, as a number convertible to `double`.
+ * @param generator The random number generator that must produce 32 or 64 random bits per call, for e.g. `lz::Pcg32`.
+ * @return A vector with the `k` picked elements, or less if there are less than `k` elements with a positive weight.
+ */
+template<class Iterable, class WeightFunc, class Generator>
+LZ_NODISCARD std::vector<internal::ValueTypeIterable<Iterable>>
+weightedSample(Iterable&& iterable, const std::size_t k, WeightFunc weightFunc, Generator& generator) {
+    return internal::weightedSampleImpl(internal::begin(std::forward<Iterable>(iterable)),
+                                        internal::end(std::forward<Iterable>(iterable)), k, std::move(weightFunc), generator);
+}
+
+/**
+ * Selects `k` random elements from `iterable`, without replacement, where the chance that an element is picked is proportional
+ * to `weightFunc(element)`, using a `lz::ThreadLocalEngine<lz::Xoshiro256StarStar>`. See
+ * `lz::weightedSample(Iterable&&, std::size_t, WeightFunc, Generator&)`.
+ * @param iterable The iterable to sample from.
+ * @param k The amount of elements to pick.
+ * @param weightFunc Returns the weight of an element, as a number convertible to `double`.
+ * @return A vector with the `k` picked elements, or less if there are less than `k` elements with a positive weight.
+ */
+template<class Iterable, class WeightFunc>
+LZ_NODISCARD std::vector<internal::ValueTypeIterable<Iterable>>
+weightedSample(Iterable&& iterable, const std::size_t k, WeightFunc weightFunc) {
+    ThreadLocalEngine<Xoshiro256StarStar> generator;
+    return weightedSample(std::forward<Iterable>(iterable), k, std::move(weightFunc), generator);
+}
+
+/**
+ * Reduces `iterable` to one value on the threads of `policy`, starting with `init`. The iterable is split into blocks, that are
+ * reduced by different threads, after which the results of neighbouring blocks are merged in pairs, like a tree. Random access
+ * iterables are split in O(1), other forward iterables are walked once to find the blocks, which pays off if `binaryOp` is
+ * expensive. Input iterables are reduced on the calling thread. Example:
+ * ```cpp
+ * auto total = lz::reduce(lz::map(orders, price), 0LL, std::plus<long long>(), lz::execution::pool());
+ * ```
+ * @param iterable The iterable to reduce.
+ * @param init The initial value, which is only used once.
+ * @param binaryOp The reduction, which is called from multiple threads at the same time. It must be associative, but does not
+ * need to be commutative. Floating point addition is not associative, so the result can differ from a sequential sum and
+ * depends on the amount of threads, unless the policy is `reproducible()`.
+ * @param policy The pool to run on, for instance `lz::execution::pool()`.
+ * @return The reduced value.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class T, class BinaryOp>
+LZ_NODISCARD T reduce(Iterable&& iterable, T init, BinaryOp binaryOp, const execution::PoolPolicy& policy) {
+    using Iterator = internal::IterTypeFromIterable<Iterable>;
+    return internal::parallelTransformReduce(internal::IterCat<Iterator>(), internal::begin(std::forward<Iterable>(iterable)),
+                                             internal::end(std::forward<Iterable>(iterable)), std::move(init), binaryOp,
+                                             internal::IdentityTransform(), policy);
+}
+
+/**
+ * Reduces `iterable` to one value on the calling thread, starting with `init`. If `binaryOp` is a plus over a random access
+ * iterable of integers, several sums are kept at once.
+ * @param iterable The iterable to reduce.
+ * @param init The initial value.
+ * @param binaryOp The reduction.
+ * @return The reduced value.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class T, class BinaryOp>
+LZ_NODISCARD T reduce(Iterable&& iterable, T init, BinaryOp binaryOp) {
+    return internal::sumFold(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                             std::move(init), std::move(binaryOp));
+}
+
+/**
+ * Applies `unaryOp` to every element of `iterable` and reduces the results to one value on the threads of `policy`, starting with
+ * `init`, without storing the transformed elements. See `lz::reduce(Iterable&&, T, BinaryOp, const execution::PoolPolicy&)`.
+ * @param iterable The iterable to reduce.
+ * @param init The initial value, which is only used once.
+ * @param binaryOp The reduction, which must be associative. It is called from multiple threads at the same time.
+ * @param unaryOp The transform that is applied to every element, from multiple threads at the same time.
+ * @param policy The pool to run on, for instance `lz::execution::pool()`.
+ * @return The reduced value.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class T, class BinaryOp, class UnaryOp>
+LZ_NODISCARD T
+transformReduce(Iterable&& iterable, T init, BinaryOp binaryOp, UnaryOp unaryOp, const execution::PoolPolicy& policy) {
+    using Iterator = internal::IterTypeFromIterable<Iterable>;
+    return internal::parallelTransformReduce(internal::IterCat<Iterator>(), internal::begin(std::forward<Iterable>(iterable)),
+                                             internal::end(std::forward<Iterable>(iterable)), std::move(init), binaryOp,
+                                             unaryOp, policy);
+}
+
+/**
+ * Gets the mean of a sequence, of which the sum is calculated on the threads of `policy` as a `double`. With a
+ * `reproducible()` policy, the mean is the same on any amount of threads, and the same for random access and forward iterables.
+ * Input iterables are summed front to back on the calling thread, so their mean can differ in the last bits. Example:
+ * ```cpp
+ * double average = lz::mean(measurements, lz::execution::pool().reproducible());
+ * ```
+ * @param iterable The iterable to calculate the mean of.
+ * @param policy The pool to run on, for instance `lz::execution::pool()`.
+ * @return The mean of the sequence, or NaN if it is empty.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD double mean(const Iterable& iterable, const execution::PoolPolicy& policy) {
+    using Iterator = internal::IterTypeFromIterable<const Iterable&>;
+    using std::distance;
+    const auto begin = std::begin(iterable);
+    const auto end = std::end(iterable);
+    const double sum = internal::parallelTransformReduce(internal::IterCat<Iterator>(), begin, end, 0., std::plus<double>(),
+                                                         internal::ToDouble(), policy);
+    return sum / static_cast<double>(distance(begin, end));
+}
+
+/**
+ * Applies `unaryOp` to every element of `iterable` and reduces the results to one value on the calling thread, starting with
+ * `init`.
+ * @param iterable The iterable to reduce.
+ * @param init The initial value.
+ * @param binaryOp The reduction.
+ * @param unaryOp The transform that is applied to every element.
+ * @return The reduced value.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class T, class BinaryOp, class UnaryOp>
+LZ_NODISCARD T transformReduce(Iterable&& iterable, T init, BinaryOp binaryOp, UnaryOp unaryOp) {
+    return internal::transformFold(unaryOp, internal::begin(std::forward<Iterable>(iterable)),
+                                   internal::end(std::forward<Iterable>(iterable)), std::move(init), binaryOp);
+}
+
+#    ifdef LZ_HAS_EXECUTION
+/**
+ * Reduces `iterable` to one value, starting with `init`. With `std::execution::seq`, the calling thread does this, with other
+ * policies it is done on `lz::execution::pool()`. Unlike `std::reduce`, this parallelizes over any forward iterable, such as
+ * filters and maps. See `lz::reduce(Iterable&&, T, BinaryOp, const execution::PoolPolicy&)`.
+ * @param iterable The iterable to reduce.
+ * @param init The initial value, which is only used once.
+ * @param binaryOp The reduction, which must be associative.
+ * @param execution The execution policy.
+ * @return The reduced value.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class T, class BinaryOp, class Execution,
+         class = internal::EnableIf<std::is_execution_policy_v<Execution>>>
+LZ_NODISCARD T reduce(Iterable&& iterable, T init, BinaryOp binaryOp, Execution execution) {
+    using Iterator = internal::IterTypeFromIterable<Iterable>;
+    static_cast<void>(execution);
+    if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
+        return reduce(std::forward<Iterable>(iterable), std::move(init), std::move(binaryOp));
+    }
+    else {
+        return reduce(std::forward<Iterable>(iterable), std::move(init), std::move(binaryOp), lz::execution::pool());
+    }
+}
+
+/**
+ * Applies `unaryOp` to every element of `iterable` and reduces the results to one value, starting with `init`. With
+ * `std::execution::seq`, the calling thread does this, with other policies it is done on `lz::execution::pool()`.
+ * @param iterable The iterable to reduce.
+ * @param init The initial value, which is only used once.
+ * @param binaryOp The reduction, which must be associative.
+ * @param unaryOp The transform that is applied to every element.
+ * @param execution The execution policy.
+ * @return The reduced value.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class T, class BinaryOp, class UnaryOp, class Execution,
+         class = internal::EnableIf<std::is_execution_policy_v<Execution>>>
+LZ_NODISCARD T transformReduce(Iterable&& iterable, T init, BinaryOp binaryOp, UnaryOp unaryOp, Execution execution) {
+    using Iterator = internal::IterTypeFromIterable<Iterable>;
+    static_cast<void>(execution);
+    if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
+        return transformReduce(std::forward<Iterable>(iterable), std::move(init), std::move(binaryOp), std::move(unaryOp));
+    }
+    else {
+        return transformReduce(std::forward<Iterable>(iterable), std::move(init), std::move(binaryOp), std::move(unaryOp),
+                               lz::execution::pool());
+    }
+}
+#    endif // LZ_HAS_EXECUTION
+
+/**
+ * Sorts [begin, end) on the threads of `policy`. If the elements are integers, floats or doubles and `compare` is `std::less`, a
+ * least significant digit radix sort is done, in which every thread counts and moves the digits of its own part of the
+ * sequence. Digits that are equal for all elements are skipped. Otherwise, parts of the sequence are sorted in parallel and
+ * then merged.
+ * @param begin The beginning of the sequence, which must be random access.
+ * @param end The ending of the sequence.
+ * @param compare The comparer, `operator<` by default.
+ * @param policy The pool to run on, for instance `lz::execution::pool()`.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Compare>
+void sort(Iterator begin, Iterator end, Compare compare, const execution::PoolPolicy& policy) {
+    static_assert(internal::IsRandomAccess<Iterator>::value, "the iterator must be random access");
+    internal::parallelSort(begin, end, compare, policy.pool());
+}
+
+/**
+ * Returns the distinct values of `iterable` in ascending order. The values are copied into a vector, sorted (with a radix
+ * sort for integers, floats and doubles, see `lz::sort`) and deduplicated in place, without an extra pass over `iterable`.
+ * @param iterable The sequence to get the distinct values of.
+ * @param compare The comparer, `operator<` by default. Values that are not less than each other are equivalent.
+ * @param policy The pool to sort on, for instance `lz::execution::pool()`.
+ * @return A vector with the distinct values of `iterable`, in ascending order.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Compare>
+LZ_NODISCARD std::vector<internal::ValueTypeIterable<Iterable>>
+sortedDistinct(Iterable&& iterable, Compare compare, const execution::PoolPolicy& policy) {
+    std::vector<internal::ValueTypeIterable<Iterable>> values(internal::begin(std::forward<Iterable>(iterable)),
+                                                              internal::end(std::forward<Iterable>(iterable)));
+    internal::sortedDistinctImpl(values, compare, policy.pool());
+    return values;
+}
+
+/**
+ * Returns the distinct values of `iterable` in ascending order, sorted on the calling thread. See
+ * `lz::sortedDistinct(Iterable&&, Compare, const execution::PoolPolicy&)`.
+ * @param iterable The sequence to get the distinct values of.
+ * @param compare The comparer, `operator<` by default. Values that are not less than each other are equivalent.
+ * @return A vector with the distinct values of `iterable`, in ascending order.
+ */
+#    ifdef LZ_HAS_CXX_11
+template<LZ_CONCEPT_ITERABLE Iterable, class Compare = std::less<internal::ValueTypeIterable<Iterable>>>
+#    else
+template<LZ_CONCEPT_ITERABLE Iterable, class Compare = std::less<>>
+#    endif // LZ_HAS_CXX_11
+LZ_NODISCARD std::vector<internal::ValueTypeIterable<Iterable>> sortedDistinct(Iterable&& iterable, Compare compare = {}) {
+    std::vector<internal::ValueTypeIterable<Iterable>> values(internal::begin(std::forward<Iterable>(iterable)),
+                                                              internal::end(std::forward<Iterable>(iterable)));
+    internal::CallingThread callingThread;
+    internal::sortedDistinctImpl(values, compare, callingThread);
+    return values;
+}
+
+/**
+ * Returns every distinct value of `iterable` in ascending order, together with the amount of times it occurs. The values are
+ * copied into a vector and sorted (see `lz::sortedDistinct`), after which the equivalent values are counted.
+ * @param iterable The sequence to group.
+ * @param compare The comparer, `operator<` by default. Values that are not less than each other are in the same group.
+ * @param policy The pool to sort on, for instance `lz::execution::pool()`.
+ * @return A vector of pairs with the first value of every group and the size of the group, in ascending order.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Compare>
+LZ_NODISCARD std::vector<std::pair<internal::ValueTypeIterable<Iterable>, std::size_t>>
+sortedGroups(Iterable&& iterable, Compare compare, const execution::PoolPolicy& policy) {
+    std::vector<internal::ValueTypeIterable<Iterable>> values(internal::begin(std::forward<Iterable>(iterable)),
+                                                              internal::end(std::forward<Iterable>(iterable)));
+    return internal::sortedGroupsImpl(values, compare, policy.pool());
+}
+
+/**
+ * Returns every distinct value of `iterable` in ascending order, together with the amount of times it occurs, sorted on the
+ * calling thread. See `lz::sortedGroups(Iterable&&, Compare, const execution::PoolPolicy&)`.
+ * @param iterable The sequence to group.
+ * @param compare The comparer, `operator<` by default. Values that are not less than each other are in the same group.
+ * @return A vector of pairs with the first value of every group and the size of the group, in ascending order.
+ */
+#    ifdef LZ_HAS_CXX_11
+template<LZ_CONCEPT_ITERABLE Iterable, class Compare = std::less<internal::ValueTypeIterable<Iterable>>>
+#    else
+template<LZ_CONCEPT_ITERABLE Iterable, class Compare = std::less<>>
+#    endif // LZ_HAS_CXX_11
+LZ_NODISCARD std::vector<std::pair<internal::ValueTypeIterable<Iterable>, std::size_t>>
+sortedGroups(Iterable&& iterable, Compare compare = {}) {
+    std::vector<internal::ValueTypeIterable<Iterable>> values(internal::begin(std::forward<Iterable>(iterable)),
+                                                              internal::end(std::forward<Iterable>(iterable)));
+    internal::CallingThread callingThread;
+    return internal::sortedGroupsImpl(values, compare, callingThread);
+}
+/**
+ * Returns the `k` largest elements of `iterable`, largest first. The sequence is read once, without being copied or modified,
+ * while a heap of at most `k` elements is kept, which takes O(n * log(k)) time. If `iterable` has less than `k` elements, all
+ * of them are returned.
+ * @param iterable The sequence, which may be an input iterable.
+ * @param k The amount of elements to return.
+ * @param compare The comparer, `operator<` by default. Use `std::greater` to get the `k` smallest elements instead.
+ * @return A vector with the `k` largest elements, in descending order.
+ */
+#    ifdef LZ_HAS_CXX_11
+template<LZ_CONCEPT_ITERABLE Iterable, class Compare = std::less<internal::ValueTypeIterable<Iterable>>>
+#    else
+template<LZ_CONCEPT_ITERABLE Iterable, class Compare = std::less<>>
+#    endif // LZ_HAS_CXX_11
+LZ_NODISCARD std::vector<internal::ValueTypeIterable<Iterable>>
+topK(Iterable&& iterable, const std::size_t k, Compare compare = {}) {
+    return internal::topKImpl(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                              k, std::move(compare));
+}
+
+/**
+ * Returns the `n`th smallest element of `iterable`, counting from 0, as `std::nth_element` would, but without copying or
+ * modifying the sequence. A heap of at most `n + 1` elements is kept, so this is meant for an `n` that is small compared to
+ * the length of the sequence. For approximate quantiles of large sequences, see `lz::quantileSketch`.
+ * @param iterable The sequence, which may be an input iterable. It must have more than `n` elements.
+ * @param n The index of the element in sorted order.
+ * @param compare The comparer, `operator<` by default.
+ * @return The `n`th smallest element.
+ */
+#    ifdef LZ_HAS_CXX_11
+template<LZ_CONCEPT_ITERABLE Iterable, class Compare = std::less<internal::ValueTypeIterable<Iterable>>>
+#    else
+template<LZ_CONCEPT_ITERABLE Iterable, class Compare = std::less<>>
+#    endif // LZ_HAS_CXX_11
+LZ_NODISCARD internal::ValueTypeIterable<Iterable> nthSmallest(Iterable&& iterable, const std::size_t n, Compare compare = {}) {
+    return internal::nthSmallestImpl(internal::begin(std::forward<Iterable>(iterable)),
+                                     internal::end(std::forward<Iterable>(iterable)), n, std::move(compare));
+}
+
+/**
+ * Returns the `n` elements of `iterable` with the largest keys, largest key first. The sequence is read once, while a heap of
+ * at most `n` elements and their keys is kept, which takes O(size * log(n)) time. Unlike `lz::topK` with a comparer that
+ * compares the keys of two elements, every element is dereferenced once and every key is computed once, which matters if the
+ * elements or keys are computed lazily. Elements with equal keys are returned in an unspecified order. Example:
+ * ```cpp
+ * auto best = lz::topN(lz::map(items, score), 100, [](const Scored& s) { return s.score; });
+ * ```
+ * @param iterable The sequence, which may be an input iterable.
+ * @param n The amount of elements to return. If `iterable` has less than `n` elements, all of them are returned.
+ * @param keySelector A function that returns the key of an element.
+ * @param compare The comparer of the keys, `operator<` by default. Use `std::greater` to get the `n` smallest keys instead.
+ * @return A vector with the `n` elements with the largest keys, in descending order of their keys.
+ */
+#    ifdef LZ_HAS_CXX_11
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector,
+         class Compare = std::less<internal::KeyTypeIterable<KeySelector, Iterable>>>
+#    else
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector, class Compare = std::less<>>
+#    endif // LZ_HAS_CXX_11
+LZ_NODISCARD std::vector<internal::ValueTypeIterable<Iterable>>
+topN(Iterable&& iterable, const std::size_t n, const KeySelector& keySelector, const Compare& compare = {}) {
+    return internal::topNImpl(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                              n, keySelector, compare);
+}
+
+/**
+ * Returns the element of `iterable` with the smallest key, the first of them if several keys are equally small. Unlike `min`
+ * with a comparer that compares the keys of two elements, every element is dereferenced once and every key is computed once.
+ * @param iterable The sequence, which may be an input iterable. It cannot be empty.
+ * @param keySelector A function that returns the key of an element.
+ * @param compare The comparer of the keys, `operator<` by default.
+ * @return A copy of the element with the smallest key.
+ */
+#    ifdef LZ_HAS_CXX_11
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector,
+         class Compare = std::less<internal::KeyTypeIterable<KeySelector, Iterable>>>
+#    else
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector, class Compare = std::less<>>
+#    endif // LZ_HAS_CXX_11
+LZ_NODISCARD internal::ValueTypeIterable<Iterable>
+minBy(Iterable&& iterable, const KeySelector& keySelector, const Compare& compare = {}) {
+    return internal::extremeBy(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                               keySelector, compare);
+}
+
+/**
+ * Returns the element of `iterable` with the largest key, the first of them if several keys are equally large. Unlike `max`
+ * with a comparer that compares the keys of two elements, every element is dereferenced once and every key is computed once.
+ * @param iterable The sequence, which may be an input iterable. It cannot be empty.
+ * @param keySelector A function that returns the key of an element.
+ * @param compare The comparer of the keys, `operator<` by default.
+ * @return A copy of the element with the largest key.
+ */
+#    ifdef LZ_HAS_CXX_11
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector,
+         class Compare = std::less<internal::KeyTypeIterable<KeySelector, Iterable>>>
+#    else
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector, class Compare = std::less<>>
+#    endif // LZ_HAS_CXX_11
+LZ_NODISCARD internal::ValueTypeIterable<Iterable>
+maxBy(Iterable&& iterable, const KeySelector& keySelector, const Compare& compare = {}) {
+    return internal::extremeBy(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                               keySelector, internal::ReverseCompare<Compare>(compare));
+}
 } // End namespace lz
 
 #endif // End LZ_FUNCTION_TOOLS_HPP
\ No newline at end of file
@@ -14,8 +14,8 @@ public:
     using const_iterator = iterator;
     using value_type = typename iterator::value_type;
 
-    constexpr Generate(GeneratorFunc func, const std::size_t amount, const bool isWhileTrueLoop) :
-        internal::BasicIteratorView<iterator>(iterator(0, func, isWhileTrueLoop), iterator(amount, func, isWhileTrueLoop)) {
+    constexpr Generate(GeneratorFunc func, const std::size_t amount) :
+        internal::BasicIteratorView<iterator>(iterator(0, func), iterator(amount, func)) {
     }
 
     constexpr Generate() = default;
@@ -41,9 +41,27 @@ public:
  * @return A generator random access iterator view object.
  */
 template<LZ_CONCEPT_INVOCABLE GeneratorFunc>
-LZ_NODISCARD constexpr Generate<GeneratorFunc>
-generate(GeneratorFunc generatorFunc, const std::size_t amount = (std::numeric_limits<std::size_t>::max)()) {
-    return { std::move(generatorFunc), amount, amount == (std::numeric_limits<std::size_t>::max)() };
+LZ_NODISCARD constexpr Generate<GeneratorFunc> generate(GeneratorFunc generatorFunc, const std::size_t amount) {
+    return { std::move(generatorFunc), amount };
+}
+
+/**
+ * @brief Returns a view to a generate iterator that calls `generatorFunc` forever, and is interpreted as a `while-true` loop.
+ * Example:
+ * ```cpp
+ * int a = 0;
+ * for (int i : lz::generate([&a]() { return a++; })) {
+ *     if (i == 3) {
+ *         break;
+ *     }
+ * }
+ * ```
+ * @param generatorFunc The function to execute. The return value of the function is the type that is generated.
+ * @return A generator random access iterator view object.
+ */
+template<LZ_CONCEPT_INVOCABLE GeneratorFunc>
+LZ_NODISCARD constexpr Generate<GeneratorFunc> generate(GeneratorFunc generatorFunc) {
+    return { std::move(generatorFunc), static_cast<std::size_t>((std::numeric_limits<std::ptrdiff_t>::max)()) };
 }
 
 // End of group
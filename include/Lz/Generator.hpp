@@ -0,0 +1,113 @@
+#pragma once
+
+#ifndef LZ_GENERATOR_HPP
+#    define LZ_GENERATOR_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/GeneratorIterator.hpp"
+
+#    ifdef __cpp_lib_coroutine
+
+namespace lz {
+/**
+ * A view over the values that a C++20 coroutine yields with `co_yield`. Producers that keep state between values (tree walks,
+ * paginated readers, decoders) can be written as plain loops, instead of as hand written iterators or state machines, and can be
+ * used with every adaptor of this library. Example:
+ * ```cpp
+ * lz::Generator<Page> pages(Reader& reader) {
+ *     while (reader.hasNext()) {
+ *         co_yield reader.next(); // Pages are never stored in a vector
+ *     }
+ * }
+ *
+ * auto rows = lz::filter(lz::flatten(lz::own(pages(reader))), isValid);
+ * ```
+ * The coroutine starts when the view is first iterated over and is destroyed with the view. A generator is single pass: its
+ * iterators are input iterators, and adaptors that store its iterators refer to the view, so pass temporary generators through
+ * `lz::own`. Other generators can be nested with `co_yield lz::elementsOf(other)`, which resumes the innermost generator
+ * directly, so that recursive generators don't pay for every level of the recursion on every value. The coroutine frame is
+ * allocated with `operator new`, unless its first parameters are `std::allocator_arg, allocator`, in which case the frame is
+ * allocated with `allocator` (a member function coroutine may take those parameters after its object as well).
+ * @tparam T The type of the yielded values. If `T` is a reference, references to the values are yielded instead.
+ */
+template<class T>
+class Generator final : public internal::BasicIteratorView<internal::GeneratorIterator<T>> {
+    using Handle = std::coroutine_handle<internal::GeneratorPromise<T>>;
+    using Base = internal::BasicIteratorView<internal::GeneratorIterator<T>>;
+
+    Handle _handle{};
+
+    friend class internal::GeneratorPromise<T>;
+
+    explicit Generator(const Handle handle) noexcept : Base(internal::GeneratorIterator<T>(handle), {}), _handle(handle) {
+    }
+
+public:
+    using promise_type = internal::GeneratorPromise<T>;
+    using iterator = internal::GeneratorIterator<T>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    Generator() = default;
+
+    Generator(Generator&& other) noexcept : Base(std::move(other)), _handle(std::exchange(other._handle, {})) {
+    }
+
+    Generator& operator=(Generator&& other) noexcept {
+        if (this != &other) {
+            if (_handle) {
+                _handle.destroy();
+            }
+            Base::operator=(std::move(other));
+            _handle = std::exchange(other._handle, {});
+        }
+        return *this;
+    }
+
+    ~Generator() {
+        if (_handle) {
+            _handle.destroy();
+        }
+    }
+};
+
+namespace internal {
+// The coroutine is destroyed with the generator, so its iterators cannot outlive it
+template<class T>
+struct IsBorrowedView<Generator<T>> : std::false_type {};
+} // namespace internal
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Yields all values of `generator` from within another generator, with `co_yield lz::elementsOf(std::move(generator))`. The
+ * nested generator is resumed directly instead of through the generator that yields it. Example:
+ * ```cpp
+ * lz::Generator<const Node&> walk(const Node& node) {
+ *     for (const Node& child : node.children) {
+ *         co_yield lz::elementsOf(walk(child));
+ *     }
+ *     co_yield node;
+ * }
+ * ```
+ * @param generator The generator of which the values are yielded.
+ * @return An object that can only be passed to `co_yield`.
+ */
+template<class T>
+LZ_NODISCARD internal::ElementsOf<T> elementsOf(Generator<T>&& generator) noexcept {
+    return { std::move(generator) };
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#    endif // __cpp_lib_coroutine
+
+#endif // LZ_GENERATOR_HPP
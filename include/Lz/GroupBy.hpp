@@ -4,6 +4,7 @@
 #define LZ_GROUP_BY_HPP
 
 #include "detail/GroupByIterator.hpp"
+#include "detail/HashAggregate.hpp"
 
 namespace lz {
 
@@ -31,6 +32,41 @@ public:
     }
 
     constexpr GroupBy() = default;
+
+#ifdef LZ_HAS_EXECUTION
+    /**
+     * Calls `func` for every group. If `execution` is a parallel policy and `Iterator` is random access, the group boundaries
+     * are searched on multiple threads, and every thread calls `func` for the groups in its part of the sequence, so `func`
+     * must be thread safe. Otherwise the groups are visited sequentially, in order.
+     * @param func A function with the signature `void func(std::pair<value, view>)`.
+     * @param execution The execution policy. Must be one of `std::execution`'s tags.
+     */
+    template<class UnaryFunc, class ForEachExecution = std::execution::sequenced_policy>
+    GroupBy& forEach(UnaryFunc func, ForEachExecution execution = std::execution::seq) {
+        static_cast<void>(execution);
+        if constexpr (internal::checkForwardAndPolicies<ForEachExecution, iterator>()) {
+            for (auto&& group : *this) {
+                func(group);
+            }
+        }
+        else {
+            this->begin().parallelForEach(this->end(), func);
+        }
+        return *this;
+    }
+#else  // ^^ LZ_HAS_EXECUTION vv !LZ_HAS_EXECUTION
+    /**
+     * Calls `func` for every group, in order.
+     * @param func A function with the signature `void func(std::pair<value, view>)`.
+     */
+    template<class UnaryFunc>
+    GroupBy& forEach(UnaryFunc func) {
+        for (auto&& group : *this) {
+            func(group);
+        }
+        return *this;
+    }
+#endif // LZ_HAS_EXECUTION
 };
 
 /**
@@ -109,6 +145,134 @@ GroupBy<internal::IterTypeFromIterable<Iterable>, Comparer> groupBy(Iterable&& i
 
 #endif // end LZ_HAS_EXECUTION
 
+/**
+ * Groups `iterable` by `keySelector` in a single pass, without requiring it to be sorted, and folds every group into an
+ * accumulator. For every element, `fold(accumulator, element)` is called, where `accumulator` starts at `init` for every key.
+ * For e.g. the maximum per key: `lz::aggregateBy(iterable, key, INT_MIN, [](int max, const T& t) { return std::max(max, t.v); })`
+ * @param iterable The sequence to aggregate.
+ * @param keySelector A function that returns the hashable key of an element.
+ * @param init The initial value of the accumulator of every key.
+ * @param fold A function that takes the accumulator and an element and returns the new accumulator.
+ * @return A `std::unordered_map` of key -> accumulator.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector, class T, class Fold>
+LZ_NODISCARD internal::AggregateMap<internal::IterTypeFromIterable<Iterable>, KeySelector, T>
+aggregateBy(Iterable&& iterable, KeySelector keySelector, T init, Fold fold) {
+    using Map = internal::AggregateMap<internal::IterTypeFromIterable<Iterable>, KeySelector, T>;
+    return internal::hashAggregate<Map>(internal::begin(std::forward<Iterable>(iterable)),
+                                        internal::end(std::forward<Iterable>(iterable)), keySelector, init, fold);
+}
+
+#ifdef LZ_HAS_EXECUTION
+/**
+ * Groups `iterable` by `keySelector` in a single pass, without requiring it to be sorted, and folds every group into an
+ * accumulator. For every element, `fold(accumulator, element)` is called, where `accumulator` starts at `init` for every key.
+ * If `execution` is a parallel policy and `iterable` is random access, every thread aggregates its own part of `iterable`
+ * into its own map, after which the partial maps are combined using `merge(accumulator, accumulator)`.
+ * @param iterable The sequence to aggregate.
+ * @param keySelector A function that returns the hashable key of an element.
+ * @param init The initial value of the accumulator of every key.
+ * @param fold A function that takes the accumulator and an element and returns the new accumulator.
+ * @param merge A function that takes two accumulators of the same key and returns the combined accumulator.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags.
+ * @return A `std::unordered_map` of key -> accumulator.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector, class T, class Fold, class Merge,
+         class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD internal::AggregateMap<internal::IterTypeFromIterable<Iterable>, KeySelector, T>
+aggregateBy(Iterable&& iterable, KeySelector keySelector, T init, Fold fold, Merge merge,
+            Execution execution = std::execution::seq) {
+    using Iterator = internal::IterTypeFromIterable<Iterable>;
+    using Map = internal::AggregateMap<Iterator, KeySelector, T>;
+    static_cast<void>(execution);
+    if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>() || !internal::IsRandomAccess<Iterator>::value) {
+        return internal::hashAggregate<Map>(internal::begin(std::forward<Iterable>(iterable)),
+                                            internal::end(std::forward<Iterable>(iterable)), keySelector, init, fold);
+    }
+    else {
+        return internal::parallelHashAggregate<Map>(internal::begin(std::forward<Iterable>(iterable)),
+                                                    internal::end(std::forward<Iterable>(iterable)), keySelector, init, fold,
+                                                    merge);
+    }
+}
+
+/**
+ * Counts the elements of `iterable` per key in a single pass, without requiring it to be sorted.
+ * @param iterable The sequence to count.
+ * @param keySelector A function that returns the hashable key of an element.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags. See `lz::aggregateBy`.
+ * @return A `std::unordered_map` of key -> amount of elements with that key.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector, class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD internal::AggregateMap<internal::IterTypeFromIterable<Iterable>, KeySelector, std::size_t>
+countBy(Iterable&& iterable, KeySelector keySelector, Execution execution = std::execution::seq) {
+    return aggregateBy(std::forward<Iterable>(iterable), std::move(keySelector), std::size_t{ 0 }, internal::CountFold{},
+                       internal::SumMerge{}, execution);
+}
+
+/**
+ * Sums `valueSelector(element)` of the elements of `iterable` per key in a single pass, without requiring it to be sorted.
+ * @param iterable The sequence to sum.
+ * @param keySelector A function that returns the hashable key of an element.
+ * @param valueSelector A function that returns the value of an element to sum.
+ * @param execution The execution policy. Must be one of `std::execution`'s tags. See `lz::aggregateBy`.
+ * @return A `std::unordered_map` of key -> sum of the values with that key.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector, class ValueSelector, class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD internal::AggregateMap<internal::IterTypeFromIterable<Iterable>, KeySelector,
+                                    internal::SumType<internal::IterTypeFromIterable<Iterable>, ValueSelector>>
+sumBy(Iterable&& iterable, KeySelector keySelector, ValueSelector valueSelector, Execution execution = std::execution::seq) {
+    using Sum = internal::SumType<internal::IterTypeFromIterable<Iterable>, ValueSelector>;
+    return aggregateBy(std::forward<Iterable>(iterable), std::move(keySelector), Sum(),
+                       internal::SumFold<ValueSelector>{ std::move(valueSelector) }, internal::SumMerge{}, execution);
+}
+#else // ^^ LZ_HAS_EXECUTION vv !LZ_HAS_EXECUTION
+/**
+ * Groups `iterable` by `keySelector` in a single pass, without requiring it to be sorted, and folds every group into an
+ * accumulator. For every element, `fold(accumulator, element)` is called, where `accumulator` starts at `init` for every key.
+ * `merge` is only used when aggregating in parallel, which requires `<execution>` to be included.
+ * @param iterable The sequence to aggregate.
+ * @param keySelector A function that returns the hashable key of an element.
+ * @param init The initial value of the accumulator of every key.
+ * @param fold A function that takes the accumulator and an element and returns the new accumulator.
+ * @param merge A function that takes two accumulators of the same key and returns the combined accumulator.
+ * @return A `std::unordered_map` of key -> accumulator.
+ */
+template<class Iterable, class KeySelector, class T, class Fold, class Merge>
+internal::AggregateMap<internal::IterTypeFromIterable<Iterable>, KeySelector, T>
+aggregateBy(Iterable&& iterable, KeySelector keySelector, T init, Fold fold, Merge) {
+    return aggregateBy(std::forward<Iterable>(iterable), std::move(keySelector), std::move(init), std::move(fold));
+}
+
+/**
+ * Counts the elements of `iterable` per key in a single pass, without requiring it to be sorted.
+ * @param iterable The sequence to count.
+ * @param keySelector A function that returns the hashable key of an element.
+ * @return A `std::unordered_map` of key -> amount of elements with that key.
+ */
+template<class Iterable, class KeySelector>
+internal::AggregateMap<internal::IterTypeFromIterable<Iterable>, KeySelector, std::size_t>
+countBy(Iterable&& iterable, KeySelector keySelector) {
+    return aggregateBy(std::forward<Iterable>(iterable), std::move(keySelector), std::size_t{ 0 }, internal::CountFold{});
+}
+
+/**
+ * Sums `valueSelector(element)` of the elements of `iterable` per key in a single pass, without requiring it to be sorted.
+ * @param iterable The sequence to sum.
+ * @param keySelector A function that returns the hashable key of an element.
+ * @param valueSelector A function that returns the value of an element to sum.
+ * @return A `std::unordered_map` of key -> sum of the values with that key.
+ */
+template<class Iterable, class KeySelector, class ValueSelector>
+internal::AggregateMap<internal::IterTypeFromIterable<Iterable>, KeySelector,
+                       internal::SumType<internal::IterTypeFromIterable<Iterable>, ValueSelector>>
+sumBy(Iterable&& iterable, KeySelector keySelector, ValueSelector valueSelector) {
+    using Sum = internal::SumType<internal::IterTypeFromIterable<Iterable>, ValueSelector>;
+    return aggregateBy(std::forward<Iterable>(iterable), std::move(keySelector), Sum(),
+                       internal::SumFold<ValueSelector>{ std::move(valueSelector) });
+}
+#endif // end LZ_HAS_EXECUTION
+
 // End of group
 /**
  * @}
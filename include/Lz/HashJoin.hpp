@@ -0,0 +1,127 @@
+#pragma once
+
+#ifndef LZ_HASH_JOIN_HPP
+#    define LZ_HASH_JOIN_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/HashJoinIterator.hpp"
+
+namespace lz {
+namespace internal {
+template<class IterB, class SelectorB>
+using HashJoinKey = Decay<FunctionReturnType<SelectorB, RefType<IterB>>>;
+} // namespace internal
+
+template<class IterA, class Index, class SelectorA, class ResultSelector>
+class HashJoin final : public internal::BasicIteratorView<internal::HashJoinIterator<IterA, Index, SelectorA, ResultSelector>> {
+public:
+    using iterator = internal::HashJoinIterator<IterA, Index, SelectorA, ResultSelector>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    HashJoin(IterA iterA, IterA endA, std::shared_ptr<const Index> index, SelectorA a, ResultSelector resultSelector) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(iterA), endA, index, a, resultSelector),
+                                              iterator(endA, endA, index, a, resultSelector)) {
+    }
+
+    HashJoin() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * The index type that `lz::hashJoinIndex` returns for sequence B with iterator type `IterB` and key selector `SelectorB`.
+ */
+template<class IterB, class SelectorB>
+using HashJoinIndexFor = HashJoinIndex<IterB, internal::HashJoinKey<IterB, SelectorB>>;
+
+/**
+ * Builds a hash index over [iterB, endB) that can be passed to `lz::hashJoin` multiple times, so that B only has to be hashed
+ * once. B does not have to be sorted, but must outlive the index.
+ * @param iterB The beginning of the sequence B to index.
+ * @param endB The ending of the sequence B to index.
+ * @param b A function that returns a hashable key of an element of B.
+ * @return A shared pointer to the index.
+ */
+template<LZ_CONCEPT_ITERATOR IterB, class SelectorB>
+LZ_NODISCARD std::shared_ptr<const HashJoinIndexFor<IterB, SelectorB>> hashJoinIndex(IterB iterB, IterB endB, SelectorB b) {
+    return std::make_shared<const HashJoinIndexFor<IterB, SelectorB>>(std::move(iterB), std::move(endB), std::move(b));
+}
+
+/**
+ * Builds a hash index over `iterableB` that can be passed to `lz::hashJoin` multiple times, so that B only has to be hashed
+ * once. B does not have to be sorted, but must outlive the index.
+ * @param iterableB The sequence B to index.
+ * @param b A function that returns a hashable key of an element of B.
+ * @return A shared pointer to the index.
+ */
+template<LZ_CONCEPT_ITERABLE IterableB, class SelectorB>
+LZ_NODISCARD std::shared_ptr<const HashJoinIndexFor<internal::IterTypeFromIterable<IterableB>, SelectorB>>
+hashJoinIndex(IterableB&& iterableB, SelectorB b) {
+    return hashJoinIndex(internal::begin(std::forward<IterableB>(iterableB)), internal::end(std::forward<IterableB>(iterableB)),
+                         std::move(b));
+}
+
+/**
+ * Performs an SQL-like inner join of [iterA, endA) with an index built by `lz::hashJoinIndex`. For every element of A, all
+ * elements of B whose key is equal to `a(elementOfA)` are looked up in O(1) and `resultSelector(elementOfA, elementOfB)` is
+ * returned for each of them. Matches are yielded in the order of A and, per element of A, in the order of B.
+ * @param iterA The beginning of the sequence A to join.
+ * @param endA The ending of the sequence A to join.
+ * @param index The index of sequence B, created by `lz::hashJoinIndex`. It's kept alive by the view and its iterators.
+ * @param a A function that returns the key of an element of A.
+ * @param resultSelector A function that takes an element of A and an element of B and returns the joined result.
+ * @return A hash join iterator view object, which can be used to iterate over.
+ */
+template<LZ_CONCEPT_ITERATOR IterA, class Index, class SelectorA, class ResultSelector>
+LZ_NODISCARD HashJoin<IterA, Index, SelectorA, ResultSelector>
+hashJoin(IterA iterA, IterA endA, std::shared_ptr<const Index> index, SelectorA a, ResultSelector resultSelector) {
+    return { std::move(iterA), std::move(endA), std::move(index), std::move(a), std::move(resultSelector) };
+}
+
+/**
+ * Performs an SQL-like inner join of `iterableA` with an index built by `lz::hashJoinIndex`. For every element of A, all
+ * elements of B whose key is equal to `a(elementOfA)` are looked up in O(1) and `resultSelector(elementOfA, elementOfB)` is
+ * returned for each of them. Matches are yielded in the order of A and, per element of A, in the order of B.
+ * @param iterableA The sequence A to join.
+ * @param index The index of sequence B, created by `lz::hashJoinIndex`. It's kept alive by the view and its iterators.
+ * @param a A function that returns the key of an element of A.
+ * @param resultSelector A function that takes an element of A and an element of B and returns the joined result.
+ * @return A hash join iterator view object, which can be used to iterate over.
+ */
+template<LZ_CONCEPT_ITERABLE IterableA, class Index, class SelectorA, class ResultSelector>
+LZ_NODISCARD HashJoin<internal::IterTypeFromIterable<IterableA>, Index, SelectorA, ResultSelector>
+hashJoin(IterableA&& iterableA, std::shared_ptr<const Index> index, SelectorA a, ResultSelector resultSelector) {
+    return hashJoin(internal::begin(std::forward<IterableA>(iterableA)), internal::end(std::forward<IterableA>(iterableA)),
+                    std::move(index), std::move(a), std::move(resultSelector));
+}
+
+/**
+ * Performs an SQL-like inner join of `iterableA` and `iterableB` by hashing B once, so unlike `lz::joinWhere`, B does not have
+ * to be sorted. All matches are yielded: for every element of A, `resultSelector(elementOfA, elementOfB)` is returned for each
+ * element of B where `a(elementOfA) == b(elementOfB)`. Use `lz::hashJoinIndex` to reuse the index of B across multiple joins.
+ * @param iterableA The sequence A to join.
+ * @param iterableB The sequence B to join. Must outlive the returned view.
+ * @param a A function that returns the key of an element of A.
+ * @param b A function that returns a hashable key of an element of B.
+ * @param resultSelector A function that takes an element of A and an element of B and returns the joined result.
+ * @return A hash join iterator view object, which can be used to iterate over.
+ */
+template<LZ_CONCEPT_ITERABLE IterableA, LZ_CONCEPT_ITERABLE IterableB, class SelectorA, class SelectorB, class ResultSelector>
+LZ_NODISCARD HashJoin<internal::IterTypeFromIterable<IterableA>,
+                      HashJoinIndexFor<internal::IterTypeFromIterable<IterableB>, SelectorB>, SelectorA, ResultSelector>
+hashJoin(IterableA&& iterableA, IterableB&& iterableB, SelectorA a, SelectorB b, ResultSelector resultSelector) {
+    return hashJoin(std::forward<IterableA>(iterableA), hashJoinIndex(std::forward<IterableB>(iterableB), std::move(b)),
+                    std::move(a), std::move(resultSelector));
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_HASH_JOIN_HPP
@@ -0,0 +1,210 @@
+#pragma once
+
+#ifndef LZ_INCREMENTAL_HPP
+#    define LZ_INCREMENTAL_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/HashAggregate.hpp"
+
+namespace lz {
+namespace internal {
+template<class Fold>
+class IncrementalFold {
+    Fold _fold;
+
+public:
+    explicit IncrementalFold(Fold fold) : _fold(std::move(fold)) {
+    }
+
+    template<class State, class Delta>
+    State operator()(State state, const Delta& added) const {
+        for (auto&& value : added) {
+            state = _fold(std::move(state), value);
+        }
+        return state;
+    }
+};
+
+template<class KeySelector, class T, class Fold>
+class IncrementalAggregate {
+    KeySelector _keySelector;
+    T _init;
+    Fold _fold;
+
+public:
+    IncrementalAggregate(KeySelector keySelector, T init, Fold fold) :
+        _keySelector(std::move(keySelector)),
+        _init(std::move(init)),
+        _fold(std::move(fold)) {
+    }
+
+    template<class Map, class Delta>
+    Map operator()(Map map, const Delta& added) const {
+        hashAggregateInto(map, added.begin(), added.end(), _keySelector, _init, _fold);
+        return map;
+    }
+};
+} // namespace internal
+
+/**
+ * The state of a computation over a container that is only ever appended to, such as a `std::vector` or `std::deque` that
+ * collects measurements. Every `refresh()` only passes the elements that were appended since the previous one to `update`,
+ * so keeping e.g. a filtered sum up to date costs time in the amount of new elements, instead of in the size of the container.
+ * The position is kept as an index, so appending may invalidate the iterators of the container. This works for every
+ * computation that can be continued with more elements, such as sums, counts, minima, maxima and aggregations per key, but
+ * not for e.g. a median. Example:
+ * ```cpp
+ * auto errors = lz::incremental(log, std::ptrdiff_t{ 0 }, [](std::ptrdiff_t count, const auto& added) {
+ *     return count + std::count_if(added.begin(), added.end(), isError);
+ * });
+ * log.push_back(entry);
+ * std::ptrdiff_t errorCount = errors.refresh(); // only looks at `entry`
+ * ```
+ * @tparam Container A random access container, which must outlive this object and may only be appended to.
+ * @tparam State The result of the computation.
+ * @tparam Update A function with the signature `State update(State state, Delta added)`.
+ */
+template<class Container, class State, class Update>
+class Incremental {
+public:
+    using iterator = internal::IterTypeFromIterable<const Container&>;
+    //! The view of the elements that were appended since the previous refresh.
+    using Delta = internal::BasicIteratorView<iterator>;
+
+private:
+    const Container* _source;
+    std::size_t _position{ 0 };
+    State _init;
+    State _state;
+    Update _update;
+
+public:
+    /**
+     * Creates an incremental computation of which the state starts at `init`, without looking at `source` yet.
+     * @param source The container, which must outlive this object.
+     * @param init The state for an empty container.
+     * @param update The function that continues the state with the elements appended to `source`.
+     */
+    Incremental(const Container& source, State init, Update update) :
+        _source(&source),
+        _init(init),
+        _state(std::move(init)),
+        _update(std::move(update)) {
+    }
+
+    /**
+     * Continues the state with the elements that were appended to the container since the previous refresh.
+     * @return The state over all elements of the container.
+     */
+    const State& refresh() {
+        const iterator begin = std::begin(*_source);
+        const auto size = static_cast<std::size_t>(std::end(*_source) - begin);
+        LZ_ASSERT(_position <= size, "the container of an incremental computation may only be appended to");
+        if (_position != size) {
+            using Diff = internal::DiffType<iterator>;
+            _state = _update(std::move(_state), Delta(begin + static_cast<Diff>(_position), begin + static_cast<Diff>(size)));
+            _position = size;
+        }
+        return _state;
+    }
+
+    //! The state over the elements up to `position()`, without looking at newer ones.
+    LZ_NODISCARD const State& value() const noexcept {
+        return _state;
+    }
+
+    //! The amount of elements of the container the state is computed over.
+    LZ_NODISCARD std::size_t position() const noexcept {
+        return _position;
+    }
+
+    //! Forgets all elements, so that the next refresh starts over at the first element of the container.
+    void reset() {
+        _state = _init;
+        _position = 0;
+    }
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Creates a computation over `source` that only processes the elements that were appended to it since the previous
+ * `refresh()`, see `lz::Incremental`. `update` gets the state so far and a view of the new elements, which can be passed to
+ * all adaptors and algorithms. Example:
+ * ```cpp
+ * auto total = lz::incremental(prices, 0., [](double sum, const auto& added) {
+ *     return sum + lz::reduce(lz::filter(added, isLarge), 0., std::plus<double>());
+ * });
+ * ```
+ * @param source A random access container that is only appended to, and which must outlive the result.
+ * @param init The state for an empty container.
+ * @param update A function with the signature `State update(State state, Delta added)`.
+ * @return The incremental computation, of which the state is `init` until it is refreshed.
+ */
+template<class Container, class State, class Update>
+LZ_NODISCARD Incremental<Container, State, Update> incremental(const Container& source, State init, Update update) {
+    return { source, std::move(init), std::move(update) };
+}
+
+template<class Container, class State, class Update>
+Incremental<Container, State, Update> incremental(const Container&& source, State init, Update update) = delete;
+
+/**
+ * Creates a fold over `source` that only folds the elements that were appended to it since the previous `refresh()`, see
+ * `lz::Incremental`. For every new element, `fold(state, element)` is called. Example:
+ * ```cpp
+ * auto maximum = lz::incrementalFold(latencies, 0, [](int max, int latency) { return std::max(max, latency); });
+ * ```
+ * @param source A random access container that is only appended to, and which must outlive the result.
+ * @param init The state for an empty container.
+ * @param fold A function that takes the state and an element and returns the new state.
+ * @return The incremental fold, of which the state is `init` until it is refreshed.
+ */
+template<class Container, class T, class Fold>
+LZ_NODISCARD Incremental<Container, T, internal::IncrementalFold<Fold>>
+incrementalFold(const Container& source, T init, Fold fold) {
+    return { source, std::move(init), internal::IncrementalFold<Fold>(std::move(fold)) };
+}
+
+template<class Container, class T, class Fold>
+Incremental<Container, T, internal::IncrementalFold<Fold>> incrementalFold(const Container&& source, T init, Fold fold) = delete;
+
+/**
+ * Creates an `lz::aggregateBy` over `source` that only aggregates the elements that were appended to it since the previous
+ * `refresh()`, see `lz::Incremental`. The state is a `std::unordered_map` of key -> accumulator. Example:
+ * ```cpp
+ * auto perCustomer = lz::incrementalAggregateBy(orders, customerOf, 0., [](double sum, const Order& o) {
+ *     return sum + o.price;
+ * });
+ * const auto& totals = perCustomer.refresh();
+ * ```
+ * @param source A random access container that is only appended to, and which must outlive the result.
+ * @param keySelector A function that returns the hashable key of an element.
+ * @param init The initial value of the accumulator of every key.
+ * @param fold A function that takes the accumulator and an element and returns the new accumulator.
+ * @return The incremental aggregation, of which the map is empty until it is refreshed.
+ */
+template<class Container, class KeySelector, class T, class Fold>
+LZ_NODISCARD Incremental<Container, internal::AggregateMap<internal::IterTypeFromIterable<const Container&>, KeySelector, T>,
+                         internal::IncrementalAggregate<KeySelector, T, Fold>>
+incrementalAggregateBy(const Container& source, KeySelector keySelector, T init, Fold fold) {
+    return { source,
+             {},
+             internal::IncrementalAggregate<KeySelector, T, Fold>(std::move(keySelector), std::move(init), std::move(fold)) };
+}
+
+template<class Container, class KeySelector, class T, class Fold>
+Incremental<Container, internal::AggregateMap<internal::IterTypeFromIterable<const Container&>, KeySelector, T>,
+            internal::IncrementalAggregate<KeySelector, T, Fold>>
+incrementalAggregateBy(const Container&& source, KeySelector keySelector, T init, Fold fold) = delete;
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_INCREMENTAL_HPP
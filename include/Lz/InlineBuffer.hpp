@@ -0,0 +1,213 @@
+#pragma once
+
+#ifndef LZ_INLINE_BUFFER_HPP
+#    define LZ_INLINE_BUFFER_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+
+#    include <memory>
+#    include <new>
+
+namespace lz {
+/**
+ * A vector like buffer that stores up to `N` elements inside the object itself, so that filling it does not allocate. If more
+ * than `N` elements are added, the elements are moved to the heap, like a `std::vector`. Clearing it keeps its capacity, so
+ * a buffer that is filled and cleared over and over only allocates (at most) once.
+ * @tparam T The element type.
+ * @tparam N The amount of elements that are stored inline.
+ */
+template<class T, std::size_t N>
+class InlineBuffer {
+    static_assert(N > 0, "InlineBuffer requires an inline capacity larger than 0");
+
+    alignas(T) unsigned char _inline[N * sizeof(T)];
+    T* _data = reinterpret_cast<T*>(_inline);
+    std::size_t _size{};
+    std::size_t _capacity = N;
+
+    void destroyAll() noexcept {
+        for (std::size_t i = 0; i < _size; ++i) {
+            _data[i].~T();
+        }
+        _size = 0;
+    }
+
+    void release() noexcept {
+        destroyAll();
+        if (!isInline()) {
+            std::allocator<T>().deallocate(_data, _capacity);
+            _data = reinterpret_cast<T*>(_inline);
+            _capacity = N;
+        }
+    }
+
+    void grow(const std::size_t capacity) {
+        T* const data = std::allocator<T>().allocate(capacity);
+        for (std::size_t i = 0; i < _size; ++i) {
+            ::new (static_cast<void*>(data + i)) T(std::move_if_noexcept(_data[i]));
+            _data[i].~T();
+        }
+        if (!isInline()) {
+            std::allocator<T>().deallocate(_data, _capacity);
+        }
+        _data = data;
+        _capacity = capacity;
+    }
+
+    template<class Iterator>
+    void append(Iterator begin, const Iterator end) {
+        for (; begin != end; ++begin) {
+            emplaceBack(*begin);
+        }
+    }
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    InlineBuffer() = default;
+
+    InlineBuffer(const InlineBuffer& other) {
+        reserve(other._size);
+        append(other.begin(), other.end());
+    }
+
+    InlineBuffer(InlineBuffer&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        *this = std::move(other);
+    }
+
+    InlineBuffer& operator=(const InlineBuffer& other) {
+        if (this != &other) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    InlineBuffer& operator=(InlineBuffer&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this == &other) {
+            return *this;
+        }
+        release();
+        if (other.isInline()) {
+            for (std::size_t i = 0; i < other._size; ++i) {
+                ::new (static_cast<void*>(_data + i)) T(std::move(other._data[i]));
+            }
+            _size = other._size;
+            other.destroyAll();
+            return *this;
+        }
+        // Steals the heap memory of `other`, which goes back to its inline storage
+        _data = other._data;
+        _size = other._size;
+        _capacity = other._capacity;
+        other._data = reinterpret_cast<T*>(other._inline);
+        other._size = 0;
+        other._capacity = N;
+        return *this;
+    }
+
+    ~InlineBuffer() {
+        release();
+    }
+
+    LZ_NODISCARD std::size_t size() const noexcept {
+        return _size;
+    }
+
+    LZ_NODISCARD bool empty() const noexcept {
+        return _size == 0;
+    }
+
+    LZ_NODISCARD std::size_t capacity() const noexcept {
+        return _capacity;
+    }
+
+    //! Whether the elements are stored inside the buffer itself, which is the case until more than `N` elements were added.
+    LZ_NODISCARD bool isInline() const noexcept {
+        return _data == reinterpret_cast<const T*>(_inline);
+    }
+
+    void reserve(const std::size_t capacity) {
+        if (capacity > _capacity) {
+            grow(capacity);
+        }
+    }
+
+    //! Destroys all elements. The capacity, and heap memory if there is any, is kept so that refilling does not allocate.
+    void clear() noexcept {
+        destroyAll();
+    }
+
+    template<class... Args>
+    T& emplaceBack(Args&&... args) {
+        if (_size == _capacity) {
+            // The arguments can refer to an element of this buffer, so the new element is created before the elements move
+            T value(std::forward<Args>(args)...);
+            grow(_capacity * 2);
+            return *::new (static_cast<void*>(_data + _size++)) T(std::move(value));
+        }
+        T* const element = ::new (static_cast<void*>(_data + _size)) T(std::forward<Args>(args)...);
+        ++_size;
+        return *element;
+    }
+
+    void pushBack(const T& value) {
+        emplaceBack(value);
+    }
+
+    void pushBack(T&& value) {
+        emplaceBack(std::move(value));
+    }
+
+    //! Replaces the elements with the elements of [begin, end), reusing the capacity of the buffer.
+    template<class Iterator>
+    void assign(Iterator begin, const Iterator end) {
+        clear();
+        reserve(static_cast<std::size_t>(internal::sizeHint(begin, end).lower));
+        append(std::move(begin), end);
+    }
+
+    LZ_NODISCARD T* data() noexcept {
+        return _data;
+    }
+
+    LZ_NODISCARD const T* data() const noexcept {
+        return _data;
+    }
+
+    LZ_NODISCARD T& operator[](const std::size_t index) noexcept {
+        LZ_ASSERT(index < _size, "index out of bounds");
+        return _data[index];
+    }
+
+    LZ_NODISCARD const T& operator[](const std::size_t index) const noexcept {
+        LZ_ASSERT(index < _size, "index out of bounds");
+        return _data[index];
+    }
+
+    LZ_NODISCARD iterator begin() noexcept {
+        return _data;
+    }
+
+    LZ_NODISCARD iterator end() noexcept {
+        return _data + _size;
+    }
+
+    LZ_NODISCARD const_iterator begin() const noexcept {
+        return _data;
+    }
+
+    LZ_NODISCARD const_iterator end() const noexcept {
+        return _data + _size;
+    }
+
+    //! The elements as a view, so that all the functions of a view (`toVector`, `toString`, ...) can be used.
+    LZ_NODISCARD internal::BasicIteratorView<const T*> view() const noexcept {
+        return { begin(), end() };
+    }
+};
+} // namespace lz
+
+#endif // LZ_INLINE_BUFFER_HPP
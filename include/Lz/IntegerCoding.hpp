@@ -0,0 +1,223 @@
+#pragma once
+
+#ifndef LZ_INTEGER_CODING_HPP
+#    define LZ_INTEGER_CODING_HPP
+
+#    include "Map.hpp"
+#    include "Scan.hpp"
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/IntegerCodingIterator.hpp"
+
+namespace lz {
+template<LZ_CONCEPT_ITERATOR Iterator>
+class Delta final : public internal::BasicIteratorView<internal::DeltaIterator<Iterator>> {
+public:
+    using iterator = internal::DeltaIterator<Iterator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    constexpr Delta(Iterator begin, Iterator end) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(begin)), iterator(std::move(end))) {
+    }
+
+    constexpr Delta() = default;
+};
+
+template<LZ_CONCEPT_ITERATOR Iterator>
+class VarintEncode final : public internal::BasicIteratorView<internal::VarintEncodeIterator<Iterator>> {
+public:
+    using iterator = internal::VarintEncodeIterator<Iterator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    LZ_CONSTEXPR_CXX_20 VarintEncode(Iterator begin, Iterator end) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(begin), end), iterator(end, end)) {
+    }
+
+    constexpr VarintEncode() = default;
+};
+
+template<LZ_CONCEPT_ITERATOR Iterator, class T>
+class VarintDecode final : public internal::BasicIteratorView<internal::VarintDecodeIterator<Iterator, T>> {
+public:
+    using iterator = internal::VarintDecodeIterator<Iterator, T>;
+    using const_iterator = iterator;
+    using value_type = T;
+
+    LZ_CONSTEXPR_CXX_20 VarintDecode(Iterator begin, Iterator end) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(begin), end), iterator(end, end)) {
+    }
+
+    constexpr VarintDecode() = default;
+};
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Returns the differences between consecutive integers of [begin, end), of which the first one is `*begin` itself. The
+ * differences are computed in the unsigned counterpart of the value type, so they wrap around instead of overflowing, and
+ * `lz::undelta` always restores the input. The deltas of a sorted sequence, for e.g. ids or timestamps, are small, and
+ * compress well with `lz::varint`. Example:
+ * ```cpp
+ * std::vector<unsigned> ids = { 100, 103, 110 };
+ * auto deltas = lz::delta(ids); // { 100, 3, 7 }
+ * ```
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @return A forward view of the differences.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD constexpr Delta<Iterator> deltaRange(Iterator begin, Iterator end) {
+    return { std::move(begin), std::move(end) };
+}
+
+/**
+ * Returns the differences between consecutive integers of `iterable`, of which the first one is its first element. See
+ * `lz::deltaRange`.
+ * @param iterable The sequence of integers.
+ * @return A forward view of the differences.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD constexpr Delta<internal::IterTypeFromIterable<Iterable>> delta(Iterable&& iterable) {
+    return deltaRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)));
+}
+
+/**
+ * Restores a sequence from its differences, as returned by `lz::delta`: this is the inclusive scan with an addition that wraps
+ * around instead of overflowing.
+ * @param begin The beginning of the differences.
+ * @param end The ending of the differences.
+ * @return A Scan iterator view object.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Scan<Iterator, internal::Decay<internal::ValueType<Iterator>>, internal::WrappingPlus, true>
+undeltaRange(Iterator begin, Iterator end) {
+    return inclusiveScanRange(std::move(begin), std::move(end), internal::WrappingPlus());
+}
+
+/**
+ * Restores a sequence from its differences, as returned by `lz::delta`. See `lz::undeltaRange`.
+ * @param iterable The differences.
+ * @return A Scan iterator view object.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20
+    Scan<internal::IterTypeFromIterable<Iterable>, internal::Decay<internal::ValueType<internal::IterTypeFromIterable<Iterable>>>,
+         internal::WrappingPlus, true>
+    undelta(Iterable&& iterable) {
+    return undeltaRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)));
+}
+
+/**
+ * Maps signed integers to unsigned integers of the same size, such that values close to zero, positive or negative, become
+ * small: 0, -1, 1, -2, 2... become 0, 1, 2, 3, 4.... Use this before `lz::varint` to encode signed values, for e.g. the deltas
+ * of an unsorted sequence.
+ * @param begin The beginning of the signed integers.
+ * @param end The ending of the signed integers.
+ * @return A random access map view of the unsigned integers.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Map<Iterator, internal::ZigzagEncode> zigzagRange(Iterator begin, Iterator end) {
+    return mapRange(std::move(begin), std::move(end), internal::ZigzagEncode());
+}
+
+/**
+ * Maps signed integers to unsigned integers of the same size, such that values close to zero become small. See
+ * `lz::zigzagRange`.
+ * @param iterable The signed integers.
+ * @return A random access map view of the unsigned integers.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Map<internal::IterTypeFromIterable<Iterable>, internal::ZigzagEncode>
+zigzag(Iterable&& iterable) {
+    return zigzagRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)));
+}
+
+/**
+ * Restores the signed integers of `lz::zigzag`.
+ * @param begin The beginning of the unsigned integers.
+ * @param end The ending of the unsigned integers.
+ * @return A random access map view of the signed integers.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Map<Iterator, internal::ZigzagDecode> unzigzagRange(Iterator begin, Iterator end) {
+    return mapRange(std::move(begin), std::move(end), internal::ZigzagDecode());
+}
+
+/**
+ * Restores the signed integers of `lz::zigzag`.
+ * @param iterable The unsigned integers.
+ * @return A random access map view of the signed integers.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Map<internal::IterTypeFromIterable<Iterable>, internal::ZigzagDecode>
+unzigzag(Iterable&& iterable) {
+    return unzigzagRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)));
+}
+
+/**
+ * Encodes unsigned integers as LEB128 varints: every value takes one byte per 7 significant bits, least significant first,
+ * and the high bit of a byte is set if more bytes of the same value follow. The view yields `std::uint8_t`s, so it can be
+ * written to a byte buffer with e.g. `copyTo` or `toVector`. Signed integers can be encoded with `lz::zigzag` first. Example:
+ * ```cpp
+ * std::vector<std::uint32_t> ids = { 5, 300 };
+ * std::vector<std::uint8_t> bytes = lz::varint(ids).toVector(); // { 0x05, 0xAC, 0x02 }
+ * ```
+ * @param begin The beginning of the unsigned integers.
+ * @param end The ending of the unsigned integers.
+ * @return A forward view of the bytes.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 VarintEncode<Iterator> varintRange(Iterator begin, Iterator end) {
+    return { std::move(begin), std::move(end) };
+}
+
+/**
+ * Encodes unsigned integers as LEB128 varints. See `lz::varintRange`.
+ * @param iterable The unsigned integers.
+ * @return A forward view of the bytes.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 VarintEncode<internal::IterTypeFromIterable<Iterable>> varint(Iterable&& iterable) {
+    return varintRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)));
+}
+
+/**
+ * Decodes a sequence of LEB128 varint bytes into values of type `T`, which is the inverse of `lz::varint`. If the bytes are
+ * contiguous, for e.g. a `std::vector<std::uint8_t>` or a `char` buffer, iterating over all values with e.g. `copyTo`,
+ * `toVector` or `lz::forEach` decodes 8 bytes at a time: every value that ends within such a word is cut out of it without a
+ * branch per byte. A value that is cut off by the end of the bytes is decoded from the bytes that are there, and bits that do
+ * not fit in `T` are dropped.
+ * @tparam T The unsigned integer type to decode to, `std::uint64_t` by default.
+ * @param begin The beginning of the bytes.
+ * @param end The ending of the bytes.
+ * @return A forward view of the decoded values.
+ */
+template<class T = std::uint64_t, LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 VarintDecode<Iterator, T> unvarintRange(Iterator begin, Iterator end) {
+    static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value, "varints decode to unsigned integers");
+    return { std::move(begin), std::move(end) };
+}
+
+/**
+ * Decodes a sequence of LEB128 varint bytes into values of type `T`. See `lz::unvarintRange`.
+ * @tparam T The unsigned integer type to decode to, `std::uint64_t` by default.
+ * @param iterable The bytes.
+ * @return A forward view of the decoded values.
+ */
+template<class T = std::uint64_t, LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 VarintDecode<internal::IterTypeFromIterable<Iterable>, T> unvarint(Iterable&& iterable) {
+    return unvarintRange<T>(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)));
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_INTEGER_CODING_HPP
@@ -33,6 +33,10 @@ public:
         // Join already has a delimiter, default to blank string
         return o << it.toString();
     }
+
+    friend StringView printDelimiter(const Join<Iterator>&) {
+        return "";
+    }
 };
 
 /**
@@ -154,6 +158,24 @@ std::string strJoin(Iterable&& iterable, const StringView& delimiter = "", const
     return strJoinRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
                         delimiter, fmt);
 }
+
+#        ifndef LZ_STANDALONE
+/**
+ * Converts a sequence to a `std::string` using a format that is checked and compiled at compile time, which is faster than a
+ * runtime format string. Example: `lz::strJoin(ints, ",", FMT_COMPILE("{:x}"))`.
+ * @param iterable The iterable to convert to string
+ * @param delimiter The delimiter to separate each value from the sequence.
+ * @param format A compiled format string for a single element, e.g. `FMT_COMPILE("{:x}")`.
+ * @return A string where each item in `iterable` is appended to a string, separated by `delimiter`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Format, class = internal::EnableIf<internal::IsStaticFormat<Format>::value>>
+std::string strJoin(Iterable&& iterable, const StringView& delimiter, const Format& format) {
+    std::string result;
+    internal::toStringStaticFormatImpl(result, internal::begin(std::forward<Iterable>(iterable)),
+                                       internal::end(std::forward<Iterable>(iterable)), delimiter, format);
+    return result;
+}
+#        endif // LZ_STANDALONE
 #    endif // has format
 
 // End of group
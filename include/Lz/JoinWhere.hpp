@@ -3,10 +3,25 @@
 #ifndef LZ_JOIN_WHERE_HPP
 #define LZ_JOIN_WHERE_HPP
 
+#include "Filter.hpp"
 #include "detail/BasicIteratorView.hpp"
 #include "detail/JoinWhereIterator.hpp"
+#include "detail/KeyFilter.hpp"
 
 namespace lz {
+namespace internal {
+template<class IterB, class SelectorB>
+using JoinKey = Decay<FunctionReturnType<SelectorB, RefType<IterB>>>;
+
+#ifdef LZ_HAS_EXECUTION
+template<class IterA, class IterB, class SelectorA, class SelectorB, class Execution>
+using PrefilteredJoinIterator = FilterIterator<IterA, KeyFilterPredicate<JoinKey<IterB, SelectorB>, SelectorA>, Execution>;
+#else
+template<class IterA, class IterB, class SelectorA, class SelectorB>
+using PrefilteredJoinIterator = FilterIterator<IterA, KeyFilterPredicate<JoinKey<IterB, SelectorB>, SelectorA>>;
+#endif // LZ_HAS_EXECUTION
+} // namespace internal
+
 #ifdef LZ_HAS_EXECUTION
 template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector, class Execution>
 class JoinWhere final : public internal::BasicIteratorView<
@@ -106,6 +121,69 @@ joinWhere(IterableA&& iterableA, IterableB&& iterableB, SelectorA a, SelectorB b
                      internal::begin(std::forward<IterableB>(iterableB)), internal::end(std::forward<IterableB>(iterableB)),
                      std::move(a), std::move(b), std::move(resultSelector), execution);
 }
+/**
+ * Performs an SQL-like join like `lz::joinWhere`, for integral keys. An `lz::KeyFilter` is built once from the keys of
+ * [iterB, endB), which rejects most elements of A that have no match before the binary search in B is done. Use this when
+ * most elements of A have no match in B.
+ * @attention [iterB, endB) must be sorted in order to work correctly.
+ * @param iterA The beginning of the sequence A to join.
+ * @param endA The ending of the sequence A to join.
+ * @param iterB The beginning of the sequence B to join.
+ * @param endB The ending of the sequence B to join.
+ * @param a A function that returns the integral key of an element of A.
+ * @param b A function that returns the integral key of an element of B.
+ * @param resultSelector A function that takes an element of A and an element of B and returns the joined result.
+ * @param falsePositiveRate The false positive rate of the key filter, in (0, 1). Lower is faster but uses more memory.
+ * @param execution The execution policy. Must be any of std::execution::*
+ * @return A join where iterator view object, which can be used to iterate over.
+ */
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector,
+         class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD JoinWhere<internal::PrefilteredJoinIterator<IterA, IterB, SelectorA, SelectorB, Execution>, IterB, SelectorA,
+                       SelectorB, ResultSelector, Execution>
+joinWherePrefiltered(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b, ResultSelector resultSelector,
+                     const double falsePositiveRate = internal::defaultFalsePositiveRate,
+                     Execution execution = std::execution::seq) {
+    using Key = internal::JoinKey<IterB, SelectorB>;
+    auto keyFilter = std::make_shared<const KeyFilter<Key>>(iterB, endB, b, falsePositiveRate);
+    auto filtered = filterRange(std::move(iterA), std::move(endA),
+                                internal::KeyFilterPredicate<Key, SelectorA>{ std::move(keyFilter),
+                                                                              internal::FunctionContainer<SelectorA>(a) },
+                                execution);
+    return joinWhere(filtered.begin(), filtered.end(), std::move(iterB), std::move(endB), std::move(a), std::move(b),
+                     std::move(resultSelector), execution);
+}
+
+/**
+ * Performs an SQL-like join like `lz::joinWhere`, for integral keys. An `lz::KeyFilter` is built once from the keys of
+ * `iterableB`, which rejects most elements of A that have no match before the binary search in B is done. Use this when most
+ * elements of A have no match in B.
+ * @attention iterableB must be sorted in order to work correctly.
+ * @param iterableA The sequence to join with `iterableB`.
+ * @param iterableB The sequence to join with `iterableA`.
+ * @param a A function that returns the integral key of an element of A.
+ * @param b A function that returns the integral key of an element of B.
+ * @param resultSelector A function that takes an element of A and an element of B and returns the joined result.
+ * @param falsePositiveRate The false positive rate of the key filter, in (0, 1). Lower is faster but uses more memory.
+ * @param execution The execution policy. Must be any of std::execution::*
+ * @return A join where iterator view object, which can be used to iterate over.
+ */
+template<class IterableA, class IterableB, class SelectorA, class SelectorB, class ResultSelector,
+         class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD JoinWhere<internal::PrefilteredJoinIterator<internal::IterTypeFromIterable<IterableA>,
+                                                         internal::IterTypeFromIterable<IterableB>, SelectorA, SelectorB,
+                                                         Execution>,
+                       internal::IterTypeFromIterable<IterableB>, SelectorA, SelectorB, ResultSelector, Execution>
+joinWherePrefiltered(IterableA&& iterableA, IterableB&& iterableB, SelectorA a, SelectorB b, ResultSelector resultSelector,
+                     const double falsePositiveRate = internal::defaultFalsePositiveRate,
+                     Execution execution = std::execution::seq) {
+    return joinWherePrefiltered(internal::begin(std::forward<IterableA>(iterableA)),
+                                internal::end(std::forward<IterableA>(iterableA)),
+                                internal::begin(std::forward<IterableB>(iterableB)),
+                                internal::end(std::forward<IterableB>(iterableB)), std::move(a), std::move(b),
+                                std::move(resultSelector), falsePositiveRate, execution);
+}
+
 #else
 /**
  * Performs an SQL-like join where the result of the function `a` is compared with `b` using `operator<`, and returns
@@ -159,6 +237,60 @@ joinWhere(IterableA&& iterableA, IterableB&& iterableB, SelectorA a, SelectorB b
                      std::move(a), std::move(b), std::move(resultSelector));
 }
 
+/**
+ * Performs an SQL-like join like `lz::joinWhere`, for integral keys. An `lz::KeyFilter` is built once from the keys of
+ * [iterB, endB), which rejects most elements of A that have no match before the binary search in B is done. Use this when
+ * most elements of A have no match in B.
+ * @attention [iterB, endB) must be sorted in order to work correctly.
+ * @param iterA The beginning of the sequence A to join.
+ * @param endA The ending of the sequence A to join.
+ * @param iterB The beginning of the sequence B to join.
+ * @param endB The ending of the sequence B to join.
+ * @param a A function that returns the integral key of an element of A.
+ * @param b A function that returns the integral key of an element of B.
+ * @param resultSelector A function that takes an element of A and an element of B and returns the joined result.
+ * @param falsePositiveRate The false positive rate of the key filter, in (0, 1). Lower is faster but uses more memory.
+ * @return A join where iterator view object, which can be used to iterate over.
+ */
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector>
+JoinWhere<internal::PrefilteredJoinIterator<IterA, IterB, SelectorA, SelectorB>, IterB, SelectorA, SelectorB, ResultSelector>
+joinWherePrefiltered(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b, ResultSelector resultSelector,
+                     const double falsePositiveRate = internal::defaultFalsePositiveRate) {
+    using Key = internal::JoinKey<IterB, SelectorB>;
+    auto keyFilter = std::make_shared<const KeyFilter<Key>>(iterB, endB, b, falsePositiveRate);
+    auto filtered = filterRange(std::move(iterA), std::move(endA),
+                                internal::KeyFilterPredicate<Key, SelectorA>{ std::move(keyFilter),
+                                                                              internal::FunctionContainer<SelectorA>(a) });
+    return joinWhere(filtered.begin(), filtered.end(), std::move(iterB), std::move(endB), std::move(a), std::move(b),
+                     std::move(resultSelector));
+}
+
+/**
+ * Performs an SQL-like join like `lz::joinWhere`, for integral keys. An `lz::KeyFilter` is built once from the keys of
+ * `iterableB`, which rejects most elements of A that have no match before the binary search in B is done. Use this when most
+ * elements of A have no match in B.
+ * @attention iterableB must be sorted in order to work correctly.
+ * @param iterableA The sequence to join with `iterableB`.
+ * @param iterableB The sequence to join with `iterableA`.
+ * @param a A function that returns the integral key of an element of A.
+ * @param b A function that returns the integral key of an element of B.
+ * @param resultSelector A function that takes an element of A and an element of B and returns the joined result.
+ * @param falsePositiveRate The false positive rate of the key filter, in (0, 1). Lower is faster but uses more memory.
+ * @return A join where iterator view object, which can be used to iterate over.
+ */
+template<class IterableA, class IterableB, class SelectorA, class SelectorB, class ResultSelector>
+JoinWhere<internal::PrefilteredJoinIterator<internal::IterTypeFromIterable<IterableA>, internal::IterTypeFromIterable<IterableB>,
+                                            SelectorA, SelectorB>,
+          internal::IterTypeFromIterable<IterableB>, SelectorA, SelectorB, ResultSelector>
+joinWherePrefiltered(IterableA&& iterableA, IterableB&& iterableB, SelectorA a, SelectorB b, ResultSelector resultSelector,
+                     const double falsePositiveRate = internal::defaultFalsePositiveRate) {
+    return joinWherePrefiltered(internal::begin(std::forward<IterableA>(iterableA)),
+                                internal::end(std::forward<IterableA>(iterableA)),
+                                internal::begin(std::forward<IterableB>(iterableB)),
+                                internal::end(std::forward<IterableB>(iterableB)), std::move(a), std::move(b),
+                                std::move(resultSelector), falsePositiveRate);
+}
+
 #endif // LZ_HAS_EXECUTION
 
 // End of group
@@ -0,0 +1,154 @@
+#pragma once
+
+#ifndef LZ_LAYOUT_HPP
+#    define LZ_LAYOUT_HPP
+
+#    include "detail/LzTools.hpp"
+
+#    include <initializer_list>
+#    include <string>
+#    include <tuple>
+
+namespace lz {
+/**
+ * The size in bytes of the iterator of `Iterable`. Every adaptor stores its own state next to the iterator(s) it wraps, often
+ * with a copy of their end, so this grows with every stage of a chain. Can be used in a `static_assert`, to keep the iterators
+ * of hot chains within a budget:
+ * ```cpp
+ * static_assert(lz::IteratorSize<decltype(view)>::value <= 64, "the iterator of view no longer fits in a cache line");
+ * ```
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+struct IteratorSize : std::integral_constant<std::size_t, sizeof(internal::IterTypeFromIterable<Iterable>)> {};
+
+#    ifndef LZ_HAS_CXX_11
+/**
+ * The size in bytes of the iterator of `Iterable`. See `lz::IteratorSize`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+constexpr std::size_t iteratorSize = IteratorSize<Iterable>::value;
+#    endif // LZ_HAS_CXX_11
+
+namespace internal {
+template<class T>
+struct IsIteratorLike {
+private:
+    template<class U>
+    static std::true_type test(typename U::iterator_category*);
+
+    template<class>
+    static std::false_type test(...);
+
+public:
+    static constexpr bool value = std::is_pointer<T>::value || decltype(test<T>(nullptr))::value;
+};
+
+template<class T>
+struct TemplateArguments {
+    using type = std::tuple<>;
+};
+
+template<template<class...> class Template, class... Args>
+struct TemplateArguments<Template<Args...>> {
+    using type = std::tuple<Args...>;
+};
+
+// The name of T as the compiler spells it, e.g. `lz::internal::MapIterator<int*, Fn>`, where GCC leaves out the namespaces that
+// this function is in
+template<class T>
+std::string typeName() {
+#    ifdef LZ_MSVC
+    const std::string function = __FUNCSIG__;
+    const std::size_t begin = function.find("typeName<") + sizeof("typeName<") - 1;
+    const std::size_t end = function.rfind(">(void)");
+#    else
+    const std::string function = __PRETTY_FUNCTION__;
+    const std::size_t begin = function.find("T = ") + sizeof("T = ") - 1;
+    std::size_t end = function.find(';', begin);
+    if (end == std::string::npos) {
+        end = function.rfind(']');
+    }
+#    endif // LZ_MSVC
+    return function.substr(begin, end - begin);
+}
+
+// The name of a type without its template arguments and the namespace of the adaptors
+inline std::string shortTypeName(std::string name) {
+    for (const char* prefix : { "class ", "struct ", "lz::internal::" }) {
+        const std::string prefixString = prefix;
+        if (name.compare(0, prefixString.size(), prefixString) == 0) {
+            name.erase(0, prefixString.size());
+        }
+    }
+    return name.substr(0, name.find('<'));
+}
+
+template<class T>
+void writeLayout(std::string& out, std::size_t depth);
+
+template<class T>
+void writeLayoutIfIterator(std::true_type /* isIterator */, std::string& out, const std::size_t depth) {
+    writeLayout<T>(out, depth);
+}
+
+template<class T>
+void writeLayoutIfIterator(std::false_type /* isIterator */, std::string&, std::size_t) {
+}
+
+template<class Tuple>
+struct LayoutChildren;
+
+template<>
+struct LayoutChildren<std::tuple<>> {
+    static void write(std::string&, std::size_t) {
+    }
+};
+
+template<class Arg, class... Args>
+struct LayoutChildren<std::tuple<Arg, Args...>> {
+    static void write(std::string& out, const std::size_t depth) {
+        using Expand = int[];
+        static_cast<void>(Expand{
+            (writeLayoutIfIterator<Arg>(std::integral_constant<bool, IsIteratorLike<Arg>::value>(), out, depth), 0),
+            (writeLayoutIfIterator<Args>(std::integral_constant<bool, IsIteratorLike<Args>::value>(), out, depth), 0)... });
+    }
+};
+
+// Writes a line for T, and a line per iterator it is composed of. These are found by the template arguments of T, so iterators
+// that are not templates, or that have non type template parameters, are leaves
+template<class T>
+void writeLayout(std::string& out, const std::size_t depth) {
+    out.append(2 * depth, ' ');
+    out += shortTypeName(typeName<T>());
+    out += " (sizeof ";
+    out += std::to_string(sizeof(T));
+    out += ", alignof ";
+    out += std::to_string(alignof(T));
+    out += ")\n";
+    LayoutChildren<typename TemplateArguments<T>::type>::write(out, depth + 1);
+}
+} // namespace internal
+
+namespace debug {
+/**
+ * Returns the tree of the iterators that the iterator of `Iterable` is composed of, with the size and alignment of every
+ * level, one line per iterator, indented by its depth. E.g. for `lz::map(lz::filter(vec, pred), fn)`:
+ * ```
+ * MapIterator (sizeof 32, alignof 8)
+ *   FilterIterator (sizeof 24, alignof 8)
+ *     __gnu_cxx::__normal_iterator (sizeof 8, alignof 8)
+ *       int* (sizeof 8, alignof 8)
+ * ```
+ * The difference between the size of a level and the sizes of the levels below it is the state of that adaptor, such as copies
+ * of the end of the sequence and the stored functions. The names are as spelled by the compiler.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+std::string layoutOf() {
+    std::string out;
+    internal::writeLayout<internal::IterTypeFromIterable<Iterable>>(out, 0);
+    return out;
+}
+} // namespace debug
+} // namespace lz
+
+#endif // LZ_LAYOUT_HPP
@@ -3,24 +3,59 @@
 #ifndef LZ_LZ_HPP
 #    define LZ_LZ_HPP
 
+#    include "Lz/Batched.hpp"
+#    include "Lz/BinaryRecords.hpp"
+#    include "Lz/BitMask.hpp"
+#    include "Lz/Cached.hpp"
 #    include "Lz/CartesianProduct.hpp"
 #    include "Lz/ChunkIf.hpp"
 #    include "Lz/Chunks.hpp"
+#    include "Lz/Columns.hpp"
+#    include "Lz/ConcatenateAll.hpp"
+#    include "Lz/CounterRandom.hpp"
+#    include "Lz/CsvSplitter.hpp"
+#    include "Lz/Distinct.hpp"
 #    include "Lz/Enumerate.hpp"
 #    include "Lz/Except.hpp"
 #    include "Lz/Exclude.hpp"
+#    include "Lz/FilterMap.hpp"
+#    include "Lz/FlatHashMap.hpp"
+#    include "Lz/FlatMap.hpp"
 #    include "Lz/Flatten.hpp"
 #    include "Lz/FunctionTools.hpp"
 #    include "Lz/Generate.hpp"
+#    include "Lz/Generator.hpp"
 #    include "Lz/GroupBy.hpp"
+#    include "Lz/HashJoin.hpp"
+#    include "Lz/Incremental.hpp"
+#    include "Lz/InlineBuffer.hpp"
+#    include "Lz/IntegerCoding.hpp"
 #    include "Lz/JoinWhere.hpp"
+#    include "Lz/Layout.hpp"
 #    include "Lz/Loop.hpp"
+#    include "Lz/Merge.hpp"
+#    include "Lz/MergeJoin.hpp"
+#    include "Lz/MoveFrom.hpp"
+#    include "Lz/Own.hpp"
+#    include "Lz/ParallelMap.hpp"
+#    include "Lz/Partitions.hpp"
+#    include "Lz/Pmr.hpp"
+#    include "Lz/Prefetch.hpp"
+#    include "Lz/Prefetched.hpp"
+#    include "Lz/Probe.hpp"
+#    include "Lz/QuantileSketch.hpp"
 #    include "Lz/Random.hpp"
 #    include "Lz/Range.hpp"
 #    include "Lz/Repeat.hpp"
+#    include "Lz/RingBuffer.hpp"
 #    include "Lz/Rotate.hpp"
+#    include "Lz/RunLength.hpp"
+#    include "Lz/Scan.hpp"
+#    include "Lz/SetOperations.hpp"
+#    include "Lz/Statistics.hpp"
 #    include "Lz/TakeEvery.hpp"
 #    include "Lz/Unique.hpp"
+#    include "Lz/Windows.hpp"
 // Function tools includes:
 // Concatenate.hpp
 // Filter.hpp
@@ -35,11 +70,7 @@ namespace lz {
 namespace internal {
 template<class Iterator, class T, class BinOp>
 T accumulate(Iterator begin, Iterator end, T init, BinOp binOp) {
-    while (begin != end) {
-        init = binOp(std::move(init), *begin);
-        ++begin;
-    }
-    return init;
+    return sumFold(std::move(begin), end, std::move(init), std::move(binOp));
 }
 } // namespace internal
 #    endif // LZ_HAS_CXX_EXECUTION
@@ -78,6 +109,90 @@ LZ_CONSTEXPR_CXX_20 IterView<internal::IterTypeFromIterable<Iterable>> toIter(It
  * @}
  */
 
+namespace internal {
+// Chaining a map onto a map, or a filter onto a filter, does not nest another iterator, but fuses both layers into one: a map
+// of the composed function, or a filter of the conjunction of both predicates. This keeps long chains from storing the
+// underlying iterators over and over again, and removes one end comparison per fused filter
+template<class Iterator, class Function>
+struct MapFusion {
+    using type = MapIterator<Iterator, Function>;
+
+    template<class View>
+    LZ_CONSTEXPR_CXX_20 static IterView<type> fuse(const View& view, Function function) {
+        return toIter(lz::map(view, std::move(function)));
+    }
+};
+
+template<class Iterator, class First, class Second>
+struct MapFusion<MapIterator<Iterator, First>, Second> {
+    using type = MapIterator<Iterator, ComposedFunction<First, Second>>;
+
+    template<class View>
+    LZ_CONSTEXPR_CXX_20 static IterView<type> fuse(const View& view, Second function) {
+        ComposedFunction<First, Second> composed(view.begin().function(), std::move(function));
+        return { type(view.begin().base(), composed), type(view.end().base(), composed) };
+    }
+};
+
+template<class Iterator, class Function>
+using FusedMapIterType = typename MapFusion<Iterator, Function>::type;
+
+#    ifdef LZ_HAS_EXECUTION
+template<class Iterator, class UnaryPredicate, class Execution>
+struct FilterFusion {
+    using type = FilterIterator<Iterator, UnaryPredicate, Execution>;
+
+    template<class View>
+    LZ_CONSTEXPR_CXX_20 static IterView<type> fuse(const View& view, UnaryPredicate predicate, Execution execution) {
+        return toIter(lz::filter(view, std::move(predicate), execution));
+    }
+};
+
+// Filters are only fused if they run with the same execution policy
+template<class Iterator, class First, class Second, class Execution>
+struct FilterFusion<FilterIterator<Iterator, First, Execution>, Second, Execution> {
+    using type = FilterIterator<Iterator, ConjunctionFunction<First, Second>, Execution>;
+
+    template<class View>
+    LZ_CONSTEXPR_CXX_20 static IterView<type> fuse(const View& view, Second predicate, Execution execution) {
+        ConjunctionFunction<First, Second> conjunction(view.begin().predicate(), std::move(predicate));
+        const Iterator begin = view.begin().base();
+        const Iterator end = view.end().base();
+        return { type(begin, begin, end, conjunction, execution), type(end, begin, end, conjunction, execution) };
+    }
+};
+
+template<class Iterator, class UnaryPredicate, class Execution>
+using FusedFilterIterType = typename FilterFusion<Iterator, UnaryPredicate, Execution>::type;
+#    else  // ^^^ lz has execution vvv ! lz has execution
+template<class Iterator, class UnaryPredicate>
+struct FilterFusion {
+    using type = FilterIterator<Iterator, UnaryPredicate>;
+
+    template<class View>
+    LZ_CONSTEXPR_CXX_20 static IterView<type> fuse(const View& view, UnaryPredicate predicate) {
+        return toIter(lz::filter(view, std::move(predicate)));
+    }
+};
+
+template<class Iterator, class First, class Second>
+struct FilterFusion<FilterIterator<Iterator, First>, Second> {
+    using type = FilterIterator<Iterator, ConjunctionFunction<First, Second>>;
+
+    template<class View>
+    LZ_CONSTEXPR_CXX_20 static IterView<type> fuse(const View& view, Second predicate) {
+        ConjunctionFunction<First, Second> conjunction(view.begin().predicate(), std::move(predicate));
+        const Iterator begin = view.begin().base();
+        const Iterator end = view.end().base();
+        return { type(begin, begin, end, conjunction), type(end, begin, end, conjunction) };
+    }
+};
+
+template<class Iterator, class UnaryPredicate>
+using FusedFilterIterType = typename FilterFusion<Iterator, UnaryPredicate>::type;
+#    endif // LZ_HAS_EXECUTION
+} // namespace internal
+
 template<LZ_CONCEPT_ITERATOR Iterator>
 class IterView final : public internal::BasicIteratorView<Iterator> {
     using Base = internal::BasicIteratorView<Iterator>;
@@ -99,7 +214,7 @@ public:
     //! See Concatenate.hpp for documentation.
     template<LZ_CONCEPT_ITERABLE... Iterables>
     LZ_NODISCARD
-        LZ_CONSTEXPR_CXX_20 IterView<internal::ConcatenateIterator<Iterator, internal::IterTypeFromIterable<Iterables>...>>
+        LZ_CONSTEXPR_CXX_20 IterView<internal::ConcatenateIteratorFor<Iterator, internal::IterTypeFromIterable<Iterables>...>>
         concat(Iterables&&... iterables) const {
         return toIter(lz::concat(*this, std::forward<Iterables>(iterables)...));
     }
@@ -117,16 +232,60 @@ public:
         return toIter(lz::exclude(*this, from, to));
     }
 
+    //! See Scan.hpp for documentation.
+    template<class BinaryOp = std::plus<value_type>>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::ScanIterator<Iterator, value_type, BinaryOp, true>>
+    inclusiveScan(BinaryOp binaryOp = {}) const {
+        return toIter(lz::inclusiveScan(*this, std::move(binaryOp)));
+    }
+
+    //! See Scan.hpp for documentation.
+    template<class T, class BinaryOp = std::plus<T>>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::ScanIterator<Iterator, T, BinaryOp, false>>
+    exclusiveScan(T init, BinaryOp binaryOp = {}) const {
+        return toIter(lz::exclusiveScan(*this, std::move(init), std::move(binaryOp)));
+    }
+
     //! See Join.hpp for documentation.
     LZ_NODISCARD IterView<internal::JoinIterator<Iterator>> join(std::string delimiter) const {
         return toIter(lz::join(*this, std::move(delimiter)));
     }
 
-    //! See Map.hpp for documentation
+    //! See Map.hpp for documentation. A map directly after another map is fused with it into one layer.
     template<class UnaryFunction>
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::MapIterator<Iterator, UnaryFunction>>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::FusedMapIterType<Iterator, UnaryFunction>>
     map(UnaryFunction unaryFunction) const {
-        return toIter(lz::map(*this, std::move(unaryFunction)));
+        return internal::MapFusion<Iterator, UnaryFunction>::fuse(*this, std::move(unaryFunction));
+    }
+
+    //! See Map.hpp for documentation
+    template<class UnaryFunction>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::MapCachedIterator<Iterator, UnaryFunction>>
+    mapCached(UnaryFunction unaryFunction) const {
+        return toIter(lz::mapCached(*this, std::move(unaryFunction)));
+    }
+
+    //! See Batched.hpp for documentation
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::BatchedIterType<Iterator>> batched(const std::size_t batchSize) const {
+        return toIter(lz::batchedRange(Base::begin(), Base::end(), batchSize));
+    }
+
+    //! See ParallelMap.hpp for documentation
+    template<class UnaryFunction>
+    LZ_NODISCARD IterView<internal::ParallelMapIterator<Iterator, UnaryFunction>>
+    parallelMap(UnaryFunction unaryFunction, const execution::PoolPolicy policy, const std::size_t window = 0) const {
+        return toIter(lz::parallelMap(*this, std::move(unaryFunction), policy, window));
+    }
+
+    //! See Prefetch.hpp for documentation
+    LZ_NODISCARD IterView<internal::PrefetchIterator<Iterator>> prefetch(const std::size_t queueDepth) const {
+        return toIter(lz::prefetch(*this, queueDepth));
+    }
+
+    //! See Prefetched.hpp for documentation
+    template<class I = Iterator>
+    LZ_NODISCARD IterView<internal::PrefetchedIterator<I>> prefetched(const difference_type distance) const {
+        return toIter(lz::prefetched(*this, distance));
     }
 
     //! See Take.hpp for documentation.
@@ -136,7 +295,7 @@ public:
     }
 
     //! See Take.hpp for documentation.
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<Iterator> take(const difference_type amount) const {
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::TakeIterType<Iterator>> take(const difference_type amount) const {
         return toIter(lz::take(*this, amount));
     }
 
@@ -146,7 +305,8 @@ public:
     }
 
     //! See Take.hpp for documentation.
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<Iterator> slice(const difference_type from, const difference_type to) const {
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::TakeIterType<Iterator>>
+    slice(const difference_type from, const difference_type to) const {
         return toIter(lz::slice(*this, from, to));
     }
 
@@ -162,6 +322,144 @@ public:
         return toIter(lz::chunks(*this, chunkSize));
     }
 
+    //! See IntegerCoding.hpp for documentation
+    template<class I = Iterator>
+    LZ_NODISCARD constexpr IterView<internal::DeltaIterator<I>> delta() const {
+        return toIter(lz::delta(*this));
+    }
+
+    //! See IntegerCoding.hpp for documentation
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::ScanIterator<I, value_type, internal::WrappingPlus, true>>
+    undelta() const {
+        return toIter(lz::undelta(*this));
+    }
+
+    //! See IntegerCoding.hpp for documentation
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::MapIterator<I, internal::ZigzagEncode>> zigzag() const {
+        return toIter(lz::zigzag(*this));
+    }
+
+    //! See IntegerCoding.hpp for documentation
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::MapIterator<I, internal::ZigzagDecode>> unzigzag() const {
+        return toIter(lz::unzigzag(*this));
+    }
+
+    //! See IntegerCoding.hpp for documentation
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::VarintEncodeIterator<I>> varint() const {
+        return toIter(lz::varint(*this));
+    }
+
+    //! See IntegerCoding.hpp for documentation
+    template<class T = std::uint64_t>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::VarintDecodeIterator<Iterator, T>> unvarint() const {
+        return toIter(lz::unvarint<T>(*this));
+    }
+
+    //! See RunLength.hpp for documentation
+    template<class Comparer = internal::RleEqual<Iterator>>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::RleIterator<Iterator, Comparer>> rle(Comparer comparer = {}) const {
+        return toIter(lz::rle(*this, std::move(comparer)));
+    }
+
+    //! See RunLength.hpp for documentation
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::UnrleIterator<I>> unrle() const {
+        return toIter(lz::unrle(*this));
+    }
+
+    //! See BitMask.hpp for documentation
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::SetBitsIterator<I>> setBits() const {
+        return toIter(lz::setBits(*this));
+    }
+
+    //! See BitMask.hpp for documentation
+    template<class Mask>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<
+        internal::MapIterator<internal::SetBitsIterator<internal::IterTypeFromIterable<Mask>>, internal::IndexInto<Iterator>>>
+    selectBits(Mask&& mask) const {
+        return toIter(lz::selectBits(*this, std::forward<Mask>(mask)));
+    }
+
+    //! See Windows.hpp for documentation
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::WindowsIterator<Iterator>> windows(const std::size_t windowSize) const {
+        return toIter(lz::windows(*this, windowSize));
+    }
+
+    //! See Windows.hpp for documentation
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::SlidingSumIterator<Iterator>>
+    slidingSum(const std::size_t windowSize) const {
+        return toIter(lz::slidingSum(*this, windowSize));
+    }
+
+    //! See Windows.hpp for documentation
+    LZ_NODISCARD IterView<internal::SlidingExtremeIterator<Iterator, internal::MinSelector<Iterator>>>
+    slidingMin(const std::size_t windowSize) const {
+        return toIter(lz::slidingMin(*this, windowSize));
+    }
+
+    //! See Windows.hpp for documentation
+    LZ_NODISCARD IterView<internal::SlidingExtremeIterator<Iterator, internal::MaxSelector<Iterator>>>
+    slidingMax(const std::size_t windowSize) const {
+        return toIter(lz::slidingMax(*this, windowSize));
+    }
+
+    //! See Merge.hpp for documentation
+    template<LZ_CONCEPT_ITERABLE... Iterables>
+    LZ_NODISCARD auto merge(Iterables&&... iterables) const
+        -> IterView<decltype(std::begin(lz::merge(*this, std::forward<Iterables>(iterables)...)))> {
+        return toIter(lz::merge(*this, std::forward<Iterables>(iterables)...));
+    }
+
+    //! See Merge.hpp for documentation
+    template<class Compare, LZ_CONCEPT_ITERABLE... Iterables>
+    LZ_NODISCARD auto mergeWith(Compare compare, Iterables&&... iterables) const
+        -> IterView<decltype(std::begin(lz::mergeWith(std::move(compare), *this, std::forward<Iterables>(iterables)...)))> {
+        return toIter(lz::mergeWith(std::move(compare), *this, std::forward<Iterables>(iterables)...));
+    }
+
+    //! See SetOperations.hpp for documentation
+    template<LZ_CONCEPT_ITERABLE Iterable, class Compare = internal::SetCompare<Iterator>>
+    LZ_NODISCARD IterView<
+        internal::SetOperationIterator<Iterator, internal::IterTypeFromIterable<Iterable>, Compare, internal::SetIntersection>>
+    setIntersection(Iterable&& iterable, Compare compare = {}) const {
+        return toIter(lz::setIntersection(*this, std::forward<Iterable>(iterable), std::move(compare)));
+    }
+
+    //! See SetOperations.hpp for documentation
+    template<LZ_CONCEPT_ITERABLE Iterable, class Compare = internal::SetCompare<Iterator>>
+    LZ_NODISCARD IterView<
+        internal::SetOperationIterator<Iterator, internal::IterTypeFromIterable<Iterable>, Compare, internal::SetUnion>>
+    setUnion(Iterable&& iterable, Compare compare = {}) const {
+        return toIter(lz::setUnion(*this, std::forward<Iterable>(iterable), std::move(compare)));
+    }
+
+    //! See SetOperations.hpp for documentation
+    template<LZ_CONCEPT_ITERABLE Iterable, class Compare = internal::SetCompare<Iterator>>
+    LZ_NODISCARD IterView<
+        internal::SetOperationIterator<Iterator, internal::IterTypeFromIterable<Iterable>, Compare, internal::SetDifference>>
+    setDifference(Iterable&& iterable, Compare compare = {}) const {
+        return toIter(lz::setDifference(*this, std::forward<Iterable>(iterable), std::move(compare)));
+    }
+
+    //! See SetOperations.hpp for documentation
+    template<LZ_CONCEPT_ITERABLE Iterable, class Compare = internal::SetCompare<Iterator>>
+    LZ_NODISCARD IterView<internal::SetOperationIterator<Iterator, internal::IterTypeFromIterable<Iterable>, Compare,
+                                                         internal::SetSymmetricDifference>>
+    setSymmetricDifference(Iterable&& iterable, Compare compare = {}) const {
+        return toIter(lz::setSymmetricDifference(*this, std::forward<Iterable>(iterable), std::move(compare)));
+    }
+
+    //! See Probe.hpp for documentation
+    template<class Enabled = internal::ProbesEnabled>
+    LZ_NODISCARD IterView<internal::ProbeIterator<Iterator>> probe(const char* name) const {
+        return toIter(lz::probeRange<Iterator, Enabled>(Base::begin(), Base::end(), name));
+    }
+
     //! See Zip.hpp for documentation.
     template<LZ_CONCEPT_ITERABLE... Iterables>
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::ZipIterator<Iterator, internal::IterTypeFromIterable<Iterables>>...>
@@ -206,7 +504,7 @@ public:
 
     //! See Flatten.hpp for documentation
     template<int N = lz::internal::CountDims<std::iterator_traits<Iterator>>::value - 1>
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::FlattenIterator<Iterator, N>> flatten() const {
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::FlattenIteratorFor<Iterator, N>> flatten() const {
         return toIter(lz::flatten(*this));
     }
 
@@ -222,6 +520,38 @@ public:
         return toIter(lz::rotate(*this, start));
     }
 
+    //! See HashJoin.hpp for documentation
+    template<class IterableB, class SelectorA, class SelectorB, class ResultSelector>
+    LZ_NODISCARD IterView<internal::HashJoinIterator<
+        Iterator, HashJoinIndexFor<internal::IterTypeFromIterable<IterableB>, SelectorB>, SelectorA, ResultSelector>>
+    hashJoin(IterableB&& iterableB, SelectorA a, SelectorB b, ResultSelector resultSelector) const {
+        return toIter(lz::hashJoin(*this, iterableB, std::move(a), std::move(b), std::move(resultSelector)));
+    }
+
+    //! See HashJoin.hpp for documentation
+    template<class Index, class SelectorA, class ResultSelector>
+    LZ_NODISCARD IterView<internal::HashJoinIterator<Iterator, Index, SelectorA, ResultSelector>>
+    hashJoin(std::shared_ptr<const Index> index, SelectorA a, ResultSelector resultSelector) const {
+        return toIter(lz::hashJoin(*this, std::move(index), std::move(a), std::move(resultSelector)));
+    }
+
+    //! See MergeJoin.hpp for documentation
+    template<class IterableB, class SelectorA, class SelectorB, class ResultSelector>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20
+    IterView<internal::MergeJoinIterator<Iterator, internal::IterTypeFromIterable<IterableB>, SelectorA, SelectorB, ResultSelector>>
+    mergeJoin(IterableB&& iterableB, SelectorA a, SelectorB b, ResultSelector resultSelector) const {
+        return toIter(lz::mergeJoin(*this, iterableB, std::move(a), std::move(b), std::move(resultSelector)));
+    }
+
+    //! See Distinct.hpp for documentation
+    template<class Hash = std::hash<value_type>, class KeyEqual = std::equal_to<value_type>,
+             class Allocator = std::allocator<value_type>>
+    LZ_NODISCARD IterView<internal::DistinctIterator<Iterator, Hash, KeyEqual, Allocator>>
+    distinct(const std::size_t capacityHint = 0, const Hash& hash = {}, const KeyEqual& keyEqual = {},
+             const Allocator& allocator = {}) const {
+        return toIter(lz::distinct(*this, capacityHint, hash, keyEqual, allocator));
+    }
+
     //! See FunctionTools.hpp `hasOne` for documentation.
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool hasOne() const {
         return lz::hasOne(*this);
@@ -244,12 +574,18 @@ public:
         return lz::backOr(*this, defaultValue);
     }
 
+    //! See FunctionTools.hpp `containsAny` for documentation.
+    template<class Needles>
+    LZ_NODISCARD bool containsAny(const Needles& needles) const {
+        return lz::containsAny(*this, needles);
+    }
+
 #    ifdef LZ_HAS_EXECUTION
-    //! See Filter.hpp for documentation.
+    //! See Filter.hpp for documentation. A filter directly after another filter is fused with it into one layer.
     template<class UnaryPredicate, class Execution = std::execution::sequenced_policy>
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::FilterIterator<Iterator, UnaryPredicate, Execution>>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::FusedFilterIterType<Iterator, UnaryPredicate, Execution>>
     filter(UnaryPredicate predicate, Execution execution = std::execution::seq) const {
-        return toIter(lz::filter(*this, std::move(predicate), execution));
+        return internal::FilterFusion<Iterator, UnaryPredicate, Execution>::fuse(*this, std::move(predicate), execution);
     }
 
     //! See Except.hpp for documentation.
@@ -260,6 +596,33 @@ public:
         return toIter(lz::except(*this, toExcept, std::move(compare), execution));
     }
 
+    //! See Except.hpp for documentation.
+    template<class IterableToExcept, class Execution = std::execution::sequenced_policy,
+             class Hash = std::hash<internal::ValueTypeIterable<IterableToExcept>>,
+             class KeyEqual = std::equal_to<internal::ValueTypeIterable<IterableToExcept>>>
+    LZ_NODISCARD IterView<internal::FilterIterator<
+        Iterator, internal::HashedExclusionPredicate<internal::IterTypeFromIterable<IterableToExcept>, Hash, KeyEqual>, Execution>>
+    exceptHashed(IterableToExcept&& toExcept, Hash hash = {}, KeyEqual keyEqual = {},
+                 Execution execution = std::execution::seq) const {
+        return toIter(lz::exceptHashed(*this, toExcept, std::move(hash), std::move(keyEqual), execution));
+    }
+
+    //! See Except.hpp for documentation.
+    template<class Set, class Execution = std::execution::sequenced_policy>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::FilterIterator<Iterator, internal::NotContainedIn<const Set*>, Execution>>
+    exceptIn(const Set& toExcept, Execution execution = std::execution::seq) const {
+        return toIter(lz::exceptIn(*this, toExcept, execution));
+    }
+
+    //! See Except.hpp for documentation.
+    template<class IterableToExcept, class Execution = std::execution::sequenced_policy, class Compare = std::less<>>
+    LZ_NODISCARD IterView<internal::FilterIterator<
+        Iterator, internal::PrefilteredExclusionPredicate<internal::IterTypeFromIterable<IterableToExcept>, Compare>, Execution>>
+    exceptPrefiltered(IterableToExcept&& toExcept, const double falsePositiveRate = internal::defaultFalsePositiveRate,
+                      Compare compare = {}, Execution execution = std::execution::seq) const {
+        return toIter(lz::exceptPrefiltered(*this, toExcept, falsePositiveRate, std::move(compare), execution));
+    }
+
     //! See Unique.hpp for documentation.
     template<class Execution = std::execution::sequenced_policy, class Compare = std::less<>>
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::UniqueIterator<Execution, Iterator, Compare>>
@@ -282,6 +645,13 @@ public:
         return toIter(lz::filterMap(*this, std::move(filterFunc), std::move(mapFunc), execution));
     }
 
+    //! See FilterMap.hpp for documentation.
+    template<class Function>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::FilterMapIterator<Iterator, Function>>
+    filterMap(Function function) const {
+        return toIter(lz::filterMap(*this, std::move(function)));
+    }
+
     //! See FunctionTools.hpp `select` for documentation.
     template<class SelectorIterable, class Execution = std::execution::sequenced_policy>
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 auto select(SelectorIterable&& selectors, Execution execution = std::execution::seq) const {
@@ -298,6 +668,16 @@ public:
         return toIter(lz::joinWhere(*this, iterableB, std::move(a), std::move(b), std::move(resultSelector), execution));
     }
 
+    //! See JoinWhere.hpp for documentation
+    template<class IterableB, class SelectorA, class SelectorB, class ResultSelector,
+             class Execution = std::execution::sequenced_policy>
+    LZ_NODISCARD auto joinWherePrefiltered(IterableB&& iterableB, SelectorA a, SelectorB b, ResultSelector resultSelector,
+                                           const double falsePositiveRate = internal::defaultFalsePositiveRate,
+                                           Execution execution = std::execution::seq) const {
+        return toIter(lz::joinWherePrefiltered(*this, iterableB, std::move(a), std::move(b), std::move(resultSelector),
+                                               falsePositiveRate, execution));
+    }
+
     //! See Take.hpp for documentation
     template<class UnaryPredicate, class Execution = std::execution::sequenced_policy>
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<Iterator>
@@ -418,7 +798,10 @@ public:
     LZ_CONSTEXPR_CXX_20 IterView<Iterator>& forEach(UnaryFunc func, Execution execution = std::execution::seq) {
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            std::for_each(Base::begin(), Base::end(), std::move(func));
+            internal::sinkForEach(Base::begin(), Base::end(), func);
+        }
+        else if constexpr (internal::HasParallelForEach<Iterator>::value) {
+            Base::begin().parallelForEach(Base::end(), func);
         }
         else {
             std::for_each(execution, Base::begin(), Base::end(), std::move(func));
@@ -436,7 +819,7 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 T foldl(T&& init, BinaryFunction function, Execution execution = std::execution::seq) const {
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::reduce(Base::begin(), Base::end(), std::forward<T>(init), std::move(function));
+            return internal::sumFold(Base::begin(), Base::end(), std::forward<T>(init), std::move(function));
         }
         else {
             return std::reduce(execution, Base::begin(), Base::end(), std::forward<T>(init), std::move(function));
@@ -483,7 +866,7 @@ public:
         LZ_ASSERT(!lz::empty(*this), "sequence cannot be empty in order to get max element");
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return *std::max_element(Base::begin(), Base::end(), std::move(cmp));
+            return *internal::maxElement(Base::begin(), Base::end(), std::move(cmp));
         }
         else {
             return *std::max_element(execution, Base::begin(), Base::end(), std::move(cmp));
@@ -501,7 +884,7 @@ public:
         LZ_ASSERT(!lz::empty(*this), "sequence cannot be empty in order to get min element");
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return *std::min_element(Base::begin(), Base::end(), std::move(cmp));
+            return *internal::minElement(Base::begin(), Base::end(), std::move(cmp));
         }
         else {
             return *std::min_element(execution, Base::begin(), Base::end(), std::move(cmp));
@@ -530,7 +913,7 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool all(UnaryPredicate predicate, Execution execution = std::execution::seq) const {
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::all_of(Base::begin(), Base::end(), std::move(predicate));
+            return internal::sinkAllAre(Base::begin(), Base::end(), std::move(predicate), true);
         }
         else {
             return std::all_of(execution, Base::begin(), Base::end(), std::move(predicate));
@@ -547,7 +930,7 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool any(UnaryPredicate predicate, Execution execution = std::execution::seq) const {
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::any_of(Base::begin(), Base::end(), std::move(predicate));
+            return !internal::sinkAllAre(Base::begin(), Base::end(), std::move(predicate), false);
         }
         else {
             return std::any_of(execution, Base::begin(), Base::end(), std::move(predicate));
@@ -564,7 +947,7 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool none(UnaryPredicate predicate, Execution execution = std::execution::seq) {
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::none_of(Base::begin(), Base::end(), std::move(predicate));
+            return internal::sinkAllAre(Base::begin(), Base::end(), std::move(predicate), false);
         }
         else {
             return std::none_of(execution, Base::begin(), Base::end(), std::move(predicate));
@@ -580,7 +963,7 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type count(const T& value, Execution execution = std::execution::seq) const {
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::count(Base::begin(), Base::end(), value);
+            return internal::countOf(Base::begin(), Base::end(), value);
         }
         else {
             return std::count(execution, Base::begin(), Base::end(), value);
@@ -597,7 +980,7 @@ public:
                                                              Execution execution = std::execution::seq) const {
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::count_if(Base::begin(), Base::end(), std::move(predicate));
+            return internal::sinkCountIf(Base::begin(), Base::end(), std::move(predicate));
         }
         else {
             return std::count_if(execution, Base::begin(), Base::end(), std::move(predicate));
@@ -605,15 +988,19 @@ public:
     }
 
     /**
-     * Sorts the sequence with the default (operator<) comparer.
+     * Sorts the sequence with the default (operator<) comparer. Integers, floats and doubles that are sorted with `std::less`
+     * are radix sorted, on `lz::execution::pool()` if `execution` is not sequenced.
      * @param execution The execution policy.
      * @return A reference to this.
      */
     template<class BinaryPredicate = std::less<>, class Execution = std::execution::sequenced_policy>
     LZ_CONSTEXPR_CXX_20 IterView<Iterator>& sort(BinaryPredicate predicate = {}, Execution execution = std::execution::seq) {
-        if constexpr (internal::checkForwardAndPolicies<Execution, IterView>()) {
+        if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            std::sort(Base::begin(), Base::end(), std::move(predicate));
+            internal::sequentialSort(Base::begin(), Base::end(), predicate);
+        }
+        else if constexpr (internal::IsRadixSort<Iterator, BinaryPredicate>::value) {
+            internal::parallelSort(Base::begin(), Base::end(), predicate, lz::execution::pool().pool());
         }
         else {
             std::sort(execution, Base::begin(), Base::end(), std::move(predicate));
@@ -639,10 +1026,10 @@ public:
     }
 #    else // ^^^ lz has execution vvv ! lz has execution
 
-    //! See Filter.hpp for documentation
+    //! See Filter.hpp for documentation. A filter directly after another filter is fused with it into one layer.
     template<class UnaryPredicate>
-    IterView<internal::FilterIterator<Iterator, UnaryPredicate>> filter(UnaryPredicate predicate) const {
-        return toIter(lz::filter(*this, std::move(predicate)));
+    LZ_CONSTEXPR_CXX_20 IterView<internal::FusedFilterIterType<Iterator, UnaryPredicate>> filter(UnaryPredicate predicate) const {
+        return internal::FilterFusion<Iterator, UnaryPredicate>::fuse(*this, std::move(predicate));
     }
 
     //! See Except.hpp for documentation
@@ -652,6 +1039,30 @@ public:
         return toIter(lz::except(*this, toExcept, std::move(compare)));
     }
 
+    //! See Except.hpp for documentation
+    template<class IterableToExcept, class Hash = std::hash<internal::ValueTypeIterable<IterableToExcept>>,
+             class KeyEqual = std::equal_to<internal::ValueTypeIterable<IterableToExcept>>>
+    IterView<internal::FilterIterator<
+        Iterator, internal::HashedExclusionPredicate<internal::IterTypeFromIterable<IterableToExcept>, Hash, KeyEqual>>>
+    exceptHashed(IterableToExcept&& toExcept, Hash hash = {}, KeyEqual keyEqual = {}) const {
+        return toIter(lz::exceptHashed(*this, toExcept, std::move(hash), std::move(keyEqual)));
+    }
+
+    //! See Except.hpp for documentation
+    template<class Set>
+    IterView<internal::FilterIterator<Iterator, internal::NotContainedIn<const Set*>>> exceptIn(const Set& toExcept) const {
+        return toIter(lz::exceptIn(*this, toExcept));
+    }
+
+    //! See Except.hpp for documentation
+    template<class IterableToExcept, class Compare = std::less<value_type>>
+    IterView<internal::FilterIterator<
+        Iterator, internal::PrefilteredExclusionPredicate<internal::IterTypeFromIterable<IterableToExcept>, Compare>>>
+    exceptPrefiltered(IterableToExcept&& toExcept, const double falsePositiveRate = internal::defaultFalsePositiveRate,
+                      Compare compare = {}) const {
+        return toIter(lz::exceptPrefiltered(*this, toExcept, falsePositiveRate, std::move(compare)));
+    }
+
     //! See Unique.hpp for documentation
     template<class Compare = std::less<value_type>>
     IterView<internal::UniqueIterator<Iterator, Compare>> unique(Compare compare = {}) const {
@@ -671,6 +1082,12 @@ public:
         return toIter(lz::filterMap(*this, std::move(filterFunc), std::move(mapFunc)));
     }
 
+    //! See FilterMap.hpp for documentation
+    template<class Function>
+    IterView<internal::FilterMapIterator<Iterator, Function>> filterMap(Function function) const {
+        return toIter(lz::filterMap(*this, std::move(function)));
+    }
+
     //! See FunctionTools.hpp `select` for documentation
     template<class SelectorIterable>
     auto select(SelectorIterable&& selectors) const
@@ -686,6 +1103,16 @@ public:
         return toIter(lz::joinWhere(*this, iterableB, std::move(a), std::move(b), std::move(resultSelector)));
     }
 
+    //! See JoinWhere.hpp for documentation
+    template<class IterableB, class SelectorA, class SelectorB, class ResultSelector>
+    auto joinWherePrefiltered(IterableB&& iterableB, SelectorA a, SelectorB b, ResultSelector resultSelector,
+                              const double falsePositiveRate = internal::defaultFalsePositiveRate) const
+        -> decltype(toIter(lz::joinWherePrefiltered(*this, iterableB, std::move(a), std::move(b), std::move(resultSelector),
+                                                    falsePositiveRate))) {
+        return toIter(lz::joinWherePrefiltered(*this, iterableB, std::move(a), std::move(b), std::move(resultSelector),
+                                               falsePositiveRate));
+    }
+
     //! See Take.hpp for documentation
     template<class UnaryPredicate>
     IterView<Iterator> dropWhile(UnaryPredicate predicate) const {
@@ -760,7 +1187,7 @@ public:
      * @return
      */
 #        ifdef LZ_HAS_CXX_11
-    template<class Iterable, class Compare = std::equal_to<value_Type>>
+    template<class Iterable, class BinaryPredicate = std::equal_to<value_type>>
 #        else
     template<class Iterable, class BinaryPredicate = std::equal_to<>>
 #        endif
@@ -776,7 +1203,7 @@ public:
      * @return True if this starts with `iterable`, false otherwise.
      */
 #        ifdef LZ_HAS_CXX_11
-    template<class Iterable, class Compare = std::equal_to<value_Type>>
+    template<class Iterable, class BinaryPredicate = std::equal_to<value_type>>
 #        else
     template<class Iterable, class BinaryPredicate = std::equal_to<>>
 #        endif
@@ -792,7 +1219,7 @@ public:
      * @return True if this ends with `iterable`, false otherwise.
      */
 #        ifdef LZ_HAS_CXX_11
-    template<class Iterable, class Compare = std::equal_to<value_Type>>
+    template<class Iterable, class BinaryPredicate = std::equal_to<value_type>>
 #        else
     template<class Iterable, class BinaryPredicate = std::equal_to<>>
 #        endif
@@ -806,7 +1233,7 @@ public:
      */
     template<class UnaryFunc>
     IterView<Iterator>& forEach(UnaryFunc func) {
-        std::for_each(Base::begin(), Base::end(), std::move(func));
+        internal::sinkForEach(Base::begin(), Base::end(), func);
         return *this;
     }
 
@@ -839,7 +1266,7 @@ public:
      */
     value_type sum() const {
 #        ifdef LZ_HAS_CXX_11
-        return this->foldl(value_type(), [](value_type init, const value_type& val) { return std::move(init) + val; });
+        return this->foldl(value_type(), internal::MovingPlus());
 #        else
         return this->foldl(value_type(), std::plus<>());
 #        endif // LZ_HAS_CXX_11
@@ -857,7 +1284,7 @@ public:
 #        endif // LZ_HAS_CXX_11
     reference max(Compare cmp = {}) const {
         LZ_ASSERT(!lz::empty(*this), "sequence cannot be empty in order to get max element");
-        return *std::max_element(Base::begin(), Base::end(), std::move(cmp));
+        return *internal::maxElement(Base::begin(), Base::end(), std::move(cmp));
     }
 
     /**
@@ -872,7 +1299,7 @@ public:
 #        endif // LZ_HAS_CXX_11
     reference min(Compare cmp = {}) const {
         LZ_ASSERT(!lz::empty(*this), "sequence cannot be empty in order to get min element");
-        return *std::min_element(Base::begin(), Base::end(), std::move(cmp));
+        return *internal::minElement(Base::begin(), Base::end(), std::move(cmp));
     }
 
     //! See FunctionTools.hpp for documentation
@@ -902,7 +1329,7 @@ public:
      */
     template<class UnaryPredicate>
     bool all(UnaryPredicate predicate) const {
-        return std::all_of(Base::begin(), Base::end(), std::move(predicate));
+        return internal::sinkAllAre(Base::begin(), Base::end(), std::move(predicate), true);
     }
 
     /**
@@ -912,7 +1339,7 @@ public:
      */
     template<class UnaryPredicate>
     bool any(UnaryPredicate predicate) const {
-        return std::any_of(Base::begin(), Base::end(), std::move(predicate));
+        return !internal::sinkAllAre(Base::begin(), Base::end(), std::move(predicate), false);
     }
 
     /**
@@ -922,7 +1349,7 @@ public:
      */
     template<class UnaryPredicate>
     bool none(UnaryPredicate predicate) const {
-        return std::none_of(Base::begin(), Base::end(), std::move(predicate));
+        return internal::sinkAllAre(Base::begin(), Base::end(), std::move(predicate), false);
     }
 
     /**
@@ -932,7 +1359,7 @@ public:
      */
     template<class T>
     difference_type count(const T& value) const {
-        return std::count(Base::begin(), Base::end(), value);
+        return internal::countOf(Base::begin(), Base::end(), value);
     }
 
     /**
@@ -942,7 +1369,7 @@ public:
      */
     template<class UnaryPredicate>
     difference_type countIf(UnaryPredicate predicate) const {
-        return std::count_if(Base::begin(), Base::end(), std::move(predicate));
+        return internal::sinkCountIf(Base::begin(), Base::end(), std::move(predicate));
     }
 
     /**
@@ -954,8 +1381,8 @@ public:
 #        else
     template<class Comparer = std::less<>>
 #        endif // LZ_HAS_CXX_11
-    IterView<Iterator>& sort(Comparer comparer = {}) {
-        std::sort(Base::begin(), Base::end(), std::move(comparer));
+    LZ_CONSTEXPR_CXX_20 IterView<Iterator>& sort(Comparer comparer = {}) {
+        internal::sequentialSort(Base::begin(), Base::end(), comparer);
         return *this;
     }
 
@@ -973,6 +1400,208 @@ public:
     }
 
 #    endif // LZ_HAS_EXECUTION
+
+    /**
+     * Iterates over the sequence generated so far on the threads of `policy`. Only random access sequences are split up
+     * between the threads, other sequences are iterated over on the calling thread.
+     * @param func A function to apply over each element, which is called from multiple threads at the same time. Must have the
+     * following signature: `void func(value_type)`
+     * @param policy The pool to run on, for instance `lz::execution::pool()`.
+     */
+    template<class UnaryFunc>
+    IterView<Iterator>& forEach(UnaryFunc func, const execution::PoolPolicy& policy) {
+        internal::poolForEach(internal::IsRandomAccess<Iterator>(), Base::begin(), Base::end(), func, policy.pool());
+        return *this;
+    }
+
+    /**
+     * Reduces the sequence to one value on the threads of `policy`, starting with `init`. See `lz::reduce`.
+     * @param init The initial value, which is only used once.
+     * @param binaryOp The reduction, which must be associative. It is called from multiple threads at the same time.
+     * @param policy The pool to run on, for instance `lz::execution::pool()`.
+     * @return The reduced value.
+     */
+    template<class T, class BinaryOp>
+    LZ_NODISCARD T reduce(T init, BinaryOp binaryOp, const execution::PoolPolicy& policy) const {
+        return lz::reduce(*this, std::move(init), std::move(binaryOp), policy);
+    }
+
+    /**
+     * Applies `unaryOp` to every element and reduces the results to one value on the threads of `policy`, starting with `init`.
+     * See `lz::transformReduce`.
+     * @param init The initial value, which is only used once.
+     * @param binaryOp The reduction, which must be associative. It is called from multiple threads at the same time.
+     * @param unaryOp The transform that is applied to every element, from multiple threads at the same time.
+     * @param policy The pool to run on, for instance `lz::execution::pool()`.
+     * @return The reduced value.
+     */
+    template<class T, class BinaryOp, class UnaryOp>
+    LZ_NODISCARD T transformReduce(T init, BinaryOp binaryOp, UnaryOp unaryOp, const execution::PoolPolicy& policy) const {
+        return lz::transformReduce(*this, std::move(init), std::move(binaryOp), std::move(unaryOp), policy);
+    }
+
+    /**
+     * Sums the sequence on the threads of `policy`. Floating point sums can differ from a sequential sum, as they are added in
+     * a different order. With a `reproducible()` policy, the order and therefore the sum does not depend on the amount of
+     * threads.
+     * @param policy The pool to run on, for instance `lz::execution::pool()`.
+     * @return The sum of the sequence.
+     */
+    LZ_NODISCARD value_type sum(const execution::PoolPolicy& policy) const {
+        return this->reduce(value_type(), internal::MovingPlus(), policy);
+    }
+
+    //! See FunctionTools.hpp `mean(const Iterable&, const execution::PoolPolicy&)` for documentation.
+    LZ_NODISCARD double mean(const execution::PoolPolicy& policy) const {
+        return lz::mean(*this, policy);
+    }
+
+    /**
+     * Sorts the sequence on the threads of `policy`. See `lz::sort`.
+     * @param compare The comparer.
+     * @param policy The pool to run on, for instance `lz::execution::pool()`.
+     * @return A reference to this.
+     */
+    template<class Compare>
+    IterView<Iterator>& sort(Compare compare, const execution::PoolPolicy& policy) {
+        lz::sort(Base::begin(), Base::end(), std::move(compare), policy);
+        return *this;
+    }
+
+    //! See FunctionTools.hpp `sortedDistinct` for documentation.
+    template<class Compare = std::less<value_type>>
+    LZ_NODISCARD std::vector<value_type> sortedDistinct(Compare compare = {}) const {
+        return lz::sortedDistinct(*this, std::move(compare));
+    }
+
+    //! See FunctionTools.hpp `sortedDistinct` for documentation.
+    template<class Compare>
+    LZ_NODISCARD std::vector<value_type> sortedDistinct(Compare compare, const execution::PoolPolicy& policy) const {
+        return lz::sortedDistinct(*this, std::move(compare), policy);
+    }
+
+    //! See FunctionTools.hpp `sortedGroups` for documentation.
+    template<class Compare = std::less<value_type>>
+    LZ_NODISCARD std::vector<std::pair<value_type, std::size_t>> sortedGroups(Compare compare = {}) const {
+        return lz::sortedGroups(*this, std::move(compare));
+    }
+
+    //! See FunctionTools.hpp `sortedGroups` for documentation.
+    template<class Compare>
+    LZ_NODISCARD std::vector<std::pair<value_type, std::size_t>>
+    sortedGroups(Compare compare, const execution::PoolPolicy& policy) const {
+        return lz::sortedGroups(*this, std::move(compare), policy);
+    }
+
+    //! See Partitions.hpp for documentation.
+    template<class KeySelector>
+    LZ_NODISCARD Partitions<value_type> partitionBy(const KeySelector& keySelector, const std::size_t partitionCount) const {
+        return lz::partitionBy(*this, keySelector, partitionCount);
+    }
+
+    //! See Partitions.hpp for documentation.
+    template<class KeySelector>
+    LZ_NODISCARD Partitions<value_type>
+    partitionBy(const KeySelector& keySelector, const std::size_t partitionCount, const execution::PoolPolicy& policy) const {
+        return lz::partitionBy(*this, keySelector, partitionCount, policy);
+    }
+
+    //! See FunctionTools.hpp `topK` for documentation.
+    template<class Compare = std::less<value_type>>
+    LZ_NODISCARD std::vector<value_type> topK(const std::size_t k, Compare compare = {}) const {
+        return lz::topK(*this, k, std::move(compare));
+    }
+
+    //! See FunctionTools.hpp `nthSmallest` for documentation.
+    template<class Compare = std::less<value_type>>
+    LZ_NODISCARD value_type nthSmallest(const std::size_t n, Compare compare = {}) const {
+        return lz::nthSmallest(*this, n, std::move(compare));
+    }
+
+    //! See FunctionTools.hpp `topN` for documentation.
+    template<class KeySelector, class Compare = std::less<internal::Decay<internal::FunctionReturnType<KeySelector, reference>>>>
+    LZ_NODISCARD std::vector<value_type>
+    topN(const std::size_t n, const KeySelector& keySelector, const Compare& compare = {}) const {
+        return lz::topN(*this, n, keySelector, compare);
+    }
+
+    //! See FunctionTools.hpp `minBy` for documentation.
+    template<class KeySelector, class Compare = std::less<internal::Decay<internal::FunctionReturnType<KeySelector, reference>>>>
+    LZ_NODISCARD value_type minBy(const KeySelector& keySelector, const Compare& compare = {}) const {
+        return lz::minBy(*this, keySelector, compare);
+    }
+
+    //! See FunctionTools.hpp `maxBy` for documentation.
+    template<class KeySelector, class Compare = std::less<internal::Decay<internal::FunctionReturnType<KeySelector, reference>>>>
+    LZ_NODISCARD value_type maxBy(const KeySelector& keySelector, const Compare& compare = {}) const {
+        return lz::maxBy(*this, keySelector, compare);
+    }
+
+    //! See QuantileSketch.hpp for documentation.
+    LZ_NODISCARD QuantileSketch<value_type> quantileSketch(const std::size_t k = 200) const {
+        return lz::quantileSketch(*this, k);
+    }
+
+    //! See Statistics.hpp for documentation.
+    LZ_NODISCARD Statistics<value_type> stats() const {
+        return lz::stats(*this);
+    }
+
+    //! See Statistics.hpp for documentation.
+    LZ_NODISCARD Statistics<value_type> stats(const execution::PoolPolicy& policy) const {
+        return lz::stats(*this, policy);
+    }
+
+    //! See Cached.hpp for documentation.
+    LZ_NODISCARD IterView<internal::CachedIterator<Iterator>>
+    cache(const std::size_t chunkSize = internal::defaultCacheChunkSize) const {
+        return toIter(lz::cached(*this, chunkSize));
+    }
+
+    //! See Columns.hpp for documentation.
+    template<class Projection, class... Projections>
+    LZ_NODISCARD internal::ProjectedColumns<Iterator, Projection, Projections...>
+    toColumns(Projection projection, Projections... projections) const {
+        return lz::toColumns(*this, std::move(projection), std::move(projections)...);
+    }
+
+    //! See Columns.hpp for documentation.
+    template<class I = Iterator>
+    LZ_NODISCARD internal::TupleColumns<I> toColumns() const {
+        return lz::toColumns(*this);
+    }
+
+    //! See FlatHashMap.hpp for documentation.
+    template<class KeySelectorFunc>
+    LZ_NODISCARD FlatHashMap<internal::Decay<internal::FunctionReturnType<KeySelectorFunc, internal::RefType<Iterator>>>,
+                             value_type>
+    toFlatHashMap(KeySelectorFunc keyGen) const {
+        return lz::toFlatHashMap(*this, std::move(keyGen));
+    }
+
+    //! See FlatMap.hpp for documentation.
+    template<class KeySelectorFunc>
+    LZ_NODISCARD FlatMap<internal::Decay<internal::FunctionReturnType<KeySelectorFunc, internal::RefType<Iterator>>>, value_type>
+    toFlatMap(KeySelectorFunc keyGen) const {
+        return lz::toFlatMap(*this, std::move(keyGen));
+    }
+
+    //! See Chunks.hpp for documentation.
+    template<std::size_t N, class Function>
+    void chunksInto(const std::size_t chunkSize, Function function) const {
+        lz::chunksInto<N>(*this, chunkSize, std::move(function));
+    }
+
+    //! See ChunkIf.hpp for documentation.
+    template<std::size_t N, class UnaryPredicate, class Function>
+    void chunkIfInto(UnaryPredicate predicate, Function function) const {
+        lz::chunkIfInto<N>(*this, std::move(predicate), std::move(function));
+    }
+
+    //! See MoveFrom.hpp for documentation.
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<std::move_iterator<Iterator>> asRvalue() const {
+        return toIter(lz::asRvalue(*this));
+    }
 };
 } // namespace lz
 
@@ -21,6 +21,20 @@ public:
     constexpr Map() = default;
 };
 
+template<LZ_CONCEPT_ITERATOR Iterator, class Function>
+class MapCached final : public internal::BasicIteratorView<internal::MapCachedIterator<Iterator, Function>> {
+public:
+    using iterator = internal::MapCachedIterator<Iterator, Function>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    LZ_CONSTEXPR_CXX_20 MapCached(Iterator begin, Iterator end, Function function) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(begin), end, function), iterator(end, end, function)) {
+    }
+
+    constexpr MapCached() = default;
+};
+
 // Start of group
 /**
  * @addtogroup ItFns
@@ -59,6 +73,43 @@ map(Iterable&& iterable, Function function) {
                     std::move(function));
 }
 
+/**
+ * @brief Returns a forward map object, that calls `function` once when an iterator arrives at an element, instead of on every
+ * dereference. Use this instead of `mapRange` if `function` is expensive and the result is passed to algorithms that dereference
+ * the same position repeatedly, such as `lz::unique`, `lz::groupBy` or `std::max_element`.
+ * @details The result of the current element is stored in the iterator, so dereferencing returns a reference into the iterator
+ * that is invalidated when the iterator is incremented or destroyed. Copying an iterator copies its result, but a copy that
+ * is incremented on its own calls `function` for the elements it arrives at.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param function A function that takes a value type as parameter. It may return anything.
+ * @return A MapCached object from [begin, end) that can be converted to an arbitrary container or can be iterated over
+ * using `for (auto... lz::mapCached(...))`.
+ */
+template<class Function, LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 MapCached<Iterator, Function> mapCachedRange(Iterator begin, Iterator end, Function function) {
+    return { std::move(begin), std::move(end), std::move(function) };
+}
+
+/**
+ * @brief Returns a forward map object, that calls `function` once per iterator arriving at an element. See
+ * `lz::mapCachedRange`.
+ * @details Copies that are incremented separately do not share results: an algorithm that looks ahead with a copy, such as the
+ * `std::adjacent_find` inside `lz::unique`, calls `function` again when the original iterator arrives at the same element. E.g.
+ * `lz::unique(lz::mapCached(encoded, decode))` decodes most elements once and the first element of every later run twice,
+ * instead of every element two or three times.
+ * @param iterable The iterable to do the mapping over.
+ * @param function A function that takes a value type as parameter. It may return anything.
+ * @return A MapCached object that can be converted to an arbitrary container or can be iterated over using
+ * `for (auto... lz::mapCached(...))`.
+ */
+template<class Function, LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 MapCached<internal::IterTypeFromIterable<Iterable>, Function>
+mapCached(Iterable&& iterable, Function function) {
+    return mapCachedRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                          std::move(function));
+}
+
 // End of group
 /**
  * @}
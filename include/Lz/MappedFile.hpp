@@ -0,0 +1,240 @@
+#pragma once
+
+#ifndef LZ_MAPPED_FILE_HPP
+#    define LZ_MAPPED_FILE_HPP
+
+#    include "detail/LzTools.hpp"
+
+#    include <cerrno>
+#    include <cstdint>
+#    include <string>
+#    include <system_error>
+
+#    ifdef _WIN32
+#        ifndef NOMINMAX
+#            define NOMINMAX
+#        endif // NOMINMAX
+#        ifndef WIN32_LEAN_AND_MEAN
+#            define WIN32_LEAN_AND_MEAN
+#        endif // WIN32_LEAN_AND_MEAN
+#        include <windows.h>
+#    else
+#        include <fcntl.h>
+#        include <sys/mman.h>
+#        include <sys/stat.h>
+#        include <unistd.h>
+#    endif // _WIN32
+
+namespace lz {
+/**
+ * How a mapped file is going to be read, so that the operating system can read ahead (or not) accordingly.
+ */
+enum class AccessPattern {
+    //! No hint is given.
+    normal,
+    //! The file is read from front to back, so pages can be read ahead aggressively and dropped after being read.
+    sequential,
+    //! The file is read at random positions, so reading ahead is of no use.
+    random
+};
+
+/**
+ * A read only memory mapped file. Its characters are contiguous and can be accessed using `data()` and `size()`, so it can be
+ * used with e.g. `lz::split`, `lz::lines` or `lz::csvRecords`, without copying the file to the heap. The file stays mapped
+ * until the object is destroyed, so views over it must not outlive it.
+ */
+class MappedFile {
+    const char* _data{ "" };
+    std::size_t _size{};
+
+    static std::size_t checkedSize(const std::uint64_t fileSize, const std::string& path) {
+        if (fileSize > (std::numeric_limits<std::size_t>::max)()) {
+            throw std::system_error(EFBIG, std::generic_category(), "lz::mappedFile: file too large to map: " + path);
+        }
+        return static_cast<std::size_t>(fileSize);
+    }
+
+#    ifdef _WIN32
+    static void throwLastError(const std::string& what, const std::string& path) {
+        throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "lz::mappedFile: " + what + path);
+    }
+
+    void map(const std::string& path, const AccessPattern pattern) {
+        DWORD flags = FILE_ATTRIBUTE_NORMAL;
+        if (pattern == AccessPattern::sequential) {
+            flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+        }
+        else if (pattern == AccessPattern::random) {
+            flags |= FILE_FLAG_RANDOM_ACCESS;
+        }
+        const HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throwLastError("cannot open ", path);
+        }
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize)) {
+            CloseHandle(file);
+            throwLastError("cannot get the size of ", path);
+        }
+        _size = checkedSize(static_cast<std::uint64_t>(fileSize.QuadPart), path);
+        if (_size == 0) {
+            CloseHandle(file);
+            return;
+        }
+        // The view keeps the mapping and file alive, so both handles can be closed right away
+        const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr) {
+            throwLastError("cannot map ", path);
+        }
+        const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (view == nullptr) {
+            throwLastError("cannot map ", path);
+        }
+        _data = static_cast<const char*>(view);
+    }
+
+    void unmap() noexcept {
+        if (_size != 0) {
+            UnmapViewOfFile(_data);
+        }
+    }
+#    else
+    static void throwErrno(const std::string& what, const std::string& path) {
+        throw std::system_error(errno, std::generic_category(), "lz::mappedFile: " + what + path);
+    }
+
+    void map(const std::string& path, const AccessPattern pattern) {
+        const int file = ::open(path.c_str(), O_RDONLY);
+        if (file == -1) {
+            throwErrno("cannot open ", path);
+        }
+        struct stat status {};
+        if (::fstat(file, &status) == -1) {
+            const int error = errno;
+            ::close(file);
+            errno = error;
+            throwErrno("cannot get the size of ", path);
+        }
+        _size = checkedSize(static_cast<std::uint64_t>(status.st_size), path);
+        if (_size == 0) {
+            ::close(file);
+            return;
+        }
+        // The mapping keeps the file alive, so it can be closed right away
+        void* view = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file, 0);
+        const int error = errno;
+        ::close(file);
+        if (view == MAP_FAILED) {
+            _size = 0;
+            errno = error;
+            throwErrno("cannot map ", path);
+        }
+#        if defined(MADV_SEQUENTIAL) && defined(MADV_RANDOM)
+        if (pattern != AccessPattern::normal) {
+            ::madvise(view, _size, pattern == AccessPattern::sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+        }
+#        else
+        static_cast<void>(pattern);
+#        endif
+        _data = static_cast<const char*>(view);
+    }
+
+    void unmap() noexcept {
+        if (_size != 0) {
+            ::munmap(const_cast<char*>(_data), _size);
+        }
+    }
+#    endif // _WIN32
+
+public:
+    using value_type = char;
+    using const_iterator = const char*;
+    using iterator = const_iterator;
+
+    /**
+     * Maps the file at `path` into memory.
+     * @param path The path of the file to map.
+     * @param pattern How the file is going to be read.
+     * @throws `std::system_error` if the file cannot be opened or mapped, or if it is too large to fit in the address space.
+     */
+    explicit MappedFile(const std::string& path, const AccessPattern pattern = AccessPattern::sequential) {
+        map(path, pattern);
+    }
+
+    MappedFile() = default;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept : _data(other._data), _size(other._size) {
+        other._data = "";
+        other._size = 0;
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            _data = other._data;
+            _size = other._size;
+            other._data = "";
+            other._size = 0;
+        }
+        return *this;
+    }
+
+    ~MappedFile() {
+        unmap();
+    }
+
+    LZ_NODISCARD const char* data() const noexcept {
+        return _data;
+    }
+
+    LZ_NODISCARD std::size_t size() const noexcept {
+        return _size;
+    }
+
+    LZ_NODISCARD bool empty() const noexcept {
+        return _size == 0;
+    }
+
+    LZ_NODISCARD const_iterator begin() const noexcept {
+        return _data;
+    }
+
+    LZ_NODISCARD const_iterator end() const noexcept {
+        return _data + _size;
+    }
+};
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Maps the file at `path` into memory. Files larger than 4GB are supported on 64 bit platforms. Example:
+ * ```cpp
+ * const auto file = lz::mappedFile("log.txt");
+ * for (lz::StringView line : lz::lines<lz::StringView>(file)) {}
+ * ```
+ * @param path The path of the file to map.
+ * @param pattern How the file is going to be read. Defaults to `AccessPattern::sequential`, which lets the operating system
+ * read ahead.
+ * @return A MappedFile object, which can be split or iterated over.
+ * @throws `std::system_error` if the file cannot be opened or mapped, or if it is too large to fit in the address space.
+ */
+LZ_NODISCARD inline MappedFile mappedFile(const std::string& path, const AccessPattern pattern = AccessPattern::sequential) {
+    return MappedFile(path, pattern);
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_MAPPED_FILE_HPP
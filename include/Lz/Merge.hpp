@@ -0,0 +1,134 @@
+#pragma once
+
+#ifndef LZ_MERGE_HPP
+#    define LZ_MERGE_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/MergeIterator.hpp"
+
+#    include <functional>
+
+namespace lz {
+template<class Compare, class... Iterators>
+class Merge final : public internal::BasicIteratorView<typename internal::MergeIterType<Compare, Iterators...>::type> {
+public:
+    using iterator = typename internal::MergeIterType<Compare, Iterators...>::type;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    Merge(std::tuple<Iterators...> begin, std::tuple<Iterators...> end, Compare compare) :
+        internal::BasicIteratorView<iterator>(internal::makeMergeIterator(std::move(begin), end, compare),
+                                              internal::makeMergeIterator(end, end, compare)) {
+    }
+
+    Merge() = default;
+};
+
+template<class Iterator, class Compare>
+class MergeRuns final
+    : public internal::BasicIteratorView<internal::MergeIterator<internal::MergeRunsSource<Iterator>, Compare>> {
+public:
+    using iterator = internal::MergeIterator<internal::MergeRunsSource<Iterator>, Compare>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    MergeRuns(std::vector<std::pair<Iterator, Iterator>> runs, Compare compare) :
+        internal::BasicIteratorView<iterator>(
+            iterator(internal::MergeRunsSource<Iterator>(std::move(runs)), compare),
+            iterator(internal::MergeRunsSource<Iterator>(), compare)) {
+    }
+
+    MergeRuns() = default;
+};
+
+namespace internal {
+template<class... Iterables>
+using MergeValueType = Decay<ValueType<TupleElement<0, std::tuple<IterTypeFromIterable<Iterables>...>>>>;
+} // namespace internal
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Merges the sorted sequences [std::get<I>(begin), std::get<I>(end)) lazily into one sorted sequence, as `std::merge` would
+ * for two sequences, without copying or sorting anything. For more than two sequences, the heads are kept in a loser tree, so
+ * every element costs about log2(k) comparisons for k sequences. Two sequences take a path without a tree. Equal elements are
+ * yielded in the order of the sequences, and the heads of the sequences are dereferenced for every comparison. Example:
+ * ```cpp
+ * std::vector<int> a = { 1, 4, 7 }, b = { 2, 5, 8 }, c = { 3, 6, 9 };
+ * auto merged = lz::mergeRange(std::make_tuple(a.begin(), b.begin(), c.begin()), std::make_tuple(a.end(), b.end(), c.end()),
+ *                              std::less<int>()); // 1, 2, 3, 4, 5, 6, 7, 8, 9
+ * ```
+ * @param begin A tuple of the beginnings of the sequences. There must be at least 2.
+ * @param end A tuple of the endings of the sequences.
+ * @param compare The ordering of the sequences, which returns whether its first argument goes before its second.
+ * @return A forward (or input, if one of the sequences is input) view of the merged sequences.
+ */
+template<class Compare, LZ_CONCEPT_ITERATOR... Iterators>
+LZ_NODISCARD Merge<Compare, Iterators...>
+mergeRange(std::tuple<Iterators...> begin, std::tuple<Iterators...> end, Compare compare) {
+    static_assert(sizeof...(Iterators) >= 2, "amount of iterators/containers cannot be less than or equal to 1");
+    static_assert(internal::IsAllSame<internal::ValueType<Iterators>...>::value, "value types of iterators do no match");
+    return { std::move(begin), std::move(end), std::move(compare) };
+}
+
+/**
+ * Merges the sorted sequences `iterables` lazily into one sorted sequence, using `compare` as ordering. See `lz::mergeRange`.
+ * @param compare The ordering of the sequences, which returns whether its first argument goes before its second.
+ * @param iterables The sorted sequences. There must be at least 2.
+ * @return A forward (or input, if one of the sequences is input) view of the merged sequences.
+ */
+template<class Compare, LZ_CONCEPT_ITERABLE... Iterables>
+LZ_NODISCARD Merge<Compare, internal::IterTypeFromIterable<Iterables>...> mergeWith(Compare compare, Iterables&&... iterables) {
+    return mergeRange(std::make_tuple(internal::begin(std::forward<Iterables>(iterables))...),
+                      std::make_tuple(internal::end(std::forward<Iterables>(iterables))...), std::move(compare));
+}
+
+/**
+ * Merges the sequences `iterables`, which are sorted ascending, lazily into one sorted sequence. See `lz::mergeRange`.
+ * @param iterables The sorted sequences. There must be at least 2.
+ * @return A forward (or input, if one of the sequences is input) view of the merged sequences.
+ */
+template<LZ_CONCEPT_ITERABLE... Iterables>
+LZ_NODISCARD Merge<std::less<internal::MergeValueType<Iterables...>>, internal::IterTypeFromIterable<Iterables>...>
+merge(Iterables&&... iterables) {
+    return mergeWith(std::less<internal::MergeValueType<Iterables...>>(), std::forward<Iterables>(iterables)...);
+}
+
+/**
+ * Merges a runtime amount of sorted sequences of the same type lazily into one sorted sequence, e.g. the sorted runs of an
+ * external sort or the results of a number of shards. The heads of the sequences are kept in a loser tree, so every element
+ * costs about log2(k) comparisons for k sequences. Equal elements are yielded in the order of the sequences. Only the iterators
+ * of the sequences are stored, so `runs` must outlive the view. Example:
+ * ```cpp
+ * std::vector<std::vector<Row>> shards = fetchShards();
+ * for (const Row& row : lz::mergeRuns(shards, [](const Row& a, const Row& b) { return a.key < b.key; })) {
+ * }
+ * ```
+ * @param runs An iterable of the sorted sequences. May be empty.
+ * @param compare The ordering of the sequences, which returns whether its first argument goes before its second. Is
+ * `std::less` by default.
+ * @return A forward (or input, if the sequences are input) view of the merged sequences.
+ */
+template<LZ_CONCEPT_ITERABLE Runs,
+         class I = internal::IterTypeFromIterable<internal::RefType<internal::IterTypeFromIterable<Runs>>>,
+         class Compare = std::less<internal::Decay<internal::ValueType<I>>>>
+LZ_NODISCARD MergeRuns<I, Compare> mergeRuns(Runs&& runs, Compare compare = {}) {
+    std::vector<std::pair<I, I>> iterators;
+    for (auto&& run : runs) {
+        iterators.emplace_back(internal::begin(run), internal::end(run));
+    }
+    return { std::move(iterators), std::move(compare) };
+}
+
+// End of group
+/**
+ * @}
+ */
+
+} // namespace lz
+
+#endif // LZ_MERGE_HPP
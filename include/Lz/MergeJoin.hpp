@@ -0,0 +1,86 @@
+#pragma once
+
+#ifndef LZ_MERGE_JOIN_HPP
+#    define LZ_MERGE_JOIN_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/MergeJoinIterator.hpp"
+
+namespace lz {
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector>
+class MergeJoin final
+    : public internal::BasicIteratorView<internal::MergeJoinIterator<IterA, IterB, SelectorA, SelectorB, ResultSelector>> {
+public:
+    using iterator = internal::MergeJoinIterator<IterA, IterB, SelectorA, SelectorB, ResultSelector>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    LZ_CONSTEXPR_CXX_20
+    MergeJoin(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b, ResultSelector resultSelector) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(iterA), endA, std::move(iterB), endB, a, b, resultSelector),
+                                              iterator(endA, endA, endB, endB, a, b, resultSelector)) {
+    }
+
+    constexpr MergeJoin() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Performs an SQL-like inner join of two sequences that are both sorted by their keys, by advancing A and B in lockstep. This
+ * is O(|A| + |B|) (plus the amount of matches), compared to the O(|A| log |B|) of `lz::joinWhere`, and only needs forward
+ * iterators. Duplicate keys are allowed on both sides: every element of an equal run in A is joined with every element of
+ * the equal run in B. Keys are compared using `operator<`.
+ * @attention Both [iterA, endA) and [iterB, endB) must be sorted by their keys in order to work correctly.
+ * @param iterA The beginning of the sequence A to join.
+ * @param endA The ending of the sequence A to join.
+ * @param iterB The beginning of the sequence B to join.
+ * @param endB The ending of the sequence B to join.
+ * @param a A function that returns the key of an element of A.
+ * @param b A function that returns the key of an element of B.
+ * @param resultSelector A function that takes an element of A and an element of B and returns the joined result.
+ * @return A merge join iterator view object, which can be used to iterate over.
+ */
+template<LZ_CONCEPT_ITERATOR IterA, LZ_CONCEPT_ITERATOR IterB, class SelectorA, class SelectorB, class ResultSelector>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 MergeJoin<IterA, IterB, SelectorA, SelectorB, ResultSelector>
+mergeJoin(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b, ResultSelector resultSelector) {
+    // clang-format off
+    return {
+        std::move(iterA), std::move(endA), std::move(iterB), std::move(endB), std::move(a), std::move(b),
+        std::move(resultSelector)
+    };
+    // clang-format on
+}
+
+/**
+ * Performs an SQL-like inner join of two sequences that are both sorted by their keys, by advancing A and B in lockstep. This
+ * is O(|A| + |B|) (plus the amount of matches), compared to the O(|A| log |B|) of `lz::joinWhere`, and only needs forward
+ * iterators. Duplicate keys are allowed on both sides: every element of an equal run in A is joined with every element of
+ * the equal run in B. Keys are compared using `operator<`.
+ * @attention Both `iterableA` and `iterableB` must be sorted by their keys in order to work correctly.
+ * @param iterableA The sequence A to join.
+ * @param iterableB The sequence B to join.
+ * @param a A function that returns the key of an element of A.
+ * @param b A function that returns the key of an element of B.
+ * @param resultSelector A function that takes an element of A and an element of B and returns the joined result.
+ * @return A merge join iterator view object, which can be used to iterate over.
+ */
+template<LZ_CONCEPT_ITERABLE IterableA, LZ_CONCEPT_ITERABLE IterableB, class SelectorA, class SelectorB, class ResultSelector>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 MergeJoin<internal::IterTypeFromIterable<IterableA>, internal::IterTypeFromIterable<IterableB>,
+                                           SelectorA, SelectorB, ResultSelector>
+mergeJoin(IterableA&& iterableA, IterableB&& iterableB, SelectorA a, SelectorB b, ResultSelector resultSelector) {
+    return mergeJoin(internal::begin(std::forward<IterableA>(iterableA)), internal::end(std::forward<IterableA>(iterableA)),
+                     internal::begin(std::forward<IterableB>(iterableB)), internal::end(std::forward<IterableB>(iterableB)),
+                     std::move(a), std::move(b), std::move(resultSelector));
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_MERGE_JOIN_HPP
@@ -0,0 +1,81 @@
+#pragma once
+
+#ifndef LZ_MOVE_FROM_HPP
+#    define LZ_MOVE_FROM_HPP
+
+#    include "Own.hpp"
+
+namespace lz {
+template<class Iterator>
+class AsRvalue final : public internal::BasicIteratorView<std::move_iterator<Iterator>> {
+public:
+    using iterator = std::move_iterator<Iterator>;
+    using const_iterator = iterator;
+    using value_type = internal::ValueType<Iterator>;
+
+    constexpr AsRvalue() = default;
+
+    LZ_CONSTEXPR_CXX_20 AsRvalue(Iterator begin, Iterator end) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(begin)), iterator(std::move(end))) {
+    }
+};
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Iterates over [begin, end) with `std::move_iterator`s, so that the elements are yielded as rvalue references. See
+ * `lz::asRvalue(iterable)` for details.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @return A view of which the elements can be moved from.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 AsRvalue<Iterator> asRvalueRange(Iterator begin, Iterator end) {
+    return { std::move(begin), std::move(end) };
+}
+
+/**
+ * Iterates over `iterable` with `std::move_iterator`s, so that the elements are yielded as rvalue references. Adaptors such as
+ * `lz::filter`, `lz::map`, `lz::concat` and `lz::flatten` pass the rvalue references through, and `toVector()`, `to<>()` and
+ * the like then move the elements into the destination instead of copying them, which leaves the elements of `iterable` in a
+ * moved from state. Functions that are passed to the adaptors should take the elements by (const) reference, taking them by
+ * value moves them out of `iterable` before they reach the destination. Example:
+ * ```cpp
+ * std::vector<std::string> lines = readLines();
+ * // Moves the non empty lines into `nonEmpty`, instead of copying them
+ * const auto isNotEmpty = [](const std::string& s) { return !s.empty(); };
+ * std::vector<std::string> nonEmpty = lz::filter(lz::asRvalue(lines), isNotEmpty).toVector();
+ * ```
+ * @param iterable The sequence to move the elements from. It must outlive the view.
+ * @return A view of which the elements can be moved from.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class I = internal::IterTypeFromIterable<Iterable>>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 AsRvalue<I> asRvalue(Iterable&& iterable) {
+    return asRvalueRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)));
+}
+
+/**
+ * Takes ownership of `container` and iterates over it with `std::move_iterator`s, like `lz::asRvalue`. The view owns the
+ * container the same way `lz::own` does, so it can be consumed after the original container is gone, for e.g.
+ * `lz::map(lz::moveFrom(readLines()), parse)` can be returned from a function, without copying the elements.
+ * @param container The container to take ownership of, for e.g. `std::move(lines)`.
+ * @return A view of which the elements can be moved from, that owns `container`.
+ */
+template<LZ_CONCEPT_ITERABLE Container>
+LZ_NODISCARD AsRvalue<typename Owned<internal::Decay<Container>>::iterator> moveFrom(Container&& container) {
+    static_assert(!std::is_lvalue_reference<Container>::value,
+                  "moveFrom takes ownership of the container, use std::move or lz::asRvalue instead");
+    return asRvalue(own(std::move(container)));
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_MOVE_FROM_HPP
@@ -0,0 +1,60 @@
+#pragma once
+
+#ifndef LZ_OWN_HPP
+#    define LZ_OWN_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/OwningIterator.hpp"
+
+namespace lz {
+template<class Container>
+class Owned final
+    : public internal::BasicIteratorView<internal::OwningIterator<internal::IterTypeFromIterable<Container&>, Container>> {
+public:
+    using iterator = internal::OwningIterator<internal::IterTypeFromIterable<Container&>, Container>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    Owned() = default;
+
+    explicit Owned(const std::shared_ptr<Container>& container) :
+        internal::BasicIteratorView<iterator>(iterator(std::begin(*container), container),
+                                              iterator(std::end(*container), container)) {
+    }
+};
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Takes ownership of `container`, so that a chain of adaptors can be built on a temporary container and be returned from a
+ * function, without copying the container into a named local first and without dangling. The container is moved into a
+ * `std::shared_ptr` that every iterator of the view shares, so that adaptors that store the iterators (which all adaptors do)
+ * keep the container alive as well. Example:
+ * ```cpp
+ * auto validIds() {
+ *     // lz::filter(loadIds(), isValid) would refer to a destroyed vector
+ *     return lz::filter(lz::own(loadIds()), isValid);
+ * }
+ * ```
+ * Copying an iterator copies the `std::shared_ptr`. Algorithms and materializers such as `toVector` iterate over the underlying
+ * iterators instead, so they do not pay for the reference count.
+ * @param container The container to take ownership of, for e.g. a temporary or `std::move(vector)`.
+ * @return A view of the elements of `container`, that owns `container`.
+ */
+template<LZ_CONCEPT_ITERABLE Container>
+LZ_NODISCARD Owned<internal::Decay<Container>> own(Container&& container) {
+    static_assert(!std::is_lvalue_reference<Container>::value, "own takes ownership of the container, use std::move");
+    return Owned<internal::Decay<Container>>(std::make_shared<internal::Decay<Container>>(std::move(container)));
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_OWN_HPP
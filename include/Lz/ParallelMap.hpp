@@ -0,0 +1,82 @@
+#pragma once
+
+#ifndef LZ_PARALLEL_MAP_HPP
+#    define LZ_PARALLEL_MAP_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/ParallelMapIterator.hpp"
+
+namespace lz {
+template<LZ_CONCEPT_ITERATOR Iterator, class Function>
+class ParallelMap final : public internal::BasicIteratorView<internal::ParallelMapIterator<Iterator, Function>> {
+public:
+    using iterator = internal::ParallelMapIterator<Iterator, Function>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    ParallelMap(Iterator begin, Iterator end, Function function, ThreadPool& pool, const std::size_t window) :
+        internal::BasicIteratorView<iterator>(iterator(std::make_shared<internal::ParallelMapState<Iterator, Function>>(
+                                                  std::move(begin), std::move(end), std::move(function), pool, window)),
+                                              iterator()) {
+    }
+
+    ParallelMap() = default;
+};
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Maps [begin, end) with `function` like `lz::mapRange`, but calls `function` for `window` elements at a time on the threads of
+ * a pool, and yields the results in the order of the input. Use this for expensive functions, such as parsing or hashing, when
+ * the sequence is not random access (e.g. `lz::lines`) and therefore can't be split up front. Example:
+ * ```cpp
+ * auto enriched = lz::parallelMap(lz::lines(log), enrich, lz::execution::pool());
+ * for (const Record& record : enriched) {
+ *     write(record);
+ * }
+ * ```
+ * While the consumer reads the results of a window, the next window is mapped in the background, so the consumer only waits
+ * if it is faster than the pool. Inside a task of the same pool, a window is mapped when the consumer arrives at it instead. The
+ * view is single pass; its copies and iterators share the results.
+ * @param begin The beginning of the sequence, a forward iterator, of which the elements must stay valid until their window
+ * is read, which is up to two windows ahead of the consumer.
+ * @param end The ending of the sequence.
+ * @param function The function to map with, which is called from multiple threads at the same time.
+ * @param policy The pool to run on, for instance `lz::execution::pool()`.
+ * @param window The amount of elements that are mapped at once. If 0, eight times the amount of threads of the pool.
+ * @return A ParallelMap view, of which the iterators are input iterators.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Function>
+LZ_NODISCARD ParallelMap<Iterator, Function> parallelMapRange(Iterator begin, Iterator end, Function function,
+                                                              const execution::PoolPolicy policy, const std::size_t window = 0) {
+    return { std::move(begin), std::move(end), std::move(function), policy.pool(),
+             window == 0 ? 8 * policy.pool().threadCount() : window };
+}
+
+/**
+ * Maps `iterable` with `function`, calling `function` for `window` elements at a time on the threads of a pool, and yields the
+ * results in the order of the input. See `lz::parallelMapRange`.
+ * @param iterable The sequence to map, of which the iterators are forward iterators.
+ * @param function The function to map with, which is called from multiple threads at the same time.
+ * @param policy The pool to run on, for instance `lz::execution::pool()`.
+ * @param window The amount of elements that are mapped at once. If 0, eight times the amount of threads of the pool.
+ * @return A ParallelMap view, of which the iterators are input iterators.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Function>
+LZ_NODISCARD ParallelMap<internal::IterTypeFromIterable<Iterable>, Function>
+parallelMap(Iterable&& iterable, Function function, const execution::PoolPolicy policy, const std::size_t window = 0) {
+    return parallelMapRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                            std::move(function), policy, window);
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_PARALLEL_MAP_HPP
@@ -0,0 +1,225 @@
+#pragma once
+
+#ifndef LZ_PARTITIONS_HPP
+#    define LZ_PARTITIONS_HPP
+
+#    include "FlatHashMap.hpp"
+#    include "detail/MapIterator.hpp"
+#    include "detail/Parallel.hpp"
+
+#    include <cmath>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+// Maps a hash onto [0, partitionCount) with a multiplication instead of a division, using the upper bits of the mixed hash
+LZ_NODISCARD inline std::size_t partitionIndex(const std::uint64_t hash, const std::size_t partitionCount) noexcept {
+    return static_cast<std::size_t>(((mixHash(hash) >> 32) * static_cast<std::uint64_t>(partitionCount)) >> 32);
+}
+
+// Appends every element to the partition of the hash of its key, in a single pass. If the length of the sequence is known,
+// every partition reserves a bit more than its share up front, as growing P vectors while scattering costs as much as the
+// scatter itself. With an even hash, a partition is rarely larger than its share by more than 4 standard deviations
+template<class T, class Iterator, class KeySelector>
+std::vector<std::vector<T>> scatter(Iterator begin, const Iterator& end, const KeySelector& keySelector,
+                                    const std::size_t partitionCount) {
+    using Key = Decay<FunctionReturnType<KeySelector, RefType<Iterator>>>;
+    std::vector<std::vector<T>> partitions(partitionCount);
+    const std::size_t share = sizeHint(begin, end).lower / partitionCount;
+    if (share != 0) {
+        const auto deviation = static_cast<std::size_t>(std::sqrt(static_cast<double>(share)));
+        for (std::vector<T>& partition : partitions) {
+            partition.reserve(share + 4 * deviation + 1);
+        }
+    }
+
+    const std::hash<Key> hash{};
+    for (; begin != end; ++begin) {
+        auto&& value = *begin;
+        const std::size_t partition = partitionIndex(static_cast<std::uint64_t>(hash(keySelector(value))), partitionCount);
+        partitions[partition].push_back(std::forward<decltype(value)>(value));
+    }
+    return partitions;
+}
+
+// Every block of [begin, end) is scattered into partitions of its own. Then every partition is concatenated from the blocks
+// in order, so that the elements of a partition keep the order of the sequence
+template<class T, class Iterator, class KeySelector>
+std::vector<std::vector<T>> parallelScatter(std::true_type /* isRandomAccess */, const Iterator& begin, const Iterator& end,
+                                            const KeySelector& keySelector, const std::size_t partitionCount,
+                                            ThreadPool& pool) {
+    using Diff = DiffType<Iterator>;
+    const auto length = static_cast<std::size_t>(end - begin);
+    const std::size_t blockCount = parallelBlockCount(pool, length);
+    if (blockCount == 1) {
+        return scatter<T>(begin, end, keySelector, partitionCount);
+    }
+
+    std::vector<std::vector<std::vector<T>>> blocks(blockCount);
+    pool.parallelFor(blockCount, [&](const std::size_t block) {
+        blocks[block] = scatter<T>(begin + static_cast<Diff>(length * block / blockCount),
+                                   begin + static_cast<Diff>(length * (block + 1) / blockCount), keySelector, partitionCount);
+    });
+
+    std::vector<std::vector<T>> partitions(partitionCount);
+    pool.parallelFor(partitionCount, [&](const std::size_t partition) {
+        std::size_t size = 0;
+        for (const std::vector<std::vector<T>>& block : blocks) {
+            size += block[partition].size();
+        }
+        std::vector<T>& result = partitions[partition];
+        result.reserve(size);
+        for (std::vector<std::vector<T>>& block : blocks) {
+            std::move(block[partition].begin(), block[partition].end(), std::back_inserter(result));
+            block[partition] = std::vector<T>();
+        }
+    });
+    return partitions;
+}
+
+template<class T, class Iterator, class KeySelector>
+std::vector<std::vector<T>> parallelScatter(std::false_type /* isRandomAccess */, const Iterator& begin, const Iterator& end,
+                                            const KeySelector& keySelector, const std::size_t partitionCount, ThreadPool&) {
+    return scatter<T>(begin, end, keySelector, partitionCount);
+}
+
+template<class T>
+struct PartitionView {
+    LZ_NODISCARD BasicIteratorView<T*> operator()(std::vector<T>& values) const noexcept {
+        return { values.data(), values.data() + values.size() };
+    }
+};
+
+template<class T>
+struct ConstPartitionView {
+    LZ_NODISCARD BasicIteratorView<const T*> operator()(const std::vector<T>& values) const noexcept {
+        return { values.data(), values.data() + values.size() };
+    }
+};
+} // namespace internal
+
+/**
+ * The result of `lz::partitionBy`: a fixed amount of partitions, each of which holds its elements contiguously. Every partition
+ * is a view that can be passed to all adaptors, or handed to another thread or node as a whole. Iterating the container yields
+ * the partitions in order.
+ * @tparam T The type of the elements.
+ */
+template<class T>
+class Partitions {
+    using Storage = std::vector<std::vector<T>>;
+
+    Storage _partitions;
+
+public:
+    //! The view of a partition.
+    using Partition = internal::BasicIteratorView<T*>;
+    //! The view of a partition of a const container.
+    using ConstPartition = internal::BasicIteratorView<const T*>;
+
+    using iterator = internal::MapIterator<typename Storage::iterator, internal::PartitionView<T>>;
+    using const_iterator = internal::MapIterator<typename Storage::const_iterator, internal::ConstPartitionView<T>>;
+    using value_type = Partition;
+
+    Partitions() = default;
+
+    /**
+     * Creates a container of which partition `i` holds the elements of `partitions[i]`.
+     * @param partitions The elements of every partition.
+     */
+    explicit Partitions(std::vector<std::vector<T>> partitions) noexcept : _partitions(std::move(partitions)) {
+    }
+
+    //! The amount of partitions.
+    LZ_NODISCARD std::size_t size() const noexcept {
+        return _partitions.size();
+    }
+
+    LZ_NODISCARD bool empty() const noexcept {
+        return _partitions.empty();
+    }
+
+    //! The elements of partition `index`, as a contiguous view.
+    LZ_NODISCARD Partition operator[](const std::size_t index) noexcept {
+        return internal::PartitionView<T>()(_partitions[index]);
+    }
+
+    //! The elements of partition `index`, as a contiguous view.
+    LZ_NODISCARD ConstPartition operator[](const std::size_t index) const noexcept {
+        return internal::ConstPartitionView<T>()(_partitions[index]);
+    }
+
+    //! The underlying storage of partition `index`, for e.g. to move its elements elsewhere.
+    LZ_NODISCARD std::vector<T>& partitionVector(const std::size_t index) noexcept {
+        return _partitions[index];
+    }
+
+    //! The underlying storage of partition `index`.
+    LZ_NODISCARD const std::vector<T>& partitionVector(const std::size_t index) const noexcept {
+        return _partitions[index];
+    }
+
+    LZ_NODISCARD iterator begin() noexcept {
+        return { _partitions.begin(), internal::PartitionView<T>() };
+    }
+
+    LZ_NODISCARD iterator end() noexcept {
+        return { _partitions.end(), internal::PartitionView<T>() };
+    }
+
+    LZ_NODISCARD const_iterator begin() const noexcept {
+        return { _partitions.begin(), internal::ConstPartitionView<T>() };
+    }
+
+    LZ_NODISCARD const_iterator end() const noexcept {
+        return { _partitions.end(), internal::ConstPartitionView<T>() };
+    }
+};
+
+/**
+ * Splits `iterable` into `partitionCount` partitions by the hash of the key of every element, in a single pass. Elements with
+ * equal keys end up in the same partition, and the elements of a partition keep their order. This is the first step of e.g. a
+ * parallel hash aggregation, in which every partition is then aggregated by its own thread without sharing keys, or of sending
+ * shards to other nodes. The key is hashed with `std::hash` and mixed, so integer keys are spread evenly as well. If the
+ * size of `iterable` is known, every partition reserves room for its share beforehand. Random access iterables are split
+ * into blocks that are partitioned by different threads, after which the partitions of the blocks are concatenated in
+ * parallel. Other iterables are partitioned on the calling thread. Example:
+ * ```cpp
+ * auto shards = lz::partitionBy(orders, [](const Order& o) { return o.customerId; }, 16, lz::execution::pool());
+ * lz::execution::pool().pool().parallelFor(shards.size(), [&](std::size_t i) { totals[i] = aggregate(shards[i]); });
+ * ```
+ * @param iterable The sequence to partition.
+ * @param keySelector A function that returns the key of an element, which is hashed with `std::hash`.
+ * @param partitionCount The amount of partitions, which must be at least 1 and less than 2^32.
+ * @param policy The pool to run on, for instance `lz::execution::pool()`.
+ * @return The partitions, with copies of the elements of `iterable`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector>
+LZ_NODISCARD Partitions<internal::ValueTypeIterable<Iterable>>
+partitionBy(Iterable&& iterable, const KeySelector& keySelector, const std::size_t partitionCount,
+            const execution::PoolPolicy& policy) {
+    using Iterator = internal::IterTypeFromIterable<Iterable>;
+    LZ_ASSERT(partitionCount > 0 && (partitionCount >> 16 >> 16) == 0, "the amount of partitions must be in [1, 2^32)");
+    return Partitions<internal::ValueTypeIterable<Iterable>>(internal::parallelScatter<internal::ValueTypeIterable<Iterable>>(
+        internal::IsRandomAccess<Iterator>(), internal::begin(std::forward<Iterable>(iterable)),
+        internal::end(std::forward<Iterable>(iterable)), keySelector, partitionCount, policy.pool()));
+}
+
+/**
+ * Splits `iterable` into `partitionCount` partitions by the hash of the key of every element, in a single pass on the calling
+ * thread. See `lz::partitionBy(Iterable&&, const KeySelector&, std::size_t, const execution::PoolPolicy&)`.
+ * @param iterable The sequence to partition.
+ * @param keySelector A function that returns the key of an element, which is hashed with `std::hash`.
+ * @param partitionCount The amount of partitions, which must be at least 1 and less than 2^32.
+ * @return The partitions, with copies of the elements of `iterable`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelector>
+LZ_NODISCARD Partitions<internal::ValueTypeIterable<Iterable>>
+partitionBy(Iterable&& iterable, const KeySelector& keySelector, const std::size_t partitionCount) {
+    LZ_ASSERT(partitionCount > 0 && (partitionCount >> 16 >> 16) == 0, "the amount of partitions must be in [1, 2^32)");
+    return Partitions<internal::ValueTypeIterable<Iterable>>(internal::scatter<internal::ValueTypeIterable<Iterable>>(
+        internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), keySelector,
+        partitionCount));
+}
+} // namespace lz
+
+#endif // LZ_PARTITIONS_HPP
@@ -0,0 +1,144 @@
+#pragma once
+
+#ifndef LZ_PMR_HPP
+#    define LZ_PMR_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+
+#    if defined(LZ_HAS_CXX_17) && LZ_HAS_INCLUDE(<memory_resource>)
+#        include <memory_resource>
+#    endif // defined(LZ_HAS_CXX_17) && LZ_HAS_INCLUDE(<memory_resource>)
+
+#    ifdef __cpp_lib_memory_resource
+
+namespace lz {
+namespace internal {
+template<class Iterable>
+BasicIteratorView<IterTypeFromIterable<Iterable>> viewOf(Iterable&& iterable) {
+    return { std::begin(iterable), std::end(iterable) };
+}
+
+template<class Iterable, class KeySelectorFunc>
+using PmrKeyType = FunctionReturnType<KeySelectorFunc, RefType<IterTypeFromIterable<Iterable>>>;
+} // namespace internal
+
+/**
+ * Materializes views into `std::pmr` containers, of which all memory comes from a `std::pmr::memory_resource`, for e.g. a
+ * `std::pmr::monotonic_buffer_resource` that lives as long as a request. The memory of the results (and of the temporary strings
+ * that are needed to create them) is then released at once when the arena goes out of scope, instead of being freed element by
+ * element. Example:
+ * ```cpp
+ * std::byte buffer[4096];
+ * std::pmr::monotonic_buffer_resource arena(buffer, sizeof buffer);
+ * std::pmr::vector<int> ids = lz::pmr::toVector(lz::filter(request.ids, isValid), &arena);
+ * std::pmr::string joined = lz::pmr::toString(ids, &arena, ", ");
+ * ```
+ * Other containers can be created with `lz::pmr::to<std::pmr::set<int>>(iterable, &arena)`, or with the `to`, `toVector`,
+ * `toMap` and `toUnorderedMap` functions of a view, that all take an allocator.
+ */
+namespace pmr {
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Creates a container that uses `std::pmr::polymorphic_allocator`, of which the memory comes from `resource`.
+ * @tparam Container The container type, for e.g. `std::pmr::deque<int>`.
+ * @param iterable The sequence to copy into the container.
+ * @param resource The memory resource to allocate from, the default resource by default.
+ * @return The container with the elements of `iterable`.
+ */
+template<class Container, LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD Container to(Iterable&& iterable, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+    return internal::viewOf(iterable).template to<Container>(MaterializePolicy::reserveUpperBound,
+                                                             typename Container::allocator_type(resource));
+}
+
+/**
+ * Creates a `std::pmr::vector` of which the memory comes from `resource`.
+ * @param iterable The sequence to copy into the vector.
+ * @param resource The memory resource to allocate from, the default resource by default.
+ * @return The vector with the elements of `iterable`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD std::pmr::vector<internal::ValueType<internal::IterTypeFromIterable<Iterable>>>
+toVector(Iterable&& iterable, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+    return pmr::to<std::pmr::vector<internal::ValueType<internal::IterTypeFromIterable<Iterable>>>>(iterable, resource);
+}
+
+/**
+ * Joins the elements of `iterable` into a `std::pmr::string` of which the memory comes from `resource`. See
+ * `BasicIteratorView::toString` for how the elements are joined.
+ * @param iterable The sequence to join.
+ * @param resource The memory resource to allocate from.
+ * @param delimiter The delimiter between the elements.
+ * @param fmt The format of an element, `{}` by default. (not applicable if std::format isn't available and LZ_STANDALONE is
+ * defined)
+ * @return The joined string.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+#        if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+LZ_NODISCARD std::pmr::string
+toString(Iterable&& iterable, std::pmr::memory_resource* resource, const StringView delimiter = "", const StringView fmt = "{}") {
+    std::pmr::string result(resource);
+    internal::viewOf(iterable).appendTo(result, delimiter, fmt);
+    return result;
+}
+#        else
+LZ_NODISCARD std::pmr::string
+toString(Iterable&& iterable, std::pmr::memory_resource* resource, const StringView delimiter = "") {
+    std::pmr::string result(resource);
+    internal::viewOf(iterable).appendTo(result, delimiter);
+    return result;
+}
+#        endif // defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+
+/**
+ * Creates a `std::pmr::map` of which the memory comes from `resource`. The keys are created by `keyGen`, the values are the
+ * elements of `iterable`.
+ * @param iterable The sequence to create the map of.
+ * @param keyGen The function that creates the key of an element.
+ * @param resource The memory resource to allocate from, the default resource by default.
+ * @return The map.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelectorFunc>
+LZ_NODISCARD std::pmr::map<internal::PmrKeyType<Iterable, KeySelectorFunc>,
+                           internal::ValueType<internal::IterTypeFromIterable<Iterable>>>
+toMap(Iterable&& iterable, KeySelectorFunc keyGen, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+    using Key = internal::PmrKeyType<Iterable, KeySelectorFunc>;
+    using Value = internal::ValueType<internal::IterTypeFromIterable<Iterable>>;
+    return internal::viewOf(iterable).toMap(std::move(keyGen),
+                                            std::pmr::polymorphic_allocator<std::pair<const Key, Value>>(resource));
+}
+
+/**
+ * Creates a `std::pmr::unordered_map` of which the memory comes from `resource`. The keys are created by `keyGen`, the values
+ * are the elements of `iterable`.
+ * @param iterable The sequence to create the map of.
+ * @param keyGen The function that creates the key of an element.
+ * @param resource The memory resource to allocate from, the default resource by default.
+ * @return The unordered map.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class KeySelectorFunc>
+LZ_NODISCARD std::pmr::unordered_map<internal::PmrKeyType<Iterable, KeySelectorFunc>,
+                                     internal::ValueType<internal::IterTypeFromIterable<Iterable>>>
+toUnorderedMap(Iterable&& iterable, KeySelectorFunc keyGen,
+               std::pmr::memory_resource* resource = std::pmr::get_default_resource()) {
+    using Key = internal::PmrKeyType<Iterable, KeySelectorFunc>;
+    using Value = internal::ValueType<internal::IterTypeFromIterable<Iterable>>;
+    return internal::viewOf(iterable).toUnorderedMap(std::move(keyGen),
+                                                     std::pmr::polymorphic_allocator<std::pair<const Key, Value>>(resource));
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace pmr
+} // namespace lz
+
+#    endif // __cpp_lib_memory_resource
+
+#endif // LZ_PMR_HPP
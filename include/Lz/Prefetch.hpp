@@ -0,0 +1,76 @@
+#pragma once
+
+#ifndef LZ_PREFETCH_HPP
+#    define LZ_PREFETCH_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/PrefetchIterator.hpp"
+
+namespace lz {
+template<LZ_CONCEPT_ITERATOR Iterator>
+class Prefetch final : public internal::BasicIteratorView<internal::PrefetchIterator<Iterator>> {
+public:
+    using iterator = internal::PrefetchIterator<Iterator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    Prefetch(Iterator begin, Iterator end, const std::size_t queueDepth) :
+        internal::BasicIteratorView<iterator>(
+            iterator(std::make_shared<internal::PrefetchState<Iterator>>(std::move(begin), std::move(end), queueDepth)),
+            iterator()) {
+    }
+
+    Prefetch() = default;
+};
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Iterates over [begin, end) on a background thread, that runs ahead of the consumer by at most `queueDepth` elements. The
+ * elements are handed over in order through a lock free single producer, single consumer queue (`lz::SpscRingBuffer`), so that
+ * an expensive stage, such as `lz::map(blocks, decompress)`, runs in parallel with whatever consumes its results. Example:
+ * ```cpp
+ * for (const Block& block : lz::prefetch(lz::map(compressed, decompress), 16)) {
+ *     parse(block); // Decompresses the next blocks in the meantime
+ * }
+ * ```
+ * The thread starts when the view is first iterated over, and is stopped and joined when the view and all its iterators are
+ * destroyed, even if not all elements were consumed. An exception thrown by the background iteration is rethrown by the consumer
+ * after the elements before it. The view is single pass; its copies and iterators share the same thread. Threads waiting for the
+ * queue yield instead of blocking, so this suits stages that are expensive per element, not cheap ones. [begin, end) must
+ * not be used by other threads while the view is iterated over.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param queueDepth The maximum amount of elements that are computed ahead, rounded up to a power of two. The value type must be
+ * default constructible.
+ * @return A Prefetch view, of which the iterators are input iterators.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD Prefetch<Iterator> prefetchRange(Iterator begin, Iterator end, const std::size_t queueDepth) {
+    return { std::move(begin), std::move(end), queueDepth };
+}
+
+/**
+ * Iterates over `iterable` on a background thread, that runs ahead of the consumer by at most `queueDepth` elements. See
+ * `lz::prefetchRange`.
+ * @param iterable The sequence to iterate over on a background thread.
+ * @param queueDepth The maximum amount of elements that are computed ahead, rounded up to a power of two.
+ * @return A Prefetch view, of which the iterators are input iterators.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD Prefetch<internal::IterTypeFromIterable<Iterable>> prefetch(Iterable&& iterable, const std::size_t queueDepth) {
+    return prefetchRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                         queueDepth);
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_PREFETCH_HPP
@@ -0,0 +1,73 @@
+#pragma once
+
+#ifndef LZ_PREFETCHED_HPP
+#    define LZ_PREFETCHED_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/PrefetchedIterator.hpp"
+
+namespace lz {
+template<LZ_CONCEPT_ITERATOR Iterator>
+class Prefetched final : public internal::BasicIteratorView<internal::PrefetchedIterator<Iterator>> {
+public:
+    using iterator = internal::PrefetchedIterator<Iterator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    Prefetched(Iterator begin, Iterator end, const internal::DiffType<Iterator> distance) :
+        internal::BasicIteratorView<iterator>(iterator(begin, end, distance), iterator(end, end, distance)) {
+    }
+
+    Prefetched() = default;
+};
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Issues a software prefetch for the element `distance` positions ahead every time an iterator is incremented, for random
+ * accesses the hardware prefetcher cannot predict. The element itself is not read ahead, only its address is computed: of a
+ * reference, e.g. `&table[index]` of a map that returns `table[index]` by reference, or of the object a pointer-like element
+ * (a raw pointer, `std::unique_ptr` or `std::shared_ptr`) points to. This way a gather or a hash probe has a few loads in flight
+ * instead of waiting for one cache miss at a time. Example:
+ * ```cpp
+ * auto gathered = lz::map(indices, [&table](std::size_t i) -> const Row& { return table[i]; });
+ * for (const Row& row : lz::prefetched(gathered, 16)) { ... }
+ * std::vector<Node*> nodes = ...;
+ * for (Node* node : lz::prefetched(nodes, 8)) { sum += node->value; }
+ * ```
+ * The distance should cover the latency of a cache miss, which is about 100 ns, so typically 8 to 32 for cheap loop bodies.
+ * @param begin The beginning of the random access sequence, of which the elements are references or pointers.
+ * @param end The ending of the random access sequence.
+ * @param distance The amount of elements ahead of the current one that is prefetched.
+ * @return A random access Prefetched view.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD Prefetched<Iterator> prefetchedRange(Iterator begin, Iterator end, const internal::DiffType<Iterator> distance) {
+    return { std::move(begin), std::move(end), distance };
+}
+
+/**
+ * Issues a software prefetch for the element `distance` positions ahead every time an iterator is incremented. See
+ * `lz::prefetchedRange`.
+ * @param iterable The random access sequence, of which the elements are references or pointers.
+ * @param distance The amount of elements ahead of the current one that is prefetched.
+ * @return A random access Prefetched view.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD Prefetched<internal::IterTypeFromIterable<Iterable>>
+prefetched(Iterable&& iterable, const internal::DiffType<internal::IterTypeFromIterable<Iterable>> distance) {
+    return prefetchedRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                           distance);
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_PREFETCHED_HPP
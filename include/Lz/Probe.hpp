@@ -0,0 +1,91 @@
+#pragma once
+
+#ifndef LZ_PROBE_HPP
+#    define LZ_PROBE_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/ProbeIterator.hpp"
+
+namespace lz {
+template<LZ_CONCEPT_ITERATOR Iterator>
+class Probe final : public internal::BasicIteratorView<internal::ProbeIterator<Iterator>> {
+public:
+    using iterator = internal::ProbeIterator<Iterator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    Probe(Iterator begin, Iterator end, internal::ProbeRecord* record) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(begin), end, record), iterator(end, end, record)) {
+    }
+
+    Probe() = default;
+};
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Tags a stage of a chain, to find out which stage makes it slow. If `LZ_PROBES` is defined (`-D CPP-LAZY_PROBES=ON`), the
+ * elements that are iterated past the probe are counted, and the time spent in the increments and dereferences of [begin, end)
+ * is added up. As the stages of a chain are lazy, this time includes all stages before the probe, so the time of the stages
+ * between two probes is the difference of their times, and the selectivity of e.g. a `filter`, `except` or `unique` between
+ * them is the ratio of their element counts. See `lz::probeReport` and `lz::onProbeFinished`. If `LZ_PROBES` is not defined,
+ * the probe records nothing and only costs a branch per increment and dereference, so probes can be left in place. The type of
+ * the returned view does not depend on `LZ_PROBES`, so translation units with and without it can be linked together. Example:
+ * ```cpp
+ * auto valid = lz::toIter(lines).probe("read").map(parse).probe("parse").filter(isValid).probe("filter");
+ * ```
+ * @param begin The beginning of the sequence to probe.
+ * @param end The ending of the sequence to probe.
+ * @param name The name of the probe. Probes with the same name share their counters.
+ * @return A Probe view of [begin, end).
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Enabled = internal::ProbesEnabled>
+LZ_NODISCARD Probe<Iterator> probeRange(Iterator begin, Iterator end, const char* name) {
+    return { std::move(begin), std::move(end), internal::probeRecord(name, Enabled()) };
+}
+
+/**
+ * Tags a stage of a chain, to find out which stage makes it slow. See `lz::probeRange`.
+ * @param iterable The sequence to probe.
+ * @param name The name of the probe. Probes with the same name share their counters.
+ * @return A Probe view of `iterable`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class I = internal::IterTypeFromIterable<Iterable>, class Enabled = internal::ProbesEnabled>
+LZ_NODISCARD Probe<I> probe(Iterable&& iterable, const char* name) {
+    return probeRange<I, Enabled>(internal::begin(std::forward<Iterable>(iterable)),
+                                  internal::end(std::forward<Iterable>(iterable)), name);
+}
+
+// End of group
+/**
+ * @}
+ */
+
+/**
+ * Returns the counters of all probes, in the order in which they were created. Without `LZ_PROBES`, this is empty.
+ */
+inline std::vector<ProbeSnapshot> probeReport() {
+    return internal::probeRegistry().snapshot();
+}
+
+/**
+ * Sets the counters of all probes to zero.
+ */
+inline void resetProbes() {
+    internal::probeRegistry().reset();
+}
+
+/**
+ * Calls `callback` with the counters of a probe every time a probed sequence is iterated up to its end, e.g. to export them to
+ * a metrics system. The callback can be called from any thread that iterates a probed sequence. An empty function removes it.
+ */
+inline void onProbeFinished(std::function<void(const ProbeSnapshot&)> callback) {
+    internal::probeRegistry().onFinished(std::move(callback));
+}
+} // namespace lz
+
+#endif // LZ_PROBE_HPP
@@ -0,0 +1,40 @@
+#pragma once
+
+#ifndef LZ_PROBE_REPORT_HPP
+#    define LZ_PROBE_REPORT_HPP
+
+#    include "Probe.hpp"
+
+#    include <iomanip>
+#    include <ostream>
+
+namespace lz {
+/**
+ * Writes `lz::probeReport()` as a table to `stream`: per probe its elements, its time, and its elements relative to the probe
+ * that was created before it, which is the selectivity of the stages between them if they are part of the same chain.
+ */
+inline void writeProbeReport(std::ostream& stream) {
+    const std::vector<ProbeSnapshot> report = probeReport();
+    const std::ios_base::fmtflags flags = stream.flags();
+    const std::streamsize precision = stream.precision();
+    stream << std::left << std::setw(24) << "probe" << std::right << std::setw(16) << "elements" << std::setw(16) << "time (us)"
+           << std::setw(12) << "ratio" << '\n';
+    for (std::size_t i = 0; i < report.size(); ++i) {
+        const ProbeSnapshot& snapshot = report[i];
+        stream << std::left << std::setw(24) << snapshot.name << std::right << std::setw(16) << snapshot.elements << std::setw(16)
+               << std::fixed << std::setprecision(1) << static_cast<double>(snapshot.time.count()) / 1000. << std::setw(12);
+        if (i == 0 || report[i - 1].elements == 0) {
+            stream << '-';
+        }
+        else {
+            stream << std::setprecision(3)
+                   << static_cast<double>(snapshot.elements) / static_cast<double>(report[i - 1].elements);
+        }
+        stream << '\n';
+    }
+    stream.flags(flags);
+    stream.precision(precision);
+}
+} // namespace lz
+
+#endif // LZ_PROBE_REPORT_HPP
@@ -0,0 +1,222 @@
+#pragma once
+
+#ifndef LZ_QUANTILE_SKETCH_HPP
+#    define LZ_QUANTILE_SKETCH_HPP
+
+#    include "Random.hpp"
+#    include "detail/FunctionContainer.hpp"
+#    include "detail/LzTools.hpp"
+
+#    include <algorithm>
+#    include <cmath>
+#    include <cstdint>
+#    include <utility>
+#    include <vector>
+
+namespace lz {
+/**
+ * A KLL sketch (Karnin, Lang & Liberty, "Optimal Quantile Approximation in Streams", 2016), that estimates the quantiles of a
+ * stream of values in one pass, while storing only a few times `k` of them. The values are kept in levels, a value at level `h`
+ * standing for 2^h values of the stream. When a level is full, it is sorted and every other value is promoted to the next
+ * level, starting at a random offset. The lower levels are smaller than the higher ones, so that the estimated rank of a
+ * value is off by about `1.7 / k` of the count at most. As long as less than `k` values are inserted, the answers are exact.
+ * Two sketches of the same comparer can be merged, so a stream can be split into parts that are sketched on separate threads.
+ * @tparam T The value type.
+ * @tparam Compare The comparer, `operator<` by default.
+ */
+template<class T, class Compare = std::less<T>>
+class QuantileSketch {
+    std::vector<std::vector<T>> _levels;
+    std::size_t _k{};
+    std::size_t _count{};
+    std::size_t _size{};
+    std::size_t _capacity{};
+    SplitMix64 _random;
+    internal::FunctionContainer<Compare> _compare;
+
+    std::size_t levelCapacity(const std::size_t level) const {
+        const auto depth = static_cast<double>(_levels.size() - level - 1);
+        const auto capacity = static_cast<std::size_t>(std::ceil(static_cast<double>(_k) * std::pow(2. / 3., depth)));
+        return capacity < 2 ? 2 : capacity;
+    }
+
+    void updateCapacity() {
+        _capacity = 0;
+        for (std::size_t level = 0; level != _levels.size(); ++level) {
+            _capacity += levelCapacity(level);
+        }
+    }
+
+    // At least one level is full if the sketch is, as the capacity is the sum of the level capacities
+    void compress() {
+        for (std::size_t level = 0; level != _levels.size(); ++level) {
+            if (_levels[level].size() < levelCapacity(level)) {
+                continue;
+            }
+            if (level + 1 == _levels.size()) {
+                _levels.emplace_back();
+                updateCapacity();
+            }
+            std::vector<T>& current = _levels[level];
+            std::vector<T>& next = _levels[level + 1];
+            std::sort(current.begin(), current.end(), _compare);
+            // With an odd amount of values, the first one stays behind, so that the weight of the sketch doesn't change
+            const std::size_t kept = current.size() % 2;
+            for (std::size_t i = kept + (_random() & 1u); i < current.size(); i += 2) {
+                next.push_back(std::move(current[i]));
+            }
+            _size -= (current.size() - kept) / 2;
+            current.erase(current.begin() + static_cast<std::ptrdiff_t>(kept), current.end());
+            return;
+        }
+    }
+
+    std::vector<std::pair<const T*, std::size_t>> weightedValues() const {
+        std::vector<std::pair<const T*, std::size_t>> weighted;
+        weighted.reserve(_size);
+        for (std::size_t level = 0; level != _levels.size(); ++level) {
+            for (const T& value : _levels[level]) {
+                weighted.emplace_back(&value, std::size_t{ 1 } << level);
+            }
+        }
+        return weighted;
+    }
+
+public:
+    /**
+     * Creates an empty sketch.
+     * @param k The accuracy. The sketch stores about 3 * `k` values, and the rank of an estimated quantile is off by about
+     * `1.7 / k` of the count at most.
+     * @param compare The comparer.
+     * @param seed The seed of the random offsets that are used to compress the levels. Equally seeded sketches that are given
+     * the same values give the same answers.
+     */
+    explicit QuantileSketch(const std::size_t k = 200, Compare compare = {}, const std::uint64_t seed = 0) :
+        _levels(1),
+        _k(k),
+        _random(seed),
+        _compare(std::move(compare)) {
+        LZ_ASSERT(k >= 2, "k must be at least 2");
+        updateCapacity();
+    }
+
+    //! Adds `value` to the sketch, in amortized O(log(k)) time.
+    void insert(T value) {
+        _levels.front().push_back(std::move(value));
+        ++_count;
+        if (++_size >= _capacity) {
+            compress();
+        }
+    }
+
+    /**
+     * Adds the values of `other` to this sketch, as if they were inserted into it.
+     * @param other The sketch to merge, that must use the same comparer.
+     */
+    void merge(const QuantileSketch& other) {
+        if (_levels.size() < other._levels.size()) {
+            _levels.resize(other._levels.size());
+            updateCapacity();
+        }
+        for (std::size_t level = 0; level != other._levels.size(); ++level) {
+            _levels[level].insert(_levels[level].end(), other._levels[level].begin(), other._levels[level].end());
+        }
+        _count += other._count;
+        _size += other._size;
+        while (_size >= _capacity) {
+            compress();
+        }
+    }
+
+    //! The amount of values that were inserted.
+    LZ_NODISCARD std::size_t count() const noexcept {
+        return _count;
+    }
+
+    //! Whether no values were inserted.
+    LZ_NODISCARD bool empty() const noexcept {
+        return _count == 0;
+    }
+
+    //! The amount of values the sketch stores.
+    LZ_NODISCARD std::size_t retained() const noexcept {
+        return _size;
+    }
+
+    /**
+     * Estimates the `q` quantile, the value of which about `q * count()` inserted values are smaller.
+     * @param q The quantile, in [0, 1]. 0 gives the smallest value that is stored, 0.5 the median and 1 the largest value.
+     * @return The estimated quantile. The sketch must not be empty.
+     */
+    LZ_NODISCARD T quantile(const double q) const {
+        LZ_ASSERT(!empty(), "the sketch cannot be empty");
+        LZ_ASSERT(q >= 0 && q <= 1, "the quantile must be in [0, 1]");
+        std::vector<std::pair<const T*, std::size_t>> weighted = weightedValues();
+        std::sort(weighted.begin(), weighted.end(),
+                  [this](const std::pair<const T*, std::size_t>& a, const std::pair<const T*, std::size_t>& b) {
+                      return _compare(*a.first, *b.first);
+                  });
+        const double rank = q * static_cast<double>(_count);
+        std::size_t cumulative = 0;
+        for (const std::pair<const T*, std::size_t>& entry : weighted) {
+            cumulative += entry.second;
+            if (static_cast<double>(cumulative) > rank) {
+                return *entry.first;
+            }
+        }
+        return *weighted.back().first;
+    }
+
+    /**
+     * Estimates the normalized rank of `value`: the fraction of the inserted values that are smaller than it.
+     * @param value The value to get the rank of.
+     * @return The estimated rank, in [0, 1]. The sketch must not be empty.
+     */
+    LZ_NODISCARD double rank(const T& value) const {
+        LZ_ASSERT(!empty(), "the sketch cannot be empty");
+        std::size_t smaller = 0;
+        for (std::size_t level = 0; level != _levels.size(); ++level) {
+            for (const T& stored : _levels[level]) {
+                if (_compare(stored, value)) {
+                    smaller += std::size_t{ 1 } << level;
+                }
+            }
+        }
+        return static_cast<double>(smaller) / static_cast<double>(_count);
+    }
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Reads `iterable` once and returns a `lz::QuantileSketch` of its values, to estimate quantiles such as the median without
+ * copying or modifying the sequence. Example:
+ * ```cpp
+ * auto sketch = lz::quantileSketch(lz::map(lines, parseLatency));
+ * double p99 = sketch.quantile(0.99);
+ * ```
+ * @param iterable The sequence to sketch, which may be an input iterable.
+ * @param k The accuracy, see `lz::QuantileSketch`.
+ * @return A sketch of the values of `iterable`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD QuantileSketch<internal::ValueTypeIterable<Iterable>>
+quantileSketch(Iterable&& iterable, const std::size_t k = 200) {
+    QuantileSketch<internal::ValueTypeIterable<Iterable>> sketch(k);
+    auto end = internal::end(std::forward<Iterable>(iterable));
+    for (auto it = internal::begin(std::forward<Iterable>(iterable)); it != end; ++it) {
+        sketch.insert(*it);
+    }
+    return sketch;
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_QUANTILE_SKETCH_HPP
@@ -4,8 +4,10 @@
 #    define LZ_RANDOM_HPP
 
 #    include "detail/BasicIteratorView.hpp"
+#    include "detail/RandomBits.hpp"
 #    include "detail/RandomIterator.hpp"
 
+#    include <cstdint>
 #    include <random>
 
 namespace lz {
@@ -112,11 +114,394 @@ public:
     }
 };
 
-inline std::mt19937 createMtEngine() {
+// Whether SeedSeq has the `generate(first, last)` of a seed sequence. Checked instead of only excluding integers, so that the
+// seed sequence constructors of the engines below are no better match than their copy constructors for non const engines
+template<class SeedSeq, class = int>
+struct IsSeedSequence : std::false_type {};
+
+template<class SeedSeq>
+struct IsSeedSequence<SeedSeq, decltype(std::declval<SeedSeq&>().generate(std::declval<std::uint_least32_t*>(),
+                                                                         std::declval<std::uint_least32_t*>()),
+                                        0)> : std::true_type {};
+
+// Fills N 64 bit words using a seed sequence, such as `std::seed_seq` or `SeedSequence`
+template<std::size_t N, class SeedSeq>
+std::array<std::uint64_t, N> generateSeedWords(SeedSeq& seedSeq) {
+    std::array<std::uint_least32_t, 2 * N> halves{};
+    seedSeq.generate(halves.begin(), halves.end());
+    std::array<std::uint64_t, N> words{};
+    for (std::size_t i = 0; i < N; ++i) {
+        const auto high = static_cast<std::uint64_t>(halves[2 * i] & 0xFFFFFFFFu);
+        words[i] = (high << 32u) | static_cast<std::uint64_t>(halves[2 * i + 1] & 0xFFFFFFFFu);
+    }
+    return words;
+}
+
+constexpr std::uint64_t rotateLeft(const std::uint64_t x, const unsigned shift) noexcept {
+    return (x << shift) | (x >> (64u - shift));
+}
+
+inline std::uint64_t randomDeviceSeed() {
+    std::random_device rd;
+    return (static_cast<std::uint64_t>(rd()) << 32u) ^ static_cast<std::uint64_t>(rd());
+}
+} // namespace internal
+
+/**
+ * SplitMix64, a random number generator with 8 bytes of state, that passes BigCrush. It is mostly used to seed the other
+ * generators, but it is also one of the fastest generators there is. Satisfies the `UniformRandomBitGenerator` requirements,
+ * so it can be used as `Generator` of `lz::random`.
+ */
+class SplitMix64 {
+    std::uint64_t _state{};
+
+public:
+    using result_type = std::uint64_t;
+
+    constexpr explicit SplitMix64(const std::uint64_t seed = 0) noexcept : _state(seed) {
+    }
+
+    template<class SeedSeq, class = internal::EnableIf<internal::IsSeedSequence<SeedSeq>::value>>
+    explicit SplitMix64(SeedSeq& seedSeq) : _state(internal::generateSeedWords<1>(seedSeq)[0]) {
+    }
+
+    static constexpr result_type(min)() noexcept {
+        return 0;
+    }
+
+    static constexpr result_type(max)() noexcept {
+        return (std::numeric_limits<result_type>::max)();
+    }
+
+    LZ_CONSTEXPR_CXX_14 result_type operator()() noexcept {
+        _state += 0x9E3779B97F4A7C15ULL;
+        std::uint64_t z = _state;
+        z = (z ^ (z >> 30u)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27u)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31u);
+    }
+
+    //! Advances the state by `n` steps in constant time.
+    LZ_CONSTEXPR_CXX_14 void discard(const unsigned long long n) noexcept {
+        _state += 0x9E3779B97F4A7C15ULL * n;
+    }
+
+    LZ_NODISCARD constexpr friend bool operator==(const SplitMix64& a, const SplitMix64& b) noexcept {
+        return a._state == b._state;
+    }
+
+    LZ_NODISCARD constexpr friend bool operator!=(const SplitMix64& a, const SplitMix64& b) noexcept {
+        return !(a == b); // NOLINT
+    }
+};
+
+/**
+ * xoshiro256**, a fast all purpose random number generator with 32 bytes of state and a period of 2^256 - 1. A seed of 64
+ * bits is expanded to the full state using SplitMix64, as recommended by its authors. Satisfies the
+ * `UniformRandomBitGenerator` requirements, so it can be used as `Generator` of `lz::random`.
+ */
+class Xoshiro256StarStar {
+    std::uint64_t _state[4]{};
+
+public:
+    using result_type = std::uint64_t;
+
+    LZ_CONSTEXPR_CXX_14 explicit Xoshiro256StarStar(const std::uint64_t seed = 0) noexcept {
+        SplitMix64 seeder(seed);
+        for (std::uint64_t& word : _state) {
+            word = seeder();
+        }
+    }
+
+    template<class SeedSeq, class = internal::EnableIf<internal::IsSeedSequence<SeedSeq>::value>>
+    explicit Xoshiro256StarStar(SeedSeq& seedSeq) {
+        const auto words = internal::generateSeedWords<4>(seedSeq);
+        std::copy(words.begin(), words.end(), std::begin(_state));
+        // A state of all zeros is the only one that can't be used
+        if (_state[0] == 0 && _state[1] == 0 && _state[2] == 0 && _state[3] == 0) {
+            _state[0] = 1;
+        }
+    }
+
+    static constexpr result_type(min)() noexcept {
+        return 0;
+    }
+
+    static constexpr result_type(max)() noexcept {
+        return (std::numeric_limits<result_type>::max)();
+    }
+
+    LZ_CONSTEXPR_CXX_14 result_type operator()() noexcept {
+        const std::uint64_t result = internal::rotateLeft(_state[1] * 5, 7) * 9;
+        const std::uint64_t t = _state[1] << 17u;
+        _state[2] ^= _state[0];
+        _state[3] ^= _state[1];
+        _state[1] ^= _state[2];
+        _state[0] ^= _state[3];
+        _state[2] ^= t;
+        _state[3] = internal::rotateLeft(_state[3], 45);
+        return result;
+    }
+
+    LZ_CONSTEXPR_CXX_14 void discard(unsigned long long n) noexcept {
+        for (; n != 0; --n) {
+            (*this)();
+        }
+    }
+
+    /**
+     * Advances the state by 2^128 steps, which can be used to create 2^128 generators that don't overlap, e.g. one per thread.
+     */
+    LZ_CONSTEXPR_CXX_14 void jump() noexcept {
+        constexpr std::uint64_t jumpPolynomial[] = { 0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL,
+                                                     0x39ABDC4529B1661CULL };
+        std::uint64_t jumped[4]{};
+        for (const std::uint64_t polynomial : jumpPolynomial) {
+            for (unsigned bit = 0; bit < 64; ++bit) {
+                if ((polynomial >> bit) & 1u) {
+                    for (std::size_t i = 0; i < 4; ++i) {
+                        jumped[i] ^= _state[i];
+                    }
+                }
+                (*this)();
+            }
+        }
+        for (std::size_t i = 0; i < 4; ++i) {
+            _state[i] = jumped[i];
+        }
+    }
+
+    LZ_NODISCARD friend bool operator==(const Xoshiro256StarStar& a, const Xoshiro256StarStar& b) noexcept {
+        return std::equal(std::begin(a._state), std::end(a._state), std::begin(b._state));
+    }
+
+    LZ_NODISCARD friend bool operator!=(const Xoshiro256StarStar& a, const Xoshiro256StarStar& b) noexcept {
+        return !(a == b); // NOLINT
+    }
+};
+
+/**
+ * PCG32 (XSH RR), a fast random number generator with 16 bytes of state that produces 32 bit numbers. Generators with a
+ * different `stream` produce different sequences, even with the same seed. Satisfies the `UniformRandomBitGenerator`
+ * requirements, so it can be used as `Generator` of `lz::random`.
+ */
+class Pcg32 {
+    std::uint64_t _state{};
+    std::uint64_t _increment{};
+
+    static constexpr std::uint64_t multiplier = 6364136223846793005ULL;
+
+    explicit Pcg32(const std::array<std::uint64_t, 2>& seedAndStream) : Pcg32(seedAndStream[0], seedAndStream[1]) {
+    }
+
+public:
+    using result_type = std::uint32_t;
+
+    LZ_CONSTEXPR_CXX_14 explicit Pcg32(const std::uint64_t seed = 0,
+                                       const std::uint64_t stream = 0xDA3E39CB94B95BDBULL) noexcept :
+        _increment((stream << 1u) | 1u) {
+        (*this)();
+        _state += seed;
+        (*this)();
+    }
+
+    template<class SeedSeq, class = internal::EnableIf<internal::IsSeedSequence<SeedSeq>::value>>
+    explicit Pcg32(SeedSeq& seedSeq) : Pcg32(internal::generateSeedWords<2>(seedSeq)) {
+    }
+
+    static constexpr result_type(min)() noexcept {
+        return 0;
+    }
+
+    static constexpr result_type(max)() noexcept {
+        return (std::numeric_limits<result_type>::max)();
+    }
+
+    LZ_CONSTEXPR_CXX_14 result_type operator()() noexcept {
+        const std::uint64_t old = _state;
+        _state = old * multiplier + _increment;
+        const auto xorShifted = static_cast<std::uint32_t>(((old >> 18u) ^ old) >> 27u);
+        const auto rotation = static_cast<std::uint32_t>(old >> 59u);
+        return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31u));
+    }
+
+    //! Advances the state by `n` steps in O(log n).
+    LZ_CONSTEXPR_CXX_14 void discard(unsigned long long n) noexcept {
+        std::uint64_t accumulatedMultiplier = 1;
+        std::uint64_t accumulatedIncrement = 0;
+        std::uint64_t currentMultiplier = multiplier;
+        std::uint64_t currentIncrement = _increment;
+        for (; n != 0; n >>= 1u) {
+            if (n & 1u) {
+                accumulatedMultiplier *= currentMultiplier;
+                accumulatedIncrement = accumulatedIncrement * currentMultiplier + currentIncrement;
+            }
+            currentIncrement = (currentMultiplier + 1) * currentIncrement;
+            currentMultiplier *= currentMultiplier;
+        }
+        _state = accumulatedMultiplier * _state + accumulatedIncrement;
+    }
+
+    LZ_NODISCARD constexpr friend bool operator==(const Pcg32& a, const Pcg32& b) noexcept {
+        return a._state == b._state && a._increment == b._increment;
+    }
+
+    LZ_NODISCARD constexpr friend bool operator!=(const Pcg32& a, const Pcg32& b) noexcept {
+        return !(a == b); // NOLINT
+    }
+};
+
+/**
+ * Returns a seed for e.g. `lz::Xoshiro256StarStar` or `lz::Pcg32`. Only the first seed on a thread comes from
+ * `std::random_device`, the next ones are drawn from a SplitMix64 generator that it seeded, so that creating many short lived
+ * generators is cheap. Every call returns a different seed.
+ */
+inline std::uint64_t randomSeed() {
+    static thread_local SplitMix64 seeds(internal::randomDeviceSeed());
+    return seeds();
+}
+
+namespace internal {
+template<class Engine>
+struct IsSmallEngine
+    : std::integral_constant<bool, std::is_same<Engine, SplitMix64>::value || std::is_same<Engine, Xoshiro256StarStar>::value ||
+                                       std::is_same<Engine, Pcg32>::value> {};
+
+template<class Engine>
+EnableIf<!IsSmallEngine<Engine>::value, Engine> createEngine() {
     std::random_device rd;
     SeedSequence<8> seedSeq(rd);
-    return std::mt19937(seedSeq);
+    return Engine(seedSeq);
+}
+
+// The state of the small engines is expanded from a single seed, so a seed sequence would only slow down their creation
+template<class Engine>
+EnableIf<IsSmallEngine<Engine>::value, Engine> createEngine() {
+    return Engine(randomSeed());
+}
+} // namespace internal
+
+/**
+ * A random number generator that draws from an `Engine` that is local to the calling thread. The engine of every thread is
+ * seeded independently, with a `SeedSequence` of 8 x `std::random_device` (or with `lz::randomSeed()` for the small engines
+ * such as `lz::Xoshiro256StarStar`), the first time it is used on that thread. The generator itself has no state, so one
+ * object (and the random views that use it) can be shared by any amount of threads without a data race or a lock. Example:
+ * ```cpp
+ * lz::ThreadLocalEngine<std::mt19937_64> gen;
+ * std::normal_distribution<> dist;
+ * auto rand = lz::random(dist, gen, 100); // Can be iterated over on different threads at the same time
+ * ```
+ */
+template<class Engine>
+class ThreadLocalEngine {
+public:
+    using result_type = typename Engine::result_type;
+
+    static constexpr result_type(min)() {
+        return (Engine::min)();
+    }
+
+    static constexpr result_type(max)() {
+        return (Engine::max)();
+    }
+
+    //! Returns the engine of the calling thread.
+    static Engine& engine() {
+        static thread_local Engine threadEngine = internal::createEngine<Engine>();
+        return threadEngine;
+    }
+
+    result_type operator()() const {
+        return engine()();
+    }
+};
+
+/**
+ * A uniform distribution that is a faster alternative to `std::uniform_int_distribution` and `std::uniform_real_distribution`,
+ * and that gives the same numbers on every platform for the same generator state, unlike the standard distributions, which
+ * are implemented differently by every standard library. Integers are drawn from [a, b] using Lemire's nearly divisionless
+ * method, which almost never needs a division or a second call to the generator. Floating point numbers are drawn from
+ * [a, b) by converting 24 (float) or 53 random bits directly. The generator must produce 32 or 64 random bits per call, such
+ * as `std::mt19937`, `lz::Pcg32` or `lz::Xoshiro256StarStar`. Example:
+ * ```cpp
+ * lz::Xoshiro256StarStar gen(1234);
+ * auto rolls = lz::random(lz::FastUniformDistribution<int>(1, 6), gen, 100); // Same rolls with MSVC, GCC and Clang
+ * ```
+ */
+template<LZ_CONCEPT_ARITHMETIC Arithmetic>
+class FastUniformDistribution {
+#    ifndef LZ_HAS_CONCEPTS
+    static_assert(std::is_arithmetic<Arithmetic>::value, "type should be arithmetic");
+#    endif // LZ_HAS_CONCEPTS
+
+    Arithmetic _a{};
+    Arithmetic _b{};
+
+public:
+    using result_type = Arithmetic;
+
+    constexpr FastUniformDistribution() = default;
+
+    LZ_CONSTEXPR_CXX_14 FastUniformDistribution(const Arithmetic a, const Arithmetic b) noexcept : _a(a), _b(b) {
+        LZ_ASSERT(a <= b, "a cannot be larger than b");
+    }
+
+    template<class Generator>
+    result_type operator()(Generator& generator) const {
+        return internal::uniformValue(std::is_integral<Arithmetic>(), generator, _a, _b);
+    }
+
+    void reset() noexcept {
+    }
+
+    LZ_NODISCARD constexpr result_type a() const noexcept {
+        return _a;
+    }
+
+    LZ_NODISCARD constexpr result_type b() const noexcept {
+        return _b;
+    }
+
+    LZ_NODISCARD constexpr result_type(min)() const noexcept {
+        return _a;
+    }
+
+    LZ_NODISCARD constexpr result_type(max)() const noexcept {
+        return _b;
+    }
+
+    LZ_NODISCARD constexpr friend bool operator==(const FastUniformDistribution& a, const FastUniformDistribution& b) noexcept {
+        return a._a == b._a && a._b == b._b;
+    }
+
+    LZ_NODISCARD constexpr friend bool operator!=(const FastUniformDistribution& a, const FastUniformDistribution& b) noexcept {
+        return !(a == b); // NOLINT
+    }
+};
+
+template<LZ_CONCEPT_ARITHMETIC Arithmetic, class Distribution, class Generator>
+class Random;
+
+namespace internal {
+template<class Integral>
+std::uniform_int_distribution<Integral>
+uniformDistribution(std::true_type /* isIntegral */, const Integral min, const Integral max) {
+    return std::uniform_int_distribution<Integral>(min, max);
+}
+
+template<class Floating>
+std::uniform_real_distribution<Floating>
+uniformDistribution(std::false_type /* isIntegral */, const Floating min, const Floating max) {
+    return std::uniform_real_distribution<Floating>(min, max);
 }
+
+template<class Arithmetic>
+using UniformDistribution =
+    decltype(uniformDistribution(std::is_integral<Arithmetic>(), std::declval<Arithmetic>(), std::declval<Arithmetic>()));
+
+template<class Arithmetic>
+using UniformRandom = EnableIf<std::is_arithmetic<Arithmetic>::value,
+                               Random<Arithmetic, UniformDistribution<Arithmetic>, ThreadLocalEngine<std::mt19937>>>;
 } // namespace internal
 
 template<LZ_CONCEPT_ARITHMETIC Arithmetic, class Distribution, class Generator>
@@ -126,9 +511,8 @@ public:
     using const_iterator = iterator;
     using value_type = typename iterator::value_type;
 
-    Random(const Distribution& distribution, Generator& generator, const std::ptrdiff_t amount, const bool isWhileTrueLoop) :
-        internal::BasicIteratorView<iterator>(iterator(distribution, generator, 0, isWhileTrueLoop),
-                                              iterator(distribution, generator, amount, isWhileTrueLoop)) {
+    Random(const Distribution& distribution, Generator& generator, const std::ptrdiff_t amount) :
+        internal::BasicIteratorView<iterator>(iterator(distribution, generator, 0), iterator(distribution, generator, amount)) {
     }
 
     Random() = default;
@@ -147,6 +531,33 @@ public:
         return *this->begin();
     }
 
+    /**
+     * Writes distance(`first`, `last`) new random numbers to [`first`, `last`), using the distribution and generator of the
+     * view, regardless of the amount of numbers in the view. Example:
+     * ```cpp
+     * std::vector<double> samples(1024);
+     * lz::random(0., 1.).fillTo(samples.begin(), samples.end());
+     * ```
+     * @param first The start of the range to write to.
+     * @param last The end of the range to write to.
+     */
+    template<class Iterator>
+    void fillTo(Iterator first, const Iterator last) const {
+        auto generator = this->begin();
+        for (; first != last; ++first) {
+            *first = generator();
+        }
+    }
+
+    /**
+     * Writes `size(range)` new random numbers to `range`, e.g. a `std::vector` or `std::span`. See `fillTo(Iterator, Iterator)`.
+     * @param range The range to write to.
+     */
+    template<class Range>
+    void fillTo(Range&& range) const {
+        fillTo(std::begin(range), std::end(range));
+    }
+
     /**
      * Gets the minimum random value.
      * @return The min value
@@ -178,90 +589,56 @@ public:
  */
 template<class Generator, class Distribution>
 LZ_NODISCARD Random<typename Distribution::result_type, Distribution, Generator>
-random(const Distribution& distribution, Generator& generator,
-       const std::size_t amount = (std::numeric_limits<std::size_t>::max)()) {
-    return { distribution, generator, static_cast<std::ptrdiff_t>(amount), amount == (std::numeric_limits<std::size_t>::max)() };
+random(const Distribution& distribution, Generator& generator, const std::size_t amount) {
+    return { distribution, generator, static_cast<std::ptrdiff_t>(amount) };
 }
 
-#    ifdef __cpp_if_constexpr
 /**
- * @brief Returns an iterator view object that generates a sequence of random numbers, using an uniform distribution.
- * @details This random access iterator view object can be used to generate a sequence of random numbers between
- * [`min, max`]. It uses the std::mt19937 random engine and a seed sequence of 8 x `std::random_device` as seed. The
- * seed sequence is a custom implementation of `std::seed_seq`. Internally, it uses a `std::array` instead of a `std::vector` and
- * tends to be more faster than its `std::seed_seq` implementation.
- * @param min The minimum value, included.
- * @param max The maximum value, included.
- * @tparam Distribution The distribution for generating the random numbers. `std::uniform_int_distribution` by default.
- * @tparam Generator The random number generator. `std::mt19937` by default.
- * @param amount The amount of numbers to create. If left empty or equal to `std::numeric_limits<std::size_t>::max()`
- * it is interpreted as a `while-true` loop.
- * @return A random view object that generates a sequence of random numbers
+ * Creates a random number generator with specified generator and distribution, that never stops and is interpreted as a
+ * `while-true` loop.
+ * @param distribution A number distribution, for e.g. std::uniform_<type>_distribution<type>.
+ * @param generator A random number generator, for e.g. std::mt19937.
+ * @return A random view object that generates a sequence of `Generator::result_type`
  */
-template<LZ_CONCEPT_ARITHMETIC Arithmetic>
-LZ_NODISCARD auto
-random(const Arithmetic min, const Arithmetic max, const std::size_t amount = (std::numeric_limits<std::size_t>::max)()) {
-#        ifndef LZ_HAS_CONCEPTS
-    static_assert(std::is_arithmetic_v<Arithmetic>, "min/max type should be arithmetic");
-#        endif // LZ_HAS_CONCEPTS
-    static std::mt19937 gen = internal::createMtEngine();
-    if constexpr (std::is_integral_v<Arithmetic>) {
-        std::uniform_int_distribution<Arithmetic> dist(min, max);
-        return random(dist, gen, amount);
-    }
-    else {
-        std::uniform_real_distribution<Arithmetic> dist(min, max);
-        return random(dist, gen, amount);
-    }
+template<class Generator, class Distribution>
+LZ_NODISCARD Random<typename Distribution::result_type, Distribution, Generator>
+random(const Distribution& distribution, Generator& generator) {
+    return { distribution, generator, (std::numeric_limits<std::ptrdiff_t>::max)() };
 }
-#    else
+
 /**
  * @brief Returns an iterator view object that generates a sequence of random numbers, using an uniform distribution.
  * @details This random access iterator view object can be used to generate a sequence of random numbers between
- * [`min, max`]. It uses the std::mt19937 random engine and a seed sequence of 8 x `std::random_device` as seed. The
- * seed sequence is a custom implementation of `std::seed_seq`. Internally, it uses a `std::array` instead of a `std::vector` and
- * tends to be more faster than its `std::seed_seq` implementation.
- * @param min The minimum value , included.
+ * [`min, max`]. It uses a std::mt19937 random engine per thread (see `lz::ThreadLocalEngine`), that is seeded with a seed
+ * sequence of 8 x `std::random_device`, so it is safe to use from multiple threads at the same time. The seed sequence is a
+ * custom implementation of `std::seed_seq`. Internally, it uses a `std::array` instead of a `std::vector` and tends to be more
+ * faster than its `std::seed_seq` implementation. Integers are drawn using `std::uniform_int_distribution`, floating point
+ * numbers using `std::uniform_real_distribution`.
+ * @param min The minimum value, included.
  * @param max The maximum value, included.
- * @tparam Distribution The distribution for generating the random numbers. `std::uniform_int_distribution` by default.
- * @tparam Generator The random number generator. `std::mt19937` by default.
- * @param amount The amount of numbers to create. If left empty or equal to `std::numeric_limits<std::size_t>::max()`
- * it is interpreted as a `while-true` loop.
+ * @param amount The amount of numbers to create.
  * @return A random view object that generates a sequence of random numbers
  */
-template<class Integral>
-LZ_NODISCARD
-internal::EnableIf<std::is_integral<Integral>::value, Random<Integral, std::uniform_int_distribution<Integral>, std::mt19937>>
-random(const Integral min, const Integral max, const std::size_t amount = (std::numeric_limits<std::size_t>::max)()) {
-    static std::mt19937 gen = internal::createMtEngine();
-    std::uniform_int_distribution<Integral> dist(min, max);
-    return random(dist, gen, amount);
+template<LZ_CONCEPT_ARITHMETIC Arithmetic>
+LZ_NODISCARD internal::UniformRandom<Arithmetic>
+random(const Arithmetic min, const Arithmetic max, const std::size_t amount) {
+    static ThreadLocalEngine<std::mt19937> gen;
+    return random(internal::uniformDistribution(std::is_integral<Arithmetic>(), min, max), gen, amount);
 }
 
 /**
- * @brief Returns an output view object that generates a sequence of floating point doubles, using a uniform
- * distribution.
- * @details This random access iterator view object can be used to generate a sequence of random doubles between
- * [`min, max`]. It uses the std::mt19937 random engine and a seed of `std::random_device` as seed.
- * @tparam Distribution The distribution for generating the random numbers. `std::uniform_real_distribution` by default.
- * @tparam Generator The random number generator. `std::mt19937` by default.
+ * @brief Returns an iterator view object that generates random numbers between [`min, max`] forever, using an uniform
+ * distribution. It is interpreted as a `while-true` loop. See `lz::random(Arithmetic, Arithmetic, std::size_t)`.
  * @param min The minimum value, included.
  * @param max The maximum value, included.
- * @param amount The amount of numbers to create. If left empty or equal to `std::numeric_limits<std::size_t>::max()`
- * it is interpreted as a `while-true` loop.
- * @return A random view object that generates a sequence of random floating point values.
+ * @return A random view object that generates a sequence of random numbers
  */
-template<class Floating>
-LZ_NODISCARD internal::EnableIf<std::is_floating_point<Floating>::value,
-                                Random<Floating, std::uniform_real_distribution<Floating>, std::mt19937>>
-random(const Floating min, const Floating max, const std::size_t amount = (std::numeric_limits<std::size_t>::max)()) {
-    static std::mt19937 gen = internal::createMtEngine();
-    std::uniform_real_distribution<Floating> dist(min, max);
-    return random(dist, gen, amount);
+template<LZ_CONCEPT_ARITHMETIC Arithmetic>
+LZ_NODISCARD internal::UniformRandom<Arithmetic> random(const Arithmetic min, const Arithmetic max) {
+    static ThreadLocalEngine<std::mt19937> gen;
+    return random(internal::uniformDistribution(std::is_integral<Arithmetic>(), min, max), gen);
 }
 
-#    endif // __cpp_if_constexpr
-
 // End of group
 /**
  * @}
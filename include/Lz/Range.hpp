@@ -20,12 +20,24 @@ private:
 
 public:
     constexpr Range(const Arithmetic start, const Arithmetic end, const Arithmetic step) noexcept :
-        Base(iterator(start, step), iterator(end, step)) {
+        Base(iterator(start, step, 0),
+             iterator(start, step, internal::rangeLength(std::is_integral<Arithmetic>(), start, end, step))) {
+    }
+
+    constexpr Range(const iterator begin, const iterator end) noexcept : Base(begin, end) {
     }
 
     constexpr Range() = default;
 };
 
+namespace internal {
+template<class Arithmetic>
+constexpr Range<Arithmetic> countedRange(const Arithmetic start, const Arithmetic step, const std::size_t count) noexcept {
+    return { RangeIterator<Arithmetic>(start, step, 0),
+             RangeIterator<Arithmetic>(start, step, static_cast<std::ptrdiff_t>(count)) };
+}
+} // namespace internal
+
 // Start of group
 /**
  * @addtogroup ItFns
@@ -35,7 +47,8 @@ public:
 /**
  * @brief Returns a random access range object with specified [start, end) and a step.
  * @details E.g. `lz::range(3, 20, 2)` will return all values between [3, 20) with a step of 2 when iterating over
- * its iterator.
+ * its iterator. The i-th value is computed as `start + i * step`, so floating point ranges don't accumulate rounding errors, and
+ * the range can be split at any index in O(1), e.g. over threads.
  * @tparam Arithmetic Int is automatically assumed, may be any arithmetic type.
  * @param end Specifies when to stop iterator after `end` count. It is assumed from [start, end) with a step.
  * @param step The incrementing value after each loop.
@@ -64,6 +77,23 @@ LZ_NODISCARD constexpr Range<Arithmetic> range(const Arithmetic end) noexcept {
     return range<Arithmetic>(0, end, 1);
 }
 
+/**
+ * @brief Returns `count` evenly spaced values from `start` up to and including `stop`, as a random access range.
+ * @details E.g. `lz::linspace(0., 1., 5)` returns 0, 0.25, 0.5, 0.75 and 1. The i-th value is computed as
+ * `start + i * step`, with `step = (stop - start) / (count - 1)`, so the last value may differ from `stop` by a rounding error.
+ * @tparam Floating The floating point type of the values.
+ * @param start The first value.
+ * @param stop The last value.
+ * @param count The amount of values. If it is 1, the only value is `start`.
+ * @return A Range object that can be converted to an arbitrary container or can be iterated over using
+ * `for (auto... lz::linspace(...))`.
+ */
+template<class Floating>
+LZ_NODISCARD constexpr Range<Floating> linspace(const Floating start, const Floating stop, const std::size_t count) noexcept {
+    static_assert(std::is_floating_point<Floating>::value, "type must be of type floating point");
+    return internal::countedRange(start, count > 1 ? (stop - start) / static_cast<Floating>(count - 1) : Floating{}, count);
+}
+
 // End of group
 /**
  * @}
@@ -0,0 +1,105 @@
+#pragma once
+
+#ifndef LZ_RECORD_READER_HPP
+#define LZ_RECORD_READER_HPP
+
+#include "detail/BasicIteratorView.hpp"
+#include "detail/RecordReaderIterator.hpp"
+
+namespace lz {
+template<class Source, class SubString>
+class RecordReader final : public internal::BasicIteratorView<internal::RecordReaderIterator<Source, SubString>> {
+public:
+    using iterator = internal::RecordReaderIterator<Source, SubString>;
+    using const_iterator = iterator;
+    using value_type = SubString;
+
+    RecordReader(Source source, const char separator, const std::size_t blockSize) :
+        internal::BasicIteratorView<iterator>(
+            iterator(std::make_shared<internal::RecordBuffer<Source>>(std::move(source), separator, blockSize)), iterator()) {
+    }
+
+    RecordReader() = default;
+};
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Reads `stream` in blocks of `blockSize` bytes and returns the records in it, separated by `separator`. Unlike
+ * `std::istream_iterator`, the stream is not read character by character, and records are returned as views into the block that
+ * was read, so they are only copied if they span two blocks. A trailing separator does not start an empty record. The view is an
+ * input view: a record is only valid until the iterator is incremented, and the records can only be iterated over once. Use
+ * `std::string` as `SubString` to keep them.
+ * @tparam SubString The string type of the records. If C++17, this will default to `std::string_view`. If `LZ_STANDALONE` is
+ * not defined and C++17 is not defined, this will default to `std::string`. Otherwise it will default to `fmt::string_view`.
+ * @param stream The stream to read.
+ * @param separator The character that separates the records.
+ * @param blockSize The amount of bytes to read at once. The buffer grows if a single record is larger than this.
+ * @return A RecordReader object that can be iterated over using `for (auto... lz::readRecords(...))`.
+ */
+template<class SubString = StringView>
+LZ_NODISCARD RecordReader<internal::StreamSource, SubString>
+readRecords(std::istream& stream, const char separator = '\n', const std::size_t blockSize = internal::defaultReadBlockSize) {
+    return { internal::StreamSource{ &stream }, separator, blockSize };
+}
+
+/**
+ * @brief Reads the file descriptor `fileDescriptor` (e.g. a pipe or socket) in blocks of `blockSize` bytes and returns the
+ * records in it, separated by `separator`. Records are returned as views into the block that was read, so they are only copied
+ * if they span two blocks. A trailing separator does not start an empty record. The view is an input view: a record is only
+ * valid until the iterator is incremented, and the records can only be iterated over once. Use `std::string` as `SubString` to
+ * keep them. The file descriptor is not closed.
+ * @tparam SubString The string type of the records. If C++17, this will default to `std::string_view`. If `LZ_STANDALONE` is
+ * not defined and C++17 is not defined, this will default to `std::string`. Otherwise it will default to `fmt::string_view`.
+ * @param fileDescriptor The file descriptor to read.
+ * @param separator The character that separates the records.
+ * @param blockSize The amount of bytes to read at once. The buffer grows if a single record is larger than this.
+ * @return A RecordReader object that can be iterated over using `for (auto... lz::readRecords(...))`.
+ * @throws `std::system_error` when iterating, if reading fails.
+ */
+template<class SubString = StringView>
+LZ_NODISCARD RecordReader<internal::FileDescriptorSource, SubString>
+readRecords(const int fileDescriptor, const char separator = '\n', const std::size_t blockSize = internal::defaultReadBlockSize) {
+    return { internal::FileDescriptorSource{ fileDescriptor }, separator, blockSize };
+}
+
+#ifndef _WIN32
+/**
+ * @brief Reads the file `fileDescriptor` in blocks of `blockSize` bytes like `lz::readRecords`, but keeps `queueDepth` reads in
+ * flight at the same time, so that a device that works best with several outstanding requests, e.g. an NVMe drive with a cold
+ * page cache, keeps reading the next blocks while the records of the current block are processed. On Linux, the reads are
+ * submitted using io_uring. If io_uring is not available, or the file descriptor is not seekable (e.g. a pipe), one block is read
+ * at a time. The file is read from the current offset of the file descriptor, which is not changed. The file descriptor is not
+ * closed. Example:
+ * ```cpp
+ * int fd = ::open("big.csv", O_RDONLY);
+ * for (auto line : lz::readRecordsAsync(fd, '\n', 1 << 20, 8)) { ... }
+ * ```
+ * @tparam SubString The string type of the records. If C++17, this will default to `std::string_view`. If `LZ_STANDALONE` is
+ * not defined and C++17 is not defined, this will default to `std::string`. Otherwise it will default to `fmt::string_view`.
+ * @param fileDescriptor The file descriptor to read.
+ * @param separator The character that separates the records.
+ * @param blockSize The amount of bytes of every read. The buffer grows if a single record is larger than this.
+ * @param queueDepth The amount of reads that are in flight at the same time.
+ * @return A RecordReader object that can be iterated over using `for (auto... lz::readRecordsAsync(...))`.
+ * @throws `std::system_error` when iterating, if reading fails.
+ */
+template<class SubString = StringView>
+LZ_NODISCARD RecordReader<internal::ReadAheadSource, SubString>
+readRecordsAsync(const int fileDescriptor, const char separator = '\n',
+                 const std::size_t blockSize = internal::defaultReadBlockSize, const std::size_t queueDepth = 4) {
+    return { internal::ReadAheadSource{ fileDescriptor, blockSize, queueDepth }, separator, blockSize };
+}
+#endif // _WIN32
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_RECORD_READER_HPP
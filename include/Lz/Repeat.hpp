@@ -15,7 +15,7 @@ public:
     using value_type = T;
 
     constexpr Repeat(T toRepeat, const std::size_t amount) :
-        internal::BasicIteratorView<iterator>(iterator(toRepeat, 0, amount), iterator(toRepeat, amount, amount)) {
+        internal::BasicIteratorView<iterator>(iterator(toRepeat, 0), iterator(toRepeat, amount)) {
     }
 
     constexpr Repeat() = default;
@@ -28,18 +28,26 @@ public:
  */
 
 /**
- * @brief Returns `toRepeat`, `amount` of times. If amount is left empty, it never stops and is interpreted as a
- * `while-true` loop.
+ * @brief Returns `toRepeat`, `amount` of times.
  * @param toRepeat The value to repeat `amount` times.
  * @param amount The amount of times to repeat the loop, returning `toRepeat`.
  * @return A repeat object, containing the random access iterator.
  */
 template<class T>
-LZ_NODISCARD constexpr Repeat<internal::Decay<T>>
-repeat(T&& toRepeat, const std::size_t amount = (std::numeric_limits<std::size_t>::max)()) {
+LZ_NODISCARD constexpr Repeat<internal::Decay<T>> repeat(T&& toRepeat, const std::size_t amount) {
     return { std::forward<T>(toRepeat), amount };
 }
 
+/**
+ * @brief Returns `toRepeat` forever, which is interpreted as a `while-true` loop.
+ * @param toRepeat The value to repeat.
+ * @return A repeat object, containing the random access iterator.
+ */
+template<class T>
+LZ_NODISCARD constexpr Repeat<internal::Decay<T>> repeat(T&& toRepeat) {
+    return { std::forward<T>(toRepeat), static_cast<std::size_t>((std::numeric_limits<std::ptrdiff_t>::max)()) };
+}
+
 // End of group
 /**
  * @}
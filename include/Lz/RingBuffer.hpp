@@ -0,0 +1,313 @@
+#pragma once
+
+#ifndef LZ_RING_BUFFER_HPP
+#    define LZ_RING_BUFFER_HPP
+
+#    include "Concatenate.hpp"
+#    include "detail/LzTools.hpp"
+
+#    include <algorithm>
+#    include <atomic>
+#    include <cstdint>
+#    include <memory>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+inline std::size_t roundUpToPowerOfTwo(const std::size_t value) noexcept {
+    std::size_t power = 1;
+    while (power < value) {
+        power *= 2;
+    }
+    return power;
+}
+} // namespace internal
+
+/**
+ * A lock free ring buffer for one producer thread and one consumer thread. Instead of copying elements out of the buffer, the
+ * consumer can use the pending elements as a view, `readable()`, over which all adaptors such as `lz::map` and `lz::chunks`
+ * can run directly, after which it releases them in bulk with `consume(n)`. The view consists of at most two contiguous
+ * segments, the part up to the end of the storage and the part that wrapped around, which algorithms iterate over as two plain
+ * loops. The producer can likewise fill `writable()` and publish it with `produce(n)`. Example:
+ * ```cpp
+ * lz::SpscRingBuffer<Tick> ring(4096);
+ * // producer
+ * ring.tryPush(tick);
+ * // consumer
+ * auto pending = ring.readable();
+ * process(lz::filter(pending, isTrade));
+ * ring.consume(pending.size());
+ * ```
+ * @tparam T The element type, which must be default constructible.
+ */
+template<class T>
+class SpscRingBuffer {
+public:
+    //! The view of a region of the buffer, two segments of contiguous memory.
+    using Segments = Concatenate<T*, T*>;
+
+private:
+    std::vector<T> _buffer;
+    std::size_t _mask{};
+    // The consumer writes the head, the producer writes the tail. Both only ever grow and wrap around at 2^64. They are kept on
+    // separate cache lines, so that they don't invalidate each other
+    alignas(internal::cacheLineSize) std::atomic<std::size_t> _head{ 0 };
+    std::size_t _cachedTail{ 0 };
+    alignas(internal::cacheLineSize) std::atomic<std::size_t> _tail{ 0 };
+    std::size_t _cachedHead{ 0 };
+
+    Segments segments(const std::size_t from, const std::size_t count) {
+        T* data = _buffer.data();
+        const std::size_t first = from & _mask;
+        const std::size_t firstLength = (std::min)(count, _buffer.size() - first);
+        return concatRange(std::make_tuple(data + first, data),
+                           std::make_tuple(data + first + firstLength, data + (count - firstLength)));
+    }
+
+public:
+    /**
+     * Creates an empty ring buffer.
+     * @param capacity The minimum amount of elements the buffer can hold, which is rounded up to a power of two.
+     */
+    explicit SpscRingBuffer(const std::size_t capacity) :
+        _buffer(internal::roundUpToPowerOfTwo(capacity)),
+        _mask(_buffer.size() - 1) {
+    }
+
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+    //! The amount of elements the buffer can hold.
+    LZ_NODISCARD std::size_t capacity() const noexcept {
+        return _buffer.size();
+    }
+
+    /**
+     * The amount of pending elements. May be called from any thread: it is exact when called by the producer or the consumer,
+     * and a snapshot between 0 and `capacity()` otherwise. The consumer index is loaded first, so a newer producer index can
+     * only make the difference larger, never wrap it around.
+     */
+    LZ_NODISCARD std::size_t size() const noexcept {
+        const std::size_t head = _head.load(std::memory_order_acquire);
+        const std::size_t tail = _tail.load(std::memory_order_acquire);
+        return (std::min)(tail - head, _buffer.size());
+    }
+
+    LZ_NODISCARD bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /**
+     * Adds an element, from the producer thread.
+     * @param value The element.
+     * @return Whether the element was added, false if the buffer is full.
+     */
+    bool tryPush(T value) {
+        const std::size_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail - _cachedHead == _buffer.size()) {
+            _cachedHead = _head.load(std::memory_order_acquire);
+            if (tail - _cachedHead == _buffer.size()) {
+                return false;
+            }
+        }
+        _buffer[tail & _mask] = std::move(value);
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Adds as many elements of [begin, end) as fit, from the producer thread, and publishes them at once.
+     * @param begin The beginning of the elements.
+     * @param end The ending of the elements.
+     * @return The iterator to the first element that didn't fit.
+     */
+    template<LZ_CONCEPT_ITERATOR Iterator>
+    Iterator tryPushRange(Iterator begin, const Iterator end) {
+        Segments free = writable();
+        std::size_t count = 0;
+        for (auto it = free.begin(); it != free.end() && begin != end; ++it, ++begin, ++count) {
+            *it = *begin;
+        }
+        produce(count);
+        return begin;
+    }
+
+    /**
+     * The free region of the buffer, from the producer thread. Elements that are assigned to it are published by `produce`.
+     * @return A view of the free region, in the order in which the elements are read.
+     */
+    LZ_NODISCARD Segments writable() {
+        const std::size_t tail = _tail.load(std::memory_order_relaxed);
+        _cachedHead = _head.load(std::memory_order_acquire);
+        return segments(tail, _buffer.size() - (tail - _cachedHead));
+    }
+
+    /**
+     * Publishes the first `count` elements of `writable()` to the consumer, from the producer thread.
+     * @param count The amount of elements, at most the size of `writable()`.
+     */
+    void produce(const std::size_t count) {
+        const std::size_t tail = _tail.load(std::memory_order_relaxed);
+        LZ_ASSERT(tail + count - _head.load(std::memory_order_acquire) <= _buffer.size(), "cannot produce more than is free");
+        _tail.store(tail + count, std::memory_order_release);
+    }
+
+    /**
+     * Removes the oldest element, from the consumer thread.
+     * @param value The element is moved into this, if there is one.
+     * @return Whether there was an element.
+     */
+    bool tryPop(T& value) {
+        const std::size_t head = _head.load(std::memory_order_relaxed);
+        if (head == _cachedTail) {
+            _cachedTail = _tail.load(std::memory_order_acquire);
+            if (head == _cachedTail) {
+                return false;
+            }
+        }
+        value = std::move(_buffer[head & _mask]);
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * The pending elements, from the consumer thread, without copying them. Elements that the producer adds afterwards are not
+     * part of the view. The view stays valid until the elements are consumed.
+     * @return A view of the pending elements, oldest first.
+     */
+    LZ_NODISCARD Segments readable() {
+        const std::size_t head = _head.load(std::memory_order_relaxed);
+        _cachedTail = _tail.load(std::memory_order_acquire);
+        return segments(head, _cachedTail - head);
+    }
+
+    /**
+     * Releases the oldest `count` elements to the producer, from the consumer thread.
+     * @param count The amount of elements, at most the size of `readable()`.
+     */
+    void consume(const std::size_t count) {
+        const std::size_t head = _head.load(std::memory_order_relaxed);
+        LZ_ASSERT(count <= _tail.load(std::memory_order_acquire) - head, "cannot consume more than is pending");
+        _head.store(head + count, std::memory_order_release);
+    }
+};
+
+/**
+ * A bounded lock free queue for any amount of producer and consumer threads (Vyukov's bounded MPMC queue). Every slot has a
+ * sequence number that tells whether it's free or filled for the current lap, so that threads only contend on the index they
+ * increment. As several consumers take elements at once, there is no view of the pending elements; see `lz::SpscRingBuffer`
+ * for that.
+ * @tparam T The element type, which must be default constructible.
+ */
+template<class T>
+class MpmcQueue {
+    struct Slot {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Slot[]> _slots;
+    std::size_t _mask{};
+    alignas(internal::cacheLineSize) std::atomic<std::size_t> _enqueuePosition{ 0 };
+    alignas(internal::cacheLineSize) std::atomic<std::size_t> _dequeuePosition{ 0 };
+
+    static std::ptrdiff_t difference(const std::size_t a, const std::size_t b) noexcept {
+        return static_cast<std::ptrdiff_t>(a - b);
+    }
+
+public:
+    /**
+     * Creates an empty queue.
+     * @param capacity The minimum amount of elements the queue can hold, which is rounded up to a power of two.
+     */
+    explicit MpmcQueue(const std::size_t capacity) :
+        _slots(new Slot[internal::roundUpToPowerOfTwo(capacity)]),
+        _mask(internal::roundUpToPowerOfTwo(capacity) - 1) {
+        for (std::size_t i = 0; i <= _mask; ++i) {
+            _slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    //! The amount of elements the queue can hold.
+    LZ_NODISCARD std::size_t capacity() const noexcept {
+        return _mask + 1;
+    }
+
+    /**
+     * Adds an element.
+     * @param value The element.
+     * @return Whether the element was added, false if the queue is full.
+     */
+    bool tryPush(T value) {
+        std::size_t position = _enqueuePosition.load(std::memory_order_relaxed);
+        Slot* slot;
+        while (true) {
+            slot = &_slots[position & _mask];
+            const std::ptrdiff_t lap = difference(slot->sequence.load(std::memory_order_acquire), position);
+            if (lap == 0) {
+                if (_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (lap < 0) {
+                return false;
+            }
+            else {
+                position = _enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        slot->value = std::move(value);
+        slot->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Removes the oldest element.
+     * @param value The element is moved into this, if there is one.
+     * @return Whether there was an element.
+     */
+    bool tryPop(T& value) {
+        std::size_t position = _dequeuePosition.load(std::memory_order_relaxed);
+        Slot* slot;
+        while (true) {
+            slot = &_slots[position & _mask];
+            const std::ptrdiff_t lap = difference(slot->sequence.load(std::memory_order_acquire), position + 1);
+            if (lap == 0) {
+                if (_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (lap < 0) {
+                return false;
+            }
+            else {
+                position = _dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        value = std::move(slot->value);
+        slot->sequence.store(position + _mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Removes up to `count` elements and writes them to `out`, oldest first.
+     * @param out The output iterator.
+     * @param count The maximum amount of elements to remove.
+     * @return The amount of elements that were removed.
+     */
+    template<class OutputIterator>
+    std::size_t tryPopInto(OutputIterator out, const std::size_t count) {
+        std::size_t popped = 0;
+        T value;
+        for (; popped != count && tryPop(value); ++popped, ++out) {
+            *out = std::move(value);
+        }
+        return popped;
+    }
+};
+} // namespace lz
+
+#endif // LZ_RING_BUFFER_HPP
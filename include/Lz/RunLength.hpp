@@ -0,0 +1,121 @@
+#pragma once
+
+#ifndef LZ_RUN_LENGTH_HPP
+#    define LZ_RUN_LENGTH_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/RunLengthIterator.hpp"
+
+namespace lz {
+template<LZ_CONCEPT_ITERATOR Iterator, class Comparer>
+class Rle final : public internal::BasicIteratorView<internal::RleIterator<Iterator, Comparer>> {
+public:
+    using iterator = internal::RleIterator<Iterator, Comparer>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    LZ_CONSTEXPR_CXX_20 Rle(Iterator begin, Iterator end, Comparer comparer) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(begin), end, comparer), iterator(end, end, comparer)) {
+    }
+
+    constexpr Rle() = default;
+};
+
+template<LZ_CONCEPT_ITERATOR Iterator>
+class Unrle final : public internal::BasicIteratorView<internal::UnrleIterator<Iterator>> {
+public:
+    using iterator = internal::UnrleIterator<Iterator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    LZ_CONSTEXPR_CXX_20 Unrle(Iterator begin, Iterator end) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(begin), end), iterator(end, end)) {
+    }
+
+    constexpr Unrle() = default;
+};
+
+namespace internal {
+#    ifdef LZ_HAS_CXX_11
+template<class Iterator>
+using RleEqual = std::equal_to<ValueType<Iterator>>;
+#    else
+template<class>
+using RleEqual = std::equal_to<>;
+#    endif // LZ_HAS_CXX_11
+} // namespace internal
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Run-length encodes [begin, end): every run of consecutive equal elements is yielded as a `std::pair` of the first element of
+ * the run and the length of the run, as a `std::size_t`. Unlike `lz::groupBy`, the length is counted while searching for the
+ * end of the run, so no `std::distance` per run is needed. Example:
+ * ```cpp
+ * std::vector<char> status = { 'a', 'a', 'a', 'b', 'c', 'c' };
+ * auto runs = lz::rle(status); // {('a', 3), ('b', 1), ('c', 2)}
+ * ```
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param comparer Whether an element belongs to the run of the element that is passed as second argument. `==` by default.
+ * @return A forward view of (value, length) pairs.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Comparer = internal::RleEqual<Iterator>>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Rle<Iterator, Comparer> rleRange(Iterator begin, Iterator end, Comparer comparer = {}) {
+    return { std::move(begin), std::move(end), std::move(comparer) };
+}
+
+/**
+ * Run-length encodes `iterable`: every run of consecutive equal elements is yielded as a `std::pair` of the first element of
+ * the run and the length of the run, as a `std::size_t`. See `lz::rleRange`.
+ * @param iterable The sequence to encode.
+ * @param comparer Whether an element belongs to the run of the element that is passed as second argument. `==` by default.
+ * @return A forward view of (value, length) pairs.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Comparer = internal::RleEqual<internal::IterTypeFromIterable<Iterable>>>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Rle<internal::IterTypeFromIterable<Iterable>, Comparer>
+rle(Iterable&& iterable, Comparer comparer = {}) {
+    return rleRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                    std::move(comparer));
+}
+
+/**
+ * Expands a run-length encoded sequence lazily: for every (value, count) pair or tuple of [begin, end), `value` is yielded
+ * `count` times. This is the inverse of `lz::rle`. Every run is a segment of one repeated value, so copying the view, with
+ * e.g. `copyTo` or `toVector`, fills every run at once, which is a `memset` for bytes, rather than copying element by element.
+ * Example:
+ * ```cpp
+ * std::vector<std::pair<char, int>> runs = { { 'a', 3 }, { 'b', 1 } };
+ * auto status = lz::unrle(runs); // {'a', 'a', 'a', 'b'}
+ * ```
+ * @param begin The beginning of the runs.
+ * @param end The ending of the runs.
+ * @return A forward view of the expanded values.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Unrle<Iterator> unrleRange(Iterator begin, Iterator end) {
+    return { std::move(begin), std::move(end) };
+}
+
+/**
+ * Expands a run-length encoded sequence lazily: for every (value, count) pair or tuple of `iterable`, `value` is yielded
+ * `count` times. See `lz::unrleRange`.
+ * @param iterable The runs, for e.g. a container of `std::pair<T, std::size_t>` or an `lz::rle` view.
+ * @return A forward view of the expanded values.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Unrle<internal::IterTypeFromIterable<Iterable>> unrle(Iterable&& iterable) {
+    return unrleRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)));
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_RUN_LENGTH_HPP
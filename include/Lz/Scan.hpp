@@ -0,0 +1,169 @@
+#pragma once
+
+#ifndef LZ_SCAN_HPP
+#    define LZ_SCAN_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/ScanIterator.hpp"
+
+#    include <functional>
+
+namespace lz {
+template<LZ_CONCEPT_ITERATOR Iterator, class T, class BinaryOp, bool IsInclusive>
+class Scan final : public internal::BasicIteratorView<internal::ScanIterator<Iterator, T, BinaryOp, IsInclusive>> {
+public:
+    using iterator = internal::ScanIterator<Iterator, T, BinaryOp, IsInclusive>;
+    using const_iterator = iterator;
+    using value_type = T;
+
+    LZ_CONSTEXPR_CXX_20 Scan(Iterator begin, Iterator end, T init, BinaryOp binaryOp) :
+        internal::BasicIteratorView<iterator>(iterator(begin, end, init, binaryOp), iterator(end, end, init, binaryOp)) {
+    }
+
+    constexpr Scan() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Returns a view of the running reductions of [begin, end): the first element is `*begin`, every next element is
+ * `binaryOp(previous, element)`. With the default `binaryOp`, these are the cumulative sums. Example:
+ * ```cpp
+ * std::vector<int> v = { 1, 2, 3, 4 };
+ * auto sums = lz::inclusiveScan(v); // { 1, 3, 6, 10 }
+ * ```
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param binaryOp The reduction.
+ * @return A Scan iterator view object.
+ */
+#    ifdef LZ_HAS_CXX_11
+template<LZ_CONCEPT_ITERATOR Iterator, class BinaryOp = std::plus<internal::Decay<internal::ValueType<Iterator>>>>
+#    else
+template<LZ_CONCEPT_ITERATOR Iterator, class BinaryOp = std::plus<>>
+#    endif // LZ_HAS_CXX_11
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Scan<Iterator, internal::Decay<internal::ValueType<Iterator>>, BinaryOp, true>
+inclusiveScanRange(Iterator begin, Iterator end, BinaryOp binaryOp = {}) {
+    return { std::move(begin), std::move(end), internal::Decay<internal::ValueType<Iterator>>(), std::move(binaryOp) };
+}
+
+/**
+ * Returns a view of the running reductions of `iterable`: the first element is its first element, every next element is
+ * `binaryOp(previous, element)`. With the default `binaryOp`, these are the cumulative sums.
+ * @param iterable The sequence to scan.
+ * @param binaryOp The reduction.
+ * @return A Scan iterator view object.
+ */
+#    ifdef LZ_HAS_CXX_11
+template<LZ_CONCEPT_ITERABLE Iterable, class BinaryOp = std::plus<internal::Decay<internal::ValueTypeIterable<Iterable>>>,
+         class Iterator = internal::IterTypeFromIterable<Iterable>>
+#    else
+template<LZ_CONCEPT_ITERABLE Iterable, class BinaryOp = std::plus<>, class Iterator = internal::IterTypeFromIterable<Iterable>>
+#    endif // LZ_HAS_CXX_11
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Scan<Iterator, internal::Decay<internal::ValueType<Iterator>>, BinaryOp, true>
+inclusiveScan(Iterable&& iterable, BinaryOp binaryOp = {}) {
+    return inclusiveScanRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                              std::move(binaryOp));
+}
+
+/**
+ * Returns a view of the running reductions of [begin, end), that excludes the current element: the first element is `init`,
+ * every next element is `binaryOp(previous, previous element)`. The view has as many elements as [begin, end). Example:
+ * ```cpp
+ * std::vector<int> sizes = { 3, 1, 2 };
+ * auto offsets = lz::exclusiveScan(sizes, 0); // { 0, 3, 4 }
+ * ```
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param init The first element.
+ * @param binaryOp The reduction.
+ * @return A Scan iterator view object.
+ */
+#    ifdef LZ_HAS_CXX_11
+template<LZ_CONCEPT_ITERATOR Iterator, class T, class BinaryOp = std::plus<T>>
+#    else
+template<LZ_CONCEPT_ITERATOR Iterator, class T, class BinaryOp = std::plus<>>
+#    endif // LZ_HAS_CXX_11
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Scan<Iterator, T, BinaryOp, false>
+exclusiveScanRange(Iterator begin, Iterator end, T init, BinaryOp binaryOp = {}) {
+    return { std::move(begin), std::move(end), std::move(init), std::move(binaryOp) };
+}
+
+/**
+ * Returns a view of the running reductions of `iterable`, that excludes the current element: the first element is `init`,
+ * every next element is `binaryOp(previous, previous element)`. The view has as many elements as `iterable`.
+ * @param iterable The sequence to scan.
+ * @param init The first element.
+ * @param binaryOp The reduction.
+ * @return A Scan iterator view object.
+ */
+#    ifdef LZ_HAS_CXX_11
+template<LZ_CONCEPT_ITERABLE Iterable, class T, class BinaryOp = std::plus<T>,
+         class Iterator = internal::IterTypeFromIterable<Iterable>>
+#    else
+template<LZ_CONCEPT_ITERABLE Iterable, class T, class BinaryOp = std::plus<>,
+         class Iterator = internal::IterTypeFromIterable<Iterable>>
+#    endif // LZ_HAS_CXX_11
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Scan<Iterator, T, BinaryOp, false>
+exclusiveScan(Iterable&& iterable, T init, BinaryOp binaryOp = {}) {
+    return exclusiveScanRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                              std::move(init), std::move(binaryOp));
+}
+
+/**
+ * Writes the running reductions of `iterable` to `outputIterator` on the threads of `policy`, like `lz::inclusiveScan`. If
+ * both `iterable` and `outputIterator` are random access, a two pass blocked scan is done: the blocks are reduced in parallel
+ * and then scanned in parallel, starting with the reduction of the blocks before them. Otherwise, the calling thread scans.
+ * @param iterable The sequence to scan.
+ * @param outputIterator The output, which must be able to hold as many elements as `iterable`.
+ * @param binaryOp The reduction, which must be associative. It is called from multiple threads at the same time.
+ * @param policy The pool to run on, for instance `lz::execution::pool()`.
+ * @return The end of the output.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class OutputIterator, class BinaryOp>
+OutputIterator inclusiveScanTo(Iterable&& iterable, OutputIterator outputIterator, BinaryOp binaryOp,
+                               const execution::PoolPolicy& policy) {
+    using Iterator = internal::IterTypeFromIterable<Iterable>;
+    using IsParallel = std::integral_constant<bool, internal::IsRandomAccess<Iterator>::value &&
+                                                        internal::IsRandomAccess<OutputIterator>::value>;
+    auto begin = internal::begin(std::forward<Iterable>(iterable));
+    auto end = internal::end(std::forward<Iterable>(iterable));
+    if (begin == end) {
+        return outputIterator;
+    }
+    internal::Decay<internal::ValueType<Iterator>> first(*begin);
+    return internal::parallelScan(IsParallel(), std::true_type(), std::move(begin), end, std::move(outputIterator),
+                                  std::move(first), false, binaryOp, policy.pool());
+}
+
+/**
+ * Writes the running reductions of `iterable`, that exclude the current element, to `outputIterator` on the threads of
+ * `policy`, like `lz::exclusiveScan`. See `lz::inclusiveScanTo`.
+ * @param iterable The sequence to scan.
+ * @param outputIterator The output, which must be able to hold as many elements as `iterable`.
+ * @param init The first element.
+ * @param binaryOp The reduction, which must be associative. It is called from multiple threads at the same time.
+ * @param policy The pool to run on, for instance `lz::execution::pool()`.
+ * @return The end of the output.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class OutputIterator, class T, class BinaryOp>
+OutputIterator exclusiveScanTo(Iterable&& iterable, OutputIterator outputIterator, T init, BinaryOp binaryOp,
+                               const execution::PoolPolicy& policy) {
+    using Iterator = internal::IterTypeFromIterable<Iterable>;
+    using IsParallel = std::integral_constant<bool, internal::IsRandomAccess<Iterator>::value &&
+                                                        internal::IsRandomAccess<OutputIterator>::value>;
+    return internal::parallelScan(IsParallel(), std::false_type(), internal::begin(std::forward<Iterable>(iterable)),
+                                  internal::end(std::forward<Iterable>(iterable)), std::move(outputIterator), std::move(init),
+                                  true, binaryOp, policy.pool());
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_SCAN_HPP
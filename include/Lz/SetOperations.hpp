@@ -0,0 +1,202 @@
+#pragma once
+
+#ifndef LZ_SET_OPERATIONS_HPP
+#    define LZ_SET_OPERATIONS_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/SetOperationIterator.hpp"
+
+namespace lz {
+template<LZ_CONCEPT_ITERATOR IteratorA, LZ_CONCEPT_ITERATOR IteratorB, class Compare, class Operation>
+class SetOperation final
+    : public internal::BasicIteratorView<internal::SetOperationIterator<IteratorA, IteratorB, Compare, Operation>> {
+public:
+    using iterator = internal::SetOperationIterator<IteratorA, IteratorB, Compare, Operation>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    SetOperation(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, Compare compare) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(beginA), endA, std::move(beginB), endB, compare),
+                                              iterator(endA, endA, endB, endB, compare)) {
+    }
+
+    SetOperation() = default;
+};
+
+namespace internal {
+#    ifdef LZ_HAS_CXX_11
+template<class Iterator>
+using SetCompare = std::less<ValueType<Iterator>>;
+#    else
+template<class>
+using SetCompare = std::less<>;
+#    endif // LZ_HAS_CXX_11
+
+template<class IteratorA, class IteratorB, class Operation, class Compare>
+SetOperation<IteratorA, IteratorB, Compare, Operation>
+setOperationRange(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, Compare compare) {
+    static_assert(IsForward<IteratorA>::value && IsForward<IteratorB>::value,
+                  "set operations require forward iterators or stronger");
+    return { std::move(beginA), std::move(endA), std::move(beginB), std::move(endB), std::move(compare) };
+}
+} // namespace internal
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Yields the elements of the sorted [beginA, endA) that are also in the sorted [beginB, endB), like `std::set_intersection`,
+ * lazily. An element that occurs m times in A and n times in B is yielded min(m, n) times, from A. The side that is behind
+ * gallops to the other one, so intersecting a short sequence with a long random access one takes O(m log(n / m))
+ * comparisons, rather than O(m + n). The first cache line of a contiguous arithmetic sequence (e.g. a posting list of
+ * `uint32_t`), compared with `std::less`, is skipped with vector compares before the search gallops. Example:
+ * ```cpp
+ * auto both = lz::setIntersection(postingsOfRare, postingsOfCommon);
+ * ```
+ * @param beginA The beginning of the first sorted sequence.
+ * @param endA The ending of the first sorted sequence.
+ * @param beginB The beginning of the second sorted sequence.
+ * @param endB The ending of the second sorted sequence.
+ * @param compare The ordering of both sequences, `operator<` by default.
+ * @return A forward view of the intersection.
+ */
+template<LZ_CONCEPT_ITERATOR IteratorA, LZ_CONCEPT_ITERATOR IteratorB, class Compare = internal::SetCompare<IteratorA>>
+LZ_NODISCARD SetOperation<IteratorA, IteratorB, Compare, internal::SetIntersection>
+setIntersectionRange(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, Compare compare = {}) {
+    return internal::setOperationRange<IteratorA, IteratorB, internal::SetIntersection>(
+        std::move(beginA), std::move(endA), std::move(beginB), std::move(endB), std::move(compare));
+}
+
+/**
+ * Yields the elements of the sorted `a` that are also in the sorted `b`. See `lz::setIntersectionRange`.
+ * @param a The first sorted sequence.
+ * @param b The second sorted sequence.
+ * @param compare The ordering of both sequences, `operator<` by default.
+ * @return A forward view of the intersection.
+ */
+template<LZ_CONCEPT_ITERABLE IterableA, LZ_CONCEPT_ITERABLE IterableB,
+         class Compare = internal::SetCompare<internal::IterTypeFromIterable<IterableA>>>
+LZ_NODISCARD SetOperation<internal::IterTypeFromIterable<IterableA>, internal::IterTypeFromIterable<IterableB>, Compare,
+                          internal::SetIntersection>
+setIntersection(IterableA&& a, IterableB&& b, Compare compare = {}) {
+    return setIntersectionRange(internal::begin(std::forward<IterableA>(a)), internal::end(std::forward<IterableA>(a)),
+                                internal::begin(std::forward<IterableB>(b)), internal::end(std::forward<IterableB>(b)),
+                                std::move(compare));
+}
+
+/**
+ * Yields the elements that are in the sorted [beginA, endA) or in the sorted [beginB, endB), in order, like `std::set_union`,
+ * lazily. An element that occurs m times in A and n times in B is yielded max(m, n) times, from A first.
+ * @param beginA The beginning of the first sorted sequence.
+ * @param endA The ending of the first sorted sequence.
+ * @param beginB The beginning of the second sorted sequence.
+ * @param endB The ending of the second sorted sequence.
+ * @param compare The ordering of both sequences, `operator<` by default.
+ * @return A forward view of the union.
+ */
+template<LZ_CONCEPT_ITERATOR IteratorA, LZ_CONCEPT_ITERATOR IteratorB, class Compare = internal::SetCompare<IteratorA>>
+LZ_NODISCARD SetOperation<IteratorA, IteratorB, Compare, internal::SetUnion>
+setUnionRange(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, Compare compare = {}) {
+    return internal::setOperationRange<IteratorA, IteratorB, internal::SetUnion>(std::move(beginA), std::move(endA),
+                                                                                 std::move(beginB), std::move(endB),
+                                                                                 std::move(compare));
+}
+
+/**
+ * Yields the elements that are in the sorted `a` or in the sorted `b`, in order. See `lz::setUnionRange`.
+ * @param a The first sorted sequence.
+ * @param b The second sorted sequence.
+ * @param compare The ordering of both sequences, `operator<` by default.
+ * @return A forward view of the union.
+ */
+template<LZ_CONCEPT_ITERABLE IterableA, LZ_CONCEPT_ITERABLE IterableB,
+         class Compare = internal::SetCompare<internal::IterTypeFromIterable<IterableA>>>
+LZ_NODISCARD SetOperation<internal::IterTypeFromIterable<IterableA>, internal::IterTypeFromIterable<IterableB>, Compare,
+                          internal::SetUnion>
+setUnion(IterableA&& a, IterableB&& b, Compare compare = {}) {
+    return setUnionRange(internal::begin(std::forward<IterableA>(a)), internal::end(std::forward<IterableA>(a)),
+                         internal::begin(std::forward<IterableB>(b)), internal::end(std::forward<IterableB>(b)),
+                         std::move(compare));
+}
+
+/**
+ * Yields the elements of the sorted [beginA, endA) that are not in the sorted [beginB, endB), like `std::set_difference`,
+ * lazily. An element that occurs m times in A and n times in B is yielded max(m - n, 0) times. Unlike `lz::except`, which
+ * binary searches all of B for every element of A, B is walked once, and galloped through where it is behind A.
+ * @param beginA The beginning of the first sorted sequence.
+ * @param endA The ending of the first sorted sequence.
+ * @param beginB The beginning of the second sorted sequence.
+ * @param endB The ending of the second sorted sequence.
+ * @param compare The ordering of both sequences, `operator<` by default.
+ * @return A forward view of the difference.
+ */
+template<LZ_CONCEPT_ITERATOR IteratorA, LZ_CONCEPT_ITERATOR IteratorB, class Compare = internal::SetCompare<IteratorA>>
+LZ_NODISCARD SetOperation<IteratorA, IteratorB, Compare, internal::SetDifference>
+setDifferenceRange(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, Compare compare = {}) {
+    return internal::setOperationRange<IteratorA, IteratorB, internal::SetDifference>(
+        std::move(beginA), std::move(endA), std::move(beginB), std::move(endB), std::move(compare));
+}
+
+/**
+ * Yields the elements of the sorted `a` that are not in the sorted `b`. See `lz::setDifferenceRange`.
+ * @param a The first sorted sequence.
+ * @param b The second sorted sequence.
+ * @param compare The ordering of both sequences, `operator<` by default.
+ * @return A forward view of the difference.
+ */
+template<LZ_CONCEPT_ITERABLE IterableA, LZ_CONCEPT_ITERABLE IterableB,
+         class Compare = internal::SetCompare<internal::IterTypeFromIterable<IterableA>>>
+LZ_NODISCARD SetOperation<internal::IterTypeFromIterable<IterableA>, internal::IterTypeFromIterable<IterableB>, Compare,
+                          internal::SetDifference>
+setDifference(IterableA&& a, IterableB&& b, Compare compare = {}) {
+    return setDifferenceRange(internal::begin(std::forward<IterableA>(a)), internal::end(std::forward<IterableA>(a)),
+                              internal::begin(std::forward<IterableB>(b)), internal::end(std::forward<IterableB>(b)),
+                              std::move(compare));
+}
+
+/**
+ * Yields the elements that are in either the sorted [beginA, endA) or the sorted [beginB, endB), but not in both, in order,
+ * like `std::set_symmetric_difference`, lazily. An element that occurs m times in A and n times in B is yielded |m - n| times.
+ * @param beginA The beginning of the first sorted sequence.
+ * @param endA The ending of the first sorted sequence.
+ * @param beginB The beginning of the second sorted sequence.
+ * @param endB The ending of the second sorted sequence.
+ * @param compare The ordering of both sequences, `operator<` by default.
+ * @return A forward view of the symmetric difference.
+ */
+template<LZ_CONCEPT_ITERATOR IteratorA, LZ_CONCEPT_ITERATOR IteratorB, class Compare = internal::SetCompare<IteratorA>>
+LZ_NODISCARD SetOperation<IteratorA, IteratorB, Compare, internal::SetSymmetricDifference>
+setSymmetricDifferenceRange(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, Compare compare = {}) {
+    return internal::setOperationRange<IteratorA, IteratorB, internal::SetSymmetricDifference>(
+        std::move(beginA), std::move(endA), std::move(beginB), std::move(endB), std::move(compare));
+}
+
+/**
+ * Yields the elements that are in either the sorted `a` or the sorted `b`, but not in both. See
+ * `lz::setSymmetricDifferenceRange`.
+ * @param a The first sorted sequence.
+ * @param b The second sorted sequence.
+ * @param compare The ordering of both sequences, `operator<` by default.
+ * @return A forward view of the symmetric difference.
+ */
+template<LZ_CONCEPT_ITERABLE IterableA, LZ_CONCEPT_ITERABLE IterableB,
+         class Compare = internal::SetCompare<internal::IterTypeFromIterable<IterableA>>>
+LZ_NODISCARD SetOperation<internal::IterTypeFromIterable<IterableA>, internal::IterTypeFromIterable<IterableB>, Compare,
+                          internal::SetSymmetricDifference>
+setSymmetricDifference(IterableA&& a, IterableB&& b, Compare compare = {}) {
+    return setSymmetricDifferenceRange(internal::begin(std::forward<IterableA>(a)), internal::end(std::forward<IterableA>(a)),
+                                       internal::begin(std::forward<IterableB>(b)), internal::end(std::forward<IterableB>(b)),
+                                       std::move(compare));
+}
+
+// End of group
+/**
+ * @}
+ */
+
+} // namespace lz
+
+#endif // LZ_SET_OPERATIONS_HPP
@@ -0,0 +1,198 @@
+#pragma once
+
+#ifndef LZ_STATISTICS_HPP
+#    define LZ_STATISTICS_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/Parallel.hpp"
+#    include "detail/Reduce.hpp"
+
+#    include <cmath>
+#    include <cstddef>
+
+namespace lz {
+/**
+ * The count, sum, extrema, mean and variance of a sequence of arithmetic values, computed in one pass. The mean and variance use
+ * Welford's algorithm, which does not suffer from the cancellation of the naive sum of squares. Two `Statistics` can be merged
+ * (Chan et al., 1979), so that the parts of a sequence can be summarized on separate threads. The mean and variance are
+ * computed in `double`, the sum is of type `T`.
+ * @tparam T The arithmetic value type.
+ */
+template<class T>
+class Statistics {
+    std::size_t _count{};
+    T _sum{};
+    T _min{};
+    T _max{};
+    double _mean{};
+    double _m2{};
+
+public:
+    constexpr Statistics() = default;
+
+    //! The statistics of `value` alone.
+    explicit Statistics(const T& value) {
+        insert(value);
+    }
+
+    //! Adds `value`.
+    LZ_CONSTEXPR_CXX_14 void insert(const T& value) {
+        if (_count == 0) {
+            _min = value;
+            _max = value;
+        }
+        else if (value < _min) {
+            _min = value;
+        }
+        else if (_max < value) {
+            _max = value;
+        }
+        ++_count;
+        _sum += value;
+        const auto x = static_cast<double>(value);
+        const double delta = x - _mean;
+        _mean += delta / static_cast<double>(_count);
+        _m2 += delta * (x - _mean);
+    }
+
+    //! Adds the values that `other` summarizes, as if they were inserted after the ones of this.
+    LZ_CONSTEXPR_CXX_14 void merge(const Statistics& other) {
+        if (other._count == 0) {
+            return;
+        }
+        if (_count == 0) {
+            *this = other;
+            return;
+        }
+        const auto count = static_cast<double>(_count);
+        const auto otherCount = static_cast<double>(other._count);
+        const double total = count + otherCount;
+        const double delta = other._mean - _mean;
+        _mean += delta * otherCount / total;
+        _m2 += other._m2 + delta * delta * count * otherCount / total;
+        _count += other._count;
+        _sum += other._sum;
+        if (other._min < _min) {
+            _min = other._min;
+        }
+        if (_max < other._max) {
+            _max = other._max;
+        }
+    }
+
+    //! The amount of values.
+    LZ_NODISCARD constexpr std::size_t count() const noexcept {
+        return _count;
+    }
+
+    //! Whether there are no values.
+    LZ_NODISCARD constexpr bool empty() const noexcept {
+        return _count == 0;
+    }
+
+    //! The sum of the values, or `T()` if there are none.
+    LZ_NODISCARD constexpr T sum() const noexcept {
+        return _sum;
+    }
+
+    //! The smallest value. There must be at least one value.
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 T minimum() const {
+        LZ_ASSERT(!empty(), "the sequence cannot be empty");
+        return _min;
+    }
+
+    //! The largest value. There must be at least one value.
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 T maximum() const {
+        LZ_ASSERT(!empty(), "the sequence cannot be empty");
+        return _max;
+    }
+
+    //! The arithmetic mean, or 0 if there are no values.
+    LZ_NODISCARD constexpr double mean() const noexcept {
+        return _mean;
+    }
+
+    //! The population variance, the sum of the squared deviations from the mean divided by `count()`. 0 if there are no values.
+    LZ_NODISCARD constexpr double variance() const noexcept {
+        return _count == 0 ? 0. : _m2 / static_cast<double>(_count);
+    }
+
+    //! The sample variance, the sum of the squared deviations from the mean divided by `count() - 1`. 0 if there are less than
+    //! 2 values.
+    LZ_NODISCARD constexpr double sampleVariance() const noexcept {
+        return _count < 2 ? 0. : _m2 / static_cast<double>(_count - 1);
+    }
+
+    //! The population standard deviation, the square root of `variance()`.
+    LZ_NODISCARD double standardDeviation() const {
+        return std::sqrt(variance());
+    }
+};
+
+namespace internal {
+// Inserts values into, or merges partial results with the accumulated statistics, so that it can be used by reduceBlocks
+struct StatisticsAccumulate {
+    template<class T, class U>
+    LZ_CONSTEXPR_CXX_14 Statistics<T> operator()(Statistics<T> statistics, const U& value) const {
+        statistics.insert(static_cast<T>(value));
+        return statistics;
+    }
+
+    template<class T>
+    LZ_CONSTEXPR_CXX_14 Statistics<T> operator()(Statistics<T> statistics, const Statistics<T>& other) const {
+        statistics.merge(other);
+        return statistics;
+    }
+};
+} // namespace internal
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Computes the count, sum, minimum, maximum, mean and variance of `iterable` in one pass, so that an expensive chain of e.g.
+ * `lz::map` is only evaluated once instead of once per statistic. Example:
+ * ```cpp
+ * auto statistics = lz::stats(lz::map(lines, parseLatency));
+ * double mean = statistics.mean();
+ * double deviation = statistics.standardDeviation();
+ * ```
+ * @param iterable The sequence of arithmetic values, which may be an input iterable.
+ * @return The `lz::Statistics` of `iterable`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD Statistics<internal::ValueTypeIterable<Iterable>> stats(Iterable&& iterable) {
+    Statistics<internal::ValueTypeIterable<Iterable>> statistics;
+    auto end = internal::end(std::forward<Iterable>(iterable));
+    for (auto it = internal::begin(std::forward<Iterable>(iterable)); it != end; ++it) {
+        statistics.insert(*it);
+    }
+    return statistics;
+}
+
+/**
+ * Computes the statistics of `iterable` on the threads of `policy`. Every thread summarizes its own blocks of the sequence,
+ * after which the partial statistics are merged. Forward iterables are walked once to find the blocks; input iterables are
+ * summarized on the calling thread. The mean and variance may differ from `lz::stats(iterable)` in the last bits.
+ * @param iterable The sequence of arithmetic values.
+ * @param policy The pool to run on, for instance `lz::execution::pool()`.
+ * @return The `lz::Statistics` of `iterable`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD Statistics<internal::ValueTypeIterable<Iterable>> stats(Iterable&& iterable, const execution::PoolPolicy& policy) {
+    using Iterator = internal::IterTypeFromIterable<Iterable>;
+    return internal::parallelTransformReduce(internal::IterCat<Iterator>(), internal::begin(std::forward<Iterable>(iterable)),
+                                             internal::end(std::forward<Iterable>(iterable)),
+                                             Statistics<internal::ValueTypeIterable<Iterable>>(),
+                                             internal::StatisticsAccumulate(), internal::IdentityTransform(), policy);
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_STATISTICS_HPP
@@ -4,6 +4,7 @@
 #define LZ_STRING_SPLITTER_HPP
 
 #include "detail/BasicIteratorView.hpp"
+#include "detail/CharSetSplitIterator.hpp"
 #include "detail/SplitIterator.hpp"
 
 namespace lz {
@@ -16,13 +17,40 @@ public:
 public:
     using value_type = SubString;
 
+    LZ_CONSTEXPR_CXX_20 StringSplitter(const char* data, const std::size_t size, StringType delimiter) :
+        internal::BasicIteratorView<iterator>(iterator(0, data, size, delimiter), iterator(size, data, size, delimiter)) {
+    }
+
     LZ_CONSTEXPR_CXX_20 StringSplitter(const String& str, StringType delimiter) :
-        internal::BasicIteratorView<iterator>(iterator(0, str, delimiter), iterator(str.size(), str, delimiter)) {
+        StringSplitter(str.data(), str.size(), std::move(delimiter)) {
     }
 
     StringSplitter() = default;
 };
 
+/**
+ * A set of delimiters for `lz::splitAny`. Can be created from a string literal, e.g. `lz::CharSet(" \t,;")`, at compile time
+ * from C++14 onwards.
+ */
+using CharSet = internal::CharSet;
+
+template<class SubString>
+class CharSetSplitter final : public internal::BasicIteratorView<internal::CharSetSplitIterator<SubString>> {
+public:
+    using const_iterator = internal::CharSetSplitIterator<SubString>;
+    using iterator = const_iterator;
+
+public:
+    using value_type = SubString;
+
+    CharSetSplitter(const char* data, const std::size_t size, const CharSet& delimiters, const bool collapse) :
+        internal::BasicIteratorView<iterator>(iterator(data, size, delimiters, collapse, false),
+                                              iterator(data, size, delimiters, collapse, true)) {
+    }
+
+    CharSetSplitter() = default;
+};
+
 // Start of group
 /**
  * @addtogroup ItFns
@@ -90,9 +118,209 @@ template<class SubString = fmt::string_view>
 #endif
 StringSplitter<SubString, std::string, std::string> split(std::string&& str, std::string delimiter) = delete;
 
+#if defined(LZ_HAS_STRING_VIEW)
+template<class SubString = std::string_view>
+#elif defined(LZ_STANDALONE)
+template<class SubString = std::string>
+#else
+template<class SubString = fmt::string_view>
+#endif
+/**
+ * @brief This is a lazy evaluated string splitter function. It splits the characters [data, data + length) using `delimiter`.
+ * Only a pointer to the characters is kept, so they must outlive the returned view.
+ * @tparam SubString The string type of the substring. If C++17, this will default to `std::string_view`. If `LZ_STANDALONE` is
+ * not defined and C++17 is not defined, this will default to `std::string`. Otherwise it will default to `fmt::string_view`.
+ * Furthermore, `SubString` should have a constructor which looks like `SubString([const]char*, std::size_t length)`:
+ * @param data The characters to split.
+ * @param length The amount of characters to split.
+ * @param delimiter The delimiter to split on.
+ * @return A stringSplitter object that can be converted to an arbitrary container or can be iterated over using
+ * `for (auto... lz::split(...))`.
+ */
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 StringSplitter<SubString, const char*, std::string>
+split(const char* data, const std::size_t length, std::string delimiter) {
+    return { data, length, std::move(delimiter) };
+}
+
+#if defined(LZ_HAS_STRING_VIEW)
+template<class SubString = std::string_view>
+#elif defined(LZ_STANDALONE)
+template<class SubString = std::string>
+#else
+template<class SubString = fmt::string_view>
+#endif
+/**
+ * @brief This is a lazy evaluated string splitter function. It splits the characters [data, data + length) using `delimiter`.
+ * Only a pointer to the characters is kept, so they must outlive the returned view.
+ * @tparam SubString The string type of the substring. If C++17, this will default to `std::string_view`. If `LZ_STANDALONE` is
+ * not defined and C++17 is not defined, this will default to `std::string`. Otherwise it will default to `fmt::string_view`.
+ * Furthermore, `SubString` should have a constructor which looks like `SubString([const]char*, std::size_t length)`:
+ * @param data The characters to split.
+ * @param length The amount of characters to split.
+ * @param delimiter The delimiter to split on.
+ * @return A stringSplitter object that can be converted to an arbitrary container or can be iterated over using
+ * `for (auto... lz::split(...))`.
+ */
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 StringSplitter<SubString, const char*, char>
+split(const char* data, const std::size_t length, const char delimiter) {
+    return { data, length, delimiter };
+}
+
+#if defined(LZ_HAS_STRING_VIEW)
+template<class SubString = std::string_view, class CharRange,
+         class = internal::EnableIf<internal::IsCharBuffer<CharRange>::value>>
+#elif defined(LZ_STANDALONE)
+template<class SubString = std::string, class CharRange,
+         class = internal::EnableIf<internal::IsCharBuffer<CharRange>::value>>
+#else
+template<class SubString = fmt::string_view, class CharRange,
+         class = internal::EnableIf<internal::IsCharBuffer<CharRange>::value>>
+#endif
+/**
+ * @brief This is a lazy evaluated string splitter function. It splits a contiguous range of characters, such as a
+ * `std::vector<char>` or `std::array<char, N>`, using `delimiter`. Only a pointer to the characters is kept, so they must outlive
+ * the returned view.
+ * @tparam SubString The string type of the substring. If C++17, this will default to `std::string_view`. If `LZ_STANDALONE` is
+ * not defined and C++17 is not defined, this will default to `std::string`. Otherwise it will default to `fmt::string_view`.
+ * Furthermore, `SubString` should have a constructor which looks like `SubString([const]char*, std::size_t length)`:
+ * @tparam CharRange A type with `data()` and `size()` members that refers to contiguous characters.
+ * @param range The characters to split.
+ * @param delimiter The delimiter to split on.
+ * @return A stringSplitter object that can be converted to an arbitrary container or can be iterated over using
+ * `for (auto... lz::split(...))`.
+ */
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 StringSplitter<SubString, CharRange, std::string>
+split(const CharRange& range, std::string delimiter) {
+    return { range, std::move(delimiter) };
+}
+
+#if defined(LZ_HAS_STRING_VIEW)
+template<class SubString = std::string_view, class CharRange,
+         class = internal::EnableIf<internal::IsCharBuffer<CharRange>::value>>
+#elif defined(LZ_STANDALONE)
+template<class SubString = std::string, class CharRange,
+         class = internal::EnableIf<internal::IsCharBuffer<CharRange>::value>>
+#else
+template<class SubString = fmt::string_view, class CharRange,
+         class = internal::EnableIf<internal::IsCharBuffer<CharRange>::value>>
+#endif
+/**
+ * @brief This is a lazy evaluated string splitter function. It splits a contiguous range of characters, such as a
+ * `std::vector<char>` or `std::array<char, N>`, using `delimiter`. Only a pointer to the characters is kept, so they must outlive
+ * the returned view.
+ * @tparam SubString The string type of the substring. If C++17, this will default to `std::string_view`. If `LZ_STANDALONE` is
+ * not defined and C++17 is not defined, this will default to `std::string`. Otherwise it will default to `fmt::string_view`.
+ * Furthermore, `SubString` should have a constructor which looks like `SubString([const]char*, std::size_t length)`:
+ * @tparam CharRange A type with `data()` and `size()` members that refers to contiguous characters.
+ * @param range The characters to split.
+ * @param delimiter The delimiter to split on.
+ * @return A stringSplitter object that can be converted to an arbitrary container or can be iterated over using
+ * `for (auto... lz::split(...))`.
+ */
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 StringSplitter<SubString, CharRange, char> split(const CharRange& range, const char delimiter) {
+    return { range, delimiter };
+}
+
+#if defined(LZ_HAS_STRING_VIEW)
+template<class SubString = std::string_view, class CharRange,
+         class = internal::EnableIf<internal::IsCharBuffer<CharRange>::value && !std::is_lvalue_reference<CharRange>::value>>
+#elif defined(LZ_STANDALONE)
+template<class SubString = std::string, class CharRange,
+         class = internal::EnableIf<internal::IsCharBuffer<CharRange>::value && !std::is_lvalue_reference<CharRange>::value>>
+#else
+template<class SubString = fmt::string_view, class CharRange,
+         class = internal::EnableIf<internal::IsCharBuffer<CharRange>::value && !std::is_lvalue_reference<CharRange>::value>>
+#endif
+StringSplitter<SubString, CharRange, std::string> split(CharRange&& range, std::string delimiter) = delete;
+
+#if defined(LZ_HAS_STRING_VIEW)
+template<class SubString = std::string_view, class CharRange,
+         class = internal::EnableIf<internal::IsCharBuffer<CharRange>::value && !std::is_lvalue_reference<CharRange>::value>>
+#elif defined(LZ_STANDALONE)
+template<class SubString = std::string, class CharRange,
+         class = internal::EnableIf<internal::IsCharBuffer<CharRange>::value && !std::is_lvalue_reference<CharRange>::value>>
+#else
+template<class SubString = fmt::string_view, class CharRange,
+         class = internal::EnableIf<internal::IsCharBuffer<CharRange>::value && !std::is_lvalue_reference<CharRange>::value>>
+#endif
+StringSplitter<SubString, CharRange, char> split(CharRange&& range, char delimiter) = delete;
+
+#if defined(LZ_HAS_STRING_VIEW)
+template<class SubString = std::string_view, class CharRange,
+         class = internal::EnableIf<internal::HasCharData<CharRange>::value>>
+#elif defined(LZ_STANDALONE)
+template<class SubString = std::string, class CharRange,
+         class = internal::EnableIf<internal::HasCharData<CharRange>::value>>
+#else
+template<class SubString = fmt::string_view, class CharRange,
+         class = internal::EnableIf<internal::HasCharData<CharRange>::value>>
+#endif
+/**
+ * @brief This is a lazy evaluated string splitter function. It splits `range` on every character that is in `delimiters`, e.g.
+ * `lz::splitAny(str, " \t,;")`. Looking up whether a character is a delimiter costs the same regardless of the amount of
+ * delimiters. Only a pointer to the characters is kept, so they must outlive the returned view.
+ * @tparam SubString The string type of the substring. If C++17, this will default to `std::string_view`. If `LZ_STANDALONE` is
+ * not defined and C++17 is not defined, this will default to `std::string`. Otherwise it will default to `fmt::string_view`.
+ * Furthermore, `SubString` should have a constructor which looks like `SubString([const]char*, std::size_t length)`:
+ * @tparam CharRange A type with `data()` and `size()` members that refers to contiguous characters, such as `std::string`.
+ * @param range The characters to split.
+ * @param delimiters The characters to split on.
+ * @param collapse If true, consecutive delimiters are treated as one and no empty substrings are returned, so that leading and
+ * trailing delimiters are skipped as well.
+ * @return A CharSetSplitter object that can be converted to an arbitrary container or can be iterated over using
+ * `for (auto... lz::splitAny(...))`.
+ */
+LZ_NODISCARD CharSetSplitter<SubString>
+splitAny(const CharRange& range, const CharSet& delimiters, const bool collapse = false) {
+    return { range.data(), range.size(), delimiters, collapse };
+}
+
+#if defined(LZ_HAS_STRING_VIEW)
+template<class SubString = std::string_view>
+#elif defined(LZ_STANDALONE)
+template<class SubString = std::string>
+#else
+template<class SubString = fmt::string_view>
+#endif
+/**
+ * @brief This is a lazy evaluated string splitter function. It splits the characters [data, data + length) on every character
+ * that is in `delimiters`, e.g. `lz::splitAny(data, length, " \t,;")`. Looking up whether a character is a delimiter costs the
+ * same regardless of the amount of delimiters. Only a pointer to the characters is kept, so they must outlive the returned view.
+ * @tparam SubString The string type of the substring. If C++17, this will default to `std::string_view`. If `LZ_STANDALONE` is
+ * not defined and C++17 is not defined, this will default to `std::string`. Otherwise it will default to `fmt::string_view`.
+ * Furthermore, `SubString` should have a constructor which looks like `SubString([const]char*, std::size_t length)`:
+ * @param data The characters to split.
+ * @param length The amount of characters to split.
+ * @param delimiters The characters to split on.
+ * @param collapse If true, consecutive delimiters are treated as one and no empty substrings are returned, so that leading and
+ * trailing delimiters are skipped as well.
+ * @return A CharSetSplitter object that can be converted to an arbitrary container or can be iterated over using
+ * `for (auto... lz::splitAny(...))`.
+ */
+LZ_NODISCARD CharSetSplitter<SubString>
+splitAny(const char* data, const std::size_t length, const CharSet& delimiters, const bool collapse = false) {
+    return { data, length, delimiters, collapse };
+}
+
+#if defined(LZ_HAS_STRING_VIEW)
+template<class SubString = std::string_view, class CharRange,
+         class = internal::EnableIf<internal::HasCharData<CharRange>::value && !std::is_lvalue_reference<CharRange>::value &&
+                                    !internal::IsView<CharRange>::value>>
+#elif defined(LZ_STANDALONE)
+template<class SubString = std::string, class CharRange,
+         class = internal::EnableIf<internal::HasCharData<CharRange>::value && !std::is_lvalue_reference<CharRange>::value &&
+                                    !internal::IsView<CharRange>::value>>
+#else
+template<class SubString = fmt::string_view, class CharRange,
+         class = internal::EnableIf<internal::HasCharData<CharRange>::value && !std::is_lvalue_reference<CharRange>::value &&
+                                    !internal::IsView<CharRange>::value>>
+#endif
+CharSetSplitter<SubString> splitAny(CharRange&& range, const CharSet& delimiters, bool collapse = false) = delete;
+
 #ifdef LZ_HAS_STRING_VIEW
 /**
- * @brief This is a lazy evaluated string splitter function. It splits a string using `delimiter`.
+ * @brief This is a lazy evaluated string splitter function. It splits a string using `delimiter`. The view is taken by value,
+ * so temporary string views are fine, as long as the characters they refer to outlive the returned view.
  * @tparam SubString The string type of the substring.
  * @param str The string to split.
  * @param delimiter The delimiter to split on.
@@ -101,21 +329,15 @@ StringSplitter<SubString, std::string, std::string> split(std::string&& str, std
  */
 template<class SubString = std::string_view>
 LZ_NODISCARD LZ_CONSTEXPR_CXX_20 StringSplitter<SubString, std::string_view, std::string>
-split(const std::string_view& str, std::string delimiter) {
+split(const std::string_view str, std::string delimiter) {
     return { str, std::move(delimiter) };
 }
 
 template<class SubString = std::string_view>
 LZ_NODISCARD constexpr StringSplitter<SubString, std::string_view, char>
-split(const std::string_view& str, char delimiter) {
+split(const std::string_view str, const char delimiter) {
     return { str, delimiter };
 }
-
-template<class SubString = std::string_view>
-StringSplitter<SubString, std::string_view, std::string> split(std::string_view&& str, char delimiter) = delete;
-
-template<class SubString = std::string_view>
-StringSplitter<SubString, std::string_view, std::string> split(std::string_view&& str, std::string delimiter) = delete;
 #endif // LZ_HAS_STRING_VIEW
 
 // End of group
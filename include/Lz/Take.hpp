@@ -4,8 +4,47 @@
 #    define LZ_TAKE_HPP
 
 #    include "detail/BasicIteratorView.hpp"
+#    include "detail/TakeIterator.hpp"
 
 namespace lz {
+template<class Iterator>
+class Take final : public internal::BasicIteratorView<internal::TakeIterator<Iterator>> {
+public:
+    using iterator = internal::TakeIterator<Iterator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    constexpr Take() = default;
+
+    LZ_CONSTEXPR_CXX_20 Take(Iterator begin, Iterator end, const internal::DiffType<Iterator> amount) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(begin), end, amount), iterator(end, end, 0)) {
+    }
+};
+
+namespace internal {
+// Random access iterators are sliced directly, other iterators are counted by a Take view
+template<class Iterator>
+using TakeView = Conditional<IsRandomAccess<Iterator>::value, BasicIteratorView<Iterator>, Take<Iterator>>;
+
+template<class Iterator>
+using TakeIterType = Conditional<IsRandomAccess<Iterator>::value, Iterator, TakeIterator<Iterator>>;
+
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 BasicIteratorView<Iterator>
+takeImpl(std::true_type /* isRandomAccess */, Iterator begin, Iterator end, const DiffType<Iterator> amount) {
+    LZ_ASSERT(amount >= 0, "amount to take cannot be negative");
+    static_cast<void>(end);
+    end = begin + amount;
+    return { std::move(begin), std::move(end) };
+}
+
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 Take<Iterator>
+takeImpl(std::false_type /* isRandomAccess */, Iterator begin, Iterator end, const DiffType<Iterator> amount) {
+    return { std::move(begin), std::move(end), amount };
+}
+} // namespace internal
+
 // Start of group
 /**
  * @defgroup ItFns Iterator free functions.
@@ -20,38 +59,39 @@ namespace lz {
 /**
  * @brief This function takes a range between two iterators from [begin, end). Its `begin()` function returns a
  * an iterator. If MSVC and the type is an STL iterator, pass a pointer iterator, not an actual
- * iterator object.
+ * iterator object. If `Iterator` is random access, the end of the view is computed in O(1) and the view iterates over `Iterator`
+ * itself, in which case `amount` must not exceed the length of the sequence. Otherwise, the elements are counted while
+ * iterating, using a `Take` view, so that the sequence is not walked to find the end up front. A `Take` view stops at `end` if
+ * `amount` exceeds the length of the sequence.
  * @param begin The beginning of the 'view'.
  * @param end The ending of the 'view'.
  * @return A Take object that can be converted to an arbitrary container or can be iterated over using
  * `for (auto... lz::takeRange(...))`.
  */
 template<LZ_CONCEPT_ITERATOR Iterator>
-LZ_NODISCARD LZ_CONSTEXPR_CXX_20 internal::BasicIteratorView<Iterator>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 internal::TakeView<Iterator>
 takeRange(Iterator begin, Iterator end, const internal::DiffType<Iterator> amount) {
-    using lz::next;
-    using std::next;
-    static_cast<void>(end);
-    return { begin, next(begin, amount) };
+    return internal::takeImpl(internal::IsRandomAccess<Iterator>(), std::move(begin), std::move(end), amount);
 }
 
 /**
  * @brief This function takes an iterable and slices `amount` from the beginning of the array. Essentially it is
  * equivalent to [`iterable.begin(), iterable.begin() + amount`). Its `begin()` function returns a random
- * access iterator.
+ * access iterator if the iterable is random access. See `lz::takeRange` for details.
  * @param iterable An iterable with method `begin()`.
  * @param amount The amount of elements to take from the beginning of the `iterable`.
  * @return A Take object that can be converted to an arbitrary container or can be iterated over using
  * `for (auto... lz::take(...))`.
  */
 template<LZ_CONCEPT_ITERABLE Iterable, class IterType = internal::IterTypeFromIterable<Iterable>>
-LZ_NODISCARD LZ_CONSTEXPR_CXX_20 internal::BasicIteratorView<IterType>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 internal::TakeView<IterType>
 take(Iterable&& iterable, const internal::DiffType<IterType> amount) {
     return takeRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), amount);
 }
 
 /**
- * Drops an amount of items, starting from begin.
+ * Drops an amount of items, starting from begin. Jumps in O(1) if `Iterator` is random access, otherwise stops at `end` if
+ * `amount` exceeds the length of the sequence.
  * @param begin The beginning of the sequence.
  * @param end The ending of the sequence.
  * @param amount The amount of items to drop, which is equivalent to next(begin, amount)
@@ -60,13 +100,12 @@ take(Iterable&& iterable, const internal::DiffType<IterType> amount) {
 template<LZ_CONCEPT_ITERATOR Iterator>
 LZ_NODISCARD LZ_CONSTEXPR_CXX_20 internal::BasicIteratorView<Iterator>
 dropRange(Iterator begin, Iterator end, const internal::DiffType<Iterator> amount) {
-    using lz::next;
-    using std::next;
-    return takeRange(next(begin, amount), end, internal::getIterLength(begin, end) - amount);
+    begin = internal::nextBounded(internal::IsRandomAccess<Iterator>(), std::move(begin), end, amount);
+    return { std::move(begin), std::move(end) };
 }
 
 /**
- * Drops an amount of items, starting from begin.
+ * Drops an amount of items, starting from begin. Jumps in O(1) if the iterable is random access, see `lz::dropRange`.
  * @param iterable The iterable to drop from.
  * @param amount The amount of items to drop, which is equivalent to next(begin, amount)
  * @return A Take iterator where the first `amount` items have been dropped.
@@ -74,16 +113,12 @@ dropRange(Iterator begin, Iterator end, const internal::DiffType<Iterator> amoun
 template<LZ_CONCEPT_ITERABLE Iterable, class IterType = internal::IterTypeFromIterable<Iterable>>
 LZ_NODISCARD LZ_CONSTEXPR_CXX_20 internal::BasicIteratorView<IterType>
 drop(Iterable&& iterable, const internal::DiffType<IterType> amount) {
-    using lz::next;
-    using std::next;
-    auto begin = std::begin(iterable);
-    auto end = std::end(iterable);
-    return takeRange(next(begin, amount), end, static_cast<internal::DiffTypeIterable<Iterable>>(iterable.size()) - amount);
+    return dropRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), amount);
 }
 
 /**
  * @brief This function slices an iterable. It is equivalent to [`begin() + from, begin() + to`).
- * Its `begin()` function returns an iterator.
+ * Its `begin()` function returns an iterator. See `lz::takeRange` for details.
  * @param iterable An iterable with method `begin()`.
  * @param from The offset from the beginning of the iterable.
  * @param to The offset from the beginning to take. `from` must be higher than `to`.
@@ -91,14 +126,13 @@ drop(Iterable&& iterable, const internal::DiffType<IterType> amount) {
  * `for (auto... lz::slice(...))`.
  */
 template<LZ_CONCEPT_ITERABLE Iterable, class IterType = internal::IterTypeFromIterable<Iterable>>
-LZ_NODISCARD LZ_CONSTEXPR_CXX_20 internal::BasicIteratorView<IterType>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 internal::TakeView<IterType>
 slice(Iterable&& iterable, const internal::DiffType<IterType> from, const internal::DiffType<IterType> to) {
-    using lz::next;
-    using std::next;
     LZ_ASSERT(to >= from, "parameter `to` cannot be more than `from`");
-    auto begin = internal::begin(std::forward<Iterable>(iterable));
-    begin = next(std::move(begin), from);
-    return takeRange(begin, internal::end(std::forward<Iterable>(iterable)), to - from);
+    auto end = internal::end(std::forward<Iterable>(iterable));
+    auto begin =
+        internal::nextBounded(internal::IsRandomAccess<IterType>(), internal::begin(std::forward<Iterable>(iterable)), end, from);
+    return takeRange(std::move(begin), std::move(end), to - from);
 }
 
 #    ifdef LZ_HAS_EXECUTION
@@ -156,7 +190,6 @@ takeWhile(Iterable&& iterable, Function predicate, Execution execution = std::ex
 template<LZ_CONCEPT_ITERATOR Iterator, class Function, class Execution = std::execution::sequenced_policy>
 LZ_NODISCARD LZ_CONSTEXPR_CXX_20 internal::BasicIteratorView<Iterator>
 dropWhileRange(Iterator begin, Iterator end, Function predicate, Execution execution = std::execution::seq) {
-    using ValueType = internal::ValueType<Iterator>;
     if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
         static_cast<void>(execution);
         begin = std::find_if_not(std::move(begin), end, std::move(predicate));
@@ -164,7 +197,7 @@ dropWhileRange(Iterator begin, Iterator end, Function predicate, Execution execu
     else {
         begin = std::find_if_not(execution, std::move(begin), end, std::move(predicate));
     }
-    return takeRange(begin, end, internal::getIterLength(begin, end));
+    return { std::move(begin), std::move(end) };
 }
 
 /**
@@ -229,7 +262,7 @@ takeWhile(Iterable&& iterable, Function predicate) {
 template<LZ_CONCEPT_ITERATOR Iterator, class Function>
 internal::BasicIteratorView<Iterator> dropWhileRange(Iterator begin, Iterator end, Function predicate) {
     begin = std::find_if_not(std::move(begin), end, std::move(predicate));
-    return takeRange(begin, end, internal::getIterLength(begin, end));
+    return { std::move(begin), std::move(end) };
 }
 
 /**
@@ -0,0 +1,220 @@
+#pragma once
+
+#ifndef LZ_WINDOWS_HPP
+#    define LZ_WINDOWS_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/WindowsIterator.hpp"
+
+#    include <functional>
+
+namespace lz {
+template<LZ_CONCEPT_ITERATOR Iterator>
+class Windows final : public internal::BasicIteratorView<internal::WindowsIterator<Iterator>> {
+public:
+    using iterator = internal::WindowsIterator<Iterator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    LZ_CONSTEXPR_CXX_20 Windows(iterator begin, iterator end) :
+        internal::BasicIteratorView<iterator>(std::move(begin), std::move(end)) {
+    }
+
+    constexpr Windows() = default;
+};
+
+template<LZ_CONCEPT_ITERATOR Iterator>
+class SlidingSum final : public internal::BasicIteratorView<internal::SlidingSumIterator<Iterator>> {
+public:
+    using iterator = internal::SlidingSumIterator<Iterator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    LZ_CONSTEXPR_CXX_20 SlidingSum(Iterator begin, Iterator end, const std::size_t windowSize) :
+        internal::BasicIteratorView<iterator>(iterator(std::move(begin), end, windowSize), iterator(end, end, windowSize)) {
+    }
+
+    constexpr SlidingSum() = default;
+};
+
+template<LZ_CONCEPT_ITERATOR Iterator, class Compare>
+class SlidingExtreme final : public internal::BasicIteratorView<internal::SlidingExtremeIterator<Iterator, Compare>> {
+public:
+    using iterator = internal::SlidingExtremeIterator<Iterator, Compare>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    SlidingExtreme(Iterator begin, Iterator end, const std::size_t windowSize, Compare compare) :
+        internal::BasicIteratorView<iterator>(iterator(std::make_shared<internal::SlidingExtremeState<Iterator, Compare>>(
+                                                  std::move(begin), std::move(end), windowSize, std::move(compare))),
+                                              iterator()) {
+    }
+
+    SlidingExtreme() = default;
+};
+
+namespace internal {
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 Iterator
+windowsEndFirst(std::true_type /* isBidirectional */, const Iterator& end, const std::size_t windowSize) {
+    return std::prev(end, static_cast<DiffType<Iterator>>(windowSize - 1));
+}
+
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 Iterator windowsEndFirst(std::false_type /* isBidirectional */, const Iterator& end, std::size_t) {
+    return end;
+}
+
+template<class Iterator>
+using MinSelector = std::less<Decay<ValueType<Iterator>>>;
+
+template<class Iterator>
+using MaxSelector = std::greater<Decay<ValueType<Iterator>>>;
+} // namespace internal
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * Yields every window of `windowSize` consecutive elements of [begin, end), so [begin, begin + windowSize), then
+ * [begin + 1, begin + windowSize + 1), up to the window that ends at `end`. A window is a view of two iterators, that are both
+ * moved one step per window, so the elements are never walked more than once per window boundary. If [begin, end) has less
+ * than `windowSize` elements, there are no windows. The iterator has the category of `Iterator`. Example:
+ * ```cpp
+ * for (auto window : lz::windows(prices, 20)) {
+ *     // window.begin(), window.end()
+ * }
+ * ```
+ * @param begin The beginning of the sequence, which must be forward or stronger.
+ * @param end The ending of the sequence.
+ * @param windowSize The amount of elements per window. Must be larger than 0.
+ * @return A Windows view, of which the `value_type` is `lz::internal::BasicIteratorView<Iterator>`.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Windows<Iterator> windowsRange(Iterator begin, Iterator end, const std::size_t windowSize) {
+    static_assert(internal::IsForward<Iterator>::value, "Windows requires a forward iterator or stronger");
+    LZ_ASSERT(windowSize > 0, "window size must be larger than 0");
+    // Always steps, so that a window that is larger than the sequence does not jump past its end
+    internal::WindowsIterator<Iterator> first(
+        begin, internal::nextBounded(std::false_type(), begin, end, static_cast<internal::DiffType<Iterator>>(windowSize - 1)));
+    if (first == internal::WindowsIterator<Iterator>(begin, end)) {
+        return { first, first };
+    }
+    auto endFirst = internal::windowsEndFirst(internal::IsBidirectional<Iterator>(), end, windowSize);
+    return { std::move(first), internal::WindowsIterator<Iterator>(std::move(endFirst), std::move(end)) };
+}
+
+/**
+ * Yields every window of `windowSize` consecutive elements of `iterable`. See `lz::windowsRange`.
+ * @param iterable The sequence, which must be forward or stronger.
+ * @param windowSize The amount of elements per window. Must be larger than 0.
+ * @return A Windows view, of which the `value_type` is `lz::internal::BasicIteratorView<Iterator>`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class I = internal::IterTypeFromIterable<Iterable>>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Windows<I> windows(Iterable&& iterable, const std::size_t windowSize) {
+    return windowsRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                        windowSize);
+}
+
+/**
+ * Yields the sum of every window of `windowSize` consecutive elements of [begin, end), see `lz::windows`. The sum is updated
+ * with the element that enters and the element that leaves the window, so every step is O(1), regardless of `windowSize`. Every
+ * element is therefore read twice. For floating point types, the rounding errors of these updates add up over long sequences.
+ * Example:
+ * ```cpp
+ * auto movingAverage = lz::map(lz::slidingSum(prices, 20), [](double sum) { return sum / 20; });
+ * ```
+ * @param begin The beginning of the sequence, which must be forward or stronger.
+ * @param end The ending of the sequence.
+ * @param windowSize The amount of elements per window. Must be larger than 0.
+ * @return A forward view of the sums, of the value type of the sequence.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SlidingSum<Iterator>
+slidingSumRange(Iterator begin, Iterator end, const std::size_t windowSize) {
+    static_assert(internal::IsForward<Iterator>::value, "SlidingSum requires a forward iterator or stronger");
+    LZ_ASSERT(windowSize > 0, "window size must be larger than 0");
+    return { std::move(begin), std::move(end), windowSize };
+}
+
+/**
+ * Yields the sum of every window of `windowSize` consecutive elements of `iterable`. See `lz::slidingSumRange`.
+ * @param iterable The sequence, which must be forward or stronger.
+ * @param windowSize The amount of elements per window. Must be larger than 0.
+ * @return A forward view of the sums, of the value type of the sequence.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class I = internal::IterTypeFromIterable<Iterable>>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SlidingSum<I> slidingSum(Iterable&& iterable, const std::size_t windowSize) {
+    return slidingSumRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                           windowSize);
+}
+
+/**
+ * Yields the smallest element of every window of `windowSize` consecutive elements of [begin, end), see `lz::windows`. The
+ * candidates for the minimum are kept in a monotonic deque, so every step is O(1) amortized, regardless of `windowSize`, and
+ * every element is read once. The iterators are therefore input iterators. Example:
+ * ```cpp
+ * auto support = lz::slidingMin(prices, 50);
+ * ```
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param windowSize The amount of elements per window. Must be larger than 0.
+ * @return An input view of the minimums, of the value type of the sequence.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD SlidingExtreme<Iterator, internal::MinSelector<Iterator>>
+slidingMinRange(Iterator begin, Iterator end, const std::size_t windowSize) {
+    LZ_ASSERT(windowSize > 0, "window size must be larger than 0");
+    return { std::move(begin), std::move(end), windowSize, internal::MinSelector<Iterator>() };
+}
+
+/**
+ * Yields the smallest element of every window of `windowSize` consecutive elements of `iterable`. See `lz::slidingMinRange`.
+ * @param iterable The sequence.
+ * @param windowSize The amount of elements per window. Must be larger than 0.
+ * @return An input view of the minimums, of the value type of the sequence.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class I = internal::IterTypeFromIterable<Iterable>>
+LZ_NODISCARD SlidingExtreme<I, internal::MinSelector<I>> slidingMin(Iterable&& iterable, const std::size_t windowSize) {
+    return slidingMinRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                           windowSize);
+}
+
+/**
+ * Yields the largest element of every window of `windowSize` consecutive elements of [begin, end). See
+ * `lz::slidingMinRange`.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param windowSize The amount of elements per window. Must be larger than 0.
+ * @return An input view of the maximums, of the value type of the sequence.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD SlidingExtreme<Iterator, internal::MaxSelector<Iterator>>
+slidingMaxRange(Iterator begin, Iterator end, const std::size_t windowSize) {
+    LZ_ASSERT(windowSize > 0, "window size must be larger than 0");
+    return { std::move(begin), std::move(end), windowSize, internal::MaxSelector<Iterator>() };
+}
+
+/**
+ * Yields the largest element of every window of `windowSize` consecutive elements of `iterable`. See `lz::slidingMinRange`.
+ * @param iterable The sequence.
+ * @param windowSize The amount of elements per window. Must be larger than 0.
+ * @return An input view of the maximums, of the value type of the sequence.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class I = internal::IterTypeFromIterable<Iterable>>
+LZ_NODISCARD SlidingExtreme<I, internal::MaxSelector<I>> slidingMax(Iterable&& iterable, const std::size_t windowSize) {
+    return slidingMaxRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                           windowSize);
+}
+
+// End of group
+/**
+ * @}
+ */
+
+} // namespace lz
+
+#endif // LZ_WINDOWS_HPP
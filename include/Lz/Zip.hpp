@@ -4,6 +4,7 @@
 #    define LZ_ZIP_HPP
 
 #    include "detail/BasicIteratorView.hpp"
+#    include "detail/ZipContiguousIterator.hpp"
 #    include "detail/ZipIterator.hpp"
 
 namespace lz {
@@ -46,6 +47,9 @@ template<class DiffTy, class... Iterables>
 LZ_CONSTEXPR_CXX_20 void getLengthFromIterables(DiffTy* out, const Iterables&... iterables) {
     doGetLengthFromIterables(out, internal::MakeIndexSequence<sizeof...(Iterables)>(), iterables...);
 }
+
+template<class Iterable>
+using DataPointer = decltype(std::declval<Iterable&>().data());
 } // namespace internal
 
 template<LZ_CONCEPT_ITERATOR... Iterators>
@@ -63,6 +67,21 @@ public:
     constexpr Zip() = default;
 };
 
+template<class... Pointers>
+class ZipContiguous final : public internal::BasicIteratorView<internal::ZipContiguousIterator<Pointers...>> {
+public:
+    using iterator = internal::ZipContiguousIterator<Pointers...>;
+    using const_iterator = iterator;
+
+    using value_type = typename iterator::value_type;
+
+    LZ_CONSTEXPR_CXX_20 ZipContiguous(std::tuple<Pointers...> bases, const std::ptrdiff_t length) :
+        internal::BasicIteratorView<iterator>(iterator(bases, 0), iterator(bases, length)) {
+    }
+
+    constexpr ZipContiguous() = default;
+};
+
 // Start of group
 /**
  * @addtogroup ItFns
@@ -112,6 +131,30 @@ LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Zip<internal::IterTypeFromIterable<Iterables>..
     return { std::move(begin), std::move(end) };
 }
 
+/**
+ * @brief Zips contiguous containers (anything with `data()` and `size()`, such as `std::vector`, `std::array` and
+ * `std::string`) as a structure of arrays. It stops at its smallest container, just like `lz::zip`, and `operator*` returns
+ * the same `std::tuple<Args&...>`. The difference is that the iterator only stores the base pointers and a single shared
+ * index, so that incrementing and comparing it is as cheap as an indexed loop. Iterating it with `forEach`, `toVector` or
+ * `copyTo` runs a plain indexed loop over the containers, that the compiler is able to vectorize. Example:
+ * ```cpp
+ * std::vector<float> positions(n), velocities(n);
+ * lz::toIter(lz::zipContiguous(positions, velocities)).forEach([dt](std::tuple<float&, float&> particle) {
+ *     std::get<0>(particle) += std::get<1>(particle) * dt;
+ * });
+ * ```
+ * @param iterables The contiguous containers to iterate simultaneously over.
+ * @return A ZipContiguous object that can be converted to an arbitrary container or can be iterated over using
+ * `for (auto tuple : lz::zipContiguous(...))`.
+ */
+template<LZ_CONCEPT_ITERABLE... Iterables>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 ZipContiguous<internal::DataPointer<Iterables>...> zipContiguous(Iterables&&... iterables) {
+    std::ptrdiff_t lengths[sizeof...(Iterables)]{};
+    internal::getLengthFromIterables(lengths, iterables...);
+    const auto length = *std::min_element(lengths, lengths + sizeof...(Iterables));
+    return { std::make_tuple(iterables.data()...), length };
+}
+
 // End of group
 /**
  * @}
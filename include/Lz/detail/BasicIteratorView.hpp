@@ -21,10 +21,28 @@
 #            include <sstream>
 #        endif // LZ_HAS_FORMAT
 #    else
+#        include <fmt/compile.h>
 #        include <fmt/ostream.h>
+// Runtime format strings must be marked as such since fmt 8, which checks format strings at compile time
+#        if FMT_VERSION >= 80000
+#            define LZ_FMT_RUNTIME(FORMAT) fmt::runtime(FORMAT)
+#        else
+#            define LZ_FMT_RUNTIME(FORMAT) (FORMAT)
+#        endif // FMT_VERSION >= 80000
 #    endif // LZ_STANDALONE
 
+#    include "Contiguous.hpp"
+#    include "GenerateIterator.hpp"
 #    include "LzTools.hpp"
+#    include "Parallel.hpp"
+#    include "RangeIterator.hpp"
+#    include "RepeatIterator.hpp"
+#    include "WriteSink.hpp"
+
+#    ifdef LZ_HAS_EXECUTION
+#        include <exception>
+#        include <thread>
+#    endif // LZ_HAS_EXECUTION
 
 namespace lz {
 namespace internal {
@@ -152,6 +170,165 @@ LZ_NODISCARD LZ_CONSTEXPR_CXX_20 internal::RefType<internal::IterTypeFromIterabl
 }
 
 namespace internal {
+template<class Iterator, class OutputIterator>
+LZ_CONSTEXPR_CXX_20 OutputIterator
+sinkCopyImpl(std::true_type /* hasForEachWhile */, Iterator begin, const Iterator& end, OutputIterator outputIterator) {
+    CopySink<OutputIterator> sink{ outputIterator };
+    forEachWhile(std::move(begin), end, sink);
+    return outputIterator;
+}
+
+template<class Iterator, class OutputIterator>
+LZ_CONSTEXPR_CXX_20 OutputIterator
+copyContiguous(std::true_type /* isMemcpyable */, Iterator begin, const Iterator& end, OutputIterator outputIterator) {
+    if (isConstantEvaluated()) {
+        return std::copy(std::move(begin), end, std::move(outputIterator));
+    }
+    return memCopy(begin, end, std::move(outputIterator));
+}
+
+template<class Iterator, class OutputIterator>
+LZ_CONSTEXPR_CXX_20 OutputIterator
+copyContiguous(std::false_type /* isMemcpyable */, Iterator begin, const Iterator& end, OutputIterator outputIterator) {
+    return std::copy(std::move(begin), end, std::move(outputIterator));
+}
+
+template<class Iterator, class OutputIterator>
+LZ_CONSTEXPR_CXX_20 OutputIterator
+sinkCopyImpl(std::false_type /* hasForEachWhile */, Iterator begin, const Iterator& end, OutputIterator outputIterator) {
+    return copyContiguous(IsMemcpyable<Iterator, OutputIterator>(), std::move(begin), end, std::move(outputIterator));
+}
+
+template<class OutputIterator>
+struct CopySegmentSink {
+    OutputIterator& outputIterator;
+
+    template<class I>
+    LZ_CONSTEXPR_CXX_20 void operator()(I begin, const I& end) {
+        outputIterator = sinkCopyImpl(HasForEachWhile<I>(), std::move(begin), end, std::move(outputIterator));
+    }
+
+    // A segment of one repeated value, for e.g. `lz::repeat` or a run of `lz::unrle`, is a fill, which compilers turn into a
+    // memset for bytes and into stores of a broadcast vector otherwise
+    template<class T>
+    LZ_CONSTEXPR_CXX_20 void operator()(const RepeatIterator<T> begin, const RepeatIterator<T>& end) {
+        outputIterator = std::fill_n(std::move(outputIterator), end - begin, *begin);
+    }
+};
+
+template<class Iterator, class OutputIterator>
+LZ_CONSTEXPR_CXX_20 OutputIterator sinkCopy(Iterator begin, const Iterator& end, OutputIterator outputIterator) {
+    CopySegmentSink<OutputIterator> sink{ outputIterator };
+    forEachSegment(std::move(begin), end, sink);
+    return outputIterator;
+}
+
+// Appends every segment using the range insert of the container, if it has one, which is a plain copy for trivial types
+template<class Container>
+struct InsertSegmentSink {
+    Container& container;
+
+    template<class I>
+    LZ_CONSTEXPR_CXX_20 auto insert(I begin, const I& end, int) -> decltype((void)container.insert(container.end(), begin, end)) {
+        container.insert(container.end(), std::move(begin), end);
+    }
+
+    template<class I>
+    LZ_CONSTEXPR_CXX_20 void insert(I begin, const I& end, long) {
+        sinkCopy(std::move(begin), end, std::inserter(container, container.end()));
+    }
+
+    template<class T>
+    LZ_CONSTEXPR_CXX_20 auto fill(const RepeatIterator<T>& begin, const RepeatIterator<T>& end, int)
+        -> decltype((void)container.insert(container.end(), std::size_t{}, *begin)) {
+        container.insert(container.end(), static_cast<std::size_t>(end - begin), *begin);
+    }
+
+    template<class T>
+    LZ_CONSTEXPR_CXX_20 void fill(const RepeatIterator<T>& begin, const RepeatIterator<T>& end, long) {
+        insert(begin, end, 0);
+    }
+
+    template<class I>
+    LZ_CONSTEXPR_CXX_20 void operator()(I begin, const I& end) {
+        insert(std::move(begin), end, 0);
+    }
+
+    // A segment of one repeated value is appended with the fill insert of the container, see CopySegmentSink
+    template<class T>
+    LZ_CONSTEXPR_CXX_20 void operator()(const RepeatIterator<T> begin, const RepeatIterator<T>& end) {
+        fill(begin, end, 0);
+    }
+};
+
+template<class Container, class Iterator>
+LZ_CONSTEXPR_CXX_20 void
+insertSegments(std::true_type /* hasForEachSegment */, Container& container, Iterator begin, const Iterator& end) {
+    if (!container.empty()) {
+        sinkCopy(std::move(begin), end, std::inserter(container, container.begin()));
+        return;
+    }
+    InsertSegmentSink<Container> sink{ container };
+    forEachSegment(std::move(begin), end, sink);
+}
+
+template<class Container, class Iterator>
+LZ_CONSTEXPR_CXX_20 void
+insertContiguous(std::true_type /* isContiguous */, Container& container, const Iterator& begin, const Iterator& end) {
+    // A contiguous range is inserted as a range of pointers, which the container copies at once for trivial types
+    if (!container.empty()) {
+        sinkCopy(begin, end, std::inserter(container, container.begin()));
+        return;
+    }
+    const auto first = contiguousData(begin, end);
+    InsertSegmentSink<Container> sink{ container };
+    sink(first, first + (end - begin));
+}
+
+template<class Container, class Iterator>
+LZ_CONSTEXPR_CXX_20 void
+insertContiguous(std::false_type /* isContiguous */, Container& container, Iterator begin, const Iterator& end) {
+    sinkCopy(std::move(begin), end, std::inserter(container, container.begin()));
+}
+
+// Repeated, generated and range values have their amount up front and don't depend on other ranges. An empty container
+// therefore takes them in one fill or range insert, which constructs the elements in place without checking the capacity for
+// every one
+template<class Container, class Iterator>
+LZ_CONSTEXPR_CXX_20 void insertSized(Container& container, Iterator begin, const Iterator& end) {
+    if (!container.empty()) {
+        sinkCopy(std::move(begin), end, std::inserter(container, container.begin()));
+        return;
+    }
+    InsertSegmentSink<Container> sink{ container };
+    sink(std::move(begin), end);
+}
+
+template<class Container, class T>
+LZ_CONSTEXPR_CXX_20 void insertContiguous(std::false_type /* isContiguous */, Container& container, RepeatIterator<T> begin,
+                                          const RepeatIterator<T>& end) {
+    insertSized(container, std::move(begin), end);
+}
+
+template<class Container, class GeneratorFunc>
+LZ_CONSTEXPR_CXX_20 void insertContiguous(std::false_type /* isContiguous */, Container& container,
+                                          GenerateIterator<GeneratorFunc> begin, const GenerateIterator<GeneratorFunc>& end) {
+    insertSized(container, std::move(begin), end);
+}
+
+// The values are computed from their index, so this is a loop of independent `start + i * step` stores, which vectorizes
+template<class Container, class Arithmetic>
+LZ_CONSTEXPR_CXX_20 void insertContiguous(std::false_type /* isContiguous */, Container& container,
+                                          RangeIterator<Arithmetic> begin, const RangeIterator<Arithmetic>& end) {
+    insertSized(container, std::move(begin), end);
+}
+
+template<class Container, class Iterator>
+LZ_CONSTEXPR_CXX_20 void
+insertSegments(std::false_type /* hasForEachSegment */, Container& container, Iterator begin, const Iterator& end) {
+    insertContiguous(IsContiguousIterator<Iterator>(), container, std::move(begin), end);
+}
+
 #    if defined(LZ_STANDALONE) && !defined(LZ_HAS_FORMAT)
 #        ifdef __cpp_if_constexpr
 template<class T>
@@ -175,49 +352,183 @@ std::string makeString(const T value) {
 }
 #        endif // __cpp_if_constexpr
 
-template<class Iterator>
+template<class String, class Iterator>
 EnableIf<std::is_arithmetic<ValueType<Iterator>>::value>
-toStringImplSpecialized(std::string& result, Iterator begin, Iterator end, const StringView& delimiter) {
+toStringImplSpecialized(String& result, Iterator begin, Iterator end, const StringView& delimiter) {
     std::for_each(begin, end, [&delimiter, &result](const ValueType<Iterator>& vt) {
-        result += makeString(vt);
-        result += delimiter;
+        const std::string value = makeString(vt);
+        result.append(value.data(), value.size());
+        result.append(delimiter.data(), delimiter.size());
     });
 }
 
-template<class Iterator>
+template<class String, class Iterator>
 EnableIf<!std::is_arithmetic<ValueType<Iterator>>::value>
-toStringImplSpecialized(std::string& result, Iterator begin, Iterator end, const StringView& delimiter) {
+toStringImplSpecialized(String& result, Iterator begin, Iterator end, const StringView& delimiter) {
     std::ostringstream oss;
     std::for_each(begin, end, [&oss, &delimiter](const ValueType<Iterator>& t) { oss << t << delimiter; });
-    result = oss.str();
+    const std::string joined = oss.str();
+    result.append(joined.data(), joined.size());
 }
 #    endif // defined(LZ_STANDALONE) && !defined(LZ_HAS_FORMAT)
 
+// How toString joins the elements of a view with the default "{}" format. Strings and integers are appended to the result
+// directly, instead of formatting every element using a dynamic format string
+enum class JoinStrategy { format, strings, integers };
+
+template<JoinStrategy Strategy>
+using JoinStrategyTag = std::integral_constant<JoinStrategy, Strategy>;
+
+template<class T>
+struct IsJoinableString
+    : std::integral_constant<bool, std::is_same<T, std::string>::value || std::is_same<T, StringView>::value> {};
+
+// Character types are excluded, as they are formatted as characters rather than as numbers
+template<class T>
+struct IsJoinableInteger
+    : std::integral_constant<bool, std::is_integral<T>::value && !std::is_same<T, bool>::value && !std::is_same<T, char>::value &&
+                                       !std::is_same<T, signed char>::value && !std::is_same<T, unsigned char>::value &&
+                                       !std::is_same<T, wchar_t>::value && !std::is_same<T, char16_t>::value &&
+                                       !std::is_same<T, char32_t>::value> {};
+
 template<class Iterator>
+using JoinStrategyOf = JoinStrategyTag<IsJoinableString<Decay<ValueType<Iterator>>>::value    ? JoinStrategy::strings
+                                       : IsJoinableInteger<Decay<ValueType<Iterator>>>::value ? JoinStrategy::integers
+                                                                                               : JoinStrategy::format>;
+
+template<class String>
+void appendDelimiter(String& result, const StringView& delimiter) {
+    result.append(delimiter.data(), delimiter.size());
+}
+
+// Strings that are references can be visited twice cheaply, so the exact length of the result is computed up front
+template<class String, class Iterator>
+void reserveJoinedStrings(std::true_type /* isCheapToVisitTwice */, String& result, Iterator begin, const Iterator& end,
+                          const StringView& delimiter) {
+    std::size_t length = 0;
+    std::size_t count = 0;
+    for (; begin != end; ++begin) {
+        length += (*begin).size();
+        ++count;
+    }
+    result.reserve(result.size() + length + (count - 1) * delimiter.size());
+}
+
+template<class String, class Iterator>
+void reserveJoinedStrings(std::false_type /* isCheapToVisitTwice */, String&, Iterator, const Iterator&, const StringView&) {
+}
+
+// Not used, only for when it is a runtime choice whether the elements need to be formatted
+template<class String, class Iterator>
+void appendJoined(JoinStrategyTag<JoinStrategy::format>, String&, Iterator, const Iterator&, const StringView&) {
+}
+
+template<class String, class Iterator>
+void appendJoined(JoinStrategyTag<JoinStrategy::strings>, String& result, Iterator begin, const Iterator& end,
+                  const StringView& delimiter) {
+    using IsCheapToVisitTwice =
+        std::integral_constant<bool, std::is_reference<RefType<Iterator>>::value && IsForward<Iterator>::value>;
+    reserveJoinedStrings(IsCheapToVisitTwice(), result, begin, end, delimiter);
+    auto&& first = *begin;
+    result.append(first.data(), first.size());
+    for (++begin; begin != end; ++begin) {
+        auto&& string = *begin;
+        appendDelimiter(result, delimiter);
+        result.append(string.data(), string.size());
+    }
+}
+
+template<class Integral>
+constexpr bool isNegative(std::true_type /* isSigned */, const Integral value) noexcept {
+    return value < 0;
+}
+
+template<class Integral>
+constexpr bool isNegative(std::false_type /* isSigned */, const Integral) noexcept {
+    return false;
+}
+
+template<class String, class Integral>
+void appendInteger(String& result, const Integral value) {
+    using Unsigned = typename std::make_unsigned<Integral>::type;
+    char buffer[std::numeric_limits<Unsigned>::digits10 + 2];
+    char* const last = std::end(buffer);
+    char* first = last;
+    const bool negative = isNegative(std::is_signed<Integral>(), value);
+    auto magnitude = static_cast<Unsigned>(value);
+    if (negative) {
+        magnitude = static_cast<Unsigned>(Unsigned{ 0 } - magnitude);
+    }
+    do {
+        *--first = static_cast<char>('0' + magnitude % 10);
+        magnitude = static_cast<Unsigned>(magnitude / 10);
+    } while (magnitude != 0);
+    if (negative) {
+        *--first = '-';
+    }
+    result.append(first, last);
+}
+
+// The length of the result is estimated from the length of the first integer and the (lower bound of the) amount of integers
+template<class String, class Iterator>
+void appendJoined(JoinStrategyTag<JoinStrategy::integers>, String& result, Iterator begin, const Iterator& end,
+                  const StringView& delimiter) {
+    const std::size_t count = sizeHint(begin, end).lower;
+    const std::size_t before = result.size();
+    appendInteger(result, *begin);
+    if (count > 1) {
+        result.reserve(result.size() + (count - 1) * (result.size() - before + delimiter.size()));
+    }
+    for (++begin; begin != end; ++begin) {
+        appendDelimiter(result, delimiter);
+        appendInteger(result, *begin);
+    }
+}
+
+#    if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+constexpr bool isDefaultFormat(const StringView fmt) noexcept {
+    return fmt.size() == 2 && fmt.data()[0] == '{' && fmt.data()[1] == '}';
+}
+#    endif // defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+
+template<class String, class Iterator>
 LZ_CONSTEXPR_CXX_20 void
 #    if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
-toStringImpl(std::string& result, const Iterator& begin, const Iterator& end, const StringView delimiter, const StringView fmt) {
+toStringImpl(String& result, const Iterator& begin, const Iterator& end, const StringView delimiter, const StringView fmt) {
 #    else
-toStringImpl(std::string& result, const Iterator& begin, const Iterator& end, const StringView& delimiter) {
+toStringImpl(String& result, const Iterator& begin, const Iterator& end, const StringView& delimiter) {
 #    endif // LZ_HAS_FORMAT
     if (begin == end) {
         return;
     }
+    using Strategy = JoinStrategyOf<Iterator>;
+#    if !defined(LZ_STANDALONE) || defined(LZ_HAS_FORMAT)
+    if (Strategy::value != JoinStrategy::format && isDefaultFormat(fmt)) {
+        appendJoined(Strategy(), result, begin, end, delimiter);
+        return;
+    }
+#    else
+    if (Strategy::value != JoinStrategy::format) {
+        appendJoined(Strategy(), result, begin, end, delimiter);
+        return;
+    }
+#    endif // !defined(LZ_STANDALONE) || defined(LZ_HAS_FORMAT)
 #    if !defined(LZ_STANDALONE) || defined(LZ_HAS_FORMAT)
     auto backInserter = std::back_inserter(result);
-    // Dynamic format merge with the `fmt` and the "{}" for the delimiter
-    std::string format;
+    // Dynamic format merge with the `fmt` and the "{}" for the delimiter. It uses the allocator of the result, so that it comes
+    // from the same arena if the result does
+    String format(result.get_allocator());
     format.reserve(3 + fmt.size());
     format.append(fmt.data(), fmt.size());
     format += "{}";
 #    endif // !defined(LZ_STANDALONE) || defined(LZ_HAS_FORMAT)
 #    if !defined(LZ_STANDALONE)
     std::for_each(begin, end, [&delimiter, backInserter, &format](const ValueType<Iterator>& v) {
-        fmt::format_to(backInserter, format.c_str(), v, delimiter);
+        fmt::format_to(backInserter, LZ_FMT_RUNTIME(format), v, delimiter);
     });
 #    elif defined(LZ_HAS_FORMAT)
     std::for_each(begin, end, [&delimiter, backInserter, &format](const ValueType<Iterator>& v) {
-        std::format_to(backInserter, format.c_str(), v, delimiter);
+        std::vformat_to(backInserter, format, std::make_format_args(v, delimiter));
     });
     // clang-format off
 #else
@@ -228,43 +539,235 @@ toStringImpl(std::string& result, const Iterator& begin, const Iterator& end, co
     result.erase(resultEnd - static_cast<std::ptrdiff_t>(delimiter.size()), resultEnd);
 }
 
-template<class Iterator>
-LZ_CONSTEXPR_CXX_20 internal::EnableIf<std::is_same<char, ValueType<Iterator>>::value, std::string>
+#    ifndef LZ_STANDALONE
+// A format that is not a string, e.g. `FMT_COMPILE("{}")`. It is passed to fmt as is, and only formats the element, so that the
+// format doesn't have to be merged with the one of the delimiter at runtime
+template<class Format>
+struct IsStaticFormat : std::integral_constant<bool, !std::is_convertible<Format, StringView>::value> {};
+
+template<class String, class Iterator, class Format>
+void toStringStaticFormatImpl(String& result, Iterator begin, const Iterator& end, const StringView delimiter,
+                              const Format& format) {
+    if (begin == end) {
+        return;
+    }
+    auto backInserter = std::back_inserter(result);
+    fmt::format_to(backInserter, format, *begin);
+    for (++begin; begin != end; ++begin) {
+        appendDelimiter(result, delimiter);
+        fmt::format_to(backInserter, format, *begin);
+    }
+}
+#    endif // LZ_STANDALONE
+
+// Appends the elements of [b, e) to `result`, so that a string can be reused to join several views without reallocating
+template<class String, class Iterator>
+LZ_CONSTEXPR_CXX_20 internal::EnableIf<std::is_same<char, ValueType<Iterator>>::value>
 #    if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
-doMakeString(const Iterator& b, const Iterator& e, const StringView delimiter, const StringView fmt) {
+appendString(String& result, const Iterator& b, const Iterator& e, const StringView delimiter, const StringView fmt) {
 #    else
-doMakeString(const Iterator& b, const Iterator& e, const StringView& delimiter) {
+appendString(String& result, const Iterator& b, const Iterator& e, const StringView& delimiter) {
 #    endif // LZ_HAS_FORMAT
     if (delimiter.size() == 0) {
-        return std::string(b, e);
+        result.append(b, e);
+        return;
     }
-    std::string result;
-
     const auto len = static_cast<std::size_t>(getIterLength(b, e));
-    result.reserve(len + delimiter.size() * len + 1);
+    result.reserve(result.size() + len + delimiter.size() * len + 1);
 
 #    if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
     toStringImpl(result, b, e, delimiter, fmt);
 #    else
     toStringImpl(result, b, e, delimiter);
 #    endif
-    return result;
 }
 
+template<class String, class Iterator>
+LZ_CONSTEXPR_CXX_20 internal::EnableIf<!std::is_same<char, ValueType<Iterator>>::value>
+#    if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+appendString(String& result, const Iterator& b, const Iterator& e, const StringView delimiter, const StringView fmt) {
+    toStringImpl(result, b, e, delimiter, fmt);
+}
+#    else
+appendString(String& result, const Iterator& b, const Iterator& e, const StringView& delimiter) {
+    toStringImpl(result, b, e, delimiter);
+}
+#    endif // LZ_HAS_FORMAT
+
 template<class Iterator>
-LZ_CONSTEXPR_CXX_20 internal::EnableIf<!std::is_same<char, ValueType<Iterator>>::value, std::string>
+LZ_CONSTEXPR_CXX_20 std::string
 #    if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
 doMakeString(const Iterator& b, const Iterator& e, const StringView delimiter, const StringView fmt) {
+    std::string result;
+    appendString(result, b, e, delimiter, fmt);
+    return result;
+}
 #    else
 doMakeString(const Iterator& b, const Iterator& e, const StringView& delimiter) {
-#    endif // LZ_HAS_FORMAT
     std::string result;
+    appendString(result, b, e, delimiter);
+    return result;
+}
+#    endif // LZ_HAS_FORMAT
+
+template<class OutputIterator>
+OutputIterator copyDelimiter(OutputIterator out, const StringView& delimiter) {
+    return std::copy(delimiter.data(), delimiter.data() + delimiter.size(), out);
+}
+
+#    ifndef LZ_STANDALONE
+// Formats every element of [begin, end) with `format`, which only formats the element, straight into `out`
+template<class Iterator, class OutputIterator, class Format>
+OutputIterator formatElementsTo(OutputIterator out, Iterator begin, const Iterator& end, const StringView delimiter,
+                                const Format& format) {
+    if (begin == end) {
+        return out;
+    }
+    out = fmt::format_to(out, format, *begin);
+    for (++begin; begin != end; ++begin) {
+        out = copyDelimiter(out, delimiter);
+        out = fmt::format_to(out, format, *begin);
+    }
+    return out;
+}
+
+template<class Iterator, class OutputIterator>
+OutputIterator formatToImpl(OutputIterator out, const Iterator& begin, const Iterator& end, const StringView delimiter,
+                            const StringView format) {
+    // The default format is compiled, so that e.g. integers and strings are written without parsing a format at runtime
+    if (isDefaultFormat(format)) {
+        return formatElementsTo(out, begin, end, delimiter, FMT_COMPILE("{}"));
+    }
+    return formatElementsTo(out, begin, end, delimiter, LZ_FMT_RUNTIME(format));
+}
+#    elif defined(LZ_HAS_FORMAT)
+template<class Iterator, class OutputIterator>
+OutputIterator
+formatToImpl(OutputIterator out, Iterator begin, const Iterator& end, const StringView delimiter, const StringView fmt) {
+    if (begin == end) {
+        return out;
+    }
+    auto&& first = *begin;
+    out = std::vformat_to(out, fmt, std::make_format_args(first));
+    for (++begin; begin != end; ++begin) {
+        auto&& value = *begin;
+        out = copyDelimiter(out, delimiter);
+        out = std::vformat_to(out, fmt, std::make_format_args(value));
+    }
+    return out;
+}
+#    else
+template<class Iterator, class OutputIterator>
+OutputIterator formatToImpl(OutputIterator out, const Iterator& begin, const Iterator& end, const StringView& delimiter) {
+    const std::string result = doMakeString(begin, end, delimiter);
+    return std::copy(result.begin(), result.end(), out);
+}
+#    endif // LZ_STANDALONE
+
+// Formats a single element into `result`
+#    ifndef LZ_STANDALONE
+template<class String, class T>
+void appendFormatted(String& result, const T& value, const StringView fmt) {
+    if (isDefaultFormat(fmt)) {
+        fmt::format_to(std::back_inserter(result), FMT_COMPILE("{}"), value);
+        return;
+    }
+    fmt::format_to(std::back_inserter(result), LZ_FMT_RUNTIME(fmt), value);
+}
+#    elif defined(LZ_HAS_FORMAT)
+template<class String, class T>
+void appendFormatted(String& result, const T& value, const StringView fmt) {
+    std::vformat_to(std::back_inserter(result), fmt, std::make_format_args(value));
+}
+#    else
+template<class String, class T>
+EnableIf<std::is_arithmetic<T>::value> appendFormatted(String& result, const T& value) {
+    const std::string string = makeString(value);
+    result.append(string.data(), string.size());
+}
+
+template<class String, class T>
+EnableIf<!std::is_arithmetic<T>::value> appendFormatted(String& result, const T& value) {
+    std::ostringstream oss;
+    oss << value;
+    const std::string string = oss.str();
+    result.append(string.data(), string.size());
+}
+#    endif // LZ_STANDALONE
+
+// Strings and integers are appended without formatting them if the format is the default one, like toString does
 #    if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
-    toStringImpl(result, b, e, delimiter, fmt);
+template<class String, class T>
+void appendElement(JoinStrategyTag<JoinStrategy::format>, String& result, const T& value, const StringView fmt) {
+    appendFormatted(result, value, fmt);
+}
+
+template<class String, class T>
+void appendElement(JoinStrategyTag<JoinStrategy::strings>, String& result, const T& value, const StringView fmt) {
+    if (isDefaultFormat(fmt)) {
+        result.append(value.data(), value.size());
+        return;
+    }
+    appendFormatted(result, value, fmt);
+}
+
+template<class String, class T>
+void appendElement(JoinStrategyTag<JoinStrategy::integers>, String& result, const T& value, const StringView fmt) {
+    if (isDefaultFormat(fmt)) {
+        appendInteger(result, value);
+        return;
+    }
+    appendFormatted(result, value, fmt);
+}
 #    else
-    toStringImpl(result, b, e, delimiter);
-#    endif
-    return result;
+template<class String, class T>
+void appendElement(JoinStrategyTag<JoinStrategy::format>, String& result, const T& value) {
+    appendFormatted(result, value);
+}
+
+template<class String, class T>
+void appendElement(JoinStrategyTag<JoinStrategy::strings>, String& result, const T& value) {
+    result.append(value.data(), value.size());
+}
+
+template<class String, class T>
+void appendElement(JoinStrategyTag<JoinStrategy::integers>, String& result, const T& value) {
+    appendInteger(result, value);
+}
+#    endif // defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+
+// Formats the elements of [begin, end) into a buffer of one block, that is passed to `sink` and then reused every time it is
+// full. Unlike toString, only one block is held in memory at a time, however long the view is
+template<class Sink, class Iterator>
+#    if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+void writeToImpl(const Sink& sink, Iterator begin, const Iterator& end, const StringView delimiter, const StringView fmt) {
+#    else
+void writeToImpl(const Sink& sink, Iterator begin, const Iterator& end, const StringView& delimiter) {
+#    endif // defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+    if (begin == end) {
+        return;
+    }
+    using Strategy = JoinStrategyOf<Iterator>;
+    std::string buffer;
+    buffer.reserve(defaultWriteBlockSize);
+#    if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+    appendElement(Strategy(), buffer, *begin, fmt);
+#    else
+    appendElement(Strategy(), buffer, *begin);
+#    endif // defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+    for (++begin; begin != end; ++begin) {
+        if (buffer.size() >= defaultWriteBlockSize) {
+            sink(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+        appendDelimiter(buffer, delimiter);
+#    if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+        appendElement(Strategy(), buffer, *begin, fmt);
+#    else
+        appendElement(Strategy(), buffer, *begin);
+#    endif // defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+    }
+    sink(buffer.data(), buffer.size());
 }
 
 template<class T, class = int>
@@ -279,6 +782,30 @@ struct HasReserve : std::false_type {};
 template<class T>
 struct HasReserve<T, decltype((void)std::declval<T&>().reserve(1), 0)> : std::true_type {};
 
+template<class T, class = int>
+struct HasShrinkToFit : std::false_type {};
+
+template<class T>
+struct HasShrinkToFit<T, decltype((void)std::declval<T&>().shrink_to_fit(), 0)> : std::true_type {};
+
+template<class Container>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasReserve<Container>::value> reserveUpperBound(Container&, const SizeHint) {
+}
+
+template<class Container>
+LZ_CONSTEXPR_CXX_20 EnableIf<HasReserve<Container>::value> reserveUpperBound(Container& container, const SizeHint hint) {
+    container.reserve(container.size() + (hint.upper != unknownSize ? hint.upper : hint.lower));
+}
+
+template<class Container>
+LZ_CONSTEXPR_CXX_20 EnableIf<!HasShrinkToFit<Container>::value> shrinkToFit(Container&) {
+}
+
+template<class Container>
+LZ_CONSTEXPR_CXX_20 EnableIf<HasShrinkToFit<Container>::value> shrinkToFit(Container& container) {
+    container.shrink_to_fit();
+}
+
 template<class LzIterator>
 class BasicIteratorView {
 protected:
@@ -296,20 +823,21 @@ private:
     template<class KeySelectorFunc>
     using KeyType = FunctionReturnType<KeySelectorFunc, RefType<LzIterator>>;
 
+    // Only reserves if the length can be computed without iterating over the whole sequence (see `IsSized`)
 #    ifndef __cpp_if_constexpr
     template<class Container>
-    EnableIf<!HasReserve<Container>::value, void> tryReserve(Container&) const {
+    EnableIf<!HasReserve<Container>::value || !IsSized<LzIterator>::value, void> tryReserve(Container&) const {
     }
 
     template<class Container>
-    EnableIf<HasReserve<Container>::value, void> tryReserve(Container& container) const {
-        container.reserve(size());
+    EnableIf<HasReserve<Container>::value && IsSized<LzIterator>::value, void> tryReserve(Container& container) const {
+        container.reserve(container.size() + static_cast<std::size_t>(size()));
     }
 #    else
     template<class Container>
     LZ_CONSTEXPR_CXX_20 void tryReserve(Container& container) const {
-        if constexpr (HasReserve<Container>::value) {
-            container.reserve(size());
+        if constexpr (HasReserve<Container>::value && IsSized<LzIterator>::value) {
+            container.reserve(container.size() + static_cast<std::size_t>(size()));
         }
     }
 #    endif // __cpp_if_constexpr
@@ -319,6 +847,20 @@ private:
                     [keyGen](internal::RefType<LzIterator> value) { return std::make_pair(keyGen(value), value); });
     }
 
+    template<class Allocator>
+    std::vector<value_type, Allocator>
+    poolToVector(std::true_type /* isRandomAccess */, const Allocator& allocator, const execution::PoolPolicy& policy) const {
+        std::vector<value_type, Allocator> vector(static_cast<std::size_t>(_end - _begin), allocator);
+        copyTo(vector.begin(), policy);
+        return vector;
+    }
+
+    template<class Allocator>
+    std::vector<value_type, Allocator>
+    poolToVector(std::false_type /* isRandomAccess */, const Allocator& allocator, const execution::PoolPolicy&) const {
+        return to<std::vector<value_type, Allocator>>(MaterializePolicy::reserveUpperBound, allocator);
+    }
+
 public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 LzIterator begin() LZ_CONST_REF_QUALIFIER noexcept {
         return _begin;
@@ -390,8 +932,8 @@ public:
         Container container(std::forward<Args>(args)...);
         tryReserve(container);
         if constexpr (internal::IsSequencedPolicyV<Execution>) {
-            tryReserve(container);
-            copyTo(std::inserter(container, container.begin()), execution);
+            static_cast<void>(execution);
+            internal::insertSegments(HasForEachSegment<LzIterator>(), container, _begin, _end);
         }
         else {
             static_assert(HasResize<Container>::value, "Container needs to have a method resize() in order to use parallel "
@@ -411,12 +953,20 @@ public:
     template<class OutputIterator, class Execution = std::execution::sequenced_policy>
     LZ_CONSTEXPR_CXX_20 void copyTo(OutputIterator outputIterator, Execution execution = std::execution::seq) const {
         if constexpr (internal::checkForwardAndPolicies<Execution, OutputIterator>()) {
-            std::copy(_begin, _end, outputIterator);
+            internal::sinkCopy(_begin, _end, std::move(outputIterator));
         }
         else {
             static_assert(IsForward<LzIterator>::value,
                           "The iterator type must be forward iterator or stronger. Prefer using std::execution::seq");
-            std::copy(execution, _begin, _end, outputIterator);
+            // Lazy iterators are often not recognized by the standard parallel backends, so random access views are split
+            // by index manually, on the pool of lz::execution::pool()
+            if constexpr (IsRandomAccess<LzIterator>::value && IsRandomAccess<OutputIterator>::value) {
+                static_cast<void>(execution);
+                internal::poolCopy(std::true_type(), _begin, _end, outputIterator, execution::pool().pool());
+            }
+            else {
+                std::copy(execution, _begin, _end, outputIterator);
+            }
         }
     }
 
@@ -460,9 +1010,10 @@ public:
      * @param alloc The allocator.
      * @return A new `std::vector<value_type, Allocator>`.
      */
-    template<class Allocator, class Execution = std::execution::sequenced_policy>
+    template<class Allocator, class Execution = std::execution::sequenced_policy,
+             class = EnableIf<!std::is_execution_policy<Allocator>::value>>
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 std::vector<value_type, Allocator>
-    toVector(const Allocator& alloc, Execution execution) const {
+    toVector(const Allocator& alloc, Execution execution = std::execution::seq) const {
         return to<std::vector>(execution, alloc);
     }
 
@@ -518,7 +1069,7 @@ public:
     Container to(Args&&... args) const {
         Container cont(std::forward<Args>(args)...);
         tryReserve(cont);
-        copyTo(std::inserter(cont, cont.begin()));
+        internal::insertSegments(HasForEachSegment<LzIterator>(), cont, _begin, _end);
         return cont;
     }
 
@@ -528,8 +1079,8 @@ public:
      * `std::copy(lzView.begin(), lzView.end(), myContainer.begin());`
      */
     template<class OutputIterator>
-    void copyTo(OutputIterator outputIterator) const {
-        std::copy(_begin, _end, outputIterator);
+    LZ_CONSTEXPR_CXX_20 void copyTo(OutputIterator outputIterator) const {
+        internal::sinkCopy(_begin, _end, std::move(outputIterator));
     }
 
     /**
@@ -561,7 +1112,7 @@ public:
      */
     template<class Allocator>
     std::vector<value_type, Allocator> toVector(const Allocator& alloc = Allocator()) const {
-        return to<std::vector, Allocator>(alloc);
+        return to<std::vector>(alloc);
     }
 
     /**
@@ -571,13 +1122,114 @@ public:
      * @throws `std::out_of_range` if the size of the iterator is bigger than `N`.
      */
     template<std::size_t N>
-    std::array<value_type, N> toArray() const {
+    LZ_CONSTEXPR_CXX_20 std::array<value_type, N> toArray() const {
         std::array<value_type, N> cont{};
         copyTo(cont.begin());
         return cont;
     }
 #    endif // LZ_HAS_EXECUTION
 
+    /**
+     * @brief Creates a new container from the current view, using the materialization policy `policy`. See the other `to`
+     * function overloads for more documentation.
+     * @details If the size of the view is known beforehand, the container is always reserved exactly. Otherwise, with
+     * `MaterializePolicy::reserveUpperBound`, the upper bound of `sizeHint()` is reserved and the container is shrunk to fit
+     * afterwards. This prevents repeated reallocations when, for e.g. a filter keeps most of its elements. With
+     * `MaterializePolicy::geometric` the container grows on its own.
+     * @param policy The materialization policy.
+     * @param args Additional container args. Must be compatible with the constructor of `Container`
+     * @return The container.
+     */
+    template<class Container, class... Args>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Container to(const MaterializePolicy policy, Args&&... args) const {
+        Container container(std::forward<Args>(args)...);
+        if (policy == MaterializePolicy::geometric || IsSized<LzIterator>::value) {
+            tryReserve(container);
+            internal::insertSegments(HasForEachSegment<LzIterator>(), container, _begin, _end);
+            return container;
+        }
+        internal::reserveUpperBound(container, sizeHint());
+        internal::insertSegments(HasForEachSegment<LzIterator>(), container, _begin, _end);
+        internal::shrinkToFit(container);
+        return container;
+    }
+
+    /**
+     * @brief Creates a new container from the current view, using the materialization policy `policy`. The value type of
+     * the container is equal to `value_type`. See the other `to` function overloads for more documentation.
+     * @param policy The materialization policy.
+     * @param args Additional container args. Must be compatible with the constructor of `Container`
+     * @return The container.
+     */
+    template<template<class, class...> class Container, class... Args>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Container<value_type, Decay<Args>...>
+    to(const MaterializePolicy policy, Args&&... args) const {
+        using Cont = Container<value_type, Decay<Args>...>;
+        return to<Cont>(policy, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Creates a new `std::vector<value_type>` of the sequence, using the materialization policy `policy`.
+     * @param policy The materialization policy.
+     * @return A `std::vector<value_type>` with the sequence.
+     */
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 std::vector<value_type> toVector(const MaterializePolicy policy) const {
+        return to<std::vector<value_type>>(policy);
+    }
+
+    /**
+     * @brief Copies the sequence to `outputIterator` on the threads of `policy`. Only if both the view and `outputIterator`
+     * are random access, the sequence is split up between the threads, otherwise it is copied on the calling thread.
+     * @param outputIterator The output to copy to, which must be able to hold `size()` elements.
+     * @param policy The pool to run on, for instance `lz::execution::pool()`.
+     */
+    template<class OutputIterator>
+    void copyTo(OutputIterator outputIterator, const execution::PoolPolicy& policy) const {
+        using IsParallel =
+            std::integral_constant<bool, IsRandomAccess<LzIterator>::value && IsRandomAccess<OutputIterator>::value>;
+        internal::poolCopy(IsParallel(), _begin, _end, outputIterator, policy.pool());
+    }
+
+    /**
+     * @brief Transforms the sequence to `outputIterator` on the threads of `policy`. Only if both the view and
+     * `outputIterator` are random access, the sequence is split up between the threads, otherwise the calling thread does it.
+     * @param outputIterator The output to transform to, which must be able to hold `size()` elements.
+     * @param transformFunc The transform function, which is called from multiple threads at the same time.
+     * @param policy The pool to run on, for instance `lz::execution::pool()`.
+     */
+    template<class OutputIterator, class TransformFunc>
+    void transformTo(OutputIterator outputIterator, TransformFunc transformFunc, const execution::PoolPolicy& policy) const {
+        using IsParallel =
+            std::integral_constant<bool, IsRandomAccess<LzIterator>::value && IsRandomAccess<OutputIterator>::value>;
+        internal::poolTransform(IsParallel(), _begin, _end, outputIterator, transformFunc, policy.pool());
+    }
+
+    /**
+     * @brief Creates a new `std::vector<value_type>` of the sequence on the threads of `policy`. If the view is random access,
+     * the vector is default constructed with `size()` elements, that are then assigned in parallel. Otherwise, the vector is
+     * created on the calling thread.
+     * @param policy The pool to run on, for instance `lz::execution::pool()`.
+     * @return A `std::vector<value_type>` with the sequence.
+     */
+    LZ_NODISCARD std::vector<value_type> toVector(const execution::PoolPolicy& policy) const {
+        return poolToVector(IsRandomAccess<LzIterator>(), std::allocator<value_type>(), policy);
+    }
+
+    /**
+     * @brief Creates a new `std::vector<value_type, Allocator>` of the sequence on the threads of `policy`, like
+     * `toVector(policy)`. With an `lz::DefaultInitAllocator<value_type>`, the elements of trivial types are not written to
+     * before they are assigned in parallel, so that every thread is the first to write to its part of the vector, which the
+     * kernel then allocates on the NUMA node of that thread.
+     * @param allocator The allocator of the vector.
+     * @param policy The pool to run on, for instance `lz::execution::pool()`.
+     * @return A `std::vector<value_type, Allocator>` with the sequence.
+     */
+    template<class Allocator>
+    LZ_NODISCARD std::vector<value_type, Allocator>
+    toVector(const Allocator& allocator, const execution::PoolPolicy& policy) const {
+        return poolToVector(IsRandomAccess<LzIterator>(), allocator, policy);
+    }
+
     /**
      * Creates a `std::map<<keyGen return type, value_type[, Compare[, Allocator]]>`. The keyGen function generates the keys
      * for the `std::map`. The value type is the current type this view contains. (`typename decltype(view)::value_type`).
@@ -639,6 +1291,130 @@ public:
         // clang-format off
     }
 
+#    ifndef LZ_STANDALONE
+    /**
+     * Converts an iterator to a string, with a given delimiter and a format that is checked and compiled at compile time, which
+     * is faster than a runtime format string. Example: `lz::range(4).toString(", ", FMT_COMPILE("{:02}"))` yields
+     * 00, 01, 02, 03.
+     * @param delimiter The delimiter between the previous value and the next.
+     * @param format A compiled format string for a single element, e.g. `FMT_COMPILE("{:x}")`.
+     * @return The converted iterator in string format.
+     */
+    template<class Format, class = internal::EnableIf<internal::IsStaticFormat<Format>::value>>
+    LZ_NODISCARD std::string toString(const StringView delimiter, const Format& format) const {
+        std::string result;
+        internal::toStringStaticFormatImpl(result, _begin, _end, delimiter, format);
+        return result;
+    }
+#    endif // LZ_STANDALONE
+
+    /**
+     * Appends the elements to `result`, with a given delimiter. Unlike `toString`, no string is created, so a string can be
+     * reused (e.g. cleared and appended to again) to join many views without allocating every time. Example:
+     * `std::string s = "x: "; lz::range(3).appendTo(s, ", ");` makes `s` equal to `x: 0, 1, 2`. The string may have any
+     * allocator, for e.g. a `std::pmr::string` of which the memory comes from an arena. All temporary strings that are needed
+     * to join the elements are then allocated using the same allocator.
+     * @param result The string to append the elements to.
+     * @param delimiter The delimiter between the previous value and the next.
+     * @param fmt The format args. (`{}` is default, not applicable if std::format isn't available or LZ_STANDALONE is defined)
+     */
+#    if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+    template<class Traits, class Allocator>
+    LZ_CONSTEXPR_CXX_20 void appendTo(std::basic_string<char, Traits, Allocator>& result, const StringView delimiter = "",
+                                      const StringView fmt = "{}") const {
+        internal::appendString(result, _begin, _end, delimiter, fmt);
+    }
+#    else
+    template<class Traits, class Allocator>
+    LZ_CONSTEXPR_CXX_20 void appendTo(std::basic_string<char, Traits, Allocator>& result, const StringView delimiter = "") const {
+        internal::appendString(result, _begin, _end, delimiter);
+    }
+#    endif
+
+    /**
+     * Writes the elements to an output iterator, with a given delimiter, without creating a string in between. Example:
+     * `lz::range(3).formatTo(std::ostreambuf_iterator<char>(std::cout), ", ")` prints `0, 1, 2`.
+     * @param out The output iterator to write the characters to.
+     * @param delimiter The delimiter between the previous value and the next.
+     * @param fmt The format args. (`{}` is default, not applicable if std::format isn't available or LZ_STANDALONE is defined)
+     * @return The output iterator past the last written character.
+     */
+    template<class OutputIterator>
+#    if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+    OutputIterator formatTo(OutputIterator out, const StringView delimiter = "", const StringView fmt = "{}") const {
+        return internal::formatToImpl(std::move(out), _begin, _end, delimiter, fmt);
+    }
+#    else
+    OutputIterator formatTo(OutputIterator out, const StringView delimiter = "") const {
+        return internal::formatToImpl(std::move(out), _begin, _end, delimiter);
+    }
+#    endif
+
+#    ifndef LZ_STANDALONE
+    /**
+     * Writes the elements to an output iterator, with a given delimiter and a compiled format, e.g. `FMT_COMPILE("{:x}")`.
+     * @param out The output iterator to write the characters to.
+     * @param delimiter The delimiter between the previous value and the next.
+     * @param format A compiled format string for a single element.
+     * @return The output iterator past the last written character.
+     */
+    template<class OutputIterator, class Format, class = internal::EnableIf<internal::IsStaticFormat<Format>::value>>
+    OutputIterator formatTo(OutputIterator out, const StringView delimiter, const Format& format) const {
+        return internal::formatElementsTo(std::move(out), _begin, _end, delimiter, format);
+    }
+
+    /**
+     * Appends the elements to a `fmt::memory_buffer`, with a given delimiter. Short results stay in the inline storage of the
+     * buffer, so that no allocation is done at all.
+     * @param buffer The buffer to append the elements to.
+     * @param delimiter The delimiter between the previous value and the next.
+     * @param fmt The format args, `{}` by default.
+     */
+    template<std::size_t Size, class Allocator>
+    void appendTo(fmt::basic_memory_buffer<char, Size, Allocator>& buffer, const StringView delimiter = "",
+                  const StringView fmt = "{}") const {
+        formatTo(std::back_inserter(buffer), delimiter, fmt);
+    }
+#    endif // LZ_STANDALONE
+
+    /**
+     * Writes the elements to a file descriptor, with a given delimiter, without creating a string of the whole view. The
+     * elements are formatted into a buffer of 1 MiB, that is written with a single `write` whenever it is full and then reused,
+     * so that e.g. a CSV of millions of lines is written in big batches while only one block is held in memory. Example:
+     * `lz::map(rows, toCsvLine).writeTo(fd, "\n")`.
+     * @param fileDescriptor The file descriptor to write to, e.g. of a file, a pipe or a socket.
+     * @param delimiter The delimiter between the previous value and the next.
+     * @param fmt The format args. (`{}` is default, not applicable if std::format isn't available or LZ_STANDALONE is defined)
+     * @throws std::system_error If writing to the file descriptor fails.
+     */
+#    if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+    void writeTo(const int fileDescriptor, const StringView delimiter = "", const StringView fmt = "{}") const {
+        internal::writeToImpl(internal::FileDescriptorSink{ fileDescriptor }, _begin, _end, delimiter, fmt);
+    }
+#    else
+    void writeTo(const int fileDescriptor, const StringView delimiter = "") const {
+        internal::writeToImpl(internal::FileDescriptorSink{ fileDescriptor }, _begin, _end, delimiter);
+    }
+#    endif
+
+    /**
+     * Writes the elements to a `std::FILE`, with a given delimiter, without creating a string of the whole view. The elements
+     * are formatted into a buffer of 1 MiB, that is passed to a single `std::fwrite` whenever it is full and then reused.
+     * @param file The file to write to, e.g. of `std::fopen` or `stdout`.
+     * @param delimiter The delimiter between the previous value and the next.
+     * @param fmt The format args. (`{}` is default, not applicable if std::format isn't available or LZ_STANDALONE is defined)
+     * @throws std::system_error If writing to the file fails.
+     */
+#    if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+    void writeTo(std::FILE* file, const StringView delimiter = "", const StringView fmt = "{}") const {
+        internal::writeToImpl(internal::FileSink{ file }, _begin, _end, delimiter, fmt);
+    }
+#    else
+    void writeTo(std::FILE* file, const StringView delimiter = "") const {
+        internal::writeToImpl(internal::FileSink{ file }, _begin, _end, delimiter);
+    }
+#    endif
+
     /**
      * Function to stream the iterator to an output stream e.g. `std::cout`.
      * @param o The stream object.
@@ -649,6 +1425,11 @@ public:
         return o << it.toString(" ");
     }
 
+    //! The delimiter with which the view is printed by `operator<<` and `fmt::format`
+    friend StringView printDelimiter(const BasicIteratorView<LzIterator>&) {
+        return " ";
+    }
+
     /**
      * Returns the length of the view.
      * @return The length of the view.
@@ -665,6 +1446,27 @@ public:
         return static_cast<std::size_t>(distance());
     }
 
+    /**
+     * Returns a pointer to the first element, if the view is contiguous memory, so that it can be passed to functions that take
+     * a pointer and a length. Views that only narrow a range, such as `lz::take`, `lz::drop`, `lz::slice` and the chunks of
+     * `lz::chunks`, keep the iterator of the range, so they are contiguous when it is. Before C++20, only pointers and the
+     * iterators of `std::vector` and `std::basic_string` are known to be contiguous.
+     * @return A pointer to the first element, or `nullptr` if the view is empty.
+     */
+    template<class I = LzIterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsContiguousIterator<I>::value, ContiguousPointer<I>> data() const {
+        return contiguousData(_begin, _end);
+    }
+
+    /**
+     * Returns the lower and upper bound of the length of the view, without iterating over it. If the upper bound is not known,
+     * `upper` is equal to `lz::unknownSize`. If the view is sized (see `size()`), lower and upper are equal to its length.
+     * @return The size hint of the view.
+     */
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHint() const {
+        return internal::sizeHint(_begin, _end);
+    }
+
     /**
      * Gets the nth position of the iterator from this sequence.
      * @param n The offset.
@@ -695,6 +1497,19 @@ public:
     }
 }; // namespace internal
 // clang-format on
+
+template<class Iterator>
+std::true_type isBasicIteratorView(const BasicIteratorView<Iterator>*);
+
+std::false_type isBasicIteratorView(...);
+
+template<class T>
+struct IsBasicIteratorView : decltype(isBasicIteratorView(static_cast<T*>(nullptr))) {};
+
+// Whether the iterators of a view stay valid after the view is destroyed. This holds for every view whose iterators carry all of
+// their state, which is every view except the ones that own a resource that their iterators point into, such as `lz::Generator`
+template<class View>
+struct IsBorrowedView : IsBasicIteratorView<View> {};
 } // namespace internal
 
 // Start of group
@@ -715,8 +1530,8 @@ template<class IterableA, class IterableB, class BinaryPredicate = std::equal_to
 #        else
 template<class IterableA, class IterableB, class BinaryPredicate = std::equal_to<>>
 #        endif // LZ_HAS_CXX_11
-bool equal(const IterableA& a, const IterableB& b, BinaryPredicate predicate = {}) {
-    return std::equal(std::begin(a), std::end(a), std::begin(b), std::end(b), std::move(predicate));
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool equal(const IterableA& a, const IterableB& b, BinaryPredicate predicate = {}) {
+    return internal::equalRange(std::begin(a), std::end(a), std::begin(b), std::end(b), std::move(predicate));
 }
 #    else  // ^^^ !LZ_HAS_EXECUTION vvv LZ_HAS_EXECUTION
 /**
@@ -732,13 +1547,32 @@ equal(const IterableA& a, const IterableB& b, BinaryPredicate predicate = {}, Ex
     if constexpr (internal::checkForwardAndPolicies<Execution, internal::IterTypeFromIterable<IterableA>>() &&
                   internal::checkForwardAndPolicies<Execution, internal::IterTypeFromIterable<IterableB>>()) {
         static_cast<void>(execution);
-        return std::equal(std::begin(a), std::end(a), std::begin(b), std::end(b), std::move(predicate));
+        return internal::equalRange(std::begin(a), std::end(a), std::begin(b), std::end(b), std::move(predicate));
     }
     else {
         return std::equal(execution, std::begin(a), std::end(a), std::begin(b), std::end(b), std::move(predicate));
     }
 }
 #    endif // LZ_HAS_EXECUTION
+
+#    ifdef LZ_HAS_CONSTEXPR_CXX_20
+/**
+ * Evaluates a view at compile time into an array, of which the size is the length of the view. The length must be a constant
+ * expression, so the view is not passed itself, but created by `makeView`, which must be a lambda without captures. E.g. to
+ * generate a lookup table:
+ * ```cpp
+ * constexpr auto crcTable = lz::toArray([] { return lz::map(lz::range(256u), crcOf); });
+ * ```
+ * @param makeView A lambda without captures, that returns the view to evaluate.
+ * @return A `std::array` with the elements of the view.
+ */
+template<class MakeView>
+LZ_NODISCARD constexpr auto toArray(MakeView makeView) {
+    static_assert(std::is_default_constructible_v<MakeView>, "makeView must be a lambda without captures");
+    constexpr auto size = static_cast<std::size_t>(MakeView{}().distance());
+    return makeView().template toArray<size>();
+}
+#    endif // LZ_HAS_CONSTEXPR_CXX_20
 } // Namespace lz
 
 // End of group
@@ -746,4 +1580,60 @@ equal(const IterableA& a, const IterableB& b, BinaryPredicate predicate = {}, Ex
  * @}
  */
 
-#endif // LZ_BASIC_ITERATOR_VIEW_HPP
\ No newline at end of file
+#    ifdef LZ_HAS_RANGES
+// Every view models std::ranges::view, so that std::views::all copies it instead of wrapping it in a ref_view or owning_view, and
+// std::ranges algorithms take its iterators as they are. Views whose iterators do not compute their distance in O(1) opt out of
+// sized_range, as their size() iterates
+namespace std {
+namespace ranges {
+template<class View>
+    requires lz::internal::IsBasicIteratorView<View>::value
+inline constexpr bool enable_view<View> = true;
+
+template<class View>
+    requires lz::internal::IsBorrowedView<View>::value
+inline constexpr bool enable_borrowed_range<View> = true;
+
+template<class View>
+    requires lz::internal::IsBasicIteratorView<View>::value
+inline constexpr bool disable_sized_range<View> = !lz::internal::IsSized<lz::internal::IterTypeFromIterable<View&>>::value;
+} // namespace ranges
+} // namespace std
+#    endif // LZ_HAS_RANGES
+
+#    if !defined(LZ_STANDALONE) && defined(LZ_FMT_FORMATTER)
+// fmt/ranges.h has a formatter for every range, lazy views included, which is ambiguous with this one. So this one is opt in, by
+// defining LZ_FMT_FORMATTER in every translation unit, and fmt/ranges.h can't be used together with it
+namespace fmt {
+/**
+ * Formats a view like `operator<<` does, so that it can be used in e.g. `fmt::format_to` without creating a string first.
+ * The format spec applies to every element: `fmt::format("{:02}", lz::range(3))` yields `00 01 02`.
+ */
+template<class View>
+struct formatter<View, char, lz::internal::EnableIf<lz::internal::IsBasicIteratorView<View>::value>> {
+    basic_string_view<char> spec{};
+
+    FMT_CONSTEXPR auto parse(format_parse_context& ctx) -> decltype(ctx.begin()) {
+        auto it = ctx.begin();
+        while (it != ctx.end() && *it != '}') {
+            ++it;
+        }
+        spec = basic_string_view<char>(ctx.begin(), static_cast<std::size_t>(it - ctx.begin()));
+        return it;
+    }
+
+    template<class FormatContext>
+    auto format(const View& view, FormatContext& ctx) const -> decltype(ctx.out()) {
+        if (spec.size() == 0) {
+            return view.formatTo(ctx.out(), printDelimiter(view));
+        }
+        std::string elementFormat = "{:";
+        elementFormat.append(spec.data(), spec.size());
+        elementFormat += '}';
+        return view.formatTo(ctx.out(), printDelimiter(view), elementFormat);
+    }
+};
+} // namespace fmt
+#    endif // !defined(LZ_STANDALONE) && defined(LZ_FMT_FORMATTER)
+
+#endif // LZ_BASIC_ITERATOR_VIEW_HPP
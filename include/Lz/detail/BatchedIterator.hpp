@@ -0,0 +1,259 @@
+#pragma once
+
+#ifndef LZ_BATCHED_ITERATOR_HPP
+#    define LZ_BATCHED_ITERATOR_HPP
+
+#    include "BasicIteratorView.hpp"
+#    include "Contiguous.hpp"
+#    include "LzTools.hpp"
+
+#    include <memory>
+
+namespace lz {
+namespace internal {
+// Storage for one batch, aligned to a cache line so that vectorized kernels can use aligned loads from its start
+template<class T>
+class AlignedBatch {
+    static constexpr std::size_t alignment = alignof(T) > cacheLineSize ? alignof(T) : cacheLineSize;
+
+    std::unique_ptr<unsigned char[]> _storage;
+    T* _data;
+    std::size_t _size{};
+
+public:
+    explicit AlignedBatch(const std::size_t capacity) : _storage(new unsigned char[capacity * sizeof(T) + alignment]) {
+        void* data = _storage.get();
+        std::size_t space = capacity * sizeof(T) + alignment;
+        _data = static_cast<T*>(std::align(alignment, capacity * sizeof(T), data, space));
+    }
+
+    AlignedBatch(const AlignedBatch&) = delete;
+    AlignedBatch& operator=(const AlignedBatch&) = delete;
+
+    ~AlignedBatch() {
+        clear();
+    }
+
+    template<class U>
+    void emplaceBack(U&& value) {
+        ::new (static_cast<void*>(_data + _size)) T(std::forward<U>(value));
+        ++_size;
+    }
+
+    void clear() noexcept {
+        for (std::size_t i = 0; i < _size; ++i) {
+            _data[i].~T();
+        }
+        _size = 0;
+    }
+
+    LZ_NODISCARD const T* data() const noexcept {
+        return _data;
+    }
+
+    LZ_NODISCARD std::size_t size() const noexcept {
+        return _size;
+    }
+};
+
+template<class Iterator>
+class BatchedState {
+public:
+    using value_type = Decay<ValueType<Iterator>>;
+
+private:
+    Iterator _iterator;
+    Iterator _end;
+    std::size_t _batchSize;
+    AlignedBatch<value_type> _batch;
+    bool _isStarted{ false };
+
+public:
+    BatchedState(Iterator begin, Iterator end, const std::size_t batchSize) :
+        _iterator(std::move(begin)),
+        _end(std::move(end)),
+        _batchSize(batchSize),
+        _batch(batchSize) {
+        LZ_ASSERT(batchSize > 0, "batch size must be larger than 0");
+    }
+
+    void start() {
+        if (!_isStarted) {
+            _isStarted = true;
+            next();
+        }
+    }
+
+    void next() {
+        _batch.clear();
+        for (; _batch.size() < _batchSize && _iterator != _end; ++_iterator) {
+            _batch.emplaceBack(*_iterator);
+        }
+    }
+
+    LZ_NODISCARD const AlignedBatch<value_type>& batch() const noexcept {
+        return _batch;
+    }
+};
+
+// Copies `batchSize` elements at a time into a buffer that is reused for every batch, and yields views of the buffer
+template<class Iterator>
+class BatchedIterator {
+    using State = BatchedState<Iterator>;
+    using Element = typename State::value_type;
+
+    std::shared_ptr<State> _state{};
+
+    bool isEnd() const {
+        if (!_state) {
+            return true;
+        }
+        _state->start();
+        return _state->batch().size() == 0;
+    }
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = BasicIteratorView<const Element*>;
+    using reference = value_type;
+    using pointer = FakePointerProxy<reference>;
+    using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+
+    explicit BatchedIterator(std::shared_ptr<State> state) noexcept : _state(std::move(state)) {
+    }
+
+    BatchedIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        _state->start();
+        const auto& batch = _state->batch();
+        return { batch.data(), batch.data() + batch.size() };
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    BatchedIterator& operator++() {
+        _state->start();
+        _state->next();
+        return *this;
+    }
+
+    BatchedIterator operator++(int) {
+        BatchedIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator==(const BatchedIterator& a, const BatchedIterator& b) {
+        return a.isEnd() == b.isEnd();
+    }
+
+    LZ_NODISCARD friend bool operator!=(const BatchedIterator& a, const BatchedIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+
+// Yields views of `batchSize` elements of contiguous memory directly, without copying them
+template<class T>
+class ContiguousBatchedIterator {
+    const T* _iterator{};
+    const T* _end{};
+    std::size_t _batchSize{};
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 const T* batchEnd() const noexcept {
+        return static_cast<std::size_t>(_end - _iterator) < _batchSize ? _end : _iterator + _batchSize;
+    }
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = BasicIteratorView<const T*>;
+    using reference = value_type;
+    using pointer = FakePointerProxy<reference>;
+    using difference_type = std::ptrdiff_t;
+
+    LZ_CONSTEXPR_CXX_20 ContiguousBatchedIterator(const T* iterator, const T* end, const std::size_t batchSize) :
+        _iterator(iterator),
+        _end(end),
+        _batchSize(batchSize) {
+        LZ_ASSERT(batchSize > 0, "batch size must be larger than 0");
+    }
+
+    constexpr ContiguousBatchedIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return { _iterator, batchEnd() };
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    LZ_CONSTEXPR_CXX_20 ContiguousBatchedIterator& operator++() {
+        _iterator = batchEnd();
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 ContiguousBatchedIterator operator++(int) {
+        ContiguousBatchedIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
+    operator==(const ContiguousBatchedIterator& a, const ContiguousBatchedIterator& b) noexcept {
+        return a._iterator == b._iterator;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
+    operator!=(const ContiguousBatchedIterator& a, const ContiguousBatchedIterator& b) noexcept {
+        return !(a == b); // NOLINT
+    }
+};
+
+template<class Iterator>
+using BatchedIterType = Conditional<IsContiguousIterator<Iterator>::value,
+                                    ContiguousBatchedIterator<Decay<ValueType<Iterator>>>, BatchedIterator<Iterator>>;
+
+// Iterables with a data() pointer, such as std::array before C++20, are batched through it, so that they are never copied, even
+// when their iterators are not known to be contiguous
+template<class Iterable, class = int>
+struct HasData : std::false_type {};
+
+template<class Iterable>
+struct HasData<Iterable, decltype((void)std::declval<Iterable&>().data(), (void)std::declval<Iterable&>().size(), 0)>
+    : std::is_pointer<decltype(std::declval<Iterable&>().data())> {};
+
+template<class Iterable, bool = HasData<Iterable>::value>
+struct BatchedSource {
+    using type = IterTypeFromIterable<Iterable>;
+
+    template<class I>
+    static type begin(I&& iterable) {
+        return internal::begin(std::forward<I>(iterable));
+    }
+
+    template<class I>
+    static type end(I&& iterable) {
+        return internal::end(std::forward<I>(iterable));
+    }
+};
+
+template<class Iterable>
+struct BatchedSource<Iterable, true> {
+    using type = decltype(std::declval<Iterable&>().data());
+
+    static type begin(Iterable& iterable) {
+        return iterable.data();
+    }
+
+    static type end(Iterable& iterable) {
+        return iterable.data() + iterable.size();
+    }
+};
+
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_BATCHED_ITERATOR_HPP
@@ -0,0 +1,233 @@
+#pragma once
+
+#ifndef LZ_BINARY_RECORD_ITERATOR_HPP
+#    define LZ_BINARY_RECORD_ITERATOR_HPP
+
+#    include "LzTools.hpp"
+
+#    include <cstdint>
+#    include <cstring>
+#    include <memory>
+
+#    if defined(LZ_MSVC)
+#        include <stdlib.h>
+#    endif // LZ_MSVC
+
+namespace lz {
+/**
+ * The order of the bytes of the values in a byte buffer. Like `std::endian::native`, `native` equals either `little` or `big`.
+ */
+enum class ByteOrder {
+    little,
+    big,
+#    if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    native = big
+#    else
+    native = little
+#    endif
+};
+
+namespace internal {
+LZ_NODISCARD inline std::uint16_t byteSwap(const std::uint16_t value) noexcept {
+#    if defined(LZ_MSVC)
+    return _byteswap_ushort(value);
+#    elif defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap16(value);
+#    else
+    return static_cast<std::uint16_t>((value << 8) | (value >> 8));
+#    endif
+}
+
+LZ_NODISCARD inline std::uint32_t byteSwap(const std::uint32_t value) noexcept {
+#    if defined(LZ_MSVC)
+    return _byteswap_ulong(value);
+#    elif defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(value);
+#    else
+    return (static_cast<std::uint32_t>(byteSwap(static_cast<std::uint16_t>(value))) << 16) |
+           byteSwap(static_cast<std::uint16_t>(value >> 16));
+#    endif
+}
+
+LZ_NODISCARD inline std::uint64_t byteSwap(const std::uint64_t value) noexcept {
+#    if defined(LZ_MSVC)
+    return _byteswap_uint64(value);
+#    elif defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(value);
+#    else
+    return (static_cast<std::uint64_t>(byteSwap(static_cast<std::uint32_t>(value))) << 32) |
+           byteSwap(static_cast<std::uint32_t>(value >> 32));
+#    endif
+}
+
+// Values of which the byte order can be reversed as a whole. The fields of a struct would each have to be reversed on their own
+template<class T>
+struct IsByteSwappable
+    : std::integral_constant<bool, (std::is_arithmetic<T>::value || std::is_enum<T>::value) &&
+                                       (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)> {};
+
+template<class T>
+using ByteSwapWord =
+    Conditional<sizeof(T) == 2, std::uint16_t, Conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>>;
+
+template<class T>
+EnableIf<sizeof(T) == 1, T> reverseBytes(const T value) noexcept {
+    return value;
+}
+
+template<class T>
+EnableIf<(sizeof(T) > 1), T> reverseBytes(T value) noexcept {
+    ByteSwapWord<T> word;
+    std::memcpy(&word, &value, sizeof(T));
+    word = byteSwap(word);
+    std::memcpy(&value, &word, sizeof(T));
+    return value;
+}
+
+// Reads a `T` from `bytes`, which don't have to be aligned for `T`. For the size of a register, the memcpy compiles to a single
+// load
+template<class T>
+T loadRecord(std::false_type /* reverseBytes */, const char* bytes) noexcept {
+    T value;
+    std::memcpy(static_cast<void*>(std::addressof(value)), bytes, sizeof(T));
+    return value;
+}
+
+template<class T>
+T loadRecord(std::true_type /* reverseBytes */, const char* bytes) noexcept {
+    return reverseBytes(loadRecord<T>(std::false_type(), bytes));
+}
+
+// Yields the record of `stride` bytes at index i of a byte buffer as a `T`, read from its first `sizeof(T)` bytes. The position
+// of a record is computed from its index, so the iterator never points past the buffer, even if the last stride is cut off
+template<class T, ByteOrder Order>
+class BinaryRecordIterator {
+    static_assert(std::is_trivially_copyable<T>::value && std::is_default_constructible<T>::value,
+                  "records can only be read as trivially copyable types that are default constructible");
+    static_assert(Order == ByteOrder::native || IsByteSwappable<T>::value,
+                  "only the byte order of arithmetic and enum types of 1, 2, 4 or 8 bytes can be converted");
+
+    using ReverseBytes = std::integral_constant<bool, Order != ByteOrder::native>;
+
+    const char* _data{ nullptr };
+    std::size_t _index{};
+    std::size_t _stride{};
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using reference = T;
+    using pointer = FakePointerProxy<reference>;
+    using difference_type = std::ptrdiff_t;
+
+    constexpr BinaryRecordIterator(const char* data, const std::size_t index, const std::size_t stride) noexcept :
+        _data(data),
+        _index(index),
+        _stride(stride) {
+    }
+
+    constexpr BinaryRecordIterator() = default;
+
+    LZ_NODISCARD reference operator*() const noexcept {
+        return loadRecord<T>(ReverseBytes(), _data + _index * _stride);
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    LZ_CONSTEXPR_CXX_20 BinaryRecordIterator& operator++() noexcept {
+        ++_index;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 BinaryRecordIterator operator++(int) noexcept {
+        BinaryRecordIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_20 BinaryRecordIterator& operator--() noexcept {
+        --_index;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 BinaryRecordIterator operator--(int) noexcept {
+        BinaryRecordIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_20 BinaryRecordIterator& operator+=(const difference_type offset) noexcept {
+        _index = static_cast<std::size_t>(static_cast<difference_type>(_index) + offset);
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 BinaryRecordIterator& operator-=(const difference_type offset) noexcept {
+        return *this += -offset;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 BinaryRecordIterator operator+(const difference_type offset) const noexcept {
+        BinaryRecordIterator tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend BinaryRecordIterator operator+(const difference_type offset,
+                                                                           const BinaryRecordIterator& iterator) noexcept {
+        return iterator + offset;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 BinaryRecordIterator operator-(const difference_type offset) const noexcept {
+        BinaryRecordIterator tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD constexpr friend difference_type
+    operator-(const BinaryRecordIterator& a, const BinaryRecordIterator& b) noexcept {
+        return static_cast<difference_type>(a._index) - static_cast<difference_type>(b._index);
+    }
+
+    LZ_NODISCARD reference operator[](const difference_type offset) const noexcept {
+        return *(*this + offset);
+    }
+
+    LZ_NODISCARD constexpr friend bool operator==(const BinaryRecordIterator& a, const BinaryRecordIterator& b) noexcept {
+        return a._index == b._index;
+    }
+
+    LZ_NODISCARD constexpr friend bool operator!=(const BinaryRecordIterator& a, const BinaryRecordIterator& b) noexcept {
+        return !(a == b); // NOLINT
+    }
+
+    LZ_NODISCARD constexpr friend bool operator<(const BinaryRecordIterator& a, const BinaryRecordIterator& b) noexcept {
+        return a._index < b._index;
+    }
+
+    LZ_NODISCARD constexpr friend bool operator>(const BinaryRecordIterator& a, const BinaryRecordIterator& b) noexcept {
+        return b < a;
+    }
+
+    LZ_NODISCARD constexpr friend bool operator<=(const BinaryRecordIterator& a, const BinaryRecordIterator& b) noexcept {
+        return !(b < a); // NOLINT
+    }
+
+    LZ_NODISCARD constexpr friend bool operator>=(const BinaryRecordIterator& a, const BinaryRecordIterator& b) noexcept {
+        return !(a < b); // NOLINT
+    }
+};
+
+// A type with contiguous bytes that can be accessed using `data()` and `size()`, e.g. a std::vector<std::uint8_t>, a std::string
+// or an lz::MappedFile
+template<class T, class = int>
+struct HasByteData : std::false_type {};
+
+template<class T>
+struct HasByteData<T, decltype((void)std::declval<const T&>().data(), (void)std::declval<const T&>().size(), 0)>
+    : std::integral_constant<bool, std::is_pointer<decltype(std::declval<const T&>().data())>::value &&
+                                       sizeof(*std::declval<const T&>().data()) == 1> {};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_BINARY_RECORD_ITERATOR_HPP
@@ -0,0 +1,258 @@
+#pragma once
+
+#ifndef LZ_BIT_MASK_ITERATOR_HPP
+#    define LZ_BIT_MASK_ITERATOR_HPP
+
+#    include "ByteMask.hpp"
+#    include "Contiguous.hpp"
+#    include "LzTools.hpp"
+
+#    include <cstdint>
+#    include <limits>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+// Amount of flags that are packed into one word of a bit mask
+constexpr LZ_INLINE_VAR std::size_t bitMaskWordBits = 64;
+
+struct ToBool {
+    template<class T>
+    LZ_NODISCARD constexpr bool operator()(const T& value) const {
+        return static_cast<bool>(value);
+    }
+};
+
+// Sets bit i of the result if `predicate(begin[i])` holds, for i in [0, count). The results are or'ed into the word rather than
+// branched on, so that unpredictable predicates don't cost a misprediction per element
+template<class Iterator, class UnaryPredicate>
+std::uint64_t packWord(const Iterator& begin, const std::size_t count, UnaryPredicate& predicate) {
+    std::uint64_t word = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        word |= static_cast<std::uint64_t>(static_cast<bool>(predicate(begin[static_cast<DiffType<Iterator>>(i)]))) << i;
+    }
+    return word;
+}
+
+template<class Iterator, class UnaryPredicate>
+void packBits(std::true_type /* isRandomAccess */, Iterator begin, const Iterator& end, UnaryPredicate& predicate,
+              std::vector<std::uint64_t>& words) {
+    auto length = static_cast<std::size_t>(end - begin);
+    words.reserve(words.size() + (length + bitMaskWordBits - 1) / bitMaskWordBits);
+    for (; length >= bitMaskWordBits; length -= bitMaskWordBits) {
+        words.push_back(packWord(begin, bitMaskWordBits, predicate));
+        begin += static_cast<DiffType<Iterator>>(bitMaskWordBits);
+    }
+    if (length != 0) {
+        words.push_back(packWord(begin, length, predicate));
+    }
+}
+
+template<class Iterator, class UnaryPredicate>
+void packBits(std::false_type /* isRandomAccess */, Iterator begin, const Iterator& end, UnaryPredicate& predicate,
+              std::vector<std::uint64_t>& words) {
+    while (begin != end) {
+        std::uint64_t word = 0;
+        for (std::size_t i = 0; i < bitMaskWordBits && begin != end; ++i, ++begin) {
+            word |= static_cast<std::uint64_t>(static_cast<bool>(predicate(*begin))) << i;
+        }
+        words.push_back(word);
+    }
+}
+
+// Flags of one byte each, e.g. `bool`s or `char`s, that lie next to each other in memory
+template<class Iterator>
+struct IsByteFlags
+    : std::integral_constant<bool, IsContiguousIterator<Iterator>::value && std::is_lvalue_reference<RefType<Iterator>>::value &&
+                                       std::is_integral<Decay<ValueType<Iterator>>>::value &&
+                                       sizeof(Decay<ValueType<Iterator>>) == 1> {};
+
+// Packs a word of byte flags 8 at a time: the high bit of every byte that is not zero is moved to the bit of its index
+inline std::uint64_t packByteWord(const char* bytes) noexcept {
+    std::uint64_t word = 0;
+    for (std::size_t i = 0; i < bitMaskWordBits; i += 8) {
+        word |= gatherHighBits(zeroBytes(loadWord(bytes + i)) ^ ~lowSevenBits) << i;
+    }
+    return word;
+}
+
+inline void packByteFlags(const char* bytes, std::size_t length, std::vector<std::uint64_t>& words) {
+    words.reserve(words.size() + (length + bitMaskWordBits - 1) / bitMaskWordBits);
+    for (; length >= bitMaskWordBits; length -= bitMaskWordBits, bytes += bitMaskWordBits) {
+        words.push_back(packByteWord(bytes));
+    }
+    if (length != 0) {
+        std::uint64_t word = 0;
+        for (std::size_t i = 0; i < length; ++i) {
+            word |= static_cast<std::uint64_t>(bytes[i] != 0) << i;
+        }
+        words.push_back(word);
+    }
+}
+
+// Packs `count` <= 64 flags of a random access sequence into a word
+template<class Iterator>
+std::uint64_t packFlagWord(std::true_type /* isByteFlags */, const Iterator& begin, const std::size_t count) {
+    if (count == bitMaskWordBits) {
+        return packByteWord(reinterpret_cast<const char*>(std::addressof(*begin)));
+    }
+    ToBool toBool;
+    return packWord(begin, count, toBool);
+}
+
+template<class Iterator>
+std::uint64_t packFlagWord(std::false_type /* isByteFlags */, const Iterator& begin, const std::size_t count) {
+    ToBool toBool;
+    return packWord(begin, count, toBool);
+}
+
+template<class Iterator>
+void packFlags(std::true_type /* isByteFlags */, const Iterator& begin, const Iterator& end, std::vector<std::uint64_t>& words) {
+    if (begin != end) {
+        packByteFlags(reinterpret_cast<const char*>(contiguousData(begin, end)), static_cast<std::size_t>(end - begin), words);
+    }
+}
+
+template<class Iterator>
+void packFlags(std::false_type /* isByteFlags */, const Iterator& begin, const Iterator& end, std::vector<std::uint64_t>& words) {
+    ToBool toBool;
+    packBits(IsRandomAccess<Iterator>(), begin, end, toBool, words);
+}
+
+// Yields the indices of the set bits of a sequence of unsigned words, in which bit j of word i has index i * (bits per word) + j.
+// Every word is scanned with a count trailing zeros instruction and the lowest set bit is cleared on increment, so the cost is
+// per set bit and per word rather than per bit
+template<LZ_CONCEPT_ITERATOR Iterator>
+class SetBitsIterator {
+    using Word = Decay<ValueType<Iterator>>;
+    static_assert(std::is_integral<Word>::value && std::is_unsigned<Word>::value && std::numeric_limits<Word>::digits <= 64,
+                  "the words of a bit mask must be unsigned integers of at most 64 bits");
+
+    static constexpr std::size_t wordBits = std::numeric_limits<Word>::digits;
+
+    Iterator _iterator{};
+    Iterator _end{};
+    // The bits of `*_iterator` that are not visited yet
+    std::uint64_t _word{};
+    // The index of the lowest bit of `*_iterator`
+    std::size_t _base{};
+
+    LZ_CONSTEXPR_CXX_20 void skipEmptyWords() {
+        while (_word == 0 && _iterator != _end) {
+            ++_iterator;
+            _base += wordBits;
+            if (_iterator != _end) {
+                _word = static_cast<std::uint64_t>(*_iterator);
+            }
+        }
+    }
+
+    // The bits of the word of `end` that come before it. If `end` is the end of the words, this is zero
+    LZ_CONSTEXPR_CXX_20 std::uint64_t bitsBefore(const SetBitsIterator& end) const {
+        return end._iterator == _end ? 0 : static_cast<std::uint64_t>(*end._iterator) ^ end._word;
+    }
+
+    template<class Sink>
+    static bool forEachSetBit(std::uint64_t word, const std::size_t base, Sink& sink) {
+        for (; word != 0; word &= word - 1) {
+            if (!sink(base + countTrailingZeros(word))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+public:
+    using iterator_category =
+        typename std::common_type<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>::type;
+    using value_type = std::size_t;
+    using reference = std::size_t;
+    using pointer = FakePointerProxy<reference>;
+    using difference_type = std::ptrdiff_t;
+
+    LZ_CONSTEXPR_CXX_20 SetBitsIterator(Iterator iterator, Iterator end) : _iterator(std::move(iterator)), _end(std::move(end)) {
+        if (_iterator != _end) {
+            _word = static_cast<std::uint64_t>(*_iterator);
+            skipEmptyWords();
+        }
+    }
+
+    constexpr SetBitsIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return _base + countTrailingZeros(_word);
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    // Counts the set bits with a population count per word
+    LZ_NODISCARD difference_type sizeTo(const SetBitsIterator& end) const {
+        if (_iterator == end._iterator) {
+            return static_cast<difference_type>(popCount(_word ^ end._word));
+        }
+        std::size_t count = popCount(_word);
+        for (Iterator it = std::next(_iterator); it != end._iterator; ++it) {
+            count += popCount(static_cast<std::uint64_t>(*it));
+        }
+        return static_cast<difference_type>(count + popCount(bitsBefore(end)));
+    }
+
+    template<class Sink>
+    bool forEachWhile(const SetBitsIterator& end, Sink& sink) const {
+        if (_iterator == end._iterator) {
+            return forEachSetBit(_word ^ end._word, _base, sink);
+        }
+        if (!forEachSetBit(_word, _base, sink)) {
+            return false;
+        }
+        std::size_t base = _base + wordBits;
+        for (Iterator it = std::next(_iterator); it != end._iterator; ++it, base += wordBits) {
+            if (!forEachSetBit(static_cast<std::uint64_t>(*it), base, sink)) {
+                return false;
+            }
+        }
+        return forEachSetBit(bitsBefore(end), base, sink);
+    }
+
+    LZ_CONSTEXPR_CXX_20 SetBitsIterator& operator++() {
+        _word &= _word - 1;
+        skipEmptyWords();
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 SetBitsIterator operator++(int) {
+        SetBitsIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD constexpr friend bool operator==(const SetBitsIterator& a, const SetBitsIterator& b) {
+        return a._iterator == b._iterator && a._word == b._word;
+    }
+
+    LZ_NODISCARD constexpr friend bool operator!=(const SetBitsIterator& a, const SetBitsIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+
+// Looks up an index in a random access sequence, used to map the set bits of a mask to the elements they select
+template<class Iterator>
+class IndexInto {
+    Iterator _begin{};
+
+public:
+    constexpr explicit IndexInto(Iterator begin) : _begin(std::move(begin)) {
+    }
+
+    constexpr IndexInto() = default;
+
+    LZ_NODISCARD constexpr RefType<Iterator> operator()(const std::size_t index) const {
+        return _begin[static_cast<DiffType<Iterator>>(index)];
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_BIT_MASK_ITERATOR_HPP
@@ -0,0 +1,124 @@
+#pragma once
+
+#ifndef LZ_BLOCK_FIND_HPP
+#    define LZ_BLOCK_FIND_HPP
+
+#    include "Contiguous.hpp"
+#    include "LzTools.hpp"
+
+#    include <algorithm>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+// The search kernels compare a whole cache line of elements without branching, which compilers turn into vector compares and a
+// movemask, and only look for the exact position once a line contains a match. This is portable, unlike intrinsics, and uses
+// whatever the target has, e.g. SSE2, AVX2 or NEON
+template<class T>
+struct BlockLength : std::integral_constant<std::size_t, (sizeof(T) < cacheLineSize ? cacheLineSize / sizeof(T) : 1)> {};
+
+// Up to this many needles are compared one by one per block in `containsAny`, more are sorted and binary searched
+constexpr LZ_INLINE_VAR std::size_t maxBlockNeedles = 8;
+
+// Whether [begin, end) can be searched for a `T` with the block kernels. As with memchr, the value must have the element type,
+// to not change the result of comparisons that would otherwise convert the element
+template<class Iterator, class T, bool = IsContiguousIterator<Iterator>::value>
+struct IsBlockSearchable : std::false_type {};
+
+template<class Iterator, class T>
+struct IsBlockSearchable<Iterator, T, true>
+    : std::integral_constant<bool, std::is_arithmetic<ValueType<Iterator>>::value &&
+                                       std::is_same<ValueType<Iterator>, T>::value> {};
+
+template<class T>
+LZ_NODISCARD bool blockHasMatch(const T* block, const T value) noexcept {
+    unsigned char found = 0;
+    for (std::size_t i = 0; i < BlockLength<T>::value; ++i) {
+        found |= static_cast<unsigned char>(block[i] == value);
+    }
+    return found != 0;
+}
+
+template<class T>
+LZ_NODISCARD const T* blockFind(const T* first, const T* last, const T value) noexcept {
+    constexpr std::size_t length = BlockLength<T>::value;
+    while (static_cast<std::size_t>(last - first) >= length && !blockHasMatch(first, value)) {
+        first += length;
+    }
+    return std::find(first, last, value);
+}
+
+template<class T>
+LZ_NODISCARD std::ptrdiff_t blockCount(const T* first, const T* last, const T value) noexcept {
+    constexpr std::size_t length = BlockLength<T>::value;
+    std::ptrdiff_t count = 0;
+    for (; static_cast<std::size_t>(last - first) >= length; first += length) {
+        // A narrow counter per block, so that the compares are summed in vector registers
+        unsigned blockMatches = 0;
+        for (std::size_t i = 0; i < length; ++i) {
+            blockMatches += static_cast<unsigned>(first[i] == value);
+        }
+        count += static_cast<std::ptrdiff_t>(blockMatches);
+    }
+    for (; first != last; ++first) {
+        count += static_cast<std::ptrdiff_t>(*first == value);
+    }
+    return count;
+}
+
+// The amount of elements of the block that are less than `value`. If the block is sorted, this is the position of the first
+// element that is not
+template<class T>
+LZ_NODISCARD std::size_t blockCountLess(const T* block, const T value) noexcept {
+    unsigned less = 0;
+    for (std::size_t i = 0; i < BlockLength<T>::value; ++i) {
+        less += static_cast<unsigned>(block[i] < value);
+    }
+    return less;
+}
+
+template<class T>
+LZ_NODISCARD bool blockContainsAnyOf(const T* first, const T* last, const std::vector<T>& needles) noexcept {
+    constexpr std::size_t length = BlockLength<T>::value;
+    for (; static_cast<std::size_t>(last - first) >= length; first += length) {
+        for (const T needle : needles) {
+            if (blockHasMatch(first, needle)) {
+                return true;
+            }
+        }
+    }
+    return std::find_first_of(first, last, needles.begin(), needles.end()) != last;
+}
+
+template<class T>
+LZ_NODISCARD bool sortedContainsAnyOf(const T* first, const T* last, std::vector<T>& needles) {
+    // NaN is never equal to anything, and would break the ordering of the sort
+    needles.erase(std::remove_if(needles.begin(), needles.end(), [](const T needle) { return !(needle == needle); }),
+                  needles.end());
+    std::sort(needles.begin(), needles.end());
+    return std::any_of(first, last,
+                       [&needles](const T value) { return std::binary_search(needles.begin(), needles.end(), value); });
+}
+
+template<class Iterator, class NeedleIterator>
+LZ_NODISCARD bool containsAnyImpl(std::true_type /* isBlockSearchable */, const Iterator& begin, const Iterator& end,
+                                  NeedleIterator needlesBegin, const NeedleIterator& needlesEnd) {
+    using T = ValueType<Iterator>;
+    std::vector<T> needles(std::move(needlesBegin), needlesEnd);
+    const T* first = contiguousData(begin, end);
+    const T* last = first + (end - begin);
+    if (needles.size() <= maxBlockNeedles) {
+        return blockContainsAnyOf(first, last, needles);
+    }
+    return sortedContainsAnyOf(first, last, needles);
+}
+
+template<class Iterator, class NeedleIterator>
+LZ_NODISCARD bool containsAnyImpl(std::false_type /* isBlockSearchable */, const Iterator& begin, const Iterator& end,
+                                  const NeedleIterator& needlesBegin, const NeedleIterator& needlesEnd) {
+    return std::find_first_of(begin, end, needlesBegin, needlesEnd) != end;
+}
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_BLOCK_FIND_HPP
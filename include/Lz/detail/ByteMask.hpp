@@ -0,0 +1,352 @@
+#pragma once
+
+#ifndef LZ_BYTE_MASK_HPP
+#    define LZ_BYTE_MASK_HPP
+
+#    include "LzTools.hpp"
+
+#    include <algorithm>
+#    include <cstdint>
+#    include <cstring>
+#    include <string>
+
+#    if defined(LZ_MSVC)
+#        include <intrin.h>
+#    endif // LZ_MSVC
+
+namespace lz {
+namespace internal {
+// Amount of bytes of which the matches are kept in one 64 bit mask
+constexpr LZ_INLINE_VAR std::size_t byteMaskBlockSize = 64;
+
+constexpr LZ_INLINE_VAR std::uint64_t lowSevenBits = 0x7F7F7F7F7F7F7F7FULL;
+
+LZ_NODISCARD constexpr std::uint64_t broadcastByte(const unsigned char byte) noexcept {
+    return 0x0101010101010101ULL * byte;
+}
+
+// Loads 8 bytes such that byte i of `bytes` ends up in bits [8 * i, 8 * i + 8), regardless of endianness
+LZ_NODISCARD inline std::uint64_t loadWord(const char* bytes) noexcept {
+    std::uint64_t word = 0;
+#    if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    for (std::size_t i = 0; i < 8; ++i) {
+        word |= static_cast<std::uint64_t>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+    }
+#    else
+    std::memcpy(&word, bytes, sizeof word);
+#    endif
+    return word;
+}
+
+// Sets the high bit of every byte of `word` that is zero, and clears all other bits. Unlike the classic `(x - 1) & ~x` trick
+// this has no false positives, because no borrow can propagate between bytes
+LZ_NODISCARD constexpr std::uint64_t zeroBytes(const std::uint64_t word) noexcept {
+    return ~(((word & lowSevenBits) + lowSevenBits) | word | lowSevenBits);
+}
+
+LZ_NODISCARD constexpr bool isAsciiSpace(const char c) noexcept {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+// Sets the high bit of every byte of `word` that lies in [low, high], where both bounds are ASCII characters. Adding 0x80 - n
+// to the low seven bits of a byte sets its high bit if they are at least n, without carrying into the next byte, which tests
+// every byte against the range at once
+LZ_NODISCARD constexpr std::uint64_t rangeBytes(const std::uint64_t word, const char low, const char high) noexcept {
+    return ((word & lowSevenBits) + broadcastByte(static_cast<unsigned char>(0x80 - low))) &
+           ~((word & lowSevenBits) + broadcastByte(static_cast<unsigned char>(0x80 - high - 1))) & ~word & ~lowSevenBits;
+}
+
+// Sets the high bit of every byte of `word` that is an ASCII whitespace character: ' ' or one of '\t', '\n', '\v', '\f' and
+// '\r'
+LZ_NODISCARD constexpr std::uint64_t spaceBytes(const std::uint64_t word) noexcept {
+    return zeroBytes(word ^ broadcastByte(' ')) | rangeBytes(word, '\t', '\r');
+}
+
+// Lowercases the ASCII letters 'A' to 'Z' and leaves every other character, including non ASCII bytes, as is
+template<class Char>
+LZ_NODISCARD constexpr Char toLowerAscii(const Char c) noexcept {
+    return c >= static_cast<Char>('A') && c <= static_cast<Char>('Z') ? static_cast<Char>(c | 0x20) : c;
+}
+
+// Lowercases the ASCII letters of 8 bytes at once by or'ing 0x20 into the bytes in ['A', 'Z']
+LZ_NODISCARD constexpr std::uint64_t toLowerAsciiWord(const std::uint64_t word) noexcept {
+    return word | (rangeBytes(word, 'A', 'Z') >> 2);
+}
+
+// Whether [a, a + size) and [b, b + size) are equal when the case of ASCII letters is ignored. Words that are bitwise equal are
+// skipped without folding them, which is the common case when e.g. header names are spelled the usual way
+LZ_NODISCARD inline bool equalIgnoringAsciiCase(const char* a, const char* b, std::size_t size) noexcept {
+    for (; size >= 8; size -= 8, a += 8, b += 8) {
+        const std::uint64_t wordA = loadWord(a);
+        const std::uint64_t wordB = loadWord(b);
+        if (wordA != wordB && toLowerAsciiWord(wordA) != toLowerAsciiWord(wordB)) {
+            return false;
+        }
+    }
+    for (; size != 0; --size, ++a, ++b) {
+        if (toLowerAscii(*a) != toLowerAscii(*b)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Moves the high bit of byte i of `highBits` to bit i
+LZ_NODISCARD constexpr std::uint64_t gatherHighBits(const std::uint64_t highBits) noexcept {
+    return ((highBits >> 7) * 0x0102040810204080ULL) >> 56;
+}
+
+LZ_NODISCARD inline std::size_t countTrailingZeros(const std::uint64_t mask) noexcept {
+    LZ_ASSERT(mask != 0, "mask cannot be zero");
+#    if defined(LZ_MSVC)
+    unsigned long index = 0;
+    _BitScanForward64(&index, mask);
+    return static_cast<std::size_t>(index);
+#    elif defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_ctzll(mask));
+#    else
+    std::size_t index = 0;
+    for (std::uint64_t m = mask; (m & 1u) == 0; m >>= 1) {
+        ++index;
+    }
+    return index;
+#    endif
+}
+
+LZ_NODISCARD inline std::size_t countLeadingZeros(const std::uint64_t mask) noexcept {
+    LZ_ASSERT(mask != 0, "mask cannot be zero");
+#    if defined(LZ_MSVC)
+    unsigned long index = 0;
+    _BitScanReverse64(&index, mask);
+    return 63 - static_cast<std::size_t>(index);
+#    elif defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_clzll(mask));
+#    else
+    std::size_t count = 0;
+    for (std::uint64_t m = mask; (m & (std::uint64_t{ 1 } << 63)) == 0; m <<= 1) {
+        ++count;
+    }
+    return count;
+#    endif
+}
+
+LZ_NODISCARD inline std::size_t popCount(std::uint64_t mask) noexcept {
+#    if defined(LZ_MSVC) && defined(_M_X64)
+    return static_cast<std::size_t>(__popcnt64(mask));
+#    elif defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_popcountll(mask));
+#    else
+    std::size_t count = 0;
+    for (; mask != 0; mask &= mask - 1) {
+        ++count;
+    }
+    return count;
+#    endif
+}
+
+// Returns the amount of ASCII whitespace characters at the front of [data, data + size). Most strings don't start with
+// whitespace, so the first character is tested on its own, after which runs of whitespace are skipped 8 characters at a time
+LZ_NODISCARD inline std::size_t leadingSpaces(const char* data, const std::size_t size) noexcept {
+    if (size == 0 || !isAsciiSpace(data[0])) {
+        return 0;
+    }
+    std::size_t count = 0;
+    for (; count + 8 <= size; count += 8) {
+        const std::uint64_t others = ~spaceBytes(loadWord(data + count)) & ~lowSevenBits;
+        if (others != 0) {
+            return count + countTrailingZeros(others) / 8;
+        }
+    }
+    for (; count < size && isAsciiSpace(data[count]); ++count) {
+    }
+    return count;
+}
+
+// Returns the amount of ASCII whitespace characters at the end of [data, data + size), see `leadingSpaces`
+LZ_NODISCARD inline std::size_t trailingSpaces(const char* data, const std::size_t size) noexcept {
+    if (size == 0 || !isAsciiSpace(data[size - 1])) {
+        return 0;
+    }
+    std::size_t count = 0;
+    for (; count + 8 <= size; count += 8) {
+        const std::uint64_t others = ~spaceBytes(loadWord(data + size - count - 8)) & ~lowSevenBits;
+        if (others != 0) {
+            return count + countLeadingZeros(others) / 8;
+        }
+    }
+    for (; count < size && isAsciiSpace(data[size - count - 1]); ++count) {
+    }
+    return count;
+}
+
+// Returns a mask with bit i set if bytes[i] == byte, for i in [0, length), length <= byteMaskBlockSize. Full blocks are
+// compared 8 bytes at a time without branches
+LZ_NODISCARD inline std::uint64_t byteMask(const char* bytes, const std::size_t length, const char byte) noexcept {
+    std::uint64_t mask = 0;
+    std::size_t i = 0;
+    if (length == byteMaskBlockSize) {
+        const std::uint64_t pattern = broadcastByte(static_cast<unsigned char>(byte));
+        for (; i < byteMaskBlockSize; i += 8) {
+            mask |= gatherHighBits(zeroBytes(loadWord(bytes + i) ^ pattern)) << i;
+        }
+        return mask;
+    }
+    for (; i < length; ++i) {
+        mask |= static_cast<std::uint64_t>(bytes[i] == byte) << i;
+    }
+    return mask;
+}
+
+// Finds delimiters in a buffer from front to back. Delimiters are searched with memchr, which is fastest for long tokens. Once
+// two consecutive matches fall in the same block of 64 bytes, the tokens are short, so the matches of that block are computed
+// at once into a bit mask, after which every next token in the block costs a bit scan instead of a call to memchr
+class DelimiterScanner {
+    std::size_t _blockBegin{ std::string::npos };
+    std::size_t _previousMatchBlock{ std::string::npos };
+    std::uint64_t _mask{};
+
+    std::size_t findByte(const char* data, const std::size_t size, std::size_t from, const char byte) noexcept {
+        if (from >= size) {
+            return std::string::npos;
+        }
+        const std::size_t block = from - from % byteMaskBlockSize;
+        if (block == _blockBegin) {
+            const std::uint64_t remaining = _mask & (~std::uint64_t{ 0 } << (from - block));
+            if (remaining != 0) {
+                return block + countTrailingZeros(remaining);
+            }
+            from = block + byteMaskBlockSize;
+            if (from >= size) {
+                return std::string::npos;
+            }
+        }
+
+        const void* match = std::memchr(data + from, byte, size - from);
+        if (match == nullptr) {
+            return std::string::npos;
+        }
+        const auto position = static_cast<std::size_t>(static_cast<const char*>(match) - data);
+        const std::size_t matchBlock = position - position % byteMaskBlockSize;
+        if (matchBlock == _previousMatchBlock) {
+            _blockBegin = matchBlock;
+            _mask = byteMask(data + matchBlock, (std::min)(byteMaskBlockSize, size - matchBlock), byte);
+        }
+        _previousMatchBlock = matchBlock;
+        return position;
+    }
+
+public:
+    //! Returns the position of the first `delimiter` in [data + from, data + size), or npos if there is none
+    std::size_t find(const char* data, const std::size_t size, const std::size_t from, const char delimiter) noexcept {
+        return findByte(data, size, from, delimiter);
+    }
+
+    //! Returns the position of the first `delimiter` in [data + from, data + size), or npos if there is none
+    std::size_t find(const char* data, const std::size_t size, std::size_t from, const std::string& delimiter) noexcept {
+        const std::size_t length = delimiter.size();
+        if (length == 0) {
+            return from <= size ? from : std::string::npos;
+        }
+        if (length > size) {
+            return std::string::npos;
+        }
+        if (length == 1) {
+            return findByte(data, size, from, delimiter[0]);
+        }
+        // Only the first byte is searched with the mask, candidates are verified with a memcmp of the rest
+        const std::size_t lastStart = size - length;
+        for (std::size_t position = findByte(data, size, from, delimiter[0]);
+             position != std::string::npos && position <= lastStart; position = findByte(data, size, position + 1, delimiter[0])) {
+            if (std::memcmp(data + position + 1, delimiter.data() + 1, length - 1) == 0) {
+                return position;
+            }
+        }
+        return std::string::npos;
+    }
+};
+
+// A set of characters, stored as a 256 bit lookup table so that testing whether a character is in the set is a shift and a mask,
+// regardless of the amount of characters in the set
+class CharSet {
+    std::uint64_t _bits[4]{};
+
+public:
+    constexpr CharSet() = default;
+
+    LZ_CONSTEXPR_CXX_14 CharSet(const char* characters, const std::size_t length) noexcept {
+        for (std::size_t i = 0; i < length; ++i) {
+            insert(characters[i]);
+        }
+    }
+
+    // Implicit, so that a set can be passed as a string literal, e.g. `" \t,;"`
+    LZ_CONSTEXPR_CXX_14 CharSet(const char* characters) noexcept { // NOLINT(google-explicit-constructor)
+        for (; *characters != '\0'; ++characters) {
+            insert(*characters);
+        }
+    }
+
+    LZ_CONSTEXPR_CXX_14 CharSet& insert(const char character) noexcept {
+        const auto byte = static_cast<unsigned char>(character);
+        _bits[byte >> 6] |= std::uint64_t{ 1 } << (byte & 63u);
+        return *this;
+    }
+
+    LZ_NODISCARD constexpr bool contains(const char character) const noexcept {
+        return ((_bits[static_cast<unsigned char>(character) >> 6] >> (static_cast<unsigned char>(character) & 63u)) & 1u) != 0;
+    }
+
+    //! Returns the position of the first character in [data + from, data + size) that is in the set, or size if there is none
+    LZ_NODISCARD std::size_t find(const char* data, const std::size_t size, std::size_t from) const noexcept {
+        for (; from < size && !contains(data[from]); ++from) {
+        }
+        return from;
+    }
+
+    //! Returns the position of the first character in [data + from, data + size) that is not in the set, or size if there is none
+    LZ_NODISCARD std::size_t skip(const char* data, const std::size_t size, std::size_t from) const noexcept {
+        for (; from < size && contains(data[from]); ++from) {
+        }
+        return from;
+    }
+
+    LZ_NODISCARD constexpr friend bool operator==(const CharSet& a, const CharSet& b) noexcept {
+        return a._bits[0] == b._bits[0] && a._bits[1] == b._bits[1] && a._bits[2] == b._bits[2] && a._bits[3] == b._bits[3];
+    }
+
+    LZ_NODISCARD constexpr friend bool operator!=(const CharSet& a, const CharSet& b) noexcept {
+        return !(a == b); // NOLINT
+    }
+};
+
+//! Returns the position of the last `delimiter` that starts in [data, data + from], or npos if there is none
+inline std::size_t reverseFindDelimiter(const char* data, const std::size_t size, std::size_t from, const char delimiter) noexcept {
+    if (size == 0) {
+        return std::string::npos;
+    }
+    for (std::size_t i = (std::min)(from, size - 1) + 1; i-- > 0;) {
+        if (data[i] == delimiter) {
+            return i;
+        }
+    }
+    return std::string::npos;
+}
+
+//! Returns the position of the last `delimiter` that starts in [data, data + from], or npos if there is none
+inline std::size_t
+reverseFindDelimiter(const char* data, const std::size_t size, std::size_t from, const std::string& delimiter) noexcept {
+    const std::size_t length = delimiter.size();
+    if (length > size) {
+        return std::string::npos;
+    }
+    for (std::size_t i = (std::min)(from, size - length) + 1; i-- > 0;) {
+        if (std::memcmp(data + i, delimiter.data(), length) == 0) {
+            return i;
+        }
+    }
+    return std::string::npos;
+}
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_BYTE_MASK_HPP
@@ -0,0 +1,139 @@
+#pragma once
+
+#ifndef LZ_CACHED_ITERATOR_HPP
+#    define LZ_CACHED_ITERATOR_HPP
+
+#    include "LzTools.hpp"
+
+#    include <deque>
+#    include <memory>
+#    include <mutex>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+// The amount of elements a cached view reads from its input at once by default
+constexpr LZ_INLINE_VAR std::size_t defaultCacheChunkSize = 256;
+
+// The buffer that the iterators of one cached view share. The input is read in chunks, and only when an iterator reaches a chunk
+// that wasn't read yet. A chunk is never changed once it's added and std::deque doesn't move its elements when one is appended,
+// so iterators can read a chunk without a lock. Only getting the next chunk is guarded by the mutex
+template<class Iterator>
+class CacheState {
+public:
+    using Chunk = std::vector<ValueType<Iterator>>;
+
+private:
+    std::mutex _mutex;
+    Iterator _iterator;
+    Iterator _end;
+    std::deque<Chunk> _chunks;
+    std::size_t _chunkSize;
+
+public:
+    CacheState(Iterator begin, Iterator end, const std::size_t chunkSize) :
+        _iterator(std::move(begin)),
+        _end(std::move(end)),
+        _chunkSize(chunkSize) {
+        LZ_ASSERT(chunkSize != 0, "the chunk size cannot be 0");
+    }
+
+    // The chunk at `index`, reading it from the input if necessary, or nullptr if the input has less chunks
+    const Chunk* chunk(const std::size_t index) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        while (_chunks.size() <= index && _iterator != _end) {
+            Chunk chunk;
+            chunk.reserve(_chunkSize);
+            for (; _iterator != _end && chunk.size() < _chunkSize; ++_iterator) {
+                chunk.push_back(*_iterator);
+            }
+            _chunks.push_back(std::move(chunk));
+        }
+        return index < _chunks.size() ? &_chunks[index] : nullptr;
+    }
+};
+
+template<class Iterator>
+class CachedIterator {
+    using State = CacheState<Iterator>;
+    using IterTraits = std::iterator_traits<Iterator>;
+
+    std::shared_ptr<State> _state{};
+    // The first chunk is only read when the iterator is used, so that creating a cached view doesn't evaluate anything
+    mutable std::size_t _chunkIndex{};
+    mutable const ValueType<Iterator>* _current{ nullptr };
+    mutable const ValueType<Iterator>* _chunkEnd{ nullptr };
+    mutable bool _isLoaded{ true };
+
+    void ensureLoaded() const {
+        if (!_isLoaded) {
+            load(0);
+        }
+    }
+
+    void load(const std::size_t chunkIndex) const {
+        _isLoaded = true;
+        _chunkIndex = chunkIndex;
+        const typename State::Chunk* chunk = _state->chunk(chunkIndex);
+        if (chunk == nullptr) {
+            _current = nullptr;
+            _chunkEnd = nullptr;
+            return;
+        }
+        _current = chunk->data();
+        _chunkEnd = chunk->data() + chunk->size();
+    }
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = ValueType<Iterator>;
+    using reference = const value_type&;
+    using difference_type = typename IterTraits::difference_type;
+    using pointer = const value_type*;
+
+    // Without a state, this is the end iterator
+    explicit CachedIterator(std::shared_ptr<State> state) : _state(std::move(state)), _isLoaded(_state == nullptr) {
+    }
+
+    CachedIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        ensureLoaded();
+        return *_current;
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        ensureLoaded();
+        return _current;
+    }
+
+    CachedIterator& operator++() {
+        ensureLoaded();
+        ++_current;
+        if (_current == _chunkEnd) {
+            load(_chunkIndex + 1);
+        }
+        return *this;
+    }
+
+    CachedIterator operator++(int) {
+        CachedIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    // Every cached element has its own address, and the end iterator points nowhere
+    LZ_NODISCARD friend bool operator==(const CachedIterator& a, const CachedIterator& b) {
+        a.ensureLoaded();
+        b.ensureLoaded();
+        return a._current == b._current;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const CachedIterator& a, const CachedIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_CACHED_ITERATOR_HPP
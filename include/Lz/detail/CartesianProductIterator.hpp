@@ -5,7 +5,8 @@
 
 #    include "LzTools.hpp"
 
-#    include <numeric>
+#    include <algorithm>
+#    include <limits>
 
 namespace lz {
 namespace internal {
@@ -102,39 +103,6 @@ private:
 #            pragma warning(pop)
 #        endif // LZ_MSVC
 
-    template<std::size_t I>
-    LZ_CONSTEXPR_CXX_20 EnableIf<I == 0> operatorPlusImpl(const difference_type offset) {
-        using lz::next;
-        using std::next;
-        auto& iterator = std::get<0>(_iterator);
-        iterator = next(std::move(iterator), offset);
-    }
-
-    template<std::size_t I>
-    EnableIf<(I > 0)> operatorPlusImpl(const difference_type offset) {
-        using lz::next;
-        using std::next;
-        auto& iterator = std::get<I>(_iterator);
-        const auto& begin = std::get<I>(_begin);
-        const auto& end = std::get<I>(_end);
-        difference_type dist;
-        if (offset < 0) {
-            if (iterator == begin) {
-                iterator = end;
-                dist = getIterLength(begin, iterator);
-            }
-            else {
-                dist = getIterLength(begin, iterator) + 1;
-            }
-        }
-        else {
-            dist = getIterLength(iterator, end);
-        }
-        const auto offsets = std::lldiv(offset, dist);
-        iterator = next(std::move(iterator), static_cast<difference_type>(offsets.rem));
-        operatorPlusImpl<I - 1>(static_cast<difference_type>(offsets.quot));
-    }
-
 #    else
     template<std::size_t I>
     LZ_CONSTEXPR_CXX_20 void next() {
@@ -154,39 +122,6 @@ private:
         }
     }
 
-    template<std::size_t I>
-    void operatorPlusImpl(const difference_type offset) {
-        using lz::next;
-        using std::next;
-
-        auto& iterator = std::get<I>(_iterator);
-        if constexpr (I == 0) {
-            iterator = next(std::move(iterator), offset);
-        }
-        else {
-            using lz::next;
-            using std::next;
-            const auto& begin = std::get<I>(_begin);
-            const auto& end = std::get<I>(_end);
-            difference_type dist;
-            if (offset < 0) {
-                if (iterator == begin) {
-                    iterator = end;
-                    dist = getIterLength(begin, iterator);
-                }
-                else {
-                    dist = getIterLength(begin, iterator) + 1;
-                }
-            }
-            else {
-                dist = getIterLength(iterator, end);
-            }
-            const auto [quot, rem] = std::lldiv(offset, dist);
-            iterator = next(std::move(iterator), static_cast<difference_type>(rem));
-            operatorPlusImpl<I - 1>(static_cast<difference_type>(quot));
-        }
-    }
-
     template<std::size_t I>
     LZ_CONSTEXPR_CXX_20 void doPrev() {
         using Iter = Decay<decltype(std::get<I>(_iterator))>;
@@ -238,28 +173,100 @@ private:
         return { *std::get<Is>(_iterator)... };
     }
 
+    template<std::size_t I>
+    LZ_CONSTEXPR_CXX_20 difference_type dimensionLength() const {
+        return static_cast<difference_type>(getIterLength(std::get<I>(_begin), std::get<I>(_end)));
+    }
+
     template<std::size_t... Is>
-    LZ_CONSTEXPR_CXX_20 difference_type distanceImpl(IndexSequence<Is...>, const CartesianProductIterator& c) const {
-#    ifdef LZ_HAS_CXX_11
-        const auto mulFn = std::multiplies<difference_type>();
-#    else
-        const auto mulFn = std::multiplies<>();
-#    endif // LZ_HAS_CXX_11
-        const difference_type distances[] = { static_cast<difference_type>(
-            getIterLength(std::get<Is>(_iterator), std::get<Is>(c._iterator)))... };
-        return std::accumulate(std::begin(distances), std::end(distances), difference_type{ 1 }, mulFn);
+    LZ_CONSTEXPR_CXX_20 difference_type lengthImpl(IndexSequence<Is...>) const {
+        const difference_type lengths[] = { dimensionLength<Is>()... };
+        difference_type length = 1;
+        for (const difference_type dimension : lengths) {
+            length *= dimension;
+        }
+        return length;
     }
 
+    // The position in the product is a mixed radix number: its digits are the positions of the iterators and its radices the
+    // lengths of the sequences, the last sequence being the least significant digit
     template<std::size_t... Is>
-    LZ_CONSTEXPR_CXX_20 bool lessThan(IndexSequence<Is...>, const CartesianProductIterator& c) const {
-        const bool allLessThan[] = { (std::get<Is>(_iterator) < std::get<Is>(c._iterator))... };
-        const auto end = std::end(allLessThan);
-        return std::find(std::begin(allLessThan), end, false) == end;
+    LZ_CONSTEXPR_CXX_20 difference_type indexImpl(IndexSequence<Is...>) const {
+        if (std::get<0>(_iterator) == std::get<0>(_end)) {
+            return lengthImpl(IndexSequence<Is...>());
+        }
+        const difference_type digits[] = { static_cast<difference_type>(
+            getIterLength(std::get<Is>(_begin), std::get<Is>(_iterator)))... };
+        const difference_type radices[] = { dimensionLength<Is>()... };
+        difference_type index = 0;
+        for (std::size_t i = 0; i != sizeof...(Is); ++i) {
+            index = index * radices[i] + digits[i];
+        }
+        return index;
+    }
+
+    template<std::size_t I>
+    LZ_CONSTEXPR_CXX_20 EnableIf<I == 0> setIndex(const difference_type index) {
+        using lz::next;
+        using std::next;
+        std::get<0>(_iterator) = next(std::get<0>(_begin), index);
+    }
+
+    template<std::size_t I>
+    LZ_CONSTEXPR_CXX_20 EnableIf<(I > 0)> setIndex(const difference_type index) {
+        using lz::next;
+        using std::next;
+        const difference_type radix = dimensionLength<I>();
+        std::get<I>(_iterator) = next(std::get<I>(_begin), index % radix);
+        setIndex<I - 1>(index / radix);
+    }
+
+    template<std::size_t... Is>
+    LZ_CONSTEXPR_CXX_20 bool isAnyEmpty(IndexSequence<Is...>) const {
+        const bool empty[] = { (std::get<Is>(_begin) == std::get<Is>(_end))... };
+        return std::find(std::begin(empty), std::end(empty), true) != std::end(empty);
+    }
+
+    template<class... Refs>
+    static LZ_CONSTEXPR_CXX_20 reference makeReference(Refs&... refs) {
+        return reference(static_cast<RefType<Iterators>>(refs)...);
+    }
+
+    // Push based iteration as a loop nest: the elements of the outer sequences are dereferenced once per iteration of their own
+    // loop, after which the innermost loop only dereferences and increments its own iterator. `remaining` is the amount of
+    // combinations that are left before the end is reached
+    template<std::size_t I, class Sink, class... Refs>
+    LZ_CONSTEXPR_CXX_20 EnableIf<(I + 1 == sizeof...(Iterators)), bool>
+    loopNest(difference_type& remaining, Sink& sink, Refs&... refs) {
+        auto& iterator = std::get<I>(_iterator);
+        const auto& end = std::get<I>(_end);
+        for (; iterator != end && remaining != 0; ++iterator, --remaining) {
+            auto&& value = *iterator;
+            if (!sink(makeReference(refs..., value))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<std::size_t I, class Sink, class... Refs>
+    LZ_CONSTEXPR_CXX_20 EnableIf<(I + 1 < sizeof...(Iterators)), bool>
+    loopNest(difference_type& remaining, Sink& sink, Refs&... refs) {
+        auto& iterator = std::get<I>(_iterator);
+        const auto& end = std::get<I>(_end);
+        for (; iterator != end && remaining != 0; ++iterator) {
+            auto&& value = *iterator;
+            if (!loopNest<I + 1>(remaining, sink, refs..., value)) {
+                return false;
+            }
+            std::get<I + 1>(_iterator) = std::get<I + 1>(_begin);
+        }
+        return true;
     }
 
     using IndexSequenceForThis = MakeIndexSequence<sizeof...(Iterators)>;
 
-    void checkEnd() {
+    LZ_CONSTEXPR_CXX_20 void checkEnd() {
         if (std::get<0>(_iterator) == std::get<0>(_end)) {
             _iterator = _end;
         }
@@ -273,6 +280,10 @@ public:
         _begin(std::move(begin)),
         _iterator(std::move(iterator)),
         _end(std::move(end)) {
+        // If one of the sequences is empty, so is the product
+        if (isAnyEmpty(IndexSequenceForThis())) {
+            _iterator = _end;
+        }
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
@@ -306,9 +317,32 @@ public:
         return tmp;
     }
 
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool forEachWhile(const CartesianProductIterator& end, Sink& sink) {
+        if (*this == end) {
+            return true;
+        }
+        // Up to the end of the product, the loops end by themselves, so the combinations don't have to be counted
+        difference_type remaining =
+            end._iterator == _end ? (std::numeric_limits<difference_type>::max)() : end.index() - index();
+        return loopNest<0>(remaining, sink);
+    }
+
+    // The index of the current combination. In O(1) time if all iterators are random access
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type index() const {
+        return indexImpl(IndexSequenceForThis());
+    }
+
     LZ_CONSTEXPR_CXX_20 CartesianProductIterator& operator+=(const difference_type offset) {
-        operatorPlusImpl<sizeof...(Iterators) - 1>(offset);
-        checkEnd();
+        const difference_type index = this->index() + offset;
+        const difference_type length = lengthImpl(IndexSequenceForThis());
+        LZ_ASSERT(index >= 0 && index <= length, "cannot increment/decrement beyond the bounds of the product");
+        if (index == length) {
+            _iterator = _end;
+        }
+        else {
+            setIndex<sizeof...(Iterators) - 1>(index);
+        }
         return *this;
     }
 
@@ -318,6 +352,11 @@ public:
         return tmp;
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend CartesianProductIterator operator+(const difference_type offset,
+                                                                               const CartesianProductIterator& iterator) {
+        return iterator + offset;
+    }
+
     LZ_CONSTEXPR_CXX_20 CartesianProductIterator& operator-=(const difference_type offset) {
         return *this += -offset;
     }
@@ -328,6 +367,10 @@ public:
         return tmp;
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator[](const difference_type offset) const {
+        return *(*this + offset);
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
     operator==(const CartesianProductIterator& lhs, const CartesianProductIterator& rhs) noexcept {
         return lhs._iterator == rhs._iterator;
@@ -340,12 +383,12 @@ public:
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend difference_type
     operator-(const CartesianProductIterator& a, const CartesianProductIterator& b) {
-        return b.distanceImpl(IndexSequenceForThis(), a);
+        return a.index() - b.index();
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
     operator<(const CartesianProductIterator& a, const CartesianProductIterator& b) {
-        return a.lessThan(IndexSequenceForThis(), b);
+        return a.index() < b.index();
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
@@ -0,0 +1,96 @@
+#pragma once
+
+#ifndef LZ_CHAR_SET_SPLIT_ITERATOR_HPP
+#    define LZ_CHAR_SET_SPLIT_ITERATOR_HPP
+
+#    include "ByteMask.hpp"
+#    include "LzTools.hpp"
+
+namespace lz {
+namespace internal {
+// Splits the characters [data, data + size) on every character that is in a CharSet. If `collapse` is true, runs of delimiters
+// are treated as one and no empty tokens are returned, so leading and trailing delimiters are skipped as well. Like lz::split, an
+// empty sequence has no tokens at all
+template<class SubString>
+class CharSetSplitIterator {
+    const char* _data{ nullptr };
+    std::size_t _size{};
+    std::size_t _tokenBegin{};
+    std::size_t _tokenEnd{};
+    CharSet _delimiters{};
+    bool _collapse{};
+
+    void toEnd() noexcept {
+        _tokenBegin = _size + 1;
+        _tokenEnd = _size + 1;
+    }
+
+    void startTokenAt(const std::size_t position) noexcept {
+        _tokenBegin = _collapse ? _delimiters.skip(_data, _size, position) : position;
+        if (_collapse && _tokenBegin == _size) {
+            toEnd();
+            return;
+        }
+        _tokenEnd = _delimiters.find(_data, _size, _tokenBegin);
+    }
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = SubString;
+    using reference = SubString;
+    using difference_type = std::ptrdiff_t;
+    using pointer = FakePointerProxy<reference>;
+
+    CharSetSplitIterator(const char* data, const std::size_t size, const CharSet& delimiters, const bool collapse,
+                         const bool isEnd) :
+        _data(data),
+        _size(size),
+        _delimiters(delimiters),
+        _collapse(collapse) {
+        if (isEnd || size == 0) {
+            toEnd();
+        }
+        else {
+            startTokenAt(0);
+        }
+    }
+
+    CharSetSplitIterator() = default;
+
+    LZ_NODISCARD value_type operator*() const {
+        return SubString(_data + _tokenBegin, _tokenEnd - _tokenBegin);
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    CharSetSplitIterator& operator++() {
+        if (_tokenEnd >= _size) {
+            toEnd();
+        }
+        else {
+            startTokenAt(_tokenEnd + 1);
+        }
+        return *this;
+    }
+
+    CharSetSplitIterator operator++(int) {
+        CharSetSplitIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const CharSetSplitIterator& a, const CharSetSplitIterator& b) noexcept {
+        LZ_ASSERT(a._delimiters == b._delimiters, "incompatible iterator types, found different delimiters");
+        return a._tokenBegin != b._tokenBegin;
+    }
+
+    LZ_NODISCARD friend bool operator==(const CharSetSplitIterator& a, const CharSetSplitIterator& b) noexcept {
+        return !(a != b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_CHAR_SET_SPLIT_ITERATOR_HPP
@@ -5,9 +5,31 @@
 
 #    include "BasicIteratorView.hpp"
 #    include "FunctionContainer.hpp"
+#    include "Reduce.hpp"
 
 namespace lz {
 namespace internal {
+// The predicate of `lz::equalTo`
+template<class T>
+struct EqualTo {
+    T value;
+
+    template<class U>
+    LZ_NODISCARD constexpr bool operator()(const U& element) const {
+        return element == value;
+    }
+};
+
+// Whether the chunks are split on elements that are equal to a number, which is searched for like `lz::find` does instead of
+// calling the predicate for every element
+template<class UnaryPredicate>
+struct IsNumberDelimiter : std::false_type {};
+
+template<class T>
+struct IsNumberDelimiter<EqualTo<T>> : std::is_arithmetic<T> {};
+
+constexpr LZ_INLINE_VAR std::ptrdiff_t shortChunkLength = 32;
+
 #    ifdef LZ_HAS_EXECUTION
 template<class Iterator, class UnaryPredicate, class Execution>
 #    else  // ^^ LZ_HAS_EXECUTION vv !LZ_HAS_EXECUTION
@@ -19,7 +41,8 @@ class ChunkIfIterator {
     Iterator _subRangeBegin{};
     Iterator _subRangeEnd{};
     Iterator _end{};
-    mutable FunctionContainer<UnaryPredicate> _predicate{};
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<UnaryPredicate> _predicate{};
 #    ifdef LZ_HAS_EXECUTION
     LZ_NO_UNIQUE_ADDRESS
     Execution _execution{};
@@ -35,17 +58,44 @@ public:
     using pointer = FakePointerProxy<reference>;
 
 private:
+    // Searching has a start up cost that is only earned back on longer chunks, so the first elements are compared one by one
+    template<class I>
+    LZ_CONSTEXPR_CXX_20 I findDelimiter(std::true_type /* isRandomAccess */, I first, const I& last) const {
+        const auto delimiter = _predicate.function().value;
+        const I probeEnd = last - first > shortChunkLength ? first + shortChunkLength : last;
+        first = std::find(std::move(first), probeEnd, delimiter);
+        if (first != probeEnd) {
+            return first;
+        }
+        return findValue(std::move(first), last, delimiter);
+    }
+
+    template<class I>
+    LZ_CONSTEXPR_CXX_20 I findDelimiter(std::false_type /* isRandomAccess */, I first, const I& last) const {
+        return findValue(std::move(first), last, _predicate.function().value);
+    }
+
+    template<class I>
+    LZ_CONSTEXPR_CXX_20 I findSequential(std::true_type /* isNumberDelimiter */, I first, const I& last) const {
+        return findDelimiter(IsRandomAccess<I>(), std::move(first), last);
+    }
+
+    template<class I>
+    LZ_CONSTEXPR_CXX_20 I findSequential(std::false_type /* isNumberDelimiter */, I first, const I& last) const {
+        return std::find_if(std::move(first), last, _predicate);
+    }
+
     template<class I>
     LZ_CONSTEXPR_CXX_20 I findNext(I first, I last) {
 #    ifdef LZ_HAS_EXECUTION
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
-            return std::find_if(_execution, std::move(first), std::move(last), _predicate);
+            return findSequential(IsNumberDelimiter<UnaryPredicate>(), std::move(first), last);
         }
         else {
-            return std::find_if(std::move(first), std::move(last), _predicate);
+            return internal::findIfBatched(_execution, std::move(first), std::move(last), _predicate);
         }
 #    else  // ^^ LZ_HAS_EXECUTION vv !LZ_HAS_EXECUTION
-        return std::find_if(std::move(first), std::move(last), _predicate);
+        return findSequential(IsNumberDelimiter<UnaryPredicate>(), std::move(first), last);
 #    endif // LZ_HAS_EXECUTION
     }
 
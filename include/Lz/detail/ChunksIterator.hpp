@@ -201,7 +201,7 @@ public:
 
     LZ_CONSTEXPR_CXX_20 ChunksIterator operator--(int) {
         ChunksIterator tmp(*this);
-        ++*this;
+        --*this;
         return tmp;
     }
 
@@ -215,33 +215,21 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_20 ChunksIterator& operator+=(const difference_type offset) {
-        auto totalOffset = _chunkSize * offset;
-        if (offset == 0) {
-            return *this;
+        // Jumps directly to the chunk `offset` steps away, producing the same sub ranges as repeatedly calling ++ or --.
+        // All distances are clamped against _begin and _end so no iterator is ever moved out of its range.
+        if (offset > 0) {
+            const auto skip = (offset - 1) * _chunkSize;
+            const auto remaining = _end - _subRangeEnd;
+            _subRangeBegin = _subRangeEnd + (skip < remaining ? skip : remaining);
+            const auto chunkLength = _end - _subRangeBegin;
+            _subRangeEnd = _subRangeBegin + (_chunkSize < chunkLength ? _chunkSize : chunkLength);
         }
-        if (totalOffset < 0) {
-            auto dist = _subRangeEnd - _begin;
-            if (std::abs(totalOffset) > dist) {
-                _subRangeBegin = _begin;
-                _subRangeEnd = _begin + static_cast<difference_type>((_end - _begin) / _chunkSize);
-            }
-            else {
-                if (offset != -1 || _subRangeEnd != _end) {
-                    totalOffset += _chunkSize;
-                    _subRangeEnd += totalOffset;
-                }
-                _subRangeBegin = totalOffset >= _subRangeEnd - _begin ? _begin : _subRangeEnd + totalOffset;
-            }
-        }
-        else {
-            if (totalOffset >= _end - _subRangeBegin) {
-                _subRangeEnd = _end;
-                _subRangeBegin += _end - _subRangeBegin;
-            }
-            else {
-                _subRangeBegin += totalOffset;
-                _subRangeEnd = totalOffset >= _end - _subRangeBegin ? _end : _subRangeBegin + totalOffset;
-            }
+        else if (offset < 0) {
+            const auto skip = (-offset - 1) * _chunkSize;
+            const auto remaining = _subRangeBegin - _begin;
+            _subRangeEnd = _subRangeBegin - (skip < remaining ? skip : remaining);
+            const auto chunkLength = _subRangeEnd - _begin;
+            _subRangeBegin = _subRangeEnd - (_chunkSize < chunkLength ? _chunkSize : chunkLength);
         }
         return *this;
     }
@@ -252,6 +240,11 @@ public:
         return tmp;
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend ChunksIterator operator+(const difference_type offset,
+                                                                     const ChunksIterator& iterator) {
+        return iterator + offset;
+    }
+
     LZ_CONSTEXPR_CXX_20 ChunksIterator& operator-=(const difference_type offset) {
         return *this += -offset;
     }
@@ -262,11 +255,13 @@ public:
         return tmp;
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend difference_type operator-(const ChunksIterator& lhs, const ChunksIterator& rhs) {
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend EnableIf<IsRandomAccess<I>::value, difference_type>
+    operator-(const ChunksIterator& lhs, const ChunksIterator& rhs) {
         LZ_ASSERT(lhs._chunkSize == rhs._chunkSize, "incompatible iterators: different chunk sizes");
-        const auto dist = lhs._subRangeBegin - rhs._subRangeBegin;
-        return dist == 0 ? 0 : roundEven(dist, lhs._chunkSize);
+        return roundEven(lhs._subRangeBegin - rhs._subRangeBegin, lhs._chunkSize);
     }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator[](const difference_type offset) const {
         return *(*this + offset);
     }
@@ -0,0 +1,257 @@
+#pragma once
+
+#ifndef LZ_CONCATENATE_ALL_ITERATOR_HPP
+#    define LZ_CONCATENATE_ALL_ITERATOR_HPP
+
+#    include "LzTools.hpp"
+
+#    include <algorithm>
+#    include <memory>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+// The ranges of `lz::concatAll`, shared by all of its iterators. `offsets[i]` is the amount of elements before range i and
+// `offsets.back()` the total amount of elements. The offsets are only computed if the ranges are sized.
+template<class Iterator>
+struct ConcatenateAllSegments {
+    std::vector<Iterator> begins{};
+    std::vector<Iterator> ends{};
+    std::vector<DiffType<Iterator>> offsets{};
+
+    template<class OuterIterator>
+    ConcatenateAllSegments(OuterIterator begin, OuterIterator end) {
+        for (; begin != end; ++begin) {
+            begins.push_back(internal::begin(*begin));
+            ends.push_back(internal::end(*begin));
+        }
+        computeOffsets(IsSized<Iterator>());
+    }
+
+private:
+    void computeOffsets(std::true_type /* isSized */) {
+        offsets.reserve(begins.size() + 1);
+        offsets.push_back(0);
+        for (std::size_t i = 0; i != begins.size(); ++i) {
+            offsets.push_back(offsets.back() + getIterLength(begins[i], ends[i]));
+        }
+    }
+
+    void computeOffsets(std::false_type /* isSized */) {
+    }
+};
+
+// Iterates over a runtime amount of ranges. Besides the current position, the end of the current range is kept, so that
+// incrementing only looks up the next range when the current one is exhausted. The iterator never points to the end of a
+// range, except for the end of the last range, which is the end of the whole sequence.
+template<LZ_CONCEPT_ITERATOR Iterator>
+class ConcatenateAllIterator {
+    using Segments = ConcatenateAllSegments<Iterator>;
+    using IterTraits = std::iterator_traits<Iterator>;
+
+    std::shared_ptr<const Segments> _segments{};
+    std::size_t _segment{};
+    Iterator _iterator{};
+    Iterator _segmentEnd{};
+
+public:
+    using value_type = typename IterTraits::value_type;
+    using difference_type = typename IterTraits::difference_type;
+    using reference = typename IterTraits::reference;
+    using pointer = FakePointerProxy<reference>;
+    using iterator_category = typename IterTraits::iterator_category;
+
+private:
+    void enterSegment(const std::size_t segment, Iterator iterator) {
+        _segment = segment;
+        _iterator = std::move(iterator);
+        _segmentEnd = _segments->ends[segment];
+    }
+
+    void skipExhaustedSegments() {
+        const std::size_t last = _segments->begins.size() - 1;
+        while (_iterator == _segmentEnd && _segment != last) {
+            enterSegment(_segment + 1, _segments->begins[_segment + 1]);
+        }
+    }
+
+    difference_type index() const {
+        if (_segments == nullptr || _segments->begins.empty()) {
+            return 0;
+        }
+        return _segments->offsets[_segment] + getIterLength(_segments->begins[_segment], _iterator);
+    }
+
+    // The segment that contains `index` is the last one whose offset is not greater than it. Empty segments share their offset
+    // with the next segment, so they are never selected, except the last one, when `index` is the total size
+    void seek(const difference_type index) {
+        const auto& offsets = _segments->offsets;
+        const auto next = std::upper_bound(offsets.begin(), offsets.end() - 1, index);
+        const auto segment = static_cast<std::size_t>(next - offsets.begin()) - 1;
+        enterSegment(segment, _segments->begins[segment] + (index - offsets[segment]));
+    }
+
+public:
+    ConcatenateAllIterator(std::shared_ptr<const Segments> segments, const bool isEnd) : _segments(std::move(segments)) {
+        if (_segments->begins.empty()) {
+            return;
+        }
+        if (isEnd) {
+            const std::size_t last = _segments->begins.size() - 1;
+            enterSegment(last, _segments->ends[last]);
+            return;
+        }
+        enterSegment(0, _segments->begins.front());
+        skipExhaustedSegments();
+    }
+
+    ConcatenateAllIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return *_iterator;
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    template<class I = Iterator>
+    LZ_NODISCARD EnableIf<IsSized<I>::value, difference_type> sizeTo(const ConcatenateAllIterator& end) const {
+        return end.index() - index();
+    }
+
+    LZ_NODISCARD SizeHint sizeHintTo(const ConcatenateAllIterator& end) const {
+        if (_segment == end._segment) {
+            return sizeHint(_iterator, end._iterator);
+        }
+        SizeHint total = sizeHint(_iterator, _segmentEnd);
+        for (std::size_t segment = _segment + 1; segment <= end._segment; ++segment) {
+            const Iterator& segmentEnd = segment == end._segment ? end._iterator : _segments->ends[segment];
+            const SizeHint hint = sizeHint(_segments->begins[segment], segmentEnd);
+            total.lower += hint.lower;
+            total.upper = (total.upper == unknownSize || hint.upper == unknownSize) ? unknownSize : total.upper + hint.upper;
+        }
+        return total;
+    }
+
+    template<class Sink>
+    bool forEachWhile(const ConcatenateAllIterator& end, Sink& sink) const {
+        if (_segment == end._segment) {
+            return internal::forEachWhile(_iterator, end._iterator, sink);
+        }
+        if (!internal::forEachWhile(_iterator, _segmentEnd, sink)) {
+            return false;
+        }
+        for (std::size_t segment = _segment + 1; segment != end._segment; ++segment) {
+            if (!internal::forEachWhile(_segments->begins[segment], _segments->ends[segment], sink)) {
+                return false;
+            }
+        }
+        return internal::forEachWhile(_segments->begins[end._segment], end._iterator, sink);
+    }
+
+    template<class SegmentSink>
+    void forEachSegment(const ConcatenateAllIterator& end, SegmentSink& sink) const {
+        if (_segment == end._segment) {
+            internal::forEachSegment(_iterator, end._iterator, sink);
+            return;
+        }
+        internal::forEachSegment(_iterator, _segmentEnd, sink);
+        for (std::size_t segment = _segment + 1; segment != end._segment; ++segment) {
+            internal::forEachSegment(_segments->begins[segment], _segments->ends[segment], sink);
+        }
+        internal::forEachSegment(_segments->begins[end._segment], end._iterator, sink);
+    }
+
+    ConcatenateAllIterator& operator++() {
+        ++_iterator;
+        if (_iterator == _segmentEnd) {
+            skipExhaustedSegments();
+        }
+        return *this;
+    }
+
+    ConcatenateAllIterator operator++(int) {
+        ConcatenateAllIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    ConcatenateAllIterator& operator--() {
+        while (_iterator == _segments->begins[_segment]) {
+            enterSegment(_segment - 1, _segments->ends[_segment - 1]);
+        }
+        --_iterator;
+        return *this;
+    }
+
+    ConcatenateAllIterator operator--(int) {
+        ConcatenateAllIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    ConcatenateAllIterator& operator+=(const difference_type offset) {
+        seek(index() + offset);
+        return *this;
+    }
+
+    ConcatenateAllIterator& operator-=(const difference_type offset) {
+        seek(index() - offset);
+        return *this;
+    }
+
+    LZ_NODISCARD ConcatenateAllIterator operator+(const difference_type offset) const {
+        ConcatenateAllIterator tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend ConcatenateAllIterator operator+(const difference_type offset, const ConcatenateAllIterator& iterator) {
+        return iterator + offset;
+    }
+
+    LZ_NODISCARD ConcatenateAllIterator operator-(const difference_type offset) const {
+        ConcatenateAllIterator tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    template<class I = Iterator>
+    LZ_NODISCARD friend EnableIf<IsRandomAccess<I>::value, difference_type>
+    operator-(const ConcatenateAllIterator& a, const ConcatenateAllIterator& b) {
+        return a.index() - b.index();
+    }
+
+    LZ_NODISCARD reference operator[](const difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    LZ_NODISCARD friend bool operator==(const ConcatenateAllIterator& a, const ConcatenateAllIterator& b) {
+        return a._segment == b._segment && a._iterator == b._iterator;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const ConcatenateAllIterator& a, const ConcatenateAllIterator& b) {
+        return !(a == b); // NOLINT
+    }
+
+    LZ_NODISCARD friend bool operator<(const ConcatenateAllIterator& a, const ConcatenateAllIterator& b) {
+        return a._segment < b._segment || (a._segment == b._segment && a._iterator < b._iterator);
+    }
+
+    LZ_NODISCARD friend bool operator>(const ConcatenateAllIterator& a, const ConcatenateAllIterator& b) {
+        return b < a; // NOLINT
+    }
+
+    LZ_NODISCARD friend bool operator<=(const ConcatenateAllIterator& a, const ConcatenateAllIterator& b) {
+        return !(b < a); // NOLINT
+    }
+
+    LZ_NODISCARD friend bool operator>=(const ConcatenateAllIterator& a, const ConcatenateAllIterator& b) {
+        return !(a < b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_CONCATENATE_ALL_ITERATOR_HPP
@@ -5,268 +5,163 @@
 
 #include "LzTools.hpp"
 
+#include <array>
 #include <numeric>
 
 namespace lz {
 namespace internal {
-#ifndef __cpp_if_constexpr
-template<class Tuple, std::size_t I, class = void>
-struct PlusPlus {
-    LZ_CONSTEXPR_CXX_20 void operator()(Tuple& iterators, const Tuple& end) const {
-        if (std::get<I>(iterators) != std::get<I>(end)) {
-            ++std::get<I>(iterators);
-        }
-        else {
-            PlusPlus<Tuple, I + 1>()(iterators, end);
+// Calls `f(std::integral_constant<std::size_t, I>())`, where I is `index`. As `index` is only compared with constants, this
+// costs an integer comparison per range at most, while the function object stays inlinable
+template<std::size_t I, std::size_t N, class = void>
+struct VisitConcat {
+    template<class F>
+    LZ_CONSTEXPR_CXX_20 auto operator()(const std::size_t index, F& f) const
+        -> decltype(f(std::integral_constant<std::size_t, I>())) {
+        if (index == I) {
+            return f(std::integral_constant<std::size_t, I>());
         }
+        return VisitConcat<I + 1, N>()(index, f);
     }
 };
 
-template<class Tuple, std::size_t I>
-struct PlusPlus<Tuple, I, EnableIf<I == std::tuple_size<Decay<Tuple>>::value>> {
-    LZ_CONSTEXPR_CXX_20 void operator()(const Tuple& /*iterators*/, const Tuple& /*end*/) const {
+template<std::size_t I, std::size_t N>
+struct VisitConcat<I, N, EnableIf<I == N - 1>> {
+    template<class F>
+    LZ_CONSTEXPR_CXX_20 auto operator()(const std::size_t /*index*/, F& f) const
+        -> decltype(f(std::integral_constant<std::size_t, I>())) {
+        return f(std::integral_constant<std::size_t, I>());
     }
 };
 
-template<class Tuple, std::size_t I, class = void>
-struct NotEqual {
-    LZ_CONSTEXPR_CXX_20 bool operator()(const Tuple& iterators, const Tuple& end) const noexcept {
-        const bool iterHasValue = std::get<I>(iterators) != std::get<I>(end);
-        return iterHasValue ? iterHasValue : NotEqual<Tuple, I + 1>()(iterators, end);
-    }
-};
+template<class Tuple>
+struct ConcatIsEqual {
+    const Tuple& a;
+    const Tuple& b;
 
-template<class Tuple, std::size_t I>
-struct NotEqual<Tuple, I, EnableIf<I == std::tuple_size<Decay<Tuple>>::value - 1>> {
-    LZ_CONSTEXPR_CXX_20 bool operator()(const Tuple& iterators, const Tuple& end) const noexcept {
-        return std::get<I>(iterators) != std::get<I>(end);
+    template<std::size_t I>
+    LZ_CONSTEXPR_CXX_20 bool operator()(std::integral_constant<std::size_t, I>) const {
+        return std::get<I>(a) == std::get<I>(b);
     }
 };
 
-template<class Tuple, std::size_t I, class = void>
-struct Deref {
-    LZ_CONSTEXPR_CXX_20 auto operator()(const Tuple& iterators, const Tuple& end) const -> decltype(*std::get<I>(iterators)) {
-        return std::get<I>(iterators) != std::get<I>(end) ? *std::get<I>(iterators) : Deref<Tuple, I + 1>()(iterators, end);
-    }
-};
+template<class Tuple, class Reference>
+struct ConcatDeref {
+    const Tuple& iterators;
 
-template<class Tuple, std::size_t I>
-struct Deref<Tuple, I, EnableIf<I == std::tuple_size<Decay<Tuple>>::value - 1>> {
-    LZ_CONSTEXPR_CXX_20 auto operator()(const Tuple& iterators, const Tuple&) const -> decltype(*std::get<I>(iterators)) {
+    template<std::size_t I>
+    LZ_CONSTEXPR_CXX_20 Reference operator()(std::integral_constant<std::size_t, I>) const {
         return *std::get<I>(iterators);
     }
 };
 
-template<class Tuple, std::size_t I>
-struct MinusMinus {
-    LZ_CONSTEXPR_CXX_20 void operator()(Tuple& iterators, const Tuple& begin, const Tuple& end) const {
-        auto& current = std::get<I>(iterators);
-        if (current != std::get<I>(begin)) {
-            --current;
-        }
-        else {
-            MinusMinus<Tuple, I - 1>()(iterators, begin, end);
-        }
-    }
-};
-
+// Increments the iterator of range I and returns whether it reached the end of the range
 template<class Tuple>
-struct MinusMinus<Tuple, 0> {
-    LZ_CONSTEXPR_CXX_20 void operator()(Tuple& iterators, const Tuple&, const Tuple&) const {
-        --std::get<0>(iterators);
-    }
-};
+struct ConcatIncrement {
+    Tuple& iterators;
+    const Tuple& end;
 
-template<class Tuple, std::size_t I>
-struct MinIs {
-    template<class DifferenceType>
-    LZ_CONSTEXPR_CXX_20 void
-    operator()(Tuple& iterators, const Tuple& begin, const Tuple& end, const DifferenceType offset) const {
-        using TupElem = TupleElement<I, Tuple>;
-        const TupElem current = std::get<I>(iterators);
-        const TupElem currentBegin = std::get<I>(begin);
-        // Current is begin, move on to next iterator
-        if (current == currentBegin) {
-            MinIs<Tuple, I - 1>()(iterators, begin, end, offset);
-        }
-        else {
-            const auto dist = std::get<I>(end) - current;
-            if (dist <= offset) {
-                std::get<I>(iterators) = std::get<I>(begin);
-                MinIs<Tuple, I - 1>()(iterators, begin, end, dist == 0 ? DifferenceType{ 1 } : offset - dist);
-            }
-            else {
-                std::get<I>(iterators) -= offset;
-            }
-        }
+    template<std::size_t I>
+    LZ_CONSTEXPR_CXX_20 bool operator()(std::integral_constant<std::size_t, I>) const {
+        return ++std::get<I>(iterators) == std::get<I>(end);
     }
 };
 
 template<class Tuple>
-struct MinIs<Tuple, 0> {
-    template<class DifferenceType>
-    LZ_CONSTEXPR_CXX_20 void
-    operator()(Tuple& iterators, const Tuple& /* begin */, const Tuple& /*end*/, const DifferenceType offset) const {
-        using TupElem = TupleElement<0, Tuple>;
-        TupElem& current = std::get<0>(iterators);
-        current -= offset;
+struct ConcatDecrement {
+    Tuple& iterators;
+
+    template<std::size_t I>
+    LZ_CONSTEXPR_CXX_20 void operator()(std::integral_constant<std::size_t, I>) const {
+        --std::get<I>(iterators);
     }
 };
 
-template<class Tuple, std::size_t I, class = void>
-struct PlusIs {
-    template<class DifferenceType>
-    LZ_CONSTEXPR_CXX_20 void operator()(Tuple& iterators, const Tuple& end, const DifferenceType offset) const {
-        using TupElem = TupleElement<I, Tuple>;
-        TupElem& currentIterator = std::get<I>(iterators);
-        const TupElem currentEnd = std::get<I>(end);
-        const auto dist = currentEnd - currentIterator;
-        if (dist > offset) {
-            currentIterator += offset;
-        }
-        else {
-            // Moves to end
-            currentIterator += dist;
-            PlusIs<Tuple, I + 1>()(iterators, end, offset - dist);
+// Moves the iterator of range I forward by `offset`, or to its end, in which case `offset` is decreased by the amount of
+// elements that were skipped and false is returned. The last range is always moved by `offset`
+template<class Tuple, class DifferenceType>
+struct ConcatAdvance {
+    Tuple& iterators;
+    const Tuple& end;
+    DifferenceType& offset;
+
+    template<class Iterator>
+    LZ_CONSTEXPR_CXX_20 bool advance(Iterator& iterator, const Iterator& last, const bool isLastRange) const {
+        const auto distance = static_cast<DifferenceType>(last - iterator);
+        if (isLastRange || offset < distance) {
+            iterator += static_cast<DiffType<Iterator>>(offset);
+            return true;
         }
+        iterator = last;
+        offset -= distance;
+        return false;
     }
-};
 
-template<class Tuple, std::size_t I>
-struct PlusIs<Tuple, I, EnableIf<I == std::tuple_size<Decay<Tuple>>::value - 1>> {
-    template<class DifferenceType>
-    constexpr void operator()(Tuple& /*iterators*/, const Tuple& /*end*/, const DifferenceType /*offset*/) const {
+    template<std::size_t I>
+    LZ_CONSTEXPR_CXX_20 bool operator()(std::integral_constant<std::size_t, I>) const {
+        return advance(std::get<I>(iterators), std::get<I>(end), I == std::tuple_size<Tuple>::value - 1);
     }
 };
-#else
-template<class Tuple, std::size_t I>
-struct PlusPlus {
-    LZ_CONSTEXPR_CXX_20 void operator()(Tuple& iterators, const Tuple& end) const {
-        if constexpr (I == std::tuple_size_v<Decay<Tuple>>) {
-            static_cast<void>(iterators);
-            static_cast<void>(end);
-            return;
-        }
-        else {
-            if (std::get<I>(iterators) != std::get<I>(end)) {
-                ++std::get<I>(iterators);
-            }
-            else {
-                PlusPlus<Tuple, I + 1>()(iterators, end);
-            }
+
+// Moves the iterator of range I backward by `offset`, or to its beginning, in which case `offset` is decreased by the amount of
+// elements that were skipped and false is returned. The first range is always moved by `offset`
+template<class Tuple, class DifferenceType>
+struct ConcatRetreat {
+    Tuple& iterators;
+    const Tuple& begin;
+    DifferenceType& offset;
+
+    template<class Iterator>
+    LZ_CONSTEXPR_CXX_20 bool retreat(Iterator& iterator, const Iterator& first, const bool isFirstRange) const {
+        const auto distance = static_cast<DifferenceType>(iterator - first);
+        if (isFirstRange || offset <= distance) {
+            iterator -= static_cast<DiffType<Iterator>>(offset);
+            return true;
         }
+        iterator = first;
+        offset -= distance;
+        return false;
     }
-};
 
-template<class Tuple, std::size_t I>
-struct NotEqual {
-    LZ_CONSTEXPR_CXX_20 bool operator()(const Tuple& iterators, const Tuple& end) const {
-        if constexpr (I == std::tuple_size_v<Decay<Tuple>> - 1) {
-            return std::get<I>(iterators) != std::get<I>(end);
-        }
-        else {
-            const bool iterHasValue = std::get<I>(iterators) != std::get<I>(end);
-            return iterHasValue ? iterHasValue : NotEqual<Tuple, I + 1>()(iterators, end);
-        }
+    template<std::size_t I>
+    LZ_CONSTEXPR_CXX_20 bool operator()(std::integral_constant<std::size_t, I>) const {
+        return retreat(std::get<I>(iterators), std::get<I>(begin), I == 0);
     }
 };
 
-template<class Tuple, std::size_t I>
-struct Deref {
-    LZ_CONSTEXPR_CXX_20 auto operator()(const Tuple& iterators, const Tuple& end) const -> decltype(*std::get<I>(iterators)) {
-        if constexpr (I == std::tuple_size_v<Decay<Tuple>> - 1) {
-            static_cast<void>(end);
-            return *std::get<I>(iterators);
-        }
-        else {
-            return std::get<I>(iterators) != std::get<I>(end) ? *std::get<I>(iterators) : Deref<Tuple, I + 1>()(iterators, end);
-        }
+template<class Tuple, std::size_t I, class = void>
+struct ForEachWhileConcat {
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool operator()(const Tuple& iterators, const Tuple& end, Sink& sink) const {
+        return internal::forEachWhile(std::get<I>(iterators), std::get<I>(end), sink) &&
+               ForEachWhileConcat<Tuple, I + 1>()(iterators, end, sink);
     }
 };
 
 template<class Tuple, std::size_t I>
-struct MinusMinus {
-    LZ_CONSTEXPR_CXX_20 void operator()(Tuple& iterators, const Tuple& begin, const Tuple& end) const {
-        if constexpr (I == 0) {
-            static_cast<void>(begin);
-            static_cast<void>(end);
-            --std::get<0>(iterators);
-        }
-        else {
-            auto& current = std::get<I>(iterators);
-            if (current != std::get<I>(begin)) {
-                --current;
-            }
-            else {
-                MinusMinus<Tuple, I - 1>()(iterators, begin, end);
-            }
-        }
+struct ForEachWhileConcat<Tuple, I, EnableIf<I == std::tuple_size<Decay<Tuple>>::value>> {
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool operator()(const Tuple& /*iterators*/, const Tuple& /*end*/, Sink& /*sink*/) const {
+        return true;
     }
 };
 
-template<class Tuple, std::size_t I>
-struct MinIs {
-    template<class DifferenceType>
-    LZ_CONSTEXPR_CXX_20 void
-    operator()(Tuple& iterators, const Tuple& begin, const Tuple& end, const DifferenceType offset) const {
-        using TupElem = TupleElement<I, Tuple>;
-
-        if constexpr (I == 0) {
-            static_cast<void>(begin);
-            static_cast<void>(end);
-            TupElem& current = std::get<0>(iterators);
-            current -= offset;
-        }
-        else {
-            const TupElem currentBegin = std::get<I>(begin);
-            const TupElem current = std::get<I>(iterators);
-            // Current is begin, move on to next iterator
-            if (current == currentBegin) {
-                MinIs<Tuple, I - 1>()(iterators, begin, end, offset);
-            }
-            else {
-                const auto dist = std::get<I>(end) - current;
-                if (dist <= offset) {
-                    std::get<I>(iterators) = std::get<I>(begin);
-                    MinIs<Tuple, I - 1>()(iterators, begin, end, dist == 0 ? DifferenceType{ 1 } : offset - dist);
-                }
-                else {
-                    std::get<I>(iterators) -= offset;
-                }
-            }
+template<class Tuple, std::size_t I, class = void>
+struct ForEachSegmentConcat {
+    template<class SegmentSink>
+    LZ_CONSTEXPR_CXX_20 void operator()(const Tuple& iterators, const Tuple& end, SegmentSink& sink) const {
+        if (std::get<I>(iterators) != std::get<I>(end)) {
+            internal::forEachSegment(std::get<I>(iterators), std::get<I>(end), sink);
         }
+        ForEachSegmentConcat<Tuple, I + 1>()(iterators, end, sink);
     }
 };
 
 template<class Tuple, std::size_t I>
-struct PlusIs {
-    template<class DifferenceType>
-    LZ_CONSTEXPR_CXX_20 void operator()(Tuple& iterators, const Tuple& end, const DifferenceType offset) const {
-        using lz::distance;
-        using std::distance;
-        if constexpr (I == std::tuple_size_v<Decay<Tuple>> - 1) {
-            static_cast<void>(iterators);
-            static_cast<void>(end);
-            static_cast<void>(offset);
-            return;
-        }
-        else {
-            using TupElem = TupleElement<I, Tuple>;
-            TupElem& currentIterator = std::get<I>(iterators);
-            const TupElem currentEnd = std::get<I>(end);
-            const auto dist = currentEnd - currentIterator;
-            if (dist > offset) {
-                currentIterator += offset;
-            }
-            else {
-                // Moves to end
-                currentIterator += dist;
-                PlusIs<Tuple, I + 1>()(iterators, end, offset - dist);
-            }
-        }
+struct ForEachSegmentConcat<Tuple, I, EnableIf<I == std::tuple_size<Decay<Tuple>>::value>> {
+    template<class SegmentSink>
+    LZ_CONSTEXPR_CXX_20 void operator()(const Tuple& /*iterators*/, const Tuple& /*end*/, SegmentSink& /*sink*/) const {
     }
 };
-#endif // __cpp_if_constexpr
 
 template<LZ_CONCEPT_ITERATOR... Iterators>
 class ConcatenateIterator {
@@ -274,6 +169,8 @@ class ConcatenateIterator {
     IterTuple _iterators{};
     IterTuple _begin{};
     IterTuple _end{};
+    // The range that the iterator points into. The ranges before it are at their end, the ones after it at their beginning
+    std::size_t _index{};
 
     using FirstTupleIterator = std::iterator_traits<TupleElement<0, IterTuple>>;
 
@@ -285,6 +182,19 @@ public:
     using iterator_category = typename std::common_type<IterCat<Iterators>...>::type;
 
 private:
+    // Calls `f` with the index of the current range
+    template<class F>
+    LZ_CONSTEXPR_CXX_20 auto visit(F& f) const -> decltype(f(std::integral_constant<std::size_t, 0>())) {
+        return VisitConcat<0, sizeof...(Iterators)>()(_index, f);
+    }
+
+    LZ_CONSTEXPR_CXX_20 void skipExhausted() {
+        ConcatIsEqual<IterTuple> isAtEnd{ _iterators, _end };
+        while (_index != sizeof...(Iterators) - 1 && visit(isAtEnd)) {
+            ++_index;
+        }
+    }
+
     template<std::size_t... I>
     LZ_CONSTEXPR_CXX_20 difference_type minus(IndexSequence<I...>, const ConcatenateIterator& other) const {
         const difference_type totals[] = { static_cast<difference_type>(std::get<I>(_iterators) -
@@ -292,25 +202,67 @@ private:
         return std::accumulate(std::begin(totals), std::end(totals), difference_type{ 0 });
     }
 
+    template<std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 difference_type sizeToImpl(IndexSequence<I...>, const ConcatenateIterator& end) const {
+        const difference_type totals[] = { static_cast<difference_type>(
+            getIterLength(std::get<I>(_iterators), std::get<I>(end._iterators)))... };
+        return std::accumulate(std::begin(totals), std::end(totals), difference_type{ 0 });
+    }
+
+    template<std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 SizeHint sizeHintToImpl(IndexSequence<I...>, const ConcatenateIterator& end) const {
+        const SizeHint hints[] = { sizeHint(std::get<I>(_iterators), std::get<I>(end._iterators))... };
+        SizeHint total = { 0, 0 };
+        for (const SizeHint& hint : hints) {
+            total.lower += hint.lower;
+            total.upper = (total.upper == unknownSize || hint.upper == unknownSize) ? unknownSize : total.upper + hint.upper;
+        }
+        return total;
+    }
+
 public:
     LZ_CONSTEXPR_CXX_20 ConcatenateIterator(IterTuple iterators, IterTuple begin, IterTuple end) :
         _iterators(std::move(iterators)),
         _begin(std::move(begin)),
         _end(std::move(end)) {
+        skipExhausted();
     }
 
     constexpr ConcatenateIterator() = default;
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
-        return Deref<IterTuple, 0>()(_iterators, _end);
+        ConcatDeref<IterTuple, reference> deref{ _iterators };
+        return visit(deref);
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
         return FakePointerProxy<decltype(**this)>(**this);
     }
 
+    template<class I = IsAllSized<Iterators...>>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<I::value, difference_type> sizeTo(const ConcatenateIterator& end) const {
+        return sizeToImpl(MakeIndexSequence<sizeof...(Iterators)>(), end);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHintTo(const ConcatenateIterator& end) const {
+        return sizeHintToImpl(MakeIndexSequence<sizeof...(Iterators)>(), end);
+    }
+
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool forEachWhile(const ConcatenateIterator& end, Sink& sink) const {
+        return ForEachWhileConcat<IterTuple, 0>()(_iterators, end._iterators, sink);
+    }
+
+    template<class SegmentSink>
+    LZ_CONSTEXPR_CXX_20 void forEachSegment(const ConcatenateIterator& end, SegmentSink& sink) const {
+        ForEachSegmentConcat<IterTuple, 0>()(_iterators, end._iterators, sink);
+    }
+
     LZ_CONSTEXPR_CXX_20 ConcatenateIterator& operator++() {
-        PlusPlus<IterTuple, 0>()(_iterators, _end);
+        ConcatIncrement<IterTuple> increment{ _iterators, _end };
+        if (visit(increment)) {
+            skipExhausted();
+        }
         return *this;
     }
 
@@ -321,23 +273,43 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_20 ConcatenateIterator& operator--() {
-        MinusMinus<IterTuple, sizeof...(Iterators) - 1>()(_iterators, _begin, _end);
+        ConcatIsEqual<IterTuple> isAtBegin{ _iterators, _begin };
+        while (visit(isAtBegin)) {
+            --_index;
+        }
+        ConcatDecrement<IterTuple> decrement{ _iterators };
+        visit(decrement);
         return *this;
     }
 
     LZ_CONSTEXPR_CXX_20 ConcatenateIterator operator--(int) {
         ConcatenateIterator tmp(*this);
-        ++*this;
+        --*this;
         return tmp;
     }
 
     LZ_CONSTEXPR_CXX_20 ConcatenateIterator& operator+=(const difference_type offset) {
-        PlusIs<IterTuple, 0>()(_iterators, _end, offset);
+        if (offset < 0) {
+            return *this -= -offset;
+        }
+        difference_type remaining = offset;
+        ConcatAdvance<IterTuple, difference_type> advance{ _iterators, _end, remaining };
+        while (!visit(advance)) {
+            ++_index;
+        }
+        skipExhausted();
         return *this;
     }
 
     LZ_CONSTEXPR_CXX_20 ConcatenateIterator& operator-=(const difference_type offset) {
-        MinIs<IterTuple, sizeof...(Iterators) - 1>()(_iterators, _begin, _end, offset);
+        if (offset < 0) {
+            return *this += -offset;
+        }
+        difference_type remaining = offset;
+        ConcatRetreat<IterTuple, difference_type> retreat{ _iterators, _begin, remaining };
+        while (!visit(retreat)) {
+            --_index;
+        }
         return *this;
     }
 
@@ -347,18 +319,29 @@ public:
         return tmp;
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend ConcatenateIterator operator+(const difference_type offset,
+                                                                          const ConcatenateIterator& iterator) {
+        return iterator + offset;
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 ConcatenateIterator operator-(const difference_type offset) const {
         ConcatenateIterator tmp(*this);
         tmp -= offset;
         return tmp;
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type operator-(const ConcatenateIterator& other) const {
+    template<class Self = ConcatenateIterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsRandomAccess<Self>::value, difference_type>
+    operator-(const ConcatenateIterator& other) const {
         return minus(MakeIndexSequence<sizeof...(Iterators)>(), other);
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const ConcatenateIterator& a, const ConcatenateIterator& b) noexcept {
-        return NotEqual<IterTuple, 0>()(a._iterators, b._iterators);
+        if (a._index != b._index) {
+            return true;
+        }
+        ConcatIsEqual<IterTuple> isEqual{ a._iterators, b._iterators };
+        return !a.visit(isEqual);
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const ConcatenateIterator& a, const ConcatenateIterator& b) noexcept {
@@ -386,6 +369,237 @@ public:
     }
 };
 
+// The iterator of a concatenation of ranges that have the same iterator type. As the ranges can then be looked up by index, the
+// iterator keeps its position and the end of its range apart, so that incrementing costs a single comparison
+template<LZ_CONCEPT_ITERATOR Iterator, std::size_t N>
+class ConcatenateSameIterator {
+    using Ranges = std::array<Iterator, N>;
+    using IterTraits = std::iterator_traits<Iterator>;
+
+    Ranges _begin{};
+    Ranges _end{};
+    Iterator _iterator{};
+    Iterator _rangeEnd{};
+    std::size_t _index{};
+
+public:
+    using value_type = typename IterTraits::value_type;
+    using difference_type = typename IterTraits::difference_type;
+    using reference = typename IterTraits::reference;
+    using pointer = FakePointerProxy<reference>;
+    using iterator_category = typename IterTraits::iterator_category;
+
+private:
+    template<class Tuple, std::size_t... I>
+    static LZ_CONSTEXPR_CXX_20 Ranges toArray(IndexSequence<I...>, const Tuple& iterators) {
+        return { { std::get<I>(iterators)... } };
+    }
+
+    LZ_CONSTEXPR_CXX_20 void enterRange(const std::size_t index, Iterator iterator) {
+        _index = index;
+        _iterator = std::move(iterator);
+        _rangeEnd = _end[index];
+    }
+
+    LZ_CONSTEXPR_CXX_20 void skipExhausted() {
+        while (_iterator == _rangeEnd && _index != N - 1) {
+            enterRange(_index + 1, _begin[_index + 1]);
+        }
+    }
+
+    // The amount of elements before this iterator
+    LZ_CONSTEXPR_CXX_20 difference_type position() const {
+        difference_type position = getIterLength(_begin[_index], _iterator);
+        for (std::size_t i = 0; i != _index; ++i) {
+            position += getIterLength(_begin[i], _end[i]);
+        }
+        return position;
+    }
+
+public:
+    template<class Tuple>
+    LZ_CONSTEXPR_CXX_20 ConcatenateSameIterator(const Tuple& iterators, const Tuple& begin, const Tuple& end) :
+        _begin(toArray(MakeIndexSequence<N>(), begin)),
+        _end(toArray(MakeIndexSequence<N>(), end)) {
+        const Ranges positions = toArray(MakeIndexSequence<N>(), iterators);
+        std::size_t index = 0;
+        while (index != N - 1 && positions[index] == _end[index]) {
+            ++index;
+        }
+        enterRange(index, positions[index]);
+    }
+
+    constexpr ConcatenateSameIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return *_iterator;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsSized<I>::value, difference_type>
+    sizeTo(const ConcatenateSameIterator& end) const {
+        return end.position() - position();
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHintTo(const ConcatenateSameIterator& end) const {
+        if (_index == end._index) {
+            return sizeHint(_iterator, end._iterator);
+        }
+        SizeHint total = sizeHint(_iterator, _rangeEnd);
+        for (std::size_t index = _index + 1; index <= end._index; ++index) {
+            const SizeHint hint = sizeHint(_begin[index], index == end._index ? end._iterator : _end[index]);
+            total.lower += hint.lower;
+            total.upper = (total.upper == unknownSize || hint.upper == unknownSize) ? unknownSize : total.upper + hint.upper;
+        }
+        return total;
+    }
+
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool forEachWhile(const ConcatenateSameIterator& end, Sink& sink) const {
+        if (_index == end._index) {
+            return internal::forEachWhile(_iterator, end._iterator, sink);
+        }
+        if (!internal::forEachWhile(_iterator, _rangeEnd, sink)) {
+            return false;
+        }
+        for (std::size_t index = _index + 1; index != end._index; ++index) {
+            if (!internal::forEachWhile(_begin[index], _end[index], sink)) {
+                return false;
+            }
+        }
+        return internal::forEachWhile(_begin[end._index], end._iterator, sink);
+    }
+
+    template<class SegmentSink>
+    LZ_CONSTEXPR_CXX_20 void forEachSegment(const ConcatenateSameIterator& end, SegmentSink& sink) const {
+        for (std::size_t index = _index; index <= end._index; ++index) {
+            const Iterator& first = index == _index ? _iterator : _begin[index];
+            const Iterator& last = index == end._index ? end._iterator : _end[index];
+            if (first != last) {
+                internal::forEachSegment(first, last, sink);
+            }
+        }
+    }
+
+    LZ_CONSTEXPR_CXX_20 ConcatenateSameIterator& operator++() {
+        ++_iterator;
+        if (_iterator == _rangeEnd) {
+            skipExhausted();
+        }
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 ConcatenateSameIterator operator++(int) {
+        ConcatenateSameIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_20 ConcatenateSameIterator& operator--() {
+        while (_iterator == _begin[_index]) {
+            enterRange(_index - 1, _end[_index - 1]);
+        }
+        --_iterator;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 ConcatenateSameIterator operator--(int) {
+        ConcatenateSameIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_20 ConcatenateSameIterator& operator+=(const difference_type offset) {
+        if (offset < 0) {
+            return *this -= -offset;
+        }
+        difference_type remaining = offset;
+        while (_index != N - 1 && remaining >= _rangeEnd - _iterator) {
+            remaining -= _rangeEnd - _iterator;
+            enterRange(_index + 1, _begin[_index + 1]);
+        }
+        _iterator += remaining;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 ConcatenateSameIterator& operator-=(const difference_type offset) {
+        if (offset < 0) {
+            return *this += -offset;
+        }
+        difference_type remaining = offset;
+        while (_index != 0 && remaining > _iterator - _begin[_index]) {
+            remaining -= _iterator - _begin[_index];
+            enterRange(_index - 1, _end[_index - 1]);
+        }
+        _iterator -= remaining;
+        return *this;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 ConcatenateSameIterator operator+(const difference_type offset) const {
+        ConcatenateSameIterator tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend ConcatenateSameIterator operator+(const difference_type offset,
+                                                                              const ConcatenateSameIterator& iterator) {
+        return iterator + offset;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 ConcatenateSameIterator operator-(const difference_type offset) const {
+        ConcatenateSameIterator tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend EnableIf<IsRandomAccess<I>::value, difference_type>
+    operator-(const ConcatenateSameIterator& a, const ConcatenateSameIterator& b) {
+        if (a._index == b._index) {
+            return a._iterator - b._iterator;
+        }
+        return a.position() - b.position();
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator[](const difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
+    operator==(const ConcatenateSameIterator& a, const ConcatenateSameIterator& b) noexcept {
+        return a._index == b._index && a._iterator == b._iterator;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
+    operator!=(const ConcatenateSameIterator& a, const ConcatenateSameIterator& b) noexcept {
+        return !(a == b); // NOLINT
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator<(const ConcatenateSameIterator& a, const ConcatenateSameIterator& b) {
+        return a._index < b._index || (a._index == b._index && a._iterator < b._iterator);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>(const ConcatenateSameIterator& a, const ConcatenateSameIterator& b) {
+        return b < a; // NOLINT
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator<=(const ConcatenateSameIterator& a, const ConcatenateSameIterator& b) {
+        return !(b < a); // NOLINT
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>=(const ConcatenateSameIterator& a, const ConcatenateSameIterator& b) {
+        return !(a < b); // NOLINT
+    }
+};
+
+template<class... Iterators>
+using ConcatenateIteratorFor = Conditional<IsAllSame<Iterators...>::value,
+                                           ConcatenateSameIterator<TupleElement<0, std::tuple<Iterators...>>, sizeof...(Iterators)>,
+                                           ConcatenateIterator<Iterators...>>;
 } // namespace internal
 } // namespace lz
 
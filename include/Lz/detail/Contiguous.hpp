@@ -0,0 +1,348 @@
+#pragma once
+
+#ifndef LZ_CONTIGUOUS_HPP
+#    define LZ_CONTIGUOUS_HPP
+
+#    include "ByteMask.hpp"
+#    include "LzTools.hpp"
+
+#    include <algorithm>
+#    include <cstring>
+#    include <functional>
+#    include <memory>
+#    include <string>
+#    include <vector>
+
+namespace lz {
+/**
+ * Compares two characters for equality while ignoring the case of the ASCII letters 'A' to 'Z'. Other characters, including
+ * non ASCII ones, are compared as is. `lz::equal`, `lz::startsWith` and `lz::endsWith` recognize this comparer and compare
+ * contiguous sequences of single byte characters 8 at a time with it. Example:
+ * ```cpp
+ * std::string header = "Content-Length: 42";
+ * bool isLength = lz::startsWith(header, std::string("content-length:"), lz::CaseInsensitiveEqual()); // true
+ * ```
+ */
+struct CaseInsensitiveEqual {
+    template<class CharA, class CharB>
+    LZ_NODISCARD constexpr bool operator()(const CharA a, const CharB b) const noexcept {
+        return internal::toLowerAscii(a) == internal::toLowerAscii(b);
+    }
+};
+
+namespace internal {
+template<class V>
+struct IsVectorElement : std::integral_constant<bool, std::is_object<V>::value && !std::is_array<V>::value &&
+                                                          !std::is_abstract<V>::value && !std::is_const<V>::value &&
+                                                          !std::is_same<V, bool>::value> {};
+
+template<class V>
+struct IsCharacter : std::integral_constant<bool, std::is_same<V, char>::value || std::is_same<V, wchar_t>::value ||
+                                                      std::is_same<V, char16_t>::value || std::is_same<V, char32_t>::value> {};
+
+template<class Iterator, class V, bool = IsVectorElement<V>::value>
+struct IsVectorIterator : std::false_type {};
+
+template<class Iterator, class V>
+struct IsVectorIterator<Iterator, V, true>
+    : std::integral_constant<bool, std::is_same<Iterator, typename std::vector<V>::iterator>::value ||
+                                       std::is_same<Iterator, typename std::vector<V>::const_iterator>::value> {};
+
+template<class Iterator, class V, bool = IsCharacter<V>::value>
+struct IsStringIterator : std::false_type {};
+
+template<class Iterator, class V>
+struct IsStringIterator<Iterator, V, true>
+    : std::integral_constant<bool, std::is_same<Iterator, typename std::basic_string<V>::iterator>::value ||
+                                       std::is_same<Iterator, typename std::basic_string<V>::const_iterator>::value> {};
+
+template<class Iterator, class = int>
+struct IsLibraryContiguousIterator : std::false_type {};
+
+template<class Iterator>
+using TraitsValueType = typename std::iterator_traits<Iterator>::value_type;
+
+template<class Iterator>
+struct IsLibraryContiguousIterator<Iterator, decltype((void)std::declval<TraitsValueType<Iterator>*>(), 0)>
+    : std::integral_constant<bool, IsVectorIterator<Iterator, TraitsValueType<Iterator>>::value ||
+                                       IsStringIterator<Iterator, TraitsValueType<Iterator>>::value> {};
+
+#    ifdef LZ_HAS_CONCEPTS
+template<class Iterator, class = int>
+struct HasIteratorConcept : std::false_type {};
+
+template<class Iterator>
+struct HasIteratorConcept<Iterator, decltype((void)std::declval<typename Iterator::iterator_concept*>(), 0)> : std::true_type {};
+
+// Whether the elements of [begin, end) are adjacent in memory. Only pointers and iterators that declare an `iterator_concept`
+// can satisfy std::contiguous_iterator, so it isn't checked for others, e.g. the iterators of this library. Checking it
+// requires the iterator to be default constructible, which fails to compile for iterators that hold a lambda
+template<class Iterator, bool = std::is_pointer<Iterator>::value || HasIteratorConcept<Iterator>::value>
+struct IsContiguousIterator : std::false_type {};
+
+template<class Iterator>
+struct IsContiguousIterator<Iterator, true> : std::integral_constant<bool, std::contiguous_iterator<Iterator>> {};
+#    else  // ^^^ lz has concepts vvv ! lz has concepts
+// Whether the elements of [begin, end) are adjacent in memory. Before C++20 there is no way to ask an iterator this, so besides
+// pointers only the iterators of std::vector and std::basic_string are recognized
+template<class Iterator>
+struct IsContiguousIterator
+    : std::integral_constant<bool, std::is_pointer<Iterator>::value || IsLibraryContiguousIterator<Iterator>::value> {};
+#    endif // LZ_HAS_CONCEPTS
+
+template<class Iterator>
+using ContiguousPointer = decltype(std::addressof(*std::declval<const Iterator&>()));
+
+// The address of the first element of [begin, end), or nullptr if it's empty, as an end iterator cannot always be dereferenced
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 ContiguousPointer<Iterator> contiguousData(const Iterator& begin, const Iterator& end) {
+    return begin == end ? nullptr : std::addressof(*begin);
+}
+
+// Types of which two values are equal if and only if their bytes are, which excludes floating point (-0.0 == 0.0, NaN != NaN)
+// and classes, which can have padding or a custom operator==
+template<class T>
+struct IsBitwiseComparable
+    : std::integral_constant<bool, std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value> {};
+
+template<class Predicate, class T>
+struct IsDefaultEquality : std::integral_constant<bool, std::is_same<Predicate, std::equal_to<T>>::value
+#    ifndef LZ_HAS_CXX_11
+                                                            || std::is_same<Predicate, std::equal_to<>>::value
+#    endif // LZ_HAS_CXX_11
+                                                        > {
+};
+
+template<class Compare, class T>
+struct IsDefaultLess : std::integral_constant<bool, std::is_same<Compare, std::less<T>>::value
+#    ifndef LZ_HAS_CXX_11
+                                                        || std::is_same<Compare, std::less<>>::value
+#    endif // LZ_HAS_CXX_11
+                                                    > {
+};
+
+// Whether [beginA, endA) and [beginB, endB) can be compared with memcmp
+template<class IteratorA, class IteratorB, class Predicate,
+         bool = IsContiguousIterator<IteratorA>::value && IsContiguousIterator<IteratorB>::value>
+struct IsMemcmpComparable : std::false_type {};
+
+template<class IteratorA, class IteratorB, class Predicate>
+struct IsMemcmpComparable<IteratorA, IteratorB, Predicate, true>
+    : std::integral_constant<bool, std::is_same<ValueType<IteratorA>, ValueType<IteratorB>>::value &&
+                                       IsBitwiseComparable<ValueType<IteratorA>>::value &&
+                                       IsDefaultEquality<Predicate, ValueType<IteratorA>>::value> {};
+
+// Whether [beginA, endA) and [beginB, endB) can be compared with `equalIgnoringAsciiCase`
+template<class IteratorA, class IteratorB,
+         bool = IsContiguousIterator<IteratorA>::value && IsContiguousIterator<IteratorB>::value>
+struct IsCaseInsensitiveComparable : std::false_type {};
+
+template<class IteratorA, class IteratorB>
+struct IsCaseInsensitiveComparable<IteratorA, IteratorB, true>
+    : std::integral_constant<bool, std::is_integral<ValueType<IteratorA>>::value && sizeof(ValueType<IteratorA>) == 1 &&
+                                       std::is_integral<ValueType<IteratorB>>::value && sizeof(ValueType<IteratorB>) == 1> {};
+
+// Whether [begin, end) can be copied to `OutputIterator` with memmove
+template<class Iterator, class OutputIterator,
+         bool = IsContiguousIterator<Iterator>::value && IsContiguousIterator<OutputIterator>::value>
+struct IsMemcpyable : std::false_type {};
+
+template<class Iterator, class OutputIterator>
+struct IsMemcpyable<Iterator, OutputIterator, true>
+    : std::integral_constant<bool, std::is_same<ValueType<Iterator>, ValueType<OutputIterator>>::value &&
+                                       std::is_trivially_copyable<ValueType<Iterator>>::value &&
+                                       std::is_assignable<RefType<OutputIterator>, RefType<Iterator>>::value> {};
+
+// Whether `T` can be searched for in [begin, end) with memchr. The value must have the element type itself, as memchr converts
+// it to unsigned char, which would find e.g. 300 in a sequence of char
+template<class Iterator, class T, bool = IsContiguousIterator<Iterator>::value>
+struct IsMemchrSearchable : std::false_type {};
+
+template<class Iterator, class T>
+struct IsMemchrSearchable<Iterator, T, true>
+    : std::integral_constant<bool, sizeof(ValueType<Iterator>) == 1 &&
+                                       IsBitwiseComparable<ValueType<Iterator>>::value &&
+                                       std::is_same<ValueType<Iterator>, T>::value> {};
+
+template<class IteratorA, class IteratorB>
+bool memEqual(const IteratorA& beginA, const IteratorA& endA, const IteratorB& beginB, const IteratorB& endB) {
+    const auto length = endA - beginA;
+    if (length != endB - beginB) {
+        return false;
+    }
+    return length == 0 || std::memcmp(std::addressof(*beginA), std::addressof(*beginB),
+                                       static_cast<std::size_t>(length) * sizeof(ValueType<IteratorA>)) == 0;
+}
+
+template<class IteratorA, class IteratorB>
+bool memStartsWith(const IteratorA& beginA, const IteratorA& endA, const IteratorB& beginB, const IteratorB& endB) {
+    const auto length = endB - beginB;
+    if (length > endA - beginA) {
+        return false;
+    }
+    return memEqual(beginA, beginA + length, beginB, endB);
+}
+
+template<class IteratorA, class IteratorB>
+bool caseInsensitiveStartsWith(const IteratorA& beginA, const IteratorA& endA, const IteratorB& beginB, const IteratorB& endB) {
+    const auto length = endB - beginB;
+    if (length > endA - beginA) {
+        return false;
+    }
+    return length == 0 || equalIgnoringAsciiCase(reinterpret_cast<const char*>(std::addressof(*beginA)),
+                                                  reinterpret_cast<const char*>(std::addressof(*beginB)),
+                                                  static_cast<std::size_t>(length));
+}
+
+template<class Iterator, class T>
+Iterator memFind(const Iterator& begin, const Iterator& end, const T& value) {
+    const auto length = static_cast<std::size_t>(end - begin);
+    if (length == 0) {
+        return end;
+    }
+    const void* first = std::addressof(*begin);
+    const void* found = std::memchr(first, static_cast<unsigned char>(value), length);
+    return found == nullptr ? end : begin + (static_cast<const unsigned char*>(found) - static_cast<const unsigned char*>(first));
+}
+
+template<class Iterator, class OutputIterator>
+OutputIterator memCopy(const Iterator& begin, const Iterator& end, OutputIterator outputIterator) {
+    const auto length = end - begin;
+    if (length != 0) {
+        std::memmove(std::addressof(*outputIterator), std::addressof(*begin),
+                     static_cast<std::size_t>(length) * sizeof(ValueType<Iterator>));
+    }
+    return outputIterator + length;
+}
+
+// std::equal with two ranges, which is not available in C++11
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+LZ_CONSTEXPR_CXX_20 bool
+equalElements(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, BinaryPredicate predicate) {
+#    ifdef LZ_HAS_CXX_11
+    for (; beginA != endA && beginB != endB; ++beginA, ++beginB) {
+        if (!predicate(*beginA, *beginB)) {
+            return false;
+        }
+    }
+    return beginA == endA && beginB == endB;
+#    else
+    return std::equal(std::move(beginA), std::move(endA), std::move(beginB), std::move(endB), std::move(predicate));
+#    endif // LZ_HAS_CXX_11
+}
+
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+LZ_CONSTEXPR_CXX_20 bool equalRange(std::true_type /* isMemcmpComparable */, IteratorA beginA, IteratorA endA, IteratorB beginB,
+                                    IteratorB endB, BinaryPredicate predicate) {
+    if (isConstantEvaluated()) {
+        return equalElements(std::move(beginA), std::move(endA), std::move(beginB), std::move(endB), std::move(predicate));
+    }
+    return memEqual(beginA, endA, beginB, endB);
+}
+
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+LZ_CONSTEXPR_CXX_20 bool equalRange(std::false_type /* isMemcmpComparable */, IteratorA beginA, IteratorA endA, IteratorB beginB,
+                                    IteratorB endB, BinaryPredicate predicate) {
+    return equalElements(std::move(beginA), std::move(endA), std::move(beginB), std::move(endB), std::move(predicate));
+}
+
+// Same as std::equal, but compares contiguous ranges of integers with memcmp
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+LZ_CONSTEXPR_CXX_20 bool
+equalRange(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, BinaryPredicate predicate) {
+    return equalRange(IsMemcmpComparable<IteratorA, IteratorB, BinaryPredicate>(), std::move(beginA), std::move(endA),
+                      std::move(beginB), std::move(endB), std::move(predicate));
+}
+
+template<class IteratorA, class IteratorB>
+LZ_CONSTEXPR_CXX_20 bool equalRange(std::true_type /* isCaseInsensitiveComparable */, IteratorA beginA, IteratorA endA,
+                                    IteratorB beginB, IteratorB endB, CaseInsensitiveEqual predicate) {
+    if (isConstantEvaluated()) {
+        return equalElements(std::move(beginA), std::move(endA), std::move(beginB), std::move(endB), predicate);
+    }
+    return endA - beginA == endB - beginB && caseInsensitiveStartsWith(beginA, endA, beginB, endB);
+}
+
+// Compares contiguous single byte characters 8 at a time, ignoring the case of ASCII letters
+template<class IteratorA, class IteratorB>
+LZ_CONSTEXPR_CXX_20 bool
+equalRange(IteratorA beginA, IteratorA endA, IteratorB beginB, IteratorB endB, CaseInsensitiveEqual predicate) {
+    return equalRange(IsCaseInsensitiveComparable<IteratorA, IteratorB>(), std::move(beginA), std::move(endA),
+                      std::move(beginB), std::move(endB), predicate);
+}
+
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+LZ_CONSTEXPR_CXX_20 bool startsWithRange(std::false_type /* isMemcmpComparable */, IteratorA beginA, const IteratorA& endA,
+                                         IteratorB beginB, const IteratorB& endB, BinaryPredicate compare) {
+    for (; beginB != endB; ++beginA, ++beginB) {
+        if (beginA == endA || !compare(*beginA, *beginB)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+LZ_CONSTEXPR_CXX_20 bool startsWithRange(std::true_type /* isMemcmpComparable */, IteratorA beginA, const IteratorA& endA,
+                                         IteratorB beginB, const IteratorB& endB, BinaryPredicate compare) {
+    if (isConstantEvaluated()) {
+        return startsWithRange(std::false_type(), std::move(beginA), endA, std::move(beginB), endB, std::move(compare));
+    }
+    return memStartsWith(beginA, endA, beginB, endB);
+}
+
+// Whether [beginB, endB) is a prefix of [beginA, endA), which is compared with memcmp for contiguous ranges of integers
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+LZ_CONSTEXPR_CXX_20 bool
+startsWithRange(IteratorA beginA, const IteratorA& endA, IteratorB beginB, const IteratorB& endB, BinaryPredicate compare) {
+    return startsWithRange(IsMemcmpComparable<IteratorA, IteratorB, BinaryPredicate>(), std::move(beginA), endA,
+                           std::move(beginB), endB, std::move(compare));
+}
+
+template<class IteratorA, class IteratorB>
+LZ_CONSTEXPR_CXX_20 bool startsWithRange(std::true_type /* isCaseInsensitiveComparable */, IteratorA beginA,
+                                         const IteratorA& endA, IteratorB beginB, const IteratorB& endB,
+                                         CaseInsensitiveEqual compare) {
+    if (isConstantEvaluated()) {
+        return startsWithRange(std::false_type(), std::move(beginA), endA, std::move(beginB), endB, compare);
+    }
+    return caseInsensitiveStartsWith(beginA, endA, beginB, endB);
+}
+
+// Compares contiguous single byte characters 8 at a time, ignoring the case of ASCII letters
+template<class IteratorA, class IteratorB>
+LZ_CONSTEXPR_CXX_20 bool
+startsWithRange(IteratorA beginA, const IteratorA& endA, IteratorB beginB, const IteratorB& endB, CaseInsensitiveEqual compare) {
+    return startsWithRange(IsCaseInsensitiveComparable<IteratorA, IteratorB>(), std::move(beginA), endA, std::move(beginB), endB,
+                           compare);
+}
+
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+LZ_CONSTEXPR_CXX_20 bool endsWithRange(std::true_type /* isRandomAccess */, const IteratorA& beginA, const IteratorA& endA,
+                                       const IteratorB& beginB, const IteratorB& endB, BinaryPredicate compare) {
+    const auto length = endB - beginB;
+    if (length > endA - beginA) {
+        return false;
+    }
+    return startsWithRange(endA - length, endA, beginB, endB, std::move(compare));
+}
+
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+LZ_CONSTEXPR_CXX_20 bool endsWithRange(std::false_type /* isRandomAccess */, const IteratorA& beginA, const IteratorA& endA,
+                                       const IteratorB& beginB, const IteratorB& endB, BinaryPredicate compare) {
+    return startsWithRange(std::reverse_iterator<IteratorA>(endA), std::reverse_iterator<IteratorA>(beginA),
+                           std::reverse_iterator<IteratorB>(endB), std::reverse_iterator<IteratorB>(beginB), std::move(compare));
+}
+
+// Whether [beginB, endB) is a suffix of [beginA, endA). Random access ranges are compared from the start of the suffix rather
+// than through reverse iterators, so that contiguous ranges are compared like `startsWithRange` compares them
+template<class IteratorA, class IteratorB, class BinaryPredicate>
+LZ_CONSTEXPR_CXX_20 bool endsWithRange(const IteratorA& beginA, const IteratorA& endA, const IteratorB& beginB,
+                                       const IteratorB& endB, BinaryPredicate compare) {
+    return endsWithRange(std::integral_constant<bool, IsRandomAccess<IteratorA>::value && IsRandomAccess<IteratorB>::value>(),
+                         beginA, endA, beginB, endB, std::move(compare));
+}
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_CONTIGUOUS_HPP
@@ -0,0 +1,171 @@
+#pragma once
+
+#ifndef LZ_COUNTER_RANDOM_ITERATOR_HPP
+#    define LZ_COUNTER_RANDOM_ITERATOR_HPP
+
+#    include "LzTools.hpp"
+#    include "RandomBits.hpp"
+
+namespace lz {
+namespace internal {
+// Every Philox block holds the 64 random bits of two consecutive elements
+LZ_NODISCARD LZ_CONSTEXPR_CXX_14 PhiloxBlock
+counterRandomBlock(const std::uint64_t key, const std::uint64_t blockIndex) noexcept {
+    const PhiloxBlock counter = { static_cast<std::uint32_t>(blockIndex), static_cast<std::uint32_t>(blockIndex >> 32u), 0, 0 };
+    return philox4x32(counter, key);
+}
+
+LZ_NODISCARD LZ_CONSTEXPR_CXX_14 std::uint64_t blockHalf(const PhiloxBlock& block, const std::size_t half) noexcept {
+    return (static_cast<std::uint64_t>(block[2 * half]) << 32u) | block[2 * half + 1];
+}
+
+// Returns the 64 random bits of element `index` of the sequence identified by `key`
+LZ_NODISCARD LZ_CONSTEXPR_CXX_14 std::uint64_t counterRandomBits(const std::uint64_t key, const std::uint64_t index) noexcept {
+    return blockHalf(counterRandomBlock(key, index / 2), static_cast<std::size_t>(index % 2));
+}
+
+// Writes elements [index, index + (last - first)) to [first, last). Both halves of every block are used, and the blocks don't
+// depend on each other, so that the compiler can compute several blocks at once
+template<class Iterator, class Arithmetic>
+void fillCounterRandom(Iterator first, const Iterator last, const std::uint64_t key, std::uint64_t index, const Arithmetic min,
+                       const Arithmetic max) {
+    if (first != last && index % 2 != 0) {
+        *first = bitsToRange(counterRandomBits(key, index), min, max);
+        ++first;
+        ++index;
+    }
+    for (std::uint64_t block = index / 2; first != last; ++block) {
+        const PhiloxBlock bits = counterRandomBlock(key, block);
+        *first = bitsToRange(blockHalf(bits, 0), min, max);
+        if (++first == last) {
+            return;
+        }
+        *first = bitsToRange(blockHalf(bits, 1), min, max);
+        ++first;
+    }
+}
+
+template<LZ_CONCEPT_ARITHMETIC Arithmetic>
+class CounterRandomIterator {
+    std::uint64_t _key{};
+    std::ptrdiff_t _current{};
+    Arithmetic _min{};
+    Arithmetic _max{};
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = Arithmetic;
+    using difference_type = std::ptrdiff_t;
+    using pointer = FakePointerProxy<Arithmetic>;
+    using reference = value_type;
+
+    constexpr CounterRandomIterator(const std::uint64_t key, const std::ptrdiff_t current, const Arithmetic min,
+                                    const Arithmetic max) noexcept :
+        _key(key),
+        _current(current),
+        _min(min),
+        _max(max) {
+    }
+
+    constexpr CounterRandomIterator() = default;
+
+    //! Writes the elements [*this + offset, *this + offset + (last - first)) to [first, last)
+    template<class Iterator>
+    void fill(Iterator first, Iterator last, const difference_type offset) const {
+        fillCounterRandom(std::move(first), std::move(last), _key, static_cast<std::uint64_t>(_current + offset), _min, _max);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 value_type operator*() const noexcept {
+        return bitsToRange(counterRandomBits(_key, static_cast<std::uint64_t>(_current)), _min, _max);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 pointer operator->() const noexcept {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    LZ_CONSTEXPR_CXX_14 CounterRandomIterator& operator++() noexcept {
+        ++_current;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_14 CounterRandomIterator operator++(int) noexcept {
+        CounterRandomIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_14 CounterRandomIterator& operator--() noexcept {
+        --_current;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_14 CounterRandomIterator operator--(int) noexcept {
+        CounterRandomIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_14 CounterRandomIterator& operator+=(const difference_type offset) noexcept {
+        _current += offset;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_14 CounterRandomIterator& operator-=(const difference_type offset) noexcept {
+        _current -= offset;
+        return *this;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 CounterRandomIterator operator+(const difference_type offset) const noexcept {
+        CounterRandomIterator tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend CounterRandomIterator operator+(const difference_type offset,
+                                                                            const CounterRandomIterator& iterator) noexcept {
+        return iterator + offset;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 CounterRandomIterator operator-(const difference_type offset) const noexcept {
+        CounterRandomIterator tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD constexpr friend difference_type
+    operator-(const CounterRandomIterator& a, const CounterRandomIterator& b) noexcept {
+        return a._current - b._current;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 value_type operator[](const difference_type offset) const noexcept {
+        return *(*this + offset);
+    }
+
+    LZ_NODISCARD constexpr friend bool operator==(const CounterRandomIterator& a, const CounterRandomIterator& b) noexcept {
+        return a._current == b._current;
+    }
+
+    LZ_NODISCARD constexpr friend bool operator!=(const CounterRandomIterator& a, const CounterRandomIterator& b) noexcept {
+        return !(a == b); // NOLINT
+    }
+
+    LZ_NODISCARD constexpr friend bool operator<(const CounterRandomIterator& a, const CounterRandomIterator& b) noexcept {
+        return a._current < b._current;
+    }
+
+    LZ_NODISCARD constexpr friend bool operator>(const CounterRandomIterator& a, const CounterRandomIterator& b) noexcept {
+        return b < a;
+    }
+
+    LZ_NODISCARD constexpr friend bool operator<=(const CounterRandomIterator& a, const CounterRandomIterator& b) noexcept {
+        return !(b < a); // NOLINT
+    }
+
+    LZ_NODISCARD constexpr friend bool operator>=(const CounterRandomIterator& a, const CounterRandomIterator& b) noexcept {
+        return !(a < b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_COUNTER_RANDOM_ITERATOR_HPP
@@ -0,0 +1,148 @@
+#pragma once
+
+#ifndef LZ_CSV_ITERATOR_HPP
+#    define LZ_CSV_ITERATOR_HPP
+
+#    include "LzTools.hpp"
+
+#    include <cstring>
+
+namespace lz {
+namespace internal {
+// Splits the characters [data, data + size) into CSV records or fields (RFC 4180). Separators between quotes are part of the
+// record or field. Records are separated by '\n', lose a trailing '\r', and a trailing '\n' does not start an empty record.
+// Fields are returned without their surrounding quotes, but escaped quotes ("") are left as is.
+template<class SubString>
+class CsvIterator {
+    const char* _data{ nullptr };
+    std::size_t _size{};
+    std::size_t _tokenBegin{};
+    std::size_t _tokenEnd{};
+    // The position of the first quote at or after the last searched position, or size if there is none
+    std::size_t _nextQuote{};
+    char _separator{};
+    char _quote{};
+    bool _isRecords{};
+
+    std::size_t findByte(const std::size_t from, const char byte) const noexcept {
+        if (from >= _size) {
+            return _size;
+        }
+        const void* match = std::memchr(_data + from, byte, _size - from);
+        return match == nullptr ? _size : static_cast<std::size_t>(static_cast<const char*>(match) - _data);
+    }
+
+    std::size_t findSeparator(const std::size_t from) noexcept {
+        if (_nextQuote < from) {
+            _nextQuote = findByte(from, _quote);
+        }
+        const std::size_t separator = findByte(from, _separator);
+        // Fast path: no quote before the separator, so there is nothing to track. Once the input contains no more quotes,
+        // _nextQuote stays at size and this is just a memchr
+        if (separator < _nextQuote) {
+            return separator;
+        }
+        // [from, _nextQuote) contains no separator, so tracking can start at the quote
+        bool quoted = false;
+        for (std::size_t i = _nextQuote; i < _size; ++i) {
+            if (_data[i] == _quote) {
+                quoted = !quoted;
+                if (quoted) {
+                    // Jump to the closing quote
+                    i = findByte(i + 1, _quote) - 1;
+                }
+            }
+            else if (_data[i] == _separator && !quoted) {
+                return i;
+            }
+        }
+        return _size;
+    }
+
+    void toEnd() noexcept {
+        _tokenBegin = _size + 1;
+        _tokenEnd = _size + 1;
+    }
+
+    void startTokenAt(const std::size_t position) noexcept {
+        if (_isRecords && position == _size) {
+            toEnd();
+            return;
+        }
+        _tokenBegin = position;
+        _tokenEnd = findSeparator(position);
+    }
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = SubString;
+    using reference = SubString;
+    using difference_type = std::ptrdiff_t;
+    using pointer = FakePointerProxy<reference>;
+
+    CsvIterator(const char* data, const std::size_t size, const char separator, const char quote, const bool isRecords,
+                const bool isEnd) :
+        _data(data),
+        _size(size),
+        _separator(separator),
+        _quote(quote),
+        _isRecords(isRecords) {
+        if (isEnd) {
+            toEnd();
+        }
+        else {
+            _nextQuote = findByte(0, _quote);
+            startTokenAt(0);
+        }
+    }
+
+    CsvIterator() = default;
+
+    LZ_NODISCARD value_type operator*() const {
+        std::size_t begin = _tokenBegin;
+        std::size_t end = _tokenEnd;
+        if (_isRecords) {
+            if (end != begin && _data[end - 1] == '\r') {
+                --end;
+            }
+        }
+        else if (end - begin >= 2 && _data[begin] == _quote && _data[end - 1] == _quote) {
+            ++begin;
+            --end;
+        }
+        return SubString(_data + begin, end - begin);
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    CsvIterator& operator++() {
+        if (_tokenEnd >= _size) {
+            toEnd();
+        }
+        else {
+            startTokenAt(_tokenEnd + 1);
+        }
+        return *this;
+    }
+
+    CsvIterator operator++(int) {
+        CsvIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const CsvIterator& a, const CsvIterator& b) noexcept {
+        LZ_ASSERT(a._separator == b._separator && a._quote == b._quote, "incompatible iterator types, found different separators");
+        return a._tokenBegin != b._tokenBegin;
+    }
+
+    LZ_NODISCARD friend bool operator==(const CsvIterator& a, const CsvIterator& b) noexcept {
+        return !(a != b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_CSV_ITERATOR_HPP
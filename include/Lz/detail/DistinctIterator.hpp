@@ -0,0 +1,110 @@
+#pragma once
+
+#ifndef LZ_DISTINCT_ITERATOR_HPP
+#    define LZ_DISTINCT_ITERATOR_HPP
+
+#    include "LzTools.hpp"
+
+#    include <memory>
+#    include <unordered_map>
+
+namespace lz {
+namespace internal {
+// Maps every value seen so far to the position of its first occurrence. The positions [0, _scanned) have been inserted, so an
+// element is distinct if it is the first one at the scan frontier with its value, or if it's the recorded first occurrence.
+// This way all iterators of one view share the index, while still being independent multi pass forward iterators
+template<class T, class Hash, class KeyEqual, class Allocator>
+class DistinctIndex {
+    using PairAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::pair<const T, std::size_t>>;
+
+    std::unordered_map<T, std::size_t, Hash, KeyEqual, PairAllocator> _firstOccurrence;
+    std::size_t _scanned{};
+
+public:
+    DistinctIndex(const std::size_t capacityHint, const Hash& hash, const KeyEqual& keyEqual, const Allocator& allocator) :
+        _firstOccurrence(0, hash, keyEqual, PairAllocator(allocator)) {
+        if (capacityHint != 0) {
+            _firstOccurrence.reserve(capacityHint);
+        }
+    }
+
+    template<class U>
+    bool isFirstOccurrence(U&& value, const std::size_t position) {
+        if (position == _scanned) {
+            ++_scanned;
+            return _firstOccurrence.emplace(std::forward<U>(value), position).second;
+        }
+        LZ_ASSERT(position < _scanned, "positions must be checked in order");
+        return _firstOccurrence.find(value)->second == position;
+    }
+};
+
+template<LZ_CONCEPT_ITERATOR Iterator, class Hash, class KeyEqual, class Allocator>
+class DistinctIterator {
+    using IterTraits = std::iterator_traits<Iterator>;
+    using Index = DistinctIndex<Decay<typename IterTraits::value_type>, Hash, KeyEqual, Allocator>;
+
+    Iterator _iterator{};
+    Iterator _end{};
+    std::size_t _position{};
+    std::shared_ptr<Index> _index{};
+
+    void findNext() {
+        for (; _iterator != _end && !_index->isFirstOccurrence(*_iterator, _position); ++_iterator) {
+            ++_position;
+        }
+    }
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename IterTraits::value_type;
+    using difference_type = typename IterTraits::difference_type;
+    using reference = typename IterTraits::reference;
+    using pointer = FakePointerProxy<reference>;
+
+    DistinctIterator(Iterator iterator, Iterator end, std::shared_ptr<Index> index) :
+        _iterator(std::move(iterator)),
+        _end(std::move(end)),
+        _index(std::move(index)) {
+        findNext();
+    }
+
+    DistinctIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return *_iterator;
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    LZ_NODISCARD SizeHint sizeHintTo(const DistinctIterator& end) const {
+        return upperBoundSizeHint(_iterator, end._iterator);
+    }
+
+    DistinctIterator& operator++() {
+        ++_iterator;
+        ++_position;
+        findNext();
+        return *this;
+    }
+
+    DistinctIterator operator++(int) {
+        DistinctIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator==(const DistinctIterator& a, const DistinctIterator& b) {
+        return a._iterator == b._iterator;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const DistinctIterator& a, const DistinctIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_DISTINCT_ITERATOR_HPP
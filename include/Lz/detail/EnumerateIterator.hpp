@@ -7,8 +7,22 @@
 
 namespace lz {
 namespace internal {
+template<class Arithmetic, class Reference, class Sink>
+struct EnumerateSink {
+    Arithmetic index;
+    Sink& sink;
+
+    template<class T>
+    LZ_CONSTEXPR_CXX_20 bool operator()(T&& value) {
+        return sink(std::pair<Arithmetic, Reference>(index++, std::forward<T>(value)));
+    }
+};
+
+template<LZ_CONCEPT_ITERATOR Iterator, LZ_CONCEPT_INTEGRAL Arithmetic, bool = IsRandomAccess<Iterator>::value>
+class EnumerateIterator;
+
 template<LZ_CONCEPT_ITERATOR Iterator, LZ_CONCEPT_INTEGRAL Arithmetic>
-class EnumerateIterator {
+class EnumerateIterator<Iterator, Arithmetic, false /* isRandomAccess */> {
     Arithmetic _index;
     Iterator _iterator;
 
@@ -21,7 +35,7 @@ public:
     using reference = std::pair<Arithmetic, typename IterTraits::reference>;
     using pointer = FakePointerProxy<reference>;
 
-    constexpr EnumerateIterator(const Arithmetic start, Iterator iterator) : _index(start), _iterator(std::move(iterator)) {
+    constexpr EnumerateIterator(const Arithmetic index, Iterator iterator) : _index(index), _iterator(std::move(iterator)) {
     }
 
     constexpr EnumerateIterator() = default;
@@ -34,6 +48,12 @@ public:
         return FakePointerProxy<decltype(**this)>(**this);
     }
 
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool forEachWhile(const EnumerateIterator& end, Sink& sink) {
+        EnumerateSink<Arithmetic, typename IterTraits::reference, Sink> enumerateSink{ _index, sink };
+        return internal::forEachWhile(_iterator, end._iterator, enumerateSink);
+    }
+
     LZ_CONSTEXPR_CXX_20 EnumerateIterator& operator++() {
         ++_index;
         ++_iterator;
@@ -58,8 +78,97 @@ public:
         return tmp;
     }
 
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsSized<I>::value, difference_type> sizeTo(const EnumerateIterator& end) const {
+        return getIterLength(_iterator, end._iterator);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHintTo(const EnumerateIterator& end) const {
+        return sizeHint(_iterator, end._iterator);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const EnumerateIterator& a, const EnumerateIterator& b) noexcept {
+        return !(a != b); // NOLINT
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const EnumerateIterator& a, const EnumerateIterator& b) noexcept {
+        return a._iterator != b._iterator;
+    }
+};
+
+// The index is not stored, but derived from the distance to the first element, so that moving the iterator moves a single
+// variable. A loop over `lz::enumerate(vector)` then has one induction variable, like `for (std::size_t i = 0; ...)` has
+template<LZ_CONCEPT_ITERATOR Iterator, LZ_CONCEPT_INTEGRAL Arithmetic>
+class EnumerateIterator<Iterator, Arithmetic, true /* isRandomAccess */> {
+    Iterator _begin;
+    Iterator _iterator;
+    Arithmetic _start;
+
+    using IterTraits = std::iterator_traits<Iterator>;
+
+public:
+    using iterator_category = typename IterTraits::iterator_category;
+    using value_type = std::pair<Arithmetic, typename IterTraits::value_type>;
+    using difference_type = typename IterTraits::difference_type;
+    using reference = std::pair<Arithmetic, typename IterTraits::reference>;
+    using pointer = FakePointerProxy<reference>;
+
+    constexpr EnumerateIterator(const Arithmetic start, Iterator begin, Iterator iterator) :
+        _begin(std::move(begin)),
+        _iterator(std::move(iterator)),
+        _start(start) {
+    }
+
+    constexpr EnumerateIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Arithmetic index() const {
+        return static_cast<Arithmetic>(_start + static_cast<Arithmetic>(_iterator - _begin));
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return { index(), *_iterator };
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 FakePointerProxy<reference> operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    // Indexes the underlying iterator with the same counter that makes up the index
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool forEachWhile(const EnumerateIterator& end, Sink& sink) {
+        const difference_type length = end._iterator - _iterator;
+        const Arithmetic first = index();
+        for (difference_type i = 0; i != length; ++i) {
+            if (!sink(reference(static_cast<Arithmetic>(first + static_cast<Arithmetic>(i)), _iterator[i]))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    LZ_CONSTEXPR_CXX_20 EnumerateIterator& operator++() {
+        ++_iterator;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 EnumerateIterator operator++(int) {
+        EnumerateIterator tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_20 EnumerateIterator& operator--() {
+        --_iterator;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 EnumerateIterator operator--(int) {
+        EnumerateIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
     LZ_CONSTEXPR_CXX_20 EnumerateIterator& operator+=(const difference_type offset) {
-        _index += static_cast<Arithmetic>(offset);
         _iterator += offset;
         return *this;
     }
@@ -70,8 +179,12 @@ public:
         return tmp;
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend EnumerateIterator operator+(const difference_type offset,
+                                                                        const EnumerateIterator& iterator) {
+        return iterator + offset;
+    }
+
     LZ_CONSTEXPR_CXX_20 EnumerateIterator& operator-=(const difference_type offset) {
-        _index -= static_cast<Arithmetic>(offset);
         _iterator -= offset;
         return *this;
     }
@@ -82,6 +195,10 @@ public:
         return tmp;
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHintTo(const EnumerateIterator& end) const {
+        return sizeHint(_iterator, end._iterator);
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend difference_type operator-(const EnumerateIterator& a, const EnumerateIterator& b) {
         return a._iterator - b._iterator;
     }
@@ -29,7 +29,8 @@ private:
     Iterator _end{};
     IteratorToExcept _toExceptBegin{};
     IteratorToExcept _toExceptEnd{};
-    mutable FunctionContainer<Compare> _compare{};
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<Compare> _compare{};
 #ifdef LZ_HAS_EXECUTION
     LZ_NO_UNIQUE_ADDRESS
     Execution _execution{};
@@ -42,7 +43,7 @@ private:
             });
         }
         else { // NOLINT
-            _iterator = std::find_if(_execution, std::move(_iterator), _end, [this](const value_type& value) {
+            _iterator = internal::findIfBatched(_execution, std::move(_iterator), _end, [this](const value_type& value) {
                 return !std::binary_search(_toExceptBegin, _toExceptEnd, value, _compare);
             });
         }
@@ -86,6 +87,10 @@ public:
         return FakePointerProxy<decltype(**this)>(**this);
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHintTo(const ExceptIterator& end) const {
+        return upperBoundSizeHint(_iterator, end._iterator);
+    }
+
     LZ_CONSTEXPR_CXX_20 ExceptIterator& operator++() {
         ++_iterator;
         find();
@@ -5,12 +5,26 @@
 
 namespace lz {
 namespace internal {
+// The position of `end` is only needed to step back from it, which only random access exclude iterators can do
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 DiffType<Iterator>
+excludeEndIndex(std::true_type /* isRandomAccess */, const Iterator& begin, const Iterator& end) {
+    return end - begin;
+}
+
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 DiffType<Iterator> excludeEndIndex(std::false_type /* isRandomAccess */, const Iterator&, const Iterator&) {
+    return (std::numeric_limits<DiffType<Iterator>>::max)();
+}
+
 template<class Iterator>
 class ExcludeIterator {
     using IterTraits = std::iterator_traits<Iterator>;
 
 public:
-    using iterator_category = typename std::common_type<std::forward_iterator_tag, typename IterTraits::iterator_category>::type;
+    using iterator_category =
+        Conditional<IsRandomAccess<Iterator>::value, std::random_access_iterator_tag,
+                    typename std::common_type<std::forward_iterator_tag, typename IterTraits::iterator_category>::type>;
     using value_type = typename IterTraits::value_type;
     using difference_type = typename IterTraits::difference_type;
     using reference = typename IterTraits::reference;
@@ -18,25 +32,46 @@ public:
 
 private:
     Iterator _iterator{};
-    Iterator _begin{};
-    Iterator _end{};
+    // The position of `_iterator` in the underlying sequence, which is never within [_from, _to)
     difference_type _index{};
     difference_type _from{};
     difference_type _to{};
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type toExcluded(const difference_type index) const noexcept {
+        return index < _from ? index : index - (_to - _from);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type toUnderlying(const difference_type index) const noexcept {
+        return index < _from ? index : index + (_to - _from);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type excludedBetween(const difference_type first,
+                                                                     const difference_type last) const noexcept {
+        if (last < first) {
+            return -excludedBetween(last, first);
+        }
+        const auto lower = first < _from ? _from : first;
+        const auto upper = last < _to ? last : _to;
+        return upper > lower ? upper - lower : 0;
+    }
+
+    LZ_CONSTEXPR_CXX_20 void jumpTo(const difference_type index) {
+        using lz::next;
+        using std::next;
+        _iterator = next(std::move(_iterator), index - _index);
+        _index = index;
+    }
+
 public:
     LZ_CONSTEXPR_CXX_20
-    ExcludeIterator(Iterator it, Iterator begin, Iterator end, const difference_type from, const difference_type to) :
+    ExcludeIterator(Iterator it, const difference_type index, const difference_type from, const difference_type to) :
         _iterator(std::move(it)),
-        _begin(std::move(begin)),
-        _end(std::move(end)),
+        _index(index),
         _from(from),
         _to(to) {
-        using lz::next;
-        using std::next;
-        if (_iterator == _begin && _from == 0) {
-            _iterator = next(std::move(_iterator), _to);
-            _index = _to;
+        LZ_ASSERT(from <= to, "parameter `from` cannot be more than `to`");
+        if (_index >= _from && _index < _to) {
+            jumpTo(_to);
         }
     }
 
@@ -51,12 +86,10 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_20 ExcludeIterator& operator++() {
-        using lz::next;
-        using std::next;
         ++_iterator;
         ++_index;
         if (_index == _from) {
-            _iterator = next(std::move(_iterator), _to - _from);
+            jumpTo(_to);
         }
         return *this;
     }
@@ -67,6 +100,55 @@ public:
         return tmp;
     }
 
+    LZ_CONSTEXPR_CXX_20 ExcludeIterator& operator--() {
+        if (_index == _to && _from != _to) {
+            _iterator -= _to - _from;
+            _index = _from;
+        }
+        --_iterator;
+        --_index;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 ExcludeIterator operator--(int) {
+        ExcludeIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    // Jumps directly to the resulting position, so this is O(1) if `Iterator` is random access
+    LZ_CONSTEXPR_CXX_20 ExcludeIterator& operator+=(const difference_type offset) {
+        LZ_ASSERT(offset >= 0 || IsRandomAccess<Iterator>::value,
+                  "offset must be greater than 0 since this is not a bidirectional/random access iterator");
+        jumpTo(toUnderlying(toExcluded(_index) + offset));
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 ExcludeIterator& operator-=(const difference_type offset) {
+        return *this += -offset;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 ExcludeIterator operator+(const difference_type offset) const {
+        ExcludeIterator tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend ExcludeIterator operator+(const difference_type offset,
+                                                                      const ExcludeIterator& iterator) {
+        return iterator + offset;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 ExcludeIterator operator-(const difference_type offset) const {
+        ExcludeIterator tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator[](const difference_type offset) const {
+        return *(*this + offset);
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const ExcludeIterator& a, const ExcludeIterator& b) noexcept {
         return !(a != b); // NOLINT
     }
@@ -76,37 +158,33 @@ public:
         return a._iterator != b._iterator;
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator<(const ExcludeIterator& a, const ExcludeIterator& b) {
+        return a._iterator < b._iterator;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>(const ExcludeIterator& a, const ExcludeIterator& b) {
+        return b < a;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator<=(const ExcludeIterator& a, const ExcludeIterator& b) {
+        return !(b < a); // NOLINT
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>=(const ExcludeIterator& a, const ExcludeIterator& b) {
+        return !(a < b); // NOLINT
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend difference_type operator-(const ExcludeIterator& a, const ExcludeIterator& b) {
         LZ_ASSERT(a._to == b._to && a._from == b._from, "incompatible iterator types: from and to must be equal");
-        using lz::distance;
-        using std::distance;
-        if (b._index >= a._to || a._from == 0) { // after range
-            return distance(b._iterator, a._iterator);
-        }
-        return distance(b._iterator, a._iterator) - (a._to - b._from);
+        // The index of `a` is derived from `b`, because the end iterator does not know its index if `Iterator` is not random
+        // access
+        const auto length = getIterLength(b._iterator, a._iterator);
+        return length - b.excludedBetween(b._index, b._index + length);
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 ExcludeIterator operator+(difference_type offset) const {
-        LZ_ASSERT(offset >= 0, "offset must be greater than 0 since this is not a bidirectional/random access iterator");
-        using lz::distance;
-        using lz::next;
-        using std::distance;
-        using std::next;
-        ExcludeIterator tmp(*this);
-        const auto indexToAchieve = offset - tmp._index;
-        if (indexToAchieve >= tmp._to) { // after range
-            tmp._index += offset;
-            offset += tmp._to - tmp._from;
-        }
-        else if (indexToAchieve >= tmp._from && tmp._from != 0) { // within range
-            tmp._index = tmp._to;
-            offset += tmp._to - tmp._from;
-        }
-        else { // before range
-            tmp._index += offset;
-        }
-        tmp._iterator = next(std::move(tmp._iterator), offset);
-        return tmp;
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsSized<I>::value, difference_type> sizeTo(const ExcludeIterator& end) const {
+        return end - *this;
     }
 };
 } // namespace internal
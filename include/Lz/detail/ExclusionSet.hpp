@@ -0,0 +1,75 @@
+#pragma once
+
+#ifndef LZ_EXCLUSION_SET_HPP
+#    define LZ_EXCLUSION_SET_HPP
+
+#    include "LzTools.hpp"
+
+#    include <algorithm>
+#    include <memory>
+#    include <unordered_set>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+// Exclusion sets up to this size are scanned linearly, which beats hashing for a handful of elements
+constexpr LZ_INLINE_VAR std::size_t smallExclusionSetSize = 16;
+
+template<class T, class Hash, class KeyEqual>
+class ExclusionSet {
+    std::vector<T> _small{};
+    std::unordered_set<T, Hash, KeyEqual> _set{};
+    KeyEqual _equal{};
+    bool _isSmall{ true };
+
+public:
+    template<class Iterator>
+    ExclusionSet(Iterator begin, Iterator end, const Hash& hash, const KeyEqual& equal) : _set(0, hash, equal), _equal(equal) {
+        const auto length = static_cast<std::size_t>(getIterLength(begin, end));
+        _isSmall = length <= smallExclusionSetSize;
+        if (_isSmall) {
+            _small.assign(std::move(begin), std::move(end));
+        }
+        else {
+            _set.reserve(length);
+            _set.insert(std::move(begin), std::move(end));
+        }
+    }
+
+    ExclusionSet() = default;
+
+    template<class U>
+    LZ_NODISCARD std::size_t count(const U& value) const {
+        if (_isSmall) {
+            return static_cast<std::size_t>(
+                std::any_of(_small.begin(), _small.end(), [this, &value](const T& t) { return _equal(t, value); }));
+        }
+        return _set.count(value);
+    }
+};
+
+// Filter predicate that returns true for values that are not in the set. SetPointer is anything that points to a type with
+// a `count(value)` member, e.g. a shared_ptr to an ExclusionSet or a pointer to a user provided std::set/std::unordered_set
+template<class SetPointer>
+struct NotContainedIn {
+    SetPointer set;
+
+    template<class T>
+    LZ_NODISCARD bool operator()(const T& value) const {
+        return set->count(value) == 0;
+    }
+};
+
+template<class IteratorToExcept, class Hash, class KeyEqual>
+using HashedExclusionPredicate = NotContainedIn<std::shared_ptr<const ExclusionSet<ValueType<IteratorToExcept>, Hash, KeyEqual>>>;
+
+template<class IteratorToExcept, class Hash, class KeyEqual>
+HashedExclusionPredicate<IteratorToExcept, Hash, KeyEqual>
+makeHashedExclusionPredicate(IteratorToExcept begin, IteratorToExcept end, const Hash& hash, const KeyEqual& equal) {
+    using Set = ExclusionSet<ValueType<IteratorToExcept>, Hash, KeyEqual>;
+    return { std::make_shared<const Set>(std::move(begin), std::move(end), hash, equal) };
+}
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_EXCLUSION_SET_HPP
@@ -3,13 +3,138 @@
 #ifndef LZ_FILTER_ITERATOR_HPP
 #define LZ_FILTER_ITERATOR_HPP
 
+#include "BitMaskIterator.hpp"
 #include "FunctionContainer.hpp"
 #include "LzTools.hpp"
+#include "ZipIterator.hpp"
 
 #include <algorithm>
+#include <cstdint>
 
 namespace lz {
 namespace internal {
+template<class UnaryPredicate, class Sink>
+struct FilterSink {
+    FunctionContainer<UnaryPredicate>& predicate;
+    Sink& sink;
+
+    template<class T>
+    LZ_CONSTEXPR_CXX_20 bool operator()(T&& value) {
+        if (predicate(value)) {
+            return sink(std::forward<T>(value));
+        }
+        return true;
+    }
+};
+
+// Amount of elements whose predicate is evaluated at once when filtering a random access range of arithmetic values
+constexpr LZ_INLINE_VAR std::size_t filterBlockSize = 1024;
+
+template<class Iterator>
+struct IsBlockFilterable
+    : std::integral_constant<bool, IsRandomAccess<Iterator>::value && std::is_arithmetic<Decay<ValueType<Iterator>>>::value> {};
+
+// Filters [begin, end) block by block: the predicate is first evaluated for every element of the block, writing the offsets of
+// the survivors into a selection vector, after which the survivors are fed to the sink. The first loop has no data dependent
+// branches, so unpredictable predicates like `x > threshold` on unsorted data don't cost a misprediction per element. Note that
+// the predicate may therefore be called for up to a block of elements past the one at which the sink stopped.
+template<class Iterator, class UnaryPredicate, class Sink>
+LZ_CONSTEXPR_CXX_20 bool
+blockFilterForEachWhile(Iterator begin, const Iterator& end, FunctionContainer<UnaryPredicate>& predicate, Sink& sink) {
+    std::uint16_t selection[filterBlockSize]{};
+    using Difference = DiffType<Iterator>;
+    for (Difference remaining = end - begin; remaining > 0;) {
+        const auto blockSize = static_cast<std::uint16_t>(std::min(remaining, static_cast<Difference>(filterBlockSize)));
+        std::size_t selected = 0;
+        for (std::uint16_t i = 0; i < blockSize; ++i) {
+            selection[selected] = i;
+            selected += static_cast<std::size_t>(static_cast<bool>(predicate(begin[i])));
+        }
+        for (std::size_t i = 0; i < selected; ++i) {
+            if (!sink(begin[selection[i]])) {
+                return false;
+            }
+        }
+        begin += blockSize;
+        remaining -= blockSize;
+    }
+    return true;
+}
+
+template<class Iterator, class UnaryPredicate, class Sink>
+LZ_CONSTEXPR_CXX_20 bool filterForEachWhile(std::true_type /* isBlockFilterable */, Iterator begin, const Iterator& end,
+                                            FunctionContainer<UnaryPredicate>& predicate, Sink& sink) {
+    return blockFilterForEachWhile(std::move(begin), end, predicate, sink);
+}
+
+template<class Iterator, class UnaryPredicate, class Sink>
+LZ_CONSTEXPR_CXX_20 bool filterForEachWhile(std::false_type /* isBlockFilterable */, Iterator begin, const Iterator& end,
+                                            FunctionContainer<UnaryPredicate>& predicate, Sink& sink) {
+    FilterSink<UnaryPredicate, Sink> filterSink{ predicate, sink };
+    return internal::forEachWhile(std::move(begin), end, filterSink);
+}
+
+// `lz::select` filters a zip of values and selectors on the selectors. If both are random access, the selectors of a block are
+// first packed into a bit mask, 8 at a time if they are contiguous bytes, after which every selected element of the block is
+// found with a count trailing zeros, instead of testing every selector through a tuple of a value and a selector
+template<class Iterator, class SelectorIterator, class Sink>
+bool blockSelectForEachWhile(const ZipIterator<Iterator, SelectorIterator>& begin,
+                             const ZipIterator<Iterator, SelectorIterator>& end, Sink& sink) {
+    using Reference = RefType<ZipIterator<Iterator, SelectorIterator>>;
+    using SelectorDifference = DiffType<SelectorIterator>;
+    constexpr std::size_t blockWords = filterBlockSize / bitMaskWordBits;
+    std::uint64_t words[blockWords]{};
+    const Iterator& values = std::get<0>(begin.base());
+    const SelectorIterator& selectors = std::get<1>(begin.base());
+    const auto length = static_cast<std::size_t>(end - begin);
+    for (std::size_t offset = 0; offset < length; offset += filterBlockSize) {
+        const std::size_t blockSize = (std::min)(filterBlockSize, length - offset);
+        const std::size_t wordCount = (blockSize + bitMaskWordBits - 1) / bitMaskWordBits;
+        for (std::size_t w = 0; w < wordCount; ++w) {
+            const std::size_t wordOffset = offset + w * bitMaskWordBits;
+            words[w] = packFlagWord(IsByteFlags<SelectorIterator>(), selectors + static_cast<SelectorDifference>(wordOffset),
+                                    (std::min)(bitMaskWordBits, length - wordOffset));
+        }
+        for (std::size_t w = 0; w < wordCount; ++w) {
+            for (std::uint64_t word = words[w]; word != 0; word &= word - 1) {
+                const std::size_t index = offset + w * bitMaskWordBits + countTrailingZeros(word);
+                Reference selected(values[static_cast<DiffType<Iterator>>(index)],
+                                   selectors[static_cast<SelectorDifference>(index)]);
+                if (!sink(std::move(selected))) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+template<class Iterator, class SelectorIterator, class Sink>
+LZ_CONSTEXPR_CXX_20 bool
+selectForEachWhile(std::true_type /* isRandomAccess */, const ZipIterator<Iterator, SelectorIterator>& begin,
+                   const ZipIterator<Iterator, SelectorIterator>& end, FunctionContainer<GetFn<1>>& predicate, Sink& sink) {
+    if (!isConstantEvaluated()) {
+        return blockSelectForEachWhile(begin, end, sink);
+    }
+    FilterSink<GetFn<1>, Sink> filterSink{ predicate, sink };
+    return internal::forEachWhile(begin, end, filterSink);
+}
+
+template<class Iterator, class SelectorIterator, class Sink>
+LZ_CONSTEXPR_CXX_20 bool
+selectForEachWhile(std::false_type /* isRandomAccess */, const ZipIterator<Iterator, SelectorIterator>& begin,
+                   const ZipIterator<Iterator, SelectorIterator>& end, FunctionContainer<GetFn<1>>& predicate, Sink& sink) {
+    FilterSink<GetFn<1>, Sink> filterSink{ predicate, sink };
+    return internal::forEachWhile(begin, end, filterSink);
+}
+
+template<class Iterator, class SelectorIterator, class Sink>
+LZ_CONSTEXPR_CXX_20 bool
+filterForEachWhile(std::false_type /* isBlockFilterable */, ZipIterator<Iterator, SelectorIterator> begin,
+                   const ZipIterator<Iterator, SelectorIterator>& end, FunctionContainer<GetFn<1>>& predicate, Sink& sink) {
+    return selectForEachWhile(IsRandomAccess<ZipIterator<Iterator, SelectorIterator>>(), begin, end, predicate, sink);
+}
+
 #ifdef LZ_HAS_EXECUTION
 template<LZ_CONCEPT_ITERATOR Iterator, class UnaryPredicate, class Execution>
 #else  // ^^^lz has execution vvv ! lz has execution
@@ -32,7 +157,7 @@ public:
             return std::find_if(std::move(first), std::move(last), _predicate);
         }
         else {
-            return std::find_if(_execution, std::move(first), std::move(last), _predicate);
+            return internal::findIfBatched(_execution, std::move(first), std::move(last), _predicate);
         }
 #else  // ^^^lz has execution vvv ! lz has execution
         return std::find_if(std::move(first), std::move(last), _predicate);
@@ -43,7 +168,8 @@ private:
     Iterator _begin{};
     Iterator _iterator{};
     Iterator _end{};
-    mutable FunctionContainer<UnaryPredicate> _predicate{};
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<UnaryPredicate> _predicate{};
 #ifdef LZ_HAS_EXECUTION
     LZ_NO_UNIQUE_ADDRESS
     Execution _execution{};
@@ -53,7 +179,7 @@ public:
 #ifdef LZ_HAS_EXECUTION
     LZ_CONSTEXPR_CXX_20 FilterIterator(Iterator iterator, Iterator begin, Iterator end, UnaryPredicate function, Execution execution)
 #else  // ^^^lz has execution vvv ! lz has execution
-    FilterIterator(Iterator iterator, Iterator begin, Iterator end, UnaryPredicate function)
+    LZ_CONSTEXPR_CXX_20 FilterIterator(Iterator iterator, Iterator begin, Iterator end, UnaryPredicate function)
 #endif // LZ_HAS_EXECUTION
         :
         _begin(std::move(begin)),
@@ -80,6 +206,23 @@ public:
         return FakePointerProxy<decltype(**this)>(**this);
     }
 
+    LZ_NODISCARD constexpr const Iterator& base() const noexcept {
+        return _iterator;
+    }
+
+    LZ_NODISCARD constexpr const FunctionContainer<UnaryPredicate>& predicate() const noexcept {
+        return _predicate;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHintTo(const FilterIterator& end) const {
+        return upperBoundSizeHint(_iterator, end._iterator);
+    }
+
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool forEachWhile(const FilterIterator& end, Sink& sink) {
+        return filterForEachWhile(IsBlockFilterable<Iterator>(), _iterator, end._iterator, _predicate, sink);
+    }
+
     LZ_CONSTEXPR_CXX_20 FilterIterator& operator++() {
         ++_iterator;
         _iterator = find(std::move(_iterator), _end);
@@ -102,8 +245,8 @@ public:
 
     LZ_CONSTEXPR_CXX_20 FilterIterator operator--(int) {
         FilterIterator tmp(*this);
-        ++*this;
-        return *this;
+        --*this;
+        return tmp;
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const FilterIterator& a, const FilterIterator& b) noexcept {
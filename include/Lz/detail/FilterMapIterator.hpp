@@ -0,0 +1,116 @@
+#pragma once
+
+#ifndef LZ_FILTER_MAP_ITERATOR_HPP
+#    define LZ_FILTER_MAP_ITERATOR_HPP
+
+#    include "FunctionContainer.hpp"
+#    include "LzTools.hpp"
+
+#    include <memory>
+
+namespace lz {
+namespace internal {
+template<class Function, class Sink>
+struct FilterMapSink {
+    FunctionContainer<Function>& function;
+    Sink& sink;
+
+    template<class T>
+    LZ_CONSTEXPR_CXX_20 bool operator()(T&& value) {
+        auto result = function(std::forward<T>(value));
+        if (result) {
+            return sink(std::move(*result));
+        }
+        return true;
+    }
+};
+
+// Calls `function` once for every element, and yields the values of the results that are engaged. The engaged result of the
+// current element is kept in the iterator, so dereferencing it does not call `function` again
+template<class Iterator, class Function>
+class FilterMapIterator {
+    using IterTraits = std::iterator_traits<Iterator>;
+    using Optional = Decay<FunctionReturnType<FunctionContainer<Function>&, RefType<Iterator>>>;
+
+public:
+    using iterator_category = typename std::common_type<std::forward_iterator_tag, typename IterTraits::iterator_category>::type;
+    using value_type = Decay<decltype(*std::declval<Optional&>())>;
+    using reference = const value_type&;
+    using difference_type = typename IterTraits::difference_type;
+    using pointer = const value_type*;
+
+private:
+    Iterator _iterator{};
+    Iterator _end{};
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<Function> _function{};
+    Optional _current{};
+
+    LZ_CONSTEXPR_CXX_20 void find() {
+        for (; _iterator != _end; ++_iterator) {
+            _current = _function(*_iterator);
+            if (_current) {
+                return;
+            }
+        }
+    }
+
+public:
+    LZ_CONSTEXPR_CXX_20 FilterMapIterator(Iterator iterator, Iterator end, Function function) :
+        _iterator(std::move(iterator)),
+        _end(std::move(end)),
+        _function(std::move(function)) {
+        find();
+    }
+
+    constexpr FilterMapIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return *_current;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return std::addressof(**this);
+    }
+
+    LZ_CONSTEXPR_CXX_20 FilterMapIterator& operator++() {
+        ++_iterator;
+        find();
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 FilterMapIterator operator++(int) {
+        FilterMapIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHintTo(const FilterMapIterator& end) const {
+        return upperBoundSizeHint(_iterator, end._iterator);
+    }
+
+    // The current result is moved into the sink, the results of the other elements are never stored in the iterator
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool forEachWhile(const FilterMapIterator& end, Sink& sink) {
+        if (_iterator == end._iterator) {
+            return true;
+        }
+        if (!sink(std::move(*_current))) {
+            return false;
+        }
+        FilterMapSink<Function, Sink> filterMapSink{ _function, sink };
+        return internal::forEachWhile(std::next(_iterator), end._iterator, filterMapSink);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const FilterMapIterator& a, const FilterMapIterator& b) {
+        return a._iterator == b._iterator;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const FilterMapIterator& a, const FilterMapIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_FILTER_MAP_ITERATOR_HPP
@@ -3,8 +3,11 @@
 #ifndef LZ_FLATTEN_ITERATOR_HPP
 #define LZ_FLATTEN_ITERATOR_HPP
 
+#include "Contiguous.hpp"
 #include "LzTools.hpp"
 
+#include <array>
+
 namespace lz {
 namespace internal {
 template<class, class U>
@@ -85,6 +88,35 @@ struct CountDimsHelper<false> {
 template<class T>
 using CountDims = typename CountDimsHelper<IsIterator<T>::value>::template type<T>;
 
+// The inner sequences that the outer iterator yields as rvalue references (for e.g. the elements of `lz::moveFrom`) are iterated
+// with move iterators, so that their elements are moved through as well. Inner sequences that are returned by value, such as the
+// chunks of `lz::chunks`, refer to elements that live elsewhere, so those are iterated as is
+template<class OuterIterator, bool = std::is_rvalue_reference<RefType<OuterIterator>>::value>
+struct InnerIterators {
+    template<class Iterable>
+    static LZ_CONSTEXPR_CXX_20 auto begin(Iterable&& iterable) -> decltype(std::begin(iterable)) {
+        return std::begin(iterable);
+    }
+
+    template<class Iterable>
+    static LZ_CONSTEXPR_CXX_20 auto end(Iterable&& iterable) -> decltype(std::end(iterable)) {
+        return std::end(iterable);
+    }
+};
+
+template<class OuterIterator>
+struct InnerIterators<OuterIterator, true> {
+    template<class Iterable>
+    static LZ_CONSTEXPR_CXX_20 auto begin(Iterable&& iterable) -> decltype(std::make_move_iterator(std::begin(iterable))) {
+        return std::make_move_iterator(std::begin(iterable));
+    }
+
+    template<class Iterable>
+    static LZ_CONSTEXPR_CXX_20 auto end(Iterable&& iterable) -> decltype(std::make_move_iterator(std::end(iterable))) {
+        return std::make_move_iterator(std::end(iterable));
+    }
+};
+
 // Improvement of https://stackoverflow.com/a/21076724/8729023
 template<class Iterator>
 class FlattenWrapper {
@@ -122,6 +154,10 @@ public:
         return _current != _begin;
     }
 
+    LZ_CONSTEXPR_CXX_20 const Iterator& current() const noexcept {
+        return _current;
+    }
+
     LZ_CONSTEXPR_CXX_20 friend bool operator!=(const FlattenWrapper& a, const FlattenWrapper& b) noexcept {
         return a._current != b._current;
     }
@@ -156,14 +192,15 @@ public:
 
     LZ_CONSTEXPR_CXX_20 FlattenWrapper operator--(int) {
         FlattenWrapper tmp(*this);
-        ++*this;
+        --*this;
         return tmp;
     }
 };
 
 template<class Iterator, int N>
 class FlattenIterator {
-    using Inner = FlattenIterator<decltype(std::begin(*std::declval<Iterator>())), N - 1>;
+    using InnerIters = InnerIterators<Iterator>;
+    using Inner = FlattenIterator<decltype(InnerIters::begin(*std::declval<Iterator>())), N - 1>;
 
 public:
     using reference = typename Inner::reference;
@@ -179,8 +216,8 @@ private:
             return;
         }
         for (++_outerIter; _outerIter.hasSome(); ++_outerIter) {
-            const auto begin = std::begin(*_outerIter);
-            _innerIter = { begin, begin, std::end(*_outerIter) };
+            const auto begin = InnerIters::begin(*_outerIter);
+            _innerIter = { begin, begin, InnerIters::end(*_outerIter) };
             if (_innerIter.hasSome()) {
                 return;
             }
@@ -197,8 +234,8 @@ public:
     LZ_CONSTEXPR_CXX_20 FlattenIterator(Iterator it, Iterator begin, Iterator end) :
         _outerIter(std::move(it), std::move(begin), std::move(end)) {
         if (_outerIter.hasSome()) {
-            const auto beg = std::begin(*_outerIter);
-            _innerIter = { beg, beg, std::end(*_outerIter) };
+            const auto beg = InnerIters::begin(*_outerIter);
+            _innerIter = { beg, beg, InnerIters::end(*_outerIter) };
             this->advance();
         }
     }
@@ -227,6 +264,62 @@ public:
         return FakePointerProxy<decltype(**this)>(**this);
     }
 
+    template<class I = Inner>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsSized<I>::value, difference_type> sizeTo(const FlattenIterator& end) const {
+        auto outer = _outerIter;
+        auto inner = _innerIter;
+        difference_type total = 0;
+        while (outer != end._outerIter) {
+            const auto last = InnerIters::end(*outer);
+            total += getIterLength(inner, Inner(last, InnerIters::begin(*outer), last));
+            ++outer;
+            if (outer.hasSome()) {
+                const auto begin = InnerIters::begin(*outer);
+                inner = { begin, begin, InnerIters::end(*outer) };
+            }
+            else {
+                inner = {};
+            }
+        }
+        return total + getIterLength(inner, end._innerIter);
+    }
+
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool forEachWhile(const FlattenIterator& end, Sink& sink) {
+        while (_outerIter != end._outerIter) {
+            const auto last = InnerIters::end(*_outerIter);
+            if (!internal::forEachWhile(_innerIter, Inner(last, InnerIters::begin(*_outerIter), last), sink)) {
+                return false;
+            }
+            ++_outerIter;
+            if (_outerIter.hasSome()) {
+                const auto begin = InnerIters::begin(*_outerIter);
+                _innerIter = { begin, begin, InnerIters::end(*_outerIter) };
+            }
+            else {
+                _innerIter = {};
+            }
+        }
+        return internal::forEachWhile(_innerIter, end._innerIter, sink);
+    }
+
+    template<class SegmentSink>
+    LZ_CONSTEXPR_CXX_20 void forEachSegment(const FlattenIterator& end, SegmentSink& sink) {
+        while (_outerIter != end._outerIter) {
+            const auto last = InnerIters::end(*_outerIter);
+            internal::forEachSegment(_innerIter, Inner(last, InnerIters::begin(*_outerIter), last), sink);
+            ++_outerIter;
+            if (_outerIter.hasSome()) {
+                const auto begin = InnerIters::begin(*_outerIter);
+                _innerIter = { begin, begin, InnerIters::end(*_outerIter) };
+            }
+            else {
+                _innerIter = {};
+            }
+        }
+        internal::forEachSegment(_innerIter, end._innerIter, sink);
+    }
+
     LZ_CONSTEXPR_CXX_20 FlattenIterator& operator++() {
         ++_innerIter;
         this->advance();
@@ -246,8 +339,8 @@ public:
         }
         while (_outerIter.hasPrev()) {
             --_outerIter;
-            const auto end = std::end(*_outerIter);
-            _innerIter = { end, std::begin(*_outerIter), end };
+            const auto end = InnerIters::end(*_outerIter);
+            _innerIter = { end, InnerIters::begin(*_outerIter), end };
             if (_innerIter.hasPrev()) {
                 --_innerIter;
                 return *this;
@@ -306,6 +399,23 @@ public:
         return !(a != b); // NOLINT
     }
 
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsSized<I>::value, difference_type> sizeTo(const FlattenIterator& end) const {
+        return _range != end._range ? getIterLength(_range.current(), end._range.current()) : 0;
+    }
+
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool forEachWhile(const FlattenIterator& end, Sink& sink) const {
+        return internal::forEachWhile(_range.current(), end._range.current(), sink);
+    }
+
+    template<class SegmentSink>
+    LZ_CONSTEXPR_CXX_20 void forEachSegment(const FlattenIterator& end, SegmentSink& sink) const {
+        if (_range != end._range) {
+            sink(_range.current(), end._range.current());
+        }
+    }
+
     LZ_CONSTEXPR_CXX_20 FlattenIterator& operator++() {
         ++_range;
         return *this;
@@ -328,6 +438,226 @@ public:
         return tmp;
     }
 };
+
+template<class T>
+struct FixedArrayTraits {
+    static constexpr bool value = false;
+    static constexpr std::size_t size = 1;
+    using Element = T;
+};
+
+template<class T, std::size_t M>
+struct FixedArrayTraits<std::array<T, M>> {
+    static constexpr bool value = M != 0 && sizeof(std::array<T, M>) == M * sizeof(T);
+    static constexpr std::size_t size = M;
+    using Element = T;
+};
+
+template<class T, std::size_t M>
+struct FixedArrayTraits<T[M]> {
+    static constexpr bool value = true;
+    static constexpr std::size_t size = M;
+    using Element = T;
+};
+
+// Whether the first `Dims` levels of T are fixed size arrays without padding, in which case the elements of all levels lie back
+// to back in memory, as one block of `size` elements
+template<class T, int Dims>
+class ContiguousBlock {
+    using Traits = FixedArrayTraits<typename std::remove_const<T>::type>;
+    using Inner = Conditional<std::is_const<T>::value, const typename Traits::Element, typename Traits::Element>;
+    using Next = ContiguousBlock<Inner, Dims - 1>;
+
+public:
+    static constexpr bool value = Traits::value && Next::value;
+    static constexpr std::size_t size = Traits::size * Next::size;
+    using Element = typename Next::Element;
+
+    static LZ_CONSTEXPR_CXX_20 Element* data(T& array) {
+        return Next::data(array[0]);
+    }
+
+    static LZ_CONSTEXPR_CXX_20 Element& at(T& array, const std::size_t index) {
+        return Next::at(array[index / Next::size], index % Next::size);
+    }
+};
+
+template<class T>
+class ContiguousBlock<T, 0> {
+public:
+    static constexpr bool value = true;
+    static constexpr std::size_t size = 1;
+    using Element = T;
+
+    static LZ_CONSTEXPR_CXX_20 Element* data(T& element) {
+        return std::addressof(element);
+    }
+
+    static LZ_CONSTEXPR_CXX_20 Element& at(T& element, std::size_t) {
+        return element;
+    }
+};
+
+template<class Iterator, int Dims>
+using FlattenBlock = ContiguousBlock<typename std::remove_reference<RefType<Iterator>>::type, Dims>;
+
+// A contiguous sequence of e.g. `std::array<std::array<T, M>, N>` is one block of memory, which is iterated as such
+template<class Iterator, int Dims>
+struct IsFlattenBlock : std::integral_constant<bool, IsContiguousIterator<Iterator>::value &&
+                                                         std::is_lvalue_reference<RefType<Iterator>>::value &&
+                                                         FlattenBlock<Iterator, Dims>::value> {};
+
+// Iterates over a block by an index into its first element, which makes it random access, sized and as fast as iterating the
+// underlying buffer directly. Constant evaluation does not allow a pointer to walk from one array into the next, so there, the
+// element is looked up level by level instead
+template<class Iterator, int Dims>
+class FlattenBlockIterator {
+    using Block = FlattenBlock<Iterator, Dims>;
+    using Element = typename Block::Element;
+    using Size = std::size_t;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = typename std::remove_const<Element>::type;
+    using difference_type = DiffType<Iterator>;
+    using reference = Element&;
+    using pointer = Element*;
+
+private:
+    Iterator _begin{};
+    pointer _data{};
+    difference_type _index{};
+
+    LZ_CONSTEXPR_CXX_20 reference element(const difference_type index) const {
+        if (!isConstantEvaluated()) {
+            return _data[index];
+        }
+        const auto i = static_cast<Size>(index);
+        return Block::at(*(_begin + static_cast<difference_type>(i / Block::size)), i % Block::size);
+    }
+
+public:
+    constexpr FlattenBlockIterator() = default;
+
+    LZ_CONSTEXPR_CXX_20 FlattenBlockIterator(Iterator begin, const Iterator& end, const bool isEnd) :
+        _begin(std::move(begin)),
+        _data(_begin == end ? nullptr : Block::data(*_begin)),
+        _index(isEnd ? (end - _begin) * static_cast<difference_type>(Block::size) : 0) {
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return element(_index);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return std::addressof(**this);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator[](const difference_type offset) const {
+        return element(_index + offset);
+    }
+
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool forEachWhile(const FlattenBlockIterator& end, Sink& sink) const {
+        if (!isConstantEvaluated()) {
+            return internal::forEachWhile(_data + _index, _data + end._index, sink);
+        }
+        for (difference_type i = _index; i != end._index; ++i) {
+            if (!sink(element(i))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    LZ_CONSTEXPR_CXX_20 FlattenBlockIterator& operator++() {
+        ++_index;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 FlattenBlockIterator operator++(int) {
+        FlattenBlockIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_20 FlattenBlockIterator& operator--() {
+        --_index;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 FlattenBlockIterator operator--(int) {
+        FlattenBlockIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_20 FlattenBlockIterator& operator+=(const difference_type offset) {
+        _index += offset;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 FlattenBlockIterator& operator-=(const difference_type offset) {
+        _index -= offset;
+        return *this;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 FlattenBlockIterator operator+(const difference_type offset) const {
+        FlattenBlockIterator tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend FlattenBlockIterator operator+(const difference_type offset,
+                                                                           const FlattenBlockIterator& iterator) {
+        return iterator + offset;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 FlattenBlockIterator operator-(const difference_type offset) const {
+        FlattenBlockIterator tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend difference_type operator-(const FlattenBlockIterator& a,
+                                                                      const FlattenBlockIterator& b) noexcept {
+        return a._index - b._index;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
+    operator==(const FlattenBlockIterator& a, const FlattenBlockIterator& b) noexcept {
+        return a._index == b._index;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
+    operator!=(const FlattenBlockIterator& a, const FlattenBlockIterator& b) noexcept {
+        return !(a == b); // NOLINT
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
+    operator<(const FlattenBlockIterator& a, const FlattenBlockIterator& b) noexcept {
+        return a._index < b._index;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
+    operator>(const FlattenBlockIterator& a, const FlattenBlockIterator& b) noexcept {
+        return b < a; // NOLINT
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
+    operator<=(const FlattenBlockIterator& a, const FlattenBlockIterator& b) noexcept {
+        return !(b < a); // NOLINT
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
+    operator>=(const FlattenBlockIterator& a, const FlattenBlockIterator& b) noexcept {
+        return !(a < b); // NOLINT
+    }
+};
+
+template<class Iterator, int Dims>
+using FlattenIteratorFor = Conditional<IsFlattenBlock<Iterator, Dims>::value, FlattenBlockIterator<Iterator, Dims>,
+                                       FlattenIterator<Iterator, Dims>>;
 } // namespace internal
 } // namespace lz
 
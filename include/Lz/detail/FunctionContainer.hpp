@@ -5,136 +5,324 @@
 
 #    include "LzTools.hpp"
 
+#    include <memory>
 #    include <utility>
 
 namespace lz {
 namespace internal {
+#    ifdef __cpp_lib_is_final
+template<class T>
+using IsFinal = std::is_final<T>;
+#    else
+// Without std::is_final it cannot be checked whether a class can be inherited from, so every class is treated as final
 template<class>
-struct AlwaysFalse : std::false_type {};
+using IsFinal = std::true_type;
+#    endif // __cpp_lib_is_final
+
+// How FunctionContainer stores a callable:
+// - pointer: function pointers are stored as is. Calling them cannot modify them, so unlike the other callables they are not
+//   mutable, which allows copying them in constant expressions
+// - assignable: callables that can be assigned (std::function, most function objects and, since C++20, lambdas without
+//   captures) are stored as is, so that the container is as large and as trivial as the callable itself
+// - empty: lambdas without captures pre C++20 cannot be assigned, but as they have no state, assigning them is a no-op. They
+//   are inherited from, so that the container is empty too
+// - reconstructed: other lambdas are destroyed and copy constructed again when assigned. If that can't throw, no bookkeeping
+//   is needed
+// - guarded: otherwise, a flag keeps track of whether the callable is alive, in case its copy constructor threw when assigned
+enum class FunctionStorage { pointer, assignable, empty, reconstructed, guarded };
+
+template<class Func>
+constexpr FunctionStorage functionStorage() noexcept {
+    return std::is_pointer<Func>::value ? FunctionStorage::pointer
+           : std::is_copy_assignable<Func>::value && std::is_move_assignable<Func>::value ? FunctionStorage::assignable
+           : std::is_empty<Func>::value && !IsFinal<Func>::value && std::is_trivially_copy_constructible<Func>::value &&
+                   std::is_trivially_destructible<Func>::value
+               ? FunctionStorage::empty
+           : std::is_nothrow_copy_constructible<Func>::value && std::is_nothrow_move_constructible<Func>::value
+               ? FunctionStorage::reconstructed
+               : FunctionStorage::guarded;
+}
+
+template<class Func, FunctionStorage = functionStorage<Func>()>
+class FunctionContainer;
+
+template<class Func>
+class FunctionContainer<Func, FunctionStorage::pointer> {
+    Func _func;
+
+public:
+    constexpr explicit FunctionContainer(const Func func) noexcept : _func(func) {
+    }
+
+    constexpr FunctionContainer() noexcept : _func() {
+    }
+
+    template<class... Args>
+    constexpr auto operator()(Args&&... args) const noexcept(noexcept(_func(std::forward<Args>(args)...)))
+        -> decltype(_func(std::forward<Args>(args)...)) {
+        return _func(std::forward<Args>(args)...);
+    }
+};
 
 template<class Func>
-class FunctionContainer {
+class FunctionContainer<Func, FunctionStorage::assignable> {
+    LZ_NO_UNIQUE_ADDRESS
     mutable Func _func;
-    bool _isConstructed{ false };
 
-    constexpr explicit FunctionContainer(std::false_type /*isDefaultConstructible*/) {
-        static_assert(AlwaysFalse<Func>::value, "Please use std::function instead of a lambda in this case, because "
-                                                "lambda's are not default constructible pre C++20");
+public:
+    constexpr explicit FunctionContainer(const Func& func) : _func(func) {
     }
 
-    constexpr explicit FunctionContainer(std::true_type /*isDefaultConstructible*/) : _func(), _isConstructed(true) {
+    constexpr explicit FunctionContainer(Func&& func) noexcept(std::is_nothrow_move_constructible<Func>::value) :
+        _func(std::move(func)) {
     }
 
+    constexpr FunctionContainer() : _func() {
+        static_assert(std::is_default_constructible<Func>::value, "Please use std::function instead of a lambda in this case, "
+                                                                  "because lambda's are not default constructible pre C++20");
+    }
+
+    constexpr const Func& function() const noexcept {
+        return _func;
+    }
+
+    template<class... Args>
+    constexpr auto operator()(Args&&... args) const noexcept(noexcept(_func(std::forward<Args>(args)...)))
+        -> decltype(_func(std::forward<Args>(args)...)) {
+        return _func(std::forward<Args>(args)...);
+    }
+};
+
+template<class Func>
+class FunctionContainer<Func, FunctionStorage::empty> : private Func {
+    constexpr Func& function() const noexcept {
+        // Func has no state, so calling a non const operator() on it cannot modify anything
+        return static_cast<Func&>(const_cast<FunctionContainer&>(*this));
+    }
+
+public:
+    constexpr explicit FunctionContainer(const Func& func) noexcept : Func(func) {
+    }
+
+    constexpr FunctionContainer() : Func() {
+        static_assert(std::is_default_constructible<Func>::value, "Please use std::function instead of a lambda in this case, "
+                                                                  "because lambda's are not default constructible pre C++20");
+    }
+
+    constexpr FunctionContainer(const FunctionContainer&) = default;
+
+    constexpr FunctionContainer(FunctionContainer&&) = default;
+
+    LZ_CONSTEXPR_CXX_14 FunctionContainer& operator=(const FunctionContainer&) noexcept {
+        return *this;
+    }
+
+    template<class... Args>
+    constexpr auto operator()(Args&&... args) const noexcept(noexcept(std::declval<Func&>()(std::forward<Args>(args)...)))
+        -> decltype(std::declval<Func&>()(std::forward<Args>(args)...)) {
+        return function()(std::forward<Args>(args)...);
+    }
+};
+
+template<class Func>
+class FunctionContainer<Func, FunctionStorage::reconstructed> {
+    mutable Func _func;
+
     template<class F>
-    LZ_CONSTEXPR_CXX_20 void construct(F&& f) {
+    LZ_CONSTEXPR_CXX_20 void reconstruct(F&& f) noexcept {
+        _func.~Func();
         ::new (static_cast<void*>(std::addressof(_func))) Func(static_cast<F&&>(f));
-        _isConstructed = true;
     }
 
-    constexpr void reset() noexcept {
-        if (_isConstructed) {
-            _func.~Func();
-            _isConstructed = false;
-        }
+public:
+    constexpr explicit FunctionContainer(const Func& func) noexcept : _func(func) {
     }
 
-#    ifdef __cpp_if_constexpr
-    template<class F = Func>
-    LZ_CONSTEXPR_CXX_20 void copy(const Func& f) {
-        if constexpr (std::is_copy_assignable_v<F>) {
-            _func = f;
-        }
-        else {
-            reset();
-            construct(f);
-        }
+    constexpr explicit FunctionContainer(Func&& func) noexcept : _func(std::move(func)) {
     }
 
-    template<class F = Func>
-    LZ_CONSTEXPR_CXX_20 void move(Func&& f) {
-        if constexpr (std::is_move_assignable_v<F>) {
-            _func = std::move(f);
-        }
-        else {
-            reset();
-            construct(std::move(f));
+    constexpr FunctionContainer() : _func() {
+        static_assert(std::is_default_constructible<Func>::value, "Please use std::function instead of a lambda in this case, "
+                                                                  "because lambda's are not default constructible pre C++20");
+    }
+
+    constexpr FunctionContainer(const FunctionContainer&) = default;
+
+    constexpr FunctionContainer(FunctionContainer&&) = default;
+
+    LZ_CONSTEXPR_CXX_20 FunctionContainer& operator=(const FunctionContainer& other) noexcept {
+        if (this != &other) {
+            reconstruct(other._func);
         }
+        return *this;
     }
-#    else
-    template<class F = Func>
-    LZ_CONSTEXPR_CXX_20 EnableIf<std::is_copy_assignable<F>::value> copy(const Func& f) {
-        _func = f;
+
+    LZ_CONSTEXPR_CXX_20 FunctionContainer& operator=(FunctionContainer&& other) noexcept {
+        if (this != &other) {
+            reconstruct(std::move(other._func));
+        }
+        return *this;
     }
 
-    template<class F = Func>
-    LZ_CONSTEXPR_CXX_20 EnableIf<!std::is_copy_assignable<F>::value> copy(const Func& f) {
-        reset();
-        construct(f);
+    template<class... Args>
+    constexpr auto operator()(Args&&... args) const noexcept(noexcept(_func(std::forward<Args>(args)...)))
+        -> decltype(_func(std::forward<Args>(args)...)) {
+        return _func(std::forward<Args>(args)...);
     }
+};
 
-    template<class F = Func>
-    constexpr EnableIf<std::is_move_assignable<F>::value> move(Func&& f) {
-        _func = std::move(f);
+template<class Func>
+class FunctionContainer<Func, FunctionStorage::guarded> {
+    // A union, so that the callable is only destroyed if it is alive
+    union {
+        mutable Func _func;
+    };
+    bool _isConstructed{ false };
+
+    template<class F>
+    LZ_CONSTEXPR_CXX_20 void construct(F&& f) {
+        ::new (static_cast<void*>(std::addressof(_func))) Func(static_cast<F&&>(f));
+        _isConstructed = true;
     }
 
-    template<class F = Func>
-    LZ_CONSTEXPR_CXX_20 EnableIf<!std::is_move_assignable<F>::value> move(Func&& f) {
-        reset();
-        construct(std::move(f));
+    LZ_CONSTEXPR_CXX_20 void reset() noexcept {
+        if (_isConstructed) {
+            _func.~Func();
+            _isConstructed = false;
+        }
     }
-#    endif
 
 public:
-    constexpr explicit FunctionContainer(const Func& func) : _func(func), _isConstructed(true) {
+    LZ_CONSTEXPR_CXX_20 explicit FunctionContainer(const Func& func) : _func(func), _isConstructed(true) {
     }
 
-    constexpr explicit FunctionContainer(Func&& func) noexcept : _func(std::move(func)), _isConstructed(true) {
+    LZ_CONSTEXPR_CXX_20 explicit FunctionContainer(Func&& func) noexcept : _func(std::move(func)), _isConstructed(true) {
     }
 
-    constexpr FunctionContainer() : FunctionContainer(std::is_default_constructible<Func>()) {
+    LZ_CONSTEXPR_CXX_20 FunctionContainer() : _func(), _isConstructed(true) {
+        static_assert(std::is_default_constructible<Func>::value, "Please use std::function instead of a lambda in this case, "
+                                                                  "because lambda's are not default constructible pre C++20");
     }
 
-    LZ_CONSTEXPR_CXX_14 FunctionContainer(FunctionContainer&& other) noexcept :
-        _func(std::move(other._func)),
-        _isConstructed(true) {
-        other._isConstructed = false;
+    LZ_CONSTEXPR_CXX_20 FunctionContainer(const FunctionContainer& other) {
+        if (other._isConstructed) {
+            construct(other._func);
+        }
     }
 
-    constexpr FunctionContainer(const FunctionContainer& other) : _func(other._func), _isConstructed(true) {
+    LZ_CONSTEXPR_CXX_20 FunctionContainer(FunctionContainer&& other) noexcept {
+        if (other._isConstructed) {
+            construct(std::move(other._func));
+        }
     }
 
     LZ_CONSTEXPR_CXX_20 FunctionContainer& operator=(const FunctionContainer& other) {
-        if (_isConstructed && other._isConstructed) {
-            copy(other._func);
-        }
-        else if (other._isConstructed) {
-            construct(other._func);
-        }
-        else if (_isConstructed) {
+        if (this != &other) {
             reset();
+            if (other._isConstructed) {
+                construct(other._func);
+            }
         }
         return *this;
     }
 
     LZ_CONSTEXPR_CXX_20 FunctionContainer& operator=(FunctionContainer&& other) noexcept {
-        if (_isConstructed && other._isConstructed) {
-            move(std::move(other._func));
-        }
-        else if (other._isConstructed) {
-            construct(std::move(other._func));
-        }
-        else if (_isConstructed) {
+        if (this != &other) {
             reset();
+            if (other._isConstructed) {
+                construct(std::move(other._func));
+            }
         }
         return *this;
     }
 
+    LZ_CONSTEXPR_CXX_20 ~FunctionContainer() {
+        reset();
+    }
+
     template<class... Args>
     constexpr auto operator()(Args&&... args) const noexcept(noexcept(_func(std::forward<Args>(args)...)))
         -> decltype(_func(std::forward<Args>(args)...)) {
         return _func(std::forward<Args>(args)...);
     }
 };
+
+template<class Func>
+class SharedFunction {
+    std::shared_ptr<Func> _func{};
+
+public:
+    explicit SharedFunction(Func func) : _func(std::make_shared<Func>(std::move(func))) {
+    }
+
+    SharedFunction() = default;
+
+    template<class... Args>
+    auto operator()(Args&&... args) const -> decltype(std::declval<Func&>()(std::forward<Args>(args)...)) {
+        return (*_func)(std::forward<Args>(args)...);
+    }
+};
+
+// `second(first(args...))`, which is what a map of `first` followed by a map of `second` computes
+template<class First, class Second>
+class ComposedFunction {
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<First> _first;
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<Second> _second;
+
+public:
+    LZ_CONSTEXPR_CXX_20 ComposedFunction(FunctionContainer<First> first, Second second) :
+        _first(std::move(first)),
+        _second(std::move(second)) {
+    }
+
+    ComposedFunction() = default;
+
+    template<class... Args>
+    constexpr auto operator()(Args&&... args) const -> decltype(_second(_first(std::forward<Args>(args)...))) {
+        return _second(_first(std::forward<Args>(args)...));
+    }
+};
+
+// `first(value) && second(value)`, which is what a filter of `first` followed by a filter of `second` lets through
+template<class First, class Second>
+class ConjunctionFunction {
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<First> _first;
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<Second> _second;
+
+public:
+    LZ_CONSTEXPR_CXX_20 ConjunctionFunction(FunctionContainer<First> first, Second second) :
+        _first(std::move(first)),
+        _second(std::move(second)) {
+    }
+
+    ConjunctionFunction() = default;
+
+    template<class T>
+    constexpr bool operator()(T&& value) const {
+        return _first(value) && _second(value);
+    }
+};
 } // namespace internal
+
+/**
+ * @brief Lets all iterators of a view share one copy of `func`, instead of every iterator holding a copy of its own. Use this
+ * for callables that are expensive to copy, such as lambdas that capture a vector or a hash table by value. Copying an
+ * iterator then only copies a `std::shared_ptr`, and the iterators become default constructible and assignable, even if `func`
+ * is not. Because the copy is shared, a mutable callable sees the changes made through all iterators. Example:
+ * ```cpp
+ * std::unordered_set<int> allowed = { 1, 2, 3 };
+ * auto filter = lz::filter(values, lz::sharedFunction([allowed](int i) { return allowed.count(i) != 0; }));
+ * ```
+ * @param func The callable to share.
+ * @return A callable that calls the shared copy of `func`, and that can be passed to any view that takes a function.
+ */
+template<class Func>
+LZ_NODISCARD internal::SharedFunction<internal::Decay<Func>> sharedFunction(Func&& func) {
+    return internal::SharedFunction<internal::Decay<Func>>(std::forward<Func>(func));
+}
 } // namespace lz
 #endif // LZ_FUNCTION_CONTAINER_HPP
@@ -10,8 +10,8 @@ namespace internal {
 template<class GeneratorFunc>
 class GenerateIterator {
     std::size_t _current{};
-    mutable FunctionContainer<GeneratorFunc> _generator{};
-    bool _isWhileTrueLoop{};
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<GeneratorFunc> _generator{};
 
 public:
     using iterator_category = std::random_access_iterator_tag;
@@ -22,10 +22,9 @@ public:
 
     constexpr GenerateIterator() = default;
 
-    constexpr GenerateIterator(const std::size_t start, GeneratorFunc generatorFunc, const bool isWhileTrueLoop) :
-        _current(static_cast<difference_type>(start)),
-        _generator(std::move(generatorFunc)),
-        _isWhileTrueLoop(isWhileTrueLoop) {
+    constexpr GenerateIterator(const std::size_t start, GeneratorFunc generatorFunc) :
+        _current(start),
+        _generator(std::move(generatorFunc)) {
     }
 
     LZ_NODISCARD constexpr reference operator*() const {
@@ -37,9 +36,7 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_14 GenerateIterator& operator++() {
-        if (!_isWhileTrueLoop) {
-            ++_current;
-        }
+        ++_current;
         return *this;
     }
 
@@ -50,9 +47,7 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_14 GenerateIterator& operator--() {
-        if (!_isWhileTrueLoop) {
-            --_current;
-        }
+        --_current;
         return *this;
     }
 
@@ -63,16 +58,12 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_14 GenerateIterator& operator+=(const difference_type offset) {
-        if (!_isWhileTrueLoop) {
-            _current += offset;
-        }
+        _current += offset;
         return *this;
     }
 
     LZ_CONSTEXPR_CXX_14 GenerateIterator& operator-=(const difference_type offset) {
-        if (!_isWhileTrueLoop) {
-            _current -= offset;
-        }
+        _current -= offset;
         return *this;
     }
 
@@ -82,6 +73,11 @@ public:
         return tmp;
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend GenerateIterator operator+(const difference_type offset,
+                                                                       const GenerateIterator& iterator) {
+        return iterator + offset;
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_14 GenerateIterator operator-(const difference_type offset) const {
         GenerateIterator tmp(*this);
         tmp -= offset;
@@ -90,8 +86,7 @@ public:
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend difference_type
     operator-(const GenerateIterator& a, const GenerateIterator& b) {
-        LZ_ASSERT(a._isWhileTrueLoop == b._isWhileTrueLoop, "incompatible iterator types: both must be while true or not");
-        return a._current - b._current;
+        return static_cast<difference_type>(a._current - b._current);
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_14 value_type operator[](const difference_type offset) const {
@@ -103,12 +98,10 @@ public:
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend bool operator!=(const GenerateIterator& a, const GenerateIterator& b) noexcept {
-        LZ_ASSERT(a._isWhileTrueLoop == b._isWhileTrueLoop, "incompatible iterator types: both must be while true or not");
         return a._current != b._current;
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend bool operator<(const GenerateIterator& a, const GenerateIterator& b) {
-        LZ_ASSERT(a._isWhileTrueLoop == b._isWhileTrueLoop, "incompatible iterator types: both must be while true or not");
         return a._current < b._current;
     }
 
@@ -0,0 +1,318 @@
+#pragma once
+
+#ifndef LZ_GENERATOR_ITERATOR_HPP
+#    define LZ_GENERATOR_ITERATOR_HPP
+
+#    include "LzTools.hpp"
+
+#    if defined(LZ_HAS_CXX_20) && LZ_HAS_INCLUDE(<coroutine>)
+#        include <coroutine>
+#    endif // defined(LZ_HAS_CXX_20) && LZ_HAS_INCLUDE(<coroutine>)
+
+#    ifdef __cpp_lib_coroutine
+
+#        include <cstddef>
+#        include <exception>
+#        include <memory>
+#        include <type_traits>
+#        include <utility>
+
+namespace lz {
+template<class T>
+class Generator;
+
+namespace internal {
+template<class T>
+struct ElementsOf {
+    Generator<T> generator;
+};
+
+// The frame of a coroutine is followed by a header that knows how to free the frame, so that frames allocated with an allocator
+// passed as `std::allocator_arg, allocator` can be freed by the single usual `operator delete` that a promise type can have
+struct alignas(std::max_align_t) GeneratorFrameHeader {
+    void (*deallocate)(void* frame, std::size_t size) noexcept;
+};
+
+constexpr std::size_t generatorHeaderOffset(const std::size_t frameSize) noexcept {
+    return (frameSize + alignof(GeneratorFrameHeader) - 1) / alignof(GeneratorFrameHeader) * alignof(GeneratorFrameHeader);
+}
+
+template<class Allocator>
+using GeneratorBlockAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<GeneratorFrameHeader>;
+
+template<class Allocator>
+constexpr std::size_t generatorBlockCount(const std::size_t frameSize) noexcept {
+    const auto bytes = generatorHeaderOffset(frameSize) + sizeof(GeneratorFrameHeader) + sizeof(Allocator);
+    return (bytes + sizeof(GeneratorFrameHeader) - 1) / sizeof(GeneratorFrameHeader);
+}
+
+template<class Allocator>
+Allocator* generatorAllocatorOf(void* frame, const std::size_t frameSize) noexcept {
+    return reinterpret_cast<Allocator*>(static_cast<unsigned char*>(frame) + generatorHeaderOffset(frameSize) +
+                                        sizeof(GeneratorFrameHeader));
+}
+
+template<class Allocator>
+void deallocateGeneratorFrame(void* frame, const std::size_t frameSize) noexcept {
+    Allocator* stored = generatorAllocatorOf<Allocator>(frame, frameSize);
+    GeneratorBlockAllocator<Allocator> allocator(std::move(*stored));
+    stored->~Allocator();
+    std::allocator_traits<GeneratorBlockAllocator<Allocator>>::deallocate(
+        allocator, static_cast<GeneratorFrameHeader*>(frame), generatorBlockCount<Allocator>(frameSize));
+}
+
+inline void deleteGeneratorFrame(void* frame, const std::size_t frameSize) noexcept {
+    ::operator delete(frame, generatorHeaderOffset(frameSize) + sizeof(GeneratorFrameHeader));
+}
+
+// The generators nested with `co_yield lz::elementsOf(...)` form a stack, of which the innermost (the leaf) is resumed directly
+// and transfers control to its parent when it finishes. Advancing is therefore O(1), no matter how deep the nesting, which
+// matters for recursive producers such as tree walks
+template<class T>
+class GeneratorPromise {
+    using Handle = std::coroutine_handle<GeneratorPromise>;
+    using Pointer = std::add_pointer_t<Conditional<std::is_reference<T>::value, T, T&>>;
+
+    Pointer _value{};
+    GeneratorPromise* _root{ this };
+    Handle _leaf{ Handle::from_promise(*this) };
+    Handle _parent{};
+    std::exception_ptr _exception{};
+    bool _isStarted{ false };
+
+    struct FinalAwaiter {
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        std::coroutine_handle<> await_suspend(Handle handle) noexcept {
+            GeneratorPromise& promise = handle.promise();
+            if (promise._parent) {
+                promise._root->_leaf = promise._parent;
+                return promise._parent;
+            }
+            return std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {
+        }
+    };
+
+    struct NestedAwaiter {
+        Generator<T> generator;
+
+        bool await_ready() const noexcept {
+            return !generator._handle;
+        }
+
+        std::coroutine_handle<> await_suspend(Handle parent) noexcept {
+            GeneratorPromise& nested = generator._handle.promise();
+            nested._root = parent.promise()._root;
+            nested._parent = parent;
+            nested._root->_leaf = generator._handle;
+            return generator._handle;
+        }
+
+        void await_resume() const {
+            if (generator._handle && generator._handle.promise()._exception) {
+                std::rethrow_exception(generator._handle.promise()._exception);
+            }
+        }
+    };
+
+    // Non reference generators can yield const values too. They are copied, as a mutable pointer to them cannot be handed out
+    struct CopyAwaiter {
+        std::remove_cvref_t<T> value;
+        GeneratorPromise* root;
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        void await_suspend(Handle) noexcept {
+            root->_value = std::addressof(value);
+        }
+
+        void await_resume() const noexcept {
+        }
+    };
+
+    template<class Allocator>
+    static void* allocate(const std::size_t frameSize, const Allocator& allocator) {
+        static_assert(alignof(Allocator) <= alignof(GeneratorFrameHeader), "Allocator is over-aligned");
+        GeneratorBlockAllocator<Allocator> blockAllocator(allocator);
+        void* frame = std::allocator_traits<GeneratorBlockAllocator<Allocator>>::allocate(
+            blockAllocator, generatorBlockCount<Allocator>(frameSize));
+        ::new (generatorAllocatorOf<Allocator>(frame, frameSize)) Allocator(allocator);
+        auto* header = static_cast<unsigned char*>(frame) + generatorHeaderOffset(frameSize);
+        ::new (header) GeneratorFrameHeader{ &deallocateGeneratorFrame<Allocator> };
+        return frame;
+    }
+
+public:
+    GeneratorPromise() = default;
+
+    GeneratorPromise(const GeneratorPromise&) = delete;
+
+    GeneratorPromise& operator=(const GeneratorPromise&) = delete;
+
+    static void* operator new(const std::size_t frameSize) {
+        void* frame = ::operator new(generatorHeaderOffset(frameSize) + sizeof(GeneratorFrameHeader));
+        auto* header = static_cast<unsigned char*>(frame) + generatorHeaderOffset(frameSize);
+        ::new (header) GeneratorFrameHeader{ &deleteGeneratorFrame };
+        return frame;
+    }
+
+    template<class Allocator, class... Args>
+    static void* operator new(const std::size_t frameSize, std::allocator_arg_t, const Allocator& allocator, const Args&...) {
+        return allocate(frameSize, allocator);
+    }
+
+    template<class This, class Allocator, class... Args>
+    static void*
+    operator new(const std::size_t frameSize, const This&, std::allocator_arg_t, const Allocator& allocator, const Args&...) {
+        return allocate(frameSize, allocator);
+    }
+
+    static void operator delete(void* frame, const std::size_t frameSize) noexcept {
+        auto* header = static_cast<unsigned char*>(frame) + generatorHeaderOffset(frameSize);
+        reinterpret_cast<GeneratorFrameHeader*>(header)->deallocate(frame, frameSize);
+    }
+
+    // Match the placement forms of `operator new`, so that compilers do not see a frame allocated with an allocator being freed
+    // by a mismatched `operator delete`. The header knows how the frame was allocated, so these free it like the one above
+    template<class Allocator, class... Args>
+    static void operator delete(void* frame, const std::size_t frameSize, std::allocator_arg_t, const Allocator&,
+                                const Args&...) noexcept {
+        operator delete(frame, frameSize);
+    }
+
+    template<class This, class Allocator, class... Args>
+    static void operator delete(void* frame, const std::size_t frameSize, const This&, std::allocator_arg_t, const Allocator&,
+                                const Args&...) noexcept {
+        operator delete(frame, frameSize);
+    }
+
+    Generator<T> get_return_object() noexcept {
+        return Generator<T>(Handle::from_promise(*this));
+    }
+
+    std::suspend_always initial_suspend() const noexcept {
+        return {};
+    }
+
+    FinalAwaiter final_suspend() const noexcept {
+        return {};
+    }
+
+    std::suspend_always yield_value(std::remove_reference_t<T>& value) noexcept {
+        _root->_value = std::addressof(value);
+        return {};
+    }
+
+    // A yielded temporary lives until the generator is resumed, so it can be referred to until then
+    std::suspend_always yield_value(std::remove_reference_t<T>&& value) noexcept {
+        _root->_value = std::addressof(value);
+        return {};
+    }
+
+    CopyAwaiter yield_value(const std::remove_reference_t<T>& value)
+        requires(!std::is_reference<T>::value)
+    {
+        return CopyAwaiter{ value, _root };
+    }
+
+    NestedAwaiter yield_value(ElementsOf<T>&& elements) noexcept {
+        return NestedAwaiter{ std::move(elements.generator) };
+    }
+
+    void return_void() const noexcept {
+    }
+
+    // The outermost generator lets the exception escape from the increment that resumed it. A nested generator stores it, so
+    // that it is rethrown in its parent
+    void unhandled_exception() {
+        if (_root == this) {
+            throw;
+        }
+        _exception = std::current_exception();
+    }
+
+    template<class U>
+    std::suspend_never await_transform(U&&) = delete;
+
+    void start() {
+        if (!_isStarted) {
+            _isStarted = true;
+            _leaf.resume();
+        }
+    }
+
+    void resume() {
+        start();
+        _leaf.resume();
+    }
+
+    Pointer value() const noexcept {
+        return _value;
+    }
+};
+
+template<class T>
+class GeneratorIterator {
+    using Handle = std::coroutine_handle<GeneratorPromise<T>>;
+
+    Handle _handle{};
+
+    bool isDone() const {
+        if (!_handle) {
+            return true;
+        }
+        _handle.promise().start();
+        return _handle.done();
+    }
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::remove_cvref_t<T>;
+    using reference = Conditional<std::is_reference<T>::value, T, T&>;
+    using pointer = std::add_pointer_t<reference>;
+    using difference_type = std::ptrdiff_t;
+
+    explicit GeneratorIterator(const Handle handle) noexcept : _handle(handle) {
+    }
+
+    GeneratorIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        _handle.promise().start();
+        return static_cast<reference>(*_handle.promise().value());
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return std::addressof(**this);
+    }
+
+    GeneratorIterator& operator++() {
+        _handle.promise().resume();
+        return *this;
+    }
+
+    void operator++(int) {
+        ++*this;
+    }
+
+    LZ_NODISCARD friend bool operator==(const GeneratorIterator& a, const GeneratorIterator& b) {
+        return a.isDone() == b.isDone();
+    }
+
+    LZ_NODISCARD friend bool operator!=(const GeneratorIterator& a, const GeneratorIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#    endif // __cpp_lib_coroutine
+
+#endif // LZ_GENERATOR_ITERATOR_HPP
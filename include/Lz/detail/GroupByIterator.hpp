@@ -21,7 +21,8 @@ class GroupByIterator {
     Iterator _subRangeEnd{};
     Iterator _subRangeBegin{};
     Iterator _end{};
-    mutable FunctionContainer<Comparer> _comparer{};
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<Comparer> _comparer{};
 #ifdef LZ_HAS_EXECUTION
     LZ_NO_UNIQUE_ADDRESS
     Execution _execution{};
@@ -42,8 +43,8 @@ class GroupByIterator {
                                         [this, &next](const IterValueType& v) { return !_comparer(v, next); });
         }
         else {
-            _subRangeEnd = std::find_if(_execution, std::move(_subRangeEnd), _end,
-                                        [this, &next](const IterValueType& v) { return !_comparer(v, next); });
+            _subRangeEnd = internal::findIfBatched(_execution, std::move(_subRangeEnd), _end,
+                                                   [this, &next](const IterValueType& v) { return !_comparer(v, next); });
         }
 #else
         _subRangeEnd =
@@ -51,6 +52,19 @@ class GroupByIterator {
 #endif
     }
 
+#ifdef LZ_HAS_EXECUTION
+    template<class UnaryFunc>
+    void forEachGroupIn(Iterator group, const Iterator& stop, const UnaryFunc& func) const {
+        while (group != stop) {
+            Ref first = *group;
+            Iterator groupEnd =
+                std::find_if(std::next(group), stop, [this, &first](const IterValueType& v) { return !_comparer(v, first); });
+            func(reference{ first, { group, groupEnd } });
+            group = std::move(groupEnd);
+        }
+    }
+#endif // LZ_HAS_EXECUTION
+
 public:
     using iterator_category =
         typename std::common_type<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>::type;
@@ -90,6 +104,37 @@ public:
         return FakePointerProxy<decltype(**this)>(**this);
     }
 
+#ifdef LZ_HAS_EXECUTION
+    // Calls `func` for every group in [*this, end) on the pool of lz::execution::pool(). The range is split into equally sized
+    // parts, of which the edges are moved forward to the start of the next group, so that every group is handed to exactly one
+    // task. The groups themselves are found with a sequential scan in that task. Requires `_comparer` to be an equivalence relation.
+    template<class UnaryFunc>
+    void parallelForEach(const GroupByIterator& end, const UnaryFunc& func) const {
+        if constexpr (!IsRandomAccess<Iterator>::value) {
+            for (GroupByIterator it = *this; it != end; ++it) {
+                func(*it);
+            }
+        }
+        else {
+            using Diff = DiffType<Iterator>;
+            const Iterator begin = _subRangeBegin;
+            const auto length = static_cast<Diff>(end._subRangeBegin - begin);
+            const auto groupStart = [this, &begin, length](const std::size_t index) {
+                auto start = static_cast<Diff>(index);
+                while (start != 0 && start != length && _comparer(*(begin + (start - 1)), *(begin + start))) {
+                    ++start;
+                }
+                return start;
+            };
+
+            parallelForBlocks(execution::pool().pool(), static_cast<std::size_t>(length),
+                              [this, &begin, &groupStart, &func](const std::size_t from, const std::size_t to) {
+                                  forEachGroupIn(begin + groupStart(from), begin + groupStart(to), func);
+                              });
+        }
+    }
+#endif // LZ_HAS_EXECUTION
+
     LZ_CONSTEXPR_CXX_20 GroupByIterator& operator++() {
         _subRangeBegin = _subRangeEnd;
         advance();
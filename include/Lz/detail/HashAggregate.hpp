@@ -0,0 +1,106 @@
+#pragma once
+
+#ifndef LZ_HASH_AGGREGATE_HPP
+#    define LZ_HASH_AGGREGATE_HPP
+
+#    include "BasicIteratorView.hpp"
+#    include "LzTools.hpp"
+
+#    include <unordered_map>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+template<class Iterator, class KeySelector>
+using AggregateKey = Decay<FunctionReturnType<KeySelector, RefType<Iterator>>>;
+
+template<class Iterator, class KeySelector, class T>
+using AggregateMap = std::unordered_map<AggregateKey<Iterator, KeySelector>, T>;
+
+template<class Map, class Iterator, class KeySelector, class T, class Fold>
+void hashAggregateInto(Map& map, Iterator begin, const Iterator& end, const KeySelector& keySelector, const T& init,
+                       const Fold& fold) {
+    for (; begin != end; ++begin) {
+        auto&& value = *begin;
+        auto&& key = keySelector(value);
+        auto pos = map.find(key);
+        if (pos == map.end()) {
+            pos = map.emplace(std::forward<decltype(key)>(key), init).first;
+        }
+        pos->second = fold(std::move(pos->second), value);
+    }
+}
+
+template<class Map, class Iterator, class KeySelector, class T, class Fold>
+Map hashAggregate(Iterator begin, Iterator end, const KeySelector& keySelector, const T& init, const Fold& fold) {
+    Map map;
+    hashAggregateInto(map, std::move(begin), end, keySelector, init, fold);
+    return map;
+}
+
+#    ifdef LZ_HAS_EXECUTION
+// Splits [begin, end) by index into equally sized blocks that are aggregated on the pool of lz::execution::pool(), every block
+// into a partial map of its own. The partial maps are merged into the first one on the calling thread afterwards.
+template<class Map, class Iterator, class KeySelector, class T, class Fold, class Merge>
+Map parallelHashAggregate(const Iterator& begin, const Iterator& end, const KeySelector& keySelector, const T& init,
+                          const Fold& fold, const Merge& merge) {
+    using Diff = DiffType<Iterator>;
+    ThreadPool& pool = execution::pool().pool();
+    const auto length = static_cast<std::size_t>(end - begin);
+    const std::size_t blockCount = parallelBlockCount(pool, length);
+    if (blockCount <= 1) {
+        return hashAggregate<Map>(begin, end, keySelector, init, fold);
+    }
+
+    std::vector<Map> partials(blockCount);
+    parallelForBlocks(pool, length, blockCount, [&](const std::size_t block, const std::size_t from, const std::size_t to) {
+        hashAggregateInto(partials[block], begin + static_cast<Diff>(from), begin + static_cast<Diff>(to), keySelector, init,
+                          fold);
+    });
+
+    Map result = std::move(partials.front());
+    for (auto partial = std::next(partials.begin()); partial != partials.end(); ++partial) {
+        for (auto& keyValue : *partial) {
+            auto pos = result.find(keyValue.first);
+            if (pos == result.end()) {
+                result.emplace(keyValue.first, std::move(keyValue.second));
+            }
+            else {
+                pos->second = merge(std::move(pos->second), std::move(keyValue.second));
+            }
+        }
+    }
+    return result;
+}
+#    endif // LZ_HAS_EXECUTION
+
+struct CountFold {
+    template<class T>
+    LZ_NODISCARD constexpr std::size_t operator()(const std::size_t count, const T&) const noexcept {
+        return count + 1;
+    }
+};
+
+template<class ValueSelector>
+struct SumFold {
+    ValueSelector valueSelector;
+
+    template<class Sum, class T>
+    LZ_NODISCARD Sum operator()(Sum sum, const T& value) const {
+        return std::move(sum) + valueSelector(value);
+    }
+};
+
+struct SumMerge {
+    template<class Sum>
+    LZ_NODISCARD Sum operator()(Sum a, Sum b) const {
+        return std::move(a) + std::move(b);
+    }
+};
+
+template<class Iterator, class ValueSelector>
+using SumType = Decay<FunctionReturnType<ValueSelector, RefType<Iterator>>>;
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_HASH_AGGREGATE_HPP
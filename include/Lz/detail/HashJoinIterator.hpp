@@ -0,0 +1,162 @@
+#pragma once
+
+#ifndef LZ_HASH_JOIN_ITERATOR_HPP
+#    define LZ_HASH_JOIN_ITERATOR_HPP
+
+#    include "FunctionContainer.hpp"
+#    include "LzTools.hpp"
+
+#    include <memory>
+#    include <unordered_map>
+#    include <vector>
+
+namespace lz {
+/**
+ * A hash index over a sequence B, used by `lz::hashJoin`. All iterators of B are stored grouped by key in one contiguous
+ * buffer, so every key is a single hash lookup that yields all of its matches. The index can be built once with
+ * `lz::hashJoinIndex` and reused for multiple joins. The sequence B must outlive the index.
+ */
+template<class IterB, class Key, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+class HashJoinIndex {
+    std::unordered_map<Key, std::pair<std::size_t, std::size_t>, Hash, KeyEqual> _ranges{};
+    std::vector<IterB> _entries{};
+
+public:
+    using key_type = Key;
+    using match_iterator = typename std::vector<IterB>::const_iterator;
+
+    /**
+     * Builds the index in two passes over [begin, end): the first one counts the elements per key, the second one puts the
+     * iterators in place.
+     * @param begin The beginning of the sequence B.
+     * @param end The ending of the sequence B.
+     * @param selector A function that returns the key of an element of B.
+     */
+    template<class SelectorB>
+    HashJoinIndex(IterB begin, IterB end, SelectorB selector) {
+        std::size_t count = 0;
+        for (IterB it = begin; it != end; ++it, ++count) {
+            ++_ranges[selector(*it)].second;
+        }
+
+        std::size_t offset = 0;
+        for (auto& range : _ranges) {
+            const auto length = range.second.second;
+            range.second.first = offset;
+            range.second.second = offset;
+            offset += length;
+        }
+
+        _entries.resize(count);
+        for (; begin != end; ++begin) {
+            _entries[_ranges.find(selector(*begin))->second.second++] = begin;
+        }
+    }
+
+    HashJoinIndex() = default;
+
+    /**
+     * Looks up all elements of B with key `key`.
+     * @param key The key to look up.
+     * @return A pair of iterators over the matching iterators of B. Empty if there are no matches.
+     */
+    LZ_NODISCARD std::pair<match_iterator, match_iterator> find(const Key& key) const {
+        const auto pos = _ranges.find(key);
+        if (pos == _ranges.end()) {
+            return { _entries.end(), _entries.end() };
+        }
+        return { _entries.begin() + static_cast<std::ptrdiff_t>(pos->second.first),
+                 _entries.begin() + static_cast<std::ptrdiff_t>(pos->second.second) };
+    }
+
+    //! Returns the amount of elements of B that are indexed.
+    LZ_NODISCARD std::size_t size() const noexcept {
+        return _entries.size();
+    }
+
+    //! Returns the amount of distinct keys in B.
+    LZ_NODISCARD std::size_t keyCount() const noexcept {
+        return _ranges.size();
+    }
+};
+
+namespace internal {
+template<class IterA, class Index, class SelectorA, class ResultSelector>
+class HashJoinIterator {
+    using MatchIterator = typename Index::match_iterator;
+
+    IterA _iterA{};
+    IterA _endA{};
+    MatchIterator _match{};
+    MatchIterator _matchEnd{};
+    std::shared_ptr<const Index> _index{};
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<SelectorA> _selectorA{};
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<ResultSelector> _resultSelector{};
+
+    void findNext() {
+        for (; _iterA != _endA; ++_iterA) {
+            const auto matches = _index->find(_selectorA(*_iterA));
+            if (matches.first != matches.second) {
+                _match = matches.first;
+                _matchEnd = matches.second;
+                return;
+            }
+        }
+        _match = _matchEnd = MatchIterator{};
+    }
+
+public:
+    using reference = decltype(_resultSelector(*_iterA, **_match));
+    using value_type = Decay<reference>;
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using pointer = FakePointerProxy<reference>;
+
+    HashJoinIterator(IterA iterA, IterA endA, std::shared_ptr<const Index> index, SelectorA a, ResultSelector resultSelector) :
+        _iterA(std::move(iterA)),
+        _endA(std::move(endA)),
+        _index(std::move(index)),
+        _selectorA(std::move(a)),
+        _resultSelector(std::move(resultSelector)) {
+        findNext();
+    }
+
+    HashJoinIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return _resultSelector(*_iterA, **_match);
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    HashJoinIterator& operator++() {
+        ++_match;
+        if (_match == _matchEnd) {
+            ++_iterA;
+            findNext();
+        }
+        return *this;
+    }
+
+    HashJoinIterator operator++(int) {
+        HashJoinIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator==(const HashJoinIterator& a, const HashJoinIterator& b) {
+        return a._iterA == b._iterA && a._match == b._match;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const HashJoinIterator& a, const HashJoinIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_HASH_JOIN_ITERATOR_HPP
@@ -0,0 +1,381 @@
+#pragma once
+
+#ifndef LZ_INTEGER_CODING_ITERATOR_HPP
+#    define LZ_INTEGER_CODING_ITERATOR_HPP
+
+#    include "ByteMask.hpp"
+#    include "Contiguous.hpp"
+#    include "LzTools.hpp"
+
+#    include <cstdint>
+#    include <limits>
+
+namespace lz {
+namespace internal {
+template<class T>
+using UnsignedType = typename std::make_unsigned<T>::type;
+
+template<class T>
+using SignedType = typename std::make_signed<T>::type;
+
+// Arithmetic in the unsigned counterpart of T, which wraps around instead of overflowing, so that `undelta(delta(x)) == x` for
+// all integers, including deltas of signed values that do not fit in T
+struct WrappingMinus {
+    template<class T>
+    LZ_NODISCARD constexpr T operator()(const T a, const T b) const noexcept {
+        return static_cast<T>(static_cast<UnsignedType<T>>(static_cast<UnsignedType<T>>(a) - static_cast<UnsignedType<T>>(b)));
+    }
+};
+
+struct WrappingPlus {
+    template<class T>
+    LZ_NODISCARD constexpr T operator()(const T a, const T b) const noexcept {
+        return static_cast<T>(static_cast<UnsignedType<T>>(static_cast<UnsignedType<T>>(a) + static_cast<UnsignedType<T>>(b)));
+    }
+};
+
+// Maps 0, -1, 1, -2, 2... to 0, 1, 2, 3, 4..., so that values close to zero have few significant bits
+struct ZigzagEncode {
+    template<class T>
+    LZ_NODISCARD constexpr UnsignedType<T> operator()(const T value) const noexcept {
+        using U = UnsignedType<T>;
+        return static_cast<U>(static_cast<U>(static_cast<U>(value) << 1) ^ static_cast<U>(U{ 0 } - static_cast<U>(value < 0)));
+    }
+};
+
+struct ZigzagDecode {
+    template<class U>
+    LZ_NODISCARD constexpr SignedType<U> operator()(const U value) const noexcept {
+        return static_cast<SignedType<U>>(static_cast<U>(static_cast<U>(value >> 1) ^ static_cast<U>(U{ 0 } - (value & 1u))));
+    }
+};
+
+template<class T>
+struct MaxVarintLength : std::integral_constant<std::size_t, (std::numeric_limits<T>::digits + 6) / 7> {};
+
+// Yields the differences between consecutive elements, of which the first one is the first element itself
+template<LZ_CONCEPT_ITERATOR Iterator>
+class DeltaIterator {
+    using IterTraits = std::iterator_traits<Iterator>;
+    using T = Decay<typename IterTraits::value_type>;
+
+    Iterator _iterator{};
+    T _previous{};
+
+public:
+    using iterator_category = typename std::common_type<std::forward_iterator_tag, typename IterTraits::iterator_category>::type;
+    using value_type = T;
+    using reference = T;
+    using difference_type = typename IterTraits::difference_type;
+    using pointer = FakePointerProxy<reference>;
+
+    explicit constexpr DeltaIterator(Iterator iterator) : _iterator(std::move(iterator)) {
+    }
+
+    constexpr DeltaIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return WrappingMinus()(static_cast<T>(*_iterator), _previous);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool forEachWhile(const DeltaIterator& end, Sink& sink) const {
+        T previous = _previous;
+        for (Iterator it = _iterator; it != end._iterator; ++it) {
+            const T current = *it;
+            if (!sink(WrappingMinus()(current, previous))) {
+                return false;
+            }
+            previous = current;
+        }
+        return true;
+    }
+
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsSized<I>::value, difference_type> sizeTo(const DeltaIterator& end) const {
+        return getIterLength(_iterator, end._iterator);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHintTo(const DeltaIterator& end) const {
+        return sizeHint(_iterator, end._iterator);
+    }
+
+    LZ_CONSTEXPR_CXX_20 DeltaIterator& operator++() {
+        _previous = *_iterator;
+        ++_iterator;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 DeltaIterator operator++(int) {
+        DeltaIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const DeltaIterator& a, const DeltaIterator& b) {
+        return a._iterator == b._iterator;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const DeltaIterator& a, const DeltaIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+
+// Yields the LEB128 bytes of every element: 7 bits per byte, least significant first, with the high bit set on all bytes but
+// the last one of a value. The iterator points to an element and the byte within its encoding
+template<LZ_CONCEPT_ITERATOR Iterator>
+class VarintEncodeIterator {
+    using IterTraits = std::iterator_traits<Iterator>;
+    using T = Decay<typename IterTraits::value_type>;
+
+    static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value,
+                  "varint encodes unsigned integers, use lz::zigzag to encode signed integers");
+
+    Iterator _iterator{};
+    Iterator _end{};
+    T _rest{};
+    unsigned char _byte{};
+
+    LZ_CONSTEXPR_CXX_20 void load() {
+        if (_iterator != _end) {
+            _rest = *_iterator;
+        }
+    }
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::uint8_t;
+    using reference = std::uint8_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = FakePointerProxy<reference>;
+
+    LZ_CONSTEXPR_CXX_20 VarintEncodeIterator(Iterator iterator, Iterator end) :
+        _iterator(std::move(iterator)),
+        _end(std::move(end)) {
+        load();
+    }
+
+    constexpr VarintEncodeIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return static_cast<std::uint8_t>((_rest & 0x7Fu) | (_rest > 0x7Fu ? 0x80u : 0u));
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    // Every element takes at least one and at most `MaxVarintLength<T>` bytes
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHintTo(const VarintEncodeIterator& end) const {
+        const SizeHint elements = sizeHint(_iterator, end._iterator);
+        const std::size_t maxLength = MaxVarintLength<T>::value;
+        const bool fits = elements.upper != unknownSize && elements.upper <= unknownSize / maxLength;
+        return { elements.lower, fits ? elements.upper * maxLength : unknownSize };
+    }
+
+    LZ_CONSTEXPR_CXX_20 VarintEncodeIterator& operator++() {
+        if (_rest > 0x7Fu) {
+            _rest = static_cast<T>(_rest >> 7);
+            ++_byte;
+            return *this;
+        }
+        ++_iterator;
+        _byte = 0;
+        load();
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 VarintEncodeIterator operator++(int) {
+        VarintEncodeIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const VarintEncodeIterator& a, const VarintEncodeIterator& b) {
+        return a._iterator == b._iterator && a._byte == b._byte;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const VarintEncodeIterator& a, const VarintEncodeIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+
+// Decodes one value that starts at `iterator` and moves `iterator` past it. A value that is cut off by `end` is decoded from
+// the bytes that are there, and bits that do not fit in T are dropped
+template<class T, class Iterator>
+LZ_CONSTEXPR_CXX_20 T decodeVarint(Iterator& iterator, const Iterator& end) {
+    T value = 0;
+    for (unsigned shift = 0; iterator != end; shift += 7) {
+        const auto byte = static_cast<std::uint8_t>(*iterator);
+        ++iterator;
+        if (shift < static_cast<unsigned>(std::numeric_limits<T>::digits)) {
+            value = static_cast<T>(value | static_cast<T>(static_cast<T>(byte & 0x7Fu) << shift));
+        }
+        if ((byte & 0x80u) == 0) {
+            break;
+        }
+    }
+    return value;
+}
+
+// Packs the 7 bit groups of the bytes of `groups`, of which the high bits are cleared, together, in three steps that merge
+// neighbouring groups pairwise per 16, 32 and 64 bits
+LZ_NODISCARD inline std::uint64_t packVarintGroups(std::uint64_t groups) noexcept {
+    groups = ((groups & 0x7F007F007F007F00ULL) >> 1) | (groups & 0x007F007F007F007FULL);
+    groups = ((groups & 0x3FFF00003FFF0000ULL) >> 2) | (groups & 0x00003FFF00003FFFULL);
+    return ((groups & 0x0FFFFFFF00000000ULL) >> 4) | (groups & 0x000000000FFFFFFFULL);
+}
+
+// Decodes all values of [first, last) 8 bytes at a time, which is a portable form of the masked VByte decoders. The bytes
+// without their high bit set end a value, and every value that ends within a word is cut out of it and packed without a
+// branch per byte. A word of 8 single byte values is copied as is. Values of more than 8 bytes, and the last few bytes, are
+// decoded byte by byte. Returns false if the sink stopped early
+template<class T, class Sink>
+bool decodeVarints(const unsigned char* first, const unsigned char* last, Sink& sink) {
+    while (last - first >= 8) {
+        const std::uint64_t word = loadWord(reinterpret_cast<const char*>(first));
+        std::uint64_t stops = ~word & ~lowSevenBits;
+        if (stops == ~lowSevenBits) {
+            for (std::size_t i = 0; i < 8; ++i) {
+                if (!sink(static_cast<T>(first[i]))) {
+                    return false;
+                }
+            }
+            first += 8;
+            continue;
+        }
+        if (stops == 0) {
+            if (!sink(decodeVarint<T>(first, last))) {
+                return false;
+            }
+            continue;
+        }
+        std::size_t begin = 0;
+        do {
+            const std::size_t end = countTrailingZeros(stops) + 1;
+            const std::size_t length = end - begin;
+            const std::uint64_t mask = length == 64 ? ~std::uint64_t{ 0 } : (std::uint64_t{ 1 } << length) - 1;
+            if (!sink(static_cast<T>(packVarintGroups((word >> begin) & lowSevenBits & mask)))) {
+                return false;
+            }
+            begin = end;
+            stops &= stops - 1;
+        } while (stops != 0);
+        first += begin / 8;
+    }
+    while (first != last) {
+        if (!sink(decodeVarint<T>(first, last))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class Iterator>
+struct IsByteBuffer
+    : std::integral_constant<bool, IsContiguousIterator<Iterator>::value && std::is_integral<ValueType<Iterator>>::value &&
+                                       sizeof(ValueType<Iterator>) == 1> {};
+
+// Yields the values of a sequence of LEB128 bytes. The iterator points to the first byte of the current value, of which the
+// decoded value and the position of the next value are kept
+template<LZ_CONCEPT_ITERATOR Iterator, class T>
+class VarintDecodeIterator {
+    Iterator _iterator{};
+    Iterator _next{};
+    Iterator _end{};
+    T _value{};
+
+    LZ_CONSTEXPR_CXX_20 void decode() {
+        if (_iterator == _end) {
+            return;
+        }
+        _next = _iterator;
+        _value = decodeVarint<T>(_next, _end);
+    }
+
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool decodeRest(std::true_type /* isByteBuffer */, const Iterator& end, Sink& sink) const {
+        if (isConstantEvaluated() || _next == end) {
+            return decodeRest(std::false_type(), end, sink);
+        }
+        const auto* first = reinterpret_cast<const unsigned char*>(contiguousData(_next, end));
+        return decodeVarints<T>(first, first + (end - _next), sink);
+    }
+
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool decodeRest(std::false_type /* isByteBuffer */, const Iterator& end, Sink& sink) const {
+        for (Iterator it = _next; it != end;) {
+            if (!sink(decodeVarint<T>(it, end))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using reference = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = FakePointerProxy<reference>;
+
+    LZ_CONSTEXPR_CXX_20 VarintDecodeIterator(Iterator iterator, Iterator end) :
+        _iterator(std::move(iterator)),
+        _next(_iterator),
+        _end(std::move(end)) {
+        decode();
+    }
+
+    constexpr VarintDecodeIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return _value;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool forEachWhile(const VarintDecodeIterator& end, Sink& sink) const {
+        if (_iterator == end._iterator) {
+            return true;
+        }
+        if (!sink(_value)) {
+            return false;
+        }
+        return decodeRest(IsByteBuffer<Iterator>(), end._iterator, sink);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHintTo(const VarintDecodeIterator& end) const {
+        return upperBoundSizeHint(_iterator, end._iterator);
+    }
+
+    LZ_CONSTEXPR_CXX_20 VarintDecodeIterator& operator++() {
+        _iterator = _next;
+        decode();
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 VarintDecodeIterator operator++(int) {
+        VarintDecodeIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const VarintDecodeIterator& a, const VarintDecodeIterator& b) {
+        return a._iterator == b._iterator;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const VarintDecodeIterator& a, const VarintDecodeIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_INTEGER_CODING_ITERATOR_HPP
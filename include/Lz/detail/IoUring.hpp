@@ -0,0 +1,159 @@
+#pragma once
+
+#ifndef LZ_IO_URING_HPP
+#    define LZ_IO_URING_HPP
+
+#    if defined(__linux__) && defined(__has_include)
+#        if __has_include(<linux/io_uring.h>)
+#            define LZ_HAS_IO_URING
+#        endif // __has_include(<linux/io_uring.h>)
+#    endif // defined(__linux__) && defined(__has_include)
+
+#    ifdef LZ_HAS_IO_URING
+#        include <algorithm>
+#        include <cerrno>
+#        include <cstdint>
+#        include <cstring>
+#        include <linux/io_uring.h>
+#        include <sys/mman.h>
+#        include <sys/syscall.h>
+#        include <sys/uio.h>
+#        include <unistd.h>
+
+namespace lz {
+namespace internal {
+// A minimal io_uring, driven through the system calls directly so that liburing is not needed. It only submits reads, from
+// a single thread. If the kernel does not support io_uring, or it is disabled, `open` returns false
+class IoUring {
+    int _fileDescriptor{ -1 };
+    void* _submissionRing{ MAP_FAILED };
+    std::size_t _submissionRingSize{};
+    void* _completionRing{ MAP_FAILED };
+    std::size_t _completionRingSize{};
+    io_uring_sqe* _entries{ static_cast<io_uring_sqe*>(MAP_FAILED) };
+    std::size_t _entriesSize{};
+
+    unsigned* _submissionTail{};
+    unsigned* _submissionMask{};
+    unsigned* _submissionArray{};
+    unsigned* _completionHead{};
+    unsigned* _completionTail{};
+    unsigned* _completionMask{};
+    io_uring_cqe* _completions{};
+
+    template<class T>
+    static T* at(void* ring, const std::uint32_t offset) noexcept {
+        return reinterpret_cast<T*>(static_cast<char*>(ring) + offset);
+    }
+
+    static void* map(const std::size_t size, const int fileDescriptor, const off_t offset) noexcept {
+        return ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fileDescriptor, offset);
+    }
+
+    int enter(const unsigned toSubmit, const unsigned minComplete, const unsigned flags) const noexcept {
+        return static_cast<int>(::syscall(__NR_io_uring_enter, _fileDescriptor, toSubmit, minComplete, flags, nullptr, 0));
+    }
+
+    void close() noexcept {
+        if (_entries != MAP_FAILED) {
+            ::munmap(_entries, _entriesSize);
+        }
+        if (_completionRing != MAP_FAILED && _completionRing != _submissionRing) {
+            ::munmap(_completionRing, _completionRingSize);
+        }
+        if (_submissionRing != MAP_FAILED) {
+            ::munmap(_submissionRing, _submissionRingSize);
+        }
+        if (_fileDescriptor >= 0) {
+            ::close(_fileDescriptor);
+        }
+    }
+
+public:
+    IoUring() = default;
+
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    ~IoUring() {
+        close();
+    }
+
+    bool open(const unsigned entries) noexcept {
+        io_uring_params params{};
+        _fileDescriptor = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (_fileDescriptor < 0) {
+            return false;
+        }
+        _submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        _completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap) {
+            _submissionRingSize = (std::max)(_submissionRingSize, _completionRingSize);
+        }
+        _submissionRing = map(_submissionRingSize, _fileDescriptor, IORING_OFF_SQ_RING);
+        if (_submissionRing == MAP_FAILED) {
+            return false;
+        }
+        _completionRing = singleMap ? _submissionRing : map(_completionRingSize, _fileDescriptor, IORING_OFF_CQ_RING);
+        if (_completionRing == MAP_FAILED) {
+            return false;
+        }
+        _entriesSize = params.sq_entries * sizeof(io_uring_sqe);
+        _entries = static_cast<io_uring_sqe*>(map(_entriesSize, _fileDescriptor, IORING_OFF_SQES));
+        if (_entries == MAP_FAILED) {
+            return false;
+        }
+        _submissionTail = at<unsigned>(_submissionRing, params.sq_off.tail);
+        _submissionMask = at<unsigned>(_submissionRing, params.sq_off.ring_mask);
+        _submissionArray = at<unsigned>(_submissionRing, params.sq_off.array);
+        _completionHead = at<unsigned>(_completionRing, params.cq_off.head);
+        _completionTail = at<unsigned>(_completionRing, params.cq_off.tail);
+        _completionMask = at<unsigned>(_completionRing, params.cq_off.ring_mask);
+        _completions = at<io_uring_cqe>(_completionRing, params.cq_off.cqes);
+        return true;
+    }
+
+    // Submits a read of `vector` at `offset` of `fileDescriptor`. Returns a negative errno if submitting failed
+    int submitRead(const int fileDescriptor, const iovec* vector, const std::uint64_t offset,
+                   const std::uint64_t userData) noexcept {
+        const unsigned tail = *_submissionTail;
+        const unsigned index = tail & *_submissionMask;
+        io_uring_sqe& entry = _entries[index];
+        std::memset(&entry, 0, sizeof entry);
+        entry.opcode = IORING_OP_READV;
+        entry.fd = fileDescriptor;
+        entry.addr = reinterpret_cast<std::uint64_t>(vector);
+        entry.len = 1;
+        entry.off = offset;
+        entry.user_data = userData;
+        _submissionArray[index] = index;
+        // The kernel may only see the new tail after the entry is written
+        __atomic_store_n(_submissionTail, tail + 1, __ATOMIC_RELEASE);
+        int result;
+        while ((result = enter(1, 0, 0)) < 0 && errno == EINTR) {
+        }
+        return result < 0 ? -errno : 0;
+    }
+
+    // Waits for the next completed read. Returns false with `errno` set if waiting failed
+    bool waitCompletion(io_uring_cqe& completion) noexcept {
+        while (true) {
+            const unsigned head = *_completionHead;
+            if (head != __atomic_load_n(_completionTail, __ATOMIC_ACQUIRE)) {
+                completion = _completions[head & *_completionMask];
+                __atomic_store_n(_completionHead, head + 1, __ATOMIC_RELEASE);
+                return true;
+            }
+            if (enter(0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR) {
+                return false;
+            }
+        }
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#    endif // LZ_HAS_IO_URING
+
+#endif // LZ_IO_URING_HPP
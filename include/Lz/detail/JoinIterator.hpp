@@ -3,6 +3,7 @@
 #ifndef LZ_JOIN_ITERATOR_HPP
 #define LZ_JOIN_ITERATOR_HPP
 
+#include "BasicIteratorView.hpp"
 #include "LzTools.hpp"
 
 #ifdef LZ_STANDALONE
@@ -49,22 +50,47 @@ public:
 private:
     Iterator _iterator{};
     mutable std::string _delimiter{};
-#if defined(LZ_HAS_FORMAT) || !defined(LZ_STANDALONE)
+    // Declared regardless of LZ_STANDALONE, so that the layout of this class is the same in every translation unit, also when
+    // some of them are compiled with LZ_STANDALONE and others are not
     std::string _fmt{};
-#endif
+    bool _isDefaultFormat{};
     mutable bool _isIteratorTurn{ true };
 
-    reference deref(std::false_type /* isSameContainerTypeString */) const {
-        if (_isIteratorTurn) {
+    std::string format(JoinStrategyTag<JoinStrategy::format>) const {
 #ifdef LZ_STANDALONE
 #ifdef LZ_HAS_FORMAT
-            return std::format(_fmt.c_str(), *_iterator);
+        auto&& value = *_iterator;
+        return std::vformat(_fmt, std::make_format_args(value));
 #else
-            return toStringSpecialized(std::is_arithmetic<ContainerType>(), *_iterator);
+        return toStringSpecialized(std::is_arithmetic<ContainerType>(), *_iterator);
 #endif // LZ_HAS_FORMAT
 #else
-            return fmt::format(_fmt.c_str(), *_iterator);
+        return fmt::format(LZ_FMT_RUNTIME(_fmt), *_iterator);
 #endif // LZ_STANDALONE
+    }
+
+    // Integers and strings don't need to be formatted with the default format, and most integers fit in the small string buffer,
+    // so these don't allocate either
+    std::string format(JoinStrategyTag<JoinStrategy::integers>) const {
+        if (!_isDefaultFormat) {
+            return format(JoinStrategyTag<JoinStrategy::format>());
+        }
+        std::string result;
+        appendInteger(result, *_iterator);
+        return result;
+    }
+
+    std::string format(JoinStrategyTag<JoinStrategy::strings>) const {
+        if (!_isDefaultFormat) {
+            return format(JoinStrategyTag<JoinStrategy::format>());
+        }
+        auto&& string = *_iterator;
+        return std::string(string.data(), string.size());
+    }
+
+    reference deref(std::false_type /* isSameContainerTypeString */) const {
+        if (_isIteratorTurn) {
+            return format(JoinStrategyOf<Iterator>());
         }
         return _delimiter;
     }
@@ -97,6 +123,7 @@ public:
         _iterator(std::move(iterator)),
         _delimiter(std::move(delimiter)),
         _fmt(std::move(fmt)),
+        _isDefaultFormat(_fmt == "{}"),
         _isIteratorTurn(isIteratorTurn) {
     }
 #else
@@ -104,6 +131,8 @@ public:
     JoinIterator(Iterator iterator, std::string delimiter, const bool isIteratorTurn) :
         _iterator(std::move(iterator)),
         _delimiter(std::move(delimiter)),
+        _fmt("{}"),
+        _isDefaultFormat(true),
         _isIteratorTurn(isIteratorTurn) {
     }
 #endif // has format
@@ -126,7 +155,7 @@ public:
         return *this;
     }
 
-    LZ_CONSTEXPR_CXX_20 JoinIterator& operator++(int) {
+    LZ_CONSTEXPR_CXX_20 JoinIterator operator++(int) {
         JoinIterator tmp(*this);
         ++*this;
         return tmp;
@@ -164,7 +193,13 @@ public:
         return tmp;
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend difference_type operator-(const JoinIterator& a, const JoinIterator& b) {
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend JoinIterator operator+(const difference_type offset, const JoinIterator& iterator) {
+        return iterator + offset;
+    }
+
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend EnableIf<IsRandomAccess<I>::value, difference_type>
+    operator-(const JoinIterator& a, const JoinIterator& b) {
         LZ_ASSERT(a._delimiter == b._delimiter, "incompatible iterator types: found different delimiters");
         // distance * 2 for delimiter, - 1 for removing last delimiter
         return (a._iterator - b._iterator) * 2 - 1;
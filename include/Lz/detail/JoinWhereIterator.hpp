@@ -32,51 +32,58 @@ private:
     LZ_NO_UNIQUE_ADDRESS
     Execution _exec{};
 #endif // LZ_HAS_EXECUTION
-    mutable FunctionContainer<SelectorA> _selectorA{};
-    mutable FunctionContainer<SelectorB> _selectorB{};
-    mutable FunctionContainer<ResultSelector> _resultSelector{};
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<SelectorA> _selectorA{};
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<SelectorB> _selectorB{};
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<ResultSelector> _resultSelector{};
+
+    LZ_CONSTEXPR_CXX_20 IterB lowerBoundB(IterB from, const SelectorARetVal& toFind) const {
+        return std::lower_bound(std::move(from), _endB, toFind,
+                                [this](const ValueTypeB& b, const SelectorARetVal& val) { return _selectorB(b) < val; });
+    }
+
+    LZ_CONSTEXPR_CXX_20 bool isMatch(const IterB& iterB, const SelectorARetVal& toFind) const {
+        return iterB != _endB && !(toFind < _selectorB(*iterB)); // NOLINT
+    }
+
+    LZ_CONSTEXPR_CXX_20 void findNextSequential() {
+        for (; _iterA != _endA; ++_iterA) {
+            const SelectorARetVal toFind = _selectorA(*_iterA);
+            _iterB = lowerBoundB(std::move(_iterB), toFind);
+            if (isMatch(_iterB, toFind)) {
+                return;
+            }
+            _iterB = _beginB;
+        }
+    }
 
     LZ_CONSTEXPR_CXX_20 void findNext() {
 #ifdef LZ_HAS_EXECUTION
         if constexpr (checkForwardAndPolicies<Execution, IterA>()) {
-            std::mutex mutex;
-            _iterA = std::find_if(_exec, _iterA, _endA, [this, &mutex](const ValueType<IterA>& a) {
-                std::lock_guard guard(mutex);
-                auto&& toFind = _selectorA(a);
-                _iterB =
-                    std::lower_bound(std::move(_iterB), _endB, toFind,
-                                     [this](const ValueTypeB& b, const SelectorARetVal& val) { return _selectorB(b) < val; });
-                if (_iterB != _endB && !(toFind < _selectorB(*_iterB))) { // NOLINT
-                    return true;
-                }
-                _iterB = _beginB;
-                return false;
-            });
+            findNextSequential();
         }
         else {
-            _iterA = std::find_if(_iterA, _endA, [this](const ValueType<IterA>& a) {
-                auto&& toFind = _selectorA(a);
-                _iterB =
-                    std::lower_bound(std::move(_iterB), _endB, toFind,
-                                     [this](const ValueTypeB& b, const SelectorARetVal& val) { return _selectorB(b) < val; });
-                if (_iterB != _endB && !(toFind < _selectorB(*_iterB))) { // NOLINT
-                    return true;
-                }
-                _iterB = _beginB;
-                return false;
+            if (_iterA == _endA) {
+                return;
+            }
+            // First try to continue the run of equal keys in B for the current element of A
+            const SelectorARetVal current = _selectorA(*_iterA);
+            _iterB = lowerBoundB(std::move(_iterB), current);
+            if (isMatch(_iterB, current)) {
+                return;
+            }
+            // Every worker does its own lower_bound from the beginning of B, without any shared state, so that find_if can
+            // reduce to the first matching element of A without locking. The match in B is looked up once afterwards
+            _iterA = findIfBatched(_exec, std::next(_iterA), _endA, [this](const ValueType<IterA>& a) {
+                const SelectorARetVal toFind = _selectorA(a);
+                return isMatch(lowerBoundB(_beginB, toFind), toFind);
             });
+            _iterB = _iterA == _endA ? _beginB : lowerBoundB(_beginB, _selectorA(*_iterA));
         }
 #else
-        _iterA = std::find_if(_iterA, _endA, [this](const ValueType<IterA>& a) {
-            auto&& toFind = _selectorA(a);
-            _iterB = std::lower_bound(std::move(_iterB), _endB, toFind,
-                                      [this](const ValueTypeB& b, const SelectorARetVal& val) { return _selectorB(b) < val; });
-            if (_iterB != _endB && !(toFind < _selectorB(*_iterB))) { // NOLINT
-                return true;
-            }
-            _iterB = _beginB;
-            return false;
-        });
+        findNextSequential();
 #endif // LZ_HAS_EXECUTION
     }
 
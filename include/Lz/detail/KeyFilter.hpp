@@ -0,0 +1,213 @@
+#pragma once
+
+#ifndef LZ_KEY_FILTER_HPP
+#    define LZ_KEY_FILTER_HPP
+
+#    include "FunctionContainer.hpp"
+#    include "LzTools.hpp"
+
+#    include <algorithm>
+#    include <cmath>
+#    include <cstdint>
+#    include <memory>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+constexpr LZ_INLINE_VAR std::size_t keyFilterWordBits = 64;
+// Words per bloom filter block, 8 * 64 bits = one 64 byte cache line
+constexpr LZ_INLINE_VAR std::size_t keyFilterBlockWords = 8;
+constexpr LZ_INLINE_VAR std::size_t keyFilterBlockBits = keyFilterBlockWords * keyFilterWordBits;
+constexpr LZ_INLINE_VAR std::size_t keyFilterMaxHashCount = 16;
+} // namespace internal
+
+/**
+ * A membership prefilter over a set of integral keys, used by `lz::exceptPrefiltered` and `lz::joinWherePrefiltered` to
+ * reject keys before doing a binary search. If the keys are dense enough, a bitmap of [min, max] is used, which is exact.
+ * Otherwise a blocked bloom filter is used: every key maps to a single cache line, so a lookup is at most one cache miss.
+ * `mayContain` never returns false for a key that was inserted, but may return true for a key that was not.
+ */
+template<class Key>
+class KeyFilter {
+    static_assert(std::is_integral<Key>::value, "KeyFilter can only be used with integral keys");
+
+    std::vector<std::uint64_t> _words{};
+    std::uint64_t _min{};
+    // Amount of bits in the bitmap, or amount of blocks in the bloom filter
+    std::uint64_t _span{};
+    std::size_t _hashCount{};
+    bool _isExact{};
+
+    static std::uint64_t mix(std::uint64_t x) noexcept {
+        // splitmix64 finalizer
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    template<class BlockFunction>
+    void forEachBit(const std::uint64_t key, BlockFunction blockFunction) const {
+        const std::uint64_t hash = mix(key);
+        const std::size_t block = static_cast<std::size_t>((hash >> 32) % _span) * internal::keyFilterBlockWords;
+        const auto h1 = static_cast<std::uint32_t>(hash);
+        const std::uint32_t h2 = static_cast<std::uint32_t>(hash >> 32) | 1u;
+        for (std::size_t i = 0; i < _hashCount; ++i) {
+            const std::uint32_t bit = (h1 + static_cast<std::uint32_t>(i) * h2) % internal::keyFilterBlockBits;
+            const std::uint64_t mask = std::uint64_t{ 1 } << (bit % internal::keyFilterWordBits);
+            if (!blockFunction(block + bit / internal::keyFilterWordBits, mask)) {
+                return;
+            }
+        }
+    }
+
+public:
+    using key_type = Key;
+
+    /**
+     * Builds the filter from the keys in [begin, end).
+     * @param begin The beginning of the sequence to build the filter from.
+     * @param end The ending of the sequence to build the filter from.
+     * @param selector A function that returns the integral key of an element of the sequence.
+     * @param falsePositiveRate The accepted false positive rate of the bloom filter, in (0, 1). The lower it is, the more memory
+     * the filter uses. Ignored if the keys are dense enough for an exact bitmap.
+     */
+    template<class Iterator, class Selector>
+    KeyFilter(Iterator begin, Iterator end, Selector selector, const double falsePositiveRate) {
+        LZ_ASSERT(falsePositiveRate > 0 && falsePositiveRate < 1, "false positive rate must be in (0, 1)");
+        std::vector<std::uint64_t> keys;
+        for (; begin != end; ++begin) {
+            keys.push_back(static_cast<std::uint64_t>(static_cast<Key>(selector(*begin))));
+        }
+        if (keys.empty()) {
+            return;
+        }
+
+        constexpr double ln2 = 0.6931471805599453;
+        const double bitsPerKey = std::max(1.0, -std::log(falsePositiveRate) / (ln2 * ln2));
+        const auto bloomBits = static_cast<std::uint64_t>(std::ceil(bitsPerKey * static_cast<double>(keys.size())));
+
+        Key minKey = static_cast<Key>(keys.front());
+        Key maxKey = minKey;
+        for (const std::uint64_t key : keys) {
+            minKey = std::min(minKey, static_cast<Key>(key));
+            maxKey = std::max(maxKey, static_cast<Key>(key));
+        }
+        _min = static_cast<std::uint64_t>(minKey);
+        const std::uint64_t distance = static_cast<std::uint64_t>(maxKey) - _min;
+        _isExact = distance < bloomBits;
+
+        if (_isExact) {
+            _span = distance + 1;
+            _words.resize(static_cast<std::size_t>((_span + internal::keyFilterWordBits - 1) / internal::keyFilterWordBits));
+            for (const std::uint64_t key : keys) {
+                const std::uint64_t offset = key - _min;
+                const auto word = static_cast<std::size_t>(offset / internal::keyFilterWordBits);
+                _words[word] |= std::uint64_t{ 1 } << (offset % internal::keyFilterWordBits);
+            }
+            return;
+        }
+
+        // The optimal amount of hash functions is ln(2) * bits per key
+        const auto hashCount = static_cast<std::size_t>(std::lround(bitsPerKey * ln2));
+        _hashCount = std::min(internal::keyFilterMaxHashCount, std::max(std::size_t{ 1 }, hashCount));
+        _span = (bloomBits + internal::keyFilterBlockBits - 1) / internal::keyFilterBlockBits;
+        _words.resize(static_cast<std::size_t>(_span) * internal::keyFilterBlockWords);
+        for (const std::uint64_t key : keys) {
+            forEachBit(key, [this](const std::size_t word, const std::uint64_t mask) {
+                _words[word] |= mask;
+                return true;
+            });
+        }
+    }
+
+    KeyFilter() = default;
+
+    /**
+     * Checks whether `key` may be in the filter.
+     * @param key The key to check.
+     * @return `false` if `key` is definitely not in the filter, `true` if it may be.
+     */
+    LZ_NODISCARD bool mayContain(const Key key) const noexcept {
+        if (_words.empty()) {
+            return false;
+        }
+        const auto value = static_cast<std::uint64_t>(key);
+        if (_isExact) {
+            const std::uint64_t offset = value - _min;
+            if (offset >= _span) {
+                return false;
+            }
+            const auto word = static_cast<std::size_t>(offset / internal::keyFilterWordBits);
+            return ((_words[word] >> (offset % internal::keyFilterWordBits)) & 1u) != 0;
+        }
+        bool result = true;
+        forEachBit(value, [this, &result](const std::size_t word, const std::uint64_t mask) {
+            result = (_words[word] & mask) != 0;
+            return result;
+        });
+        return result;
+    }
+
+    //! Returns `true` if the filter is an exact bitmap, which has no false positives.
+    LZ_NODISCARD bool isExact() const noexcept {
+        return _isExact;
+    }
+
+    //! Returns the amount of memory the filter uses in bytes.
+    LZ_NODISCARD std::size_t sizeInBytes() const noexcept {
+        return _words.size() * sizeof(std::uint64_t);
+    }
+};
+
+namespace internal {
+constexpr LZ_INLINE_VAR double defaultFalsePositiveRate = 0.01;
+
+struct IdentitySelector {
+    template<class T>
+    LZ_NODISCARD constexpr T&& operator()(T&& value) const noexcept {
+        return std::forward<T>(value);
+    }
+};
+
+// Filter predicate that returns true for values that are not in [begin, end). The key filter is checked first, so that the
+// binary search is only done for the values that may be in [begin, end)
+template<class IteratorToExcept, class Compare>
+struct PrefilteredExclusionPredicate {
+    std::shared_ptr<const KeyFilter<Decay<ValueType<IteratorToExcept>>>> keyFilter;
+    IteratorToExcept begin;
+    IteratorToExcept end;
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<Compare> compare;
+
+    template<class T>
+    LZ_NODISCARD bool operator()(const T& value) const {
+        return !keyFilter->mayContain(value) || !std::binary_search(begin, end, value, compare);
+    }
+};
+
+template<class IteratorToExcept, class Compare>
+PrefilteredExclusionPredicate<IteratorToExcept, Compare>
+makePrefilteredExclusionPredicate(IteratorToExcept begin, IteratorToExcept end, Compare compare, const double falsePositiveRate) {
+    using Filter = KeyFilter<Decay<ValueType<IteratorToExcept>>>;
+    auto keyFilter = std::make_shared<const Filter>(begin, end, IdentitySelector{}, falsePositiveRate);
+    return { std::move(keyFilter), std::move(begin), std::move(end), FunctionContainer<Compare>(std::move(compare)) };
+}
+
+// Filter predicate that returns true for elements whose key may be in the key filter
+template<class Key, class Selector>
+struct KeyFilterPredicate {
+    std::shared_ptr<const KeyFilter<Key>> keyFilter;
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<Selector> selector;
+
+    template<class T>
+    LZ_NODISCARD bool operator()(const T& value) const {
+        return keyFilter->mayContain(selector(value));
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_KEY_FILTER_HPP
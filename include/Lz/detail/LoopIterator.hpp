@@ -28,6 +28,8 @@ public:
         _end(std::move(end))
     {}
 
+    constexpr LoopIterator() = default;
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
         return *_iterator;
     }
@@ -82,6 +84,10 @@ public:
         return tmp;
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend LoopIterator operator+(const difference_type offset, const LoopIterator& iterator) {
+        return iterator + offset;
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 LoopIterator operator-(const difference_type offset) const {
         LoopIterator tmp(*this);
         tmp -= offset;
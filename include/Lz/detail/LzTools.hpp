@@ -3,7 +3,9 @@
 #ifndef LZ_LZ_TOOLS_HPP
 #    define LZ_LZ_TOOLS_HPP
 
+#    include <algorithm>
 #    include <iterator>
+#    include <limits>
 #    include <tuple>
 
 #    if defined(__has_include)
@@ -26,6 +28,10 @@
 #        define LZ_MSVC _MSVC_LANG
 #    endif // _MSVC_LANG
 
+#    if defined(LZ_MSVC)
+#        include <intrin.h>
+#    endif // LZ_MSVC
+
 #    if (defined(LZ_MSVC) && (LZ_MSVC >= 201103L) && (LZ_MSVC < 201402L)) || ((__cplusplus >= 201103L) && (__cplusplus < 201402L))
 #        define LZ_HAS_CXX_11
 #    endif // end has cxx 11
@@ -48,6 +54,7 @@
 #        if defined(__cpp_constexpr_dynamic_alloc) && defined(__cpp_lib_constexpr_dynamic_alloc) &&                              \
             defined(__cpp_lib_constexpr_string) && defined(__cpp_lib_constexpr_vector) &&                                        \
             defined(__cpp_lib_constexpr_algorithms)
+#            define LZ_HAS_CONSTEXPR_CXX_20
 #            define LZ_CONSTEXPR_CXX_20 constexpr
 #        else
 #            define LZ_CONSTEXPR_CXX_20 inline
@@ -62,6 +69,20 @@
 #        define LZ_NODISCARD
 #    endif // LZ_HAS_ATTRIBUTE(nodiscard)
 
+#    if defined(__GNUC__) || defined(__clang__)
+#        define LZ_ALWAYS_INLINE __attribute__((always_inline)) inline
+#    elif defined(LZ_MSVC)
+#        define LZ_ALWAYS_INLINE __forceinline
+#    else
+#        define LZ_ALWAYS_INLINE inline
+#    endif // GNU/clang
+
+#    ifdef LZ_HAS_CXX_17
+#        define LZ_INLINE_VAR inline
+#    else // ^^^ has cxx 17 vvv !has cxx 17
+#        define LZ_INLINE_VAR
+#    endif // LZ_HAS_CXX_17
+
 #    ifdef __cpp_ref_qualifiers
 #        define LZ_HAS_REF_QUALIFIER
 #        define LZ_CONST_REF_QUALIFIER const&
@@ -69,7 +90,10 @@
 #        define LZ_CONST_REF_QUALIFIER
 #    endif // __cpp_ref_qualifiers
 
-#    if LZ_HAS_INCLUDE(<execution>) && (defined(LZ_HAS_CXX_17) && (defined(__cpp_lib_execution)))
+// <execution> is by far the most expensive header to compile that cpp-lazy includes. With LZ_MINIMAL_INCLUDES, it is left
+// out, and so are the overloads that take an execution policy. It must then be defined in every translation unit
+#    if LZ_HAS_INCLUDE(<execution>) && (defined(LZ_HAS_CXX_17) && (defined(__cpp_lib_execution))) &&                             \
+        !defined(LZ_MINIMAL_INCLUDES)
 #        define LZ_HAS_EXECUTION
 #        include <execution>
 #    endif // has execution
@@ -83,6 +107,14 @@
 #        include <concepts>
 #    endif // Have concepts
 
+// The views opt in to the std::ranges concepts, see the end of detail/BasicIteratorView.hpp
+#    if defined(LZ_HAS_CONCEPTS) && LZ_HAS_INCLUDE(<ranges>)
+#        include <ranges>
+#        ifdef __cpp_lib_ranges
+#            define LZ_HAS_RANGES
+#        endif // __cpp_lib_ranges
+#    endif // Have ranges
+
 #    ifdef __cpp_if_constexpr
 #        define LZ_CONSTEXPR_IF constexpr
 #    else
@@ -251,6 +283,10 @@ using ValueTypeIterable = typename Decay<Iterable>::value_type;
 template<class Iterable>
 using DiffTypeIterable = typename std::iterator_traits<IterTypeFromIterable<Iterable>>::difference_type;
 
+// The key type of a map that is created from `Iterable` with the key selector `KeySelectorFunc`
+template<class KeySelectorFunc, class Iterable>
+using KeyTypeIterable = Decay<FunctionReturnType<KeySelectorFunc, RefType<IterTypeFromIterable<Iterable>>>>;
+
 #    ifdef LZ_HAS_EXECUTION
 template<class T>
 struct IsSequencedPolicy : std::is_same<T, std::execution::sequenced_policy> {};
@@ -275,6 +311,38 @@ constexpr bool checkForwardAndPolicies() {
     return isSequenced;
 }
 
+// The amount of elements the parallel find algorithms below search sequentially before handing the rest of the range to the
+// parallel algorithm. Adaptors search once per increment, so for dense matches this keeps a parallel job from being launched
+// for every element, while sparse matches still get searched in parallel.
+constexpr LZ_INLINE_VAR std::ptrdiff_t sequentialFindWindow = 2048;
+
+template<class Execution, class Iterator, class UnaryPredicate>
+Iterator findIfBatched(Execution execution, Iterator first, const Iterator& last, const UnaryPredicate& predicate) {
+    for (std::ptrdiff_t i = 0; i < sequentialFindWindow; ++i, ++first) {
+        if (first == last || predicate(*first)) {
+            return first;
+        }
+    }
+    return std::find_if(execution, std::move(first), last, predicate);
+}
+
+template<class Execution, class Iterator, class BinaryPredicate>
+Iterator adjacentFindBatched(Execution execution, Iterator first, const Iterator& last, const BinaryPredicate& predicate) {
+    if (first == last) {
+        return first;
+    }
+    Iterator next = std::next(first);
+    for (std::ptrdiff_t i = 0; i < sequentialFindWindow; ++i, ++first, ++next) {
+        if (next == last) {
+            return next;
+        }
+        if (predicate(*first, *next)) {
+            return first;
+        }
+    }
+    return std::adjacent_find(execution, std::move(first), last, predicate);
+}
+
 #    endif // LZ_HAS_EXECUTION
 
 constexpr char to_string(const char c) {
@@ -355,27 +423,93 @@ struct IsForward : std::is_convertible<IterCat<Iterator>, std::forward_iterator_
 template<class Iterator>
 struct IsRandomAccess : std::is_convertible<IterCat<Iterator>, std::random_access_iterator_tag> {};
 
+template<class Iterator, class = int>
+struct HasSizeTo : std::false_type {};
+
+template<class Iterator>
+struct HasSizeTo<Iterator, decltype((void)std::declval<const Iterator&>().sizeTo(std::declval<const Iterator&>()), 0)>
+    : std::true_type {};
+
+// An iterator is sized if the distance between two of its instances can be computed without visiting every element. That is,
+// random access iterators, and iterators that define `difference_type sizeTo(const It& end) const` in O(1) or O(segments).
+template<class Iterator>
+struct IsSized : std::integral_constant<bool, IsRandomAccess<Iterator>::value || HasSizeTo<Iterator>::value> {};
+
+template<class... Iterators>
+struct IsAllSized;
+
+template<class Iterator>
+struct IsAllSized<Iterator> : IsSized<Iterator> {};
+
+template<class Iterator, class... Iterators>
+struct IsAllSized<Iterator, Iterators...>
+    : std::integral_constant<bool, IsSized<Iterator>::value && IsAllSized<Iterators...>::value> {};
+
+// Whether the call is evaluated at compile time, in which case functions that are not constexpr, such as the mem* functions or
+// a thread pool, can't be used. Always false before C++20
+constexpr bool isConstantEvaluated() noexcept {
+#    ifdef __cpp_lib_is_constant_evaluated
+    return std::is_constant_evaluated();
+#    else
+    return false;
+#    endif // __cpp_lib_is_constant_evaluated
+}
+
 template<LZ_CONCEPT_INTEGRAL Arithmetic>
 inline constexpr bool isEven(const Arithmetic value) noexcept {
     return (value % 2) == 0;
 }
 
+/**
+ * Divides `a` by `b`, rounding the magnitude of the result up. Used to compute the distance between iterators that jump
+ * `b` steps at a time, where the last jump may be a partial one.
+ */
 template<LZ_CONCEPT_INTEGRAL Arithmetic>
 inline constexpr Arithmetic roundEven(const Arithmetic a, const Arithmetic b) noexcept {
-    LZ_ASSERT(a != 0 && b != 0, "division by zero error");
-    if (b == 1) {
-        return a;
-    }
-    else if (b == -1) {
-        return -a;
-    }
-    if (isEven(a) && isEven(b)) {
+    LZ_ASSERT(b != 0, "division by zero error");
+    if (a % b == 0) {
         return static_cast<Arithmetic>(a / b);
     }
-    return static_cast<Arithmetic>(a / b) + 1;
+    return static_cast<Arithmetic>(a / b) + ((a < 0) == (b < 0) ? 1 : -1);
+}
+
+// Size of a cache line on common hardware
+constexpr LZ_INLINE_VAR std::size_t cacheLineSize = 64;
+
+// Asks the processor to load the cache line of `address`, without waiting for it. Does not fault on invalid addresses. GCC
+// regards a prefetch as free of side effects, and removes calls to functions that only prefetch, so it must always be inlined
+LZ_ALWAYS_INLINE void prefetch(const void* address) noexcept {
+#    if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#    elif defined(LZ_MSVC) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#    else
+    static_cast<void>(address);
+#    endif
 }
 } // namespace internal
 
+/**
+ * The lower and upper bound of the amount of elements a view yields. If the upper bound is unknown, `upper` is equal to
+ * `lz::unknownSize`.
+ */
+struct SizeHint {
+    std::size_t lower;
+    std::size_t upper;
+};
+
+constexpr LZ_INLINE_VAR std::size_t unknownSize = (std::numeric_limits<std::size_t>::max)();
+
+/**
+ * The materialization policy used by `to<Container>()` when the exact size of a view is not known.
+ */
+enum class MaterializePolicy {
+    //! Reserves exactly if the size is known, otherwise lets the container grow geometrically.
+    geometric,
+    //! Reserves the upper bound of the size hint (if known), fills the container and shrinks it to fit afterwards.
+    reserveUpperBound
+};
+
 #    if defined(LZ_HAS_STRING_VIEW)
 using StringView = std::string_view;
 #    elif defined(LZ_STANDALONE)
@@ -398,11 +532,281 @@ next(const internal::ExcludeIterator<Iterator>&, internal::DiffType<internal::Ex
 
 namespace internal {
 template<class Iterator>
-DiffType<Iterator> getIterLength(Iterator begin, Iterator end) {
+LZ_CONSTEXPR_CXX_20 DiffType<Iterator> getIterLengthImpl(std::true_type /* hasSizeTo */, const Iterator& begin, const Iterator& end) {
+    return begin.sizeTo(end);
+}
+
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 DiffType<Iterator> getIterLengthImpl(std::false_type /* hasSizeTo */, Iterator begin, Iterator end) {
     using lz::distance;
     using std::distance;
     return distance(std::move(begin), std::move(end));
 }
+
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 DiffType<Iterator> getIterLength(Iterator begin, Iterator end) {
+    return getIterLengthImpl(HasSizeTo<Iterator>(), std::move(begin), std::move(end));
+}
+
+// Advances `begin` by `amount`. Random access iterators jump, other iterators never go past `end`. Infinite random access
+// sequences (e.g. lz::repeat) have no meaningful `end - begin`, so the amount is not clamped for those
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 Iterator
+nextBounded(std::true_type /* isRandomAccess */, Iterator begin, const Iterator&, const DiffType<Iterator> amount) {
+    LZ_ASSERT(amount >= 0, "amount cannot be negative");
+    return begin + amount;
+}
+
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 Iterator
+nextBounded(std::false_type /* isRandomAccess */, Iterator begin, const Iterator& end, DiffType<Iterator> amount) {
+    LZ_ASSERT(amount >= 0, "amount cannot be negative");
+    for (; amount != 0 && begin != end; --amount) {
+        ++begin;
+    }
+    return begin;
+}
+
+template<class Iterator, class = int>
+struct HasSizeHintTo : std::false_type {};
+
+template<class Iterator>
+struct HasSizeHintTo<Iterator, decltype((void)std::declval<const Iterator&>().sizeHintTo(std::declval<const Iterator&>()), 0)>
+    : std::true_type {};
+
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 SizeHint
+sizeHintImpl(std::true_type /* hasSizeHintTo */, std::false_type /* isSized */, const Iterator& begin, const Iterator& end) {
+    return begin.sizeHintTo(end);
+}
+
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 SizeHint
+sizeHintImpl(std::false_type /* hasSizeHintTo */, std::false_type /* isSized */, const Iterator& begin, const Iterator& end) {
+    return { begin != end ? std::size_t{ 1 } : std::size_t{ 0 }, unknownSize };
+}
+
+template<class HasSizeHintTo, class Iterator>
+LZ_CONSTEXPR_CXX_20 SizeHint
+sizeHintImpl(HasSizeHintTo /* hasSizeHintTo */, std::true_type /* isSized */, const Iterator& begin, const Iterator& end) {
+    const auto size = static_cast<std::size_t>(getIterLength(begin, end));
+    return { size, size };
+}
+
+// Returns the lower and upper bound of the amount of elements in [begin, end), without iterating over the sequence
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 SizeHint sizeHint(const Iterator& begin, const Iterator& end) {
+    return sizeHintImpl(HasSizeHintTo<Iterator>(), std::integral_constant<bool, IsSized<Iterator>::value>(), begin, end);
+}
+
+// Size hint of an adaptor that yields at most the elements of [begin, end), e.g. filter
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 SizeHint upperBoundSizeHint(const Iterator& begin, const Iterator& end) {
+    return { begin != end ? std::size_t{ 1 } : std::size_t{ 0 }, sizeHint(begin, end).upper };
+}
+
+// Push based (internal) iteration. An iterator may implement `template<class Sink> bool forEachWhile(const It& end, Sink& sink)`
+// which feeds every element in [*this, end) to `sink` until `sink` returns false. This lets adaptors drive their underlying
+// range with a single end-check per element instead of one per layer. Returns false if the sink stopped early.
+struct SinkProbe {
+    template<class T>
+    bool operator()(T&&) const;
+};
+
+// An iterator may implement `template<class Func> void parallelForEach(const It& end, const Func& func) const`, which calls
+// `func` for every element in [*this, end) on multiple threads, for when a plain std::for_each with a parallel policy can't
+// split the range itself, for e.g. because the iterator is only forward
+template<class Iterator, class = int>
+struct HasParallelForEach : std::false_type {};
+
+template<class Iterator>
+struct HasParallelForEach<Iterator, decltype((void)std::declval<const Iterator&>().parallelForEach(
+                                                 std::declval<const Iterator&>(), std::declval<const SinkProbe&>()),
+                                             0)> : std::true_type {};
+
+template<class Iterator, class = int>
+struct HasForEachWhile : std::false_type {};
+
+template<class Iterator>
+struct HasForEachWhile<
+    Iterator, decltype((void)std::declval<Iterator&>().forEachWhile(std::declval<const Iterator&>(), std::declval<SinkProbe&>()),
+                       0)> : std::true_type {};
+
+template<class Iterator, class Sink>
+LZ_CONSTEXPR_CXX_20 bool forEachWhileImpl(std::true_type /* hasForEachWhile */, Iterator begin, const Iterator& end, Sink& sink) {
+    return begin.forEachWhile(end, sink);
+}
+
+template<class Iterator, class Sink>
+LZ_CONSTEXPR_CXX_20 bool forEachWhileImpl(std::false_type /* hasForEachWhile */, Iterator begin, const Iterator& end, Sink& sink) {
+    for (; begin != end; ++begin) {
+        if (!sink(*begin)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class Iterator, class Sink>
+LZ_CONSTEXPR_CXX_20 bool forEachWhile(Iterator begin, const Iterator& end, Sink& sink) {
+    return forEachWhileImpl(HasForEachWhile<Iterator>(), std::move(begin), end, sink);
+}
+
+// Segmented iteration. Iterators that are composed of several underlying ranges (e.g. flatten, concatenate) may implement
+// `template<class SegmentSink> void forEachSegment(const It& end, SegmentSink& sink)`, which calls `sink(localBegin, localEnd)`
+// for every underlying range in [*this, end). Algorithms can then run a tight loop over every segment.
+struct SegmentProbe {
+    template<class I>
+    void operator()(I, const I&) const;
+};
+
+template<class Iterator, class = int>
+struct HasForEachSegment : std::false_type {};
+
+template<class Iterator>
+struct HasForEachSegment<Iterator, decltype((void)std::declval<Iterator&>().forEachSegment(std::declval<const Iterator&>(),
+                                                                                            std::declval<SegmentProbe&>()),
+                                            0)> : std::true_type {};
+
+template<class Iterator, class SegmentSink>
+LZ_CONSTEXPR_CXX_20 void
+forEachSegmentImpl(std::true_type /* hasForEachSegment */, Iterator begin, const Iterator& end, SegmentSink& sink) {
+    begin.forEachSegment(end, sink);
+}
+
+template<class Iterator, class SegmentSink>
+LZ_CONSTEXPR_CXX_20 void
+forEachSegmentImpl(std::false_type /* hasForEachSegment */, Iterator begin, const Iterator& end, SegmentSink& sink) {
+    sink(std::move(begin), end);
+}
+
+template<class Iterator, class SegmentSink>
+LZ_CONSTEXPR_CXX_20 void forEachSegment(Iterator begin, const Iterator& end, SegmentSink& sink) {
+    forEachSegmentImpl(HasForEachSegment<Iterator>(), std::move(begin), end, sink);
+}
+
+template<class UnaryFunc>
+struct ForEachSink {
+    UnaryFunc& func;
+
+    template<class T>
+    LZ_CONSTEXPR_CXX_20 bool operator()(T&& value) {
+        func(std::forward<T>(value));
+        return true;
+    }
+};
+
+template<class T, class BinOp>
+struct FoldSink {
+    T& init;
+    BinOp& binOp;
+
+    template<class U>
+    LZ_CONSTEXPR_CXX_20 bool operator()(U&& value) {
+        init = binOp(std::move(init), std::forward<U>(value));
+        return true;
+    }
+};
+
+template<class UnaryPredicate, class Difference>
+struct CountIfSink {
+    UnaryPredicate& predicate;
+    Difference& count;
+
+    template<class T>
+    LZ_CONSTEXPR_CXX_20 bool operator()(T&& value) {
+        if (predicate(std::forward<T>(value))) {
+            ++count;
+        }
+        return true;
+    }
+};
+
+template<class T, class Difference>
+struct CountSink {
+    const T& toCount;
+    Difference& count;
+
+    template<class U>
+    LZ_CONSTEXPR_CXX_20 bool operator()(const U& value) {
+        if (value == toCount) {
+            ++count;
+        }
+        return true;
+    }
+};
+
+// Stops as soon as `predicate(value) != expected`
+template<class UnaryPredicate>
+struct UntilSink {
+    UnaryPredicate& predicate;
+    bool expected;
+
+    template<class T>
+    LZ_CONSTEXPR_CXX_20 bool operator()(T&& value) {
+        return static_cast<bool>(predicate(std::forward<T>(value))) == expected;
+    }
+};
+
+template<class OutputIterator>
+struct CopySink {
+    OutputIterator& outputIterator;
+
+    template<class T>
+    LZ_CONSTEXPR_CXX_20 bool operator()(T&& value) {
+        *outputIterator = std::forward<T>(value);
+        ++outputIterator;
+        return true;
+    }
+};
+
+template<class Iterator, class UnaryFunc>
+LZ_CONSTEXPR_CXX_20 void sinkForEach(Iterator begin, const Iterator& end, UnaryFunc& func) {
+    ForEachSink<UnaryFunc> sink{ func };
+    forEachWhile(std::move(begin), end, sink);
+}
+
+template<class T, class BinOp>
+struct FoldSegmentSink {
+    T& init;
+    BinOp& binOp;
+
+    template<class I>
+    LZ_CONSTEXPR_CXX_20 void operator()(I begin, const I& end) {
+        FoldSink<T, BinOp> sink{ init, binOp };
+        forEachWhile(std::move(begin), end, sink);
+    }
+};
+
+template<class Iterator, class T, class BinOp>
+LZ_CONSTEXPR_CXX_20 T sinkFold(Iterator begin, const Iterator& end, T init, BinOp binOp) {
+    FoldSegmentSink<T, BinOp> sink{ init, binOp };
+    forEachSegment(std::move(begin), end, sink);
+    return init;
+}
+
+template<class Iterator, class UnaryPredicate>
+LZ_CONSTEXPR_CXX_20 DiffType<Iterator> sinkCountIf(Iterator begin, const Iterator& end, UnaryPredicate predicate) {
+    DiffType<Iterator> count = 0;
+    CountIfSink<UnaryPredicate, DiffType<Iterator>> sink{ predicate, count };
+    forEachWhile(std::move(begin), end, sink);
+    return count;
+}
+
+template<class Iterator, class T>
+LZ_CONSTEXPR_CXX_20 DiffType<Iterator> sinkCount(Iterator begin, const Iterator& end, const T& value) {
+    DiffType<Iterator> count = 0;
+    CountSink<T, DiffType<Iterator>> sink{ value, count };
+    forEachWhile(std::move(begin), end, sink);
+    return count;
+}
+
+// Returns true if `predicate` returned `expected` for every element
+template<class Iterator, class UnaryPredicate>
+LZ_CONSTEXPR_CXX_20 bool sinkAllAre(Iterator begin, const Iterator& end, UnaryPredicate predicate, const bool expected) {
+    UntilSink<UnaryPredicate> sink{ predicate, expected };
+    return forEachWhile(std::move(begin), end, sink);
+}
 } // namespace internal
 } // namespace lz
 
@@ -6,12 +6,26 @@
 #include "FunctionContainer.hpp"
 #include "LzTools.hpp"
 
+#include <memory>
+
 namespace lz {
 namespace internal {
+template<class Function, class Sink>
+struct MapSink {
+    FunctionContainer<Function>& function;
+    Sink& sink;
+
+    template<class T>
+    LZ_CONSTEXPR_CXX_20 bool operator()(T&& value) {
+        return sink(function(std::forward<T>(value)));
+    }
+};
+
 template<LZ_CONCEPT_ITERATOR Iterator, class Function>
 class MapIterator {
     Iterator _iterator{};
-    mutable FunctionContainer<Function> _function{};
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<Function> _function{};
 
     using IterTraits = std::iterator_traits<Iterator>;
 
@@ -33,10 +47,44 @@ public:
         return _function(*_iterator);
     }
 
+    LZ_NODISCARD constexpr const Iterator& base() const noexcept {
+        return _iterator;
+    }
+
+    LZ_NODISCARD constexpr const FunctionContainer<Function>& function() const noexcept {
+        return _function;
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
         return FakePointerProxy<decltype(**this)>(**this);
     }
 
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsSized<I>::value, difference_type> sizeTo(const MapIterator& end) const {
+        return getIterLength(_iterator, end._iterator);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHintTo(const MapIterator& end) const {
+        return sizeHint(_iterator, end._iterator);
+    }
+
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool forEachWhile(const MapIterator& end, Sink& sink) {
+        MapSink<Function, Sink> mapSink{ _function, sink };
+        return internal::forEachWhile(_iterator, end._iterator, mapSink);
+    }
+
+#ifdef LZ_HAS_EXECUTION
+    // Lets the underlying iterator split [*this, end) over multiple threads, of which every thread applies the function to the
+    // elements it visits
+    template<class UnaryFunc, class I = Iterator>
+    EnableIf<HasParallelForEach<I>::value> parallelForEach(const MapIterator& end, const UnaryFunc& func) const {
+        const FunctionContainer<Function>& function = _function;
+        _iterator.parallelForEach(end._iterator,
+                                  [&function, &func](auto&& value) { func(function(std::forward<decltype(value)>(value))); });
+    }
+#endif // LZ_HAS_EXECUTION
+
     LZ_CONSTEXPR_CXX_20 MapIterator& operator++() {
         ++_iterator;
         return *this;
@@ -75,13 +123,19 @@ public:
         return tmp;
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend MapIterator operator+(const difference_type offset, const MapIterator& iterator) {
+        return iterator + offset;
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 MapIterator operator-(const difference_type offset) const {
         MapIterator tmp(*this);
         tmp -= offset;
         return tmp;
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend difference_type operator-(const MapIterator& a, const MapIterator& b) {
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend EnableIf<IsRandomAccess<I>::value, difference_type>
+    operator-(const MapIterator& a, const MapIterator& b) {
         return a._iterator - b._iterator;
     }
 
@@ -113,6 +167,167 @@ public:
         return !(a < b); // NOLINT
     }
 };
+
+// Holds the result of the function for the current element, unless the iterator is at the end
+template<class T>
+class MapCache {
+    // A union, so that the value does not need to be default constructible, and is only destroyed if it is alive
+    union {
+        T _value;
+    };
+    bool _isEngaged{ false };
+
+public:
+    LZ_CONSTEXPR_CXX_20 MapCache() noexcept {
+    }
+
+    LZ_CONSTEXPR_CXX_20 MapCache(const MapCache& other) {
+        if (other._isEngaged) {
+            emplace(other._value);
+        }
+    }
+
+    LZ_CONSTEXPR_CXX_20 MapCache(MapCache&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (other._isEngaged) {
+            emplace(std::move(other._value));
+        }
+    }
+
+    LZ_CONSTEXPR_CXX_20 MapCache& operator=(const MapCache& other) {
+        if (this != &other) {
+            reset();
+            if (other._isEngaged) {
+                emplace(other._value);
+            }
+        }
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 MapCache& operator=(MapCache&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this != &other) {
+            reset();
+            if (other._isEngaged) {
+                emplace(std::move(other._value));
+            }
+        }
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 ~MapCache() {
+        reset();
+    }
+
+    template<class U>
+    LZ_CONSTEXPR_CXX_20 void emplace(U&& value) {
+        ::new (static_cast<void*>(std::addressof(_value))) T(std::forward<U>(value));
+        _isEngaged = true;
+    }
+
+    LZ_CONSTEXPR_CXX_20 void reset() noexcept {
+        if (_isEngaged) {
+            _value.~T();
+            _isEngaged = false;
+        }
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 T& value() noexcept {
+        return _value;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 const T& value() const noexcept {
+        return _value;
+    }
+};
+
+// Like MapIterator, but calls the function once when the iterator arrives at an element and keeps the result, so that
+// dereferencing the same position more than once does not call it again. Copies of the iterator carry the result along, which
+// matters because standard algorithms copy iterators into their comparators. Because references point into the iterator, this is
+// a forward iterator at most
+template<class Iterator, class Function>
+class MapCachedIterator {
+    using IterTraits = std::iterator_traits<Iterator>;
+
+public:
+    using value_type = Decay<FunctionReturnType<FunctionContainer<Function>&, RefType<Iterator>>>;
+    using reference = const value_type&;
+    using iterator_category = typename std::common_type<std::forward_iterator_tag, typename IterTraits::iterator_category>::type;
+    using difference_type = typename IterTraits::difference_type;
+    using pointer = const value_type*;
+
+private:
+    Iterator _iterator{};
+    Iterator _end{};
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<Function> _function{};
+    MapCache<value_type> _cache{};
+
+    LZ_CONSTEXPR_CXX_20 void compute() {
+        _cache.reset();
+        if (_iterator != _end) {
+            _cache.emplace(_function(*_iterator));
+        }
+    }
+
+public:
+    LZ_CONSTEXPR_CXX_20 MapCachedIterator(Iterator iterator, Iterator end, Function function) :
+        _iterator(std::move(iterator)),
+        _end(std::move(end)),
+        _function(std::move(function)) {
+        compute();
+    }
+
+    constexpr MapCachedIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return _cache.value();
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return std::addressof(**this);
+    }
+
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsSized<I>::value, difference_type> sizeTo(const MapCachedIterator& end) const {
+        return getIterLength(_iterator, end._iterator);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHintTo(const MapCachedIterator& end) const {
+        return sizeHint(_iterator, end._iterator);
+    }
+
+    // The current result is moved into the sink, the results of the other elements are never stored in the iterator
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool forEachWhile(const MapCachedIterator& end, Sink& sink) {
+        if (_iterator == end._iterator) {
+            return true;
+        }
+        if (!sink(std::move(_cache.value()))) {
+            return false;
+        }
+        MapSink<Function, Sink> mapSink{ _function, sink };
+        return internal::forEachWhile(std::next(_iterator), end._iterator, mapSink);
+    }
+
+    LZ_CONSTEXPR_CXX_20 MapCachedIterator& operator++() {
+        ++_iterator;
+        compute();
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 MapCachedIterator operator++(int) {
+        MapCachedIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const MapCachedIterator& a, const MapCachedIterator& b) {
+        return a._iterator == b._iterator;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const MapCachedIterator& a, const MapCachedIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
 } // namespace internal
 } // namespace lz
 
@@ -0,0 +1,311 @@
+#pragma once
+
+#ifndef LZ_MERGE_ITERATOR_HPP
+#    define LZ_MERGE_ITERATOR_HPP
+
+#    include "FunctionContainer.hpp"
+#    include "LzTools.hpp"
+
+#    include <vector>
+
+namespace lz {
+namespace internal {
+// The sorted runs of a runtime amount of iterables of the same type
+template<class Iterator>
+class MergeRunsSource {
+    std::vector<std::pair<Iterator, Iterator>> _runs;
+
+public:
+    using value_type = ValueType<Iterator>;
+    using reference = RefType<Iterator>;
+    using difference_type = DiffType<Iterator>;
+    using iterator_category = typename std::common_type<std::forward_iterator_tag, IterCat<Iterator>>::type;
+
+    explicit MergeRunsSource(std::vector<std::pair<Iterator, Iterator>> runs) : _runs(std::move(runs)) {
+    }
+
+    MergeRunsSource() = default;
+
+    LZ_NODISCARD std::size_t size() const noexcept {
+        return _runs.size();
+    }
+
+    LZ_NODISCARD bool isEnd(const std::size_t run) const {
+        return _runs[run].first == _runs[run].second;
+    }
+
+    LZ_NODISCARD reference deref(const std::size_t run) const {
+        return *_runs[run].first;
+    }
+
+    void next(const std::size_t run) {
+        ++_runs[run].first;
+    }
+};
+
+// The sorted runs of a fixed amount of iterables, of which the iterator types can differ. The run to use is only known at
+// runtime, so every operation goes through a table with a function for every run
+template<class... Iterators>
+class MergeTupleSource {
+    using Tuple = std::tuple<Iterators...>;
+    using First = TupleElement<0, Tuple>;
+
+    Tuple _iterators;
+    Tuple _ends;
+
+public:
+    using value_type = ValueType<First>;
+    using reference = Conditional<IsAllSame<RefType<Iterators>...>::value, RefType<First>, value_type>;
+    using difference_type = typename std::common_type<DiffType<Iterators>...>::type;
+    using iterator_category = typename std::common_type<std::forward_iterator_tag, IterCat<Iterators>...>::type;
+
+private:
+    template<std::size_t I>
+    static bool isEndAt(const MergeTupleSource& source) {
+        return std::get<I>(source._iterators) == std::get<I>(source._ends);
+    }
+
+    template<std::size_t I>
+    static reference derefAt(const MergeTupleSource& source) {
+        return *std::get<I>(source._iterators);
+    }
+
+    template<std::size_t I>
+    static void nextAt(MergeTupleSource& source) {
+        ++std::get<I>(source._iterators);
+    }
+
+    template<std::size_t... I>
+    bool isEnd(const std::size_t run, IndexSequence<I...>) const {
+        static constexpr bool (*table[])(const MergeTupleSource&) = { &isEndAt<I>... };
+        return table[run](*this);
+    }
+
+    template<std::size_t... I>
+    reference deref(const std::size_t run, IndexSequence<I...>) const {
+        static constexpr reference (*table[])(const MergeTupleSource&) = { &derefAt<I>... };
+        return table[run](*this);
+    }
+
+    template<std::size_t... I>
+    void next(const std::size_t run, IndexSequence<I...>) {
+        static constexpr void (*table[])(MergeTupleSource&) = { &nextAt<I>... };
+        table[run](*this);
+    }
+
+public:
+    MergeTupleSource(Tuple iterators, Tuple ends) : _iterators(std::move(iterators)), _ends(std::move(ends)) {
+    }
+
+    MergeTupleSource() = default;
+
+    LZ_NODISCARD constexpr std::size_t size() const noexcept {
+        return sizeof...(Iterators);
+    }
+
+    LZ_NODISCARD bool isEnd(const std::size_t run) const {
+        return isEnd(run, MakeIndexSequence<sizeof...(Iterators)>());
+    }
+
+    LZ_NODISCARD reference deref(const std::size_t run) const {
+        return deref(run, MakeIndexSequence<sizeof...(Iterators)>());
+    }
+
+    void next(const std::size_t run) {
+        next(run, MakeIndexSequence<sizeof...(Iterators)>());
+    }
+};
+
+// Merges the runs of `Source` with a loser tree. Leaf i, for run i, is node `size + i`, and every internal node holds the run
+// that lost the match played there, so that after the winner is advanced, only the matches on the path from its leaf to the root
+// are replayed: O(log k) comparisons per element for k runs, against 2 log k for a binary heap. Equal elements are yielded in the
+// order of their runs, so the merge is stable
+template<class Source, class Compare>
+class MergeIterator {
+    Source _source{};
+    std::vector<std::size_t> _losers{};
+    std::size_t _winner{};
+    std::size_t _position{};
+    FunctionContainer<Compare> _compare{};
+
+    // Whether the head of run `a` goes before the head of run `b`. Exhausted runs lose every match
+    bool beats(const std::size_t a, const std::size_t b) const {
+        if (_source.isEnd(a)) {
+            return false;
+        }
+        if (_source.isEnd(b)) {
+            return true;
+        }
+        return a < b ? !_compare(_source.deref(b), _source.deref(a)) : _compare(_source.deref(a), _source.deref(b));
+    }
+
+    std::size_t build(const std::size_t node) {
+        const std::size_t size = _source.size();
+        if (node >= size) {
+            return node - size;
+        }
+        const std::size_t left = build(2 * node);
+        const std::size_t right = build(2 * node + 1);
+        if (beats(left, right)) {
+            _losers[node] = right;
+            return left;
+        }
+        _losers[node] = left;
+        return right;
+    }
+
+    bool isEnd() const {
+        return _source.size() == 0 || _source.isEnd(_winner);
+    }
+
+public:
+    using iterator_category = typename Source::iterator_category;
+    using value_type = typename Source::value_type;
+    using reference = typename Source::reference;
+    using pointer = FakePointerProxy<reference>;
+    using difference_type = typename Source::difference_type;
+
+    MergeIterator(Source source, Compare compare) :
+        _source(std::move(source)),
+        _losers(_source.size()),
+        _compare(std::move(compare)) {
+        if (_source.size() != 0) {
+            _winner = build(1);
+        }
+    }
+
+    MergeIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return _source.deref(_winner);
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    MergeIterator& operator++() {
+        _source.next(_winner);
+        ++_position;
+        std::size_t winner = _winner;
+        for (std::size_t node = (_source.size() + winner) / 2; node != 0; node /= 2) {
+            if (beats(_losers[node], winner)) {
+                std::swap(_losers[node], winner);
+            }
+        }
+        _winner = winner;
+        return *this;
+    }
+
+    MergeIterator operator++(int) {
+        MergeIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator==(const MergeIterator& a, const MergeIterator& b) {
+        const bool aIsEnd = a.isEnd();
+        return aIsEnd == b.isEnd() && (aIsEnd || a._position == b._position);
+    }
+
+    LZ_NODISCARD friend bool operator!=(const MergeIterator& a, const MergeIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+
+// Two runs need no tree: the next element is the head of one of them, which is chosen once per step
+template<class IteratorA, class IteratorB, class Compare>
+class MergeTwoIterator {
+    IteratorA _a{};
+    IteratorA _endA{};
+    IteratorB _b{};
+    IteratorB _endB{};
+    FunctionContainer<Compare> _compare{};
+    bool _useA{};
+
+    void choose() {
+        _useA = _b == _endB || (_a != _endA && !_compare(*_b, *_a));
+    }
+
+public:
+    using value_type = ValueType<IteratorA>;
+    using reference = Conditional<std::is_same<RefType<IteratorA>, RefType<IteratorB>>::value, RefType<IteratorA>, value_type>;
+    using pointer = FakePointerProxy<reference>;
+    using difference_type = typename std::common_type<DiffType<IteratorA>, DiffType<IteratorB>>::type;
+    using iterator_category =
+        typename std::common_type<std::forward_iterator_tag, IterCat<IteratorA>, IterCat<IteratorB>>::type;
+
+    MergeTwoIterator(IteratorA a, IteratorA endA, IteratorB b, IteratorB endB, Compare compare) :
+        _a(std::move(a)),
+        _endA(std::move(endA)),
+        _b(std::move(b)),
+        _endB(std::move(endB)),
+        _compare(std::move(compare)) {
+        choose();
+    }
+
+    MergeTwoIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        if (_useA) {
+            return *_a;
+        }
+        return *_b;
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    MergeTwoIterator& operator++() {
+        if (_useA) {
+            ++_a;
+        }
+        else {
+            ++_b;
+        }
+        choose();
+        return *this;
+    }
+
+    MergeTwoIterator operator++(int) {
+        MergeTwoIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator==(const MergeTwoIterator& a, const MergeTwoIterator& b) {
+        return a._a == b._a && a._b == b._b;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const MergeTwoIterator& a, const MergeTwoIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+
+template<class Compare, class... Iterators>
+struct MergeIterType {
+    using type = MergeIterator<MergeTupleSource<Iterators...>, Compare>;
+};
+
+template<class Compare, class IteratorA, class IteratorB>
+struct MergeIterType<Compare, IteratorA, IteratorB> {
+    using type = MergeTwoIterator<IteratorA, IteratorB, Compare>;
+};
+
+template<class Compare, class... Iterators>
+MergeIterator<MergeTupleSource<Iterators...>, Compare>
+makeMergeIterator(std::tuple<Iterators...> begin, std::tuple<Iterators...> end, Compare compare) {
+    return { MergeTupleSource<Iterators...>(std::move(begin), std::move(end)), std::move(compare) };
+}
+
+template<class Compare, class IteratorA, class IteratorB>
+MergeTwoIterator<IteratorA, IteratorB, Compare>
+makeMergeIterator(std::tuple<IteratorA, IteratorB> begin, std::tuple<IteratorA, IteratorB> end, Compare compare) {
+    return { std::get<0>(std::move(begin)), std::get<0>(end), std::get<1>(std::move(begin)), std::get<1>(end),
+             std::move(compare) };
+}
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_MERGE_ITERATOR_HPP
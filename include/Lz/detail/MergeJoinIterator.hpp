@@ -0,0 +1,122 @@
+#pragma once
+
+#ifndef LZ_MERGE_JOIN_ITERATOR_HPP
+#    define LZ_MERGE_JOIN_ITERATOR_HPP
+
+#    include "FunctionContainer.hpp"
+#    include "LzTools.hpp"
+
+namespace lz {
+namespace internal {
+template<class IterA, class IterB, class SelectorA, class SelectorB, class ResultSelector>
+class MergeJoinIterator {
+    IterA _iterA{};
+    IterA _endA{};
+    IterB _iterB{};
+    // The run of elements in B that have the same key as the current element of A
+    IterB _runBegin{};
+    IterB _runEnd{};
+    IterB _endB{};
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<SelectorA> _selectorA{};
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<SelectorB> _selectorB{};
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<ResultSelector> _resultSelector{};
+
+    LZ_CONSTEXPR_CXX_20 void toEnd() {
+        _iterA = _endA;
+        _iterB = _runBegin = _runEnd = _endB;
+    }
+
+    // Advances A and B monotonically, starting at _runEnd, until both point to elements with equal keys
+    LZ_CONSTEXPR_CXX_20 void findMatch() {
+        IterB iterB = _runEnd;
+        while (_iterA != _endA && iterB != _endB) {
+            auto&& keyA = _selectorA(*_iterA);
+            auto&& keyB = _selectorB(*iterB);
+            if (keyA < keyB) {
+                ++_iterA;
+            }
+            else if (keyB < keyA) {
+                ++iterB;
+            }
+            else {
+                _iterB = _runBegin = iterB;
+                for (++iterB; iterB != _endB && !(keyA < _selectorB(*iterB)); ++iterB) {
+                }
+                _runEnd = std::move(iterB);
+                return;
+            }
+        }
+        toEnd();
+    }
+
+public:
+    using reference = decltype(_resultSelector(*_iterA, *_iterB));
+    using value_type = Decay<reference>;
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using pointer = FakePointerProxy<reference>;
+
+    LZ_CONSTEXPR_CXX_20
+    MergeJoinIterator(IterA iterA, IterA endA, IterB iterB, IterB endB, SelectorA a, SelectorB b, ResultSelector resultSelector) :
+        _iterA(std::move(iterA)),
+        _endA(std::move(endA)),
+        _iterB(iterB),
+        _runBegin(iterB),
+        _runEnd(std::move(iterB)),
+        _endB(std::move(endB)),
+        _selectorA(std::move(a)),
+        _selectorB(std::move(b)),
+        _resultSelector(std::move(resultSelector)) {
+        findMatch();
+    }
+
+    constexpr MergeJoinIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return _resultSelector(*_iterA, *_iterB);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    LZ_CONSTEXPR_CXX_20 MergeJoinIterator& operator++() {
+        ++_iterB;
+        if (_iterB != _runEnd) {
+            return *this;
+        }
+        ++_iterA;
+        if (_iterA == _endA) {
+            toEnd();
+        }
+        // A is sorted, so the next element of A either has the same key as the run in B, or a greater one
+        else if (!(_selectorB(*_runBegin) < _selectorA(*_iterA))) {
+            _iterB = _runBegin;
+        }
+        else {
+            findMatch();
+        }
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 MergeJoinIterator operator++(int) {
+        MergeJoinIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const MergeJoinIterator& a, const MergeJoinIterator& b) {
+        return a._iterA == b._iterA && a._iterB == b._iterB;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const MergeJoinIterator& a, const MergeJoinIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_MERGE_JOIN_ITERATOR_HPP
@@ -0,0 +1,145 @@
+#pragma once
+
+#ifndef LZ_OWNING_ITERATOR_HPP
+#    define LZ_OWNING_ITERATOR_HPP
+
+#    include "LzTools.hpp"
+
+#    include <memory>
+
+namespace lz {
+namespace internal {
+// An iterator into a container that is owned by a `std::shared_ptr`, which every iterator shares. Adaptors that store these
+// iterators keep the container alive, so a chain over an owned container can outlive the expression that created it
+template<class Iterator, class Container>
+class OwningIterator {
+    using IterTraits = std::iterator_traits<Iterator>;
+
+public:
+    using reference = typename IterTraits::reference;
+    using value_type = typename IterTraits::value_type;
+    using pointer = FakePointerProxy<reference>;
+    using difference_type = typename IterTraits::difference_type;
+    using iterator_category = typename IterTraits::iterator_category;
+
+private:
+    Iterator _iterator{};
+    std::shared_ptr<Container> _owner;
+
+public:
+    OwningIterator(Iterator iterator, std::shared_ptr<Container> owner) :
+        _iterator(std::move(iterator)),
+        _owner(std::move(owner)) {
+    }
+
+    OwningIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return *_iterator;
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    LZ_NODISCARD const Iterator& base() const noexcept {
+        return _iterator;
+    }
+
+    // Loops run over the underlying iterators, which do not touch the reference count of the owner on every copy
+    template<class Sink>
+    bool forEachWhile(const OwningIterator& end, Sink& sink) const {
+        return internal::forEachWhile(_iterator, end._iterator, sink);
+    }
+
+    template<class SegmentSink>
+    void forEachSegment(const OwningIterator& end, SegmentSink& sink) const {
+        internal::forEachSegment(_iterator, end._iterator, sink);
+    }
+
+    OwningIterator& operator++() {
+        ++_iterator;
+        return *this;
+    }
+
+    OwningIterator operator++(int) {
+        OwningIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    OwningIterator& operator--() {
+        --_iterator;
+        return *this;
+    }
+
+    OwningIterator operator--(int) {
+        OwningIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    OwningIterator& operator+=(const difference_type offset) {
+        _iterator += offset;
+        return *this;
+    }
+
+    LZ_NODISCARD OwningIterator operator+(const difference_type offset) const {
+        OwningIterator tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend OwningIterator operator+(const difference_type offset, const OwningIterator& iterator) {
+        return iterator + offset;
+    }
+
+    OwningIterator& operator-=(const difference_type offset) {
+        _iterator -= offset;
+        return *this;
+    }
+
+    LZ_NODISCARD OwningIterator operator-(const difference_type offset) const {
+        OwningIterator tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    template<class I = Iterator>
+    LZ_NODISCARD friend EnableIf<IsRandomAccess<I>::value, difference_type>
+    operator-(const OwningIterator& a, const OwningIterator& b) {
+        return a._iterator - b._iterator;
+    }
+
+    LZ_NODISCARD reference operator[](const difference_type offset) const {
+        return _iterator[offset];
+    }
+
+    LZ_NODISCARD friend bool operator==(const OwningIterator& a, const OwningIterator& b) {
+        return a._iterator == b._iterator;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const OwningIterator& a, const OwningIterator& b) {
+        return !(a == b); // NOLINT
+    }
+
+    LZ_NODISCARD friend bool operator<(const OwningIterator& a, const OwningIterator& b) {
+        return a._iterator < b._iterator;
+    }
+
+    LZ_NODISCARD friend bool operator>(const OwningIterator& a, const OwningIterator& b) {
+        return b < a;
+    }
+
+    LZ_NODISCARD friend bool operator<=(const OwningIterator& a, const OwningIterator& b) {
+        return !(b < a); // NOLINT
+    }
+
+    LZ_NODISCARD friend bool operator>=(const OwningIterator& a, const OwningIterator& b) {
+        return !(a < b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_OWNING_ITERATOR_HPP
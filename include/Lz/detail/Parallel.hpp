@@ -0,0 +1,499 @@
+#pragma once
+
+#ifndef LZ_PARALLEL_HPP
+#    define LZ_PARALLEL_HPP
+
+#    include "LzTools.hpp"
+
+#    include <algorithm>
+#    include <atomic>
+#    include <condition_variable>
+#    include <exception>
+#    include <limits>
+#    include <memory>
+#    include <mutex>
+#    include <new>
+#    include <thread>
+#    include <vector>
+
+#    if defined(__linux__)
+#        include <pthread.h>
+#        include <sched.h>
+#    endif // defined(__linux__)
+
+namespace lz {
+namespace internal {
+// The minimum amount of elements a thread must process when materializing in parallel
+constexpr LZ_INLINE_VAR std::ptrdiff_t minParallelChunkSize = 2048;
+
+// The amount of threads to use for `taskCount` tasks. If `requested` is 0, all hardware threads are used
+inline std::size_t workerCount(const std::size_t requested, const std::size_t taskCount) {
+    std::size_t threads = requested;
+    if (threads == 0) {
+        threads = (std::max)(std::size_t{ 1 }, static_cast<std::size_t>(std::thread::hardware_concurrency()));
+    }
+    return (std::max)(std::size_t{ 1 }, (std::min)(threads, taskCount));
+}
+
+// Pins `thread` to the `index`-th CPU the process may run on, so that a worker stays on the same core, and with that on the same
+// NUMA node, for as long as the pool lives. Does nothing if pinning is not supported
+inline void pinThread(std::thread& thread, const std::size_t index) noexcept {
+#    if defined(__linux__)
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (::sched_getaffinity(0, sizeof allowed, &allowed) != 0 || CPU_COUNT(&allowed) == 0) {
+        return;
+    }
+    std::size_t target = index % static_cast<std::size_t>(CPU_COUNT(&allowed));
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &allowed) && target-- == 0) {
+            cpu_set_t pinned;
+            CPU_ZERO(&pinned);
+            CPU_SET(cpu, &pinned);
+            ::pthread_setaffinity_np(thread.native_handle(), sizeof pinned, &pinned);
+            return;
+        }
+    }
+#    else
+    static_cast<void>(thread);
+    static_cast<void>(index);
+#    endif // defined(__linux__)
+}
+
+// The part of the tasks of a job that still has to be done by one thread, [begin, end)
+struct TaskRange {
+    std::mutex mutex;
+    std::size_t begin{};
+    std::size_t end{};
+};
+
+class PoolJob {
+public:
+    virtual void run(std::size_t thread) = 0;
+
+protected:
+    ~PoolJob() = default;
+};
+
+// Every thread starts with an equal share of the tasks, and takes tasks from the front of its own range. Once its range is
+// empty, it steals the back half of the range of another thread, so that the threads finish at roughly the same time, even
+// if some tasks take much longer than others.
+template<class Task>
+class BulkJob final : public PoolJob {
+    const Task& _task;
+    std::unique_ptr<TaskRange[]> _ranges;
+    std::size_t _threadCount;
+    std::atomic<bool> _failed{ false };
+    std::mutex _errorMutex;
+    std::exception_ptr _error;
+
+    bool pop(const std::size_t thread, std::size_t& index) {
+        TaskRange& range = _ranges[thread];
+        std::lock_guard<std::mutex> lock(range.mutex);
+        if (range.begin == range.end) {
+            return false;
+        }
+        index = range.begin++;
+        return true;
+    }
+
+    bool steal(const std::size_t thread, std::size_t& index) {
+        for (std::size_t offset = 1; offset < _threadCount; ++offset) {
+            TaskRange& victim = _ranges[(thread + offset) % _threadCount];
+            std::size_t from;
+            std::size_t to;
+            {
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                const std::size_t remaining = victim.end - victim.begin;
+                if (remaining == 0) {
+                    continue;
+                }
+                to = victim.end;
+                from = to - (remaining + 1) / 2;
+                victim.end = from;
+            }
+            TaskRange& own = _ranges[thread];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            own.begin = from + 1;
+            own.end = to;
+            index = from;
+            return true;
+        }
+        return false;
+    }
+
+public:
+    BulkJob(const std::size_t taskCount, const std::size_t threadCount, const Task& task) :
+        _task(task),
+        _ranges(new TaskRange[threadCount]),
+        _threadCount(threadCount) {
+        for (std::size_t i = 0; i < threadCount; ++i) {
+            _ranges[i].begin = taskCount * i / threadCount;
+            _ranges[i].end = taskCount * (i + 1) / threadCount;
+        }
+    }
+
+    void run(const std::size_t thread) override {
+        std::size_t index;
+        while (!_failed.load(std::memory_order_relaxed) && (pop(thread, index) || steal(thread, index))) {
+            try {
+                _task(index);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(_errorMutex);
+                if (!_error) {
+                    _error = std::current_exception();
+                }
+                _failed.store(true, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void rethrow() const {
+        if (_error) {
+            std::rethrow_exception(_error);
+        }
+    }
+};
+} // namespace internal
+
+/**
+ * A fixed set of threads that run parallel loops, using work stealing. The threads are started once and wait for work, so
+ * unlike starting threads for every parallel algorithm, running a small loop on a pool costs microseconds. It can be passed to
+ * the parallel algorithms of this library using `lz::execution::pool(pool)`. Example:
+ * ```cpp
+ * lz::ThreadPool pool(4);
+ * auto squares = lz::map(values, [](int i) { return i * i; }).toVector(lz::execution::pool(pool));
+ * ```
+ */
+class ThreadPool {
+    std::vector<std::thread> _workers;
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    std::condition_variable _done;
+    // One loop runs at a time, other threads calling parallelFor wait for it
+    std::mutex _submitMutex;
+    internal::PoolJob* _job{ nullptr };
+    std::size_t _generation{};
+    std::size_t _active{};
+    bool _stop{ false };
+
+    static ThreadPool*& currentPool() noexcept {
+        static thread_local ThreadPool* pool = nullptr;
+        return pool;
+    }
+
+    void work(const std::size_t thread) {
+        currentPool() = this;
+        std::size_t generation = 0;
+        while (true) {
+            internal::PoolJob* job;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _wake.wait(lock, [this, generation] { return _stop || _generation != generation; });
+                if (_stop) {
+                    return;
+                }
+                generation = _generation;
+                job = _job;
+            }
+            job->run(thread);
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (--_active == 0) {
+                _done.notify_one();
+            }
+        }
+    }
+
+public:
+    /**
+     * Starts the threads of the pool.
+     * @param threadCount The amount of threads that work on a loop, including the thread that calls `parallelFor`, which
+     * works along. If 0, all hardware threads are used.
+     * @param pinThreads Whether every worker is pinned to a CPU of its own (Linux only). A loop over the same amount of tasks
+     * gives every worker the same tasks to start with, so with pinned workers, the memory a worker first wrote to in one loop
+     * (e.g. its part of a vector created by `toVector(lz::DefaultInitAllocator<T>(), lz::execution::pool(pool))`), which the
+     * kernel allocates on the NUMA node of the worker, is mostly read in later loops by the same worker, from local memory.
+     */
+    explicit ThreadPool(const std::size_t threadCount = 0, const bool pinThreads = false) {
+        const std::size_t count = internal::workerCount(threadCount, (std::numeric_limits<std::size_t>::max)());
+        _workers.reserve(count - 1);
+        for (std::size_t i = 0; i < count - 1; ++i) {
+            _workers.emplace_back([this, i] { work(i); });
+            if (pinThreads) {
+                internal::pinThread(_workers.back(), i);
+            }
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _wake.notify_all();
+        for (std::thread& worker : _workers) {
+            worker.join();
+        }
+    }
+
+    //! The amount of threads that work on a loop, including the thread that calls `parallelFor`.
+    LZ_NODISCARD std::size_t threadCount() const noexcept {
+        return _workers.size() + 1;
+    }
+
+    //! Whether the calling thread runs a task of this pool, in which case `parallelFor` runs its tasks on the calling thread.
+    LZ_NODISCARD bool isRunningTask() const noexcept {
+        return currentPool() == this;
+    }
+
+    /**
+     * Calls `task(index)` for every index in [0, `taskCount`) on the threads of the pool and the calling thread, and returns
+     * once all have been called. If called from within a task of the same pool, the tasks are run on the calling thread.
+     * @param taskCount The amount of tasks.
+     * @param task The task to run, which is called from multiple threads at the same time.
+     * @throws Anything `task` throws. After a task threw, no new tasks are started, and the first exception is rethrown once all
+     * threads are done.
+     */
+    template<class Task>
+    void parallelFor(const std::size_t taskCount, const Task& task) {
+        if (_workers.empty() || taskCount <= 1 || currentPool() == this) {
+            for (std::size_t i = 0; i < taskCount; ++i) {
+                task(i);
+            }
+            return;
+        }
+
+        std::lock_guard<std::mutex> submitLock(_submitMutex);
+        internal::BulkJob<Task> job(taskCount, threadCount(), task);
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _job = &job;
+            _active = _workers.size();
+            ++_generation;
+        }
+        _wake.notify_all();
+
+        ThreadPool* const previous = currentPool();
+        currentPool() = this;
+        job.run(_workers.size());
+        currentPool() = previous;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _done.wait(lock, [this] { return _active == 0; });
+            _job = nullptr;
+        }
+        job.rethrow();
+    }
+};
+
+/**
+ * An allocator that default initializes the elements that are constructed without arguments, instead of value initializing
+ * them. For trivial types such as `int` or `double`, `std::vector<T, lz::DefaultInitAllocator<T>> v(n)` then allocates memory
+ * without writing to it. When such a vector is filled in parallel, e.g. using `toVector(lz::DefaultInitAllocator<T>(), policy)`,
+ * every page is first written by the thread that fills it, which makes the kernel allocate it on the NUMA node of that thread,
+ * instead of on the node of the thread that created the vector. Elements that are constructed with arguments are constructed
+ * by `Allocator`.
+ * @tparam T The value type.
+ * @tparam Allocator The allocator that allocates the memory and constructs elements with arguments.
+ */
+template<class T, class Allocator = std::allocator<T>>
+class DefaultInitAllocator : public Allocator {
+    using Traits = std::allocator_traits<Allocator>;
+
+public:
+    using value_type = T;
+
+    template<class U>
+    struct rebind {
+        using other = DefaultInitAllocator<U, typename Traits::template rebind_alloc<U>>;
+    };
+
+    DefaultInitAllocator() = default;
+
+    DefaultInitAllocator(const Allocator& allocator) noexcept : Allocator(allocator) { // NOLINT
+    }
+
+    template<class U, class OtherAllocator>
+    DefaultInitAllocator(const DefaultInitAllocator<U, OtherAllocator>& other) noexcept : // NOLINT
+        Allocator(static_cast<const OtherAllocator&>(other)) {
+    }
+
+    template<class U>
+    void construct(U* pointer) noexcept(std::is_nothrow_default_constructible<U>::value) {
+        ::new (static_cast<void*>(pointer)) U;
+    }
+
+    template<class U, class... Args>
+    void construct(U* pointer, Args&&... args) {
+        Traits::construct(static_cast<Allocator&>(*this), pointer, std::forward<Args>(args)...);
+    }
+
+    template<class U, class OtherAllocator>
+    friend bool operator==(const DefaultInitAllocator& a, const DefaultInitAllocator<U, OtherAllocator>& b) noexcept {
+        return static_cast<const Allocator&>(a) == static_cast<const OtherAllocator&>(b);
+    }
+
+    template<class U, class OtherAllocator>
+    friend bool operator!=(const DefaultInitAllocator& a, const DefaultInitAllocator<U, OtherAllocator>& b) noexcept {
+        return !(a == b); // NOLINT
+    }
+};
+
+namespace execution {
+/**
+ * An execution policy that runs the parallel algorithms of this library on a `lz::ThreadPool`. It does not depend on
+ * `std::execution`, so it can be used with any standard library. Create one using `lz::execution::pool`.
+ */
+class PoolPolicy {
+    ThreadPool* _pool;
+    bool _reproducible{ false };
+
+public:
+    explicit PoolPolicy(ThreadPool& pool) noexcept : _pool(&pool) {
+    }
+
+    LZ_NODISCARD ThreadPool& pool() const noexcept {
+        return *_pool;
+    }
+
+    /**
+     * Returns a copy of this policy with which reductions (`lz::reduce`, `lz::transformReduce`, `sum`, `lz::mean` and
+     * `lz::stats`) give the same result on any amount of threads, so also on one. The sequence is then split into blocks of a
+     * fixed length, which only depend on the length of the sequence, and the results of the blocks are combined in pairs of
+     * neighbours, in the same order every time. For floating point sums this is also more accurate than a sequential sum, as
+     * the rounding errors of the blocks are not added up one after another. Random access and forward iterables are split into
+     * the same blocks, with two exceptions:
+     * - Input iterables are folded front to back on the calling thread, which is reproducible too, but can differ from the
+     *   result of the blocks.
+     * - With `LZ_FAST_MATH`, a plain sum (`lz::reduce` or `sum` with a plus) of a random access block is spread over several
+     *   lanes, while a forward block is folded front to back, so their results can differ in the last bits.
+     *
+     * Example:
+     * ```cpp
+     * // Gives the same result bit for bit as lz::reduce(values, 0., std::plus<double>(), lz::execution::pool(1).reproducible())
+     * double total = lz::reduce(values, 0., std::plus<double>(), lz::execution::pool().reproducible());
+     * ```
+     * @return A reproducible copy of this policy.
+     */
+    LZ_NODISCARD PoolPolicy reproducible() const noexcept {
+        PoolPolicy policy(*this);
+        policy._reproducible = true;
+        return policy;
+    }
+
+    //! Whether reductions with this policy give the same result on any amount of threads.
+    LZ_NODISCARD bool isReproducible() const noexcept {
+        return _reproducible;
+    }
+};
+
+/**
+ * Returns an execution policy that runs on `pool`, which must outlive the algorithms that use it.
+ * @param pool The pool to run on.
+ * @return An execution policy.
+ */
+LZ_NODISCARD inline PoolPolicy pool(ThreadPool& pool) noexcept {
+    return PoolPolicy(pool);
+}
+
+/**
+ * Returns an execution policy that runs on a pool with `threadCount` threads, which is shared by the whole program. The pool
+ * is started the first time it is asked for, and is stopped at exit.
+ * @param threadCount The amount of threads, including the calling thread. If 0, all hardware threads are used.
+ * @return An execution policy.
+ */
+LZ_NODISCARD inline PoolPolicy pool(const std::size_t threadCount = 0) {
+    static std::mutex mutex;
+    static std::vector<std::unique_ptr<ThreadPool>> pools;
+
+    const std::size_t count = internal::workerCount(threadCount, (std::numeric_limits<std::size_t>::max)());
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const std::unique_ptr<ThreadPool>& existing : pools) {
+        if (existing->threadCount() == count) {
+            return PoolPolicy(*existing);
+        }
+    }
+    pools.emplace_back(new ThreadPool(count));
+    return PoolPolicy(*pools.back());
+}
+} // namespace execution
+
+namespace internal {
+// The amount of blocks of at least minParallelChunkSize elements [0, length) is split into. There are a few blocks per thread,
+// so that threads that are done early can steal some of the work of others.
+inline std::size_t parallelBlockCount(const ThreadPool& pool, const std::size_t length) noexcept {
+    constexpr std::size_t blocksPerThread = 4;
+    const std::size_t maxBlocks = length / static_cast<std::size_t>(minParallelChunkSize);
+    return (std::max)(std::size_t{ 1 }, (std::min)(maxBlocks, pool.threadCount() * blocksPerThread));
+}
+
+// Splits [0, length) into `blockCount` equally sized blocks and calls `blockFn(block, from, to)` for every block on `pool`
+template<class BlockFn>
+void parallelForBlocks(ThreadPool& pool, const std::size_t length, const std::size_t blockCount, const BlockFn& blockFn) {
+    pool.parallelFor(blockCount, [&](const std::size_t block) {
+        blockFn(block, length * block / blockCount, length * (block + 1) / blockCount);
+    });
+}
+
+// Splits [0, length) into blocks and calls `blockFn(from, to)` for every block on `pool`
+template<class BlockFn>
+void parallelForBlocks(ThreadPool& pool, const std::size_t length, const BlockFn& blockFn) {
+    parallelForBlocks(pool, length, parallelBlockCount(pool, length),
+                      [&](std::size_t /* block */, const std::size_t from, const std::size_t to) { blockFn(from, to); });
+}
+
+template<class Iterator, class OutputIterator>
+void poolCopy(std::true_type /* isRandomAccess */, const Iterator& begin, const Iterator& end, const OutputIterator& out,
+              ThreadPool& pool) {
+    using Diff = DiffType<Iterator>;
+    using OutDiff = DiffType<OutputIterator>;
+    parallelForBlocks(pool, static_cast<std::size_t>(end - begin), [&](const std::size_t from, const std::size_t to) {
+        std::copy(begin + static_cast<Diff>(from), begin + static_cast<Diff>(to), out + static_cast<OutDiff>(from));
+    });
+}
+
+template<class Iterator, class OutputIterator>
+void poolCopy(std::false_type /* isRandomAccess */, const Iterator& begin, const Iterator& end, const OutputIterator& out,
+              ThreadPool&) {
+    std::copy(begin, end, out);
+}
+
+template<class Iterator, class OutputIterator, class TransformFunc>
+void poolTransform(std::true_type /* isRandomAccess */, const Iterator& begin, const Iterator& end, const OutputIterator& out,
+                   const TransformFunc& transformFunc, ThreadPool& pool) {
+    using Diff = DiffType<Iterator>;
+    using OutDiff = DiffType<OutputIterator>;
+    parallelForBlocks(pool, static_cast<std::size_t>(end - begin), [&](const std::size_t from, const std::size_t to) {
+        std::transform(begin + static_cast<Diff>(from), begin + static_cast<Diff>(to), out + static_cast<OutDiff>(from),
+                       transformFunc);
+    });
+}
+
+template<class Iterator, class OutputIterator, class TransformFunc>
+void poolTransform(std::false_type /* isRandomAccess */, const Iterator& begin, const Iterator& end, const OutputIterator& out,
+                   const TransformFunc& transformFunc, ThreadPool&) {
+    std::transform(begin, end, out, transformFunc);
+}
+
+template<class Iterator, class UnaryFunc>
+void poolForEach(std::true_type /* isRandomAccess */, const Iterator& begin, const Iterator& end, const UnaryFunc& func,
+                 ThreadPool& pool) {
+    using Diff = DiffType<Iterator>;
+    parallelForBlocks(pool, static_cast<std::size_t>(end - begin), [&](const std::size_t from, const std::size_t to) {
+        std::for_each(begin + static_cast<Diff>(from), begin + static_cast<Diff>(to), func);
+    });
+}
+
+template<class Iterator, class UnaryFunc>
+void poolForEach(std::false_type /* isRandomAccess */, const Iterator& begin, const Iterator& end, const UnaryFunc& func,
+                 ThreadPool&) {
+    std::for_each(begin, end, func);
+}
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_PARALLEL_HPP
@@ -0,0 +1,190 @@
+#pragma once
+
+#ifndef LZ_PARALLEL_MAP_ITERATOR_HPP
+#    define LZ_PARALLEL_MAP_ITERATOR_HPP
+
+#    include "FunctionContainer.hpp"
+#    include "LzTools.hpp"
+#    include "MapIterator.hpp"
+#    include "Parallel.hpp"
+
+#    include <future>
+#    include <memory>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+// Maps [iterator, end) `window` elements at a time on a pool, and hands out the results in order. While the consumer reads the
+// results of one window, the next window is already being mapped in the background, so the consumer only waits when it is
+// faster than the pool. At most two windows are in flight: the one that is read and the one that is mapped
+template<class Iterator, class Function>
+class ParallelMapState {
+public:
+    using value_type = Decay<FunctionReturnType<FunctionContainer<Function>&, RefType<Iterator>>>;
+
+private:
+    struct Window {
+        std::vector<Iterator> inputs;
+        std::unique_ptr<MapCache<value_type>[]> results;
+    };
+
+    Iterator _iterator;
+    Iterator _end;
+    FunctionContainer<Function> _function;
+    ThreadPool* _pool;
+    std::size_t _windowSize;
+    Window _windows[2];
+    std::size_t _current{};
+    std::size_t _index{};
+    bool _isStarted{ false };
+    // Declared last, so that it is destroyed, and therefore waited for, before the windows it writes to
+    std::future<void> _pending;
+
+    static void clear(Window& window) {
+        for (std::size_t i = 0; i < window.inputs.size(); ++i) {
+            window.results[i].reset();
+        }
+        window.inputs.clear();
+    }
+
+    void mapWindow(Window& window) {
+        _pool->parallelFor(window.inputs.size(),
+                           [this, &window](const std::size_t i) { window.results[i].emplace(_function(*window.inputs[i])); });
+    }
+
+    // Collects the next inputs into `window`, and starts mapping them on the pool from a background thread, which works along
+    // on the pool like the calling thread of `ThreadPool::parallelFor` does. Within a task of the same pool, the pool is busy
+    // with the loop of that task, so the window is mapped on the calling thread once it is needed instead
+    void prefetch(Window& window) {
+        clear(window);
+        for (; window.inputs.size() < _windowSize && _iterator != _end; ++_iterator) {
+            window.inputs.push_back(_iterator);
+        }
+        if (window.inputs.empty()) {
+            return;
+        }
+        const auto launch = _pool->isRunningTask() ? std::launch::deferred : std::launch::async;
+        _pending = std::async(launch, [this, &window] { mapWindow(window); });
+    }
+
+    void await() {
+        if (!_pending.valid()) {
+            return;
+        }
+        try {
+            _pending.get();
+        }
+        catch (...) {
+            // Ends the sequence, as the window has results missing
+            clear(_windows[0]);
+            clear(_windows[1]);
+            throw;
+        }
+    }
+
+public:
+    ParallelMapState(Iterator begin, Iterator end, Function function, ThreadPool& pool, const std::size_t window) :
+        _iterator(std::move(begin)),
+        _end(std::move(end)),
+        _function(std::move(function)),
+        _pool(&pool),
+        _windowSize(window) {
+        LZ_ASSERT(window > 0, "window must be greater than 0");
+        for (Window& w : _windows) {
+            w.inputs.reserve(window);
+            w.results.reset(new MapCache<value_type>[window]);
+        }
+    }
+
+    ParallelMapState(const ParallelMapState&) = delete;
+    ParallelMapState& operator=(const ParallelMapState&) = delete;
+
+    void start() {
+        if (!_isStarted) {
+            _isStarted = true;
+            prefetch(_windows[0]);
+            await();
+            prefetch(_windows[1]);
+        }
+    }
+
+    void next() {
+        if (++_index != _windows[_current].inputs.size()) {
+            return;
+        }
+        await();
+        _current ^= 1;
+        _index = 0;
+        if (!_windows[_current].inputs.empty()) {
+            prefetch(_windows[_current ^ 1]);
+        }
+    }
+
+    value_type& current() noexcept {
+        return _windows[_current].results[_index].value();
+    }
+
+    bool isEnd() const noexcept {
+        return _windows[_current].inputs.empty();
+    }
+};
+
+template<class Iterator, class Function>
+class ParallelMapIterator {
+    using State = ParallelMapState<Iterator, Function>;
+
+    std::shared_ptr<State> _state{};
+
+    bool isEnd() const {
+        if (!_state) {
+            return true;
+        }
+        _state->start();
+        return _state->isEnd();
+    }
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = typename State::value_type;
+    using reference = value_type&;
+    using pointer = value_type*;
+    using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+
+    explicit ParallelMapIterator(std::shared_ptr<State> state) noexcept : _state(std::move(state)) {
+    }
+
+    ParallelMapIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        _state->start();
+        return _state->current();
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return std::addressof(**this);
+    }
+
+    ParallelMapIterator& operator++() {
+        _state->start();
+        _state->next();
+        return *this;
+    }
+
+    ParallelMapIterator operator++(int) {
+        ParallelMapIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator==(const ParallelMapIterator& a, const ParallelMapIterator& b) {
+        return a.isEnd() == b.isEnd();
+    }
+
+    LZ_NODISCARD friend bool operator!=(const ParallelMapIterator& a, const ParallelMapIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_PARALLEL_MAP_ITERATOR_HPP
@@ -0,0 +1,174 @@
+#pragma once
+
+#ifndef LZ_PREFETCH_ITERATOR_HPP
+#    define LZ_PREFETCH_ITERATOR_HPP
+
+#    include "../RingBuffer.hpp"
+#    include "LzTools.hpp"
+
+#    include <atomic>
+#    include <exception>
+#    include <memory>
+#    include <thread>
+
+namespace lz {
+namespace internal {
+// Runs [begin, end) on a producer thread that pushes the elements into a bounded queue, which the consumer pops them from in
+// order. The thread is started when the elements are first asked for, and is stopped and joined when the state is destroyed
+template<class Iterator>
+class PrefetchState {
+public:
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+
+private:
+    struct ProducerSink {
+        PrefetchState& state;
+
+        template<class T>
+        bool operator()(T&& element) {
+            value_type value(std::forward<T>(element));
+            // Only the consumer frees up room, so once there is room for one element, the push below cannot fail
+            while (state._queue.size() == state._queue.capacity()) {
+                if (state._isStopped.load(std::memory_order_relaxed)) {
+                    return false;
+                }
+                std::this_thread::yield();
+            }
+            state._queue.tryPush(std::move(value));
+            return true;
+        }
+    };
+
+    Iterator _begin;
+    Iterator _end;
+    SpscRingBuffer<value_type> _queue;
+    std::thread _producer{};
+    std::atomic<bool> _isProduced{ false };
+    std::atomic<bool> _isStopped{ false };
+    // Written by the producer before it sets `_isProduced`
+    std::exception_ptr _exception{};
+    value_type _current{};
+    bool _isStarted{ false };
+    bool _isEnd{ false };
+
+    void produce() {
+        try {
+            ProducerSink sink{ *this };
+            internal::forEachWhile(std::move(_begin), _end, sink);
+        }
+        catch (...) {
+            _exception = std::current_exception();
+        }
+        _isProduced.store(true, std::memory_order_release);
+    }
+
+public:
+    PrefetchState(Iterator begin, Iterator end, const std::size_t queueDepth) :
+        _begin(std::move(begin)),
+        _end(std::move(end)),
+        _queue(queueDepth) {
+    }
+
+    PrefetchState(const PrefetchState&) = delete;
+    PrefetchState& operator=(const PrefetchState&) = delete;
+
+    ~PrefetchState() {
+        _isStopped.store(true, std::memory_order_relaxed);
+        if (_producer.joinable()) {
+            _producer.join();
+        }
+    }
+
+    void start() {
+        if (!_isStarted) {
+            _isStarted = true;
+            _producer = std::thread([this] { produce(); });
+            next();
+        }
+    }
+
+    void next() {
+        while (!_queue.tryPop(_current)) {
+            if (_isProduced.load(std::memory_order_acquire)) {
+                // Elements may have been pushed between the failed pop and the load
+                if (_queue.tryPop(_current)) {
+                    return;
+                }
+                _isEnd = true;
+                if (_exception) {
+                    std::rethrow_exception(std::move(_exception));
+                }
+                return;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    value_type& current() noexcept {
+        return _current;
+    }
+
+    bool isEnd() const noexcept {
+        return _isEnd;
+    }
+};
+
+template<class Iterator>
+class PrefetchIterator {
+    using State = PrefetchState<Iterator>;
+
+    std::shared_ptr<State> _state{};
+
+    bool isEnd() const {
+        if (!_state) {
+            return true;
+        }
+        _state->start();
+        return _state->isEnd();
+    }
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = typename State::value_type;
+    using reference = value_type&;
+    using pointer = value_type*;
+    using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+
+    explicit PrefetchIterator(std::shared_ptr<State> state) noexcept : _state(std::move(state)) {
+    }
+
+    PrefetchIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        _state->start();
+        return _state->current();
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return std::addressof(**this);
+    }
+
+    PrefetchIterator& operator++() {
+        _state->start();
+        _state->next();
+        return *this;
+    }
+
+    PrefetchIterator operator++(int) {
+        PrefetchIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator==(const PrefetchIterator& a, const PrefetchIterator& b) {
+        return a.isEnd() == b.isEnd();
+    }
+
+    LZ_NODISCARD friend bool operator!=(const PrefetchIterator& a, const PrefetchIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_PREFETCH_ITERATOR_HPP
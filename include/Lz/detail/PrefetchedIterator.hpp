@@ -0,0 +1,175 @@
+#pragma once
+
+#ifndef LZ_PREFETCHED_ITERATOR_HPP
+#    define LZ_PREFETCHED_ITERATOR_HPP
+
+#    include "LzTools.hpp"
+
+#    include <memory>
+
+namespace lz {
+namespace internal {
+template<class T, class = int>
+struct HasGetPointer : std::false_type {};
+
+template<class T>
+struct HasGetPointer<T, decltype((void)std::declval<const T&>().get(), 0)>
+    : std::is_pointer<decltype(std::declval<const T&>().get())> {};
+
+// Raw pointers and smart pointers, of which the object they point to is prefetched rather than the pointer itself
+template<class T>
+struct IsPointerLike : std::integral_constant<bool, std::is_pointer<T>::value || HasGetPointer<T>::value> {};
+
+template<class T>
+const void* pointeeAddress(T* const pointer) noexcept {
+    return pointer;
+}
+
+template<class T>
+const void* pointeeAddress(const T& pointer) noexcept {
+    return pointer.get();
+}
+
+template<class Reference>
+const void* prefetchAddress(std::true_type /* isPointerLike */, Reference&& reference) noexcept {
+    return pointeeAddress(reference);
+}
+
+template<class Reference>
+const void* prefetchAddress(std::false_type /* isPointerLike */, Reference&& reference) noexcept {
+    return std::addressof(reference);
+}
+
+// Prefetches the element `distance` positions ahead whenever the iterator is incremented. The element is not read: only its
+// address is computed, e.g. `&table[index]` for a map that returns `table[index]` by reference, or the pointer that the element
+// is, if it is pointer-like
+template<class Iterator>
+class PrefetchedIterator {
+    using IterTraits = std::iterator_traits<Iterator>;
+    using IsPointee = IsPointerLike<Decay<RefType<Iterator>>>;
+
+    static_assert(IsRandomAccess<Iterator>::value, "the sequence to prefetch must be random access");
+    static_assert(std::is_lvalue_reference<RefType<Iterator>>::value || IsPointee::value,
+                  "only elements that are references or pointers can be prefetched, e.g. make the function of lz::map return "
+                  "`table[index]` by reference");
+
+    Iterator _iterator{};
+    Iterator _end{};
+    typename IterTraits::difference_type _distance{};
+
+    // Always inlined, for the same reason as `prefetch`
+    LZ_ALWAYS_INLINE void prefetchAhead() const {
+        if (_end - _iterator > _distance) {
+            prefetch(prefetchAddress(IsPointee(), *(_iterator + _distance)));
+        }
+    }
+
+public:
+    using iterator_category = typename IterTraits::iterator_category;
+    using value_type = typename IterTraits::value_type;
+    using difference_type = typename IterTraits::difference_type;
+    using reference = typename IterTraits::reference;
+    using pointer = FakePointerProxy<reference>;
+
+    PrefetchedIterator(Iterator iterator, Iterator end, const difference_type distance) :
+        _iterator(std::move(iterator)),
+        _end(std::move(end)),
+        _distance(distance) {
+    }
+
+    PrefetchedIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return *_iterator;
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    PrefetchedIterator& operator++() {
+        ++_iterator;
+        prefetchAhead();
+        return *this;
+    }
+
+    PrefetchedIterator operator++(int) {
+        PrefetchedIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    PrefetchedIterator& operator--() {
+        --_iterator;
+        return *this;
+    }
+
+    PrefetchedIterator operator--(int) {
+        PrefetchedIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    PrefetchedIterator& operator+=(const difference_type offset) {
+        _iterator += offset;
+        prefetchAhead();
+        return *this;
+    }
+
+    PrefetchedIterator& operator-=(const difference_type offset) {
+        _iterator -= offset;
+        return *this;
+    }
+
+    LZ_NODISCARD PrefetchedIterator operator+(const difference_type offset) const {
+        PrefetchedIterator tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend PrefetchedIterator operator+(const difference_type offset, const PrefetchedIterator& iterator) {
+        return iterator + offset;
+    }
+
+    LZ_NODISCARD PrefetchedIterator operator-(const difference_type offset) const {
+        PrefetchedIterator tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend difference_type operator-(const PrefetchedIterator& a, const PrefetchedIterator& b) {
+        return a._iterator - b._iterator;
+    }
+
+    LZ_NODISCARD reference operator[](const difference_type offset) const {
+        return _iterator[offset];
+    }
+
+    LZ_NODISCARD friend bool operator==(const PrefetchedIterator& a, const PrefetchedIterator& b) {
+        return a._iterator == b._iterator;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const PrefetchedIterator& a, const PrefetchedIterator& b) {
+        return !(a == b); // NOLINT
+    }
+
+    LZ_NODISCARD friend bool operator<(const PrefetchedIterator& a, const PrefetchedIterator& b) {
+        return a._iterator < b._iterator;
+    }
+
+    LZ_NODISCARD friend bool operator>(const PrefetchedIterator& a, const PrefetchedIterator& b) {
+        return b < a;
+    }
+
+    LZ_NODISCARD friend bool operator<=(const PrefetchedIterator& a, const PrefetchedIterator& b) {
+        return !(b < a); // NOLINT
+    }
+
+    LZ_NODISCARD friend bool operator>=(const PrefetchedIterator& a, const PrefetchedIterator& b) {
+        return !(a < b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_PREFETCHED_ITERATOR_HPP
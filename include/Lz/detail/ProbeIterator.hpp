@@ -0,0 +1,275 @@
+#pragma once
+
+#ifndef LZ_PROBE_ITERATOR_HPP
+#    define LZ_PROBE_ITERATOR_HPP
+
+#    include "LzTools.hpp"
+
+#    include <atomic>
+#    include <chrono>
+#    include <cstdint>
+#    include <deque>
+#    include <functional>
+#    include <mutex>
+#    include <string>
+#    include <vector>
+
+namespace lz {
+/**
+ * The counters of a probe, see `lz::probe`.
+ */
+struct ProbeSnapshot {
+    //! The name the probe was created with. Probes with the same name share their counters.
+    std::string name;
+    //! The amount of elements that were iterated past the probe.
+    std::uint64_t elements;
+    //! The time spent in the increments and dereferences of the probe, which includes all stages before it.
+    std::chrono::nanoseconds time;
+    //! The amount of times a sequence was iterated up to its end.
+    std::uint64_t runs;
+};
+
+namespace internal {
+struct ProbeRecord {
+    explicit ProbeRecord(std::string probeName) : name(std::move(probeName)) {
+    }
+
+    std::string name;
+    std::atomic<std::uint64_t> elements{ 0 };
+    std::atomic<std::uint64_t> nanoseconds{ 0 };
+    std::atomic<std::uint64_t> runs{ 0 };
+
+    ProbeSnapshot snapshot() const {
+        return { name, elements.load(std::memory_order_relaxed),
+                 std::chrono::nanoseconds(nanoseconds.load(std::memory_order_relaxed)), runs.load(std::memory_order_relaxed) };
+    }
+};
+
+// The records of all probes of the program, in the order in which their names were first used. Looking a record up takes the
+// lock, but that happens once per view, the counters themselves are relaxed atomics so that probed views can be iterated
+// from several threads
+class ProbeRegistry {
+    std::mutex _mutex;
+    std::deque<ProbeRecord> _records;
+    std::function<void(const ProbeSnapshot&)> _onFinished;
+
+public:
+    ProbeRecord& record(const char* name) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (ProbeRecord& record : _records) {
+            if (record.name == name) {
+                return record;
+            }
+        }
+        _records.emplace_back(name);
+        return _records.back();
+    }
+
+    std::vector<ProbeSnapshot> snapshot() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::vector<ProbeSnapshot> snapshots;
+        snapshots.reserve(_records.size());
+        for (const ProbeRecord& record : _records) {
+            snapshots.push_back(record.snapshot());
+        }
+        return snapshots;
+    }
+
+    void reset() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (ProbeRecord& record : _records) {
+            record.elements.store(0, std::memory_order_relaxed);
+            record.nanoseconds.store(0, std::memory_order_relaxed);
+            record.runs.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void onFinished(std::function<void(const ProbeSnapshot&)> callback) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _onFinished = std::move(callback);
+    }
+
+    void finished(ProbeRecord& record) {
+        record.runs.fetch_add(1, std::memory_order_relaxed);
+        std::function<void(const ProbeSnapshot&)> callback;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            callback = _onFinished;
+        }
+        if (callback) {
+            callback(record.snapshot());
+        }
+    }
+};
+
+inline ProbeRegistry& probeRegistry() {
+    static ProbeRegistry registry;
+    return registry;
+}
+
+// Whether the probes of this translation unit record. It is a defaulted template parameter of the functions that create probes,
+// so that translation units with and without `LZ_PROBES` instantiate different functions, while the type of a probe is the same
+#    ifdef LZ_PROBES
+using ProbesEnabled = std::true_type;
+#    else
+using ProbesEnabled = std::false_type;
+#    endif // LZ_PROBES
+
+inline ProbeRecord* probeRecord(const char* name, std::true_type /* enabled */) {
+    return &probeRegistry().record(name);
+}
+
+inline ProbeRecord* probeRecord(const char*, std::false_type /* enabled */) {
+    return nullptr;
+}
+
+// Adds the time between its construction and destruction to a record
+class ProbeTimer {
+    ProbeRecord& _record;
+    std::chrono::steady_clock::time_point _start;
+
+public:
+    explicit ProbeTimer(ProbeRecord& record) : _record(record), _start(std::chrono::steady_clock::now()) {
+    }
+
+    ProbeTimer(const ProbeTimer&) = delete;
+    ProbeTimer& operator=(const ProbeTimer&) = delete;
+
+    ~ProbeTimer() {
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start);
+        _record.nanoseconds.fetch_add(static_cast<std::uint64_t>(elapsed.count()), std::memory_order_relaxed);
+    }
+};
+
+// Forwards everything to `Iterator`, and counts and times the increments and dereferences. Only the increments are counted as
+// elements, and a run is finished when an increment reaches the end. Without a record, nothing is counted
+template<class Iterator>
+class ProbeIterator {
+    using IterTraits = std::iterator_traits<Iterator>;
+
+    Iterator _iterator{};
+    Iterator _end{};
+    ProbeRecord* _record{};
+
+public:
+    using iterator_category = typename IterTraits::iterator_category;
+    using value_type = typename IterTraits::value_type;
+    using reference = typename IterTraits::reference;
+    using pointer = FakePointerProxy<reference>;
+    using difference_type = typename IterTraits::difference_type;
+
+    ProbeIterator(Iterator iterator, Iterator end, ProbeRecord* record) :
+        _iterator(std::move(iterator)),
+        _end(std::move(end)),
+        _record(record) {
+    }
+
+    ProbeIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        if (_record == nullptr) {
+            return *_iterator;
+        }
+        const ProbeTimer timer(*_record);
+        return *_iterator;
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    ProbeIterator& operator++() {
+        if (_record == nullptr) {
+            ++_iterator;
+            return *this;
+        }
+        {
+            const ProbeTimer timer(*_record);
+            ++_iterator;
+        }
+        _record->elements.fetch_add(1, std::memory_order_relaxed);
+        if (_iterator == _end) {
+            probeRegistry().finished(*_record);
+        }
+        return *this;
+    }
+
+    ProbeIterator operator++(int) {
+        ProbeIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    ProbeIterator& operator--() {
+        --_iterator;
+        return *this;
+    }
+
+    ProbeIterator operator--(int) {
+        ProbeIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    ProbeIterator& operator+=(const difference_type offset) {
+        _iterator += offset;
+        return *this;
+    }
+
+    LZ_NODISCARD ProbeIterator operator+(const difference_type offset) const {
+        ProbeIterator tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend ProbeIterator operator+(const difference_type offset, const ProbeIterator& iterator) {
+        return iterator + offset;
+    }
+
+    ProbeIterator& operator-=(const difference_type offset) {
+        _iterator -= offset;
+        return *this;
+    }
+
+    LZ_NODISCARD ProbeIterator operator-(const difference_type offset) const {
+        ProbeIterator tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend difference_type operator-(const ProbeIterator& a, const ProbeIterator& b) {
+        return a._iterator - b._iterator;
+    }
+
+    LZ_NODISCARD reference operator[](const difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    LZ_NODISCARD friend bool operator==(const ProbeIterator& a, const ProbeIterator& b) {
+        return a._iterator == b._iterator;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const ProbeIterator& a, const ProbeIterator& b) {
+        return !(a == b); // NOLINT
+    }
+
+    LZ_NODISCARD friend bool operator<(const ProbeIterator& a, const ProbeIterator& b) {
+        return a._iterator < b._iterator;
+    }
+
+    LZ_NODISCARD friend bool operator>(const ProbeIterator& a, const ProbeIterator& b) {
+        return b < a;
+    }
+
+    LZ_NODISCARD friend bool operator<=(const ProbeIterator& a, const ProbeIterator& b) {
+        return !(b < a); // NOLINT
+    }
+
+    LZ_NODISCARD friend bool operator>=(const ProbeIterator& a, const ProbeIterator& b) {
+        return !(a < b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_PROBE_ITERATOR_HPP
@@ -0,0 +1,297 @@
+#pragma once
+
+#ifndef LZ_RADIX_SORT_HPP
+#    define LZ_RADIX_SORT_HPP
+
+#    include "LzTools.hpp"
+#    include "Parallel.hpp"
+#    include "Reduce.hpp"
+
+#    include <algorithm>
+#    include <array>
+#    include <cstdint>
+#    include <cstring>
+#    include <limits>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+// Below this amount of elements, std::sort is faster than a radix sort
+constexpr LZ_INLINE_VAR std::ptrdiff_t minRadixSortLength = 1024;
+
+constexpr LZ_INLINE_VAR std::size_t radixDigitBits = 8;
+constexpr LZ_INLINE_VAR std::size_t radixBucketCount = std::size_t{ 1 } << radixDigitBits;
+
+template<std::size_t Size>
+struct UnsignedOfSize;
+
+template<>
+struct UnsignedOfSize<1> {
+    using type = std::uint8_t;
+};
+
+template<>
+struct UnsignedOfSize<2> {
+    using type = std::uint16_t;
+};
+
+template<>
+struct UnsignedOfSize<4> {
+    using type = std::uint32_t;
+};
+
+template<>
+struct UnsignedOfSize<8> {
+    using type = std::uint64_t;
+};
+
+template<class T>
+using RadixKey = typename UnsignedOfSize<sizeof(T)>::type;
+
+// Integers of up to 64 bits, and IEEE 754 floats and doubles, can be mapped onto unsigned integers of the same size that sort
+// the same
+template<class T>
+struct IsRadixSortable
+    : std::integral_constant<bool, (std::is_integral<T>::value && !std::is_same<T, bool>::value && sizeof(T) <= 8) ||
+                                       (std::is_floating_point<T>::value && std::numeric_limits<T>::is_iec559 &&
+                                        (sizeof(T) == 4 || sizeof(T) == 8))> {};
+
+// Flips the sign bit of signed integers, so that negative numbers come first
+template<class T>
+RadixKey<T> radixKey(std::true_type /* isIntegral */, const T value) noexcept {
+    using Key = RadixKey<T>;
+    constexpr Key flip = std::is_signed<T>::value ? static_cast<Key>(Key{ 1 } << (sizeof(T) * 8 - 1)) : Key{ 0 };
+    return static_cast<Key>(static_cast<Key>(value) ^ flip);
+}
+
+// Negative floats are sorted in reverse by their bits, so all their bits are flipped. Positive floats get their sign bit set,
+// so that they come after the negative ones
+template<class T>
+RadixKey<T> radixKey(std::false_type /* isIntegral */, const T value) noexcept {
+    using Key = RadixKey<T>;
+    constexpr Key sign = static_cast<Key>(Key{ 1 } << (sizeof(T) * 8 - 1));
+    Key bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    return (bits & sign) != 0 ? static_cast<Key>(~bits) : static_cast<Key>(bits | sign);
+}
+
+template<class T>
+std::size_t radixDigit(const T value, const std::size_t shift) noexcept {
+    return static_cast<std::size_t>((radixKey(std::is_integral<T>(), value) >> shift) & (radixBucketCount - 1));
+}
+
+using RadixHistogram = std::array<std::size_t, radixBucketCount>;
+
+// Runs the blocks of a sort one after another on the calling thread. Used instead of a ThreadPool when sorting sequentially,
+// so that no pool needs to be looked up or created
+struct CallingThread {
+    template<class Task>
+    void parallelFor(const std::size_t taskCount, const Task& task) const {
+        for (std::size_t i = 0; i < taskCount; ++i) {
+            task(i);
+        }
+    }
+};
+
+inline std::size_t parallelBlockCount(const CallingThread&, const std::size_t) noexcept {
+    return 1;
+}
+
+template<class Iterator, class OutputIterator>
+void poolCopy(std::true_type /* isRandomAccess */, const Iterator& begin, const Iterator& end, const OutputIterator& out,
+              const CallingThread&) {
+    std::copy(begin, end, out);
+}
+
+// One stable pass of a least significant digit radix sort from [source, source + length) to `destination`, in which the
+// elements are spread out over the buckets of their digit at `shift`. Every block counts its digits first. Then, as all
+// elements of a bucket in a block go after the same bucket in the blocks before it, the blocks can move their elements at
+// the same time.
+template<class SourceIterator, class DestinationIterator, class Pool>
+void radixPass(const SourceIterator& source, const DestinationIterator& destination, const std::size_t length,
+               const std::size_t shift, const std::size_t blockCount, Pool& pool) {
+    using SourceDiff = DiffType<SourceIterator>;
+    using DestinationDiff = DiffType<DestinationIterator>;
+    std::vector<RadixHistogram> offsets(blockCount);
+    pool.parallelFor(blockCount, [&](const std::size_t block) {
+        RadixHistogram& histogram = offsets[block];
+        histogram.fill(0);
+        for (std::size_t i = length * block / blockCount, to = length * (block + 1) / blockCount; i < to; ++i) {
+            ++histogram[radixDigit(source[static_cast<SourceDiff>(i)], shift)];
+        }
+    });
+
+    std::size_t offset = 0;
+    for (std::size_t bucket = 0; bucket < radixBucketCount; ++bucket) {
+        for (RadixHistogram& histogram : offsets) {
+            const std::size_t count = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += count;
+        }
+    }
+
+    pool.parallelFor(blockCount, [&](const std::size_t block) {
+        RadixHistogram& next = offsets[block];
+        for (std::size_t i = length * block / blockCount, to = length * (block + 1) / blockCount; i < to; ++i) {
+            auto&& value = source[static_cast<SourceDiff>(i)];
+            destination[static_cast<DestinationDiff>(next[radixDigit(value, shift)]++)] = std::move(value);
+        }
+    });
+}
+
+// Sorts [begin, end) ascending with a least significant digit radix sort, in which every pass is done in parallel on `pool`,
+// which is a ThreadPool or the CallingThread. Digits that are equal for all elements, such as the upper bytes of small numbers,
+// are found beforehand and skipped.
+template<class Iterator, class Pool>
+void radixSort(const Iterator& begin, const Iterator& end, Pool& pool) {
+    using Value = Decay<ValueType<Iterator>>;
+    using Diff = DiffType<Iterator>;
+    constexpr std::size_t digitCount = sizeof(Value) * 8 / radixDigitBits;
+    const auto length = static_cast<std::size_t>(end - begin);
+    const std::size_t blockCount = parallelBlockCount(pool, length);
+
+    std::vector<std::array<RadixHistogram, digitCount>> blockHistograms(blockCount);
+    pool.parallelFor(blockCount, [&](const std::size_t block) {
+        std::array<RadixHistogram, digitCount>& histograms = blockHistograms[block];
+        for (RadixHistogram& histogram : histograms) {
+            histogram.fill(0);
+        }
+        for (std::size_t i = length * block / blockCount, to = length * (block + 1) / blockCount; i < to; ++i) {
+            const auto key = radixKey(std::is_integral<Value>(), static_cast<Value>(begin[static_cast<Diff>(i)]));
+            for (std::size_t digit = 0; digit < digitCount; ++digit) {
+                ++histograms[digit][static_cast<std::size_t>((key >> (digit * radixDigitBits)) & (radixBucketCount - 1))];
+            }
+        }
+    });
+
+    std::vector<Value> buffer(length);
+    bool isInBuffer = false;
+    for (std::size_t digit = 0; digit < digitCount; ++digit) {
+        bool isConstant = false;
+        for (std::size_t bucket = 0; bucket < radixBucketCount && !isConstant; ++bucket) {
+            std::size_t count = 0;
+            for (const std::array<RadixHistogram, digitCount>& histograms : blockHistograms) {
+                count += histograms[digit][bucket];
+            }
+            isConstant = count == length;
+        }
+        if (isConstant) {
+            continue;
+        }
+        const std::size_t shift = digit * radixDigitBits;
+        if (isInBuffer) {
+            radixPass(buffer.begin(), begin, length, shift, blockCount, pool);
+        }
+        else {
+            radixPass(begin, buffer.begin(), length, shift, blockCount, pool);
+        }
+        isInBuffer = !isInBuffer;
+    }
+    if (isInBuffer) {
+        poolCopy(std::true_type(), buffer.begin(), buffer.end(), begin, pool);
+    }
+}
+
+// Sorts blocks in parallel, after which neighbouring blocks are merged in pairs, halving the amount of blocks every round
+template<class Iterator, class Compare>
+void mergeSort(const Iterator& begin, const Iterator& end, const Compare& compare, ThreadPool& pool) {
+    using Diff = DiffType<Iterator>;
+    const auto length = static_cast<std::size_t>(end - begin);
+    const std::size_t blockCount = parallelBlockCount(pool, length);
+    if (blockCount == 1 || pool.threadCount() == 1) {
+        std::sort(begin, end, compare);
+        return;
+    }
+    const auto blockBegin = [&](const std::size_t block) {
+        return begin + static_cast<Diff>(length * (std::min)(block, blockCount) / blockCount);
+    };
+    pool.parallelFor(blockCount, [&](const std::size_t block) { std::sort(blockBegin(block), blockBegin(block + 1), compare); });
+
+    for (std::size_t width = 1; width < blockCount; width *= 2) {
+        const std::size_t pairCount = (blockCount - width + 2 * width - 1) / (2 * width);
+        pool.parallelFor(pairCount, [&](const std::size_t pair) {
+            const std::size_t left = pair * 2 * width;
+            std::inplace_merge(blockBegin(left), blockBegin(left + width), blockBegin(left + 2 * width), compare);
+        });
+    }
+}
+
+template<class Iterator, class Compare>
+struct IsRadixSort : std::integral_constant<bool, IsRandomAccess<Iterator>::value &&
+                                                      IsRadixSortable<Decay<ValueType<Iterator>>>::value &&
+                                                      IsLess<Compare, Decay<ValueType<Iterator>>>::value> {};
+
+template<class Iterator, class Compare>
+void sortImpl(std::true_type /* isRadixSort */, const Iterator& begin, const Iterator& end, const Compare& compare,
+              ThreadPool& pool) {
+    if (end - begin < minRadixSortLength) {
+        std::sort(begin, end, compare);
+        return;
+    }
+    radixSort(begin, end, pool);
+}
+
+template<class Iterator, class Compare>
+void sortImpl(std::false_type /* isRadixSort */, const Iterator& begin, const Iterator& end, const Compare& compare,
+              ThreadPool& pool) {
+    mergeSort(begin, end, compare, pool);
+}
+
+// Sorts [begin, end) on `pool`. Arithmetic values that are sorted ascending are radix sorted, other values are merge sorted
+template<class Iterator, class Compare>
+void parallelSort(const Iterator& begin, const Iterator& end, const Compare& compare, ThreadPool& pool) {
+    sortImpl(IsRadixSort<Iterator, Compare>(), begin, end, compare, pool);
+}
+
+template<class Iterator, class Compare>
+LZ_CONSTEXPR_CXX_20 void
+sequentialSort(std::true_type /* isRadixSort */, const Iterator& begin, const Iterator& end, const Compare& compare) {
+    if (isConstantEvaluated() || end - begin < minRadixSortLength) {
+        std::sort(begin, end, compare);
+        return;
+    }
+    CallingThread callingThread;
+    radixSort(begin, end, callingThread);
+}
+
+template<class Iterator, class Compare>
+LZ_CONSTEXPR_CXX_20 void
+sequentialSort(std::false_type /* isRadixSort */, const Iterator& begin, const Iterator& end, const Compare& compare) {
+    std::sort(begin, end, compare);
+}
+
+// Sorts [begin, end) on the calling thread. Arithmetic values that are sorted ascending are radix sorted
+template<class Iterator, class Compare>
+LZ_CONSTEXPR_CXX_20 void sequentialSort(const Iterator& begin, const Iterator& end, const Compare& compare) {
+    sequentialSort(IsRadixSort<Iterator, Compare>(), begin, end, compare);
+}
+
+template<class Iterator, class Compare>
+void parallelSort(const Iterator& begin, const Iterator& end, const Compare& compare, CallingThread&) {
+    sequentialSort(begin, end, compare);
+}
+
+// Sorts `values` and removes all but the first of every run of equivalent values
+template<class T, class Compare, class Pool>
+void sortedDistinctImpl(std::vector<T>& values, const Compare& compare, Pool& pool) {
+    parallelSort(values.begin(), values.end(), compare, pool);
+    values.erase(std::unique(values.begin(), values.end(), [&compare](const T& a, const T& b) { return !compare(a, b); }),
+                 values.end());
+}
+
+// Sorts `values`, after which every run of equivalent values is counted
+template<class T, class Compare, class Pool>
+std::vector<std::pair<T, std::size_t>> sortedGroupsImpl(std::vector<T>& values, const Compare& compare, Pool& pool) {
+    parallelSort(values.begin(), values.end(), compare, pool);
+    std::vector<std::pair<T, std::size_t>> groups;
+    for (auto it = values.begin(); it != values.end();) {
+        const auto runEnd = std::upper_bound(it, values.end(), *it, compare);
+        groups.emplace_back(std::move(*it), static_cast<std::size_t>(runEnd - it));
+        it = runEnd;
+    }
+    return groups;
+}
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_RADIX_SORT_HPP
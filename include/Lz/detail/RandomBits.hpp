@@ -0,0 +1,192 @@
+#pragma once
+
+#ifndef LZ_RANDOM_BITS_HPP
+#    define LZ_RANDOM_BITS_HPP
+
+#    include "LzTools.hpp"
+
+#    include <array>
+#    include <cstdint>
+#    include <limits>
+
+#    if defined(LZ_MSVC) && defined(_M_X64)
+#        include <intrin.h>
+#    endif // defined(LZ_MSVC) && defined(_M_X64)
+
+namespace lz {
+namespace internal {
+// The upper 64 bits of the 128 bit product of a and b
+LZ_NODISCARD LZ_CONSTEXPR_CXX_14 std::uint64_t mulHigh64(const std::uint64_t a, const std::uint64_t b) noexcept {
+#    if defined(__SIZEOF_INT128__)
+    __extension__ using Uint128 = unsigned __int128;
+    return static_cast<std::uint64_t>((static_cast<Uint128>(a) * b) >> 64u);
+#    else
+    const std::uint64_t aLow = a & 0xFFFFFFFFu;
+    const std::uint64_t aHigh = a >> 32u;
+    const std::uint64_t bLow = b & 0xFFFFFFFFu;
+    const std::uint64_t bHigh = b >> 32u;
+    const std::uint64_t lowLow = aLow * bLow;
+    const std::uint64_t highLow = aHigh * bLow;
+    const std::uint64_t lowHigh = aLow * bHigh;
+    const std::uint64_t cross = (lowLow >> 32u) + (highLow & 0xFFFFFFFFu) + lowHigh;
+    return aHigh * bHigh + (highLow >> 32u) + (cross >> 32u);
+#    endif // defined(__SIZEOF_INT128__)
+}
+
+// Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3"). Every output block is a pure function of the
+// counter and the key, so any element of a random sequence can be computed without computing the ones before it
+using PhiloxBlock = std::array<std::uint32_t, 4>;
+
+LZ_NODISCARD LZ_CONSTEXPR_CXX_14 PhiloxBlock philox4x32(PhiloxBlock counter, std::uint64_t key) noexcept {
+    auto key0 = static_cast<std::uint32_t>(key);
+    auto key1 = static_cast<std::uint32_t>(key >> 32u);
+    for (int round = 0; round < 10; ++round) {
+        const std::uint64_t product0 = std::uint64_t{ 0xD2511F53u } * counter[0];
+        const std::uint64_t product1 = std::uint64_t{ 0xCD9E8D57u } * counter[2];
+        counter = { static_cast<std::uint32_t>(product1 >> 32u) ^ counter[1] ^ key0, static_cast<std::uint32_t>(product1),
+                    static_cast<std::uint32_t>(product0 >> 32u) ^ counter[3] ^ key1, static_cast<std::uint32_t>(product0) };
+        key0 += 0x9E3779B9u;
+        key1 += 0xBB67AE85u;
+    }
+    return counter;
+}
+
+// Maps 64 random bits onto [min, max]. Uses a multiplication instead of a division, the bias is at most (max - min) / 2^64
+template<class Integral>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_14 EnableIf<std::is_integral<Integral>::value, Integral>
+bitsToRange(const std::uint64_t bits, const Integral min, const Integral max) noexcept {
+    using Unsigned = typename std::make_unsigned<Integral>::type;
+    const auto span = static_cast<std::uint64_t>(static_cast<Unsigned>(static_cast<Unsigned>(max) - static_cast<Unsigned>(min)));
+    if (span == (std::numeric_limits<std::uint64_t>::max)()) {
+        return static_cast<Integral>(bits);
+    }
+    const auto offset = static_cast<Unsigned>(mulHigh64(bits, span + 1));
+    return static_cast<Integral>(static_cast<Unsigned>(static_cast<Unsigned>(min) + offset));
+}
+
+// The amount of random bits that are converted to a floating point number in [0, 1), every one of which is then equally likely
+template<class Floating, unsigned Digits = static_cast<unsigned>(std::numeric_limits<Floating>::digits)>
+struct UnitBits : std::integral_constant<unsigned, (Digits < 53 ? Digits : 53)> {};
+
+// Maps the upper bits of 64 random bits onto [0, 1)
+template<class Floating>
+LZ_NODISCARD constexpr EnableIf<std::is_floating_point<Floating>::value, Floating> bitsToUnit(const std::uint64_t bits) noexcept {
+    return static_cast<Floating>(bits >> (64u - UnitBits<Floating>::value)) /
+           static_cast<Floating>(std::uint64_t{ 1 } << UnitBits<Floating>::value);
+}
+
+// Maps 64 random bits onto [min, max)
+template<class Floating>
+LZ_NODISCARD constexpr EnableIf<std::is_floating_point<Floating>::value, Floating>
+bitsToRange(const std::uint64_t bits, const Floating min, const Floating max) noexcept {
+    return min + (max - min) * bitsToUnit<Floating>(bits);
+}
+
+constexpr unsigned countBits(const std::uint64_t value) noexcept {
+    return value == 0 ? 0 : 1 + countBits(value >> 1u);
+}
+
+// The amount of random bits a generator gives per call. Only generators of which the range is a power of two are supported, such
+// that every bit is equally likely to be set
+template<class Generator>
+struct GeneratorBits {
+    static constexpr std::uint64_t range = static_cast<std::uint64_t>((Generator::max)() - (Generator::min)());
+    static constexpr unsigned value = countBits(range);
+
+    static_assert((range & (range + 1)) == 0 && value >= 32,
+                  "the generator must produce at least 32 random bits per call, for e.g. std::mt19937 or lz::Pcg32");
+};
+
+template<class Generator>
+std::uint32_t drawBits32(Generator& generator) {
+    const auto bits = static_cast<std::uint64_t>(generator() - (Generator::min)());
+    return static_cast<std::uint32_t>(bits >> (GeneratorBits<Generator>::value - 32));
+}
+
+template<class Generator>
+std::uint64_t drawBits64(std::true_type /* is64Bits */, Generator& generator) {
+    return static_cast<std::uint64_t>(generator() - (Generator::min)());
+}
+
+template<class Generator>
+std::uint64_t drawBits64(std::false_type /* is64Bits */, Generator& generator) {
+    const std::uint64_t high = drawBits32(generator);
+    return (high << 32u) | drawBits32(generator);
+}
+
+template<class Generator>
+std::uint64_t drawBits64(Generator& generator) {
+    return drawBits64(std::integral_constant<bool, GeneratorBits<Generator>::value == 64>(), generator);
+}
+
+// Lemire's nearly divisionless method ("Fast Random Integer Generation in an Interval", 2019): a random number in [0, bound)
+// is the upper half of the product of random bits and `bound`. Only when the lower half is small, a division is done, to reject
+// the few values that would make the result biased
+template<class Generator>
+std::uint32_t boundedBits32(Generator& generator, const std::uint32_t bound) {
+    std::uint64_t product = static_cast<std::uint64_t>(drawBits32(generator)) * bound;
+    auto low = static_cast<std::uint32_t>(product);
+    if (low < bound) {
+        const std::uint32_t threshold = (0u - bound) % bound;
+        while (low < threshold) {
+            product = static_cast<std::uint64_t>(drawBits32(generator)) * bound;
+            low = static_cast<std::uint32_t>(product);
+        }
+    }
+    return static_cast<std::uint32_t>(product >> 32u);
+}
+
+template<class Generator>
+std::uint64_t boundedBits64(Generator& generator, const std::uint64_t bound) {
+    std::uint64_t bits = drawBits64(generator);
+    std::uint64_t low = bits * bound;
+    if (low < bound) {
+        const std::uint64_t threshold = (0u - bound) % bound;
+        while (low < threshold) {
+            bits = drawBits64(generator);
+            low = bits * bound;
+        }
+    }
+    return mulHigh64(bits, bound);
+}
+
+template<class Integral, class Generator>
+Integral uniformInteger(Generator& generator, const Integral min, const Integral max) {
+    using Unsigned = typename std::make_unsigned<Integral>::type;
+    const auto span = static_cast<std::uint64_t>(static_cast<Unsigned>(static_cast<Unsigned>(max) - static_cast<Unsigned>(min)));
+    std::uint64_t offset;
+    if (span < 0xFFFFFFFFu) {
+        offset = boundedBits32(generator, static_cast<std::uint32_t>(span + 1));
+    }
+    else if (span != (std::numeric_limits<std::uint64_t>::max)()) {
+        offset = boundedBits64(generator, span + 1);
+    }
+    else {
+        offset = drawBits64(generator);
+    }
+    return static_cast<Integral>(static_cast<Unsigned>(static_cast<Unsigned>(min) + static_cast<Unsigned>(offset)));
+}
+
+template<class Floating, class Generator>
+EnableIf<(UnitBits<Floating>::value <= 32), Floating> uniformUnit(Generator& generator) {
+    return bitsToUnit<Floating>(static_cast<std::uint64_t>(drawBits32(generator)) << 32u);
+}
+
+template<class Floating, class Generator>
+EnableIf<(UnitBits<Floating>::value > 32), Floating> uniformUnit(Generator& generator) {
+    return bitsToUnit<Floating>(drawBits64(generator));
+}
+
+template<class Arithmetic, class Generator>
+Arithmetic uniformValue(std::true_type /* isIntegral */, Generator& generator, const Arithmetic min, const Arithmetic max) {
+    return uniformInteger(generator, min, max);
+}
+
+template<class Arithmetic, class Generator>
+Arithmetic uniformValue(std::false_type /* isIntegral */, Generator& generator, const Arithmetic min, const Arithmetic max) {
+    return min + (max - min) * uniformUnit<Arithmetic>(generator);
+}
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_RANDOM_BITS_HPP
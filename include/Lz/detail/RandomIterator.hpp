@@ -20,15 +20,12 @@ public:
 private:
     mutable Distribution _distribution{};
     std::ptrdiff_t _current{};
-    bool _isWhileTrueLoop{};
     Generator* _generator{ nullptr };
 
 public:
-    RandomIterator(const Distribution& distribution, Generator& generator, const std::ptrdiff_t current,
-                   const bool isWhileTrueLoop) :
+    RandomIterator(const Distribution& distribution, Generator& generator, const std::ptrdiff_t current) :
         _distribution(distribution),
         _current(current),
-        _isWhileTrueLoop(isWhileTrueLoop),
         _generator(&generator) {
     }
 
@@ -55,9 +52,7 @@ public:
     }
 
     RandomIterator& operator--() noexcept {
-        if (!_isWhileTrueLoop) {
-            --_current;
-        }
+        --_current;
         return *this;
     }
 
@@ -68,9 +63,7 @@ public:
     }
 
     RandomIterator& operator+=(const difference_type offset) noexcept {
-        if (!_isWhileTrueLoop) {
-            _current += offset;
-        }
+        _current += offset;
         return *this;
     }
 
@@ -80,10 +73,12 @@ public:
         return tmp;
     }
 
+    LZ_NODISCARD friend RandomIterator operator+(const difference_type offset, const RandomIterator& iterator) noexcept {
+        return iterator + offset;
+    }
+
     RandomIterator& operator-=(const difference_type offset) noexcept {
-        if (!_isWhileTrueLoop) {
-            _current -= offset;
-        }
+        _current -= offset;
         return *this;
     }
 
@@ -94,7 +89,6 @@ public:
     }
 
     LZ_NODISCARD friend difference_type operator-(const RandomIterator& a, const RandomIterator& b) noexcept {
-        LZ_ASSERT(a._isWhileTrueLoop == b._isWhileTrueLoop, "incompatible iterator types: both must be while true or not");
         return a._current - b._current;
     }
 
@@ -103,9 +97,7 @@ public:
     }
 
     RandomIterator& operator++() noexcept {
-        if (!_isWhileTrueLoop) {
-            ++_current;
-        }
+        ++_current;
         return *this;
     }
 
@@ -116,7 +108,6 @@ public:
     }
 
     LZ_NODISCARD friend bool operator!=(const RandomIterator& a, const RandomIterator& b) noexcept {
-        LZ_ASSERT(a._isWhileTrueLoop == b._isWhileTrueLoop, "incompatible iterator types: both must be while true or not");
         return a._current != b._current;
     }
 
@@ -125,7 +116,6 @@ public:
     }
 
     LZ_NODISCARD friend bool operator<(const RandomIterator& a, const RandomIterator& b) noexcept {
-        LZ_ASSERT(a._isWhileTrueLoop == b._isWhileTrueLoop, "incompatible iterator types: both must be while true or not");
         return a._current < b._current;
     }
 
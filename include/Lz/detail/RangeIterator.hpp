@@ -3,38 +3,64 @@
 #ifndef LZ_RANGE_ITERATOR_HPP
 #    define LZ_RANGE_ITERATOR_HPP
 
-#    include <cmath>
+#    include <cstdint>
 #    include <iterator>
 
 namespace lz {
 namespace internal {
-#    ifdef __cpp_if_constexpr
-template<class ValueType>
-std::ptrdiff_t plusImpl(const ValueType difference, const ValueType step) noexcept(!std::is_floating_point_v<ValueType>) {
-    if constexpr (std::is_floating_point_v<ValueType>) {
-        return static_cast<std::ptrdiff_t>(std::ceil(difference / step));
-    }
-    else {
-        return static_cast<std::ptrdiff_t>(roundEven(difference, step));
-    }
+// The distance from `from` to `to` modulo 2^64, which is exact for integers if `to` comes after `from`, even if their
+// difference does not fit in the integer type itself
+template<class Integral>
+constexpr std::uintmax_t unsignedDistance(const Integral from, const Integral to) noexcept {
+    return static_cast<std::uintmax_t>(to) - static_cast<std::uintmax_t>(from);
+}
+
+constexpr std::uintmax_t ceilDivide(const std::uintmax_t a, const std::uintmax_t b) noexcept {
+    return a / b + (a % b == 0 ? 0 : 1);
+}
+
+// The amount of values in [start, end) with `step`
+template<class Integral>
+constexpr std::ptrdiff_t rangeLength(std::true_type /* isIntegral */, const Integral start, const Integral end,
+                                     const Integral step) noexcept {
+    return step > 0 ? (start < end ? static_cast<std::ptrdiff_t>(
+                                         ceilDivide(unsignedDistance(start, end), static_cast<std::uintmax_t>(step)))
+                                   : 0)
+                    : (end < start ? static_cast<std::ptrdiff_t>(
+                                         ceilDivide(unsignedDistance(end, start), unsignedDistance(step, Integral{ 0 })))
+                                   : 0);
 }
-#    else
-template<class ValueType>
-EnableIf<std::is_floating_point<ValueType>::value, std::ptrdiff_t> plusImpl(const ValueType difference, const ValueType step) {
-    return static_cast<std::ptrdiff_t>(std::ceil(difference / step));
+
+// Same as std::ceil, which is not constexpr, for quotients that fit in a std::ptrdiff_t
+template<class Floating>
+constexpr std::ptrdiff_t ceilToIndex(const Floating quotient) noexcept {
+    return static_cast<Floating>(static_cast<std::ptrdiff_t>(quotient)) < quotient ? static_cast<std::ptrdiff_t>(quotient) + 1
+                                                                                    : static_cast<std::ptrdiff_t>(quotient);
 }
 
-template<class ValueType>
-constexpr EnableIf<!std::is_floating_point<ValueType>::value, std::ptrdiff_t>
-plusImpl(const ValueType difference, const ValueType step) noexcept {
-    return static_cast<std::ptrdiff_t>(roundEven(difference, step));
+template<class Floating>
+constexpr std::ptrdiff_t rangeLength(std::false_type /* isIntegral */, const Floating start, const Floating end,
+                                     const Floating step) noexcept {
+    return (step > 0 ? start < end : end < start) ? ceilToIndex((end - start) / step) : 0;
 }
-#    endif // __cpp_if_constexpr
 
+// Iterates over the values `start + index * step`. Every value is computed from its index instead of by adding `step` to the
+// previous value, so floating point values don't drift, jumps and distances are exact and iterators can be compared by index.
+// Integral values are computed modulo 2^64, so that `index * step` can't overflow if the value itself fits
 template<class Arithmetic>
 class RangeIterator {
-    Arithmetic _iterator{};
+    Arithmetic _start{};
     Arithmetic _step{};
+    std::ptrdiff_t _index{};
+
+    LZ_NODISCARD constexpr Arithmetic valueAt(std::true_type /* isIntegral */, const std::ptrdiff_t index) const noexcept {
+        return static_cast<Arithmetic>(static_cast<std::uintmax_t>(_start) +
+                                       static_cast<std::uintmax_t>(index) * static_cast<std::uintmax_t>(_step));
+    }
+
+    LZ_NODISCARD constexpr Arithmetic valueAt(std::false_type /* isIntegral */, const std::ptrdiff_t index) const noexcept {
+        return static_cast<Arithmetic>(_start + static_cast<Arithmetic>(index) * _step);
+    }
 
 public:
     using iterator_category = std::random_access_iterator_tag;
@@ -43,13 +69,16 @@ public:
     using pointer = Arithmetic;
     using reference = Arithmetic;
 
-    constexpr RangeIterator(const Arithmetic iterator, const Arithmetic step) noexcept : _iterator(iterator), _step(step) {
+    constexpr RangeIterator(const Arithmetic start, const Arithmetic step, const difference_type index) noexcept :
+        _start(start),
+        _step(step),
+        _index(index) {
     }
 
     constexpr RangeIterator() = default;
 
     LZ_NODISCARD constexpr value_type operator*() const noexcept {
-        return _iterator;
+        return valueAt(std::is_integral<Arithmetic>(), _index);
     }
 
     LZ_NODISCARD constexpr pointer operator->() const noexcept {
@@ -57,7 +86,7 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_14 RangeIterator& operator++() noexcept {
-        _iterator += _step;
+        ++_index;
         return *this;
     }
 
@@ -68,7 +97,7 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_14 RangeIterator& operator--() noexcept {
-        _iterator -= _step;
+        --_index;
         return *this;
     }
 
@@ -78,65 +107,102 @@ public:
         return tmp;
     }
 
-    LZ_NODISCARD friend difference_type
-    operator-(const RangeIterator& a, const RangeIterator& b) noexcept(!std::is_floating_point<Arithmetic>::value) {
-        LZ_ASSERT(a._step == b._step, "incompatible iterator types: difference step size");
-        const auto difference = a._iterator - b._iterator;
-        return std::abs(plusImpl(static_cast<Arithmetic>(difference), a._step));
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend difference_type operator-(const RangeIterator& a, const RangeIterator& b) noexcept {
+        LZ_ASSERT(a._start == b._start && a._step == b._step, "incompatible iterator types: different start or step size");
+        return a._index - b._index;
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator[](const difference_type offset) const noexcept {
-        return *(*this + offset);
+    LZ_NODISCARD constexpr reference operator[](const difference_type offset) const noexcept {
+        return valueAt(std::is_integral<Arithmetic>(), _index + offset);
     }
 
-    constexpr RangeIterator& operator+=(const difference_type value) noexcept {
-        _iterator += static_cast<Arithmetic>(value) * _step;
+    LZ_CONSTEXPR_CXX_14 RangeIterator& operator+=(const difference_type value) noexcept {
+        _index += value;
         return *this;
     }
 
     LZ_NODISCARD constexpr RangeIterator operator+(const difference_type value) const noexcept {
-        RangeIterator tmp(*this);
-        tmp += value;
-        return tmp;
+        return RangeIterator(_start, _step, _index + value);
+    }
+
+    LZ_NODISCARD constexpr friend RangeIterator operator+(const difference_type offset, const RangeIterator& iterator) noexcept {
+        return iterator + offset;
     }
 
-    constexpr RangeIterator operator-=(const difference_type value) noexcept {
-        _iterator -= static_cast<Arithmetic>(value) * _step;
+    LZ_CONSTEXPR_CXX_14 RangeIterator& operator-=(const difference_type value) noexcept {
+        _index -= value;
         return *this;
     }
 
     LZ_NODISCARD constexpr RangeIterator operator-(const difference_type value) const noexcept {
-        RangeIterator tmp(*this);
-        tmp -= value;
-        return tmp;
+        return RangeIterator(_start, _step, _index - value);
     }
 
+    // An iterator that has been advanced past the end, e.g. by a strided view, compares equal to it
     LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend bool operator!=(const RangeIterator& a, const RangeIterator& b) noexcept {
-        LZ_ASSERT(a._step == b._step, "incompatible iterator types: difference step size");
-        return a._step < 0 ? a._iterator > b._iterator : a._iterator < b._iterator;
+        LZ_ASSERT(a._start == b._start && a._step == b._step, "incompatible iterator types: different start or step size");
+        return a._index < b._index;
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend bool operator==(const RangeIterator& a, const RangeIterator& b) noexcept {
         return !(a != b); // NOLINT
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator<(const RangeIterator& a, const RangeIterator& b) noexcept {
-        return a._iterator < b._iterator;
+    // Closed forms of reductions over [*this, end), for integral ranges. The arithmetic is done modulo 2^64, so that the
+    // intermediate values can't overflow, after which the result is truncated to the requested type
+
+    //! Returns true if the values increase, i.e. the first value is the smallest one.
+    LZ_NODISCARD constexpr bool isAscending() const noexcept {
+        return _step > 0;
+    }
+
+    //! Returns the sum of the values in [*this, end), as a T, so that e.g. the sum of a range of ints can exceed INT_MAX
+    template<class T = Arithmetic>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 T sumTo(const RangeIterator& end) const noexcept {
+        using Sum = Conditional<std::is_signed<Arithmetic>::value, std::intmax_t, std::uintmax_t>;
+        const auto n = static_cast<std::uintmax_t>(end - *this);
+        const std::uintmax_t triangle = n % 2 == 0 ? (n / 2) * (n - 1) : n * ((n - 1) / 2);
+        const std::uintmax_t sum = n * static_cast<std::uintmax_t>(**this) + static_cast<std::uintmax_t>(_step) * triangle;
+        return static_cast<T>(static_cast<Sum>(sum));
+    }
+
+    //! Returns the position of `value` in [*this, end), or `end` if it is not one of its values
+    template<class T>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 RangeIterator find(const RangeIterator& end, const T& value) const noexcept {
+        const auto converted = static_cast<Arithmetic>(value);
+        const Arithmetic current = **this;
+        if (static_cast<T>(converted) != value || (isAscending() ? converted < current : converted > current)) {
+            return end;
+        }
+        const auto first = static_cast<std::uintmax_t>(current);
+        const auto target = static_cast<std::uintmax_t>(converted);
+        const std::uintmax_t distance = isAscending() ? target - first : first - target;
+        const std::uintmax_t stepSize =
+            isAscending() ? static_cast<std::uintmax_t>(_step) : std::uintmax_t{ 0 } - static_cast<std::uintmax_t>(_step);
+        const std::uintmax_t index = distance / stepSize;
+        if (distance % stepSize != 0 || index >= static_cast<std::uintmax_t>(end - *this)) {
+            return end;
+        }
+        return *this + static_cast<difference_type>(index);
+    }
+
+    LZ_NODISCARD constexpr friend bool operator<(const RangeIterator& a, const RangeIterator& b) noexcept {
+        return a._index < b._index;
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>(const RangeIterator& a, const RangeIterator& b) noexcept {
+    LZ_NODISCARD constexpr friend bool operator>(const RangeIterator& a, const RangeIterator& b) noexcept {
         return b < a; // NOLINT
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator<=(const RangeIterator& a, const RangeIterator& b) noexcept {
+    LZ_NODISCARD constexpr friend bool operator<=(const RangeIterator& a, const RangeIterator& b) noexcept {
         return !(b < a); // NOLINT
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>=(const RangeIterator& a, const RangeIterator& b) noexcept {
+    LZ_NODISCARD constexpr friend bool operator>=(const RangeIterator& a, const RangeIterator& b) noexcept {
         return !(a < b); // NOLINT
     }
 };
 } // namespace internal
 } // namespace lz
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,426 @@
+#pragma once
+
+#ifndef LZ_RECORD_READER_ITERATOR_HPP
+#    define LZ_RECORD_READER_ITERATOR_HPP
+
+#    include "IoUring.hpp"
+#    include "LzTools.hpp"
+
+#    include <algorithm>
+#    include <cerrno>
+#    include <cstdint>
+#    include <cstring>
+#    include <istream>
+#    include <memory>
+#    include <system_error>
+#    include <vector>
+
+#    ifdef _WIN32
+#        include <io.h>
+#    else
+#        include <fcntl.h>
+#        include <unistd.h>
+#    endif // _WIN32
+
+namespace lz {
+namespace internal {
+// The default amount of bytes that is read at once by lz::readRecords
+constexpr LZ_INLINE_VAR std::size_t defaultReadBlockSize = std::size_t{ 1 } << 20;
+
+struct StreamSource {
+    std::istream* stream;
+
+    std::size_t operator()(char* into, const std::size_t maxSize) const {
+        stream->read(into, static_cast<std::streamsize>(maxSize));
+        return static_cast<std::size_t>(stream->gcount());
+    }
+};
+
+struct FileDescriptorSource {
+    int fileDescriptor;
+
+    std::size_t operator()(char* into, const std::size_t maxSize) const {
+        while (true) {
+#    ifdef _WIN32
+            const auto count = ::_read(fileDescriptor, into, static_cast<unsigned>((std::min)(maxSize, std::size_t{ 1 } << 30)));
+#    else
+            const auto count = ::read(fileDescriptor, into, maxSize);
+#    endif // _WIN32
+            if (count >= 0) {
+                return static_cast<std::size_t>(count);
+            }
+            if (errno != EINTR) {
+                throw std::system_error(errno, std::generic_category(), "lz::readRecords: cannot read from file descriptor");
+            }
+        }
+    }
+};
+
+#    ifndef _WIN32
+// Reads a file in blocks of `blockSize` bytes, of which `queueDepth` are read at the same time using io_uring, so that the
+// device already reads the next blocks while the records of the current block are cut. The blocks are handed out in order.
+// If io_uring is not available, or the file descriptor is not seekable (e.g. a pipe), one block is read at a time
+class ReadAhead {
+    struct Block {
+        std::vector<char> data;
+#        ifdef LZ_HAS_IO_URING
+        iovec vector{};
+#        endif // LZ_HAS_IO_URING
+        std::uint64_t offset{};
+        std::size_t size{};
+        std::size_t consumed{};
+        bool ready{};
+    };
+
+    std::vector<Block> _blocks;
+    std::size_t _current{};
+    std::uint64_t _nextOffset{};
+    std::size_t _blockSize{};
+    int _fileDescriptor{};
+    bool _seekable{};
+    bool _eof{};
+#        ifdef LZ_HAS_IO_URING
+    IoUring _ring;
+    std::size_t _pending{};
+    bool _async{};
+    // Whether a read reached the end of the file, after which no more reads are submitted
+    bool _submittedLast{};
+#        endif // LZ_HAS_IO_URING
+
+    [[noreturn]] static void throwReadError(const int error) {
+        throw std::system_error(error, std::generic_category(), "lz::readRecordsAsync: cannot read from file descriptor");
+    }
+
+    // Reads into `into` until it is full or the end of the file is reached
+    std::size_t readFully(char* into, const std::size_t size, const std::uint64_t offset) const {
+        std::size_t count = 0;
+        while (count != size) {
+            const auto result = ::pread(_fileDescriptor, into + count, size - count, static_cast<off_t>(offset + count));
+            if (result == 0) {
+                break;
+            }
+            if (result > 0) {
+                count += static_cast<std::size_t>(result);
+            }
+            else if (errno != EINTR) {
+                throwReadError(errno);
+            }
+        }
+        return count;
+    }
+
+    void readBlock(Block& block) {
+        block.consumed = 0;
+        block.ready = true;
+        if (_seekable) {
+            block.offset = _nextOffset;
+            block.size = readFully(block.data.data(), _blockSize, block.offset);
+            _nextOffset += block.size;
+            return;
+        }
+        FileDescriptorSource source{ _fileDescriptor };
+        block.size = source(block.data.data(), _blockSize);
+    }
+
+#        ifdef LZ_HAS_IO_URING
+    void submit(const std::size_t index) {
+        Block& block = _blocks[index];
+        block.offset = _nextOffset;
+        block.size = 0;
+        block.consumed = 0;
+        block.ready = false;
+        block.vector.iov_base = block.data.data();
+        block.vector.iov_len = _blockSize;
+        _nextOffset += _blockSize;
+        const int error = _ring.submitRead(_fileDescriptor, &block.vector, block.offset, index);
+        if (error != 0) {
+            throwReadError(-error);
+        }
+        ++_pending;
+    }
+
+    void awaitBlock(Block& block) {
+        while (!block.ready) {
+            io_uring_cqe completion{};
+            if (!_ring.waitCompletion(completion)) {
+                throwReadError(errno);
+            }
+            --_pending;
+            if (completion.res < 0) {
+                throwReadError(-completion.res);
+            }
+            Block& completed = _blocks[static_cast<std::size_t>(completion.user_data)];
+            completed.size = static_cast<std::size_t>(completion.res);
+            completed.ready = true;
+        }
+        // A read may return less than was asked for before the end of the file. The rest is read synchronously, so that the
+        // blocks after it, which are read already, still follow on it
+        if (block.size != 0 && block.size != _blockSize) {
+            block.size += readFully(block.data.data() + block.size, _blockSize - block.size, block.offset + block.size);
+        }
+        if (block.size != _blockSize) {
+            _submittedLast = true;
+        }
+    }
+
+    // The kernel writes into the blocks until their reads are completed, so they may only be freed after that
+    void drain() noexcept {
+        io_uring_cqe completion{};
+        while (_pending != 0 && _ring.waitCompletion(completion)) {
+            --_pending;
+        }
+    }
+#        endif // LZ_HAS_IO_URING
+
+public:
+    ReadAhead(const int fileDescriptor, const std::size_t blockSize, const std::size_t queueDepth) :
+        _blockSize((std::max)(blockSize, std::size_t{ 1 })),
+        _fileDescriptor(fileDescriptor) {
+        const auto start = ::lseek(fileDescriptor, 0, SEEK_CUR);
+        _seekable = start >= 0;
+        _nextOffset = _seekable ? static_cast<std::uint64_t>(start) : 0;
+        const std::size_t blockCount = _seekable ? (std::max)(queueDepth, std::size_t{ 1 }) : 1;
+        _blocks.resize(blockCount);
+        for (Block& block : _blocks) {
+            block.data.resize(_blockSize);
+        }
+#        ifdef LZ_HAS_IO_URING
+        _async = _seekable && blockCount > 1 && _ring.open(static_cast<unsigned>(blockCount));
+        if (_async) {
+            try {
+                for (std::size_t i = 0; i < blockCount; ++i) {
+                    submit(i);
+                }
+            }
+            catch (...) {
+                drain();
+                throw;
+            }
+            return;
+        }
+#        endif // LZ_HAS_IO_URING
+#        ifdef POSIX_FADV_SEQUENTIAL
+        if (_seekable) {
+            // Without reads in flight, at least let the kernel read ahead further than it does by default
+            ::posix_fadvise(fileDescriptor, static_cast<off_t>(start), 0, POSIX_FADV_SEQUENTIAL);
+        }
+#        endif // POSIX_FADV_SEQUENTIAL
+    }
+
+    ReadAhead(const ReadAhead&) = delete;
+    ReadAhead& operator=(const ReadAhead&) = delete;
+
+    ~ReadAhead() {
+#        ifdef LZ_HAS_IO_URING
+        drain();
+#        endif // LZ_HAS_IO_URING
+    }
+
+    std::size_t operator()(char* into, const std::size_t maxSize) {
+        if (_eof) {
+            return 0;
+        }
+        Block& block = _blocks[_current];
+        if (!block.ready) {
+#        ifdef LZ_HAS_IO_URING
+            if (_async) {
+                awaitBlock(block);
+            }
+            else {
+                readBlock(block);
+            }
+#        else
+            readBlock(block);
+#        endif // LZ_HAS_IO_URING
+        }
+        if (block.size == 0) {
+            _eof = true;
+            return 0;
+        }
+        const std::size_t count = (std::min)(maxSize, block.size - block.consumed);
+        std::memcpy(into, block.data.data() + block.consumed, count);
+        block.consumed += count;
+        if (block.consumed == block.size) {
+            block.ready = false;
+#        ifdef LZ_HAS_IO_URING
+            if (_async && !_submittedLast) {
+                submit(_current);
+            }
+#        endif // LZ_HAS_IO_URING
+            _current = (_current + 1) % _blocks.size();
+        }
+        return count;
+    }
+};
+
+// The reads are only started when the first record is read. The state is not movable, as the kernel holds pointers into it
+class ReadAheadSource {
+    int _fileDescriptor;
+    std::size_t _blockSize;
+    std::size_t _queueDepth;
+    std::unique_ptr<ReadAhead> _readAhead;
+
+public:
+    ReadAheadSource(const int fileDescriptor, const std::size_t blockSize, const std::size_t queueDepth) :
+        _fileDescriptor(fileDescriptor),
+        _blockSize(blockSize),
+        _queueDepth(queueDepth) {
+    }
+
+    std::size_t operator()(char* into, const std::size_t maxSize) {
+        if (_readAhead == nullptr) {
+            _readAhead.reset(new ReadAhead(_fileDescriptor, _blockSize, _queueDepth));
+        }
+        return (*_readAhead)(into, maxSize);
+    }
+};
+#    endif // _WIN32
+
+// Reads blocks from `Source` into one buffer and cuts them into records. The unfinished record at the end of the buffer is moved
+// to the front before the next block is read after it, so only records that span a block boundary are copied, and only once.
+// The buffer grows if a single record is larger than it.
+template<class Source>
+class RecordBuffer {
+    Source _source;
+    std::vector<char> _buffer;
+    std::size_t _recordBegin{};
+    std::size_t _recordEnd{};
+    // The start of the next record, and the end of the valid data in the buffer
+    std::size_t _next{};
+    std::size_t _end{};
+    char _separator{};
+    bool _eof{};
+    bool _started{};
+    bool _done{};
+
+    // Moves the unfinished record to the front and reads a block after it. Returns false if nothing could be read
+    bool fill() {
+        if (_next != 0) {
+            std::memmove(_buffer.data(), _buffer.data() + _next, _end - _next);
+            _end -= _next;
+            _next = 0;
+        }
+        if (_end == _buffer.size()) {
+            _buffer.resize(_buffer.size() * 2);
+        }
+        const std::size_t count = _source(_buffer.data() + _end, _buffer.size() - _end);
+        _end += count;
+        _eof = count == 0;
+        return !_eof;
+    }
+
+    void readRecord() {
+        std::size_t scanned = _next;
+        while (true) {
+            const void* match = std::memchr(_buffer.data() + scanned, _separator, _end - scanned);
+            if (match != nullptr) {
+                _recordBegin = _next;
+                _recordEnd = static_cast<std::size_t>(static_cast<const char*>(match) - _buffer.data());
+                _next = _recordEnd + 1;
+                return;
+            }
+            if (_eof) {
+                break;
+            }
+            scanned = _end - _next;
+            if (!fill()) {
+                break;
+            }
+        }
+        // The last record does not need a separator, but a trailing separator does not start an empty record
+        _done = _next == _end;
+        _recordBegin = _next;
+        _recordEnd = _end;
+        _next = _end;
+    }
+
+    void start() {
+        if (!_started) {
+            _started = true;
+            readRecord();
+        }
+    }
+
+public:
+    RecordBuffer(Source source, const char separator, const std::size_t blockSize) :
+        _source(std::move(source)),
+        _buffer((std::max)(blockSize, std::size_t{ 1 })),
+        _separator(separator) {
+    }
+
+    const char* recordData() {
+        start();
+        return _buffer.data() + _recordBegin;
+    }
+
+    std::size_t recordSize() {
+        start();
+        return _recordEnd - _recordBegin;
+    }
+
+    bool done() {
+        start();
+        return _done;
+    }
+
+    void next() {
+        start();
+        if (_next == _end && (_eof || !fill())) {
+            _done = true;
+            return;
+        }
+        readRecord();
+    }
+};
+
+template<class Source, class SubString>
+class RecordReaderIterator {
+    std::shared_ptr<RecordBuffer<Source>> _buffer{};
+
+    bool isEnd() const {
+        return _buffer == nullptr || _buffer->done();
+    }
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = SubString;
+    using reference = SubString;
+    using difference_type = std::ptrdiff_t;
+    using pointer = FakePointerProxy<reference>;
+
+    explicit RecordReaderIterator(std::shared_ptr<RecordBuffer<Source>> buffer) : _buffer(std::move(buffer)) {
+    }
+
+    RecordReaderIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return SubString(_buffer->recordData(), _buffer->recordSize());
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    RecordReaderIterator& operator++() {
+        _buffer->next();
+        return *this;
+    }
+
+    RecordReaderIterator operator++(int) {
+        RecordReaderIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator==(const RecordReaderIterator& a, const RecordReaderIterator& b) {
+        return a.isEnd() == b.isEnd();
+    }
+
+    LZ_NODISCARD friend bool operator!=(const RecordReaderIterator& a, const RecordReaderIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_RECORD_READER_ITERATOR_HPP
@@ -0,0 +1,474 @@
+#pragma once
+
+#ifndef LZ_REDUCE_HPP
+#    define LZ_REDUCE_HPP
+
+#    include "BlockFind.hpp"
+#    include "Contiguous.hpp"
+#    include "LzTools.hpp"
+#    include "Parallel.hpp"
+#    include "RangeIterator.hpp"
+
+#    include <algorithm>
+#    include <functional>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+// Amount of independent accumulators the reductions below use. This breaks the dependency chain of a single accumulator, so
+// that the compiler can keep several additions or comparisons in flight, or put the accumulators in one vector register
+constexpr LZ_INLINE_VAR std::size_t reduceLaneCount = 8;
+
+// Whether a sum of T may be computed in a different order than front to back. Integer addition is associative, floating point
+// addition is not, so floats are only reassociated if this is explicitly allowed by defining LZ_FAST_MATH
+#    ifdef LZ_FAST_MATH
+template<class T>
+struct IsReassociable : std::integral_constant<bool, std::is_arithmetic<T>::value && !std::is_same<T, bool>::value> {};
+#    else  // ^^^ LZ_FAST_MATH vvv !LZ_FAST_MATH
+template<class T>
+struct IsReassociable : std::integral_constant<bool, std::is_integral<T>::value && !std::is_same<T, bool>::value> {};
+#    endif // LZ_FAST_MATH
+
+// Integral `lz::range`s (also after e.g. `lz::take` or `lz::slice`) are arithmetic progressions, whose sum, extrema and
+// positions of values have closed forms
+template<class Iterator>
+struct IsArithmeticProgression : std::false_type {};
+
+template<class Arithmetic>
+struct IsArithmeticProgression<RangeIterator<Arithmetic>> : std::is_integral<Arithmetic> {};
+
+template<class Iterator>
+struct IsLaneReducible
+    : std::integral_constant<bool, IsRandomAccess<Iterator>::value && IsReassociable<Decay<ValueType<Iterator>>>::value> {};
+
+// Adds `value` to the moved from `init`, so that e.g. summing strings appends in place
+struct MovingPlus {
+    template<class T, class U>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 T operator()(T init, const U& value) const {
+        return std::move(init) + value;
+    }
+};
+
+template<class BinaryOp, class T>
+struct IsPlus : std::integral_constant<bool, std::is_same<BinaryOp, std::plus<T>>::value ||
+                                                 std::is_same<BinaryOp, std::plus<void>>::value ||
+                                                 std::is_same<BinaryOp, MovingPlus>::value> {};
+
+template<class Compare, class T>
+struct IsLess : std::integral_constant<bool, std::is_same<Compare, std::less<T>>::value ||
+                                                 std::is_same<Compare, std::less<void>>::value> {};
+
+// The lanes are of the type of the result, so that e.g. ints summed into a long long don't overflow
+template<class Iterator, class T, class BinaryOp>
+LZ_CONSTEXPR_CXX_20 T laneSum(Iterator begin, const Iterator& end, T init, BinaryOp binOp) {
+    using Difference = DiffType<Iterator>;
+    constexpr auto laneCount = static_cast<Difference>(reduceLaneCount);
+    Decay<T> lanes[reduceLaneCount]{};
+
+    const Difference length = end - begin;
+    const Difference unrolledLength = length - length % laneCount;
+    Difference i = 0;
+    for (; i < unrolledLength; i += laneCount) {
+        for (Difference lane = 0; lane < laneCount; ++lane) {
+            lanes[lane] += begin[i + lane];
+        }
+    }
+    for (; i < length; ++i) {
+        lanes[0] += begin[i];
+    }
+    for (std::size_t width = reduceLaneCount / 2; width > 0; width /= 2) {
+        for (std::size_t lane = 0; lane < width; ++lane) {
+            lanes[lane] += lanes[lane + width];
+        }
+    }
+    return binOp(std::move(init), lanes[0]);
+}
+
+// How a reduction over [begin, end) is computed: element by element, with several accumulators or with a closed form
+enum class ReduceStrategy { sequential, lanes, closedForm };
+
+template<ReduceStrategy Strategy>
+using ReduceStrategyTag = std::integral_constant<ReduceStrategy, Strategy>;
+
+template<class Iterator, bool IsApplicable>
+using ReduceStrategyOf = ReduceStrategyTag<!IsApplicable                            ? ReduceStrategy::sequential
+                                           : IsArithmeticProgression<Iterator>::value ? ReduceStrategy::closedForm
+                                           : IsLaneReducible<Iterator>::value         ? ReduceStrategy::lanes
+                                                                                      : ReduceStrategy::sequential>;
+
+template<class Iterator, class T, class BinaryOp>
+LZ_CONSTEXPR_CXX_20 T sumFoldImpl(ReduceStrategyTag<ReduceStrategy::closedForm>, const Iterator& begin, const Iterator& end,
+                                  T init, BinaryOp binOp) {
+    return binOp(std::move(init), begin.template sumTo<Decay<T>>(end));
+}
+
+template<class T, class BinaryOp>
+struct SumFoldSegmentSink;
+
+template<class Iterator, class T, class BinaryOp>
+LZ_CONSTEXPR_CXX_20 T
+laneSumSegments(std::true_type /* hasForEachSegment */, Iterator begin, const Iterator& end, T init, BinaryOp binOp) {
+    SumFoldSegmentSink<T, BinaryOp> sink{ init, binOp };
+    forEachSegment(std::move(begin), end, sink);
+    return init;
+}
+
+template<class Iterator, class T, class BinaryOp>
+LZ_CONSTEXPR_CXX_20 T
+laneSumSegments(std::false_type /* hasForEachSegment */, Iterator begin, const Iterator& end, T init, BinaryOp binOp) {
+    return laneSum(std::move(begin), end, std::move(init), std::move(binOp));
+}
+
+// Segmented iterators (e.g. rotate) are summed one segment at a time, so that the lanes index the underlying ranges directly
+template<class Iterator, class T, class BinaryOp>
+LZ_CONSTEXPR_CXX_20 T
+sumFoldImpl(ReduceStrategyTag<ReduceStrategy::lanes>, Iterator begin, const Iterator& end, T init, BinaryOp binOp) {
+    return laneSumSegments(HasForEachSegment<Iterator>(), std::move(begin), end, std::move(init), std::move(binOp));
+}
+
+template<class Iterator, class T, class BinaryOp>
+LZ_CONSTEXPR_CXX_20 T
+sumFoldImpl(ReduceStrategyTag<ReduceStrategy::sequential>, Iterator begin, const Iterator& end, T init, BinaryOp binOp) {
+    return sinkFold(std::move(begin), end, std::move(init), std::move(binOp));
+}
+
+// Left fold of [begin, end). If `binOp` is a plus of T over a random access range of values that may be reassociated, the values
+// are summed into several accumulators of type T at once, or with a closed form for arithmetic progressions
+template<class Iterator, class T, class BinaryOp>
+LZ_CONSTEXPR_CXX_20 T sumFold(Iterator begin, const Iterator& end, T init, BinaryOp binOp) {
+    using Strategy = ReduceStrategyOf<Iterator, IsPlus<BinaryOp, Decay<T>>::value && IsReassociable<Decay<T>>::value>;
+    return sumFoldImpl(Strategy(), std::move(begin), end, std::move(init), std::move(binOp));
+}
+
+template<class T, class BinaryOp>
+struct SumFoldSegmentSink {
+    T& init;
+    BinaryOp& binOp;
+
+    template<class I>
+    LZ_CONSTEXPR_CXX_20 void operator()(I begin, const I& end) {
+        init = sumFold(std::move(begin), end, std::move(init), binOp);
+    }
+};
+
+struct MinSelect {
+    template<class T>
+    LZ_NODISCARD constexpr const T& operator()(const T& a, const T& b) const {
+        return b < a ? b : a;
+    }
+};
+
+struct MaxSelect {
+    template<class T>
+    LZ_NODISCARD constexpr const T& operator()(const T& a, const T& b) const {
+        return a < b ? b : a;
+    }
+};
+
+// Finds the extremum value with several accumulators, after which the first element equal to it is searched for. The
+// comparisons are branchless, which makes both loops vectorizable, so this beats std::min_element's single dependency chain.
+// Floats only get here with LZ_FAST_MATH, which assumes there are no NaNs
+template<class Iterator, class Select>
+LZ_CONSTEXPR_CXX_20 Iterator laneSelectElement(Iterator begin, const Iterator& end, Select select) {
+    using Value = Decay<ValueType<Iterator>>;
+    using Difference = DiffType<Iterator>;
+    constexpr auto laneCount = static_cast<Difference>(reduceLaneCount);
+    const Difference length = end - begin;
+    if (length == 0) {
+        return begin;
+    }
+
+    Value lanes[reduceLaneCount]{};
+    std::fill(lanes, lanes + reduceLaneCount, begin[0]);
+    const Difference unrolledLength = length - length % laneCount;
+    Difference i = 0;
+    for (; i < unrolledLength; i += laneCount) {
+        for (Difference lane = 0; lane < laneCount; ++lane) {
+            lanes[lane] = select(lanes[lane], static_cast<Value>(begin[i + lane]));
+        }
+    }
+    for (; i < length; ++i) {
+        lanes[0] = select(lanes[0], static_cast<Value>(begin[i]));
+    }
+    for (std::size_t width = reduceLaneCount / 2; width > 0; width /= 2) {
+        for (std::size_t lane = 0; lane < width; ++lane) {
+            lanes[lane] = select(lanes[lane], lanes[lane + width]);
+        }
+    }
+    return std::find(begin, end, lanes[0]);
+}
+
+// The smallest value of an ascending progression is its first one, the largest its last one
+template<class Iterator>
+LZ_CONSTEXPR_CXX_20 Iterator progressionElement(const Iterator& begin, const Iterator& end, const bool first) {
+    if (first || begin == end) {
+        return begin;
+    }
+    return begin + ((end - begin) - 1);
+}
+
+template<class Iterator, class Compare>
+LZ_CONSTEXPR_CXX_20 Iterator
+minElementImpl(ReduceStrategyTag<ReduceStrategy::closedForm>, const Iterator& begin, const Iterator& end, Compare) {
+    return progressionElement(begin, end, begin.isAscending());
+}
+
+template<class Iterator, class Compare>
+LZ_CONSTEXPR_CXX_20 Iterator
+minElementImpl(ReduceStrategyTag<ReduceStrategy::lanes>, Iterator begin, const Iterator& end, Compare) {
+    return laneSelectElement(std::move(begin), end, MinSelect());
+}
+
+template<class Iterator, class Compare>
+LZ_CONSTEXPR_CXX_20 Iterator
+minElementImpl(ReduceStrategyTag<ReduceStrategy::sequential>, Iterator begin, const Iterator& end, Compare compare) {
+    return std::min_element(std::move(begin), end, std::move(compare));
+}
+
+template<class Iterator, class Compare>
+LZ_CONSTEXPR_CXX_20 Iterator
+maxElementImpl(ReduceStrategyTag<ReduceStrategy::closedForm>, const Iterator& begin, const Iterator& end, Compare) {
+    return progressionElement(begin, end, !begin.isAscending());
+}
+
+template<class Iterator, class Compare>
+LZ_CONSTEXPR_CXX_20 Iterator
+maxElementImpl(ReduceStrategyTag<ReduceStrategy::lanes>, Iterator begin, const Iterator& end, Compare) {
+    return laneSelectElement(std::move(begin), end, MaxSelect());
+}
+
+template<class Iterator, class Compare>
+LZ_CONSTEXPR_CXX_20 Iterator
+maxElementImpl(ReduceStrategyTag<ReduceStrategy::sequential>, Iterator begin, const Iterator& end, Compare compare) {
+    return std::max_element(std::move(begin), end, std::move(compare));
+}
+
+// Same as std::min_element, but uses several accumulators over random access ranges of reassociable values, or a closed form
+// for arithmetic progressions
+template<class Iterator, class Compare>
+LZ_CONSTEXPR_CXX_20 Iterator minElement(Iterator begin, const Iterator& end, Compare compare) {
+    using Strategy = ReduceStrategyOf<Iterator, IsLess<Compare, Decay<ValueType<Iterator>>>::value>;
+    return minElementImpl(Strategy(), std::move(begin), end, std::move(compare));
+}
+
+// Same as std::max_element, but uses several accumulators over random access ranges of reassociable values, or a closed form
+// for arithmetic progressions
+template<class Iterator, class Compare>
+LZ_CONSTEXPR_CXX_20 Iterator maxElement(Iterator begin, const Iterator& end, Compare compare) {
+    using Strategy = ReduceStrategyOf<Iterator, IsLess<Compare, Decay<ValueType<Iterator>>>::value>;
+    return maxElementImpl(Strategy(), std::move(begin), end, std::move(compare));
+}
+
+template<class Iterator, class T>
+LZ_CONSTEXPR_CXX_20 Iterator findValueImpl(std::true_type /* isArithmeticProgression */, const Iterator& begin,
+                                           const Iterator& end, const T& value) {
+    return begin.find(end, value);
+}
+
+template<class Iterator, class T>
+LZ_CONSTEXPR_CXX_20 Iterator findContiguous(std::true_type /* isMemchrSearchable */, Iterator begin, const Iterator& end,
+                                            const T& value) {
+    if (isConstantEvaluated()) {
+        return std::find(std::move(begin), end, value);
+    }
+    return memFind(begin, end, value);
+}
+
+template<class Iterator, class T>
+LZ_CONSTEXPR_CXX_20 Iterator findBlocks(std::true_type /* isBlockSearchable */, Iterator begin, const Iterator& end,
+                                        const T& value) {
+    if (isConstantEvaluated() || begin == end) {
+        return std::find(std::move(begin), end, value);
+    }
+    const T* first = contiguousData(begin, end);
+    return begin + (blockFind(first, first + (end - begin), value) - first);
+}
+
+template<class Iterator, class T>
+LZ_CONSTEXPR_CXX_20 Iterator findBlocks(std::false_type /* isBlockSearchable */, Iterator begin, const Iterator& end,
+                                        const T& value) {
+    return std::find(std::move(begin), end, value);
+}
+
+template<class Iterator, class T>
+LZ_CONSTEXPR_CXX_20 Iterator findContiguous(std::false_type /* isMemchrSearchable */, Iterator begin, const Iterator& end,
+                                            const T& value) {
+    return findBlocks(IsBlockSearchable<Iterator, T>(), std::move(begin), end, value);
+}
+
+template<class Iterator, class T>
+LZ_CONSTEXPR_CXX_20 Iterator findValueImpl(std::false_type /* isArithmeticProgression */, Iterator begin, const Iterator& end,
+                                           const T& value) {
+    return findContiguous(IsMemchrSearchable<Iterator, T>(), std::move(begin), end, value);
+}
+
+// Same as std::find, but computes the position of `value` directly in arithmetic progressions, searches contiguous bytes with
+// memchr and other contiguous numbers a cache line at a time
+template<class Iterator, class T>
+LZ_CONSTEXPR_CXX_20 Iterator findValue(Iterator begin, const Iterator& end, const T& value) {
+    using IsClosedForm = std::integral_constant<bool, IsArithmeticProgression<Iterator>::value && std::is_arithmetic<T>::value>;
+    return findValueImpl(IsClosedForm(), std::move(begin), end, value);
+}
+
+template<class Iterator, class T>
+LZ_CONSTEXPR_CXX_20 DiffType<Iterator> countOfImpl(std::true_type /* isArithmeticProgression */, const Iterator& begin,
+                                                   const Iterator& end, const T& value) {
+    // Every value of a progression is distinct
+    return begin.find(end, value) != end ? 1 : 0;
+}
+
+template<class Iterator, class T>
+LZ_CONSTEXPR_CXX_20 DiffType<Iterator>
+countBlocks(std::true_type /* isBlockSearchable */, Iterator begin, const Iterator& end, const T& value) {
+    if (isConstantEvaluated() || begin == end) {
+        return sinkCount(std::move(begin), end, value);
+    }
+    const T* first = contiguousData(begin, end);
+    return static_cast<DiffType<Iterator>>(blockCount(first, first + (end - begin), value));
+}
+
+template<class Iterator, class T>
+LZ_CONSTEXPR_CXX_20 DiffType<Iterator>
+countBlocks(std::false_type /* isBlockSearchable */, Iterator begin, const Iterator& end, const T& value) {
+    return sinkCount(std::move(begin), end, value);
+}
+
+template<class Iterator, class T>
+LZ_CONSTEXPR_CXX_20 DiffType<Iterator> countOfImpl(std::false_type /* isArithmeticProgression */, Iterator begin,
+                                                   const Iterator& end, const T& value) {
+    return countBlocks(IsBlockSearchable<Iterator, T>(), std::move(begin), end, value);
+}
+
+// Counts the elements equal to `value`, which is at most one for arithmetic progressions. Contiguous numbers are counted a cache
+// line at a time
+template<class Iterator, class T>
+LZ_CONSTEXPR_CXX_20 DiffType<Iterator> countOf(Iterator begin, const Iterator& end, const T& value) {
+    using IsClosedForm = std::integral_constant<bool, IsArithmeticProgression<Iterator>::value && std::is_arithmetic<T>::value>;
+    return countOfImpl(IsClosedForm(), std::move(begin), end, value);
+}
+
+struct IdentityTransform {
+    template<class T>
+    LZ_NODISCARD constexpr T&& operator()(T&& value) const noexcept {
+        return static_cast<T&&>(value);
+    }
+};
+
+struct ToDouble {
+    template<class T>
+    LZ_NODISCARD constexpr double operator()(const T& value) const noexcept {
+        return static_cast<double>(value);
+    }
+};
+
+// Without a transform, the faster sum of sumFold can be used
+template<class Iterator, class T, class BinaryOp>
+T transformFold(const IdentityTransform&, Iterator begin, const Iterator& end, T init, const BinaryOp& binOp) {
+    return sumFold(std::move(begin), end, std::move(init), binOp);
+}
+
+template<class Iterator, class T, class BinaryOp, class UnaryOp>
+T transformFold(const UnaryOp& unaryOp, Iterator begin, const Iterator& end, T init, const BinaryOp& binOp) {
+    for (; begin != end; ++begin) {
+        init = binOp(std::move(init), unaryOp(*begin));
+    }
+    return init;
+}
+
+// Wrapped, so that threads can assign partial results next to each other, even if T is bool
+template<class T>
+struct PartialResult {
+    T value;
+};
+
+// Reduces the blocks [blockFn(i).first, blockFn(i).second) on `pool`. Only the first block starts with `init`, the others start
+// with their first element. The partial results are then merged in pairs of neighbours, halving their amount every round, so
+// that `binOp` needs to be associative, but not commutative.
+template<class T, class BinaryOp, class UnaryOp, class BlockFn>
+T reduceBlocks(const std::size_t blockCount, T init, const BinaryOp& binOp, const UnaryOp& unaryOp, ThreadPool& pool,
+               const BlockFn& blockFn) {
+    std::vector<PartialResult<T>> partials(blockCount, PartialResult<T>{ std::move(init) });
+    pool.parallelFor(blockCount, [&](const std::size_t block) {
+        auto bounds = blockFn(block);
+        if (block == 0) {
+            partials[0].value =
+                transformFold(unaryOp, std::move(bounds.first), bounds.second, std::move(partials[0].value), binOp);
+            return;
+        }
+        T head(unaryOp(*bounds.first));
+        ++bounds.first;
+        partials[block].value = transformFold(unaryOp, std::move(bounds.first), bounds.second, std::move(head), binOp);
+    });
+
+    for (std::size_t width = 1; width < blockCount; width *= 2) {
+        const std::size_t pairCount = (blockCount - width + 2 * width - 1) / (2 * width);
+        pool.parallelFor(pairCount, [&](const std::size_t pair) {
+            const std::size_t left = pair * 2 * width;
+            partials[left].value = binOp(std::move(partials[left].value), std::move(partials[left + width].value));
+        });
+    }
+    return std::move(partials.front().value);
+}
+
+// The amount of blocks [0, length) is split into by a reduction. Reproducible reductions use blocks of minParallelChunkSize
+// elements, which don't depend on the amount of threads and are the same as the blocks of forward iterators
+inline std::size_t reduceBlockCount(const execution::PoolPolicy& policy, const std::size_t length) noexcept {
+    constexpr auto blockLength = static_cast<std::size_t>(minParallelChunkSize);
+    return policy.isReproducible() ? (length + blockLength - 1) / blockLength : parallelBlockCount(policy.pool(), length);
+}
+
+// Random access: [begin, end) is split into blocks in O(1)
+template<class Iterator, class T, class BinaryOp, class UnaryOp>
+T parallelTransformReduce(std::random_access_iterator_tag, const Iterator& begin, const Iterator& end, T init,
+                          const BinaryOp& binOp, const UnaryOp& unaryOp, const execution::PoolPolicy& policy) {
+    using Diff = DiffType<Iterator>;
+    const auto length = static_cast<std::size_t>(end - begin);
+    const std::size_t blockCount = reduceBlockCount(policy, length);
+    if (blockCount <= 1) {
+        return transformFold(unaryOp, begin, end, std::move(init), binOp);
+    }
+    if (policy.isReproducible()) {
+        constexpr auto blockLength = static_cast<std::size_t>(minParallelChunkSize);
+        return reduceBlocks(blockCount, std::move(init), binOp, unaryOp, policy.pool(), [&](const std::size_t block) {
+            return std::make_pair(begin + static_cast<Diff>(block * blockLength),
+                                  begin + static_cast<Diff>((std::min)((block + 1) * blockLength, length)));
+        });
+    }
+    return reduceBlocks(blockCount, std::move(init), binOp, unaryOp, policy.pool(), [&](const std::size_t block) {
+        return std::make_pair(begin + static_cast<Diff>(length * block / blockCount),
+                              begin + static_cast<Diff>(length * (block + 1) / blockCount));
+    });
+}
+
+// Forward: the block boundaries are found by walking [begin, end) once, after which the blocks are reduced in parallel. This
+// pays off if the reduction or the transform is more expensive than incrementing the iterator. The blocks have a fixed length,
+// so the result is always reproducible
+template<class Iterator, class T, class BinaryOp, class UnaryOp>
+T parallelTransformReduce(std::forward_iterator_tag, Iterator begin, const Iterator& end, T init, const BinaryOp& binOp,
+                          const UnaryOp& unaryOp, const execution::PoolPolicy& policy) {
+    std::vector<Iterator> boundaries;
+    boundaries.push_back(begin);
+    while (begin != end) {
+        for (std::ptrdiff_t count = 0; count < minParallelChunkSize && begin != end; ++count, ++begin) {
+        }
+        boundaries.push_back(begin);
+    }
+    const std::size_t blockCount = boundaries.size() - 1;
+    if (blockCount <= 1) {
+        return transformFold(unaryOp, boundaries.front(), end, std::move(init), binOp);
+    }
+    return reduceBlocks(blockCount, std::move(init), binOp, unaryOp, policy.pool(), [&boundaries](const std::size_t block) {
+        return std::make_pair(boundaries[block], boundaries[block + 1]);
+    });
+}
+
+// Input iterators can only be iterated over once, by one thread
+template<class Iterator, class T, class BinaryOp, class UnaryOp>
+T parallelTransformReduce(std::input_iterator_tag, Iterator begin, const Iterator& end, T init, const BinaryOp& binOp,
+                          const UnaryOp& unaryOp, const execution::PoolPolicy&) {
+    return transformFold(unaryOp, std::move(begin), end, std::move(init), binOp);
+}
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_REDUCE_HPP
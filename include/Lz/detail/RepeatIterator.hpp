@@ -5,14 +5,11 @@
 
 #include "LzTools.hpp"
 
-#include <limits>
-
 namespace lz {
 namespace internal {
 template<class T>
 class RepeatIterator {
     mutable T _toRepeat{};
-    std::size_t _amount{};
     std::size_t _iterator{};
 
 public:
@@ -22,10 +19,7 @@ public:
     using pointer = T*;
     using reference = T&;
 
-    constexpr RepeatIterator(T toRepeat, const std::size_t start, const std::size_t amount) :
-        _toRepeat(std::move(toRepeat)),
-        _amount(amount),
-        _iterator(start) {
+    constexpr RepeatIterator(T toRepeat, const std::size_t start) : _toRepeat(std::move(toRepeat)), _iterator(start) {
     }
 
     constexpr RepeatIterator() = default;
@@ -39,9 +33,7 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_14 RepeatIterator& operator++() noexcept {
-        if (_amount != (std::numeric_limits<std::size_t>::max)()) {
-            ++_iterator;
-        }
+        ++_iterator;
         return *this;
     }
 
@@ -52,9 +44,7 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_14 RepeatIterator& operator--() noexcept {
-        if (_amount != (std::numeric_limits<std::size_t>::max)()) {
-            --_iterator;
-        }
+        --_iterator;
         return *this;
     }
 
@@ -65,16 +55,12 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_14 RepeatIterator& operator+=(const difference_type offset) noexcept {
-        if (_amount != (std::numeric_limits<std::size_t>::max)()) {
-            _iterator += static_cast<std::size_t>(offset);
-        }
+        _iterator += static_cast<std::size_t>(offset);
         return *this;
     }
 
     LZ_CONSTEXPR_CXX_14 RepeatIterator& operator-=(const difference_type offset) noexcept {
-        if (_amount != (std::numeric_limits<std::size_t>::max)()) {
-            _iterator -= static_cast<std::size_t>(offset);
-        }
+        _iterator -= static_cast<std::size_t>(offset);
         return *this;
     }
 
@@ -84,6 +70,11 @@ public:
         return tmp;
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend RepeatIterator operator+(const difference_type offset,
+                                                                     const RepeatIterator& iterator) noexcept {
+        return iterator + offset;
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_14 RepeatIterator operator-(const difference_type offset) const noexcept {
         RepeatIterator tmp(*this);
         tmp -= offset;
@@ -91,7 +82,6 @@ public:
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend difference_type operator-(const RepeatIterator& a, const RepeatIterator& b) noexcept {
-        LZ_ASSERT(a._amount == b._amount, "incompatible iterator types: amount of times to repeat not the same");
         return a._iterator - b._iterator;
     }
 
@@ -100,7 +90,6 @@ public:
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend bool operator!=(const RepeatIterator& a, const RepeatIterator& b) noexcept {
-        LZ_ASSERT(a._amount == b._amount, "incompatible iterator types: amount of times to repeat not the same");
         return a._iterator != b._iterator;
     }
 
@@ -109,7 +98,6 @@ public:
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend bool operator<(const RepeatIterator& a, const RepeatIterator& b) noexcept {
-        LZ_ASSERT(a._amount == b._amount, "incompatible iterator types: amount of times to repeat not the same");
         return a._iterator < b._iterator;
     }
 
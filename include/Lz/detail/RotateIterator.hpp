@@ -40,10 +40,43 @@ public:
         _distance(distance) {
     }
 
+    constexpr RotateIterator() = default;
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
         return *_iterator;
     }
 
+    // A rotation is [mid, end) followed by [begin, mid), so algorithms can run over at most two plain ranges, without checking
+    // for the wrap around on every element
+    template<class SegmentSink>
+    LZ_CONSTEXPR_CXX_20 void forEachSegment(const RotateIterator& end, SegmentSink& sink) const {
+        const difference_type remaining = end._current - _current;
+        if (remaining <= 0) {
+            return;
+        }
+        const difference_type untilEnd = _end - _iterator;
+        if (remaining <= untilEnd) {
+            sink(_iterator, _iterator + remaining);
+            return;
+        }
+        sink(_iterator, _end);
+        sink(_begin, _begin + (remaining - untilEnd));
+    }
+
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool forEachWhile(const RotateIterator& end, Sink& sink) const {
+        const difference_type remaining = end._current - _current;
+        if (remaining <= 0) {
+            return true;
+        }
+        const difference_type untilEnd = _end - _iterator;
+        if (remaining <= untilEnd) {
+            return internal::forEachWhile(_iterator, _iterator + remaining, sink);
+        }
+        return internal::forEachWhile(_iterator, _end, sink) &&
+               internal::forEachWhile(_begin, _begin + (remaining - untilEnd), sink);
+    }
+
     LZ_CONSTEXPR_CXX_20 RotateIterator& operator++() {
         ++_iterator;
         ++_current;
@@ -93,6 +126,11 @@ public:
         return tmp;
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend RotateIterator operator+(const difference_type offset,
+                                                                     const RotateIterator& iterator) {
+        return iterator + offset;
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 RotateIterator operator-(const difference_type offset) const {
         RotateIterator tmp(*this);
         tmp -= offset;
@@ -157,6 +195,8 @@ public:
         _current(current) {
     }
 
+    constexpr RotateIterator() = default;
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
         return *_iterator;
     }
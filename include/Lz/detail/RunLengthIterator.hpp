@@ -0,0 +1,220 @@
+#pragma once
+
+#ifndef LZ_RUN_LENGTH_ITERATOR_HPP
+#    define LZ_RUN_LENGTH_ITERATOR_HPP
+
+#    include "FunctionContainer.hpp"
+#    include "LzTools.hpp"
+#    include "RepeatIterator.hpp"
+
+#    include <algorithm>
+#    include <tuple>
+
+namespace lz {
+namespace internal {
+// Yields every run of equal elements as (first element of the run, length of the run). The length is counted while the end of
+// the run is searched, so unlike `lz::groupBy`, no extra pass over the run is needed to get its size
+template<LZ_CONCEPT_ITERATOR Iterator, class Comparer>
+class RleIterator {
+    Iterator _runBegin{};
+    Iterator _runEnd{};
+    Iterator _end{};
+    std::size_t _count{};
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<Comparer> _comparer{};
+
+    using IterValueType = ValueType<Iterator>;
+    using Ref = RefType<Iterator>;
+
+    LZ_CONSTEXPR_CXX_20 void findRunEnd(std::true_type /* isRandomAccess */, const Ref first) {
+        _runEnd =
+            std::find_if(std::next(_runBegin), _end, [this, &first](const IterValueType& v) { return !_comparer(v, first); });
+        _count = static_cast<std::size_t>(_runEnd - _runBegin);
+    }
+
+    LZ_CONSTEXPR_CXX_20 void findRunEnd(std::false_type /* isRandomAccess */, const Ref first) {
+        _runEnd = std::next(_runBegin);
+        _count = 1;
+        for (; _runEnd != _end && _comparer(*_runEnd, first); ++_runEnd) {
+            ++_count;
+        }
+    }
+
+    LZ_CONSTEXPR_CXX_20 void advance() {
+        if (_runBegin == _end) {
+            _count = 0;
+            return;
+        }
+        findRunEnd(IsRandomAccess<Iterator>(), *_runBegin);
+    }
+
+public:
+    using iterator_category =
+        typename std::common_type<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>::type;
+    using value_type = std::pair<Decay<Ref>, std::size_t>;
+    using reference = std::pair<Ref, std::size_t>;
+    using pointer = FakePointerProxy<reference>;
+    using difference_type = std::ptrdiff_t;
+
+    LZ_CONSTEXPR_CXX_20 RleIterator(Iterator begin, Iterator end, Comparer comparer) :
+        _runBegin(std::move(begin)),
+        _runEnd(_runBegin),
+        _end(std::move(end)),
+        _comparer(std::move(comparer)) {
+        advance();
+    }
+
+    constexpr RleIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return { *_runBegin, _count };
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHintTo(const RleIterator& end) const {
+        return upperBoundSizeHint(_runBegin, end._runBegin);
+    }
+
+    LZ_CONSTEXPR_CXX_20 RleIterator& operator++() {
+        _runBegin = _runEnd;
+        advance();
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 RleIterator operator++(int) {
+        RleIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const RleIterator& a, const RleIterator& b) {
+        return a._runBegin == b._runBegin;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const RleIterator& a, const RleIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+
+// Expands a sequence of (value, count) pairs or tuples, yielding every value `count` times. Runs with a count of zero are
+// skipped. The iterator points to a run and the position within it, which is never the end of a run, so that the end of the
+// sequence is (end of the runs, 0)
+template<LZ_CONCEPT_ITERATOR Iterator>
+class UnrleIterator {
+    using RunRef = RefType<Iterator>;
+    using ValueRef = decltype(std::get<0>(std::declval<RunRef>()));
+
+    Iterator _iterator{};
+    Iterator _end{};
+    std::size_t _index{};
+    std::size_t _count{};
+
+    // Skips the runs that are empty, and caches the length of the run that is entered
+    LZ_CONSTEXPR_CXX_20 void enterRun() {
+        _index = 0;
+        for (; _iterator != _end; ++_iterator) {
+            _count = static_cast<std::size_t>(std::get<1>(*_iterator));
+            if (_count != 0) {
+                return;
+            }
+        }
+    }
+
+public:
+    using iterator_category =
+        typename std::common_type<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>::type;
+    using value_type = Decay<ValueRef>;
+    // A value that lives in a temporary pair is returned by value
+    using reference = Conditional<std::is_rvalue_reference<ValueRef>::value, value_type, ValueRef>;
+    using pointer = FakePointerProxy<reference>;
+    using difference_type = std::ptrdiff_t;
+
+    LZ_CONSTEXPR_CXX_20 UnrleIterator(Iterator iterator, Iterator end) : _iterator(std::move(iterator)), _end(std::move(end)) {
+        enterRun();
+    }
+
+    constexpr UnrleIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return std::get<0>(*_iterator);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool forEachWhile(const UnrleIterator& end, Sink& sink) const {
+        Iterator run = _iterator;
+        std::size_t index = _index;
+        for (; run != end._iterator; ++run, index = 0) {
+            auto&& pair = *run;
+            auto&& value = std::get<0>(pair);
+            const auto count = static_cast<std::size_t>(std::get<1>(pair));
+            for (; index < count; ++index) {
+                if (!sink(value)) {
+                    return false;
+                }
+            }
+        }
+        if (index == end._index) {
+            return true;
+        }
+        auto&& pair = *run;
+        auto&& value = std::get<0>(pair);
+        for (; index != end._index; ++index) {
+            if (!sink(value)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Every run is a segment of repeated values, which e.g. `copyTo` fills at once instead of assigning element by element
+    template<class SegmentSink>
+    LZ_CONSTEXPR_CXX_20 void forEachSegment(const UnrleIterator& end, SegmentSink& sink) const {
+        using Repeat = RepeatIterator<value_type>;
+        Iterator run = _iterator;
+        std::size_t index = _index;
+        for (; run != end._iterator; ++run, index = 0) {
+            auto&& pair = *run;
+            const auto count = static_cast<std::size_t>(std::get<1>(pair));
+            if (index < count) {
+                sink(Repeat(std::get<0>(pair), index), Repeat(std::get<0>(pair), count));
+            }
+        }
+        if (index != end._index) {
+            auto&& pair = *run;
+            sink(Repeat(std::get<0>(pair), index), Repeat(std::get<0>(pair), end._index));
+        }
+    }
+
+    LZ_CONSTEXPR_CXX_20 UnrleIterator& operator++() {
+        if (++_index == _count) {
+            ++_iterator;
+            enterRun();
+        }
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 UnrleIterator operator++(int) {
+        UnrleIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const UnrleIterator& a, const UnrleIterator& b) {
+        return a._iterator == b._iterator && a._index == b._index;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const UnrleIterator& a, const UnrleIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_RUN_LENGTH_ITERATOR_HPP
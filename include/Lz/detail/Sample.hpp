@@ -0,0 +1,140 @@
+#pragma once
+
+#ifndef LZ_SAMPLE_HPP
+#    define LZ_SAMPLE_HPP
+
+#    include "LzTools.hpp"
+#    include "RandomBits.hpp"
+
+#    include <algorithm>
+#    include <cmath>
+#    include <unordered_set>
+#    include <utility>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+// A random number in (0, 1], so that its logarithm is finite
+template<class Generator>
+double uniformOpenUnit(Generator& generator) {
+    return 1. - uniformUnit<double>(generator);
+}
+
+// Random access: Floyd's algorithm picks k distinct indices in O(k), without visiting the other elements. The indices are
+// sorted, so that the elements are read front to back and keep their relative order
+template<class Iterator, class Generator>
+std::vector<ValueType<Iterator>>
+sampleImpl(std::true_type /* isRandomAccess */, Iterator begin, const Iterator end, const std::size_t k, Generator& generator) {
+    const auto size = static_cast<std::size_t>(end - begin);
+    if (k >= size) {
+        return std::vector<ValueType<Iterator>>(begin, end);
+    }
+    std::unordered_set<std::size_t> chosen(k);
+    std::vector<std::size_t> indices;
+    indices.reserve(k);
+    for (std::size_t upper = size - k; upper < size; ++upper) {
+        const std::size_t index = uniformInteger<std::size_t>(generator, 0, upper);
+        // If the index was already picked, `upper` can't have been, as it is larger than all previous upper bounds
+        if (chosen.insert(index).second) {
+            indices.push_back(index);
+        }
+        else {
+            chosen.insert(upper);
+            indices.push_back(upper);
+        }
+    }
+    std::sort(indices.begin(), indices.end());
+
+    std::vector<ValueType<Iterator>> result;
+    result.reserve(k);
+    for (const std::size_t index : indices) {
+        result.push_back(begin[static_cast<DiffType<Iterator>>(index)]);
+    }
+    return result;
+}
+
+// Otherwise reservoir sampling, Algorithm L (Li, 1994): the amount of elements that are skipped before the next one enters the
+// reservoir is drawn at once, so the generator is only called O(k * (1 + log(n / k))) times instead of n times
+template<class Iterator, class Generator>
+std::vector<ValueType<Iterator>>
+sampleImpl(std::false_type /* isRandomAccess */, Iterator begin, const Iterator end, const std::size_t k, Generator& generator) {
+    std::vector<ValueType<Iterator>> reservoir;
+    reservoir.reserve(k);
+    for (; begin != end && reservoir.size() < k; ++begin) {
+        reservoir.push_back(*begin);
+    }
+    if (k == 0 || begin == end) {
+        return reservoir;
+    }
+
+    const auto count = static_cast<double>(k);
+    double w = std::exp(std::log(uniformOpenUnit(generator)) / count);
+    while (true) {
+        for (double skip = std::floor(std::log(uniformOpenUnit(generator)) / std::log1p(-w)); skip >= 1 && begin != end;
+             skip -= 1) {
+            ++begin;
+        }
+        if (begin == end) {
+            return reservoir;
+        }
+        reservoir[uniformInteger<std::size_t>(generator, 0, k - 1)] = *begin;
+        ++begin;
+        w *= std::exp(std::log(uniformOpenUnit(generator)) / count);
+    }
+}
+
+// Weighted reservoir sampling without replacement, A-ExpJ (Efraimidis & Spirakis, 2006). Every element gets the key
+// u^(1 / weight) and the k elements with the largest keys are kept. Instead of drawing a key for every element, the total weight
+// that can be skipped before an element beats the smallest kept key is drawn at once
+template<class Iterator, class WeightFunc, class Generator>
+std::vector<ValueType<Iterator>>
+weightedSampleImpl(Iterator begin, const Iterator end, const std::size_t k, WeightFunc weightFunc, Generator& generator) {
+    using Entry = std::pair<double, ValueType<Iterator>>;
+    const auto largerKey = [](const Entry& a, const Entry& b) {
+        return a.first > b.first;
+    };
+    // Min heap of the keys, the front is the element that is replaced next
+    std::vector<Entry> heap;
+    heap.reserve(k);
+    for (; begin != end && heap.size() < k; ++begin) {
+        auto&& value = *begin;
+        const double weight = static_cast<double>(weightFunc(value));
+        if (weight > 0) {
+            heap.emplace_back(std::pow(uniformOpenUnit(generator), 1. / weight), value);
+            std::push_heap(heap.begin(), heap.end(), largerKey);
+        }
+    }
+
+    if (k != 0 && heap.size() == k) {
+        double skipWeight = std::log(uniformOpenUnit(generator)) / std::log(heap.front().first);
+        for (; begin != end; ++begin) {
+            auto&& value = *begin;
+            const double weight = static_cast<double>(weightFunc(value));
+            if (weight <= 0) {
+                continue;
+            }
+            skipWeight -= weight;
+            if (skipWeight > 0) {
+                continue;
+            }
+            // The new key is drawn from (smallest key, 1], so that the element is guaranteed to enter the reservoir
+            const double threshold = std::pow(heap.front().first, weight);
+            const double key = std::pow(threshold + (1. - threshold) * uniformUnit<double>(generator), 1. / weight);
+            std::pop_heap(heap.begin(), heap.end(), largerKey);
+            heap.back() = Entry(key, value);
+            std::push_heap(heap.begin(), heap.end(), largerKey);
+            skipWeight = std::log(uniformOpenUnit(generator)) / std::log(heap.front().first);
+        }
+    }
+
+    std::vector<ValueType<Iterator>> result;
+    result.reserve(heap.size());
+    for (Entry& entry : heap) {
+        result.push_back(std::move(entry.second));
+    }
+    return result;
+}
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_SAMPLE_HPP
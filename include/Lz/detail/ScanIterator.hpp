@@ -0,0 +1,203 @@
+#pragma once
+
+#ifndef LZ_SCAN_ITERATOR_HPP
+#    define LZ_SCAN_ITERATOR_HPP
+
+#    include "FunctionContainer.hpp"
+#    include "LzTools.hpp"
+#    include "Parallel.hpp"
+#    include "Reduce.hpp"
+
+#    include <vector>
+
+namespace lz {
+namespace internal {
+// An inclusive scan holds the reduction of all elements up to and including the current one, an exclusive scan the reduction
+// of all elements before the current one, starting with an initial value. Both have as many elements as the input.
+template<class Iterator, class T, class BinaryOp, bool IsInclusive>
+class ScanIterator {
+    Iterator _iterator{};
+    Iterator _end{};
+    T _value{};
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<BinaryOp> _binaryOp{};
+
+    using IterTraits = std::iterator_traits<Iterator>;
+
+    LZ_CONSTEXPR_CXX_20 void advance(std::true_type /* isInclusive */) {
+        ++_iterator;
+        if (_iterator != _end) {
+            _value = _binaryOp(std::move(_value), *_iterator);
+        }
+    }
+
+    LZ_CONSTEXPR_CXX_20 void advance(std::false_type /* isInclusive */) {
+        _value = _binaryOp(std::move(_value), *_iterator);
+        ++_iterator;
+    }
+
+    static LZ_CONSTEXPR_CXX_20 T
+    initialValue(std::true_type /* isInclusive */, const Iterator& iterator, const Iterator& end, T init) {
+        return iterator != end ? T(*iterator) : std::move(init);
+    }
+
+    static LZ_CONSTEXPR_CXX_20 T initialValue(std::false_type /* isInclusive */, const Iterator&, const Iterator&, T init) {
+        return init;
+    }
+
+public:
+    using iterator_category = typename std::common_type<std::forward_iterator_tag, typename IterTraits::iterator_category>::type;
+    using value_type = T;
+    using reference = T;
+    using difference_type = typename IterTraits::difference_type;
+    using pointer = FakePointerProxy<reference>;
+
+    // For inclusive scans, `init` is only used if `iterator` is at the end, the first value is `*iterator`
+    LZ_CONSTEXPR_CXX_20 ScanIterator(Iterator iterator, Iterator end, T init, BinaryOp binaryOp) :
+        _iterator(std::move(iterator)),
+        _end(std::move(end)),
+        _value(initialValue(std::integral_constant<bool, IsInclusive>(), _iterator, _end, std::move(init))),
+        _binaryOp(std::move(binaryOp)) {
+    }
+
+    constexpr ScanIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return _value;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsSized<I>::value, difference_type> sizeTo(const ScanIterator& end) const {
+        return getIterLength(_iterator, end._iterator);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHintTo(const ScanIterator& end) const {
+        return sizeHint(_iterator, end._iterator);
+    }
+
+    LZ_CONSTEXPR_CXX_20 ScanIterator& operator++() {
+        advance(std::integral_constant<bool, IsInclusive>());
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 ScanIterator operator++(int) {
+        ScanIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const ScanIterator& a, const ScanIterator& b) {
+        return a._iterator == b._iterator;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const ScanIterator& a, const ScanIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+
+// Pass one of a blocked scan: the reductions of all blocks but the last one, which no other block depends on
+template<class Iterator, class T, class BinaryOp>
+std::vector<PartialResult<T>> scanBlockSums(const Iterator& begin, const std::size_t length, const std::size_t blockCount,
+                                            const BinaryOp& binOp, ThreadPool& pool) {
+    using Diff = DiffType<Iterator>;
+    std::vector<PartialResult<T>> sums(blockCount - 1, PartialResult<T>{ T(*begin) });
+    pool.parallelFor(blockCount - 1, [&](const std::size_t block) {
+        const Iterator first = begin + static_cast<Diff>(length * block / blockCount);
+        const Iterator last = begin + static_cast<Diff>(length * (block + 1) / blockCount);
+        sums[block].value = sumFold(std::next(first), last, T(*first), binOp);
+    });
+    return sums;
+}
+
+// Pass two of a blocked scan: every block is scanned again, starting with the reduction of all blocks before it
+template<class Iterator, class OutputIterator, class T, class BinaryOp>
+OutputIterator scanBlock(std::true_type /* isInclusive */, Iterator first, const Iterator& last, OutputIterator out, T value,
+                         const BinaryOp& binOp) {
+    for (; first != last; ++first, ++out) {
+        value = binOp(std::move(value), *first);
+        *out = value;
+    }
+    return out;
+}
+
+template<class Iterator, class OutputIterator, class T, class BinaryOp>
+OutputIterator scanBlock(std::false_type /* isInclusive */, Iterator first, const Iterator& last, OutputIterator out, T value,
+                         const BinaryOp& binOp) {
+    for (; first != last; ++first, ++out) {
+        *out = value;
+        value = binOp(std::move(value), *first);
+    }
+    return out;
+}
+
+// Two pass blocked scan (Blelloch): the blocks are first reduced in parallel, the prefixes of the block reductions are computed
+// on the calling thread, after which every block is scanned in parallel, starting with its prefix. `init` is the value the
+// first block starts with; for inclusive scans, the first block instead starts with its first element if there is no `init`
+template<class Iterator, class OutputIterator, class T, class BinaryOp, bool IsInclusive>
+OutputIterator parallelScan(std::true_type /* isRandomAccess */, std::integral_constant<bool, IsInclusive> isInclusive,
+                            const Iterator& begin, const Iterator& end, OutputIterator out, T init, const bool hasInit,
+                            const BinaryOp& binOp, ThreadPool& pool) {
+    using Diff = DiffType<Iterator>;
+    using OutDiff = DiffType<OutputIterator>;
+    const auto length = static_cast<std::size_t>(end - begin);
+    if (length == 0) {
+        return out;
+    }
+    const std::size_t blockCount = parallelBlockCount(pool, length);
+    std::vector<PartialResult<T>> prefixes;
+    prefixes.reserve(blockCount);
+    if (hasInit) {
+        prefixes.push_back(PartialResult<T>{ std::move(init) });
+    }
+    if (blockCount > 1) {
+        std::vector<PartialResult<T>> sums = scanBlockSums<Iterator, T>(begin, length, blockCount, binOp, pool);
+        for (PartialResult<T>& sum : sums) {
+            if (prefixes.empty()) {
+                prefixes.push_back(std::move(sum));
+            }
+            else {
+                prefixes.push_back(PartialResult<T>{ binOp(T(prefixes.back().value), std::move(sum.value)) });
+            }
+        }
+    }
+
+    pool.parallelFor(blockCount, [&](const std::size_t block) {
+        const auto from = static_cast<Diff>(length * block / blockCount);
+        Iterator first = begin + from;
+        const Iterator last = begin + static_cast<Diff>(length * (block + 1) / blockCount);
+        OutputIterator blockOut = out + static_cast<OutDiff>(from);
+        if (hasInit || block > 0) {
+            scanBlock(isInclusive, first, last, blockOut, T(prefixes[hasInit ? block : block - 1].value), binOp);
+            return;
+        }
+        // The first element of an inclusive scan without an initial value is the first element itself
+        T value(*first);
+        *blockOut = value;
+        scanBlock(isInclusive, std::next(first), last, std::next(blockOut), std::move(value), binOp);
+    });
+    return out + static_cast<OutDiff>(length);
+}
+
+template<class Iterator, class OutputIterator, class T, class BinaryOp, bool IsInclusive>
+OutputIterator parallelScan(std::false_type /* isRandomAccess */, std::integral_constant<bool, IsInclusive> isInclusive,
+                            Iterator begin, const Iterator& end, OutputIterator out, T init, const bool hasInit,
+                            const BinaryOp& binOp, ThreadPool&) {
+    if (begin == end) {
+        return out;
+    }
+    if (!hasInit) {
+        init = *begin;
+        *out = init;
+        ++begin;
+        ++out;
+    }
+    return scanBlock(isInclusive, std::move(begin), end, std::move(out), std::move(init), binOp);
+}
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_SCAN_ITERATOR_HPP
@@ -0,0 +1,253 @@
+#pragma once
+
+#ifndef LZ_SET_OPERATION_ITERATOR_HPP
+#    define LZ_SET_OPERATION_ITERATOR_HPP
+
+#    include "BlockFind.hpp"
+#    include "FunctionContainer.hpp"
+#    include "LzTools.hpp"
+
+namespace lz {
+namespace internal {
+struct SetIntersection {
+    static constexpr bool yieldsFromB = false;
+};
+
+struct SetUnion {
+    static constexpr bool yieldsFromB = true;
+};
+
+struct SetDifference {
+    static constexpr bool yieldsFromB = false;
+};
+
+struct SetSymmetricDifference {
+    static constexpr bool yieldsFromB = true;
+};
+
+// Whether the lower bound of a `T` in [begin, end) can be searched for with the block kernels
+template<class Iterator, class T, class Compare>
+struct IsBlockSkippable
+    : std::integral_constant<bool, IsBlockSearchable<Iterator, T>::value && IsDefaultLess<Compare, T>::value> {};
+
+// The first element of the sorted [first, last) that is not less than `value`, where *first is known to be less. The distance
+// to it is doubled until it is overshot, which takes O(log d) comparisons for a distance d, instead of the O(log n) of a binary
+// search over the rest of the sequence, or the O(d) of a linear one
+template<class Iterator, class T, class Compare>
+Iterator gallopLowerBound(Iterator first, const Iterator& last, const T& value, const Compare& compare) {
+    using Diff = DiffType<Iterator>;
+    Diff step = 1;
+    while (step < last - first && compare(first[step], value)) {
+        first += step;
+        step *= 2;
+    }
+    // The lower bound is in (first, first + step]
+    Diff count = std::min(step, last - first) - 1;
+    ++first;
+    while (count > 0) {
+        const Diff half = count / 2;
+        if (compare(first[half], value)) {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else {
+            count = half;
+        }
+    }
+    return first;
+}
+
+template<class Iterator, class T, class Compare>
+Iterator lowerBoundFrom(std::false_type /* isRandomAccess */, Iterator first, const Iterator& last, const T& value,
+                        const Compare& compare) {
+    while (first != last && compare(*first, value)) {
+        ++first;
+    }
+    return first;
+}
+
+template<class Iterator, class T, class Compare>
+Iterator lowerBoundFrom(std::true_type /* isRandomAccess */, Iterator first, const Iterator& last, const T& value,
+                        const Compare& compare) {
+    return gallopLowerBound(std::move(first), last, value, compare);
+}
+
+// Most skips of an intersection of sequences with a similar length are short, so the first block after `first` is searched
+// with a (vectorized) count of the elements that are less, and only longer skips gallop
+template<class Iterator, class T, class Compare>
+Iterator lowerBoundFrom(std::true_type /* isBlockSkippable */, std::true_type /* isRandomAccess */, Iterator first,
+                        const Iterator& last, const T& value, const Compare& compare) {
+    if (static_cast<std::size_t>(last - first) < BlockLength<T>::value) {
+        return gallopLowerBound(std::move(first), last, value, compare);
+    }
+    const std::size_t less = blockCountLess(contiguousData(first, last), value);
+    if (less != BlockLength<T>::value) {
+        return first + static_cast<DiffType<Iterator>>(less);
+    }
+    first += static_cast<DiffType<Iterator>>(less - 1);
+    return gallopLowerBound(std::move(first), last, value, compare);
+}
+
+template<class Iterator, class T, class Compare>
+Iterator lowerBoundFrom(std::false_type /* isBlockSkippable */, std::true_type isRandomAccess, Iterator first,
+                        const Iterator& last, const T& value, const Compare& compare) {
+    return lowerBoundFrom(isRandomAccess, std::move(first), last, value, compare);
+}
+
+template<class Iterator, class T, class Compare>
+Iterator lowerBoundFrom(std::false_type /* isBlockSkippable */, std::false_type isRandomAccess, Iterator first,
+                        const Iterator& last, const T& value, const Compare& compare) {
+    return lowerBoundFrom(isRandomAccess, std::move(first), last, value, compare);
+}
+
+// Skips to the first element of the sorted [first, last) that is not less than `value`, where *first is known to be less
+template<class Iterator, class T, class Compare>
+Iterator skipLess(Iterator first, const Iterator& last, const T& value, const Compare& compare) {
+    return lowerBoundFrom(IsBlockSkippable<Iterator, Decay<T>, Compare>(), IsRandomAccess<Iterator>(), std::move(first), last,
+                          value, compare);
+}
+
+template<class Operation, class IteratorA, class IteratorB>
+using SetOperationReference =
+    Conditional<!Operation::yieldsFromB || std::is_same<RefType<IteratorA>, RefType<IteratorB>>::value, RefType<IteratorA>,
+                ValueType<IteratorA>>;
+
+// Walks both sorted sequences at once, as the std::set_* algorithms do, so elements that occur m times in A and n times in B
+// occur min(m, n) times in the intersection, max(m, n) times in the union, max(m - n, 0) times in the difference and |m - n|
+// times in the symmetric difference. The iterator is at the end if both sequences are
+template<class IteratorA, class IteratorB, class Compare, class Operation>
+class SetOperationIterator {
+    IteratorA _a{};
+    IteratorA _endA{};
+    IteratorB _b{};
+    IteratorB _endB{};
+    FunctionContainer<Compare> _compare{};
+    bool _fromB{};
+    bool _fromBoth{};
+
+    void settle(SetIntersection) {
+        while (_a != _endA && _b != _endB) {
+            if (_compare(*_a, *_b)) {
+                auto&& value = *_b;
+                _a = skipLess(std::move(_a), _endA, value, _compare);
+            }
+            else if (_compare(*_b, *_a)) {
+                auto&& value = *_a;
+                _b = skipLess(std::move(_b), _endB, value, _compare);
+            }
+            else {
+                return;
+            }
+        }
+        _a = _endA;
+        _b = _endB;
+    }
+
+    void settle(SetUnion) {
+        if (_a == _endA || _b == _endB) {
+            _fromB = _a == _endA;
+            _fromBoth = false;
+            return;
+        }
+        _fromB = _compare(*_b, *_a);
+        _fromBoth = !_fromB && !_compare(*_a, *_b);
+    }
+
+    void settle(SetDifference) {
+        while (_a != _endA && _b != _endB) {
+            if (_compare(*_a, *_b)) {
+                return;
+            }
+            if (_compare(*_b, *_a)) {
+                auto&& value = *_a;
+                _b = skipLess(std::move(_b), _endB, value, _compare);
+            }
+            else {
+                ++_a;
+                ++_b;
+            }
+        }
+        if (_a == _endA) {
+            _b = _endB;
+        }
+    }
+
+    void settle(SetSymmetricDifference) {
+        while (_a != _endA && _b != _endB) {
+            if (_compare(*_a, *_b)) {
+                _fromB = false;
+                return;
+            }
+            if (_compare(*_b, *_a)) {
+                _fromB = true;
+                return;
+            }
+            ++_a;
+            ++_b;
+        }
+        _fromB = _a == _endA;
+    }
+
+public:
+    using value_type = ValueType<IteratorA>;
+    using reference = SetOperationReference<Operation, IteratorA, IteratorB>;
+    using pointer = FakePointerProxy<reference>;
+    using difference_type = typename std::common_type<DiffType<IteratorA>, DiffType<IteratorB>>::type;
+    using iterator_category =
+        typename std::common_type<std::forward_iterator_tag, IterCat<IteratorA>, IterCat<IteratorB>>::type;
+
+    SetOperationIterator(IteratorA a, IteratorA endA, IteratorB b, IteratorB endB, Compare compare) :
+        _a(std::move(a)),
+        _endA(std::move(endA)),
+        _b(std::move(b)),
+        _endB(std::move(endB)),
+        _compare(std::move(compare)) {
+        settle(Operation());
+    }
+
+    SetOperationIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        if (_fromB) {
+            return *_b;
+        }
+        return *_a;
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    SetOperationIterator& operator++() {
+        if (std::is_same<Operation, SetIntersection>::value || _fromBoth) {
+            ++_a;
+            ++_b;
+        }
+        else if (_fromB) {
+            ++_b;
+        }
+        else {
+            ++_a;
+        }
+        settle(Operation());
+        return *this;
+    }
+
+    SetOperationIterator operator++(int) {
+        SetOperationIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator==(const SetOperationIterator& a, const SetOperationIterator& b) {
+        return a._a == b._a && a._b == b._b;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const SetOperationIterator& a, const SetOperationIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_SET_OPERATION_ITERATOR_HPP
@@ -3,17 +3,27 @@
 #ifndef LZ_SPLIT_ITERATOR_HPP
 #    define LZ_SPLIT_ITERATOR_HPP
 
+#    include "BasicIteratorView.hpp"
+#    include "ByteMask.hpp"
 #    include "LzTools.hpp"
 
 #    include <string>
 
 namespace lz {
 namespace internal {
+// Splits the characters [data, data + size) on a delimiter. Only a pointer to the characters is kept, so `String` can be any
+// type with contiguous characters, e.g. a std::string, std::string_view or a plain buffer
 template<class SubString, class String, class StringType>
 class SplitIterator {
     std::size_t _currentPos{}, _lastPos{};
-    const String* _string{ nullptr };
+    const char* _data{ nullptr };
+    std::size_t _size{};
     StringType _delimiter{};
+    DelimiterScanner _scanner{};
+
+    std::size_t findDelimiter(const std::size_t from) {
+        return _scanner.find(_data, _size, from, _delimiter);
+    }
 
 #    ifdef __cpp_if_constexpr
     std::size_t getDelimiterLength() const { // NOLINT
@@ -36,19 +46,20 @@ class SplitIterator {
     }
 #    endif
 public:
-    using iterator_category =
-        typename std::common_type<std::bidirectional_iterator_tag, IterCat<typename String::const_iterator>>::type;
+    using iterator_category = std::bidirectional_iterator_tag;
     using value_type = SubString;
     using reference = SubString;
     using difference_type = std::ptrdiff_t;
     using pointer = FakePointerProxy<reference>;
 
-    LZ_CONSTEXPR_CXX_20 SplitIterator(const std::size_t startingPosition, const String& string, StringType delimiter) :
+    LZ_CONSTEXPR_CXX_20
+    SplitIterator(const std::size_t startingPosition, const char* data, const std::size_t size, StringType delimiter) :
         _currentPos(startingPosition),
-        _string(&string),
+        _data(data),
+        _size(size),
         _delimiter(std::move(delimiter)) {
         if (startingPosition == 0) {
-            _lastPos = _string->find(_delimiter);
+            _lastPos = findDelimiter(0);
         }
         else {
             _currentPos = startingPosition + getDelimiterLength();
@@ -59,10 +70,10 @@ public:
 
     LZ_CONSTEXPR_CXX_20 value_type operator*() const {
         if (_lastPos != std::string::npos) {
-            return SubString(&(*_string)[_currentPos], _lastPos - _currentPos);
+            return SubString(_data + _currentPos, _lastPos - _currentPos);
         }
         else {
-            return SubString(&(*_string)[_currentPos]);
+            return SubString(_data + _currentPos, _size - _currentPos);
         }
     }
 
@@ -70,6 +81,51 @@ public:
         return FakePointerProxy<decltype(**this)>(**this);
     }
 
+#    ifdef LZ_HAS_EXECUTION
+    // Calls `func` for every piece in [*this, end) on the pool of lz::execution::pool(). The characters are split into equally
+    // sized parts, of which the edges are moved forward past the next delimiter, so that every piece is handed to exactly one
+    // task. Every task then finds the pieces of its part with its own scanner. Delimiters of more than one character are split
+    // sequentially, because where their occurrences are depends on where the scan started if they can overlap, e.g. "aa"
+    template<class UnaryFunc>
+    void parallelForEach(const SplitIterator& end, const UnaryFunc& func) const {
+        if constexpr (!std::is_same_v<char, StringType>) {
+            for (SplitIterator it = *this; it != end; ++it) {
+                func(*it);
+            }
+        }
+        else {
+            // Finding a delimiter costs much less per character than processing an element of a sequence does, so a block
+            // is made of many more characters
+            constexpr std::size_t charactersPerElement = 64;
+            ThreadPool& pool = execution::pool().pool();
+            const std::size_t first = _currentPos;
+            const std::size_t last = end._currentPos;
+            const std::size_t length = last - first;
+            const auto pieceStart = [this, first, last, length](const std::size_t offset) {
+                const std::size_t position = first + offset;
+                if (offset == 0 || offset == length) {
+                    return position;
+                }
+                DelimiterScanner scanner;
+                const std::size_t delimiter = scanner.find(_data, _size, position - 1, _delimiter);
+                return delimiter == std::string::npos ? last : (std::min)(delimiter + 1, last);
+            };
+
+            parallelForBlocks(pool, length, parallelBlockCount(pool, length / charactersPerElement),
+                              [this, &pieceStart, &func](std::size_t /* block */, const std::size_t from, const std::size_t to) {
+                                  DelimiterScanner scanner;
+                                  const std::size_t partEnd = pieceStart(to);
+                                  for (std::size_t position = pieceStart(from); position < partEnd;) {
+                                      const std::size_t delimiter = scanner.find(_data, _size, position, _delimiter);
+                                      const std::size_t pieceEnd = delimiter == std::string::npos ? _size : delimiter;
+                                      func(SubString(_data + position, pieceEnd - position));
+                                      position = pieceEnd + 1;
+                                  }
+                              });
+        }
+    }
+#    endif // LZ_HAS_EXECUTION
+
     constexpr friend bool operator!=(const SplitIterator& a, const SplitIterator& b) noexcept {
         LZ_ASSERT(a._delimiter == b._delimiter, "incompatible iterator types, found different delimiters");
         return a._currentPos != b._currentPos;
@@ -81,11 +137,11 @@ public:
 
     LZ_CONSTEXPR_CXX_20 SplitIterator& operator++() {
         if (_lastPos == std::string::npos) {
-            _currentPos = _string->length() + getDelimiterLength();
+            _currentPos = _size + getDelimiterLength();
         }
         else {
             _currentPos = _lastPos + getDelimiterLength();
-            _lastPos = _string->find(_delimiter, _currentPos);
+            _lastPos = findDelimiter(_currentPos);
         }
         return *this;
     }
@@ -101,17 +157,48 @@ public:
         _lastPos = _currentPos - delimLen;
         _currentPos -= delimLen;
         if (_currentPos != 0) {
-            _currentPos = _string->rfind(_delimiter, _currentPos - 1) + delimLen;
+            const std::size_t previous = reverseFindDelimiter(_data, _size, _currentPos - 1, _delimiter);
+            _currentPos = previous == std::string::npos ? 0 : previous + delimLen;
         }
         return *this;
     }
 
-    LZ_CONSTEXPR_CXX_20 SplitIterator& operator--(int) {
+    LZ_CONSTEXPR_CXX_20 SplitIterator operator--(int) {
         SplitIterator tmp(*this);
         --*this;
         return tmp;
     }
 };
+
+// A type with contiguous characters that can be accessed using `data()` and `size()`
+template<class T, class = int>
+struct HasCharData : std::false_type {};
+
+template<class T>
+struct HasCharData<T, decltype((void)static_cast<const char*>(std::declval<const T&>().data()),
+                               (void)static_cast<std::size_t>(std::declval<const T&>().size()), 0)> : std::true_type {};
+
+template<class T>
+#    ifdef LZ_HAS_STRING_VIEW
+struct IsStringOrView
+    : std::integral_constant<bool, std::is_same<T, std::string>::value || std::is_same<T, std::string_view>::value> {};
+#    else
+struct IsStringOrView : std::is_same<T, std::string> {};
+#    endif // LZ_HAS_STRING_VIEW
+
+// A non owning type with contiguous characters, which can therefore safely be split as a temporary
+template<class T>
+#    if defined(LZ_HAS_STRING_VIEW)
+struct IsView : std::is_same<T, std::string_view> {};
+#    elif defined(LZ_STANDALONE)
+struct IsView : std::false_type {};
+#    else
+struct IsView : std::is_same<T, fmt::string_view> {};
+#    endif
+
+// A type with contiguous characters, other than std::string(_view), which have their own split overloads
+template<class T>
+struct IsCharBuffer : std::integral_constant<bool, HasCharData<T>::value && !IsStringOrView<T>::value> {};
 } // namespace internal
 } // namespace lz
 
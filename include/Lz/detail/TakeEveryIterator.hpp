@@ -5,8 +5,51 @@
 
 #    include "LzTools.hpp"
 
+#    include <memory>
+
 namespace lz {
 namespace internal {
+// The amount of strides by which an element is prefetched ahead, if the elements of a strided loop are at least a cache line
+// apart. Hardware prefetchers do not follow strides that large
+constexpr LZ_INLINE_VAR std::ptrdiff_t stridePrefetchDistance = 8;
+
+template<class Iterator>
+struct IsPrefetchable
+    : std::integral_constant<bool, IsRandomAccess<Iterator>::value && std::is_lvalue_reference<RefType<Iterator>>::value> {};
+
+// Feeds `begin[0], begin[stride], ..., begin[(count - 1) * stride]` to `sink`. The loop is indexed and knows its trip count, so
+// the compiler can turn it into gathers, and no end check is done per element
+template<class Iterator, class Sink>
+LZ_CONSTEXPR_CXX_20 bool stridedForEachWhile(std::false_type /* isPrefetchable */, const Iterator& begin,
+                                             const DiffType<Iterator> count, const DiffType<Iterator> stride, Sink& sink) {
+    for (DiffType<Iterator> i = 0; i < count; ++i) {
+        if (!sink(begin[i * stride])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class Iterator, class Sink>
+bool stridedForEachWhile(std::true_type /* isPrefetchable */, const Iterator& begin, const DiffType<Iterator> count,
+                         const DiffType<Iterator> stride, Sink& sink) {
+    DiffType<Iterator> i = 0;
+    if (static_cast<std::size_t>(stride) * sizeof(Decay<RefType<Iterator>>) >= cacheLineSize) {
+        for (; i + stridePrefetchDistance < count; ++i) {
+            prefetch(std::addressof(begin[(i + stridePrefetchDistance) * stride]));
+            if (!sink(begin[i * stride])) {
+                return false;
+            }
+        }
+    }
+    for (; i < count; ++i) {
+        if (!sink(begin[i * stride])) {
+            return false;
+        }
+    }
+    return true;
+}
+
 template<class, bool>
 class TakeEveryIterator;
 
@@ -177,6 +220,14 @@ public:
         return *this;
     }
 
+    // Random access iterators are iterated with a strided loop, see `stridedForEachWhile`
+    template<class Sink, class I = Iterator>
+    LZ_CONSTEXPR_CXX_20 EnableIf<IsRandomAccess<I>::value, bool> forEachWhile(const TakeEveryIterator& end, Sink& sink) const {
+        LZ_ASSERT(_offset == end._offset, "incompatible iterator types: different offsets");
+        const auto count = roundEven(end._iterator - _iterator, _offset);
+        return stridedForEachWhile(IsPrefetchable<Iterator>(), _iterator, count, _offset, sink);
+    }
+
     LZ_CONSTEXPR_CXX_20 TakeEveryIterator operator++(int) {
         TakeEveryIterator tmp(*this);
         ++*this;
@@ -226,6 +277,11 @@ public:
         return tmp;
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend TakeEveryIterator operator+(const difference_type offset,
+                                                                        const TakeEveryIterator& iterator) {
+        return iterator + offset;
+    }
+
     LZ_CONSTEXPR_CXX_20 TakeEveryIterator& operator-=(const difference_type offset) {
         return *this += -offset;
     }
@@ -236,7 +292,8 @@ public:
         return tmp;
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend difference_type
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend EnableIf<IsRandomAccess<I>::value, difference_type>
     operator-(const TakeEveryIterator& a, const TakeEveryIterator& b) {
         LZ_ASSERT(a._offset == b._offset, "incompatible iterator types: different offsets");
         return roundEven(a._iterator - b._iterator, a._offset);
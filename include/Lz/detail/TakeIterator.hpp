@@ -0,0 +1,111 @@
+#pragma once
+
+#ifndef LZ_TAKE_ITERATOR_HPP
+#define LZ_TAKE_ITERATOR_HPP
+
+#include "LzTools.hpp"
+
+namespace lz {
+namespace internal {
+template<class Sink, class Diff>
+struct TakeSink {
+    Sink& sink;
+    Diff remaining;
+    bool stopped;
+
+    template<class T>
+    LZ_CONSTEXPR_CXX_20 bool operator()(T&& value) {
+        if (!sink(std::forward<T>(value))) {
+            stopped = true;
+            return false;
+        }
+        return --remaining != 0;
+    }
+};
+
+// Yields at most `remaining` elements of [iterator, end). The amount is counted while iterating, so the end of the taken range
+// does not have to be searched for up front, which walks the sequence if `Iterator` is not random access
+template<class Iterator>
+class TakeIterator {
+    using IterTraits = std::iterator_traits<Iterator>;
+
+public:
+    using iterator_category = typename std::common_type<std::forward_iterator_tag, typename IterTraits::iterator_category>::type;
+    using value_type = typename IterTraits::value_type;
+    using difference_type = typename IterTraits::difference_type;
+    using reference = typename IterTraits::reference;
+    using pointer = FakePointerProxy<reference>;
+
+private:
+    Iterator _iterator{};
+    Iterator _end{};
+    difference_type _remaining{};
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool isDone() const {
+        return _remaining == 0 || _iterator == _end;
+    }
+
+public:
+    LZ_CONSTEXPR_CXX_20 TakeIterator(Iterator iterator, Iterator end, const difference_type remaining) :
+        _iterator(std::move(iterator)),
+        _end(std::move(end)),
+        _remaining(remaining) {
+        LZ_ASSERT(remaining >= 0, "amount to take cannot be negative");
+    }
+
+    constexpr TakeIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return *_iterator;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    LZ_CONSTEXPR_CXX_20 TakeIterator& operator++() {
+        ++_iterator;
+        --_remaining;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 TakeIterator operator++(int) {
+        TakeIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsSized<I>::value, difference_type> sizeTo(const TakeIterator& end) const {
+        const auto length = getIterLength(_iterator, end._iterator);
+        return length < _remaining ? length : _remaining;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHintTo(const TakeIterator& end) const {
+        const auto hint = sizeHint(_iterator, end._iterator);
+        const auto remaining = static_cast<std::size_t>(_remaining);
+        return { hint.lower < remaining ? hint.lower : remaining, hint.upper < remaining ? hint.upper : remaining };
+    }
+
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool forEachWhile(const TakeIterator& end, Sink& sink) {
+        if (isDone()) {
+            return true;
+        }
+        TakeSink<Sink, difference_type> takeSink{ sink, _remaining, false };
+        internal::forEachWhile(_iterator, end._iterator, takeSink);
+        return !takeSink.stopped;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const TakeIterator& a, const TakeIterator& b) {
+        return a.isDone() ? b.isDone() : !b.isDone() && a._iterator == b._iterator;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const TakeIterator& a, const TakeIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_TAKE_ITERATOR_HPP
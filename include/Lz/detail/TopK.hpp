@@ -0,0 +1,128 @@
+#pragma once
+
+#ifndef LZ_TOP_K_HPP
+#    define LZ_TOP_K_HPP
+
+#    include "FunctionContainer.hpp"
+#    include "LzTools.hpp"
+
+#    include <algorithm>
+#    include <utility>
+#    include <vector>
+
+namespace lz {
+namespace internal {
+template<class Compare>
+class ReverseCompare {
+    FunctionContainer<Compare> _compare;
+
+public:
+    explicit ReverseCompare(Compare compare) : _compare(std::move(compare)) {
+    }
+
+    template<class T, class U>
+    bool operator()(const T& a, const U& b) const {
+        return _compare(b, a);
+    }
+};
+
+// A max heap of the `k` smallest elements of [begin, end), the front being the largest of them. The input is read once and never
+// more than `k` elements are stored, so this takes O(n * log(k)) time and works on input iterators
+template<class Iterator, class Compare>
+std::vector<ValueType<Iterator>> smallestHeap(Iterator begin, const Iterator end, const std::size_t k, Compare compare) {
+    std::vector<ValueType<Iterator>> heap;
+    if (k == 0) {
+        return heap;
+    }
+    heap.reserve(k);
+    for (; begin != end && heap.size() < k; ++begin) {
+        heap.push_back(*begin);
+        std::push_heap(heap.begin(), heap.end(), compare);
+    }
+    for (; begin != end; ++begin) {
+        auto&& value = *begin;
+        if (compare(value, heap.front())) {
+            std::pop_heap(heap.begin(), heap.end(), compare);
+            heap.back() = value;
+            std::push_heap(heap.begin(), heap.end(), compare);
+        }
+    }
+    return heap;
+}
+
+template<class Iterator, class Compare>
+std::vector<ValueType<Iterator>> topKImpl(Iterator begin, Iterator end, const std::size_t k, Compare compare) {
+    // The k largest elements are the k smallest ones when the comparer is reversed
+    ReverseCompare<Compare> reversed(std::move(compare));
+    std::vector<ValueType<Iterator>> heap = smallestHeap(std::move(begin), std::move(end), k, reversed);
+    std::sort_heap(heap.begin(), heap.end(), reversed);
+    return heap;
+}
+
+// The `n` elements of [begin, end) with the largest keys, largest key first. Like `smallestHeap`, but the heap stores the key of
+// every element next to it, so that every element is dereferenced once and every key is computed once
+template<class Iterator, class KeySelector, class Compare>
+std::vector<ValueType<Iterator>>
+topNImpl(Iterator begin, const Iterator& end, const std::size_t n, const KeySelector& keySelector, const Compare& compare) {
+    using Key = Decay<FunctionReturnType<KeySelector, RefType<Iterator>>>;
+    using Entry = std::pair<Key, ValueType<Iterator>>;
+    // The front of the heap is the entry with the smallest key, which is the first to be replaced
+    const auto largerKey = [&compare](const Entry& a, const Entry& b) {
+        return compare(b.first, a.first);
+    };
+    std::vector<Entry> heap;
+    if (n == 0) {
+        return {};
+    }
+    heap.reserve(n);
+    for (; begin != end; ++begin) {
+        auto&& value = *begin;
+        auto key = keySelector(value);
+        if (heap.size() < n) {
+            heap.emplace_back(std::move(key), std::forward<decltype(value)>(value));
+            std::push_heap(heap.begin(), heap.end(), largerKey);
+        }
+        else if (compare(heap.front().first, key)) {
+            std::pop_heap(heap.begin(), heap.end(), largerKey);
+            heap.back().first = std::move(key);
+            heap.back().second = std::forward<decltype(value)>(value);
+            std::push_heap(heap.begin(), heap.end(), largerKey);
+        }
+    }
+    std::sort_heap(heap.begin(), heap.end(), largerKey);
+    std::vector<ValueType<Iterator>> result;
+    result.reserve(heap.size());
+    for (Entry& entry : heap) {
+        result.push_back(std::move(entry.second));
+    }
+    return result;
+}
+
+// The first element of [begin, end) of which no other key goes before its key according to `goesBefore`. Unlike a comparer
+// that projects both elements, every element is dereferenced once and every key is computed once
+template<class Iterator, class KeySelector, class GoesBefore>
+ValueType<Iterator> extremeBy(Iterator begin, const Iterator& end, const KeySelector& keySelector, const GoesBefore& goesBefore) {
+    LZ_ASSERT(begin != end, "sequence cannot be empty in order to get the element with the smallest or largest key");
+    ValueType<Iterator> best = *begin;
+    auto bestKey = keySelector(best);
+    for (++begin; begin != end; ++begin) {
+        auto&& value = *begin;
+        auto key = keySelector(value);
+        if (goesBefore(key, bestKey)) {
+            best = std::forward<decltype(value)>(value);
+            bestKey = std::move(key);
+        }
+    }
+    return best;
+}
+
+template<class Iterator, class Compare>
+ValueType<Iterator> nthSmallestImpl(Iterator begin, Iterator end, const std::size_t n, Compare compare) {
+    std::vector<ValueType<Iterator>> heap = smallestHeap(std::move(begin), std::move(end), n + 1, compare);
+    LZ_ASSERT(heap.size() == n + 1, "the sequence must have more than n elements");
+    return std::move(heap.front());
+}
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_TOP_K_HPP
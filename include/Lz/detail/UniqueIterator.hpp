@@ -20,7 +20,8 @@ class UniqueIterator {
 
     Iterator _iterator{};
     Iterator _end{};
-    mutable FunctionContainer<Compare> _compare{};
+    LZ_NO_UNIQUE_ADDRESS
+    FunctionContainer<Compare> _compare{};
 #ifdef LZ_HAS_EXECUTION
     LZ_NO_UNIQUE_ADDRESS
     Execution _execution;
@@ -59,13 +60,17 @@ public:
         return FakePointerProxy<decltype(**this)>(**this);
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHintTo(const UniqueIterator& end) const {
+        return upperBoundSizeHint(_iterator, end._iterator);
+    }
+
     LZ_CONSTEXPR_CXX_20 UniqueIterator& operator++() {
 #ifdef LZ_HAS_EXECUTION
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             _iterator = std::adjacent_find(std::move(_iterator), _end, _compare);
         }
         else {
-            _iterator = std::adjacent_find(_execution, std::move(_iterator), _end, _compare);
+            _iterator = internal::adjacentFindBatched(_execution, std::move(_iterator), _end, _compare);
         }
 #else  // ^^^ lz has execution vvv ! lz has execution
         _iterator = std::adjacent_find(std::move(_iterator), _end, _compare);
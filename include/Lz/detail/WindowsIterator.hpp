@@ -0,0 +1,326 @@
+#pragma once
+
+#ifndef LZ_WINDOWS_ITERATOR_HPP
+#    define LZ_WINDOWS_ITERATOR_HPP
+
+#    include "BasicIteratorView.hpp"
+#    include "LzTools.hpp"
+
+#    include <deque>
+#    include <memory>
+
+namespace lz {
+namespace internal {
+// A window is [_first, _last], so that the past the end iterator, of which _last is the end of the sequence, is distinct from
+// the last window
+template<class Iterator>
+class WindowsIterator {
+    using IterTraits = std::iterator_traits<Iterator>;
+
+public:
+    using iterator_category = typename IterTraits::iterator_category;
+    using value_type = BasicIteratorView<Iterator>;
+    using reference = value_type;
+    using pointer = FakePointerProxy<value_type>;
+    using difference_type = typename IterTraits::difference_type;
+
+private:
+    Iterator _first{};
+    Iterator _last{};
+
+public:
+    LZ_CONSTEXPR_CXX_20 WindowsIterator(Iterator first, Iterator last) : _first(std::move(first)), _last(std::move(last)) {
+    }
+
+    constexpr WindowsIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return { _first, std::next(_last) };
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    LZ_CONSTEXPR_CXX_20 WindowsIterator& operator++() {
+        ++_first;
+        ++_last;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 WindowsIterator operator++(int) {
+        WindowsIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_20 WindowsIterator& operator--() {
+        --_first;
+        --_last;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 WindowsIterator operator--(int) {
+        WindowsIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_20 WindowsIterator& operator+=(const difference_type offset) {
+        _first += offset;
+        _last += offset;
+        return *this;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 WindowsIterator operator+(const difference_type offset) const {
+        WindowsIterator tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend WindowsIterator operator+(const difference_type offset,
+                                                                      const WindowsIterator& iterator) {
+        return iterator + offset;
+    }
+
+    LZ_CONSTEXPR_CXX_20 WindowsIterator& operator-=(const difference_type offset) {
+        return *this += -offset;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 WindowsIterator operator-(const difference_type offset) const {
+        WindowsIterator tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend EnableIf<IsRandomAccess<I>::value, difference_type>
+    operator-(const WindowsIterator& a, const WindowsIterator& b) {
+        return a._last - b._last;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator[](const difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const WindowsIterator& a, const WindowsIterator& b) {
+        return a._last == b._last;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const WindowsIterator& a, const WindowsIterator& b) {
+        return !(a == b); // NOLINT
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator<(const WindowsIterator& a, const WindowsIterator& b) {
+        return b - a > 0;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>(const WindowsIterator& a, const WindowsIterator& b) {
+        return b < a;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator<=(const WindowsIterator& a, const WindowsIterator& b) {
+        return !(b < a); // NOLINT
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>=(const WindowsIterator& a, const WindowsIterator& b) {
+        return !(a < b); // NOLINT
+    }
+};
+
+// The sum of the window is kept up to date by adding the element that enters it and subtracting the one that leaves it
+template<class Iterator>
+class SlidingSumIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Decay<ValueType<Iterator>>;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+    using difference_type = DiffType<Iterator>;
+
+private:
+    Iterator _first{};
+    Iterator _last{};
+    Iterator _end{};
+    value_type _sum{};
+
+public:
+    LZ_CONSTEXPR_CXX_20 SlidingSumIterator(Iterator begin, Iterator end, const std::size_t windowSize) :
+        _first(begin),
+        _last(std::move(begin)),
+        _end(std::move(end)) {
+        if (_last == _end) {
+            return;
+        }
+        _sum = *_last;
+        for (std::size_t count = 1; count < windowSize; ++count) {
+            if (++_last == _end) {
+                return;
+            }
+            _sum += *_last;
+        }
+    }
+
+    constexpr SlidingSumIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const noexcept {
+        return _sum;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const noexcept {
+        return std::addressof(_sum);
+    }
+
+    LZ_CONSTEXPR_CXX_20 SlidingSumIterator& operator++() {
+        _sum -= *_first;
+        ++_first;
+        if (++_last != _end) {
+            _sum += *_last;
+        }
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 SlidingSumIterator operator++(int) {
+        SlidingSumIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const SlidingSumIterator& a, const SlidingSumIterator& b) {
+        return a._last == b._last;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const SlidingSumIterator& a, const SlidingSumIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+
+// Keeps the candidates for the extreme of the window in a monotonic deque: an element that is not better than one that entered
+// after it can never become the extreme, so it is removed when the newer one enters. The front of the deque is then the extreme
+// of the window, and every element is pushed and popped once, which is O(1) amortized per step
+template<class Iterator, class Compare>
+class SlidingExtremeState {
+public:
+    using value_type = Decay<ValueType<Iterator>>;
+
+private:
+    Iterator _iterator;
+    Iterator _end;
+    std::size_t _windowSize;
+    std::size_t _index{ 0 };
+    std::deque<std::pair<std::size_t, value_type>> _candidates;
+    Compare _compare;
+    bool _isStarted{ false };
+    bool _isEnd{ false };
+
+    void push() {
+        value_type value = *_iterator;
+        ++_iterator;
+        while (!_candidates.empty() && !_compare(_candidates.back().second, value)) {
+            _candidates.pop_back();
+        }
+        _candidates.emplace_back(_index, std::move(value));
+        ++_index;
+        if (_candidates.front().first + _windowSize < _index) {
+            _candidates.pop_front();
+        }
+    }
+
+public:
+    SlidingExtremeState(Iterator begin, Iterator end, const std::size_t windowSize, Compare compare) :
+        _iterator(std::move(begin)),
+        _end(std::move(end)),
+        _windowSize(windowSize),
+        _compare(std::move(compare)) {
+    }
+
+    SlidingExtremeState(const SlidingExtremeState&) = delete;
+    SlidingExtremeState& operator=(const SlidingExtremeState&) = delete;
+
+    void start() {
+        if (_isStarted) {
+            return;
+        }
+        _isStarted = true;
+        while (_index != _windowSize && _iterator != _end) {
+            push();
+        }
+        _isEnd = _index != _windowSize;
+    }
+
+    void next() {
+        if (_iterator == _end) {
+            _isEnd = true;
+            return;
+        }
+        push();
+    }
+
+    const value_type& current() const noexcept {
+        return _candidates.front().second;
+    }
+
+    bool isEnd() const noexcept {
+        return _isEnd;
+    }
+};
+
+template<class Iterator, class Compare>
+class SlidingExtremeIterator {
+    using State = SlidingExtremeState<Iterator, Compare>;
+
+    std::shared_ptr<State> _state{};
+
+    bool isEnd() const {
+        if (!_state) {
+            return true;
+        }
+        _state->start();
+        return _state->isEnd();
+    }
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = typename State::value_type;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+    using difference_type = DiffType<Iterator>;
+
+    explicit SlidingExtremeIterator(std::shared_ptr<State> state) noexcept : _state(std::move(state)) {
+    }
+
+    SlidingExtremeIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        _state->start();
+        return _state->current();
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return std::addressof(**this);
+    }
+
+    SlidingExtremeIterator& operator++() {
+        _state->start();
+        _state->next();
+        return *this;
+    }
+
+    SlidingExtremeIterator operator++(int) {
+        SlidingExtremeIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator==(const SlidingExtremeIterator& a, const SlidingExtremeIterator& b) {
+        return a.isEnd() == b.isEnd();
+    }
+
+    LZ_NODISCARD friend bool operator!=(const SlidingExtremeIterator& a, const SlidingExtremeIterator& b) {
+        return !(a == b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_WINDOWS_ITERATOR_HPP
@@ -0,0 +1,58 @@
+#pragma once
+
+#ifndef LZ_WRITE_SINK_HPP
+#    define LZ_WRITE_SINK_HPP
+
+#    include "LzTools.hpp"
+
+#    include <algorithm>
+#    include <cerrno>
+#    include <cstdio>
+#    include <system_error>
+
+#    ifdef _WIN32
+#        include <io.h>
+#    else
+#        include <unistd.h>
+#    endif // _WIN32
+
+namespace lz {
+namespace internal {
+// The amount of bytes that `writeTo` collects before it writes them at once
+constexpr LZ_INLINE_VAR std::size_t defaultWriteBlockSize = std::size_t{ 1 } << 20;
+
+struct FileDescriptorSink {
+    int fileDescriptor;
+
+    // Writes all of [data, data + size), as a write may write less than it was asked to
+    void operator()(const char* data, std::size_t size) const {
+        while (size != 0) {
+#    ifdef _WIN32
+            const auto count = ::_write(fileDescriptor, data, static_cast<unsigned>((std::min)(size, std::size_t{ 1 } << 30)));
+#    else
+            const auto count = ::write(fileDescriptor, data, size);
+#    endif // _WIN32
+            if (count >= 0) {
+                data += count;
+                size -= static_cast<std::size_t>(count);
+            }
+            else if (errno != EINTR) {
+                throw std::system_error(errno, std::generic_category(), "lz::writeTo: cannot write to file descriptor");
+            }
+        }
+    }
+};
+
+struct FileSink {
+    std::FILE* file;
+
+    void operator()(const char* data, const std::size_t size) const {
+        if (std::fwrite(data, 1, size, file) != size) {
+            throw std::system_error(errno, std::generic_category(), "lz::writeTo: cannot write to file");
+        }
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_WRITE_SINK_HPP
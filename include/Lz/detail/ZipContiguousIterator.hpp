@@ -0,0 +1,161 @@
+#pragma once
+
+#ifndef LZ_ZIP_CONTIGUOUS_ITERATOR_HPP
+#    define LZ_ZIP_CONTIGUOUS_ITERATOR_HPP
+
+#    include "LzTools.hpp"
+
+namespace lz {
+namespace internal {
+// Zips contiguous sequences as a structure of arrays: instead of a tuple of iterators that are all incremented and compared,
+// only the base pointers and a single shared index are stored. Incrementing, comparing and computing distances only touch the
+// index, and dereferencing is `base[index]` for every sequence, which is the same loop a hand written indexed loop gives
+template<class... Pointers>
+class ZipContiguousIterator {
+    static_assert(sizeof...(Pointers) > 1, "zipContiguous requires more than 1 container/iterable");
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::tuple<ValueType<Pointers>...>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::tuple<RefType<Pointers>...>;
+    using pointer = FakePointerProxy<reference>;
+
+private:
+    using MakeIndexSequenceForThis = MakeIndexSequence<sizeof...(Pointers)>;
+    std::tuple<Pointers...> _bases{};
+    difference_type _index{};
+
+    template<std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 reference dereference(IndexSequence<I...>, const difference_type index) const {
+        return reference(std::get<I>(_bases)[index]...);
+    }
+
+    template<class Sink, std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 bool forEachWhile(IndexSequence<I...>, const difference_type last, Sink& sink) const {
+        // The base pointers are copied into locals, so that the compiler knows they don't change during the loop
+        const std::tuple<Pointers...> bases = _bases;
+        for (difference_type index = _index; index != last; ++index) {
+            if (!sink(reference(std::get<I>(bases)[index]...))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+public:
+    LZ_CONSTEXPR_CXX_20 ZipContiguousIterator(std::tuple<Pointers...> bases, const difference_type index) :
+        _bases(std::move(bases)),
+        _index(index) {
+    }
+
+    constexpr ZipContiguousIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return dereference(MakeIndexSequenceForThis(), _index);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    LZ_NODISCARD constexpr difference_type index() const noexcept {
+        return _index;
+    }
+
+    template<class Sink>
+    LZ_CONSTEXPR_CXX_20 bool forEachWhile(const ZipContiguousIterator& end, Sink& sink) const {
+        return forEachWhile(MakeIndexSequenceForThis(), end._index, sink);
+    }
+
+    LZ_CONSTEXPR_CXX_20 ZipContiguousIterator& operator++() noexcept {
+        ++_index;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 ZipContiguousIterator operator++(int) noexcept {
+        ZipContiguousIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_20 ZipContiguousIterator& operator--() noexcept {
+        --_index;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 ZipContiguousIterator operator--(int) noexcept {
+        ZipContiguousIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_20 ZipContiguousIterator& operator+=(const difference_type offset) noexcept {
+        _index += offset;
+        return *this;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 ZipContiguousIterator operator+(const difference_type offset) const noexcept {
+        ZipContiguousIterator tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend ZipContiguousIterator operator+(const difference_type offset,
+                                                                            const ZipContiguousIterator& iterator) noexcept {
+        return iterator + offset;
+    }
+
+    LZ_CONSTEXPR_CXX_20 ZipContiguousIterator& operator-=(const difference_type offset) noexcept {
+        _index -= offset;
+        return *this;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 ZipContiguousIterator operator-(const difference_type offset) const noexcept {
+        ZipContiguousIterator tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type operator-(const ZipContiguousIterator& other) const noexcept {
+        return _index - other._index;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator[](const difference_type offset) const {
+        return dereference(MakeIndexSequenceForThis(), _index + offset);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
+    operator==(const ZipContiguousIterator& a, const ZipContiguousIterator& b) noexcept {
+        return a._index == b._index;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
+    operator!=(const ZipContiguousIterator& a, const ZipContiguousIterator& b) noexcept {
+        return !(a == b); // NOLINT
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
+    operator<(const ZipContiguousIterator& a, const ZipContiguousIterator& b) noexcept {
+        return a._index < b._index;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
+    operator>(const ZipContiguousIterator& a, const ZipContiguousIterator& b) noexcept {
+        return b < a;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
+    operator<=(const ZipContiguousIterator& a, const ZipContiguousIterator& b) noexcept {
+        return !(b < a); // NOLINT
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
+    operator>=(const ZipContiguousIterator& a, const ZipContiguousIterator& b) noexcept {
+        return !(a < b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_ZIP_CONTIGUOUS_ITERATOR_HPP
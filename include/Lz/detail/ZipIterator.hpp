@@ -9,6 +9,14 @@
 
 namespace lz {
 namespace internal {
+template<std::size_t I>
+struct GetFn {
+    template<class T>
+    LZ_CONSTEXPR_CXX_20 auto operator()(T&& gettable) noexcept -> decltype(std::get<I>(std::forward<T>(gettable))) {
+        return std::get<I>(std::forward<T>(gettable));
+    }
+};
+
 template<LZ_CONCEPT_ITERATOR... Iterators>
 class ZipIterator {
 public:
@@ -56,6 +64,10 @@ public:
 
     constexpr ZipIterator() = default;
 
+    LZ_NODISCARD constexpr const std::tuple<Iterators...>& base() const noexcept {
+        return _iterators;
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
         return dereference(MakeIndexSequenceForThis());
     }
@@ -97,6 +109,10 @@ public:
         return tmp;
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend ZipIterator operator+(const difference_type offset, const ZipIterator& iterator) {
+        return iterator + offset;
+    }
+
     LZ_CONSTEXPR_CXX_20 ZipIterator& operator-=(const difference_type offset) {
         minIs(MakeIndexSequenceForThis(), offset);
         return *this;
@@ -108,7 +124,19 @@ public:
         return tmp;
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type operator-(const ZipIterator& other) const {
+    // The end iterators of a zip are trimmed to the shortest sequence, so the length of the first sequence is the minimum
+    template<class I = TupleElement<0, std::tuple<Iterators...>>>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsSized<I>::value, difference_type> sizeTo(const ZipIterator& end) const {
+        return static_cast<difference_type>(getIterLength(std::get<0>(_iterators), std::get<0>(end._iterators)));
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 SizeHint sizeHintTo(const ZipIterator& end) const {
+        return sizeHint(std::get<0>(_iterators), std::get<0>(end._iterators));
+    }
+
+    template<class Self = ZipIterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 EnableIf<IsRandomAccess<Self>::value, difference_type>
+    operator-(const ZipIterator& other) const {
         return std::get<0>(_iterators) - std::get<0>(other._iterators);
     }
 
@@ -0,0 +1,117 @@
+// The cpp-lazy module. `import lz;` makes everything available that Lz/Lz.hpp declares, so that its templates are parsed once
+// per build, instead of once per translation unit. As modules do not export macros, options such as LZ_STANDALONE,
+// LZ_MINIMAL_INCLUDES or LZ_PROBES must be defined when this module is built, which the cpp-lazy::module target of
+// CMakeLists.txt does.
+module;
+
+// Everything that cpp-lazy includes must be included here first, so that it is not attached to the module when Lz.hpp
+// includes it below, where the include guards then skip it
+#if __has_include(<version>)
+#    include <version>
+#endif
+
+#ifndef LZ_STANDALONE
+#    include <fmt/compile.h>
+#    include <fmt/ostream.h>
+#endif
+
+#include <algorithm>
+#include <type_traits>
+#if __has_include(<concepts>)
+#    include <concepts>
+#endif
+#if __has_include(<ranges>)
+#    include <ranges>
+#endif
+#include <new>
+#include <initializer_list>
+#include <array>
+#include <map>
+#include <tuple>
+#include <numeric>
+#include <limits>
+#include <string>
+#include <cstdint>
+#include <cctype>
+#include <cerrno>
+#include <unordered_map>
+#include <vector>
+#if __has_include(<charconv>)
+#    include <charconv>
+#endif
+#if __has_include(<format>) && defined(LZ_STANDALONE)
+#    include <format>
+#endif
+#include <sstream>
+#include <istream>
+#include <exception>
+#include <system_error>
+#include <stdexcept>
+#include <ostream>
+#include <iterator>
+#if __has_include(<execution>) && !defined(LZ_MINIMAL_INCLUDES)
+#    include <execution>
+#endif
+#include <utility>
+#include <functional>
+#include <cstddef>
+#include <atomic>
+#ifdef _WIN32
+#    include <io.h>
+#else
+#    include <unistd.h>
+#endif
+#include <cstdio>
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#endif
+#if defined(__linux__)
+#    include <pthread.h>
+#    include <sched.h>
+#    if __has_include(<linux/io_uring.h>)
+#        include <linux/io_uring.h>
+#        include <sys/syscall.h>
+#        include <sys/uio.h>
+#    endif
+#endif
+#include <thread>
+#include <memory>
+#include <mutex>
+#if __has_include(<memory_resource>)
+#    include <memory_resource>
+#endif
+#include <cstring>
+#include <condition_variable>
+#include <future>
+#include <deque>
+#include <cmath>
+#include <random>
+#include <unordered_set>
+#if __has_include(<coroutine>)
+#    include <coroutine>
+#endif
+#include <chrono>
+#include <iomanip>
+
+#ifdef _MSC_VER
+#    include <intrin.h>
+#endif
+
+export module lz;
+
+export extern "C++" {
+#include <Lz/Lz.hpp>
+#include <Lz/MappedFile.hpp>
+#include <Lz/ProbeReport.hpp>
+#include <Lz/RecordReader.hpp>
+}
@@ -0,0 +1,65 @@
+#include <Lz/Lz.hpp>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <list>
+#include <numeric>
+
+namespace {
+template<class Batches>
+std::vector<std::vector<int>> toVectors(Batches&& batches) {
+    std::vector<std::vector<int>> result;
+    for (auto batch : batches) {
+        result.emplace_back(batch.begin(), batch.end());
+    }
+    return result;
+}
+} // namespace
+
+TEST_CASE("Batched yields contiguous batches", "[Batched][Basic functionality]") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5, 6, 7 };
+    const std::vector<std::vector<int>> expected = { { 1, 2, 3 }, { 4, 5, 6 }, { 7 } };
+
+    SECTION("Contiguous sources are not copied") {
+        auto batches = lz::batched(vec, 3);
+        CHECK(batches.begin()->begin() == vec.data());
+        CHECK((*++batches.begin()).begin() == vec.data() + 3);
+        CHECK(toVectors(batches) == expected);
+        CHECK(toVectors(lz::batchedRange(vec.data(), vec.data() + vec.size(), 3)) == expected);
+        CHECK(toVectors(lz::toIterRange(vec.data(), vec.data() + vec.size()).batched(3)) == expected);
+    }
+
+    SECTION("Other sources are copied into an aligned buffer") {
+        std::list<int> list(vec.begin(), vec.end());
+        auto batches = lz::batched(list, 3);
+        const int* buffer = batches.begin()->begin();
+        // Aligned to a cache line
+        CHECK(reinterpret_cast<std::uintptr_t>(buffer) % 64 == 0);
+        CHECK(toVectors(lz::batched(list, 3)) == expected);
+
+        auto mapped = lz::batched(lz::map(vec, [](int i) { return i * 10; }), 4);
+        auto it = mapped.begin();
+        CHECK(it->size() == 4);
+        CHECK(it->begin()[3] == 40);
+        ++it;
+        CHECK(it->begin() == mapped.begin()->begin());
+        CHECK(it->size() == 3);
+        ++it;
+        CHECK(it == mapped.end());
+    }
+
+    SECTION("Chains") {
+        using Batch = decltype(lz::batched(vec, 2))::value_type;
+        auto sums = lz::toIter(vec).filter([](int i) { return i != 4; }).batched(2).map([](Batch batch) {
+            return std::accumulate(batch.begin(), batch.end(), 0);
+        });
+        CHECK(sums.toVector() == std::vector<int>{ 3, 8, 13 });
+    }
+
+    SECTION("Empty") {
+        std::vector<int> empty;
+        std::list<int> emptyList;
+        CHECK(lz::batched(empty, 4).begin() == lz::batched(empty, 4).end());
+        auto batches = lz::batched(emptyList, 4);
+        CHECK(batches.begin() == batches.end());
+    }
+}
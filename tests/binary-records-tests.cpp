@@ -0,0 +1,72 @@
+#include <Lz/BinaryRecords.hpp>
+#include <Lz/Lz.hpp>
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+#pragma pack(push, 1)
+struct Trade {
+    std::uint64_t time;
+    double price;
+    std::uint32_t size;
+};
+#pragma pack(pop)
+
+template<class T>
+void append(std::vector<std::uint8_t>& bytes, const T& value) {
+    const auto* first = reinterpret_cast<const std::uint8_t*>(&value);
+    bytes.insert(bytes.end(), first, first + sizeof(T));
+}
+} // namespace
+
+TEST_CASE("Binary records", "[BinaryRecords][Basic functionality]") {
+    std::vector<std::uint8_t> bytes;
+    for (std::uint32_t i = 0; i < 5; ++i) {
+        append(bytes, Trade{ 1000 + i, 1.5 * i, i * 100 });
+    }
+
+    SECTION("Should read every record") {
+        auto trades = lz::records<Trade>(bytes);
+        REQUIRE(trades.size() == 5);
+        CHECK(trades.begin()[3].time == 1003);
+        CHECK(trades.begin()[3].price == 4.5);
+        CHECK(lz::map(trades, [](const Trade& t) { return t.size; }).toVector() ==
+              std::vector<std::uint32_t>{ 0, 100, 200, 300, 400 });
+        CHECK(lz::filter(trades, [](const Trade& t) { return t.size > 250; }).distance() == 2);
+    }
+
+    SECTION("Should read a field of every record with a stride") {
+        auto prices = lz::recordsRange<double>(reinterpret_cast<const char*>(bytes.data()) + 8,
+                                               reinterpret_cast<const char*>(bytes.data() + bytes.size()), sizeof(Trade));
+        CHECK(prices.toVector() == std::vector<double>{ 0, 1.5, 3, 4.5, 6 });
+        CHECK(std::prev(prices.end())[0] == 6);
+    }
+
+    SECTION("Should ignore an incomplete record at the end") {
+        bytes.resize(bytes.size() - 1);
+        CHECK(lz::records<Trade>(bytes).size() == 4);
+        std::vector<std::uint8_t> tooSmall(sizeof(Trade) - 1);
+        CHECK(lz::records<Trade>(tooSmall).size() == 0);
+        CHECK(lz::records<std::uint16_t>(std::string("abcde")).size() == 2);
+    }
+}
+
+TEST_CASE("Binary records with a byte order", "[BinaryRecords][Basic functionality]") {
+    const std::vector<std::uint8_t> bytes = { 0x00, 0x00, 0x01, 0x02, 0xFF, 0xFF, 0xFF, 0xFE };
+    CHECK(lz::records<std::uint32_t, lz::ByteOrder::big>(bytes).toVector() == std::vector<std::uint32_t>{ 0x102, 0xFFFFFFFE });
+    CHECK(lz::records<std::int16_t, lz::ByteOrder::big>(bytes).toVector() == std::vector<std::int16_t>{ 0, 0x102, -1, -2 });
+    CHECK(lz::records<std::uint16_t, lz::ByteOrder::little>(bytes).toVector() ==
+          std::vector<std::uint16_t>{ 0, 0x201, 0xFFFF, 0xFEFF });
+    CHECK(lz::records<std::uint8_t, lz::ByteOrder::big>(bytes).toVector() == bytes);
+
+    double value = 2.75;
+    std::vector<std::uint8_t> reversed(sizeof value);
+    std::memcpy(reversed.data(), &value, sizeof value);
+    std::reverse(reversed.begin(), reversed.end());
+    constexpr lz::ByteOrder other = lz::ByteOrder::native == lz::ByteOrder::little ? lz::ByteOrder::big : lz::ByteOrder::little;
+    CHECK(*lz::records<double, other>(reversed).begin() == 2.75);
+}
@@ -0,0 +1,108 @@
+#include <Lz/BitMask.hpp>
+#include <Lz/Lz.hpp>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <deque>
+#include <forward_list>
+#include <list>
+#include <vector>
+
+TEST_CASE("To bit mask", "[BitMask][Basic functionality]") {
+    std::vector<int> values(130);
+    for (std::size_t i = 0; i != values.size(); ++i) {
+        values[i] = static_cast<int>(i);
+    }
+    const auto isOdd = [](int i) { return i % 2 != 0; };
+
+    SECTION("Should pack a bit per element") {
+        auto mask = lz::toBitMask(values, isOdd);
+        CHECK(mask == std::vector<std::uint64_t>{ 0xAAAAAAAAAAAAAAAAULL, 0xAAAAAAAAAAAAAAAAULL, 0x2 });
+        std::vector<int> empty;
+        CHECK(lz::toBitMask(empty, isOdd).empty());
+    }
+
+    SECTION("Should pack elements of other iterators") {
+        std::list<int> list(values.begin(), values.end());
+        CHECK(lz::toBitMask(list, isOdd) == lz::toBitMask(values, isOdd));
+    }
+
+    SECTION("Should pack flags") {
+        std::vector<char> flags(70);
+        flags[0] = 1;
+        flags[9] = 'x';
+        flags[63] = -1;
+        flags[64] = 1;
+        flags[69] = 1;
+        CHECK(lz::toBitMask(flags) == std::vector<std::uint64_t>{ (1ULL << 63) | (1ULL << 9) | 1ULL, 0x21 });
+
+        std::vector<bool> bools = { true, false, true };
+        CHECK(lz::toBitMask(bools) == std::vector<std::uint64_t>{ 0x5 });
+        std::deque<int> ints = { 0, 3, 0, 0, -1 };
+        CHECK(lz::toBitMask(ints) == std::vector<std::uint64_t>{ 0x12 });
+    }
+}
+
+TEST_CASE("Set bits", "[BitMask][Basic functionality]") {
+    std::vector<std::uint8_t> mask = { 0x05, 0, 0, 0x80, 0x01 };
+    auto indices = lz::setBits(mask);
+
+    SECTION("Should yield the indices of the set bits") {
+        CHECK(indices.toVector() == std::vector<std::size_t>{ 0, 2, 31, 32 });
+        std::vector<std::uint64_t> empty = { 0, 0 };
+        CHECK(lz::setBits(empty).begin() == lz::setBits(empty).end());
+        std::vector<std::uint64_t> full = { ~std::uint64_t{ 0 } };
+        CHECK(lz::setBits(full).size() == 64);
+        CHECK(*std::next(lz::setBits(full).begin(), 63) == 63);
+    }
+
+    SECTION("Should count the set bits") {
+        CHECK(indices.size() == 4);
+        auto it = std::next(indices.begin());
+        CHECK(lz::IterView<decltype(it)>(it, indices.end()).size() == 3);
+        CHECK(lz::IterView<decltype(it)>(it, std::next(it)).size() == 1);
+        CHECK(lz::IterView<decltype(it)>(it, std::next(it, 2)).size() == 2);
+    }
+
+    SECTION("Should be usable in push based loops") {
+        auto it = std::next(indices.begin());
+        std::vector<std::size_t> rest;
+        lz::IterView<decltype(it)>(it, std::next(it, 2)).copyTo(std::back_inserter(rest));
+        CHECK(rest == std::vector<std::size_t>{ 2, 31 });
+        CHECK(lz::toIter(indices).countIf([](std::size_t i) { return i > 2; }) == 2);
+        CHECK(lz::indexOf(indices, std::size_t{ 32 }) == 3);
+    }
+
+    SECTION("Should accept forward iterators") {
+        std::forward_list<std::uint16_t> words = { 0, 0x8001 };
+        CHECK(lz::setBits(words).toVector() == std::vector<std::size_t>{ 16, 31 });
+    }
+}
+
+TEST_CASE("Select bits", "[BitMask][Basic functionality]") {
+    std::vector<int> values(200);
+    for (std::size_t i = 0; i != values.size(); ++i) {
+        values[i] = static_cast<int>(i);
+    }
+    const auto isSelected = [](int i) { return i % 7 == 0 || i == 199; };
+    auto mask = lz::toBitMask(values, isSelected);
+
+    SECTION("Should select like select does") {
+        std::vector<bool> flags = lz::map(values, isSelected).to<std::vector<bool>>();
+        CHECK(lz::selectBits(values, mask).toVector() == lz::select(values, flags).toVector());
+        CHECK(lz::selectBits(values, mask).size() == 30);
+        CHECK(lz::toIter(values).selectBits(mask).toVector() == lz::filter(values, isSelected).toVector());
+    }
+
+    SECTION("Should select by reference") {
+        for (int& value : lz::selectBits(values, mask)) {
+            value = -1;
+        }
+        CHECK(values[7] == -1);
+        CHECK(values[8] == 8);
+        CHECK(values[199] == -1);
+    }
+
+    SECTION("Should select chained set bits") {
+        CHECK(lz::toIter(mask).setBits().take(3).toVector() == std::vector<std::size_t>{ 0, 7, 14 });
+    }
+}
@@ -0,0 +1,77 @@
+#include "Lz/Cached.hpp"
+#include "Lz/Map.hpp"
+
+#include <atomic>
+#include <catch2/catch.hpp>
+#include <iterator>
+#include <numeric>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Cached evaluates once", "[Cached][Basic functionality]") {
+    std::vector<int> v = { 1, 2, 3, 4, 5 };
+    int calls = 0;
+    auto map = lz::map(v, [&calls](const int i) {
+        ++calls;
+        return i * 2;
+    });
+    auto cached = lz::cached(map, 2);
+    CHECK(calls == 0);
+
+    SECTION("Replays") {
+        CHECK(cached.toVector() == std::vector<int>{ 2, 4, 6, 8, 10 });
+        CHECK(calls == 5);
+        CHECK(std::accumulate(cached.begin(), cached.end(), 0) == 30);
+        auto copy = cached;
+        CHECK(copy.toVector() == std::vector<int>{ 2, 4, 6, 8, 10 });
+        CHECK(calls == 5);
+    }
+
+    SECTION("Only the iterated prefix is evaluated") {
+        auto it = cached.begin();
+        CHECK(*it == 2);
+        CHECK(calls == 2);
+        ++it;
+        ++it;
+        CHECK(*it == 6);
+        CHECK(calls == 4);
+    }
+
+    SECTION("Input iterators") {
+        std::istringstream stream("1 2 3");
+        auto input = lz::cachedRange(std::istream_iterator<int>(stream), std::istream_iterator<int>());
+        CHECK(input.toVector() == std::vector<int>{ 1, 2, 3 });
+        CHECK(input.toVector() == std::vector<int>{ 1, 2, 3 });
+    }
+
+    SECTION("Empty") {
+        std::vector<int> empty;
+        auto cachedEmpty = lz::cached(empty);
+        CHECK(cachedEmpty.begin() == cachedEmpty.end());
+        CHECK(cachedEmpty.toVector().empty());
+    }
+}
+
+TEST_CASE("Cached is filled by several threads", "[Cached][Basic functionality]") {
+    std::vector<int> v(10000);
+    std::iota(v.begin(), v.end(), 0);
+    std::atomic<int> calls{ 0 };
+    auto cached = lz::cached(lz::map(v, [&calls](const int i) {
+        ++calls;
+        return i;
+    }), 64);
+
+    std::vector<long long> sums(4);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < sums.size(); ++i) {
+        threads.emplace_back([&cached, &sums, i] { sums[i] = std::accumulate(cached.begin(), cached.end(), 0LL); });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    for (const long long sum : sums) {
+        CHECK(sum == 49995000);
+    }
+    CHECK(calls == 10000);
+}
@@ -1,4 +1,5 @@
 #include "Lz/CartesianProduct.hpp"
+#include "Lz/Take.hpp"
 
 #include <catch2/catch.hpp>
 #include <list>
@@ -94,6 +95,13 @@ TEST_CASE("Cartesian product binary operations", "[CartesianProduct][Binary ops]
         CHECK(iter - 8 == cartesian.begin());
     }
 
+    SECTION("Operator[]()") {
+        auto iter = cartesian.begin();
+        CHECK(iter[0] == std::make_tuple(1, 'a'));
+        CHECK(iter[3] == std::make_tuple(2, 'a'));
+        CHECK(iter[8] == std::make_tuple(3, 'c'));
+    }
+
     SECTION("Operator<, <, <=, >, >=") {
         auto b = cartesian.begin();
         auto end = cartesian.end();
@@ -104,6 +112,47 @@ TEST_CASE("Cartesian product binary operations", "[CartesianProduct][Binary ops]
         CHECK(b + distance - 1 <= end);
         CHECK(b + 9 - 1 >= end - 1);
     }
+
+    SECTION("Distances between any two combinations") {
+        auto b = cartesian.begin();
+        CHECK((b + 4) - (b + 1) == 3);
+        CHECK((b + 1) - (b + 4) == -3);
+        CHECK(cartesian.end() - (b + 5) == 4);
+        CHECK(b + 2 < b + 3);
+        CHECK_FALSE(b + 3 < b + 2);
+        CHECK(cartesian.size() == 9);
+    }
+}
+
+TEST_CASE("Cartesian product of many sequences", "[CartesianProduct][Basic functionality]") {
+    std::vector<int> grid = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    auto product = lz::cartesian(grid, grid, grid, grid, grid, grid);
+
+    SECTION("Jumping to the k-th combination") {
+        CHECK(product.size() == 1000000);
+        CHECK(product.begin()[123456] == std::make_tuple(1, 2, 3, 4, 5, 6));
+        auto it = product.begin() + 999999;
+        CHECK(*it == std::make_tuple(9, 9, 9, 9, 9, 9));
+        CHECK(it - product.begin() == 999999);
+        CHECK(++it == product.end());
+        it -= 654321;
+        CHECK(*it == std::make_tuple(3, 4, 5, 6, 7, 9));
+    }
+
+    SECTION("Empty sequences") {
+        std::vector<int> empty;
+        auto emptyProduct = lz::cartesian(grid, empty);
+        CHECK(emptyProduct.begin() == emptyProduct.end());
+        CHECK(emptyProduct.size() == 0);
+    }
+
+    SECTION("Shards and parallel traversal") {
+        auto small = lz::cartesian(grid, grid, grid, grid);
+        const std::vector<std::tuple<int, int, int, int>> expected = small.toVector();
+        CHECK(small.toVector(lz::execution::pool(4)) == expected);
+        auto shard = lz::slice(small, 2500, 5000);
+        CHECK(shard.toVector() == std::vector<std::tuple<int, int, int, int>>(expected.begin() + 2500, expected.begin() + 5000));
+    }
 }
 
 TEST_CASE("CartesianProduct to containers", "[CartesianProduct][To container]") {
@@ -173,4 +222,31 @@ TEST_CASE("CartesianProduct to containers", "[CartesianProduct][To container]")
         };
         CHECK(result == expected);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Cartesian product as loop nest", "[CartesianProduct][Basic functionality]") {
+    std::vector<int> a = { 1, 2, 3 };
+    std::list<int> b = { 10, 20 };
+    std::vector<int> c = { 100, 200, 300, 400 };
+    auto product = lz::cartesian(a, b, c);
+    std::vector<std::tuple<int, int, int>> expected;
+    for (const int i : a) {
+        for (const int j : b) {
+            for (const int k : c) {
+                expected.emplace_back(i, j, k);
+            }
+        }
+    }
+
+    SECTION("Whole product") {
+        std::vector<std::tuple<int, int, int>> visited;
+        product.copyTo(std::back_inserter(visited));
+        CHECK(visited == expected);
+    }
+
+    SECTION("Part of the product") {
+        CHECK(lz::slice(product, 5, 19).toVector() ==
+              std::vector<std::tuple<int, int, int>>(expected.begin() + 5, expected.begin() + 19));
+        CHECK(lz::slice(product, 7, 7).toVector().empty());
+    }
+}
@@ -109,4 +109,64 @@ TEST_CASE("ChunkIf to containers", "[ChunkIf][To container]") {
                        [](const Iterator& it) { return it.toString(); });
         CHECK(list == decltype(list){ "hello world", " this is a message" });
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("ChunkIf into an inline buffer", "[ChunkIf][Chunk if into]") {
+    std::string s = "hello world; this is a message;";
+    const auto isSemicolon = [](const char c) { return c == ';'; };
+
+    std::vector<std::string> expected;
+    for (auto&& chunk : lz::chunkIf(s, isSemicolon)) {
+        expected.push_back(chunk.toString());
+    }
+    std::vector<std::string> actual;
+    lz::chunkIfInto<16>(s, isSemicolon, [&actual](lz::InlineBuffer<char, 16>& chunk) {
+        actual.emplace_back(chunk.begin(), chunk.end());
+    });
+    CHECK(actual == expected);
+}
+
+TEST_CASE("ChunkIf on a delimiter value", "[ChunkIf][Delimiter]") {
+    const std::string longChunk(100, 'a');
+    std::string s = ";hello;;" + longChunk + ";" + longChunk + "b;world";
+    const auto isSemicolon = [](const char c) { return c == ';'; };
+
+    SECTION("Should be the same as with a lambda") {
+        std::vector<std::string> expected;
+        for (auto&& chunk : lz::chunkIf(s, isSemicolon)) {
+            expected.push_back(chunk.toString());
+        }
+        std::vector<std::string> actual;
+        for (auto&& chunk : lz::chunkIf(s, lz::equalTo(';'))) {
+            actual.push_back(chunk.toString());
+        }
+        CHECK(actual == expected);
+        CHECK(actual.size() == 6);
+        CHECK(actual[3] == longChunk);
+    }
+
+    SECTION("Operator--") {
+        auto chunked = lz::chunkIf(s, lz::equalTo(';'));
+        auto it = chunked.end();
+        --it;
+        CHECK(it->toString() == "world");
+        --it;
+        CHECK(it->toString() == longChunk + "b");
+    }
+
+    SECTION("Numbers") {
+        std::vector<int> numbers(80, 1);
+        numbers[3] = 0;
+        numbers[70] = 0;
+        std::vector<std::size_t> sizes;
+        for (auto&& chunk : lz::chunkIf(numbers, lz::equalTo(0))) {
+            sizes.push_back(static_cast<std::size_t>(chunk.size()));
+        }
+        CHECK(sizes == std::vector<std::size_t>{ 3, 66, 9 });
+
+        std::list<long> list = { 1, 0, 2, 3 };
+        auto listChunks = lz::chunkIf(list, lz::equalTo(0));
+        CHECK(std::distance(listChunks.begin(), listChunks.end()) == 2);
+        CHECK(listChunks.begin()->toVector() == std::vector<long>{ 1 });
+    }
+}
@@ -2,7 +2,10 @@
 #include "catch2/catch.hpp"
 
 #include <Lz/FunctionTools.hpp>
+#include <atomic>
 #include <list>
+#include <numeric>
+#include <stdexcept>
 
 TEST_CASE("Chunks changing and creating elements", "[Chunks][Basic functionality]") {
     std::vector<int> v = { 1, 2, 3, 4, 5, 6, 7 };
@@ -140,6 +143,50 @@ TEST_CASE("Chunks binary operations", "[Chunks][Binary ops]") {
     }
 }
 
+TEST_CASE("Chunks random access jumps", "[Chunks][Binary ops]") {
+    std::vector<int> v(20);
+    std::iota(v.begin(), v.end(), 0);
+    auto chunked = lz::chunks(v, 3);
+    const auto length = static_cast<std::ptrdiff_t>(chunked.size());
+    REQUIRE(length == 7);
+
+    SECTION("Jumps match stepping forward") {
+        auto stepped = chunked.begin();
+        for (std::ptrdiff_t i = 0; i <= length; ++i, ++stepped) {
+            auto jumped = chunked.begin() + i;
+            CHECK(jumped->begin() == stepped->begin());
+            CHECK(jumped->end() == stepped->end());
+            CHECK(jumped - chunked.begin() == i);
+            CHECK(chunked.end() - jumped == length - i);
+        }
+    }
+
+    SECTION("Jumps match stepping backward") {
+        auto stepped = chunked.end();
+        for (std::ptrdiff_t i = 1; i <= length; ++i) {
+            --stepped;
+            auto jumped = chunked.end() - i;
+            CHECK(jumped->begin() == stepped->begin());
+            CHECK(jumped->end() == stepped->end());
+            CHECK(chunked.end() - jumped == i);
+        }
+    }
+
+    SECTION("Postfix decrement") {
+        auto it = chunked.end();
+        auto old = it--;
+        CHECK(old == chunked.end());
+        CHECK(it == chunked.end() - 1);
+    }
+
+    SECTION("Binary search on chunks") {
+        auto found = std::lower_bound(chunked.begin(), chunked.end(), 10,
+                                      [](const decltype(*chunked.begin())& chunk, int value) { return *chunk.begin() < value; });
+        REQUIRE(found != chunked.end());
+        CHECK(*found->begin() == 12);
+    }
+}
+
 TEST_CASE("Chunks to containers", "[Chunk][To container]") {
     std::vector<int> v = { 1, 2, 3, 4, 5, 6, 7, 8 };
     auto chunked = lz::chunks(v, 3);
@@ -172,4 +219,100 @@ TEST_CASE("Chunks to containers", "[Chunk][To container]") {
 
         CHECK(lists == expected);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Parallel for each chunk", "[Chunks][Parallel]") {
+    std::vector<int> values(10007);
+    std::iota(values.begin(), values.end(), 0);
+
+    SECTION("Random access") {
+        std::vector<int> doubled(values.size());
+        std::atomic<std::size_t> chunkCount{ 0 };
+        std::atomic<bool> tooLarge{ false };
+        lz::parallelForEachChunk(
+            values, 100,
+            [&](lz::Chunk<std::vector<int>::iterator> chunk) {
+                if (chunk.size() > 100) {
+                    tooLarge = true;
+                }
+                const auto offset = chunk.begin() - values.begin();
+                std::transform(chunk.begin(), chunk.end(), doubled.begin() + offset, [](int i) { return i * 2; });
+                ++chunkCount;
+            },
+            4);
+        CHECK(chunkCount == 101);
+        CHECK(!tooLarge);
+        CHECK(lz::equal(doubled, lz::map(values, [](int i) { return i * 2; })));
+    }
+
+    SECTION("Forward") {
+        std::list<int> list(values.begin(), values.end());
+        std::atomic<long long> sum{ 0 };
+        std::atomic<std::size_t> elements{ 0 };
+        lz::parallelForEachChunk(list, 64, [&](lz::Chunk<std::list<int>::iterator> chunk) {
+            long long chunkSum = 0;
+            for (const int i : chunk) {
+                chunkSum += i;
+                ++elements;
+            }
+            sum += chunkSum;
+        });
+        CHECK(elements == values.size());
+        CHECK(sum == 10006LL * 10007LL / 2);
+    }
+
+    SECTION("Empty and single threaded") {
+        std::vector<int> empty;
+        bool called = false;
+        lz::parallelForEachChunk(empty, 10, [&](lz::Chunk<std::vector<int>::iterator>) { called = true; });
+        CHECK(!called);
+
+        std::vector<std::size_t> sizes;
+        lz::parallelForEachChunk(
+            values, 5000, [&](lz::Chunk<std::vector<int>::iterator> chunk) { sizes.push_back(chunk.size()); },
+            1);
+        CHECK(sizes == std::vector<std::size_t>{ 5000, 5000, 7 });
+    }
+
+    SECTION("Exceptions are rethrown") {
+        CHECK_THROWS_AS(lz::parallelForEachChunk(values, 10,
+                                                 [](lz::Chunk<std::vector<int>::iterator> chunk) {
+                                                     if (*chunk.begin() == 500) {
+                                                         throw std::runtime_error("failed");
+                                                     }
+                                                 }),
+                        std::runtime_error);
+    }
+}
+
+TEST_CASE("Chunks into an inline buffer", "[Chunks][Chunks into]") {
+    std::vector<int> v = { 1, 2, 3, 4, 5, 6, 7 };
+
+    SECTION("Chunks are the same as lz::chunks") {
+        std::vector<std::vector<int>> chunks;
+        const int* firstData = nullptr;
+        lz::chunksInto<3>(v, 3, [&](lz::InlineBuffer<int, 3>& chunk) {
+            CHECK(chunk.isInline());
+            if (firstData == nullptr) {
+                firstData = chunk.data();
+            }
+            CHECK(chunk.data() == firstData);
+            chunks.push_back(chunk.view().toVector());
+        });
+        CHECK(chunks == std::vector<std::vector<int>>{ { 1, 2, 3 }, { 4, 5, 6 }, { 7 } });
+    }
+
+    SECTION("Chunks larger than the inline capacity") {
+        std::vector<std::size_t> sizes;
+        lz::chunksInto<2>(std::list<int>(v.begin(), v.end()), 4, [&sizes](lz::InlineBuffer<int, 2>& chunk) {
+            CHECK_FALSE(chunk.isInline());
+            sizes.push_back(chunk.size());
+        });
+        CHECK(sizes == std::vector<std::size_t>{ 4, 3 });
+    }
+
+    SECTION("Empty") {
+        std::vector<int> empty;
+        lz::chunksInto<4>(empty, 4, [](lz::InlineBuffer<int, 4>&) { FAIL("called for an empty sequence"); });
+    }
+}
@@ -0,0 +1,103 @@
+#include "Lz/Columns.hpp"
+#include "Lz/Filter.hpp"
+#include "Lz/Map.hpp"
+
+#include <catch2/catch.hpp>
+#include <numeric>
+
+namespace {
+struct Trade {
+    int id;
+    double price;
+    char side;
+};
+} // namespace
+
+TEST_CASE("Columns basic functionality", "[Columns][Basic functionality]") {
+    lz::Columns<int, double> columns;
+    CHECK(columns.empty());
+    columns.pushBack(1, 2.5);
+    columns.pushBack(2, 3.5);
+    columns.pushBack(3, 1.);
+    REQUIRE(columns.size() == 3);
+
+    SECTION("Rows") {
+        CHECK(columns[1] == std::make_tuple(2, 3.5));
+        std::size_t i = 0;
+        for (std::tuple<int&, double&> row : columns) {
+            CHECK(&std::get<0>(row) == &columns.columnVector<0>()[i]);
+            CHECK(&std::get<1>(row) == &columns.columnVector<1>()[i]);
+            ++i;
+        }
+        CHECK(i == 3);
+        CHECK(std::distance(columns.begin(), columns.end()) == 3);
+    }
+
+    SECTION("Columns are contiguous") {
+        auto prices = columns.column<1>();
+        CHECK(prices.begin() == columns.columnVector<1>().data());
+        CHECK(prices.toVector() == std::vector<double>{ 2.5, 3.5, 1. });
+    }
+
+    SECTION("Columns with adaptors") {
+        auto expensive = lz::filter(columns.column<1>(), [](double price) { return price > 2; });
+        CHECK(std::accumulate(expensive.begin(), expensive.end(), 0.) == Approx(6.));
+        auto ids = lz::map(columns, [](std::tuple<int&, double&> row) { return std::get<0>(row) * 10; });
+        CHECK(ids.toVector() == std::vector<int>{ 10, 20, 30 });
+    }
+
+    SECTION("Modify through rows") {
+        for (std::tuple<int&, double&> row : columns.rows()) {
+            std::get<1>(row) *= 2;
+        }
+        CHECK(columns.columnVector<1>() == std::vector<double>{ 5., 7., 2. });
+    }
+
+    SECTION("Const") {
+        const auto& constColumns = columns;
+        static_assert(std::is_same<decltype(*constColumns.begin()), std::tuple<const int&, const double&>>::value, "");
+        CHECK(constColumns[2] == std::make_tuple(3, 1.));
+        CHECK(constColumns.column<0>().toVector() == std::vector<int>{ 1, 2, 3 });
+    }
+
+    SECTION("Resize and clear") {
+        columns.resize(5);
+        CHECK(columns.size() == 5);
+        CHECK(columns[4] == std::make_tuple(0, 0.));
+        columns.clear();
+        CHECK(columns.empty());
+        CHECK(columns.rows().begin() == columns.rows().end());
+    }
+}
+
+TEST_CASE("To columns", "[Columns][To columns]") {
+    std::vector<Trade> trades = { { 1, 10.5, 'b' }, { 2, 11.25, 's' }, { 3, 9., 'b' } };
+
+    SECTION("With projections") {
+        auto columns = lz::toColumns(
+            trades, [](const Trade& trade) { return trade.id; }, [](const Trade& trade) { return trade.price; },
+            [](const Trade& trade) { return trade.side; });
+        static_assert(std::is_same<decltype(columns), lz::Columns<int, double, char>>::value, "");
+        REQUIRE(columns.size() == trades.size());
+        CHECK(columns.columnVector<0>() == std::vector<int>{ 1, 2, 3 });
+        CHECK(columns.columnVector<1>() == std::vector<double>{ 10.5, 11.25, 9. });
+        CHECK(columns.columnVector<2>() == std::vector<char>{ 'b', 's', 'b' });
+    }
+
+    SECTION("From tuples") {
+        std::vector<std::pair<int, std::string>> pairs = { { 1, "a" }, { 2, "b" } };
+        auto columns = lz::toColumns(pairs);
+        static_assert(std::is_same<decltype(columns), lz::Columns<int, std::string>>::value, "");
+        CHECK(columns[1] == std::make_tuple(2, std::string("b")));
+
+        auto roundTrip = lz::toColumns(columns.rows());
+        CHECK(roundTrip.columnVector<1>() == columns.columnVector<1>());
+    }
+
+    SECTION("Empty") {
+        std::vector<Trade> empty;
+        auto columns =
+            lz::toColumns(empty, [](const Trade& trade) { return trade.id; }, [](const Trade& trade) { return trade.price; });
+        CHECK(columns.empty());
+    }
+}
@@ -0,0 +1,101 @@
+#include <Lz/ConcatenateAll.hpp>
+#include <Lz/Filter.hpp>
+#include <Lz/Map.hpp>
+#include <catch2/catch.hpp>
+#include <list>
+#include <vector>
+
+TEST_CASE("ConcatenateAll basic functionality", "[ConcatenateAll][Basic functionality]") {
+    std::vector<std::vector<int>> segments = { {}, { 1, 2 }, {}, {}, { 3 }, { 4, 5, 6 }, {} };
+    auto concatenated = lz::concatAll(segments);
+
+    SECTION("Should skip empty ranges") {
+        CHECK(concatenated.toVector() == std::vector<int>{ 1, 2, 3, 4, 5, 6 });
+        CHECK(*concatenated.begin() == 1);
+    }
+
+    SECTION("Should be by reference") {
+        *concatenated.begin() = 10;
+        CHECK(segments[1][0] == 10);
+    }
+
+    SECTION("Should be sized") {
+        CHECK(concatenated.size() == 6);
+        CHECK(lz::concatAll(std::vector<std::vector<int>>{}).size() == 0);
+        CHECK(lz::concatAll(std::vector<std::vector<int>>(3)).toVector().empty());
+    }
+
+    SECTION("Should concatenate views") {
+        std::vector<decltype(lz::map(segments[0], std::negate<int>()))> views;
+        for (auto& segment : segments) {
+            views.push_back(lz::map(segment, std::negate<int>()));
+        }
+        CHECK(lz::concatAll(views).toVector() == std::vector<int>{ -1, -2, -3, -4, -5, -6 });
+    }
+
+    SECTION("Should be usable in push based loops") {
+        auto even = lz::filter(concatenated, [](int i) { return i % 2 == 0; });
+        CHECK(even.toVector() == std::vector<int>{ 2, 4, 6 });
+
+        std::vector<int> copied(6);
+        concatenated.copyTo(copied.begin());
+        CHECK(copied == std::vector<int>{ 1, 2, 3, 4, 5, 6 });
+    }
+}
+
+TEST_CASE("ConcatenateAll binary operations", "[ConcatenateAll][Binary ops]") {
+    std::vector<std::vector<int>> segments = { {}, { 1, 2 }, {}, {}, { 3 }, { 4, 5, 6 }, {} };
+    auto concatenated = lz::concatAll(segments);
+    auto begin = concatenated.begin();
+    auto end = concatenated.end();
+
+    SECTION("Operator++ and operator--") {
+        ++begin;
+        ++begin;
+        CHECK(*begin == 3);
+        --begin;
+        CHECK(*begin == 2);
+
+        --end;
+        CHECK(*end == 6);
+        end -= 3;
+        CHECK(*end == 3);
+        --end;
+        CHECK(*end == 2);
+    }
+
+    SECTION("Operator+ and operator-") {
+        for (int i = 0; i != 6; ++i) {
+            CHECK(*(begin + i) == i + 1);
+            CHECK(begin[i] == i + 1);
+            CHECK(*(end - (6 - i)) == i + 1);
+        }
+        CHECK(begin + 6 == end);
+        CHECK(end - 6 == begin);
+        CHECK((begin + 4) - 4 == begin);
+    }
+
+    SECTION("Operator-(Iterator)") {
+        CHECK(end - begin == 6);
+        CHECK((begin + 4) - (begin + 1) == 3);
+        CHECK(begin - end == -6);
+    }
+
+    SECTION("Operator<, <=, >, >=") {
+        CHECK(begin < end);
+        CHECK(begin + 2 > begin + 1);
+        CHECK(begin + 2 <= begin + 2);
+        CHECK(end >= begin);
+    }
+}
+
+TEST_CASE("ConcatenateAll of bidirectional ranges", "[ConcatenateAll][Bidirectional]") {
+    std::vector<std::list<int>> segments = { { 1 }, {}, { 2, 3 } };
+    auto concatenated = lz::concatAll(segments);
+
+    CHECK(concatenated.toVector() == std::vector<int>{ 1, 2, 3 });
+    CHECK(concatenated.size() == 3);
+    CHECK(*--concatenated.end() == 3);
+    CHECK(*std::prev(concatenated.end(), 3) == 1);
+    CHECK(lz::concatAllRange(segments.begin(), segments.begin() + 1).toVector() == std::vector<int>{ 1 });
+}
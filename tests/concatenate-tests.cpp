@@ -1,6 +1,8 @@
 #include <Lz/Concatenate.hpp>
+#include <array>
 #include <catch2/catch.hpp>
 #include <list>
+#include <set>
 
 TEST_CASE("Concat changing and creating elements", "[Concat][Basic functionality]") {
     std::string a = "hello ";
@@ -55,6 +57,22 @@ TEST_CASE("Concat binary operations", "[Concat][Binary ops]") {
         CHECK(*begin == 'o');
     }
 
+    SECTION("Postfix operators") {
+        auto it = begin++;
+        CHECK(*it == 'h');
+        CHECK(*begin == 'e');
+        it = begin--;
+        CHECK(*it == 'e');
+        CHECK(*begin == 'h');
+        begin += 6;
+        it = begin--;
+        CHECK(*it == 'w');
+        CHECK(*begin == ' ');
+        it = begin++;
+        CHECK(*it == ' ');
+        CHECK(*begin == 'w');
+    }
+
     SECTION("Operator== & operator!=") {
         CHECK(begin != concat.end());
         begin = concat.end();
@@ -93,6 +111,66 @@ TEST_CASE("Concat binary operations", "[Concat][Binary ops]") {
     }
 }
 
+TEST_CASE("Concatenate with empty ranges", "[Concatenate][Empty ranges]") {
+    std::vector<int> a = { 1, 2, 3 }, b, c = { 4 }, d, e = { 5, 6 };
+    auto concat = lz::concat(a, b, c, d, e);
+    const std::vector<int> expected = { 1, 2, 3, 4, 5, 6 };
+    auto begin = concat.begin();
+    auto end = concat.end();
+
+    SECTION("Operator++ and operator--") {
+        CHECK(concat.toVector() == expected);
+        auto it = end;
+        for (std::size_t i = expected.size(); i != 0; --i) {
+            --it;
+            CHECK(*it == expected[i - 1]);
+        }
+        CHECK(it == begin);
+    }
+
+    SECTION("Postfix operators") {
+        auto it = begin++;
+        CHECK(*it == 1);
+        CHECK(*begin == 2);
+        it = begin--;
+        CHECK(*it == 2);
+        CHECK(*begin == 1);
+    }
+
+    SECTION("Operator+= and operator-=") {
+        for (std::ptrdiff_t i = 0; i <= 6; ++i) {
+            const auto it = begin + i;
+            CHECK(it - begin == i);
+            CHECK(end - (6 - i) == it);
+            for (std::ptrdiff_t j = 0; j <= 6; ++j) {
+                CHECK(it + (j - i) == begin + j);
+                CHECK(it - (i - j) == begin + j);
+            }
+        }
+    }
+
+    SECTION("Different iterator types") {
+        std::array<int, 0> empty{};
+        std::array<int, 2> array = { 7, 8 };
+        auto mixed = lz::concat(a, empty, c, array, d);
+        CHECK(mixed.toVector() == std::vector<int>{ 1, 2, 3, 4, 7, 8 });
+        CHECK(mixed.end() - mixed.begin() == 6);
+        for (std::ptrdiff_t i = 0; i <= 6; ++i) {
+            CHECK(mixed.begin() + i == mixed.end() - (6 - i));
+        }
+        auto it = mixed.end();
+        --it, --it, --it;
+        CHECK(*it == 4);
+        CHECK(*(it - 1) == 3);
+    }
+
+    SECTION("Only empty ranges") {
+        auto empty = lz::concat(b, d);
+        CHECK(empty.begin() == empty.end());
+        CHECK(empty.toVector().empty());
+    }
+}
+
 TEST_CASE("Concatenate to containers", "[Concatenate][To container]") {
     std::vector<int> v1 = { 1, 2, 3 };
     std::vector<int> v2 = { 4, 5, 6 };
@@ -124,4 +202,33 @@ TEST_CASE("Concatenate to containers", "[Concatenate][To container]") {
                                                   std::make_pair(4, 4), std::make_pair(5, 5), std::make_pair(6, 6) };
         CHECK(map == expected);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Concatenate segmented iteration", "[Concatenate][Segments]") {
+    std::vector<int> v1 = { 1, 2, 3 };
+    std::vector<int> v2;
+    std::vector<int> v3 = { 4, 5 };
+    auto concat = lz::concat(v1, v2, v3);
+
+    SECTION("Segments") {
+        std::vector<std::size_t> segmentSizes;
+        auto sink = [&segmentSizes](std::vector<int>::iterator begin, std::vector<int>::iterator end) {
+            segmentSizes.push_back(static_cast<std::size_t>(std::distance(begin, end)));
+        };
+        lz::internal::forEachSegment(concat.begin(), concat.end(), sink);
+        CHECK(segmentSizes == std::vector<std::size_t>{ 3, 2 });
+    }
+
+    SECTION("Partial range") {
+        auto begin = std::next(concat.begin(), 2);
+        auto end = std::next(concat.begin(), 4);
+        std::vector<int> result;
+        lz::internal::sinkCopy(begin, end, std::back_inserter(result));
+        CHECK(result == std::vector<int>{ 3, 4 });
+        CHECK(lz::internal::sinkFold(begin, end, 0, std::plus<int>()) == 7);
+    }
+
+    SECTION("To set") {
+        CHECK(concat.to<std::set>() == std::set<int>{ 1, 2, 3, 4, 5 });
+    }
+}
@@ -0,0 +1,91 @@
+#include <Lz/Lz.hpp>
+#include <array>
+#include <catch2/catch.hpp>
+
+namespace {
+LZ_CONSTEXPR_CXX_20 unsigned crc8(unsigned byte) {
+    for (int bit = 0; bit < 8; ++bit) {
+        byte = (byte & 0x80u) != 0 ? ((byte << 1) ^ 0x07u) & 0xFFu : (byte << 1) & 0xFFu;
+    }
+    return byte;
+}
+
+LZ_CONSTEXPR_CXX_20 int sumOfEvenSquares() {
+    int sum = 0;
+    for (const int i : lz::filter(lz::map(lz::range(10), [](int i) { return i * i; }), [](int i) { return i % 2 == 0; })) {
+        sum += i;
+    }
+    return sum;
+}
+
+LZ_CONSTEXPR_CXX_20 int sumOfZippedChunks() {
+    int sum = 0;
+    for (const auto chunk : lz::chunks(lz::take(lz::range(100), 6), 4)) {
+        for (const auto tup : lz::zip(chunk, lz::range(4))) {
+            sum += std::get<0>(tup) * std::get<1>(tup);
+        }
+    }
+    return sum;
+}
+
+LZ_CONSTEXPR_CXX_20 int sumOfCartesianConcatenated() {
+    int sum = 0;
+    for (const auto tup : lz::cartesian(lz::concat(lz::range(2), lz::range(2)), lz::range(3))) {
+        sum += std::get<0>(tup) * std::get<1>(tup);
+    }
+    return sum;
+}
+
+LZ_CONSTEXPR_CXX_20 int sumOfEnumeratedFlattened() {
+    std::array<std::array<int, 2>, 2> nested = { { { 1, 2 }, { 3, 4 } } };
+    int sum = 0;
+    for (const auto pair : lz::enumerate(lz::flatten(nested))) {
+        sum += pair.first * pair.second;
+    }
+    return sum;
+}
+
+LZ_CONSTEXPR_CXX_20 std::array<int, 6> sortedDigits() {
+    std::array<int, 6> digits = { 3, 1, 4, 1, 5, 9 };
+    lz::toIter(digits).sort();
+    return digits;
+}
+} // namespace
+
+TEST_CASE("Constexpr views", "[Constexpr][Basic functionality]") {
+    SECTION("Should evaluate chains") {
+        CHECK(sumOfEvenSquares() == 120);
+        CHECK(sumOfZippedChunks() == 0 * 0 + 1 * 1 + 2 * 2 + 3 * 3 + 4 * 0 + 5 * 1);
+        CHECK(sumOfCartesianConcatenated() == 6);
+        CHECK(sumOfEnumeratedFlattened() == 0 * 1 + 1 * 2 + 2 * 3 + 3 * 4);
+        CHECK(sortedDigits() == std::array<int, 6>{ 1, 1, 3, 4, 5, 9 });
+    }
+
+    SECTION("Should create arrays") {
+        const std::array<unsigned, 4> table = lz::map(lz::range(4u), crc8).toArray<4>();
+        CHECK(table == std::array<unsigned, 4>{ 0x00, 0x07, 0x0E, 0x09 });
+    }
+
+#ifdef LZ_HAS_CONSTEXPR_CXX_20
+    SECTION("Should evaluate chains at compile time") {
+        static_assert(sumOfEvenSquares() == 120);
+        static_assert(sumOfZippedChunks() == 19);
+        static_assert(sumOfCartesianConcatenated() == 6);
+        static_assert(sumOfEnumeratedFlattened() == 20);
+        static_assert(sortedDigits() == std::array<int, 6>{ 1, 1, 3, 4, 5, 9 });
+
+        constexpr auto doubled = lz::toIter(lz::range(5)).map([](int i) { return i * 2; }).toArray<5>();
+        static_assert(doubled == std::array<int, 5>{ 0, 2, 4, 6, 8 });
+    }
+
+    SECTION("Should deduce the size of arrays") {
+        constexpr auto table = lz::toArray([] { return lz::map(lz::range(256u), crc8); });
+        static_assert(table.size() == 256);
+        static_assert(table[1] == 0x07 && table[255] == 0xF3);
+
+        constexpr auto odd = lz::toArray([] { return lz::filter(lz::range(10), [](int i) { return i % 2 != 0; }); });
+        static_assert(odd == std::array<int, 5>{ 1, 3, 5, 7, 9 });
+        CHECK(table[2] == 0x0E);
+    }
+#endif // LZ_HAS_CONSTEXPR_CXX_20
+}
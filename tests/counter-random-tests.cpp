@@ -0,0 +1,84 @@
+#include <Lz/CounterRandom.hpp>
+#include <catch2/catch.hpp>
+#include <list>
+
+TEST_CASE("Counter random is a pure function of key and index", "[CounterRandom][Basic functionality]") {
+    constexpr std::size_t size = 100;
+    const auto random = lz::counterRandom(0, 1000, size, 7);
+    const std::vector<int> values = random.toVector();
+    REQUIRE(values.size() == size);
+    CHECK(std::all_of(values.begin(), values.end(), [](const int i) { return i >= 0 && i <= 1000; }));
+
+    SECTION("Same key gives same sequence") {
+        CHECK(lz::counterRandom(0, 1000, size, 7).toVector() == values);
+        CHECK(lz::counterRandom(0, 1000, size, 8).toVector() != values);
+    }
+
+    SECTION("Random access does not depend on evaluation order") {
+        auto it = random.begin();
+        for (std::size_t i = size; i-- > 0;) {
+            CHECK(it[static_cast<std::ptrdiff_t>(i)] == values[i]);
+        }
+        CHECK(*(it + 50) == values[50]);
+        CHECK(*it == values[0]);
+    }
+
+    SECTION("Splitting gives the same elements") {
+        const auto longer = lz::counterRandom(0, 1000, 2 * size, 7).toVector();
+        CHECK(std::equal(values.begin(), values.end(), longer.begin()));
+    }
+
+    SECTION("Known values") {
+        // Philox4x32-10 of counter 0 and key 0 is 0x6627e8d5 0xe169c58d 0xbc57ac4c 0x9b00dbd8
+        const auto bits = lz::counterRandom<std::uint64_t>(0, (std::numeric_limits<std::uint64_t>::max)(), 2, 0);
+        CHECK(*bits.begin() == 0x6627E8D5E169C58DULL);
+        CHECK(bits.begin()[1] == 0xBC57AC4C9B00DBD8ULL);
+    }
+}
+
+TEST_CASE("Counter random fill", "[CounterRandom][Fill]") {
+    const auto random = lz::counterRandom(0., 1., 101, 11);
+    const std::vector<double> expected = random.toVector();
+
+    std::vector<double> filled(expected.size());
+    random.fillTo(filled);
+    CHECK(filled == expected);
+
+    std::vector<double> part(10);
+    random.fillTo(part.begin(), part.end(), 33);
+    CHECK(std::equal(part.begin(), part.end(), expected.begin() + 33));
+    random.fillTo(part, 90);
+    CHECK(std::equal(part.begin(), part.end(), expected.begin() + 90));
+}
+
+TEST_CASE("Counter random ranges", "[CounterRandom][Ranges]") {
+    SECTION("Floating point") {
+        const auto values = lz::counterRandom(-1., 1., 1000, 3).toVector();
+        CHECK(std::all_of(values.begin(), values.end(), [](const double d) { return d >= -1. && d < 1.; }));
+        const auto floats = lz::counterRandom(0.f, 1.f, 1000, 3).toVector();
+        CHECK(std::all_of(floats.begin(), floats.end(), [](const float f) { return f >= 0.f && f < 1.f; }));
+    }
+
+    SECTION("Small and signed integers") {
+        const auto values = lz::counterRandom<std::int8_t>(-128, 127, 1000, 3).toVector();
+        CHECK(std::any_of(values.begin(), values.end(), [](const std::int8_t i) { return i < 0; }));
+        const auto single = lz::counterRandom(5, 5, 10, 3).toVector();
+        CHECK(std::all_of(single.begin(), single.end(), [](const int i) { return i == 5; }));
+    }
+}
+
+TEST_CASE("Counter random binary operations", "[CounterRandom][Binary ops]") {
+    constexpr std::ptrdiff_t size = 5;
+    const auto random = lz::counterRandom(0., 1., size, 1);
+    auto it = random.begin();
+
+    CHECK(random.end() - it == size);
+    CHECK(std::distance(it, random.end()) == size);
+    ++it;
+    CHECK(random.end() - it == size - 1);
+    --it;
+    CHECK(it == random.begin());
+    CHECK(it < random.end());
+    CHECK(it + size == random.end());
+    CHECK(random.to<std::list>().size() == static_cast<std::size_t>(size));
+}
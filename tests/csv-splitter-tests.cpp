@@ -0,0 +1,72 @@
+#include <Lz/CsvSplitter.hpp>
+#include <Lz/Map.hpp>
+#include <catch2/catch.hpp>
+#include <vector>
+
+namespace {
+template<class Iterable>
+std::vector<std::string> toStrings(const Iterable& iterable) {
+    std::vector<std::string> result;
+    for (auto&& s : iterable) {
+        result.emplace_back(s.data(), s.size());
+    }
+    return result;
+}
+} // namespace
+
+TEST_CASE("CSV fields", "[CSV splitter][Basic functionality]") {
+    SECTION("Without quotes") {
+        const std::string record = "a,bb,,ccc,";
+        CHECK(toStrings(lz::csvFields(record)) == std::vector<std::string>{ "a", "bb", "", "ccc", "" });
+    }
+
+    SECTION("With quotes") {
+        const std::string record = R"(1,"hello, world","say ""hi""",,"")";
+        CHECK(toStrings(lz::csvFields(record)) == std::vector<std::string>{ "1", "hello, world", R"(say ""hi"")", "", "" });
+        CHECK(lz::unescapeCsv(std::string(R"(say ""hi"")")) == R"(say "hi")");
+    }
+
+    SECTION("Tab separated") {
+        const std::string record = "a\t\"b\tc\"\td";
+        CHECK(toStrings(lz::csvFields(record, '\t')) == std::vector<std::string>{ "a", "b\tc", "d" });
+    }
+
+    SECTION("Unterminated quote") {
+        const std::string record = "a,\"b,c";
+        CHECK(toStrings(lz::csvFields(record)) == std::vector<std::string>{ "a", "\"b,c" });
+    }
+}
+
+TEST_CASE("CSV records", "[CSV splitter][Records]") {
+    const std::string text = "id,name\r\n1,\"multi\nline\"\r\n2,plain\n";
+
+    SECTION("Records") {
+        CHECK(toStrings(lz::csvRecords(text)) == std::vector<std::string>{ "id,name", "1,\"multi\nline\"", "2,plain" });
+        const std::string empty;
+        CHECK(toStrings(lz::csvRecords(empty)).empty());
+    }
+
+    SECTION("Records composed with fields") {
+        std::vector<std::vector<std::string>> table;
+        for (auto&& fields : lz::map(lz::csvRecords(text), [](lz::StringView record) { return lz::csvFields(record); })) {
+            table.push_back(toStrings(fields));
+        }
+        const std::vector<std::vector<std::string>> expected = { { "id", "name" }, { "1", "multi\nline" }, { "2", "plain" } };
+        CHECK(table == expected);
+    }
+
+    SECTION("Many records without quotes") {
+        std::string many;
+        for (int i = 0; i < 1000; ++i) {
+            many += std::to_string(i) + ',' + std::to_string(i * 2) + '\n';
+        }
+        std::size_t count = 0;
+        for (auto&& record : lz::csvRecords(many)) {
+            const auto fields = toStrings(lz::csvFields(record));
+            CHECK(fields.size() == 2);
+            CHECK(fields[1] == std::to_string(2 * std::stoi(fields[0])));
+            ++count;
+        }
+        CHECK(count == 1000);
+    }
+}
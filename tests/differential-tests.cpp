@@ -0,0 +1,317 @@
+#include <Lz/BitMask.hpp>
+#include <Lz/Lz.hpp>
+#include <Lz/Random.hpp>
+#include <algorithm>
+#include <array>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <list>
+#include <numeric>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// Randomized differential tests of the fast paths. Sequences that are random access, contiguous or arithmetic progressions take
+// dedicated code paths (selection vectors, memchr, several accumulators, closed forms, segments), which are compared here with
+// the generic path, taken by the same values in a std::list, and with a plain loop. Every trial is generated from its own seed,
+// which is reported when a check fails, so that a failure can be reproduced by running that trial only.
+
+namespace {
+constexpr std::uint64_t trialCount = 200;
+
+std::size_t below(lz::SplitMix64& engine, const std::size_t bound) {
+    return static_cast<std::size_t>(engine() % bound);
+}
+
+// Sizes around the block sizes of the fast paths (8 lanes, 64 bit masks, cache lines) are more likely than others
+std::size_t randomSize(lz::SplitMix64& engine) {
+    static constexpr std::array<std::size_t, 8> edges = { 0, 1, 7, 8, 63, 64, 65, 129 };
+    return engine() % 2 == 0 ? edges[below(engine, edges.size())] : below(engine, 2000);
+}
+
+std::vector<int> randomInts(lz::SplitMix64& engine, const std::size_t size, const int maxValue) {
+    std::vector<int> ints(size);
+    for (int& i : ints) {
+        i = static_cast<int>(below(engine, static_cast<std::size_t>(maxValue) + 1));
+    }
+    return ints;
+}
+
+// Random text of which most characters are in `alphabet`, the others are random printable characters
+std::string randomText(lz::SplitMix64& engine, const std::size_t size, const std::string& alphabet) {
+    std::string text(size, ' ');
+    for (char& c : text) {
+        c = engine() % 4 == 0 ? static_cast<char>(' ' + below(engine, 95)) : alphabet[below(engine, alphabet.size())];
+    }
+    return text;
+}
+
+// Iterates `iterable` one element at a time, without the push based and segmented algorithms that e.g. toVector may use
+template<class Iterable>
+auto pull(const Iterable& iterable) -> std::vector<typename std::decay<decltype(*std::begin(iterable))>::type> {
+    std::vector<typename std::decay<decltype(*std::begin(iterable))>::type> result;
+    for (auto it = std::begin(iterable); it != std::end(iterable); ++it) {
+        result.push_back(*it);
+    }
+    return result;
+}
+
+template<class Iterable>
+std::vector<std::string> toStrings(const Iterable& substrings) {
+    std::vector<std::string> strings;
+    for (const auto& substring : substrings) {
+        strings.emplace_back(substring.data(), substring.size());
+    }
+    return strings;
+}
+
+// Function objects with state that, unlike capturing lambdas, are default constructible, as some iterators require
+struct IsBelow {
+    int threshold;
+
+    bool operator()(const int i) const {
+        return i < threshold;
+    }
+};
+
+struct Scale {
+    int factor;
+
+    int operator()(const int i) const {
+        return i * factor;
+    }
+};
+
+// Splits `text` on every character in `delimiters`. Like lz::split, an empty text has no parts
+std::vector<std::string> referenceSplit(const std::string& text, const std::string& delimiters) {
+    std::vector<std::string> parts;
+    if (text.empty()) {
+        return parts;
+    }
+    std::string part;
+    for (const char c : text) {
+        if (delimiters.find(c) != std::string::npos) {
+            parts.push_back(part);
+            part.clear();
+        }
+        else {
+            part += c;
+        }
+    }
+    parts.push_back(part);
+    return parts;
+}
+} // namespace
+
+TEST_CASE("Filter and fused chains match the generic path", "[Differential]") {
+    for (std::uint64_t trial = 0; trial != trialCount; ++trial) {
+        lz::SplitMix64 engine(trial);
+        const auto values = randomInts(engine, randomSize(engine), 1000);
+        const std::list<int> list(values.begin(), values.end());
+        const int threshold = static_cast<int>(below(engine, 1001));
+        const int factor = static_cast<int>(below(engine, 7)) + 1;
+        const IsBelow isBelow{ threshold };
+        const Scale scale{ factor };
+        const auto isOdd = [](int i) { return i % 2 != 0; };
+        CAPTURE(trial, values.size(), threshold, factor);
+
+        std::vector<int> expected;
+        std::copy_if(values.begin(), values.end(), std::back_inserter(expected), isBelow);
+        CHECK(lz::filter(values, isBelow).toVector() == expected);
+        CHECK(pull(lz::filter(values, isBelow)) == expected);
+        CHECK(lz::filter(list, isBelow).toVector() == expected);
+
+        std::vector<int> chained;
+        for (const int i : values) {
+            if (isBelow(i) && isOdd(scale(i))) {
+                chained.push_back(scale(i));
+            }
+        }
+        CHECK(lz::toIter(values).filter(isBelow).map(scale).filter(isOdd).toVector() == chained);
+        CHECK(pull(lz::toIter(values).filter(isBelow).map(scale).filter(isOdd)) == chained);
+        CHECK(lz::toIter(list).filter(isBelow).map(scale).filter(isOdd).toVector() == chained);
+
+        const auto step = static_cast<std::ptrdiff_t>(below(engine, 9)) + 1;
+        std::vector<int> strided;
+        for (std::size_t i = 0; i < values.size(); i += static_cast<std::size_t>(step)) {
+            strided.push_back(scale(values[i]));
+        }
+        CHECK(lz::map(lz::takeEvery(values, step), scale).toVector() == strided);
+        CHECK(pull(lz::map(lz::takeEvery(values, step), scale)) == strided);
+        CHECK(lz::map(lz::takeEvery(list, step), scale).toVector() == strided);
+    }
+}
+
+TEST_CASE("Reductions match the generic path", "[Differential]") {
+    lz::ThreadPool pool(3);
+
+    for (std::uint64_t trial = 0; trial != trialCount; ++trial) {
+        lz::SplitMix64 engine(trial);
+        const auto values = randomInts(engine, randomSize(engine), 1 << 20);
+        const std::list<int> list(values.begin(), values.end());
+        CAPTURE(trial, values.size());
+
+        const long long expected = std::accumulate(values.begin(), values.end(), 0LL);
+        CHECK(lz::reduce(values, 0LL, std::plus<long long>()) == expected);
+        CHECK(lz::reduce(list, 0LL, std::plus<long long>()) == expected);
+        CHECK(lz::reduce(values, 0LL, std::plus<long long>(), lz::execution::pool(pool)) == expected);
+        CHECK(lz::reduce(list, 0LL, std::plus<long long>(), lz::execution::pool(pool)) == expected);
+        CHECK(lz::reduce(values, 0LL, std::plus<long long>(), lz::execution::pool(pool).reproducible()) == expected);
+
+        if (!values.empty()) {
+            const int minimum = *std::min_element(values.begin(), values.end());
+            const int maximum = *std::max_element(values.begin(), values.end());
+            CHECK(lz::toIter(values).min() == minimum);
+            CHECK(lz::toIter(list).min() == minimum);
+            CHECK(lz::toIter(values).max() == maximum);
+            CHECK(lz::toIter(list).max() == maximum);
+        }
+
+        const int from = static_cast<int>(below(engine, 2001)) - 1000;
+        const int rangeStep = (engine() % 2 == 0 ? 1 : -1) * (static_cast<int>(below(engine, 5)) + 1);
+        const int to = from + rangeStep * static_cast<int>(below(engine, 500));
+        const auto range = lz::range(from, to, rangeStep);
+        const auto rangeValues = pull(range);
+        CAPTURE(from, to, rangeStep);
+        CHECK(lz::reduce(range, 0, std::plus<int>()) == std::accumulate(rangeValues.begin(), rangeValues.end(), 0));
+        const int needle = from + static_cast<int>(below(engine, 1001)) - 500;
+        CHECK(lz::contains(range, needle) == (std::find(rangeValues.begin(), rangeValues.end(), needle) != rangeValues.end()));
+    }
+}
+
+TEST_CASE("Searching and comparing match the generic path", "[Differential]") {
+    for (std::uint64_t trial = 0; trial != trialCount; ++trial) {
+        lz::SplitMix64 engine(trial);
+        const auto values = randomInts(engine, randomSize(engine), 255);
+        const std::list<int> list(values.begin(), values.end());
+        const int needle = static_cast<int>(below(engine, 300));
+        const std::vector<int> needles = randomInts(engine, below(engine, 4), 300);
+        CAPTURE(trial, values.size(), needle, needles);
+
+        const bool contains = std::find(values.begin(), values.end(), needle) != values.end();
+        CHECK(lz::contains(values, needle) == contains);
+        CHECK(lz::contains(list, needle) == contains);
+
+        const bool containsAny = std::find_first_of(values.begin(), values.end(), needles.begin(), needles.end()) != values.end();
+        CHECK(lz::containsAny(values, needles) == containsAny);
+        CHECK(lz::containsAny(list, needles) == containsAny);
+
+        auto other = values;
+        if (!other.empty() && engine() % 2 == 0) {
+            other[below(engine, other.size())] += 1;
+        }
+        const std::list<int> otherList(other.begin(), other.end());
+        CHECK(lz::equal(values, other) == (values == other));
+        CHECK(lz::equal(list, otherList) == (values == other));
+
+        const std::size_t prefixSize = values.empty() ? 0 : below(engine, values.size() + 1);
+        const std::vector<int> prefix(other.begin(), other.begin() + static_cast<std::ptrdiff_t>(prefixSize));
+        const bool startsWith = std::equal(prefix.begin(), prefix.end(), values.begin());
+        CHECK(lz::startsWith(values, prefix) == startsWith);
+        CHECK(lz::startsWith(list, std::list<int>(prefix.begin(), prefix.end())) == startsWith);
+    }
+}
+
+TEST_CASE("Case insensitive comparisons match the generic path", "[Differential]") {
+    const auto lower = [](char c) { return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c; };
+
+    for (std::uint64_t trial = 0; trial != trialCount; ++trial) {
+        lz::SplitMix64 engine(trial);
+        const std::string a = randomText(engine, randomSize(engine), "aAzZ@[`{");
+        std::string b = a;
+        for (char& c : b) {
+            c = engine() % 2 == 0 ? lower(c) : c;
+        }
+        if (!b.empty() && engine() % 2 == 0) {
+            b[below(engine, b.size())] = static_cast<char>(' ' + below(engine, 95));
+        }
+        CAPTURE(trial, a, b);
+
+        const bool expected = lz::map(a, lower).toString() == lz::map(b, lower).toString();
+        CHECK(lz::equal(a, b, lz::CaseInsensitiveEqual()) == expected);
+        CHECK(lz::equal(std::list<char>(a.begin(), a.end()), std::list<char>(b.begin(), b.end()), lz::CaseInsensitiveEqual()) ==
+              expected);
+
+        const std::string suffix = b.substr(b.size() / 2);
+        const bool endsWith = lz::map(a, lower).toString().size() >= suffix.size() &&
+                              lz::map(a.substr(a.size() - suffix.size()), lower).toString() == lz::map(suffix, lower).toString();
+        CHECK(lz::endsWith(a, suffix, lz::CaseInsensitiveEqual()) == endsWith);
+        CHECK(lz::endsWith(std::list<char>(a.begin(), a.end()), std::list<char>(suffix.begin(), suffix.end()),
+                           lz::CaseInsensitiveEqual()) == endsWith);
+    }
+}
+
+TEST_CASE("Splitting matches a plain loop", "[Differential]") {
+    for (std::uint64_t trial = 0; trial != trialCount; ++trial) {
+        lz::SplitMix64 engine(trial);
+        const std::string text = randomText(engine, randomSize(engine), "ab,,;");
+        const std::vector<char> chars(text.begin(), text.end());
+        CAPTURE(trial, text);
+
+        const auto expected = referenceSplit(text, ",");
+        CHECK(toStrings(lz::split(text, ',')) == expected);
+        CHECK(toStrings(lz::split(chars, ',')) == expected);
+        CHECK(toStrings(lz::split(text, std::string(","))) == expected);
+        CHECK(toStrings(lz::splitAny(text, ",;")) == referenceSplit(text, ",;"));
+    }
+}
+
+#ifdef LZ_HAS_STRING_VIEW
+TEST_CASE("Trimming matches a plain loop", "[Differential]") {
+    for (std::uint64_t trial = 0; trial != trialCount; ++trial) {
+        lz::SplitMix64 engine(trial);
+        const std::string text = randomText(engine, randomSize(engine), " \t\n\r\v\fx");
+        CAPTURE(trial, text);
+
+        const auto isSpace = [](char c) { return c == ' ' || (c >= '\t' && c <= '\r'); };
+        const auto first = std::find_if_not(text.begin(), text.end(), isSpace);
+        const auto last = std::find_if_not(text.rbegin(), std::string::const_reverse_iterator(first), isSpace).base();
+        const auto trimmed = lz::trimString(text);
+        CHECK(std::string(trimmed.begin(), trimmed.end()) == std::string(first, last));
+        CHECK(std::string(lz::trimString(std::string_view(text))) == std::string(first, last));
+    }
+}
+#endif
+
+TEST_CASE("Except, bit masks and flatten match the generic path", "[Differential]") {
+    for (std::uint64_t trial = 0; trial != trialCount; ++trial) {
+        lz::SplitMix64 engine(trial);
+        const auto values = randomInts(engine, randomSize(engine), 300);
+        const std::list<int> list(values.begin(), values.end());
+        auto toExcept = randomInts(engine, below(engine, 100), 300);
+        std::sort(toExcept.begin(), toExcept.end());
+        CAPTURE(trial, values.size(), toExcept.size());
+
+        const std::unordered_set<int> excluded(toExcept.begin(), toExcept.end());
+        std::vector<int> expected;
+        std::copy_if(values.begin(), values.end(), std::back_inserter(expected), [&](int i) { return excluded.count(i) == 0; });
+        CHECK(lz::except(values, toExcept).toVector() == expected);
+        CHECK(lz::except(list, toExcept).toVector() == expected);
+        CHECK(lz::exceptHashed(values, toExcept).toVector() == expected);
+        CHECK(lz::exceptPrefiltered(values, toExcept).toVector() == expected);
+
+        const auto isSelected = [](int i) { return i % 3 == 0; };
+        std::vector<int> selected;
+        std::copy_if(values.begin(), values.end(), std::back_inserter(selected), isSelected);
+        CHECK(lz::selectBits(values, lz::toBitMask(values, isSelected)).toVector() == selected);
+        CHECK(pull(lz::selectBits(values, lz::toBitMask(list, isSelected))) == selected);
+
+        std::vector<std::array<int, 3>> triples(values.size() / 3);
+        std::vector<std::vector<int>> nested;
+        for (std::size_t i = 0; i != triples.size(); ++i) {
+            std::copy_n(values.begin() + static_cast<std::ptrdiff_t>(i * 3), 3, triples[i].begin());
+            nested.emplace_back(triples[i].begin(), triples[i].begin() + static_cast<std::ptrdiff_t>(below(engine, 4)));
+        }
+        const std::vector<int> flatTriples(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(triples.size() * 3));
+        CHECK(lz::flatten(triples).toVector() == flatTriples);
+        CHECK(pull(lz::flatten(triples)) == flatTriples);
+
+        std::vector<int> flatNested;
+        for (const auto& inner : nested) {
+            flatNested.insert(flatNested.end(), inner.begin(), inner.end());
+        }
+        CHECK(lz::flatten(nested).toVector() == flatNested);
+        CHECK(pull(lz::flatten(nested)) == flatNested);
+        CHECK(lz::concat(values, flatNested).toVector() == pull(lz::concat(values, flatNested)));
+    }
+}
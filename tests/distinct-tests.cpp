@@ -0,0 +1,124 @@
+#include <Lz/Distinct.hpp>
+#include <catch2/catch.hpp>
+#include <cctype>
+#include <list>
+#include <string>
+
+TEST_CASE("Distinct changing and creating elements", "[Distinct][Basic functionality]") {
+    std::array<int, 7> arr = { 3, 2, 3, 1, 2, 5, 3 };
+    auto distinct = lz::distinct(arr);
+    auto beg = distinct.begin();
+    constexpr std::size_t size = 4;
+
+    REQUIRE(*beg == 3);
+    REQUIRE(static_cast<std::size_t>(std::distance(beg, distinct.end())) == size);
+
+    SECTION("Should be distinct in order of first occurrence") {
+        std::array<int, size> expected = { 3, 2, 1, 5 };
+        CHECK(expected == distinct.toArray<size>());
+    }
+
+    SECTION("Should be by reference") {
+        *beg = 10;
+        CHECK(arr[0] == 10);
+    }
+
+    SECTION("Custom hash and equality") {
+        struct LowerHash {
+            std::size_t operator()(const char c) const {
+                return std::hash<char>()(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+            }
+        };
+        struct LowerEqual {
+            bool operator()(const char a, const char b) const {
+                return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+            }
+        };
+        std::string str = "aAbBcabC";
+        auto distinctChars = lz::distinct(str, 8, LowerHash(), LowerEqual());
+        CHECK(distinctChars.toString() == "abc");
+    }
+
+    SECTION("Empty") {
+        std::vector<int> empty;
+        auto distinctEmpty = lz::distinct(empty);
+        CHECK(distinctEmpty.begin() == distinctEmpty.end());
+    }
+}
+
+TEST_CASE("Distinct binary operations", "[Distinct][Binary ops]") {
+    std::array<int, 7> arr = { 3, 2, 3, 1, 2, 5, 3 };
+    auto distinct = lz::distinct(arr);
+    auto beg = distinct.begin();
+
+    SECTION("Operator++") {
+        ++beg;
+        CHECK(*beg == 2);
+        ++beg;
+        CHECK(*beg == 1);
+    }
+
+    SECTION("Operator==, operator!=") {
+        CHECK(beg != distinct.end());
+        beg = distinct.end();
+        CHECK(beg == distinct.end());
+    }
+
+    SECTION("Iterators are independent") {
+        auto copy = beg;
+        ++beg;
+        ++beg;
+        CHECK(*beg == 1);
+        CHECK(*copy == 3);
+        ++copy;
+        CHECK(*copy == 2);
+        CHECK(std::distance(distinct.begin(), distinct.end()) == 4);
+        CHECK(std::distance(distinct.begin(), distinct.end()) == 4);
+    }
+}
+
+TEST_CASE("Distinct to container", "[Distinct][To container]") {
+    std::array<int, 7> arr = { 3, 2, 3, 1, 2, 5, 3 };
+    constexpr std::size_t size = 4;
+    auto distinct = lz::distinct(arr, size);
+
+    SECTION("To array") {
+        auto distinctArray = distinct.toArray<size>();
+        std::array<int, size> expected = { 3, 2, 1, 5 };
+        CHECK(distinctArray == expected);
+    }
+
+    SECTION("To vector") {
+        auto distinctVec = distinct.toVector();
+        std::vector<int> expected = { 3, 2, 1, 5 };
+        CHECK(distinctVec == expected);
+    }
+
+    SECTION("To other container using to<>()") {
+        auto distinctList = distinct.to<std::list>();
+        std::list<int> expected = { 3, 2, 1, 5 };
+        CHECK(distinctList == expected);
+    }
+
+    SECTION("To map") {
+        std::map<int, int> actual = distinct.toMap([](const int i) { return i; });
+        std::map<int, int> expected = {
+            std::make_pair(1, 1),
+            std::make_pair(2, 2),
+            std::make_pair(3, 3),
+            std::make_pair(5, 5),
+        };
+        CHECK(expected == actual);
+    }
+
+    SECTION("To unordered map") {
+        std::unordered_map<int, int> actual = distinct.toUnorderedMap([](const int i) { return i; });
+        std::unordered_map<int, int> expected = {
+            std::make_pair(1, 1),
+            std::make_pair(2, 2),
+            std::make_pair(3, 3),
+            std::make_pair(5, 5),
+        };
+        CHECK(expected == actual);
+    }
+}
@@ -1,4 +1,5 @@
 #include <Lz/Enumerate.hpp>
+#include <Lz/Filter.hpp>
 #include <catch2/catch.hpp>
 #include <list>
 
@@ -31,6 +32,55 @@ TEST_CASE("Enumerate changing and creating elements", "[Enumerate][Basic functio
     }
 }
 
+TEST_CASE("Enumerate index arithmetic", "[Enumerate][Index]") {
+    std::vector<int> vec = { 1, 2, 3, 4 };
+    std::list<int> list = { 1, 2, 3, 4 };
+
+    SECTION("Index from end with offset, random access") {
+        auto enumerate = lz::enumerate(vec, 5);
+        auto end = enumerate.end();
+        --end;
+        CHECK(end->first == 8);
+        CHECK(end->second == 4);
+        CHECK((enumerate.end() - 2)->first == 7);
+    }
+
+    SECTION("Index from end with offset, bidirectional") {
+        auto enumerate = lz::enumerate(list, 5);
+        auto end = enumerate.end();
+        --end;
+        CHECK(end->first == 8);
+        CHECK(end->second == 4);
+    }
+
+    SECTION("Iterator pair with offset") {
+        auto enumerate = lz::enumerateRange(list.begin(), list.end(), 2);
+        CHECK(enumerate.begin()->first == 2);
+        CHECK(std::prev(enumerate.end())->first == 5);
+    }
+
+    SECTION("64 bit index") {
+        constexpr std::int64_t start = std::int64_t{ 1 } << 40;
+        auto enumerate = lz::enumerate<std::int64_t>(vec, start);
+        CHECK(enumerate.begin()[3].first == start + 3);
+        CHECK(std::prev(lz::enumerate<std::int64_t>(list, start).end())->first == start + 3);
+    }
+
+    SECTION("Push based loop") {
+        auto isEven = [](const std::pair<int, int&> pair) {
+            return pair.second % 2 == 0;
+        };
+        std::vector<std::pair<int, int>> expected = { { 3, 2 }, { 5, 4 } };
+        CHECK(lz::filter(lz::enumerate(vec, 2), isEven).toVector() == expected);
+        CHECK(lz::filter(lz::enumerate(list, 2), isEven).toVector() == expected);
+
+        std::vector<std::pair<int, int>> all = { { 2, 1 }, { 3, 2 }, { 4, 3 }, { 5, 4 } };
+        CHECK(lz::enumerate(vec, 2).toVector() == all);
+        CHECK(lz::enumerate(list, 2).toVector() == all);
+        CHECK(lz::enumerateRange(vec.begin() + 1, vec.end(), 3).toVector() == decltype(all)(all.begin() + 1, all.end()));
+    }
+}
+
 TEST_CASE("Enumerate binary operations", "[Enumerate][Binary ops]") {
     constexpr std::size_t size = 3;
     std::array<int, size> array = { 1, 2, 3 };
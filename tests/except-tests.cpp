@@ -1,7 +1,11 @@
 #include <Lz/Except.hpp>
 #include <Lz/Range.hpp>
+#include <algorithm>
 #include <catch2/catch.hpp>
 #include <list>
+#include <set>
+#include <string>
+#include <unordered_set>
 
 TEST_CASE("Except excepts elements and is by reference", "[Except][Basic functionality]") {
     std::vector<int> array{ 1, 2, 3, 4, 5 };
@@ -102,3 +106,107 @@ TEST_CASE("Except to containers", "[Except][To container]") {
         CHECK(actual == expected);
     }
 }
+
+TEST_CASE("Hashed except with unsorted exclusion sets", "[Except][Basic functionality]") {
+    std::vector<int> array = lz::range(40).toVector();
+
+    SECTION("Small exclusion set is scanned linearly") {
+        std::vector<int> toExcept{ 30, 3, 0, 17 };
+        auto except = lz::exceptHashed(array, toExcept);
+        CHECK(except.toVector() == lz::filter(array, [](int i) { return i != 30 && i != 3 && i != 0 && i != 17; }).toVector());
+    }
+
+    SECTION("Large exclusion set is hashed") {
+        std::list<int> toExcept;
+        for (int i = 39; i >= 0; i -= 2) {
+            toExcept.push_back(i);
+        }
+        auto except = lz::exceptHashed(array, toExcept);
+        CHECK(except.toVector() == lz::range(0, 40, 2).toVector());
+        CHECK(lz::exceptHashed(array, array).toVector().empty());
+    }
+
+    SECTION("Empty exclusion set") {
+        std::vector<int> none;
+        CHECK(lz::exceptHashed(array, none).toVector() == array);
+    }
+
+    SECTION("Custom hash and equality") {
+        std::vector<std::string> words = { "Apple", "pear", "BANANA", "kiwi" };
+        std::vector<std::string> toExcept = { "apple", "banana" };
+        struct LowerHash {
+            std::size_t operator()(const std::string& s) const {
+                std::string lower;
+                std::transform(s.begin(), s.end(), std::back_inserter(lower), [](char c) { return static_cast<char>(std::tolower(c)); });
+                return std::hash<std::string>()(lower);
+            }
+        };
+        struct LowerEqual {
+            bool operator()(const std::string& a, const std::string& b) const {
+                return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+                           return std::tolower(x) == std::tolower(y);
+                       });
+            }
+        };
+        auto except = lz::exceptHashed(words, toExcept, LowerHash(), LowerEqual());
+        CHECK(except.toVector() == std::vector<std::string>{ "pear", "kiwi" });
+    }
+
+    SECTION("Caller provided set") {
+        std::unordered_set<int> blocked = { 1, 2, 3, 39 };
+        std::set<int> ordered = { 0, 38 };
+        auto except = lz::exceptIn(array, blocked);
+        CHECK(except.begin() != except.end());
+        CHECK(*except.begin() == 0);
+        CHECK(std::distance(except.begin(), except.end()) == 36);
+        CHECK(lz::exceptIn(except, ordered).toVector().front() == 4);
+    }
+}
+
+TEST_CASE("Prefiltered except with integral keys", "[Except][Basic functionality]") {
+    SECTION("Dense keys use an exact bitmap") {
+        std::vector<int> toExcept{ -3, 0, 2, 5, 9 };
+        lz::KeyFilter<int> keyFilter(toExcept.begin(), toExcept.end(), [](int i) { return i; }, 0.01);
+        CHECK(keyFilter.isExact());
+        for (int i = -10; i < 20; ++i) {
+            CHECK(keyFilter.mayContain(i) == std::binary_search(toExcept.begin(), toExcept.end(), i));
+        }
+    }
+
+    SECTION("Sparse keys use a bloom filter without false negatives") {
+        std::vector<long long> toExcept;
+        for (long long i = 0; i < 1000; ++i) {
+            toExcept.push_back(i * 1000003);
+        }
+        lz::KeyFilter<long long> keyFilter(toExcept.begin(), toExcept.end(), [](long long i) { return i; }, 0.01);
+        CHECK(!keyFilter.isExact());
+        for (long long i : toExcept) {
+            CHECK(keyFilter.mayContain(i));
+        }
+        int falsePositives = 0;
+        for (long long i = 1; i <= 10000; ++i) {
+            falsePositives += keyFilter.mayContain(i * 1000003 + 1) ? 1 : 0;
+        }
+        CHECK(falsePositives < 500);
+    }
+
+    SECTION("Same result as except") {
+        std::vector<int> array;
+        for (int i = 0; i < 500; ++i) {
+            array.push_back((i * 7919) % 10007);
+        }
+        std::vector<int> toExcept{ 0, 7919, 5831, 100, 2000, 9999 };
+        std::sort(toExcept.begin(), toExcept.end());
+
+        std::vector<int> expected = lz::except(array, toExcept).toVector();
+        CHECK(lz::exceptPrefiltered(array, toExcept).toVector() == expected);
+        CHECK(lz::exceptPrefiltered(array, toExcept, 0.001).toVector() == expected);
+        CHECK(expected.size() == array.size() - 3);
+    }
+
+    SECTION("Empty exclusion set") {
+        std::vector<int> array{ 1, 2, 3 };
+        std::vector<int> toExcept;
+        CHECK(lz::exceptPrefiltered(array, toExcept).toVector() == array);
+    }
+}
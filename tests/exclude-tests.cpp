@@ -75,6 +75,29 @@ TEST_CASE("Exclude binary operations", "[Exclude][Binary ops]") {
         CHECK(lz::next(exBeg3, 7) == exEnd3);
     }
 
+    SECTION("Random access") {
+        CHECK(exEnd1 - exBeg1 == 8);
+        CHECK(exBeg1 - exEnd1 == -8);
+        CHECK(*(exEnd1 - 1) == 10);
+        CHECK(*(exEnd1 - 5) == 6);
+        CHECK(*(exEnd1 - 6) == 3);
+        CHECK(exBeg1[3] == 6);
+        CHECK(*(exEnd2 - 8) == 3);
+        CHECK(exEnd2 - 8 == exBeg2);
+        CHECK(*(exEnd3 - 1) == 7);
+        CHECK(exBeg1 < exEnd1);
+
+        auto it = exEnd1;
+        --it, --it, --it, --it, --it;
+        CHECK(*it == 6);
+        --it;
+        CHECK(*it == 3);
+        it += 1;
+        CHECK(*it == 6);
+        it -= 2;
+        CHECK(*it == 2);
+    }
+
     SECTION("Lz distance") {
         CHECK(lz::distance(exBeg1, exEnd1) == 8);
         CHECK(lz::distance(lz::next(exBeg1, 3), exEnd1) == 5);
@@ -87,6 +110,15 @@ TEST_CASE("Exclude binary operations", "[Exclude][Binary ops]") {
     }
 }
 
+TEST_CASE("Exclude forward sequences", "[Exclude][Basic functionality]") {
+    std::list<int> list = { 1, 2, 3, 4, 5, 6 };
+    auto excluded = lz::exclude(list, 1, 3);
+    CHECK(excluded.toVector() == std::vector<int>{ 1, 4, 5, 6 });
+    CHECK(lz::distance(excluded.begin(), excluded.end()) == 4);
+    CHECK(*lz::next(excluded.begin(), 2) == 5);
+    CHECK(lz::exclude(list, 0, 6).toVector().empty());
+}
+
 TEST_CASE("Exclude to containers", "[Exclude][To container]") {
     std::array<int, 10> arr = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
 
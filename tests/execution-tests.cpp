@@ -0,0 +1,167 @@
+// The execution policy overloads are only available if <execution> is included before cpp-lazy
+#if defined(__has_include)
+#    if __has_include(<execution>)
+#        include <execution>
+#    endif
+#endif
+
+#include "Lz/Lz.hpp"
+
+#include <catch2/catch.hpp>
+#include <mutex>
+#include <string_view>
+
+#ifdef LZ_HAS_EXECUTION
+TEST_CASE("Parallel materialization of random access chains") {
+    constexpr int size = 100000;
+    auto chain = lz::toIter(lz::range(size)).map([](int i) { return static_cast<double>(i) * 0.5; });
+    static_assert(lz::internal::IsRandomAccess<decltype(chain.begin())>::value, "Map over range should be random access");
+
+    const std::vector<double> expected = chain.toVector();
+    CHECK(chain.toVector(std::execution::par) == expected);
+    CHECK(chain.to<std::vector<double>>(std::execution::par_unseq) == expected);
+
+    std::vector<double> output(static_cast<std::size_t>(size));
+    chain.copyTo(output.begin(), std::execution::par);
+    CHECK(output == expected);
+
+    auto zipped = lz::toIter(lz::zip(lz::range(size), expected)).map([](const std::tuple<int, double>& tup) {
+        return static_cast<double>(std::get<0>(tup)) - std::get<1>(tup);
+    });
+    CHECK(zipped.toVector(std::execution::par) == expected);
+
+    std::vector<int> small = { 1, 2, 3 };
+    CHECK(lz::toIter(small).toVector(std::execution::par) == small);
+}
+
+TEST_CASE("Sorting with an execution policy") {
+    std::vector<int> v = { 5, 3, 4, 1, 2 };
+    lz::toIter(v).sort(std::greater<>(), std::execution::par);
+    CHECK(v == std::vector<int>{ 5, 4, 3, 2, 1 });
+    lz::toIter(v).sort(std::less<>(), std::execution::seq);
+    CHECK(v == std::vector<int>{ 1, 2, 3, 4, 5 });
+}
+
+TEST_CASE("Parallel joinWhere yields the same matches as sequential") {
+    std::vector<int> a = lz::range(2000).toVector();
+    std::vector<int> b;
+    for (int i = 0; i < 3000; i += 3) {
+        b.push_back(i);
+        b.push_back(i);
+    }
+    const auto identity = [](int i) {
+        return i;
+    };
+    const auto pair = [](int x, int y) {
+        return std::make_pair(x, y);
+    };
+
+    const auto sequential = lz::joinWhere(a, b, identity, identity, pair, std::execution::seq).toVector();
+    const auto parallel = lz::joinWhere(a, b, identity, identity, pair, std::execution::par).toVector();
+    REQUIRE(sequential.size() == 2 * 667);
+    CHECK(parallel == sequential);
+
+    std::vector<int> noMatches = { 5000, 6000 };
+    CHECK(lz::joinWhere(noMatches, b, identity, identity, pair, std::execution::par).toVector().empty());
+}
+
+TEST_CASE("Parallel hash aggregation merges partial maps") {
+    constexpr int size = 200000;
+    auto input = lz::range(size).toVector();
+    auto key = [](int i) { return i % 97; };
+
+    auto counts = lz::countBy(input, key, std::execution::par);
+    CHECK(counts == lz::countBy(input, key));
+    CHECK(counts.size() == 97);
+
+    auto identity = [](int i) { return static_cast<long long>(i); };
+    CHECK(lz::sumBy(input, key, identity, std::execution::par) == lz::sumBy(input, key, identity));
+
+    auto max = [](int acc, int i) { return (std::max)(acc, i); };
+    auto maxima = lz::aggregateBy(input, key, -1, max, max, std::execution::par);
+    CHECK(maxima == lz::aggregateBy(input, key, -1, max));
+    CHECK(maxima[0] == 199917);
+}
+
+TEST_CASE("Parallel groupBy forEach visits every group once") {
+    constexpr int size = 100000;
+    std::vector<int> sorted = lz::map(lz::range(size), [](int i) { return i / 7; }).toVector();
+    auto grouper = lz::groupBy(sorted);
+
+    std::vector<std::pair<int, std::ptrdiff_t>> expected;
+    grouper.forEach([&expected](const std::pair<int&, lz::internal::BasicIteratorView<std::vector<int>::iterator>>& group) {
+        expected.emplace_back(group.first, std::distance(group.second.begin(), group.second.end()));
+    });
+    CHECK(expected.size() == (size + 6) / 7);
+
+    std::mutex mutex;
+    std::vector<std::pair<int, std::ptrdiff_t>> actual;
+    auto collect = [&mutex, &actual](const std::pair<int&, lz::internal::BasicIteratorView<std::vector<int>::iterator>>& group) {
+        std::lock_guard<std::mutex> lock(mutex);
+        actual.emplace_back(group.first, std::distance(group.second.begin(), group.second.end()));
+    };
+    grouper.forEach(collect, std::execution::par);
+    std::sort(actual.begin(), actual.end());
+    CHECK(actual == expected);
+
+    actual.clear();
+    lz::toIter(sorted).groupBy().forEach(collect, std::execution::par);
+    std::sort(actual.begin(), actual.end());
+    CHECK(actual == expected);
+}
+
+TEST_CASE("Parallel adaptors give the same results for dense and sparse matches") {
+    constexpr int size = 50000;
+    const std::vector<int> input = lz::range(size).toVector();
+
+    auto dense = [](int i) { return i % 2 == 0; };
+    auto sparse = [](int i) { return i % 9973 == 0; };
+    CHECK(lz::filter(input, dense, std::execution::par).toVector() == lz::filter(input, dense).toVector());
+    CHECK(lz::filter(input, sparse, std::execution::par).toVector() == lz::filter(input, sparse).toVector());
+
+    const std::vector<int> runs = lz::map(input, [](int i) { return i / 3000; }).toVector();
+    CHECK(lz::unique(runs, std::less<>(), std::execution::par).toVector() == lz::unique(runs).toVector());
+    CHECK(lz::chunkIf(input, sparse, std::execution::par).distance() == lz::chunkIf(input, sparse).distance());
+    CHECK(lz::groupBy(runs, std::equal_to<>(), std::execution::par).distance() == lz::groupBy(runs).distance());
+
+    const std::vector<int> toExcept = { 1, 2, 3, 40000 };
+    CHECK(lz::except(input, toExcept, std::less<>(), std::execution::par).toVector() == lz::except(input, toExcept).toVector());
+}
+
+TEST_CASE("Parallel lines visits every line once") {
+    std::string text;
+    for (int i = 0; i < 100000; ++i) {
+        text += std::to_string(i);
+        text += i % 7 == 0 ? "\r\n\n" : "\n";
+    }
+    text += "last";
+
+    std::mutex mutex;
+    std::vector<std::string_view> actual;
+    const auto collect = [&mutex, &actual](const std::string_view line) {
+        std::lock_guard<std::mutex> lock(mutex);
+        actual.push_back(line);
+    };
+    const auto sorted = [&actual] {
+        std::sort(actual.begin(), actual.end(), [](std::string_view a, std::string_view b) { return a.data() < b.data(); });
+        return std::move(actual);
+    };
+
+    auto lines = lz::lines<std::string_view>(text);
+    lz::toIter(lines).forEach(collect, std::execution::par);
+    CHECK(sorted() == lines.toVector());
+
+    actual.clear();
+    auto rest = std::next(lines.begin(), 1000);
+    lz::IterView<decltype(rest)>(rest, lines.end()).forEach(collect, std::execution::par);
+    CHECK(sorted() == lz::IterView<decltype(rest)>(rest, lines.end()).toVector());
+
+    actual.clear();
+    lz::toIter(lz::crlfLines<std::string_view>(text)).forEach(collect, std::execution::par);
+    CHECK(sorted() == lz::crlfLines<std::string_view>(text).toVector());
+
+    actual.clear();
+    lz::toIter(lz::lines<std::string_view>(std::string())).forEach(collect, std::execution::par);
+    CHECK(actual.empty());
+}
+#endif // LZ_HAS_EXECUTION
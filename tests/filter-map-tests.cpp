@@ -0,0 +1,94 @@
+#include "Lz/FilterMap.hpp"
+
+#include <catch2/catch.hpp>
+#include <list>
+#include <string>
+
+namespace {
+// A minimal optional, so that this test doesn't depend on C++17
+template<class T>
+struct Maybe {
+    T value;
+    bool engaged;
+
+    explicit operator bool() const {
+        return engaged;
+    }
+
+    T& operator*() {
+        return value;
+    }
+
+    const T& operator*() const {
+        return value;
+    }
+};
+
+struct ParseEven {
+    int* calls;
+
+    Maybe<int> operator()(const std::string& s) const {
+        ++*calls;
+        const int i = std::stoi(s);
+        return i % 2 == 0 ? Maybe<int>{ i, true } : Maybe<int>{};
+    }
+};
+} // namespace
+
+TEST_CASE("FilterMap changing and creating elements", "[FilterMap][Basic functionality]") {
+    std::vector<std::string> strings = { "1", "2", "3", "4", "6", "7" };
+    int calls = 0;
+
+    SECTION("Yields the engaged values") {
+        auto filterMapped = lz::filterMap(strings, ParseEven{ &calls });
+        CHECK(filterMapped.toVector() == std::vector<int>{ 2, 4, 6 });
+    }
+
+    SECTION("Calls the function once per element") {
+        auto filterMapped = lz::filterMap(strings, ParseEven{ &calls });
+        for (auto it = filterMapped.begin(); it != filterMapped.end(); ++it) {
+            CHECK(*it % 2 == 0);
+            CHECK(*it == *it);
+        }
+        CHECK(calls == 6);
+
+        calls = 0;
+        auto other = lz::filterMap(strings, ParseEven{ &calls });
+        static_cast<void>(other.toVector());
+        CHECK(calls == 6);
+    }
+
+    SECTION("Pointers") {
+        std::list<int> list = { 1, 2, 3 };
+        auto filterMapped = lz::filterMap(list, [](int& i) { return i != 2 ? &i : nullptr; });
+        CHECK(filterMapped.toVector() == std::vector<int>{ 1, 3 });
+    }
+
+    SECTION("Empty") {
+        std::vector<std::string> empty;
+        CHECK(lz::filterMap(empty, ParseEven{ &calls }).toVector().empty());
+        std::vector<std::string> odd = { "1", "3" };
+        auto filterMapped = lz::filterMap(odd, ParseEven{ &calls });
+        CHECK(filterMapped.begin() == filterMapped.end());
+    }
+}
+
+TEST_CASE("FilterMap binary operations", "[FilterMap][Binary ops]") {
+    std::vector<std::string> strings = { "1", "2", "3", "4" };
+    int calls = 0;
+    auto filterMapped = lz::filterMap(strings, ParseEven{ &calls });
+    auto begin = filterMapped.begin();
+
+    SECTION("Operator++") {
+        CHECK(*begin == 2);
+        ++begin;
+        CHECK(*begin == 4);
+        ++begin;
+        CHECK(begin == filterMapped.end());
+    }
+
+    SECTION("Operator== & Operator!=") {
+        CHECK(begin != filterMapped.end());
+        CHECK(begin == filterMapped.begin());
+    }
+}
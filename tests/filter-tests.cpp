@@ -1,6 +1,7 @@
 #include <Lz/Filter.hpp>
 #include <catch2/catch.hpp>
 #include <list>
+#include <numeric>
 
 TEST_CASE("Filter filters and is by reference", "[Filter][Basic functionality]") {
     constexpr size_t size = 3;
@@ -129,3 +130,63 @@ TEST_CASE("Filter to container", "[Filter][To container]") {
         CHECK(expected == actual);
     }
 }
+
+TEST_CASE("Filter size hint and materialize policy", "[Filter][Size hint]") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    auto filter = lz::filter(vec, [](int i) { return i != 3; });
+
+    SECTION("Size hint") {
+        const lz::SizeHint hint = filter.sizeHint();
+        CHECK(hint.lower == 1);
+        CHECK(hint.upper == 10);
+
+        std::list<int> list = { 1, 2, 3 };
+        const lz::SizeHint listHint = lz::filter(list, [](int i) { return i != 3; }).sizeHint();
+        CHECK(listHint.upper == lz::unknownSize);
+
+        std::vector<int> empty;
+        const lz::SizeHint emptyHint = lz::filter(empty, [](int) { return true; }).sizeHint();
+        CHECK(emptyHint.lower == 0);
+        CHECK(emptyHint.upper == 0);
+    }
+
+    SECTION("Reserve upper bound") {
+        std::vector<int> actual = filter.toVector(lz::MaterializePolicy::reserveUpperBound);
+        CHECK(actual == std::vector<int>{ 1, 2, 4, 5, 6, 7, 8, 9, 10 });
+        CHECK(actual.capacity() == actual.size());
+        CHECK(filter.to<std::list>(lz::MaterializePolicy::reserveUpperBound) == std::list<int>{ 1, 2, 4, 5, 6, 7, 8, 9, 10 });
+        CHECK(filter.to<std::vector<int>>(lz::MaterializePolicy::geometric) == actual);
+    }
+}
+
+TEST_CASE("Filter over blocks of arithmetic values", "[Filter][Block filter]") {
+    std::vector<double> vec(2500);
+    std::iota(vec.begin(), vec.end(), 0.);
+    auto filter = lz::filter(vec, [](const double d) { return static_cast<int>(d) % 3 == 0; });
+
+    SECTION("Fold over multiple blocks") {
+        double expected = 0;
+        for (const double d : vec) {
+            if (static_cast<int>(d) % 3 == 0) {
+                expected += d;
+            }
+        }
+        CHECK(lz::internal::sinkFold(filter.begin(), filter.end(), 0., std::plus<double>()) == expected);
+        CHECK(lz::internal::sinkCount(filter.begin(), filter.end(), 2498.) == 0);
+        CHECK(lz::internal::sinkCount(filter.begin(), filter.end(), 2022.) == 1);
+    }
+
+    SECTION("Stops early in a later block") {
+        CHECK(!lz::internal::sinkAllAre(filter.begin(), filter.end(), [](const double d) { return d < 2000; }, true));
+        CHECK(lz::internal::sinkAllAre(filter.begin(), filter.end(), [](const double d) { return d < 2500; }, true));
+    }
+
+    SECTION("Starts in the middle of the range") {
+        auto begin = filter.begin();
+        ++begin;
+        ++begin;
+        CHECK(*begin == 6);
+        CHECK(lz::internal::sinkFold(begin, filter.end(), 0., std::plus<double>()) ==
+              lz::internal::sinkFold(filter.begin(), filter.end(), 0., std::plus<double>()) - 3);
+    }
+}
@@ -0,0 +1,143 @@
+#include "Lz/FlatHashMap.hpp"
+#include "Lz/FlatMap.hpp"
+#include "Lz/Map.hpp"
+#include "Lz/Range.hpp"
+
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+TEST_CASE("Flat hash map basic functionality", "[FlatHashMap][Basic functionality]") {
+    lz::FlatHashMap<std::string, int> map;
+    CHECK(map.empty());
+    CHECK(map.find("a") == map.end());
+    CHECK(map.begin() == map.end());
+
+    SECTION("Insert and find") {
+        CHECK(map.insert({ "a", 1 }).second);
+        CHECK_FALSE(map.insert({ "a", 2 }).second);
+        CHECK(map.at("a") == 1);
+        map["b"] = 2;
+        CHECK(map.size() == 2);
+        CHECK(map.contains("b"));
+        CHECK(map.count("c") == 0);
+        CHECK_THROWS_AS(map.at("c"), std::out_of_range);
+        CHECK(map.find("b")->second == 2);
+    }
+
+    SECTION("Grow, erase and reinsert") {
+        for (int i = 0; i < 5000; ++i) {
+            map[std::to_string(i)] = i;
+        }
+        for (int i = 0; i < 5000; i += 2) {
+            CHECK(map.erase(std::to_string(i)) == 1);
+        }
+        CHECK(map.erase("not there") == 0);
+        CHECK(map.size() == 2500);
+        for (int i = 0; i < 5000; ++i) {
+            REQUIRE(map.contains(std::to_string(i)) == (i % 2 == 1));
+        }
+        for (int i = 0; i < 5000; i += 2) {
+            map.tryEmplace(std::to_string(i), -i);
+        }
+        CHECK(map.size() == 5000);
+        int sum = 0;
+        for (const auto& pair : map) {
+            sum += pair.second < 0 ? -pair.second : pair.second;
+        }
+        CHECK(sum == 4999 * 5000 / 2);
+    }
+
+    SECTION("Copy and move") {
+        map["a"] = 1;
+        map["b"] = 2;
+        auto copy = map;
+        copy["a"] = 10;
+        CHECK(map.at("a") == 1);
+        auto moved = std::move(copy);
+        CHECK(moved.at("a") == 10);
+        CHECK(moved.size() == 2);
+        map.clear();
+        CHECK(map.empty());
+        CHECK_FALSE(map.contains("b"));
+    }
+}
+
+TEST_CASE("Flat hash map with strided keys", "[FlatHashMap][Strided keys]") {
+    // Keys that only differ in their high bits must still be spread over all groups, otherwise this takes seconds
+    for (const unsigned shift : { 0u, 8u, 12u, 20u, 32u }) {
+        INFO("shift " << shift);
+        lz::FlatHashMap<std::uint64_t, int> map;
+        for (int i = 0; i < 1 << 16; ++i) {
+            map[static_cast<std::uint64_t>(i) << shift] = i;
+        }
+        CHECK(map.size() == 1 << 16);
+        int found = 0;
+        for (int i = 0; i < 1 << 16; ++i) {
+            const auto it = map.find(static_cast<std::uint64_t>(i) << shift);
+            found += it != map.end() && it->second == i ? 1 : 0;
+        }
+        CHECK(found == 1 << 16);
+        CHECK_FALSE(map.contains((std::uint64_t{ 1 } << 16) << shift));
+    }
+}
+
+TEST_CASE("Flat map basic functionality", "[FlatMap][Basic functionality]") {
+    lz::FlatMap<int, std::string> map(std::vector<std::pair<int, std::string>>{ { 3, "c" }, { 1, "a" }, { 2, "b" }, { 1, "x" } });
+
+    SECTION("Sorted and unique") {
+        REQUIRE(map.size() == 3);
+        CHECK(map.values() == std::vector<std::pair<int, std::string>>{ { 1, "a" }, { 2, "b" }, { 3, "c" } });
+    }
+
+    SECTION("Lookup") {
+        CHECK(map.at(2) == "b");
+        CHECK(map.find(4) == map.end());
+        CHECK(map.contains(3));
+        CHECK(map.count(0) == 0);
+        CHECK(map.lowerBound(2)->first == 2);
+        CHECK_THROWS_AS(map.at(5), std::out_of_range);
+    }
+
+    SECTION("Insert and erase") {
+        CHECK(map.insert({ 0, "z" }).second);
+        CHECK_FALSE(map.insert({ 0, "y" }).second);
+        map[5] = "e";
+        CHECK(map.begin()->second == "z");
+        CHECK(map.erase(2) == 1);
+        CHECK(map.erase(2) == 0);
+        std::vector<int> keys;
+        for (const auto& pair : map) {
+            keys.push_back(pair.first);
+        }
+        CHECK(keys == std::vector<int>{ 0, 1, 3, 5 });
+    }
+}
+
+TEST_CASE("To flat maps", "[FlatHashMap][FlatMap][To flat map]") {
+    auto strings = lz::map(lz::range(1000), [](int i) { return std::to_string(i); });
+    const auto toKey = [](const std::string& s) { return s.size(); };
+
+    SECTION("Same as toUnorderedMap") {
+        auto flat = lz::toFlatHashMap(strings, toKey);
+        auto expected = strings.toUnorderedMap(toKey);
+        REQUIRE(flat.size() == expected.size());
+        for (const auto& pair : expected) {
+            CHECK(flat.at(pair.first) == pair.second);
+        }
+    }
+
+    SECTION("Same as toMap") {
+        auto flat = lz::toFlatMap(strings, toKey);
+        auto expected = strings.toMap(toKey);
+        CHECK(std::vector<std::pair<std::size_t, std::string>>(expected.begin(), expected.end()) == flat.values());
+    }
+
+    SECTION("Empty") {
+        std::vector<int> empty;
+        CHECK(lz::toFlatHashMap(empty, [](int i) { return i; }).empty());
+        CHECK(lz::toFlatMap(empty, [](int i) { return i; }).empty());
+    }
+}
@@ -1,5 +1,6 @@
 #include "Lz/FunctionTools.hpp"
 
+#include <Lz/Chunks.hpp>
 #include <Lz/Flatten.hpp>
 #include <catch2/catch.hpp>
 #include <list>
@@ -35,6 +36,14 @@ TEST_CASE("Should flatten", "[Flatten][Basic functionality]") {
         *flattened.begin() = -382753;
         CHECK(vectors[0][0][0] == -382753);
     }
+
+    SECTION("Should not move from views returned by value") {
+        using Pair = std::pair<std::string, int>;
+        std::vector<Pair> pairs = { { "hello", 1 }, { "world", 2 }, { "!", 3 } };
+        const std::vector<Pair> expected = pairs;
+        CHECK(lz::flatten(lz::chunks(pairs, 2)).toVector() == expected);
+        CHECK(pairs == expected);
+    }
 }
 
 TEST_CASE("Flatten binary operations", "[Flatten][Binary ops]") {
@@ -63,6 +72,33 @@ TEST_CASE("Flatten binary operations", "[Flatten][Binary ops]") {
         CHECK(*begin == 3);
     }
 
+    SECTION("Postfix operators") {
+        auto begin = flattened.begin();
+        auto it = begin++;
+        CHECK(*it == 1);
+        CHECK(*begin == 2);
+        it = begin--;
+        CHECK(*it == 2);
+        CHECK(*begin == 1);
+        ++begin, ++begin, ++begin;
+        it = begin--;
+        CHECK(*it == 1);
+        CHECK(*begin == 3);
+        it = begin++;
+        CHECK(*it == 3);
+        CHECK(*begin == 1);
+
+        std::vector<std::vector<std::list<int>>> cubes = { { { 1 }, {} }, { { 2, 3 } } };
+        auto cubesFlattened = lz::flatten(cubes);
+        auto cube = cubesFlattened.begin();
+        auto previous = cube++;
+        CHECK(*previous == 1);
+        CHECK(*cube == 2);
+        previous = cube--;
+        CHECK(*previous == 2);
+        CHECK(*cube == 1);
+    }
+
     SECTION("Operator== & operator!=") {
         auto begin = flattened.begin();
         CHECK(begin == flattened.begin());
@@ -114,4 +150,69 @@ TEST_CASE("Flatten to container", "[Flatten][To container]") {
 
         CHECK(expected == actual);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Flatten segmented iteration", "[Flatten][Segments]") {
+    std::vector<std::vector<std::vector<int>>> vecs = { { { 1, 2 }, {} }, {}, { { 3 }, { 4, 5 } } };
+    auto flattened = lz::flatten(vecs);
+
+    SECTION("Segments") {
+        std::vector<std::size_t> segmentSizes;
+        auto sink = [&segmentSizes](std::vector<int>::iterator begin, std::vector<int>::iterator end) {
+            segmentSizes.push_back(static_cast<std::size_t>(std::distance(begin, end)));
+        };
+        lz::internal::forEachSegment(flattened.begin(), flattened.end(), sink);
+        CHECK(segmentSizes == std::vector<std::size_t>{ 2, 1, 2 });
+    }
+
+    SECTION("To containers") {
+        CHECK(flattened.toVector() == std::vector<int>{ 1, 2, 3, 4, 5 });
+        CHECK(flattened.to<std::list>() == std::list<int>{ 1, 2, 3, 4, 5 });
+        CHECK(lz::take(flattened, 4).toVector() == std::vector<int>{ 1, 2, 3, 4 });
+        CHECK(lz::drop(flattened, 1).toVector() == std::vector<int>{ 2, 3, 4, 5 });
+
+        std::vector<int> prefilled = { 0, 0 };
+        flattened.copyTo(std::back_inserter(prefilled));
+        CHECK(prefilled == std::vector<int>{ 0, 0, 1, 2, 3, 4, 5 });
+    }
+
+    SECTION("Fold") {
+        CHECK(lz::internal::sinkFold(flattened.begin(), flattened.end(), 0, std::plus<int>()) == 15);
+    }
+}
+
+TEST_CASE("Flatten contiguous blocks", "[Flatten][Blocks]") {
+    std::array<std::array<int, 3>, 2> arrays = { { { { 1, 2, 3 } }, { { 4, 5, 6 } } } };
+    auto flattened = lz::flatten(arrays);
+
+    SECTION("Should be one block") {
+        using Category = typename decltype(flattened.begin())::iterator_category;
+        static_assert(std::is_same<Category, std::random_access_iterator_tag>::value, "Should be random access");
+        CHECK(&*flattened.begin() == arrays[0].data());
+        CHECK(flattened.toVector() == std::vector<int>{ 1, 2, 3, 4, 5, 6 });
+        CHECK(lz::reverse(flattened).toVector() == std::vector<int>{ 6, 5, 4, 3, 2, 1 });
+    }
+
+    SECTION("Should be sized and random access") {
+        CHECK(flattened.size() == 6);
+        CHECK(flattened.end() - flattened.begin() == 6);
+        CHECK(flattened.begin()[4] == 5);
+        *(flattened.begin() + 3) = 40;
+        CHECK(arrays[1][0] == 40);
+    }
+
+    SECTION("Const and multidimensional") {
+        const std::vector<std::array<std::array<int, 2>, 2>> cubes = { { { { { 1, 2 } }, { { 3, 4 } } } },
+                                                                       { { { { 5, 6 } }, { { 7, 8 } } } } };
+        auto cubesFlattened = lz::flatten(cubes);
+        static_assert(std::is_same<decltype(*cubesFlattened.begin()), const int&>::value, "Should keep the constness");
+        CHECK(cubesFlattened.size() == 8);
+        CHECK(cubesFlattened.toVector() == std::vector<int>{ 1, 2, 3, 4, 5, 6, 7, 8 });
+    }
+
+    SECTION("Empty") {
+        std::vector<std::array<int, 3>> empty;
+        CHECK(lz::flatten(empty).empty());
+        CHECK(lz::flatten(empty).size() == 0);
+    }
+}
@@ -1,8 +1,14 @@
 #include "Lz/FunctionTools.hpp"
+#include "Lz/Lz.hpp"
 #include "Lz/Range.hpp"
 
 #include <catch2/catch.hpp>
 #include <cctype>
+#include <limits>
+#include <list>
+#include <numeric>
+#include <set>
+#include <string>
 
 TEST_CASE("Function tools") {
     std::vector<int> ints = { 1, 2, 3, 4 };
@@ -57,6 +63,12 @@ TEST_CASE("Function tools") {
         CHECK(lines == std::vector<std::string>{ "aa", "bb", "bb" });
     }
 
+    SECTION("CRLF lines") {
+        std::string string = "aa\r\nbb\n\r\ncc\r";
+        auto lines = lz::crlfLines<std::string>(string).toVector();
+        CHECK(lines == std::vector<std::string>{ "aa", "bb", "", "cc" });
+    }
+
     SECTION("Pairwise") {
         auto x = lz::pairwise(ints).toVector();
         CHECK(x == std::vector<std::tuple<int, int>>{ std::make_tuple(1, 2), std::make_tuple(2, 3), std::make_tuple(3, 4) });
@@ -189,6 +201,37 @@ TEST_CASE("Function tools") {
         CHECK(selected.toVector() == std::vector<int>{ 0, 2, 4, 6, 8 });
     }
 
+    SECTION("select with contiguous selectors") {
+        std::vector<int> values(150);
+        std::iota(values.begin(), values.end(), 0);
+        std::vector<char> flags(values.size());
+        std::vector<int> expected;
+        for (std::size_t i = 0; i != values.size(); ++i) {
+            flags[i] = static_cast<char>(i % 3 == 0 || i == 149 ? i % 5 + 1 : 0);
+            if (flags[i] != 0) {
+                expected.push_back(values[i]);
+            }
+        }
+        CHECK(lz::select(values, flags).toVector() == expected);
+        CHECK(lz::toIter(values).select(flags).count(148) == 0);
+        CHECK(lz::indexOf(lz::select(values, flags), 66) == 22);
+
+        std::vector<int> copied(expected.size());
+        lz::select(values, flags).copyTo(copied.begin());
+        CHECK(copied == expected);
+
+        std::vector<bool> bools(flags.begin(), flags.end());
+        CHECK(lz::select(values, bools).toVector() == expected);
+        std::list<char> list(flags.begin(), flags.end());
+        CHECK(lz::select(values, list).toVector() == expected);
+
+        for (int& value : lz::select(values, flags)) {
+            value = -1;
+        }
+        CHECK(values[3] == -1);
+        CHECK(values[4] == 4);
+    }
+
     SECTION("Median") {
         std::array<int, 5> arr = { 5, 2, 3, 1, 7 };
         CHECK(lz::median(arr) == 3);
@@ -224,4 +267,478 @@ TEST_CASE("Function tools") {
         auto trimming = lz::trim(toTrim, spaceFn, spaceFn);
         CHECK(trimming.toString() == "Hello world");
     }
+
+    SECTION("Trimming strings") {
+        std::string toTrim = "\n\n  Hello world \v\f  \t\r";
+        CHECK(lz::trimString(toTrim).toString() == "Hello world");
+        CHECK(lz::trimString(std::string("x")).toString() == "x");
+        CHECK(lz::trimString(std::string(20, ' ')).toString().empty());
+        CHECK(lz::trimString(std::string()).toString().empty());
+
+        std::string longRuns = std::string(19, '\t') + "a  b" + std::string(17, ' ');
+        CHECK(lz::trimString(longRuns).toString() == "a  b");
+        CHECK(lz::trimString(std::string(9, '\n') + "\x80" + std::string(8, ' ')).toString() == "\x80");
+        CHECK(lz::trimString(std::string("\x08\x0E ab \x1F")).toString() == "\x08\x0E ab \x1F");
+
+#ifdef LZ_HAS_STRING_VIEW
+        std::string_view view = toTrim;
+        std::string_view trimmed = lz::trimString(view);
+        CHECK(trimmed == "Hello world");
+        CHECK(trimmed.data() == toTrim.data() + 4);
+        CHECK(lz::trimString(" \t ").empty());
+        CHECK(lz::trimString(std::string_view()).empty());
+        CHECK(lz::trimString(std::string_view(longRuns)) == "a  b");
+        for (std::size_t front = 0; front != 12; ++front) {
+            for (std::size_t back = 0; back != 12; ++back) {
+                const std::string padded = std::string(front, ' ') + "ab" + std::string(back, '\r');
+                CHECK(lz::trimString(std::string_view(padded)) == "ab");
+            }
+        }
+#endif
+    }
+}
+
+TEST_CASE("Sampling") {
+    std::vector<int> values = lz::range(1000).toVector();
+    std::list<int> list(values.begin(), values.end());
+    lz::Pcg32 gen(42);
+
+    SECTION("Random access") {
+        const auto picked = lz::sample(values, 10, gen);
+        REQUIRE(picked.size() == 10);
+        CHECK(std::is_sorted(picked.begin(), picked.end()));
+        CHECK(std::set<int>(picked.begin(), picked.end()).size() == 10);
+        CHECK(std::all_of(picked.begin(), picked.end(), [](int i) { return i >= 0 && i < 1000; }));
+    }
+
+    SECTION("Forward") {
+        const auto picked = lz::sample(list, 10, gen);
+        REQUIRE(picked.size() == 10);
+        CHECK(std::set<int>(picked.begin(), picked.end()).size() == 10);
+        CHECK(std::all_of(picked.begin(), picked.end(), [](int i) { return i >= 0 && i < 1000; }));
+
+        const auto fromFilter = lz::sample(lz::filter(values, [](int i) { return i % 2 == 0; }), 20);
+        REQUIRE(fromFilter.size() == 20);
+        CHECK(std::all_of(fromFilter.begin(), fromFilter.end(), [](int i) { return i % 2 == 0; }));
+    }
+
+    SECTION("Uniformity") {
+        std::vector<int> counts(10);
+        std::list<int> small = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+        for (int i = 0; i < 10000; ++i) {
+            for (const int picked : lz::sample(small, 3, gen)) {
+                ++counts[static_cast<std::size_t>(picked)];
+            }
+        }
+        // Every element is expected to be picked 3000 times
+        CHECK(std::all_of(counts.begin(), counts.end(), [](int count) { return count > 2700 && count < 3300; }));
+    }
+
+    SECTION("Small inputs") {
+        CHECK(lz::sample(values, 0, gen).empty());
+        CHECK(lz::sample(list, 0, gen).empty());
+        CHECK(lz::sample(std::vector<int>{ 1, 2, 3 }, 5, gen) == std::vector<int>{ 1, 2, 3 });
+        CHECK(lz::sample(std::list<int>{ 1, 2, 3 }, 3, gen) == std::vector<int>{ 1, 2, 3 });
+    }
+
+    SECTION("Weighted") {
+        const auto weight = [](int i) {
+            return i < 10 ? 1000. : i % 2 == 0 ? 0. : 1.;
+        };
+        const auto picked = lz::weightedSample(list, 10, weight, gen);
+        REQUIRE(picked.size() == 10);
+        CHECK(std::set<int>(picked.begin(), picked.end()).size() == 10);
+        CHECK(std::none_of(picked.begin(), picked.end(), [](int i) { return i >= 10 && i % 2 == 0; }));
+        // The first ten elements hold almost all of the weight
+        CHECK(std::count_if(picked.begin(), picked.end(), [](int i) { return i < 10; }) >= 8);
+
+        CHECK(lz::weightedSample(values, 0, weight).empty());
+        const auto onlyPositive = lz::weightedSample(std::vector<int>{ 0, 1, 2, 3 }, 4, [](int i) { return i % 2; }, gen);
+        CHECK(std::set<int>(onlyPositive.begin(), onlyPositive.end()) == std::set<int>{ 1, 3 });
+    }
+}
+
+TEST_CASE("Reduce") {
+    std::vector<long long> values(100000);
+    std::iota(values.begin(), values.end(), 1LL);
+    const long long expected = std::accumulate(values.begin(), values.end(), 0LL);
+    const auto pool = lz::execution::pool(4);
+
+    SECTION("Sequential") {
+        CHECK(lz::reduce(values, 0LL, std::plus<long long>()) == expected);
+        CHECK(lz::transformReduce(values, 0LL, std::plus<long long>(), [](long long i) { return 2 * i; }) == 2 * expected);
+    }
+
+    SECTION("Random access") {
+        CHECK(lz::reduce(values, 0LL, std::plus<long long>(), pool) == expected);
+        CHECK(lz::reduce(values, 10LL, std::plus<long long>(), pool) == expected + 10);
+        const auto maxValue = [](long long a, long long b) {
+            return (std::max)(a, b);
+        };
+        CHECK(lz::reduce(values, 0LL, maxValue, pool) == 100000);
+    }
+
+    SECTION("Init is used once") {
+        std::vector<int> small = { 1, 2, 3 };
+        CHECK(lz::reduce(small, 100, std::plus<int>(), pool) == 106);
+        std::vector<int> empty;
+        CHECK(lz::reduce(empty, 100, std::plus<int>(), pool) == 100);
+        CHECK(lz::reduce(lz::filter(empty, [](int) { return true; }), 100, std::plus<int>(), pool) == 100);
+    }
+
+    SECTION("Sums in the type of the initial value") {
+        const std::vector<int> large(20000, (std::numeric_limits<int>::max)());
+        const long long largeSum = 20000LL * (std::numeric_limits<int>::max)();
+        CHECK(lz::reduce(large, 0LL, std::plus<long long>()) == largeSum);
+        CHECK(lz::reduce(large, 0LL, std::plus<long long>(), pool) == largeSum);
+        CHECK(lz::toIter(lz::rotate(large, 7)).foldl(0LL, std::plus<long long>()) == largeSum);
+#ifndef LZ_HAS_CXX_11
+        CHECK(lz::reduce(large, 0LL, std::plus<>()) == largeSum);
+        CHECK(lz::reduce(large, 0LL, std::plus<>(), pool) == largeSum);
+        CHECK(lz::toIter(lz::rotate(large, 7)).foldl(0LL, std::plus<>()) == largeSum);
+#endif
+    }
+
+    SECTION("Order is kept for associative, non commutative operations") {
+        std::vector<std::string> words;
+        std::string concatenated;
+        for (int i = 0; i < 20000; ++i) {
+            words.push_back(std::to_string(i % 10));
+            concatenated += words.back();
+        }
+        const auto append = [](std::string a, const std::string& b) {
+            return a += b;
+        };
+        CHECK(lz::reduce(words, std::string(), append, pool) == concatenated);
+        std::list<std::string> wordList(words.begin(), words.end());
+        CHECK(lz::reduce(wordList, std::string(), append, pool) == concatenated);
+    }
+
+    SECTION("Forward iterables") {
+        auto even = lz::filter(values, [](long long i) { return i % 2 == 0; });
+        long long evenSum = 0;
+        for (const long long i : even) {
+            evenSum += i;
+        }
+        CHECK(lz::reduce(even, 0LL, std::plus<long long>(), pool) == evenSum);
+    }
+
+    SECTION("Transform reduce") {
+        const auto square = [](long long i) {
+            return i * i;
+        };
+        long long squares = 0;
+        for (const long long i : values) {
+            squares += square(i);
+        }
+        CHECK(lz::transformReduce(values, 0LL, std::plus<long long>(), square, pool) == squares);
+        std::list<long long> list(values.begin(), values.end());
+        CHECK(lz::transformReduce(list, 0LL, std::plus<long long>(), square, pool) == squares);
+    }
+
+    SECTION("Reproducible floating point reductions") {
+        std::vector<double> doubles;
+        for (int i = 0; i < 10000; ++i) {
+            doubles.push_back((i % 7 == 0 ? 1e12 : 1e-3) * (i % 2 == 0 ? 1 : -1.5) + i / 3.);
+        }
+        std::list<double> doubleList(doubles.begin(), doubles.end());
+        const double sum = lz::reduce(doubles, 0., std::plus<double>(), lz::execution::pool(1).reproducible());
+        const double mean = lz::mean(doubles, lz::execution::pool(1).reproducible());
+        CHECK(mean == sum / 10000);
+        for (const std::size_t threads : { 2, 3, 4 }) {
+            const auto reproducible = lz::execution::pool(threads).reproducible();
+            CHECK(reproducible.isReproducible());
+            CHECK(lz::reduce(doubles, 0., std::plus<double>(), reproducible) == sum);
+            CHECK(lz::reduce(doubleList, 0., std::plus<double>(), reproducible) == sum);
+            CHECK(lz::toIter(doubles).sum(reproducible) == sum);
+            CHECK(lz::mean(doubleList, reproducible) == mean);
+            CHECK(lz::toIter(doubles).mean(reproducible) == mean);
+        }
+    }
+
+#ifdef LZ_HAS_EXECUTION
+    SECTION("Standard execution policies") {
+        CHECK(lz::reduce(values, 0LL, std::plus<long long>(), std::execution::seq) == expected);
+        CHECK(lz::reduce(lz::filter(values, [](long long) { return true; }), 0LL, std::plus<long long>(), std::execution::par) ==
+              expected);
+        CHECK(lz::transformReduce(values, 0LL, std::plus<long long>(), [](long long i) { return -i; }, std::execution::par) ==
+              -expected);
+    }
+#endif // LZ_HAS_EXECUTION
+}
+
+TEST_CASE("Parallel sort") {
+    lz::Pcg32 generator(42);
+    const auto pool = lz::execution::pool(4);
+
+    SECTION("Radix sort of integers") {
+        std::vector<long long> values(50000);
+        for (long long& value : values) {
+            value = static_cast<long long>(generator()) - (1LL << 31);
+        }
+        values[0] = (std::numeric_limits<long long>::min)();
+        values[1] = (std::numeric_limits<long long>::max)();
+        std::vector<long long> expected = values;
+        std::sort(expected.begin(), expected.end());
+        lz::sort(values.begin(), values.end(), std::less<long long>(), pool);
+        CHECK(values == expected);
+
+        std::vector<std::uint8_t> bytes(5000);
+        for (std::uint8_t& byte : bytes) {
+            byte = static_cast<std::uint8_t>(generator());
+        }
+        std::vector<std::uint8_t> expectedBytes = bytes;
+        std::sort(expectedBytes.begin(), expectedBytes.end());
+        lz::sort(bytes.begin(), bytes.end(), std::less<std::uint8_t>(), pool);
+        CHECK(bytes == expectedBytes);
+    }
+
+    SECTION("Radix sort of floating points") {
+        std::vector<double> values(20000);
+        for (double& value : values) {
+            value = (static_cast<double>(generator()) - 2147483648.) / 1000.;
+        }
+        values[0] = -0.;
+        values[1] = std::numeric_limits<double>::infinity();
+        values[2] = -std::numeric_limits<double>::infinity();
+        std::vector<double> expected = values;
+        std::sort(expected.begin(), expected.end());
+        lz::sort(values.begin(), values.end(), std::less<double>(), pool);
+        CHECK(values == expected);
+
+        std::vector<float> floats(3000);
+        for (float& value : floats) {
+            value = static_cast<float>(static_cast<int>(generator() % 2001) - 1000) / 8.f;
+        }
+        std::vector<float> expectedFloats = floats;
+        std::sort(expectedFloats.begin(), expectedFloats.end());
+        lz::sort(floats.begin(), floats.end(), std::less<float>(), pool);
+        CHECK(floats == expectedFloats);
+    }
+
+    SECTION("Merge sort of other values") {
+        std::vector<std::string> values(10000);
+        for (std::string& value : values) {
+            value = std::to_string(generator() % 5000);
+        }
+        std::vector<std::string> expected = values;
+        std::sort(expected.begin(), expected.end());
+        lz::sort(values.begin(), values.end(), std::less<std::string>(), pool);
+        CHECK(values == expected);
+
+        std::vector<int> ints = { 3, 1, 2 };
+        lz::sort(ints.begin(), ints.end(), std::greater<int>(), pool);
+        CHECK(ints == std::vector<int>{ 3, 2, 1 });
+    }
+
+    SECTION("Sorted distinct and groups") {
+        std::vector<int> values(10000);
+        for (int& value : values) {
+            value = static_cast<int>(generator() % 100) - 50;
+        }
+        std::set<int> distinct(values.begin(), values.end());
+        const std::vector<int> expected(distinct.begin(), distinct.end());
+        CHECK(lz::sortedDistinct(values) == expected);
+        CHECK(lz::sortedDistinct(values, std::less<int>(), pool) == expected);
+        CHECK(lz::sortedDistinct(std::list<int>(values.begin(), values.end())) == expected);
+
+        const auto groups = lz::sortedGroups(values, std::less<int>(), pool);
+        REQUIRE(groups.size() == expected.size());
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < groups.size(); ++i) {
+            CHECK(groups[i].first == expected[i]);
+            CHECK(groups[i].second == static_cast<std::size_t>(std::count(values.begin(), values.end(), expected[i])));
+            total += groups[i].second;
+        }
+        CHECK(total == values.size());
+        CHECK(lz::sortedGroups(std::vector<int>{ 2, 1, 2 }) == std::vector<std::pair<int, std::size_t>>{ { 1, 1 }, { 2, 2 } });
+        CHECK(lz::sortedGroups(std::vector<int>()).empty());
+    }
+}
+
+TEST_CASE("Top k and nth smallest") {
+    std::list<int> values = { 7, 2, 9, 4, 4, 1, 8 };
+
+    SECTION("Top k") {
+        CHECK(lz::topK(values, 3) == std::vector<int>{ 9, 8, 7 });
+        CHECK(lz::topK(values, 3, std::greater<int>()) == std::vector<int>{ 1, 2, 4 });
+        CHECK(lz::topK(values, 10).size() == values.size());
+        CHECK(lz::topK(values, 0).empty());
+        CHECK(values == std::list<int>{ 7, 2, 9, 4, 4, 1, 8 });
+    }
+
+    SECTION("Nth smallest") {
+        std::vector<int> sorted(values.begin(), values.end());
+        std::sort(sorted.begin(), sorted.end());
+        for (std::size_t n = 0; n < sorted.size(); ++n) {
+            CHECK(lz::nthSmallest(values, n) == sorted[n]);
+        }
+        CHECK(lz::nthSmallest(values, 0, std::greater<int>()) == 9);
+    }
+}
+
+TEST_CASE("Top n, min by and max by") {
+    std::vector<std::string> words = { "pear", "fig", "banana", "kiwi", "apple", "plum" };
+    std::size_t keyCalls = 0;
+    std::size_t dereferences = 0;
+    const auto length = [&keyCalls](const std::string& s) {
+        ++keyCalls;
+        return s.size();
+    };
+    auto lazyWords = lz::map(lz::range(words.size()), [&](const std::size_t i) {
+        ++dereferences;
+        return words[i];
+    });
+
+    SECTION("Top n") {
+        CHECK(lz::topN(lazyWords, 2, length) == std::vector<std::string>{ "banana", "apple" });
+        CHECK(keyCalls == words.size());
+        CHECK(dereferences == words.size());
+        CHECK(lz::topN(lazyWords, 1, length, std::greater<std::size_t>()) == std::vector<std::string>{ "fig" });
+        CHECK(lz::topN(lazyWords, 10, length).size() == words.size());
+        CHECK(lz::topN(lazyWords, 0, length).empty());
+    }
+
+    SECTION("Min by and max by") {
+        CHECK(lz::maxBy(lazyWords, length) == "banana");
+        CHECK(keyCalls == words.size());
+        CHECK(dereferences == words.size());
+        CHECK(lz::minBy(lazyWords, length) == "fig");
+        // The first of the equal keys is returned
+        CHECK(lz::maxBy(lazyWords, length, std::greater<std::size_t>()) == "fig");
+        CHECK(lz::minBy(std::list<std::string>{ "pear", "kiwi", "plum" }, length) == "pear");
+        CHECK(lz::maxBy(std::list<std::string>{ "pear", "kiwi", "plum" }, length) == "pear");
+    }
+
+    SECTION("Chained") {
+        CHECK(lz::toIter(words).maxBy(length) == "banana");
+        CHECK(lz::toIter(words).minBy(length) == "fig");
+        CHECK(lz::toIter(words).topN(2, length) == std::vector<std::string>{ "banana", "apple" });
+    }
+}
+
+TEST_CASE("Contiguous ranges") {
+    std::vector<unsigned char> bytes = { 'h', 'e', 'a', 'd', 'e', 'r', 0, 1, 2, 3 };
+    const std::string text = "hello world";
+
+    SECTION("Data") {
+        CHECK(lz::toIter(bytes).data() == bytes.data());
+        CHECK(lz::take(bytes, 4).data() == bytes.data());
+        CHECK(lz::drop(bytes, 6).data() == bytes.data() + 6);
+        CHECK(lz::slice(text, 6, 11).data() == text.data() + 6);
+        CHECK(lz::toIter(bytes).take(2).data() == bytes.data());
+        const auto chunks = lz::chunks(bytes, 3);
+        CHECK(std::next(chunks.begin())->data() == bytes.data() + 3);
+        CHECK(lz::drop(bytes, 10).data() == nullptr);
+    }
+
+    SECTION("Equal and startsWith") {
+        const std::vector<unsigned char> header = { 'h', 'e', 'a', 'd', 'e', 'r' };
+        const std::vector<unsigned char> other = { 'h', 'e', 'a', 'd', 'e', 'x' };
+        CHECK(lz::startsWith(bytes, header));
+        CHECK_FALSE(lz::startsWith(bytes, other));
+        CHECK_FALSE(lz::startsWith(header, bytes));
+        CHECK(lz::startsWith(bytes, std::vector<unsigned char>()));
+        CHECK(lz::equal(lz::take(bytes, 6), header));
+        CHECK_FALSE(lz::equal(lz::take(bytes, 6), other));
+        CHECK_FALSE(lz::equal(bytes, header));
+        CHECK(lz::equal(std::vector<int>(), std::vector<int>()));
+        // Only prefixes match, not subsequences elsewhere
+        CHECK_FALSE(lz::startsWith(text, std::string("world")));
+        CHECK(lz::endsWith(text, std::string("world")));
+        std::list<char> list(text.begin(), text.end());
+        CHECK(lz::startsWith(list, std::string("hello")));
+        CHECK_FALSE(lz::startsWith(list, std::string("world")));
+    }
+
+    SECTION("Case insensitive comparisons") {
+        const std::string header = "Content-Length: 1024; charset=UTF-8";
+        const lz::CaseInsensitiveEqual ignoreCase;
+        CHECK(lz::startsWith(header, std::string("CONTENT-length:"), ignoreCase));
+        CHECK_FALSE(lz::startsWith(header, std::string("Content-Type"), ignoreCase));
+        CHECK(lz::endsWith(header, std::string("CHARSET=utf-8"), ignoreCase));
+        CHECK_FALSE(lz::endsWith(header, std::string("charset=utf-16"), ignoreCase));
+        CHECK(lz::equal(header, std::string("content-length: 1024; CHARSET=utf-8"), ignoreCase));
+        CHECK_FALSE(lz::equal(header, std::string("content-length: 1024; CHARSET=utf-8 "), ignoreCase));
+        // Only letters are folded: '@' and '`' differ from 'A' and 'a' in the same bit, as do '[' and '{'
+        CHECK_FALSE(lz::equal(std::string("@[@[@[@[@"), std::string("`{`{`{`{`"), ignoreCase));
+        CHECK_FALSE(lz::equal(std::string("\xC0\xC1\xC2\xC3\xC4\xC5\xC6\xC7"), std::string("\xE0\xE1\xE2\xE3\xE4\xE5\xE6\xE7"),
+                              ignoreCase));
+        std::list<char> list(header.begin(), header.end());
+        CHECK(lz::startsWith(list, std::string("content-LENGTH"), ignoreCase));
+        CHECK(lz::endsWith(list, std::string("utf-8"), ignoreCase));
+        CHECK(lz::toIter(header).endsWith(std::string("UTF-8"), ignoreCase));
+        CHECK(lz::endsWith(header, std::string("UTF-8")));
+        CHECK_FALSE(lz::endsWith(header, std::string("utf-8")));
+    }
+
+    SECTION("Contains") {
+        CHECK(lz::contains(text, 'w'));
+        CHECK_FALSE(lz::contains(text, 'z'));
+        CHECK(lz::contains(bytes, static_cast<unsigned char>(3)));
+        CHECK(lz::indexOf(text, 'o') == 4);
+        const std::vector<char> chars = { 'a', ',', 'b' };
+        // 300 converted to unsigned char is ',', which must not be found
+        CHECK_FALSE(lz::contains(chars, 300));
+    }
+
+    SECTION("Copy") {
+        std::vector<unsigned char> copy(4);
+        lz::drop(bytes, 6).copyTo(copy.begin());
+        CHECK(copy == std::vector<unsigned char>{ 0, 1, 2, 3 });
+        CHECK(lz::take(bytes, 6).toVector() == std::vector<unsigned char>(bytes.begin(), bytes.begin() + 6));
+        CHECK(lz::slice(text, 0, 5).to<std::string>() == "hello");
+    }
+}
+
+TEST_CASE("Block search") {
+    std::vector<int> ids(1000);
+    std::iota(ids.begin(), ids.end(), 0);
+
+    SECTION("Find and count") {
+        // Positions in the first block, a middle block and the tail after the last full block
+        for (const int id : { 0, 15, 16, 500, 991, 999 }) {
+            CHECK(lz::indexOf(ids, id) == static_cast<std::size_t>(id));
+        }
+        CHECK(lz::indexOf(ids, 1000) == lz::npos);
+        CHECK_FALSE(lz::contains(ids, -1));
+        CHECK(lz::findFirstOrDefault(ids, 998, -1) == 998);
+        CHECK(lz::toIter(ids).count(7) == 1);
+        std::vector<int> repeated(1001, 3);
+        repeated[1000] = 4;
+        CHECK(lz::toIter(repeated).count(3) == 1000);
+        CHECK(lz::toIter(repeated).count(4) == 1);
+    }
+
+    SECTION("Floating point") {
+        std::vector<double> values(100, 1.5);
+        values[70] = -0.0;
+        values[80] = std::numeric_limits<double>::quiet_NaN();
+        CHECK(lz::indexOf(values, 0.0) == 70);
+        CHECK_FALSE(lz::contains(values, std::numeric_limits<double>::quiet_NaN()));
+        CHECK(lz::toIter(values).count(1.5) == 98);
+    }
+
+    SECTION("Contains any") {
+        CHECK(lz::containsAny(ids, std::vector<int>{ -5, 999 }));
+        CHECK_FALSE(lz::containsAny(ids, std::vector<int>{ -5, 1000 }));
+        CHECK_FALSE(lz::containsAny(ids, std::vector<int>()));
+        std::vector<int> many;
+        for (int i = 0; i < 20; ++i) {
+            many.push_back(-i - 1);
+        }
+        CHECK_FALSE(lz::toIter(ids).containsAny(many));
+        many.push_back(512);
+        CHECK(lz::toIter(ids).containsAny(many));
+
+        std::vector<double> values = { 0.5, 2.5 };
+        std::vector<double> needles(10, std::numeric_limits<double>::quiet_NaN());
+        CHECK_FALSE(lz::containsAny(values, needles));
+        needles.push_back(2.5);
+        CHECK(lz::containsAny(values, needles));
+
+        std::list<std::string> words = { "a", "b" };
+        CHECK(lz::containsAny(words, std::vector<std::string>{ "c", "b" }));
+        CHECK_FALSE(lz::containsAny(words, std::vector<std::string>{ "c" }));
+    }
 }
@@ -1,5 +1,7 @@
 #include <Lz/Generate.hpp>
+#include <Lz/Take.hpp>
 #include <catch2/catch.hpp>
+#include <deque>
 #include <list>
 
 TEST_CASE("Generate changing and creating elements", "[Generate][Basic functionality]") {
@@ -15,6 +17,26 @@ TEST_CASE("Generate changing and creating elements", "[Generate][Basic functiona
     }
 }
 
+TEST_CASE("Generate while true", "[Generate][Basic functionality]") {
+    std::size_t counter = 0;
+    auto generator = lz::generate([&counter] { return counter++; });
+    CHECK(generator.begin() != generator.end());
+
+    std::size_t expected = 0;
+    for (std::size_t i : generator) {
+        CHECK(i == expected++);
+        if (i == 100) {
+            break;
+        }
+    }
+    CHECK(counter == 101);
+
+    counter = 0;
+    CHECK(lz::take(generator, 5).toVector() == std::vector<std::size_t>{ 0, 1, 2, 3, 4 });
+    CHECK(std::next(generator.begin(), 5) != generator.end());
+    CHECK(generator.end() - generator.begin() > 0);
+}
+
 TEST_CASE("Generate binary operations", "[Generate][Binary ops]") {
     constexpr std::size_t amount = 4;
     std::size_t counter = 0;
@@ -97,6 +119,14 @@ TEST_CASE("Generate to containers", "[Generate][To container]") {
         CHECK(vector == expected);
     }
 
+    SECTION("To deque calls the generator once per element") {
+        std::deque<std::size_t> deque = generator.to<std::deque>();
+        std::deque<std::size_t> expected = { 0, 1, 2, 3 };
+
+        CHECK(deque == expected);
+        CHECK(counter == amount);
+    }
+
     SECTION("To map") {
         std::map<std::size_t, std::size_t> map = generator.toMap([](const std::size_t elm) { return elm * 10; });
 
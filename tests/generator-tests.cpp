@@ -0,0 +1,144 @@
+#include <Lz/Generator.hpp>
+#include <catch2/catch.hpp>
+
+#ifdef __cpp_lib_coroutine
+#    include <Lz/Filter.hpp>
+#    include <Lz/Map.hpp>
+#    include <Lz/Own.hpp>
+#    include <memory>
+#    include <stdexcept>
+#    include <string>
+#    include <vector>
+
+namespace {
+lz::Generator<int> iota(const int count) {
+    for (int i = 0; i < count; ++i) {
+        co_yield i;
+    }
+}
+
+struct Node {
+    int value;
+    std::vector<Node> children;
+};
+
+lz::Generator<const Node&> walk(const Node& node) {
+    co_yield node;
+    for (const Node& child : node.children) {
+        co_yield lz::elementsOf(walk(child));
+    }
+}
+
+lz::Generator<int> throwsAt(const int count) {
+    for (int i = 0; i < count; ++i) {
+        co_yield i;
+    }
+    throw std::runtime_error("exhausted");
+}
+
+lz::Generator<int> nestsThrowing() {
+    co_yield -1;
+    co_yield lz::elementsOf(throwsAt(2));
+}
+
+template<class T>
+struct CountingAllocator {
+    using value_type = T;
+
+    int* allocations;
+
+    explicit CountingAllocator(int* allocations) noexcept : allocations(allocations) {
+    }
+
+    template<class U>
+    CountingAllocator(const CountingAllocator<U>& other) noexcept : allocations(other.allocations) {
+    }
+
+    T* allocate(const std::size_t n) {
+        ++*allocations;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, const std::size_t n) noexcept {
+        --*allocations;
+        std::allocator<T>().deallocate(p, n);
+    }
+};
+
+lz::Generator<int> iotaWith(std::allocator_arg_t, CountingAllocator<int>, const int count) {
+    for (int i = 0; i < count; ++i) {
+        co_yield i;
+    }
+}
+} // namespace
+
+TEST_CASE("Generator yields the values of a coroutine", "[Generator][Basic functionality]") {
+    SECTION("Loops") {
+        auto generator = iota(4);
+        std::vector<int> values;
+        for (int i : generator) {
+            values.push_back(i);
+        }
+        CHECK(values == std::vector<int>{ 0, 1, 2, 3 });
+    }
+
+    SECTION("Empty") {
+        auto generator = iota(0);
+        CHECK(generator.begin() == generator.end());
+        CHECK(generator.toVector().empty());
+    }
+
+    SECTION("Adaptors") {
+        auto generator = iota(6);
+        auto evens = lz::map(lz::filter(generator, [](int i) { return i % 2 == 0; }), [](int i) { return std::to_string(i); });
+        CHECK(evens.toVector() == std::vector<std::string>{ "0", "2", "4" });
+    }
+
+    SECTION("Owned temporaries") {
+        auto squares = lz::map(lz::own(iota(4)), [](int i) { return i * i; });
+        CHECK(squares.toVector() == std::vector<int>{ 0, 1, 4, 9 });
+    }
+
+    SECTION("Const values") {
+        const std::string values[] = { "a", "b" };
+        auto generator = [](const std::string* values) -> lz::Generator<std::string> {
+            co_yield values[0];
+            co_yield values[1];
+        }(values);
+        CHECK(generator.toVector() == std::vector<std::string>{ "a", "b" });
+    }
+}
+
+TEST_CASE("Generator nesting", "[Generator][Basic functionality]") {
+    SECTION("Recursive walk") {
+        Node tree{ 1, { Node{ 2, { Node{ 3, {} } } }, Node{ 4, {} } } };
+        auto nodes = walk(tree);
+        std::vector<int> values;
+        for (const Node& node : nodes) {
+            values.push_back(node.value);
+        }
+        CHECK(values == std::vector<int>{ 1, 2, 3, 4 });
+    }
+
+    SECTION("Exceptions propagate through the parent") {
+        auto generator = nestsThrowing();
+        auto it = generator.begin();
+        CHECK(*it == -1);
+        ++it;
+        CHECK(*it == 0);
+        ++it;
+        CHECK(*it == 1);
+        CHECK_THROWS_AS(++it, std::runtime_error);
+    }
+}
+
+TEST_CASE("Generator frames use the passed allocator", "[Generator][Basic functionality]") {
+    int allocations = 0;
+    {
+        auto generator = iotaWith(std::allocator_arg, CountingAllocator<int>(&allocations), 3);
+        CHECK(allocations == 1);
+        CHECK(generator.toVector() == std::vector<int>{ 0, 1, 2 });
+    }
+    CHECK(allocations == 0);
+}
+#endif // __cpp_lib_coroutine
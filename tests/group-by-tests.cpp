@@ -49,4 +49,35 @@ TEST_CASE("GroupBy binary operations", "[GroupBy][Binary ops]") {
         it = grouper.end();
         CHECK(it == grouper.end());
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Hash aggregation on unsorted input", "[GroupBy][Basic functionality]") {
+    std::vector<std::string> vec = { "hello", "i'm", "done", "hellp", "abc", "x" };
+    auto length = [](const std::string& s) { return s.length(); };
+
+    SECTION("Count by") {
+        std::unordered_map<std::size_t, std::size_t> expected = { { 5, 2 }, { 3, 2 }, { 4, 1 }, { 1, 1 } };
+        CHECK(lz::countBy(vec, length) == expected);
+    }
+
+    SECTION("Sum by") {
+        std::vector<std::pair<char, int>> pairs = { { 'a', 1 }, { 'b', 2 }, { 'a', 3 }, { 'c', 4 }, { 'b', 5 } };
+        auto sums = lz::sumBy(
+            pairs, [](const std::pair<char, int>& p) { return p.first; }, [](const std::pair<char, int>& p) { return p.second; });
+        std::unordered_map<char, int> expected = { { 'a', 4 }, { 'b', 7 }, { 'c', 4 } };
+        CHECK(sums == expected);
+    }
+
+    SECTION("Custom fold") {
+        auto firstLetters = lz::aggregateBy(vec, length, std::string(),
+                                            [](std::string acc, const std::string& s) { return std::move(acc) + s.front(); });
+        CHECK(firstLetters[5] == "hh");
+        CHECK(firstLetters[3] == "ia");
+        CHECK(firstLetters.size() == 4);
+    }
+
+    SECTION("Empty") {
+        std::vector<std::string> empty;
+        CHECK(lz::countBy(empty, length).empty());
+    }
+}
@@ -0,0 +1,113 @@
+#include <Lz/HashJoin.hpp>
+#include <catch2/catch.hpp>
+#include <list>
+#include <map>
+
+namespace {
+struct Order {
+    int customerId;
+    int id;
+};
+
+struct Customer {
+    int id;
+};
+} // namespace
+
+TEST_CASE("Hash join changing and creating elements", "[HashJoin][Basic functionality]") {
+    std::vector<Customer> customers{ Customer{ 25 }, Customer{ 1 }, Customer{ 39 }, Customer{ 103 }, Customer{ 99 } };
+    // Deliberately not sorted, hashJoin does not need it
+    std::vector<Order> orders{ Order{ 99, 1 }, Order{ 25, 0 }, Order{ 2523, 52 }, Order{ 25, 2 }, Order{ 25, 3 } };
+
+    auto joined = lz::hashJoin(
+        customers, orders, [](const Customer& c) { return c.id; }, [](const Order& o) { return o.customerId; },
+        [](const Customer& c, const Order& o) { return std::make_pair(c.id, o.id); });
+
+    SECTION("Should yield all matches in the order of A, then B") {
+        std::vector<std::pair<int, int>> expected = { { 25, 0 }, { 25, 2 }, { 25, 3 }, { 99, 1 } };
+        CHECK(joined.toVector() == expected);
+    }
+
+    SECTION("Should be empty without matches") {
+        std::vector<Customer> others{ Customer{ 5 }, Customer{ 6 } };
+        auto empty = lz::hashJoin(
+            others, orders, [](const Customer& c) { return c.id; }, [](const Order& o) { return o.customerId; },
+            [](const Customer& c, const Order& o) { return std::make_pair(c.id, o.id); });
+        CHECK(empty.begin() == empty.end());
+    }
+
+    SECTION("Should work with an empty right side") {
+        std::vector<Order> none;
+        auto empty = lz::hashJoin(
+            customers, none, [](const Customer& c) { return c.id; }, [](const Order& o) { return o.customerId; },
+            [](const Customer& c, const Order& o) { return std::make_pair(c.id, o.id); });
+        CHECK(empty.begin() == empty.end());
+    }
+}
+
+TEST_CASE("Hash join with a reused index", "[HashJoin][Basic functionality]") {
+    std::list<Order> orders{ Order{ 3, 30 }, Order{ 1, 10 }, Order{ 3, 31 }, Order{ 2, 20 } };
+    auto index = lz::hashJoinIndex(orders, [](const Order& o) { return o.customerId; });
+    CHECK(index->size() == 4);
+    CHECK(index->keyCount() == 3);
+
+    const auto toOrderId = [](int, const Order& o) {
+        return o.id;
+    };
+    const auto identity = [](int i) {
+        return i;
+    };
+
+    std::vector<int> first = { 3, 4 };
+    std::vector<int> second = { 2, 1, 3 };
+    CHECK(lz::hashJoin(first, index, identity, toOrderId).toVector() == std::vector<int>{ 30, 31 });
+    CHECK(lz::hashJoin(second, index, identity, toOrderId).toVector() == std::vector<int>{ 20, 10, 30, 31 });
+
+    SECTION("The view keeps the index alive") {
+        auto view = lz::hashJoin(second, index, identity, toOrderId);
+        index.reset();
+        CHECK(view.toVector() == std::vector<int>{ 20, 10, 30, 31 });
+    }
+}
+
+TEST_CASE("Hash join binary operations", "[HashJoin][Binary ops]") {
+    std::vector<int> a = { 1, 2, 3 };
+    std::vector<int> b = { 3, 1, 1 };
+    auto joined = lz::hashJoin(
+        a, b, [](int i) { return i; }, [](int i) { return i; }, [](int x, int y) { return x * 10 + y; });
+    auto it = joined.begin();
+
+    SECTION("Operator++") {
+        CHECK(*it == 11);
+        ++it;
+        CHECK(*it == 11);
+        ++it;
+        CHECK(*it == 33);
+        ++it;
+        CHECK(it == joined.end());
+    }
+
+    SECTION("Operator== & operator!=") {
+        CHECK(it == joined.begin());
+        CHECK(it != joined.end());
+        it++;
+        CHECK(it != joined.begin());
+    }
+}
+
+TEST_CASE("Hash join to containers", "[HashJoin][To container]") {
+    std::vector<int> a = { 1, 2, 3 };
+    std::vector<int> b = { 3, 2, 2 };
+    auto joined = lz::hashJoin(
+        a, b, [](int i) { return i; }, [](int i) { return i; }, [](int x, int y) { return std::make_pair(x, y); });
+
+    SECTION("To vector") {
+        std::vector<std::pair<int, int>> expected = { { 2, 2 }, { 2, 2 }, { 3, 3 } };
+        CHECK(joined.toVector() == expected);
+    }
+
+    SECTION("To map") {
+        CHECK(joined.toMap([](const std::pair<int, int>& p) { return p.first; }) ==
+              std::map<int, std::pair<int, int>>{ { 2, { 2, 2 } }, { 3, { 3, 3 } } });
+    }
+}
@@ -0,0 +1,88 @@
+#include "Lz/Filter.hpp"
+#include "Lz/FunctionTools.hpp"
+#include "Lz/Incremental.hpp"
+
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <deque>
+#include <string>
+
+namespace {
+// Adds the even elements that were appended, and counts all appended elements
+struct AddEven {
+    std::size_t* visited;
+
+    template<class Delta>
+    int operator()(const int sum, const Delta& added) const {
+        *visited += added.size();
+        auto even = lz::filter(added, [](int i) { return i % 2 == 0; });
+        return lz::reduce(even, sum, std::plus<int>());
+    }
+};
+} // namespace
+
+TEST_CASE("Incremental basic functionality", "[Incremental][Basic functionality]") {
+    std::vector<int> values = { 1, 2, 3, 4 };
+    std::size_t visited = 0;
+    auto evenSum = lz::incremental(values, 0, AddEven{ &visited });
+    CHECK(evenSum.value() == 0);
+    CHECK(evenSum.position() == 0);
+
+    CHECK(evenSum.refresh() == 6);
+    CHECK(visited == 4);
+
+    SECTION("Only appended elements are processed") {
+        for (int i = 5; i <= 1000; ++i) {
+            values.push_back(i);
+        }
+        CHECK(evenSum.refresh() == 250500);
+        CHECK(visited == 1000);
+        CHECK(evenSum.refresh() == 250500);
+        CHECK(visited == 1000);
+        values.push_back(1002);
+        CHECK(evenSum.value() == 250500);
+        CHECK(evenSum.refresh() == 251502);
+        CHECK(visited == 1001);
+        CHECK(evenSum.position() == 1001);
+    }
+
+    SECTION("Reset") {
+        evenSum.reset();
+        CHECK(evenSum.value() == 0);
+        CHECK(evenSum.refresh() == 6);
+        CHECK(visited == 8);
+    }
+}
+
+TEST_CASE("Incremental folds and aggregations", "[Incremental][Binary ops]") {
+    SECTION("Fold") {
+        std::deque<int> latencies;
+        auto maximum = lz::incrementalFold(latencies, 0, [](int max, int latency) { return (std::max)(max, latency); });
+        auto count = lz::incrementalFold(latencies, std::size_t{ 0 }, [](std::size_t n, int) { return n + 1; });
+        CHECK(maximum.refresh() == 0);
+        latencies.push_back(12);
+        latencies.push_back(40);
+        CHECK(maximum.refresh() == 40);
+        latencies.push_back(7);
+        CHECK(maximum.refresh() == 40);
+        latencies.push_back(41);
+        CHECK(maximum.refresh() == 41);
+        CHECK(count.refresh() == 4);
+    }
+
+    SECTION("Aggregate by") {
+        std::vector<std::string> words = { "a", "bb", "a" };
+        auto lengths = lz::incrementalAggregateBy(
+            words, [](const std::string& s) { return s; }, std::size_t{ 0 },
+            [](std::size_t total, const std::string& s) { return total + s.size(); });
+        CHECK(lengths.refresh().size() == 2);
+        CHECK(lengths.value().at("a") == 2);
+        words.push_back("bb");
+        words.push_back("ccc");
+        const auto& totals = lengths.refresh();
+        CHECK(totals.size() == 3);
+        CHECK(totals.at("a") == 2);
+        CHECK(totals.at("bb") == 4);
+        CHECK(totals.at("ccc") == 3);
+    }
+}
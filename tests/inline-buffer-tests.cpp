@@ -0,0 +1,88 @@
+#include "Lz/InlineBuffer.hpp"
+
+#include <catch2/catch.hpp>
+#include <memory>
+#include <string>
+
+TEST_CASE("Inline buffer basic functionality", "[InlineBuffer][Basic functionality]") {
+    lz::InlineBuffer<std::string, 2> buffer;
+    CHECK(buffer.empty());
+    CHECK(buffer.isInline());
+    CHECK(buffer.capacity() == 2);
+
+    SECTION("Stays inline up to its capacity") {
+        buffer.pushBack("a");
+        buffer.emplaceBack(3, 'b');
+        CHECK(buffer.isInline());
+        CHECK(buffer.size() == 2);
+        CHECK(buffer[1] == "bbb");
+    }
+
+    SECTION("Moves to the heap and keeps its capacity") {
+        for (int i = 0; i < 5; ++i) {
+            buffer.pushBack(std::to_string(i));
+        }
+        CHECK_FALSE(buffer.isInline());
+        CHECK(buffer.view().toString(",") == "0,1,2,3,4");
+        const std::string* data = buffer.data();
+        buffer.clear();
+        CHECK(buffer.empty());
+        buffer.pushBack("x");
+        CHECK(buffer.data() == data);
+    }
+
+    SECTION("Push back an element of itself") {
+        buffer.pushBack("first");
+        buffer.pushBack("second");
+        buffer.pushBack(buffer[0]);
+        CHECK(buffer.view().toString(",") == "first,second,first");
+    }
+
+    SECTION("Assign") {
+        const std::vector<std::string> values = { "a", "b", "c" };
+        buffer.assign(values.begin(), values.end());
+        CHECK(buffer.view().toVector() == values);
+        buffer.assign(values.begin(), values.begin() + 1);
+        CHECK(buffer.size() == 1);
+    }
+}
+
+TEST_CASE("Inline buffer copy and move", "[InlineBuffer][Copy and move]") {
+    lz::InlineBuffer<std::unique_ptr<int>, 2> inlineBuffer;
+    inlineBuffer.emplaceBack(new int(1));
+
+    lz::InlineBuffer<std::unique_ptr<int>, 2> heapBuffer;
+    for (int i = 0; i < 3; ++i) {
+        heapBuffer.emplaceBack(new int(i));
+    }
+
+    SECTION("Move inline") {
+        auto moved = std::move(inlineBuffer);
+        CHECK(moved.isInline());
+        CHECK(*moved[0] == 1);
+        CHECK(inlineBuffer.empty()); // NOLINT
+    }
+
+    SECTION("Move heap") {
+        const auto* data = heapBuffer.data();
+        decltype(heapBuffer) moved;
+        moved = std::move(heapBuffer);
+        CHECK(moved.data() == data);
+        CHECK(*moved[2] == 2);
+        CHECK(heapBuffer.isInline()); // NOLINT
+        CHECK(heapBuffer.empty());    // NOLINT
+    }
+
+    SECTION("Copy") {
+        lz::InlineBuffer<int, 2> buffer;
+        for (int i = 0; i < 4; ++i) {
+            buffer.pushBack(i);
+        }
+        auto copy = buffer;
+        copy[0] = 10;
+        CHECK(buffer[0] == 0);
+        CHECK(copy.size() == 4);
+        buffer = copy;
+        CHECK(buffer[0] == 10);
+    }
+}
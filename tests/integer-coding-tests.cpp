@@ -0,0 +1,132 @@
+#include <Lz/IntegerCoding.hpp>
+#include <Lz/Lz.hpp>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <forward_list>
+#include <limits>
+#include <list>
+#include <numeric>
+#include <vector>
+
+TEST_CASE("Delta and undelta", "[Delta][Basic functionality]") {
+    std::vector<std::uint32_t> ids = { 100, 103, 110, 110, 4000000000 };
+
+    SECTION("Should yield the differences") {
+        auto deltas = lz::delta(ids);
+        CHECK(deltas.toVector() == std::vector<std::uint32_t>{ 100, 3, 7, 0, 3999999890 });
+        CHECK(deltas.size() == 5);
+        std::vector<std::uint32_t> empty;
+        CHECK(lz::delta(empty).toVector().empty());
+    }
+
+    SECTION("Should restore the input") {
+        CHECK(lz::undelta(lz::delta(ids)).toVector() == ids);
+        std::list<std::uint32_t> list(ids.begin(), ids.end());
+        CHECK(lz::undelta(lz::delta(list)).toVector() == ids);
+    }
+
+    SECTION("Should wrap around") {
+        std::vector<std::int8_t> bytes = { 100, -100, 127, -128 };
+        auto deltas = lz::delta(bytes).toVector();
+        CHECK(deltas == std::vector<std::int8_t>{ 100, 56, -29, 1 });
+        CHECK(lz::undelta(deltas).toVector() == bytes);
+    }
+
+    SECTION("Should be usable in push based loops") {
+        std::vector<std::uint32_t> copied(ids.size());
+        lz::delta(ids).copyTo(copied.begin());
+        CHECK(copied == std::vector<std::uint32_t>{ 100, 3, 7, 0, 3999999890 });
+        auto it = lz::delta(ids).begin();
+        ++it;
+        CHECK(*it == 3);
+    }
+}
+
+TEST_CASE("Zigzag and unzigzag", "[Zigzag][Basic functionality]") {
+    std::vector<int> values = { 0, -1, 1, -2, 2, (std::numeric_limits<int>::max)(), (std::numeric_limits<int>::min)() };
+    auto encoded = lz::zigzag(values);
+
+    CHECK(encoded.toVector() == std::vector<unsigned>{ 0, 1, 2, 3, 4, 0xFFFFFFFEu, 0xFFFFFFFFu });
+    CHECK(encoded.size() == values.size());
+    CHECK(lz::unzigzag(encoded).toVector() == values);
+
+    std::vector<std::int8_t> bytes = { -128, 127, -3 };
+    CHECK(lz::unzigzag(lz::zigzag(bytes)).toVector() == bytes);
+}
+
+TEST_CASE("Varint encoding", "[Varint][Basic functionality]") {
+    SECTION("Should encode 7 bits per byte") {
+        std::vector<std::uint32_t> values = { 0, 5, 127, 128, 300, 0xFFFFFFFFu };
+        CHECK(lz::varint(values).toVector() == std::vector<std::uint8_t>{ 0x00, 0x05, 0x7F, 0x80, 0x01, 0xAC, 0x02, 0xFF, 0xFF,
+                                                                          0xFF, 0xFF, 0x0F });
+        std::vector<std::uint32_t> empty;
+        CHECK(lz::varint(empty).toVector().empty());
+    }
+
+    SECTION("Should hint its size") {
+        std::vector<std::uint64_t> values(10);
+        CHECK(lz::varint(values).sizeHint().lower == 10);
+        CHECK(lz::varint(values).sizeHint().upper == 100);
+    }
+
+    SECTION("Should write into byte buffers") {
+        std::vector<std::uint16_t> values = { 1, 200, 65535 };
+        char buffer[6]{};
+        lz::varint(values).copyTo(buffer);
+        CHECK(std::vector<unsigned char>(buffer, buffer + 6) == std::vector<unsigned char>{ 1, 0xC8, 1, 0xFF, 0xFF, 3 });
+    }
+}
+
+TEST_CASE("Varint decoding", "[Varint][Basic functionality]") {
+    std::vector<std::uint64_t> values;
+    for (std::uint64_t value = 1; value != 0; value <<= 3) {
+        values.push_back(value - 1);
+        values.push_back(value);
+    }
+    values.push_back((std::numeric_limits<std::uint64_t>::max)());
+    const std::vector<std::uint8_t> bytes = lz::varint(values).toVector();
+
+    SECTION("Should decode contiguous bytes") {
+        CHECK(lz::unvarint(bytes).toVector() == values);
+        std::vector<std::uint64_t> copied(values.size());
+        lz::unvarint(bytes).copyTo(copied.begin());
+        CHECK(copied == values);
+    }
+
+    SECTION("Should decode words of single bytes and the rest of a view") {
+        std::vector<std::uint8_t> small(20);
+        std::iota(small.begin(), small.end(), std::uint8_t{ 0 });
+        CHECK(lz::unvarint(small).toVector() == std::vector<std::uint64_t>(small.begin(), small.end()));
+
+        auto decoded = lz::unvarint(bytes);
+        auto it = std::next(decoded.begin(), 3);
+        std::vector<std::uint64_t> rest;
+        lz::IterView<decltype(it)>(it, decoded.end()).copyTo(std::back_inserter(rest));
+        CHECK(rest == std::vector<std::uint64_t>(values.begin() + 3, values.end()));
+    }
+
+    SECTION("Should decode bytes of other iterators") {
+        std::forward_list<std::uint8_t> list(bytes.begin(), bytes.end());
+        CHECK(lz::unvarint(list).toVector() == values);
+    }
+
+    SECTION("Should decode to narrower types") {
+        std::vector<std::uint32_t> narrow = { 0, 300, 70000, 0xFFFFFFFFu };
+        CHECK(lz::unvarint<std::uint32_t>(lz::varint(narrow).toVector()).toVector() == narrow);
+        std::vector<std::uint8_t> tooLarge = { 0xAC, 0x02, 0x05 };
+        CHECK(lz::unvarint<std::uint8_t>(tooLarge).toVector() == std::vector<std::uint8_t>{ 0x2C, 0x05 });
+    }
+
+    SECTION("Should decode a cut off value") {
+        std::vector<std::uint8_t> cutOff = { 0x05, 0xAC };
+        CHECK(lz::unvarint(cutOff).toVector() == std::vector<std::uint64_t>{ 5, 0x2C });
+    }
+
+    SECTION("Should round trip signed deltas") {
+        std::vector<std::int64_t> timestamps = { 1700000000, 1700000005, 1699999990, 1700000100 };
+        auto encoded = lz::toIter(timestamps).delta().zigzag().varint().toVector();
+        CHECK(encoded.size() == 9);
+        auto decoded = lz::toIter(encoded).unvarint().unzigzag().undelta().toVector();
+        CHECK(decoded == timestamps);
+    }
+}
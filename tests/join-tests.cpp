@@ -1,6 +1,10 @@
+#define LZ_FMT_FORMATTER
+
 #include <Lz/Join.hpp>
 #include <Lz/Map.hpp>
+#include <Lz/Range.hpp>
 #include <catch2/catch.hpp>
+#include <cstdio>
 #include <sstream>
 
 TEST_CASE("Join should convert to string", "[Join][Basic functionality]") {
@@ -144,3 +148,143 @@ TEST_CASE("Join binary operations", "[Join][Binary ops]") {
         CHECK(doubles == "1.10, 2.20, 3.30, 4.40");
     }
 }
+
+TEST_CASE("Joining strings and integers directly", "[Join][String join]") {
+    SECTION("Strings") {
+        const std::vector<std::string> strings = { "hello", "", "world" };
+        CHECK(lz::strJoin(strings, ", ") == "hello, , world");
+        CHECK(lz::strJoin(strings) == "helloworld");
+        auto mapped = lz::map(strings, [](const std::string& s) { return s + "!"; });
+        CHECK(lz::strJoin(mapped, " ") == "hello! ! world!");
+    }
+
+    SECTION("Integers") {
+        const std::vector<long long> integers = { 0, -1, 42, (std::numeric_limits<long long>::min)(),
+                                                  (std::numeric_limits<long long>::max)() };
+        CHECK(lz::strJoin(integers, ",") == "0,-1,42,-9223372036854775808,9223372036854775807");
+        const std::vector<unsigned char> bytes = { 1, 2 };
+        CHECK(lz::strJoin(bytes, ",") == "1,2");
+        const std::vector<std::uint64_t> unsignedIntegers = { (std::numeric_limits<std::uint64_t>::max)() };
+        CHECK(lz::strJoin(unsignedIntegers) == "18446744073709551615");
+    }
+
+#ifndef LZ_STANDALONE
+    SECTION("Custom formats are still used") {
+        const std::vector<int> integers = { 1, 22 };
+        CHECK(lz::strJoin(integers, ",", "{:>3}") == "  1, 22");
+    }
+#endif // LZ_STANDALONE
+}
+
+TEST_CASE("Join iterator over integers and string views", "[Join][Element formatting]") {
+    const std::vector<int> integers = { -12, 0, 345 };
+    auto joined = lz::join(integers, ", ");
+    CHECK(std::vector<std::string>(joined.begin(), joined.end()) == std::vector<std::string>{ "-12", ", ", "0", ", ", "345" });
+    CHECK(joined.toString() == "-12, 0, 345");
+
+#ifdef LZ_HAS_STRING_VIEW
+    const std::vector<std::string_view> views = { "a", "bc" };
+    auto joinedViews = lz::join(views, "-");
+    CHECK(std::vector<std::string>(joinedViews.begin(), joinedViews.end()) == std::vector<std::string>{ "a", "-", "bc" });
+#endif // LZ_HAS_STRING_VIEW
+
+#ifndef LZ_STANDALONE
+    auto formatted = lz::join(integers, ",", "{:+}");
+    CHECK(formatted.toString() == "-12,+0,+345");
+#endif // LZ_STANDALONE
+}
+
+#ifndef LZ_STANDALONE
+TEST_CASE("Joining into existing strings and output iterators", "[Join][Append]") {
+    const std::vector<int> integers = { 1, 10, 255 };
+    auto view = lz::map(integers, [](int i) { return i; });
+
+    SECTION("Append to string") {
+        std::string result = "values: ";
+        view.appendTo(result, ", ");
+        CHECK(result == "values: 1, 10, 255");
+        view.appendTo(result, "", "{:x}");
+        CHECK(result == "values: 1, 10, 2551aff");
+    }
+
+    SECTION("Append to memory buffer") {
+        fmt::memory_buffer buffer;
+        view.appendTo(buffer, "-");
+        CHECK(fmt::to_string(buffer) == "1-10-255");
+    }
+
+    SECTION("Format to output iterator") {
+        std::string result;
+        auto out = view.formatTo(std::back_inserter(result), ", ", "{:02}");
+        *out = '.';
+        CHECK(result == "01, 10, 255.");
+        result.clear();
+        view.formatTo(std::back_inserter(result), ",", FMT_COMPILE("{:x}"));
+        CHECK(result == "1,a,ff");
+        const std::vector<int> empty;
+        result.clear();
+        lz::map(empty, [](int i) { return i; }).formatTo(std::back_inserter(result), ",");
+        CHECK(result.empty());
+    }
+
+    SECTION("Formatter") {
+        CHECK(fmt::format("{}", view) == "1 10 255");
+        CHECK(fmt::format("[{:03}]", view) == "[001 010 255]");
+        CHECK(fmt::format("{}", lz::join(integers, ", ")) == "1, 10, 255");
+    }
+}
+
+TEST_CASE("Joining with compiled formats", "[Join][Compiled format]") {
+    const std::vector<int> integers = { 1, 10, 255 };
+    CHECK(lz::strJoin(integers, ",", FMT_COMPILE("{:x}")) == "1,a,ff");
+    CHECK(lz::map(integers, [](int i) { return i; }).toString(", ", FMT_COMPILE("{:03}")) == "001, 010, 255");
+    const std::vector<int> empty;
+    CHECK(lz::strJoin(empty, ",", FMT_COMPILE("{}")).empty());
+}
+#endif // LZ_STANDALONE
+
+namespace {
+std::string readAll(std::FILE* file) {
+    std::rewind(file);
+    std::string result;
+    char block[4096];
+    std::size_t count;
+    while ((count = std::fread(block, 1, sizeof block, file)) != 0) {
+        result.append(block, count);
+    }
+    return result;
+}
+} // namespace
+
+TEST_CASE("Writing views to files", "[Join][Write]") {
+    std::FILE* file = std::tmpfile();
+    REQUIRE(file != nullptr);
+
+    SECTION("Write to std::FILE") {
+        const std::vector<std::string> lines = { "a,1", "b,2", "c,3" };
+        lz::map(lines, [](const std::string& s) -> const std::string& { return s; }).writeTo(file, "\n");
+        CHECK(readAll(file) == "a,1\nb,2\nc,3");
+    }
+
+    SECTION("Write more than one block") {
+        auto numbers = lz::range(300000);
+        numbers.writeTo(file, "\n");
+        CHECK(readAll(file) == numbers.toString("\n"));
+    }
+
+    SECTION("Empty views write nothing") {
+        const std::vector<int> empty;
+        lz::map(empty, [](int i) { return i; }).writeTo(file, ",");
+        CHECK(readAll(file).empty());
+    }
+
+#ifndef _WIN32
+    SECTION("Write to file descriptor") {
+        const std::vector<double> values = { 1.5, 2.25 };
+        lz::map(values, [](double d) { return d; }).writeTo(::fileno(file), ", ");
+        CHECK(readAll(file) == "1.5, 2.25");
+    }
+#endif // _WIN32
+
+    std::fclose(file);
+}
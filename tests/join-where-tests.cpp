@@ -163,4 +163,25 @@ TEST_CASE("JoinWhere to containers", "[JoinWhere][To container]") {
                    std::get<1>(a.second).customerId == std::get<1>(b.second).customerId;
         }));
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Prefiltered join where", "[JoinWhere][Basic functionality]") {
+    std::vector<Customer> customers{
+        Customer{ 25 }, Customer{ 1 }, Customer{ 39 }, Customer{ 103 }, Customer{ 99 }, Customer{ 25 },
+    };
+    std::vector<PaymentBill> paymentBills{
+        PaymentBill{ 25, 0 }, PaymentBill{ 25, 2 },    PaymentBill{ 25, 3 },
+        PaymentBill{ 99, 1 }, PaymentBill{ 2523, 52 }, PaymentBill{ 2523, 53 },
+    };
+    auto selectA = [](const Customer& c) { return c.id; };
+    auto selectB = [](const PaymentBill& p) { return p.customerId; };
+    auto result = [](const Customer& c, const PaymentBill& p) { return std::make_pair(c.id, p.id); };
+
+    auto expected = lz::joinWhere(customers, paymentBills, selectA, selectB, result).toVector();
+    auto joined = lz::joinWherePrefiltered(customers, paymentBills, selectA, selectB, result);
+    CHECK(joined.toVector() == expected);
+    CHECK(expected.size() == 7);
+
+    std::vector<PaymentBill> empty;
+    CHECK(lz::joinWherePrefiltered(customers, empty, selectA, selectB, result).toVector().empty());
+}
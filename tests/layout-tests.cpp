@@ -0,0 +1,57 @@
+#include <Lz/Filter.hpp>
+#include <Lz/Layout.hpp>
+#include <Lz/Map.hpp>
+#include <Lz/Zip.hpp>
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <sstream>
+
+namespace {
+std::vector<std::string> toLines(const std::string& layout) {
+    std::vector<std::string> lines;
+    std::istringstream stream(layout);
+    for (std::string line; std::getline(stream, line);) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+} // namespace
+
+TEST_CASE("Layout of composed views", "[Layout][Basic functionality]") {
+    int array[] = { 1, 2, 3 };
+    auto view = lz::map(lz::filter(array, [](int i) { return i > 1; }), [](int i) { return i * 2; });
+    using View = decltype(view);
+    using Iterator = decltype(view.begin());
+
+    SECTION("Should report the size of the iterator") {
+        static_assert(lz::IteratorSize<View>::value == sizeof(Iterator), "");
+        static_assert(lz::IteratorSize<std::vector<int>&>::value == sizeof(std::vector<int>::iterator), "");
+#ifndef LZ_HAS_CXX_11
+        static_assert(lz::iteratorSize<View> == sizeof(Iterator), "");
+#endif
+        CHECK(lz::IteratorSize<View>::value >= 2 * sizeof(int*));
+    }
+
+    SECTION("Should write a line per nested iterator") {
+        const std::vector<std::string> lines = toLines(lz::debug::layoutOf<View>());
+        REQUIRE(lines.size() == 3);
+        CHECK(lines[0].find("MapIterator (sizeof " + std::to_string(sizeof(Iterator))) == 0);
+        CHECK(lines[1].find("  FilterIterator (sizeof ") == 0);
+        CHECK(lines[2].find("    int*") == 0);
+        CHECK(lines[2].find("(sizeof " + std::to_string(sizeof(int*)) + ", alignof " + std::to_string(alignof(int*)) + ")") !=
+              std::string::npos);
+    }
+
+    SECTION("Should write every iterator of adaptors with several") {
+        std::vector<int> ints = { 1 };
+        std::vector<double> doubles = { 1. };
+        auto zipped = lz::zip(ints, doubles);
+        const std::vector<std::string> lines = toLines(lz::debug::layoutOf<decltype(zipped)>());
+        REQUIRE(!lines.empty());
+        CHECK(lines[0].find("ZipIterator") == 0);
+        const auto isChild = [](const std::string& line) {
+            return line.size() > 2 && line[0] == ' ' && line[1] == ' ' && line[2] != ' ';
+        };
+        CHECK(std::count_if(lines.begin(), lines.end(), isChild) == 2);
+    }
+}
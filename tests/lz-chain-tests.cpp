@@ -3,6 +3,9 @@
 #include <algorithm>
 #include <catch2/catch.hpp>
 #include <cctype>
+#include <list>
+#include <numeric>
+#include <set>
 
 template class lz::IterView<lz::internal::BasicIteratorView<std::vector<int>::iterator>::iterator>;
 
@@ -77,6 +80,39 @@ for (auto [chunk, expectedArr] : lz::zip(chunks, expected)) {
 #endif
     }
 
+    SECTION("Windows") {
+        CHECK(lz::toIter(arr).windows(15).size() == 2);
+        CHECK(lz::toIter(arr).slidingSum(3).take(2).toVector() == std::vector<int>{ 3, 6 });
+        CHECK(lz::toIter(arr).slidingMin(4).toVector() == lz::range(0, 13).toVector());
+        CHECK(lz::toIter(arr).slidingMax(4).toVector() == lz::range(3, 16).toVector());
+    }
+
+    SECTION("Merge") {
+        std::vector<int> evens = { 0, 2, 4 };
+        CHECK(lz::toIter(arr).take(4).merge(evens).toVector() == std::vector<int>{ 0, 0, 1, 2, 2, 3, 4 });
+        std::vector<int> odds = { 3, 1 };
+        auto descending = lz::toIterRange(evens.rbegin(), evens.rend()).mergeWith(std::greater<int>(), odds);
+        CHECK(descending.toVector() == std::vector<int>{ 4, 3, 2, 1, 0 });
+    }
+
+    SECTION("Set operations") {
+        std::vector<int> evens = { 0, 2, 4, 100 };
+        CHECK(lz::toIter(arr).setIntersection(evens).toVector() == std::vector<int>{ 0, 2, 4 });
+        CHECK(lz::toIter(arr).take(5).setUnion(evens).toVector() == std::vector<int>{ 0, 1, 2, 3, 4, 100 });
+        CHECK(lz::toIter(arr).take(5).setDifference(evens).toVector() == std::vector<int>{ 1, 3 });
+        CHECK(lz::toIter(arr).take(5).setSymmetricDifference(evens).toVector() == std::vector<int>{ 1, 3, 100 });
+    }
+
+    SECTION("Probe") {
+        // LZ_PROBES is not defined here, so the probe has the same type as in probe-tests.cpp but records nothing
+        auto probed = lz::toIter(arr).probe("lz-chain-tests");
+        static_assert(std::is_same<decltype(probed), lz::IterView<lz::internal::ProbeIterator<decltype(arr.begin())>>>::value,
+                      "probe must not depend on LZ_PROBES");
+        CHECK(probed.toVector() == lz::toIter(arr).toVector());
+        const std::vector<lz::ProbeSnapshot> report = lz::probeReport();
+        CHECK(std::none_of(report.begin(), report.end(), [](const lz::ProbeSnapshot& p) { return p.name == "lz-chain-tests"; }));
+    }
+
     SECTION("Zip with") {
         auto zippedWith = lz::toIter(arr).zipWith([](int a, int b) { return a + b; }, arr2);
         for (auto&& enumerate : lz::enumerate(zippedWith)) {
@@ -142,12 +178,20 @@ for (auto [chunk, expectedArr] : lz::zip(chunks, expected)) {
 
     SECTION("Except") {
         CHECK(lz::toIter(arr).except(arr2).distance() == 0);
+        CHECK(lz::toIter(arr).exceptHashed(arr2).distance() == 0);
+        CHECK(lz::toIter(arr).exceptIn(std::set<int>(arr2.begin(), arr2.end())).distance() == 0);
     }
 
     SECTION("Unique") {
         CHECK(lz::toIter(arr).unique().distance() == size);
     }
 
+    SECTION("Distinct") {
+        std::vector<int> withDuplicates = { 4, 1, 4, 2, 1 };
+        CHECK(lz::toIter(withDuplicates).distinct().toVector() == std::vector<int>{ 4, 1, 2 });
+        CHECK(lz::toIter(arr).distinct(size).distance() == size);
+    }
+
     SECTION("ChunkIf") {
         CHECK(lz::toIter(arr).chunkIf([](int i) { return i % 2 == 0; }).distance() == 9);
     }
@@ -179,6 +223,26 @@ for (auto [chunk, expectedArr] : lz::zip(chunks, expected)) {
         CHECK(lz::back(joinWhere) == std::make_tuple(15, 15));
     }
 
+    SECTION("HashJoin") {
+        auto hashJoin = lz::toIter(arr).hashJoin(
+            arr2, [](int a) { return a; }, [](int b) { return b; },
+            [](int a, int b) -> std::tuple<int, int> {
+                return { a, b };
+            });
+        CHECK(*hashJoin.begin() == std::make_tuple(0, 0));
+        CHECK(hashJoin.distance() == size);
+    }
+
+    SECTION("MergeJoin") {
+        auto mergeJoin = lz::toIter(arr).mergeJoin(
+            arr2, [](int a) { return a; }, [](int b) { return b; },
+            [](int a, int b) -> std::tuple<int, int> {
+                return { a, b };
+            });
+        CHECK(*mergeJoin.begin() == std::make_tuple(0, 0));
+        CHECK(mergeJoin.distance() == size);
+    }
+
     SECTION("Group by") {
         CHECK(lz::toIter(arr).groupBy().distance() == size);
     }
@@ -230,3 +294,331 @@ for (auto [chunk, expectedArr] : lz::zip(chunks, expected)) {
         CHECK(lz::toIter(arr).endsWith(std::array<int, 3>{13, 14, 15}));
     }
 }
+
+TEST_CASE("Push based terminal operations") {
+    std::vector<std::vector<int>> vecs = { { 1, 2 }, {}, { 3 }, { 4, 5, 6 }, {} };
+    std::vector<int> other = { 7, 8 };
+
+    SECTION("Flatten") {
+        auto flattened = lz::toIter(lz::flatten(vecs));
+        CHECK(flattened.sum() == 21);
+        CHECK(flattened.count(3) == 1);
+        CHECK(flattened.countIf([](int i) { return i % 2 == 0; }) == 3);
+        CHECK(flattened.all([](int i) { return i > 0; }));
+        CHECK(flattened.any([](int i) { return i == 6; }));
+        CHECK(flattened.none([](int i) { return i == 7; }));
+        CHECK(flattened.toVector() == std::vector<int>{ 1, 2, 3, 4, 5, 6 });
+
+        std::vector<int> visited;
+        flattened.forEach([&visited](int i) { visited.push_back(i); });
+        CHECK(visited == std::vector<int>{ 1, 2, 3, 4, 5, 6 });
+    }
+
+    SECTION("Flatten with partial end") {
+        auto taken = lz::toIter(lz::take(lz::flatten(vecs), 4));
+        CHECK(taken.sum() == 10);
+        auto dropped = lz::toIter(lz::drop(lz::flatten(vecs), 3));
+        CHECK(dropped.toVector() == std::vector<int>{ 4, 5, 6 });
+    }
+
+    SECTION("Filter map concat") {
+        auto chain = lz::toIter(lz::flatten(vecs))
+                         .concat(other)
+                         .filter([](int i) { return i % 2 == 1; })
+                         .map([](int i) { return i * 10; });
+        CHECK(chain.toVector() == std::vector<int>{ 10, 30, 50, 70 });
+        CHECK(chain.foldl(0, std::plus<int>()) == 160);
+
+        std::size_t calls = 0;
+        CHECK(chain.any([&calls](int i) {
+            ++calls;
+            return i == 30;
+        }));
+        CHECK(calls == 2);
+    }
+}
+
+TEST_CASE("Reductions with multiple accumulators") {
+    std::vector<int> vec(1003);
+    for (std::size_t i = 0; i < vec.size(); ++i) {
+        vec[i] = static_cast<int>((i * 7919) % 1000) - 500;
+    }
+    vec[17] = 900;
+    vec[600] = 900;
+    vec[3] = -900;
+    vec[1001] = -900;
+    auto chain = lz::toIter(vec);
+
+    SECTION("Sum and mean") {
+        const int expected = std::accumulate(vec.begin(), vec.end(), 0);
+        CHECK(chain.sum() == expected);
+        CHECK(chain.foldl(5, std::plus<int>()) == expected + 5);
+        CHECK(chain.mean() == Approx(static_cast<double>(expected) / 1003));
+        CHECK(lz::toIter(lz::take(vec, 5)).sum() == std::accumulate(vec.begin(), vec.begin() + 5, 0));
+    }
+
+    SECTION("Min and max return the first extremum") {
+        CHECK(&chain.max() == &vec[17]);
+        CHECK(&chain.min() == &vec[3]);
+        std::vector<int> single = { 4 };
+        CHECK(lz::toIter(single).max() == 4);
+    }
+
+    SECTION("Mapped values") {
+        auto mapped = chain.map([](int i) { return static_cast<long long>(i) * 3; });
+        CHECK(mapped.sum() == 3LL * std::accumulate(vec.begin(), vec.end(), 0LL));
+        CHECK(mapped.max() == 2700);
+        CHECK(mapped.min() == -2700);
+    }
+
+    SECTION("Floating point sums keep their order") {
+        std::vector<double> doubles = { 1e16, 1., -1e16, 1., 1., 1., 1., 1., 1., 1. };
+        CHECK(lz::toIter(doubles).sum() == std::accumulate(doubles.begin(), doubles.end(), 0.));
+    }
+}
+
+TEST_CASE("Closed form reductions over ranges") {
+    SECTION("Ascending with step") {
+        auto range = lz::toIter(lz::range(-7, 30, 4));
+        const std::vector<int> values = range.toVector();
+        CHECK(range.sum() == std::accumulate(values.begin(), values.end(), 0));
+        CHECK(range.foldl(10, std::plus<int>()) == std::accumulate(values.begin(), values.end(), 10));
+        CHECK(range.min() == -7);
+        CHECK(range.max() == 29);
+        CHECK(range.count(5) == 1);
+        CHECK(range.count(6) == 0);
+        CHECK(range.count(33) == 0);
+        CHECK(range.contains(-3));
+        CHECK(!range.contains(-11));
+        CHECK(!range.contains(2.5));
+        CHECK(range.indexOf(21) == 7);
+        CHECK(static_cast<std::size_t>(range.indexOf(22)) == lz::npos);
+    }
+
+    SECTION("Descending") {
+        auto range = lz::toIter(lz::range(10, -10, -3));
+        const std::vector<int> values = range.toVector();
+        CHECK(range.sum() == std::accumulate(values.begin(), values.end(), 0));
+        CHECK(range.min() == -8);
+        CHECK(range.max() == 10);
+        CHECK(range.count(-5) == 1);
+        CHECK(!range.contains(-11));
+        CHECK(range.indexOf(-8) == 6);
+    }
+
+    SECTION("Take and slice") {
+        auto taken = lz::toIter(lz::take(lz::range(100), 10));
+        CHECK(taken.sum() == 45);
+        CHECK(taken.max() == 9);
+        CHECK(!taken.contains(10));
+        auto sliced = lz::toIter(lz::slice(lz::range(0, 100, 5), 2, 6));
+        CHECK(sliced.sum() == 10 + 15 + 20 + 25);
+        CHECK(sliced.min() == 10);
+        CHECK(sliced.max() == 25);
+        CHECK(sliced.indexOf(20) == 2);
+        CHECK(!sliced.contains(5));
+    }
+
+    SECTION("Unsigned wrap around") {
+        unsigned expected = 0;
+        for (const unsigned i : lz::range(0u, 4000000000u, 100003u)) {
+            expected += i;
+        }
+        CHECK(lz::toIter(lz::range(0u, 4000000000u, 100003u)).sum() == expected);
+    }
+
+    SECTION("Sum in the type of the initial value") {
+        auto range = lz::toIter(lz::range(100000));
+        CHECK(range.foldl(0LL, std::plus<long long>()) == 4999950000LL);
+        CHECK(range.foldl(0., std::plus<double>()) == 4999950000.);
+        CHECK(lz::toIter(lz::range(-100000, 0)).foldl(0LL, std::plus<long long>()) == -5000050000LL);
+    }
+}
+
+TEST_CASE("Sized iterators") {
+    std::vector<std::vector<int>> vecs = { { 1, 2 }, {}, { 3 }, { 4, 5, 6 } };
+    std::list<std::vector<int>> listOfVecs = { { 1, 2 }, { 3 } };
+    std::vector<int> other = { 7, 8, 9, 10, 11, 12, 13 };
+
+    auto flattened = lz::flatten(vecs);
+    using FlattenIter = decltype(flattened.begin());
+    static_assert(lz::internal::IsSized<FlattenIter>::value, "Flatten over vectors should be sized");
+    static_assert(lz::internal::IsSized<decltype(lz::flatten(listOfVecs).begin())>::value, "Inner vectors are sized");
+    static_assert(!lz::internal::IsSized<decltype(lz::flatten(std::declval<std::vector<std::list<int>>&>()).begin())>::value,
+                  "Inner lists are not sized");
+    auto filtered = lz::filter(other, [](int) { return true; });
+    static_assert(!lz::internal::IsSized<decltype(filtered.begin())>::value, "Filter is never sized");
+    static_cast<void>(filtered);
+
+    SECTION("Size of sized chains") {
+        CHECK(flattened.size() == 6);
+        CHECK(lz::map(flattened, [](int i) { return i * 2; }).size() == 6);
+        CHECK(lz::concat(flattened, lz::flatten(vecs)).size() == 12);
+        CHECK(lz::zip(flattened, other).size() == 6);
+        CHECK(lz::enumerate(flattened).size() == 6);
+        CHECK(lz::exclude(lz::flatten(vecs), 1, 3).size() == 4);
+        CHECK(lz::take(flattened, 4).size() == 4);
+    }
+
+    SECTION("Reserves exactly") {
+        std::vector<int> vec = lz::map(flattened, [](int i) { return i * 2; }).toVector();
+        CHECK(vec == std::vector<int>{ 2, 4, 6, 8, 10, 12 });
+        CHECK(vec.capacity() == vec.size());
+
+        std::vector<int> concatenated = lz::concat(flattened, lz::flatten(vecs)).toVector();
+        CHECK(concatenated.capacity() == 12);
+    }
+}
+
+struct TimesTwo {
+    int operator()(const int i) const {
+        return i * 2;
+    }
+};
+
+TEST_CASE("Size hints of chains") {
+    std::vector<int> vec = { 1, 1, 2, 3, 3 };
+    std::vector<int> other = { 4, 5 };
+    auto unique = lz::unique(vec);
+    CHECK(unique.sizeHint().upper == 5);
+    CHECK(lz::except(vec, other).sizeHint().upper == 5);
+
+    auto chain = lz::toIter(unique).map(TimesTwo()).concat(lz::map(other, TimesTwo()));
+    const lz::SizeHint hint = chain.sizeHint();
+    CHECK(hint.lower == 3);
+    CHECK(hint.upper == 7);
+    CHECK(chain.toVector(lz::MaterializePolicy::reserveUpperBound) == std::vector<int>{ 2, 4, 6, 8, 10 });
+}
+
+TEST_CASE("Chains on a thread pool") {
+    std::vector<int> vec(10000);
+    std::iota(vec.begin(), vec.end(), 0);
+    auto chain = lz::toIter(vec).map(TimesTwo());
+    const int expected = 2 * std::accumulate(vec.begin(), vec.end(), 0);
+
+    CHECK(chain.sum(lz::execution::pool(4)) == expected);
+    CHECK(chain.reduce(0, std::plus<int>(), lz::execution::pool(4)) == expected);
+    CHECK(lz::toIter(vec).transformReduce(0, std::plus<int>(), TimesTwo(), lz::execution::pool(4)) == expected);
+}
+
+TEST_CASE("Scan chains") {
+    std::vector<int> vec = { 1, 2, 3, 4 };
+    CHECK(lz::toIter(vec).inclusiveScan().toVector() == std::vector<int>{ 1, 3, 6, 10 });
+    CHECK(lz::toIter(vec).exclusiveScan(10).map(TimesTwo()).toVector() == std::vector<int>{ 20, 22, 26, 32 });
+}
+
+namespace {
+// 5000 values in [-500, 500), every value five times, in a scrambled order
+std::vector<int> scrambledValues() {
+    std::vector<int> vec(5000);
+    for (std::size_t i = 0; i < vec.size(); ++i) {
+        vec[i] = static_cast<int>((i * 7919) % 1000) - 500;
+    }
+    return vec;
+}
+} // namespace
+
+TEST_CASE("Sorting chains") {
+    const std::vector<int> vec = scrambledValues();
+    std::vector<int> expected = vec;
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<int> sorted = vec;
+    lz::toIter(sorted).sort();
+    CHECK(sorted == expected);
+    sorted = vec;
+    lz::toIter(sorted).sort(std::less<int>(), lz::execution::pool(4));
+    CHECK(sorted == expected);
+
+    CHECK(lz::toIter(vec).sortedDistinct().size() == 1000);
+    const auto groups = lz::toIter(vec).sortedGroups(std::less<int>(), lz::execution::pool(4));
+    CHECK(groups.front() == std::make_pair(-500, std::size_t{ 5 }));
+}
+
+TEST_CASE("Partition chains") {
+    const std::vector<int> vec = scrambledValues();
+    const auto partitions = lz::toIter(vec).partitionBy([](const int i) { return i; }, 4, lz::execution::pool(4));
+    CHECK(partitions.size() == 4);
+    CHECK(lz::toIter(partitions).map([](lz::Partitions<int>::ConstPartition p) { return p.size(); }).sum() == vec.size());
+}
+
+TEST_CASE("Order statistic chains") {
+    const std::vector<int> vec = scrambledValues();
+    CHECK(lz::toIter(vec).topK(2) == std::vector<int>{ 499, 499 });
+    CHECK(lz::toIter(vec).nthSmallest(5) == -499);
+    CHECK(std::abs(lz::toIter(vec).quantileSketch().quantile(0.5)) < 25);
+}
+
+TEST_CASE("Statistics chains") {
+    const std::vector<int> vec = scrambledValues();
+    const auto statistics = lz::toIter(vec).stats(lz::execution::pool(4));
+    CHECK(statistics.minimum() == -500);
+    CHECK(statistics.maximum() == 499);
+    CHECK(statistics.count() == vec.size());
+}
+
+TEST_CASE("Cached chains") {
+    const std::vector<int> vec = scrambledValues();
+    auto cached = lz::toIter(vec).map([](const int i) { return i * 2; }).cache();
+    CHECK(cached.max() == 998);
+    CHECK(cached.min() == -1000);
+}
+
+TEST_CASE("Cartesian chains") {
+    std::vector<int> a = { 1, 2, 3 };
+    std::vector<int> b = { 4, 5, 6 };
+    int visited = 0;
+    const bool allSmall = lz::toIter(lz::cartesian(a, b)).all([&visited](const std::tuple<int&, int&>& t) {
+        ++visited;
+        return std::get<0>(t) + std::get<1>(t) < 7;
+    });
+    CHECK_FALSE(allSmall);
+    CHECK(visited == 3);
+
+    int sum = 0;
+    lz::toIter(lz::cartesian(a, b)).forEach([&sum](const std::tuple<int&, int&>& t) { sum += std::get<0>(t) * std::get<1>(t); });
+    CHECK(sum == 90);
+}
+
+TEST_CASE("Fused map and filter chains") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    auto isEven = [](int i) {
+        return i % 2 == 0;
+    };
+    auto notDivisibleByThree = [](int i) {
+        return i % 3 != 0;
+    };
+
+    SECTION("Maps") {
+        auto chain = lz::toIter(vec).map(TimesTwo()).map([](int i) { return i + 1; }).map(TimesTwo());
+        static_assert(std::is_same<decltype(chain.begin().base()), const std::vector<int>::iterator&>::value,
+                      "Maps should be fused into one layer");
+        CHECK(chain.toVector() == lz::map(vec, [](int i) { return (i * 2 + 1) * 2; }).toVector());
+        CHECK(chain.size() == vec.size());
+    }
+
+    SECTION("Filters") {
+        auto chain = lz::toIter(vec).filter(isEven).filter(notDivisibleByThree);
+        static_assert(std::is_same<decltype(chain.begin().base()), const std::vector<int>::iterator&>::value,
+                      "Filters should be fused into one layer");
+        CHECK(sizeof(chain.begin()) == sizeof(lz::filter(vec, isEven).begin()));
+        CHECK(chain.toVector() == std::vector<int>{ 2, 4, 8, 10 });
+
+        auto it = chain.end();
+        --it;
+        CHECK(*it == 10);
+    }
+
+    SECTION("Filters after a partially consumed filter") {
+        auto chain = lz::toIter(vec).filter(isEven).drop(1).filter(notDivisibleByThree);
+        CHECK(chain.toVector() == std::vector<int>{ 4, 8, 10 });
+
+        auto upToSeven = lz::toIter(vec).filter(isEven).takeWhile([](int i) { return i < 7; }).filter(notDivisibleByThree);
+        CHECK(upToSeven.toVector() == std::vector<int>{ 2, 4 });
+    }
+
+    SECTION("Mixed") {
+        auto chain = lz::toIter(vec).map(TimesTwo()).map(TimesTwo()).filter(isEven).filter(notDivisibleByThree).map(TimesTwo());
+        CHECK(chain.toVector() == std::vector<int>{ 8, 16, 32, 40, 56, 64, 80, 88 });
+    }
+}
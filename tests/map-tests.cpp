@@ -1,6 +1,9 @@
 #include <Lz/Map.hpp>
+#include <Lz/Unique.hpp>
+#include <algorithm>
 #include <catch2/catch.hpp>
 #include <list>
+#include <string>
 
 struct TestStruct {
     std::string testFieldStr;
@@ -90,6 +93,119 @@ TEST_CASE("Map binary operations", "[Map][Binary ops]") {
     }
 }
 
+TEST_CASE("Map function storage", "[Map][Basic functionality]") {
+    std::vector<int> vec = { 1, 2, 3 };
+
+    SECTION("Stateless lambdas take no space") {
+        auto map = lz::map(vec, [](int i) { return i * 2; });
+        using Iterator = decltype(map.begin());
+#ifdef LZ_HAS_CXX_20
+        CHECK(sizeof(Iterator) == sizeof(std::vector<int>::iterator));
+#else
+        CHECK(sizeof(Iterator) <= 2 * sizeof(std::vector<int>::iterator));
+#endif
+        auto it = map.begin();
+        auto other = std::next(map.begin());
+        it = other;
+        CHECK(*it == 4);
+    }
+
+    SECTION("Lambdas with captures can be assigned") {
+        const std::string prefix = "value ";
+        auto map = lz::map(vec, [prefix](int i) { return prefix + std::to_string(i); });
+        auto it = map.begin();
+        auto other = std::next(map.begin(), 2);
+        it = other;
+        CHECK(*it == "value 3");
+        it = std::move(other);
+        CHECK(*it == "value 3");
+        const auto& self = it;
+        it = self;
+        CHECK(*it == "value 3");
+
+        int offset = 10;
+        auto offsetMap = lz::map(vec, [offset](int i) { return i + offset; });
+        auto offsetIt = offsetMap.begin();
+        offsetIt = std::next(offsetMap.begin());
+        CHECK(*offsetIt == 12);
+    }
+
+    SECTION("Shared functions are not copied along with the iterators") {
+        struct CountCopies {
+            int* copies;
+
+            CountCopies(int* c) : copies(c) {
+            }
+
+            CountCopies(const CountCopies& other) : copies(other.copies) {
+                ++*copies;
+            }
+
+            CountCopies& operator=(const CountCopies&) = delete;
+
+            int operator()(int i) const {
+                return i * 3;
+            }
+        };
+
+        int copies = 0;
+        auto map = lz::map(vec, lz::sharedFunction(CountCopies(&copies)));
+        const int copiesBefore = copies;
+        auto it = map.begin();
+        auto other = std::next(it, 2);
+        it = other;
+        CHECK(*it == 9);
+        CHECK(map.toVector() == std::vector<int>{ 3, 6, 9 });
+        CHECK(copies == copiesBefore);
+
+        decltype(it) defaultConstructed;
+        defaultConstructed = it;
+        CHECK(*defaultConstructed == 9);
+        CHECK(sizeof(it) <= sizeof(std::vector<int>::iterator) + sizeof(std::shared_ptr<int>));
+    }
+}
+
+TEST_CASE("MapCached calls the function once per element", "[Map][Basic functionality]") {
+    std::vector<int> vec = { 1, 1, 2, 3, 3, 3, 4 };
+    int calls = 0;
+    auto decode = [&calls](int i) {
+        ++calls;
+        return std::to_string(i);
+    };
+
+    SECTION("Repeated dereferences") {
+        auto map = lz::mapCached(vec, decode);
+        auto it = map.begin();
+        CHECK(*it == "1");
+        CHECK(it->size() == 1);
+        CHECK(calls == 1);
+        ++it;
+        CHECK(*it == "1");
+        CHECK(calls == 2);
+    }
+
+    SECTION("Unique") {
+        auto unique = lz::unique(lz::mapCached(vec, decode));
+        CHECK(unique.toVector() == std::vector<std::string>{ "1", "2", "3", "4" });
+        // `std::adjacent_find` looks one element ahead with a copy, so the first element of the runs "2", "3" and "4" is computed
+        // twice: once by the copy and once more when `unique` moves there
+        CHECK(calls == static_cast<int>(vec.size()) + 3);
+    }
+
+    SECTION("Max element") {
+        auto map = lz::mapCached(vec, decode);
+        CHECK(*std::max_element(map.begin(), map.end()) == "4");
+        CHECK(calls == static_cast<int>(vec.size()));
+    }
+
+    SECTION("To vector") {
+        auto map = lz::mapCached(vec, decode);
+        CHECK(map.toVector() == std::vector<std::string>{ "1", "1", "2", "3", "3", "3", "4" });
+        CHECK(calls == static_cast<int>(vec.size()));
+        CHECK(map.size() == vec.size());
+    }
+}
+
 TEST_CASE("Map to containers", "[Map][To container]") {
     constexpr std::size_t size = 3;
     std::array<TestStruct, size> array = { TestStruct{ "FieldA", 1 }, TestStruct{ "FieldB", 2 }, TestStruct{ "FieldC", 3 } };
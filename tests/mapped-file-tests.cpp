@@ -0,0 +1,57 @@
+#include <Lz/CsvSplitter.hpp>
+#include <Lz/FunctionTools.hpp>
+#include <Lz/MappedFile.hpp>
+#include <catch2/catch.hpp>
+#include <cstdio>
+#include <fstream>
+
+TEST_CASE("Mapped file", "[Mapped file][Basic functionality]") {
+    const std::string path = "lz-mapped-file-test.txt";
+    const std::string contents = "first line\nsecond,\"quoted\nfield\"\nthird line\n";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << contents;
+    }
+
+    SECTION("Contents") {
+        const auto file = lz::mappedFile(path);
+        REQUIRE(file.size() == contents.size());
+        CHECK(std::string(file.begin(), file.end()) == contents);
+    }
+
+    SECTION("Lines and records") {
+        const auto file = lz::mappedFile(path, lz::AccessPattern::random);
+        auto lines = lz::lines<std::string>(file);
+        CHECK(std::distance(lines.begin(), lines.end()) == 5);
+        std::size_t records = 0;
+        for (auto&& record : lz::csvRecords(file)) {
+            static_cast<void>(record);
+            ++records;
+        }
+        CHECK(records == 3);
+    }
+
+    SECTION("Moving") {
+        auto file = lz::mappedFile(path);
+        lz::MappedFile other(std::move(file));
+        CHECK(file.empty());
+        CHECK(other.size() == contents.size());
+        file = std::move(other);
+        CHECK(file.size() == contents.size());
+    }
+
+    SECTION("Empty file") {
+        {
+            std::ofstream truncate(path, std::ios::binary | std::ios::trunc);
+        }
+        const auto file = lz::mappedFile(path);
+        CHECK(file.empty());
+        CHECK(file.begin() == file.end());
+    }
+
+    std::remove(path.c_str());
+
+    SECTION("Missing file") {
+        CHECK_THROWS_AS(lz::mappedFile("lz-file-that-does-not-exist.txt"), std::system_error);
+    }
+}
@@ -0,0 +1,92 @@
+#include <Lz/MergeJoin.hpp>
+#include <catch2/catch.hpp>
+#include <forward_list>
+#include <list>
+
+namespace {
+struct Tick {
+    int timestamp;
+    char id;
+};
+} // namespace
+
+TEST_CASE("Merge join changing and creating elements", "[MergeJoin][Basic functionality]") {
+    const auto getTimestamp = [](const Tick& t) {
+        return t.timestamp;
+    };
+    const auto toIds = [](const Tick& a, const Tick& b) {
+        return std::make_pair(a.id, b.id);
+    };
+
+    SECTION("Should join unique keys") {
+        std::vector<Tick> a = { { 1, 'a' }, { 3, 'b' }, { 5, 'c' }, { 7, 'd' } };
+        std::vector<Tick> b = { { 0, 'w' }, { 3, 'x' }, { 4, 'y' }, { 7, 'z' } };
+        auto joined = lz::mergeJoin(a, b, getTimestamp, getTimestamp, toIds);
+        std::vector<std::pair<char, char>> expected = { { 'b', 'x' }, { 'd', 'z' } };
+        CHECK(joined.toVector() == expected);
+    }
+
+    SECTION("Should emit the cross of equal runs") {
+        std::vector<Tick> a = { { 1, 'a' }, { 2, 'b' }, { 2, 'c' }, { 4, 'd' } };
+        std::vector<Tick> b = { { 2, 'x' }, { 2, 'y' }, { 2, 'z' }, { 4, 'w' } };
+        auto joined = lz::mergeJoin(a, b, getTimestamp, getTimestamp, toIds);
+        std::vector<std::pair<char, char>> expected = {
+            { 'b', 'x' }, { 'b', 'y' }, { 'b', 'z' }, { 'c', 'x' }, { 'c', 'y' }, { 'c', 'z' }, { 'd', 'w' },
+        };
+        CHECK(joined.toVector() == expected);
+    }
+
+    SECTION("Should work with forward iterators") {
+        std::forward_list<int> a = { 1, 2, 2, 3 };
+        std::forward_list<int> b = { 2, 3, 3 };
+        auto joined = lz::mergeJoin(
+            a, b, [](int i) { return i; }, [](int i) { return i; }, [](int x, int y) { return x * 10 + y; });
+        CHECK(joined.toVector() == std::vector<int>{ 22, 22, 33, 33 });
+    }
+
+    SECTION("Should be empty without matches") {
+        std::vector<int> a = { 1, 3, 5 };
+        std::vector<int> b = { 2, 4, 6 };
+        std::vector<int> none;
+        const auto identity = [](int i) {
+            return i;
+        };
+        const auto sum = [](int x, int y) {
+            return x + y;
+        };
+        auto noMatches = lz::mergeJoin(a, b, identity, identity, sum);
+        CHECK(noMatches.begin() == noMatches.end());
+        auto emptyA = lz::mergeJoin(none, b, identity, identity, sum);
+        CHECK(emptyA.begin() == emptyA.end());
+        auto emptyB = lz::mergeJoin(a, none, identity, identity, sum);
+        CHECK(emptyB.begin() == emptyB.end());
+    }
+}
+
+TEST_CASE("Merge join binary operations", "[MergeJoin][Binary ops]") {
+    std::list<int> a = { 1, 1, 2 };
+    std::list<int> b = { 1, 2, 2 };
+    auto joined = lz::mergeJoin(
+        a, b, [](int i) { return i; }, [](int i) { return i; }, [](int x, int y) { return std::make_pair(x, y); });
+    auto it = joined.begin();
+
+    SECTION("Operator++") {
+        CHECK(*it == std::make_pair(1, 1));
+        ++it;
+        CHECK(*it == std::make_pair(1, 1));
+        ++it;
+        CHECK(*it == std::make_pair(2, 2));
+        ++it;
+        CHECK(*it == std::make_pair(2, 2));
+        ++it;
+        CHECK(it == joined.end());
+    }
+
+    SECTION("Operator== & operator!=") {
+        CHECK(it == joined.begin());
+        CHECK(it != joined.end());
+        it++;
+        CHECK(it != joined.begin());
+        CHECK(std::distance(joined.begin(), joined.end()) == 4);
+    }
+}
@@ -0,0 +1,159 @@
+#include <Lz/Map.hpp>
+#include <Lz/Merge.hpp>
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <forward_list>
+#include <list>
+#include <string>
+
+namespace {
+struct Row {
+    int key;
+    int shard;
+};
+} // namespace
+
+TEST_CASE("Merge changing and creating elements", "[Merge][Basic functionality]") {
+    SECTION("Should merge two sequences") {
+        std::vector<int> a = { 1, 3, 5, 7 };
+        std::list<int> b = { 2, 3, 4, 8, 9 };
+        auto merged = lz::merge(a, b);
+        CHECK(merged.toVector() == std::vector<int>{ 1, 2, 3, 3, 4, 5, 7, 8, 9 });
+    }
+
+    SECTION("Should merge more than two sequences") {
+        std::vector<int> a = { 1, 4, 7 };
+        std::forward_list<int> b = { 2, 5, 8 };
+        std::list<int> c = { 3, 6, 9 };
+        std::vector<int> d = { 0, 10 };
+        auto merged = lz::merge(a, b, c, d);
+        CHECK(merged.toVector() == std::vector<int>{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 });
+    }
+
+    SECTION("Should use the compare function") {
+        std::vector<std::string> a = { "ccc", "b" };
+        std::vector<std::string> b = { "dddd", "aa" };
+        std::vector<std::string> c = { "eeeee", "" };
+        auto longestFirst = [](const std::string& x, const std::string& y) {
+            return x.size() > y.size();
+        };
+        auto merged = lz::mergeWith(longestFirst, a, b, c);
+        CHECK(merged.toVector() == std::vector<std::string>{ "eeeee", "dddd", "ccc", "aa", "b", "" });
+    }
+
+    SECTION("Should be stable") {
+        std::vector<Row> a = { { 1, 0 }, { 2, 0 } };
+        std::vector<Row> b = { { 1, 1 }, { 2, 1 } };
+        std::vector<Row> c = { { 1, 2 }, { 2, 2 } };
+        auto byKey = [](const Row& x, const Row& y) {
+            return x.key < y.key;
+        };
+        auto shards = lz::map(lz::mergeWith(byKey, a, b, c), [](const Row& r) { return r.shard; });
+        CHECK(shards.toVector() == std::vector<int>{ 0, 1, 2, 0, 1, 2 });
+        auto twoShards = lz::map(lz::mergeWith(byKey, b, a), [](const Row& r) { return r.shard; });
+        CHECK(twoShards.toVector() == std::vector<int>{ 1, 0, 1, 0 });
+    }
+
+    SECTION("Should handle empty sequences") {
+        std::vector<int> a = { 1, 2 };
+        std::vector<int> none;
+        CHECK(lz::merge(none, a, none).toVector() == a);
+        CHECK(lz::merge(a, none).toVector() == a);
+        auto empty = lz::merge(none, none, none);
+        CHECK(empty.begin() == empty.end());
+    }
+
+    SECTION("Should yield references") {
+        std::vector<int> a = { 1, 3 };
+        std::vector<int> b = { 2 };
+        std::vector<int> c = { 4 };
+        for (int& i : lz::merge(a, b, c)) {
+            i *= 10;
+        }
+        CHECK(a == std::vector<int>{ 10, 30 });
+        CHECK(b == std::vector<int>{ 20 });
+    }
+}
+
+TEST_CASE("Merge runs", "[Merge][Basic functionality]") {
+    SECTION("Should merge a runtime amount of sequences") {
+        std::vector<std::vector<int>> shards(64);
+        std::vector<int> expected;
+        for (int i = 0; i < 64 * 10; ++i) {
+            const int value = (i * 37) % 211;
+            shards[static_cast<std::size_t>(i % 64)].push_back(value);
+            expected.push_back(value);
+        }
+        for (auto& shard : shards) {
+            std::sort(shard.begin(), shard.end());
+        }
+        std::sort(expected.begin(), expected.end());
+        CHECK(lz::mergeRuns(shards).toVector() == expected);
+    }
+
+    SECTION("Should work with an amount of sequences that is not a power of two") {
+        for (std::size_t count = 0; count < 10; ++count) {
+            std::vector<std::list<int>> runs(count);
+            std::vector<int> expected;
+            for (std::size_t i = 0; i < count; ++i) {
+                for (int j = 0; j < static_cast<int>(i) + 1; ++j) {
+                    runs[i].push_back(j * 3 + static_cast<int>(i % 3));
+                    expected.push_back(j * 3 + static_cast<int>(i % 3));
+                }
+            }
+            std::sort(expected.begin(), expected.end());
+            auto merged = lz::mergeRuns(runs);
+            CHECK(merged.toVector() == expected);
+        }
+    }
+
+    SECTION("Should be stable and use the compare function") {
+        std::vector<std::vector<Row>> runs = { { { 3, 0 }, { 1, 0 } }, { { 3, 1 } }, { { 2, 2 }, { 1, 2 } } };
+        auto merged = lz::mergeRuns(runs, [](const Row& x, const Row& y) { return x.key > y.key; });
+        std::vector<int> shards;
+        for (const Row& r : merged) {
+            shards.push_back(r.shard);
+        }
+        CHECK(shards == std::vector<int>{ 0, 1, 2, 0, 2 });
+    }
+}
+
+TEST_CASE("Merge binary operations", "[Merge][Binary ops]") {
+    std::vector<int> a = { 1, 4 };
+    std::list<int> b = { 2, 3 };
+    std::vector<int> c = { 0 };
+    auto merged = lz::merge(a, b, c);
+    auto it = merged.begin();
+
+    SECTION("Operator++") {
+        CHECK(*it == 0);
+        ++it;
+        CHECK(*it == 1);
+        ++it;
+        CHECK(*it == 2);
+        ++it;
+        CHECK(*it == 3);
+        ++it;
+        CHECK(*it == 4);
+        ++it;
+        CHECK(it == merged.end());
+    }
+
+    SECTION("Operator== & operator!=") {
+        CHECK(it == merged.begin());
+        CHECK(it != merged.end());
+        it++;
+        CHECK(it != merged.begin());
+        CHECK(std::distance(merged.begin(), merged.end()) == 5);
+    }
+
+    SECTION("Two sequences") {
+        auto two = lz::merge(a, b);
+        auto twoIt = two.begin();
+        CHECK(*twoIt == 1);
+        CHECK(twoIt == two.begin());
+        ++twoIt;
+        CHECK(*twoIt == 2);
+        CHECK(std::distance(two.begin(), two.end()) == 4);
+    }
+}
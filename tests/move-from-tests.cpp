@@ -0,0 +1,111 @@
+#include "Lz/Concatenate.hpp"
+#include "Lz/Filter.hpp"
+#include "Lz/Flatten.hpp"
+#include "Lz/Map.hpp"
+#include "Lz/MoveFrom.hpp"
+
+#include <catch2/catch.hpp>
+#include <list>
+#include <string>
+
+namespace {
+struct Counted {
+    static int copies;
+    int value;
+    bool movedFrom = false;
+
+    explicit Counted(const int v) : value(v) {
+    }
+
+    Counted(const Counted& other) : value(other.value) {
+        ++copies;
+    }
+
+    Counted(Counted&& other) noexcept : value(other.value) {
+        other.movedFrom = true;
+    }
+
+    Counted& operator=(const Counted& other) {
+        value = other.value;
+        ++copies;
+        return *this;
+    }
+
+    Counted& operator=(Counted&& other) noexcept {
+        value = other.value;
+        other.movedFrom = true;
+        return *this;
+    }
+};
+
+int Counted::copies = 0;
+
+std::vector<Counted> makeCounted(const int count) {
+    std::vector<Counted> result;
+    for (int i = 0; i < count; ++i) {
+        result.emplace_back(i);
+    }
+    return result;
+}
+} // namespace
+
+TEST_CASE("As rvalue moves instead of copies", "[AsRvalue][Basic functionality]") {
+    std::vector<Counted> source = makeCounted(6);
+    Counted::copies = 0;
+
+    SECTION("To vector") {
+        auto moved = lz::asRvalue(source).toVector();
+        CHECK(moved.size() == 6);
+        CHECK(Counted::copies == 0);
+        CHECK(source[0].movedFrom);
+    }
+
+    SECTION("Filter and to other container") {
+        auto odd = lz::filter(lz::asRvalue(source), [](const Counted& c) { return c.value % 2 == 1; }).to<std::list<Counted>>();
+        CHECK(odd.size() == 3);
+        CHECK(Counted::copies == 0);
+        CHECK(source[1].movedFrom);
+        CHECK_FALSE(source[0].movedFrom);
+    }
+
+    SECTION("Map") {
+        auto values = lz::map(lz::asRvalue(source), [](Counted&& c) { return Counted(std::move(c)); }).toVector();
+        CHECK(values.back().value == 5);
+        CHECK(Counted::copies == 0);
+    }
+
+    SECTION("Concatenate") {
+        std::vector<Counted> other = makeCounted(2);
+        Counted::copies = 0;
+        auto all = lz::concat(lz::asRvalue(source), lz::asRvalue(other)).toVector();
+        CHECK(all.size() == 8);
+        CHECK(Counted::copies == 0);
+        CHECK(other[1].movedFrom);
+    }
+}
+
+TEST_CASE("Flatten moves inner elements of moved outer elements", "[AsRvalue][Flatten]") {
+    std::vector<std::vector<Counted>> nested;
+    nested.push_back(makeCounted(2));
+    nested.push_back(makeCounted(3));
+    Counted::copies = 0;
+
+    auto flat = lz::flatten(lz::asRvalue(nested)).toVector();
+    CHECK(flat.size() == 5);
+    CHECK(Counted::copies == 0);
+    CHECK(nested[1][2].movedFrom);
+}
+
+TEST_CASE("Move from owns the container", "[MoveFrom][Basic functionality]") {
+    auto view = lz::moveFrom(makeCounted(4));
+    auto copy = view;
+    Counted::copies = 0;
+
+    CHECK(std::distance(copy.begin(), copy.end()) == 4);
+    auto values = lz::filter(lz::moveFrom(makeCounted(4)), [](const Counted& c) { return c.value > 1; }).toVector();
+    CHECK(values.size() == 2);
+    CHECK(Counted::copies == 0);
+
+    std::vector<std::string> strings = { "a", "bb", "ccc" };
+    CHECK(lz::moveFrom(std::move(strings)).toString(",") == "a,bb,ccc");
+}
@@ -0,0 +1,75 @@
+#include "Lz/Filter.hpp"
+#include "Lz/Map.hpp"
+#include "Lz/Own.hpp"
+
+#include <catch2/catch.hpp>
+#include <list>
+#include <vector>
+
+namespace {
+std::vector<int> makeVector() {
+    return { 1, 2, 3, 4, 5, 6 };
+}
+
+auto evenSquares() -> decltype(lz::map(lz::filter(lz::own(makeVector()), std::function<bool(int)>()), std::function<int(int)>())) {
+    return lz::map(lz::filter(lz::own(makeVector()), std::function<bool(int)>([](const int i) { return i % 2 == 0; })),
+                   std::function<int(int)>([](const int i) { return i * i; }));
+}
+} // namespace
+
+TEST_CASE("Own keeps the container alive", "[Own][Basic functionality]") {
+    auto owned = lz::own(makeVector());
+    CHECK(owned.toVector() == makeVector());
+    CHECK(owned.size() == 6);
+
+    auto copy = owned;
+    owned = decltype(owned)();
+    CHECK(copy.toVector() == makeVector());
+}
+
+TEST_CASE("Own can be returned from a function inside a chain", "[Own][Basic functionality]") {
+    auto squares = evenSquares();
+    CHECK(squares.toVector() == std::vector<int>{ 4, 16, 36 });
+}
+
+TEST_CASE("Own does not copy the container", "[Own][Basic functionality]") {
+    std::vector<int> vec = makeVector();
+    const int* data = vec.data();
+    auto owned = lz::own(std::move(vec));
+    CHECK(&*owned.begin() == data);
+}
+
+TEST_CASE("Own binary operations", "[Own][Binary ops]") {
+    auto owned = lz::own(makeVector());
+    auto begin = owned.begin();
+
+    SECTION("Operator++") {
+        ++begin;
+        CHECK(*begin == 2);
+    }
+
+    SECTION("Operator--") {
+        auto end = owned.end();
+        --end;
+        CHECK(*end == 6);
+    }
+
+    SECTION("Operator== & Operator!=") {
+        CHECK(begin != owned.end());
+        begin += 6;
+        CHECK(begin == owned.end());
+    }
+
+    SECTION("Random access") {
+        CHECK(begin[2] == 3);
+        CHECK(owned.end() - begin == 6);
+        CHECK(*(begin + 3) == 4);
+        CHECK(begin < owned.end());
+    }
+}
+
+TEST_CASE("Own with a non random access container", "[Own][Basic functionality]") {
+    auto owned = lz::own(std::list<int>{ 1, 2, 3 });
+    CHECK(owned.toVector() == std::vector<int>{ 1, 2, 3 });
+    CHECK(lz::filter(std::move(owned), [](const int i) { return i != 2; }).toVector() == std::vector<int>{ 1, 3 });
+}
@@ -0,0 +1,104 @@
+#include <Lz/Lz.hpp>
+#include <atomic>
+#include <catch2/catch.hpp>
+#include <list>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+TEST_CASE("ParallelMap yields the results in order", "[ParallelMap][Basic functionality]") {
+    std::list<int> list(1000);
+    std::iota(list.begin(), list.end(), 0);
+
+    SECTION("Loops") {
+        auto mapped = lz::parallelMap(list, [](int i) { return std::to_string(i); }, lz::execution::pool(4), 16);
+        int expected = 0;
+        for (const std::string& s : mapped) {
+            CHECK(s == std::to_string(expected));
+            ++expected;
+        }
+        CHECK(expected == 1000);
+    }
+
+    SECTION("Calls the function once per element") {
+        std::atomic<int> calls{ 0 };
+        auto mapped = lz::parallelMap(
+            list,
+            [&calls](int i) {
+                ++calls;
+                return i * 2;
+            },
+            lz::execution::pool(4));
+        const std::vector<int> expected = lz::map(list, [](int i) { return i * 2; }).toVector();
+        CHECK(mapped.toVector() == expected);
+        CHECK(calls == 1000);
+    }
+
+    SECTION("Chains and windows that don't divide the input") {
+        auto chain = lz::toIter(list).take(10).parallelMap([](int i) { return i + 1; }, lz::execution::pool(2), 3);
+        CHECK(chain.toVector() == std::vector<int>{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 });
+    }
+
+    SECTION("Empty") {
+        std::list<int> empty;
+        auto mapped = lz::parallelMap(empty, [](int i) { return i; }, lz::execution::pool(2));
+        CHECK(mapped.begin() == mapped.end());
+    }
+}
+
+TEST_CASE("ParallelMap maps the next window ahead of the consumer", "[ParallelMap][Basic functionality]") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5, 6 };
+    std::atomic<int> calls{ 0 };
+    auto mapped = lz::parallelMap(
+        vec,
+        [&calls](int i) {
+            ++calls;
+            return i;
+        },
+        lz::execution::pool(2), 2);
+    auto it = mapped.begin();
+    CHECK(*it == 1);
+    // The second window is mapped in the background while the first one is read, the third one only once the second is read
+    for (int i = 0; i < 1000 && calls < 4; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    CHECK(calls == 4);
+    ++it;
+    ++it;
+    CHECK(*it == 3);
+    CHECK(mapped.toVector() == std::vector<int>{ 3, 4, 5, 6 });
+    CHECK(calls == 6);
+}
+
+TEST_CASE("ParallelMap maps windows within tasks of the same pool", "[ParallelMap][Basic functionality]") {
+    lz::ThreadPool pool(2);
+    std::vector<int> vec = { 1, 2, 3, 4, 5 };
+    std::vector<std::vector<int>> results(4);
+    pool.parallelFor(results.size(), [&](const std::size_t task) {
+        results[task] = lz::parallelMap(vec, [task](int i) { return i * static_cast<int>(task); }, lz::execution::pool(pool), 2)
+                            .toVector();
+    });
+    for (std::size_t task = 0; task < results.size(); ++task) {
+        CHECK(results[task] == lz::map(vec, [task](int i) { return i * static_cast<int>(task); }).toVector());
+    }
+}
+
+TEST_CASE("ParallelMap rethrows exceptions of the function", "[ParallelMap][Basic functionality]") {
+    std::vector<int> vec = { 1, 2, 3, 4 };
+    auto mapped = lz::parallelMap(
+        vec,
+        [](int i) {
+            if (i == 3) {
+                throw std::runtime_error("3");
+            }
+            return i;
+        },
+        lz::execution::pool(2), 2);
+    auto it = mapped.begin();
+    CHECK(*it == 1);
+    ++it;
+    CHECK(*it == 2);
+    CHECK_THROWS_AS(++it, std::runtime_error);
+    CHECK(it == mapped.end());
+}
@@ -0,0 +1,141 @@
+#include "Lz/Filter.hpp"
+#include "Lz/Partitions.hpp"
+#include "Lz/Range.hpp"
+
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <forward_list>
+#include <string>
+
+namespace {
+struct Order {
+    int customer;
+    int amount;
+};
+
+bool operator==(const Order& a, const Order& b) {
+    return a.customer == b.customer && a.amount == b.amount;
+}
+
+// Every key is in exactly one partition, and the elements of a partition are in the order of the sequence
+template<class Partitions, class Key>
+void checkPartitions(const Partitions& partitions, const std::size_t elementCount, const Key& key) {
+    std::size_t total = 0;
+    bool keysInOnePartition = true;
+    bool inOrder = true;
+    std::vector<std::size_t> partitionOfKey;
+    for (std::size_t i = 0; i < partitions.size(); ++i) {
+        const auto partition = partitions[i];
+        total += partition.size();
+        for (auto it = partition.begin(); it != partition.end(); ++it) {
+            const auto k = static_cast<std::size_t>(key(*it));
+            if (partitionOfKey.size() <= k) {
+                partitionOfKey.resize(k + 1, partitions.size());
+            }
+            keysInOnePartition &= partitionOfKey[k] == partitions.size() || partitionOfKey[k] == i;
+            partitionOfKey[k] = i;
+            inOrder &= it == partition.begin() || std::prev(it)->amount < it->amount;
+        }
+    }
+    CHECK(keysInOnePartition);
+    CHECK(inOrder);
+    CHECK(total == elementCount);
+}
+} // namespace
+
+TEST_CASE("Partitions basic functionality", "[Partitions][Basic functionality]") {
+    std::vector<Order> orders;
+    for (int i = 0; i < 1000; ++i) {
+        orders.push_back({ i % 37, i });
+    }
+    const auto customer = [](const Order& o) {
+        return o.customer;
+    };
+    const auto partitions = lz::partitionBy(orders, customer, 8);
+    REQUIRE(partitions.size() == 8);
+    checkPartitions(partitions, orders.size(), customer);
+
+    SECTION("Iterating the partitions") {
+        std::size_t i = 0;
+        for (auto partition : partitions) {
+            CHECK(partition.begin() == partitions.partitionVector(i).data());
+            CHECK(partition.size() == partitions.partitionVector(i).size());
+            ++i;
+        }
+        CHECK(i == 8);
+    }
+
+    SECTION("Equal keys in equal partitions for every input") {
+        std::vector<Order> other = { { 5, 0 }, { 36, 1 } };
+        const auto otherPartitions = lz::partitionBy(other, customer, 8);
+        for (std::size_t i = 0; i < 8; ++i) {
+            for (const Order& o : otherPartitions[i]) {
+                const auto partition = partitions[i];
+                CHECK(std::find_if(partition.begin(), partition.end(), [&](const Order& p) {
+                          return p.customer == o.customer;
+                      }) != partition.end());
+            }
+        }
+    }
+
+    SECTION("One partition") {
+        const auto one = lz::partitionBy(orders, customer, 1);
+        REQUIRE(one.size() == 1);
+        CHECK(std::equal(one[0].begin(), one[0].end(), orders.begin()));
+        CHECK(one[0].size() == orders.size());
+    }
+}
+
+TEST_CASE("Partitions of other sequences", "[Partitions][Binary ops]") {
+    SECTION("Empty") {
+        std::vector<int> empty;
+        const auto partitions = lz::partitionBy(empty, [](int i) { return i; }, 4);
+        REQUIRE(partitions.size() == 4);
+        for (auto partition : partitions) {
+            CHECK(partition.empty());
+        }
+    }
+
+    SECTION("Forward iterable of strings") {
+        std::forward_list<std::string> words = { "a", "bb", "a", "ccc", "bb", "a" };
+        auto partitions = lz::partitionBy(words, [](const std::string& s) { return s; }, 3);
+        std::size_t total = 0;
+        for (auto partition : partitions) {
+            total += partition.size();
+            for (const std::string& word : partition) {
+                CHECK(std::count(partition.begin(), partition.end(), word) ==
+                      std::count(words.begin(), words.end(), word));
+            }
+        }
+        CHECK(total == 6);
+    }
+
+    SECTION("Unsized view") {
+        auto even = lz::filter(lz::range(100), [](int i) { return i % 2 == 0; });
+        const auto partitions = lz::partitionBy(even, [](int i) { return i; }, 5);
+        std::size_t total = 0;
+        for (auto partition : partitions) {
+            total += partition.size();
+            CHECK(std::is_sorted(partition.begin(), partition.end()));
+        }
+        CHECK(total == 50);
+    }
+}
+
+TEST_CASE("Partitions in parallel", "[Partitions][Parallel]") {
+    std::vector<Order> orders;
+    for (int i = 0; i < 20000; ++i) {
+        orders.push_back({ (i * 7919) % 1013, i });
+    }
+    const auto customer = [](const Order& o) {
+        return o.customer;
+    };
+    lz::ThreadPool pool(4);
+    const auto parallel = lz::partitionBy(orders, customer, 64, lz::execution::pool(pool));
+    const auto sequential = lz::partitionBy(orders, customer, 64);
+    REQUIRE(parallel.size() == 64);
+    checkPartitions(parallel, orders.size(), customer);
+    for (std::size_t i = 0; i < 64; ++i) {
+        CHECK(parallel.partitionVector(i) == sequential.partitionVector(i));
+    }
+}
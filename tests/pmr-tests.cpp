@@ -0,0 +1,62 @@
+#include "Lz/Filter.hpp"
+#include "Lz/Map.hpp"
+#include "Lz/Pmr.hpp"
+#include "Lz/Range.hpp"
+
+#include <catch2/catch.hpp>
+
+#ifdef __cpp_lib_memory_resource
+#    include <set>
+
+TEST_CASE("Pmr materialization", "[Pmr][Basic functionality]") {
+    // Without an upstream resource, every allocation that doesn't fit in the arena throws
+    std::byte buffer[1 << 14];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof buffer, std::pmr::null_memory_resource());
+    auto multiplesOfThree = lz::filter(lz::range(30), [](int i) { return i % 3 == 0; });
+
+    SECTION("To vector") {
+        std::pmr::vector<int> vector = lz::pmr::toVector(multiplesOfThree, &arena);
+        CHECK(vector.get_allocator().resource() == &arena);
+        CHECK(std::vector<int>(vector.begin(), vector.end()) == std::vector<int>{ 0, 3, 6, 9, 12, 15, 18, 21, 24, 27 });
+    }
+
+    SECTION("To container") {
+        auto set = lz::pmr::to<std::pmr::set<int>>(lz::range(5), &arena);
+        CHECK(set.get_allocator().resource() == &arena);
+        CHECK(set.size() == 5);
+    }
+
+    SECTION("To string") {
+        std::pmr::string joined = lz::pmr::toString(lz::range(4), &arena, ", ");
+        CHECK(joined.get_allocator().resource() == &arena);
+        CHECK(joined == "0, 1, 2, 3");
+#    if !defined(LZ_STANDALONE) || defined(LZ_HAS_FORMAT)
+        auto halves = lz::map(lz::range(3), [](int i) { return i * .5; });
+        CHECK(lz::pmr::toString(halves, &arena, " ", "{:.1f}") == "0.0 0.5 1.0");
+#    endif
+    }
+
+    SECTION("Append to a string with an allocator") {
+        std::pmr::string result("x: ", &arena);
+        multiplesOfThree.appendTo(result, " ");
+        CHECK(result == "x: 0 3 6 9 12 15 18 21 24 27");
+    }
+
+    SECTION("To maps") {
+        auto map = lz::pmr::toMap(lz::range(6), [](int i) { return i / 2; }, &arena);
+        CHECK(map.get_allocator().resource() == &arena);
+        CHECK(map.size() == 3);
+        CHECK(map.at(1) == 2);
+
+        auto unorderedMap = lz::pmr::toUnorderedMap(lz::range(6), [](int i) { return i * 2; }, &arena);
+        CHECK(unorderedMap.get_allocator().resource() == &arena);
+        CHECK(unorderedMap.at(10) == 5);
+    }
+
+    SECTION("View functions with an allocator") {
+        auto vector = multiplesOfThree.toVector(std::pmr::polymorphic_allocator<int>(&arena));
+        CHECK(vector.size() == 10);
+        CHECK(vector.get_allocator().resource() == &arena);
+    }
+}
+#endif // __cpp_lib_memory_resource
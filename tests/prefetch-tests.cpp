@@ -0,0 +1,66 @@
+#include <Lz/Lz.hpp>
+#include <catch2/catch.hpp>
+#include <list>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+
+TEST_CASE("Prefetch yields the elements in order", "[Prefetch][Basic functionality]") {
+    std::vector<int> vec(10000);
+    std::iota(vec.begin(), vec.end(), 0);
+
+    SECTION("Loops") {
+        auto prefetched = lz::prefetch(vec, 16);
+        int expected = 0;
+        for (int i : prefetched) {
+            CHECK(i == expected);
+            ++expected;
+        }
+        CHECK(expected == 10000);
+    }
+
+    SECTION("On another thread") {
+        const auto consumer = std::this_thread::get_id();
+        auto producers = lz::prefetch(lz::map(vec, [](int) { return std::this_thread::get_id(); }), 4);
+        CHECK(lz::toIter(producers).all([consumer](std::thread::id id) { return id != consumer; }));
+    }
+
+    SECTION("Chains") {
+        std::list<int> list = { 1, 2, 3, 4 };
+        auto chain = lz::toIter(list).map([](int i) { return i * 2; }).prefetch(1).filter([](int i) { return i != 4; });
+        CHECK(chain.toVector() == std::vector<int>{ 2, 6, 8 });
+    }
+
+    SECTION("Empty") {
+        std::vector<int> empty;
+        auto prefetched = lz::prefetch(empty, 8);
+        CHECK(prefetched.begin() == prefetched.end());
+        CHECK(lz::prefetch(empty, 8).toVector().empty());
+    }
+
+    SECTION("Stopping early") {
+        auto prefetched = lz::prefetch(lz::generate([] { return 1; }), 8);
+        auto it = prefetched.begin();
+        CHECK(*it == 1);
+        ++it;
+        CHECK(*it == 1);
+        // The destructor stops the endless background loop
+    }
+}
+
+TEST_CASE("Prefetch rethrows exceptions of the background thread", "[Prefetch][Basic functionality]") {
+    std::vector<int> vec = { 1, 2, 3 };
+    auto throwing = lz::map(vec, [](int i) {
+        if (i == 3) {
+            throw std::runtime_error("3");
+        }
+        return i;
+    });
+    auto prefetched = lz::prefetch(throwing, 2);
+    auto it = prefetched.begin();
+    CHECK(*it == 1);
+    ++it;
+    CHECK(*it == 2);
+    CHECK_THROWS_AS(++it, std::runtime_error);
+    CHECK(it == prefetched.end());
+}
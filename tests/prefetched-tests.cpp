@@ -0,0 +1,59 @@
+#include <Lz/Map.hpp>
+#include <Lz/Prefetched.hpp>
+#include <catch2/catch.hpp>
+#include <memory>
+#include <vector>
+
+TEST_CASE("Prefetched gathers", "[Prefetched][Basic functionality]") {
+    const std::vector<int> table = { 10, 20, 30, 40, 50 };
+    const std::vector<std::size_t> indices = { 4, 0, 3, 3, 1, 2 };
+    auto gathered = lz::map(indices, [&table](const std::size_t i) -> const int& { return table[i]; });
+
+    SECTION("Same elements for any distance") {
+        for (const std::ptrdiff_t distance : { 0, 1, 2, 6, 100 }) {
+            auto view = lz::prefetched(gathered, distance);
+            CHECK(std::vector<int>(view.begin(), view.end()) == std::vector<int>{ 50, 10, 40, 40, 20, 30 });
+        }
+    }
+
+    SECTION("Random access") {
+        auto view = lz::prefetched(gathered, 2);
+        CHECK(view.size() == 6);
+        CHECK(view.begin()[2] == 40);
+        CHECK(*(view.begin() + 5) == 30);
+        CHECK(*(view.end() - 1) == 30);
+        CHECK(&*view.begin() == &table[4]);
+        auto it = view.end();
+        --it;
+        CHECK(*it == 30);
+        CHECK(view.end() - view.begin() == 6);
+        CHECK(view.begin() < view.end());
+    }
+
+    SECTION("Empty") {
+        const std::vector<std::size_t> none;
+        auto view = lz::prefetched(lz::map(none, [&table](const std::size_t i) -> const int& { return table[i]; }), 4);
+        CHECK(view.begin() == view.end());
+    }
+}
+
+TEST_CASE("Prefetched pointers", "[Prefetched][Pointers]") {
+    std::vector<std::unique_ptr<int>> owned;
+    std::vector<int*> pointers;
+    for (int i = 0; i < 20; ++i) {
+        owned.emplace_back(new int(i));
+        pointers.push_back(owned.back().get());
+    }
+
+    int sum = 0;
+    for (int* value : lz::prefetched(pointers, 4)) {
+        sum += *value;
+    }
+    CHECK(sum == 190);
+
+    sum = 0;
+    for (const std::unique_ptr<int>& value : lz::prefetched(owned, 4)) {
+        sum += *value;
+    }
+    CHECK(sum == 190);
+}
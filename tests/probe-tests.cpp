@@ -0,0 +1,103 @@
+// The probes only count when LZ_PROBES is defined, see lz-chain-tests.cpp for a chain without it
+#define LZ_PROBES
+
+#include <Lz/Filter.hpp>
+#include <Lz/Map.hpp>
+#include <Lz/ProbeReport.hpp>
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <list>
+#include <sstream>
+
+namespace {
+const lz::ProbeSnapshot& findProbe(const std::vector<lz::ProbeSnapshot>& report, const std::string& name) {
+    const auto it = std::find_if(report.begin(), report.end(), [&name](const lz::ProbeSnapshot& p) { return p.name == name; });
+    REQUIRE(it != report.end());
+    return *it;
+}
+} // namespace
+
+TEST_CASE("Probe changing and creating elements", "[Probe][Basic functionality]") {
+    lz::resetProbes();
+    std::vector<int> input = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+    SECTION("Should count the elements of every stage") {
+        auto read = lz::probe(input, "probe-tests read");
+        auto squared = lz::probe(lz::map(read, [](int i) { return i * i; }), "probe-tests map");
+        auto even = lz::probe(lz::filter(squared, [](int i) { return i % 2 == 0; }), "probe-tests filter");
+        CHECK(even.toVector() == std::vector<int>{ 4, 16, 36, 64, 100 });
+
+        const std::vector<lz::ProbeSnapshot> report = lz::probeReport();
+        CHECK(findProbe(report, "probe-tests read").elements == 10);
+        CHECK(findProbe(report, "probe-tests map").elements == 10);
+        CHECK(findProbe(report, "probe-tests filter").elements == 5);
+        CHECK(findProbe(report, "probe-tests filter").runs == 1);
+        CHECK(findProbe(report, "probe-tests filter").time >= findProbe(report, "probe-tests read").time);
+    }
+
+    SECTION("Should share the counters of probes with the same name") {
+        std::list<int> list(input.begin(), input.end());
+        auto first = lz::probe(input, "probe-tests shared");
+        auto second = lz::probe(list, "probe-tests shared");
+        CHECK(first.toVector() == second.toVector());
+        CHECK(findProbe(lz::probeReport(), "probe-tests shared").elements == 20);
+        CHECK(findProbe(lz::probeReport(), "probe-tests shared").runs == 2);
+        lz::resetProbes();
+        CHECK(findProbe(lz::probeReport(), "probe-tests shared").elements == 0);
+    }
+
+    SECTION("Should call the callback when a sequence is finished") {
+        std::vector<std::string> finished;
+        lz::onProbeFinished([&finished](const lz::ProbeSnapshot& snapshot) { finished.push_back(snapshot.name); });
+        auto probed = lz::probe(input, "probe-tests callback");
+        auto it = probed.begin();
+        ++it;
+        CHECK(finished.empty());
+        for (; it != probed.end(); ++it) {
+        }
+        lz::onProbeFinished(nullptr);
+        CHECK(finished == std::vector<std::string>{ "probe-tests callback" });
+    }
+
+    SECTION("Should write a report") {
+        auto probed = lz::probe(input, "probe-tests report");
+        CHECK(probed.toVector() == input);
+        std::ostringstream stream;
+        lz::writeProbeReport(stream);
+        CHECK(stream.str().find("probe-tests report") != std::string::npos);
+    }
+}
+
+TEST_CASE("Probe binary operations", "[Probe][Binary ops]") {
+    std::vector<int> input = { 1, 2, 3 };
+    auto probed = lz::probe(input, "probe-tests binary operations");
+    auto it = probed.begin();
+
+    SECTION("Operator++") {
+        CHECK(*it == 1);
+        ++it;
+        CHECK(*it == 2);
+        ++it;
+        CHECK(*it == 3);
+        ++it;
+        CHECK(it == probed.end());
+    }
+
+    SECTION("Operator--") {
+        it = probed.end();
+        --it;
+        CHECK(*it == 3);
+    }
+
+    SECTION("Operator== & operator!=") {
+        CHECK(it == probed.begin());
+        CHECK(it != probed.end());
+    }
+
+    SECTION("Random access") {
+        CHECK(probed.end() - probed.begin() == 3);
+        CHECK(it[2] == 3);
+        CHECK(*(it + 1) == 2);
+        CHECK(it < probed.end());
+    }
+}
@@ -0,0 +1,63 @@
+#include "Lz/QuantileSketch.hpp"
+#include "Lz/Range.hpp"
+
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <list>
+#include <numeric>
+#include <random>
+#include <vector>
+
+TEST_CASE("Quantile sketch exact for small inputs", "[QuantileSketch][Basic functionality]") {
+    std::list<int> values = { 5, 1, 4, 2, 3 };
+    auto sketch = lz::quantileSketch(values);
+
+    CHECK(sketch.count() == 5);
+    CHECK(sketch.retained() == 5);
+    CHECK(sketch.quantile(0) == 1);
+    CHECK(sketch.quantile(0.5) == 3);
+    CHECK(sketch.quantile(1) == 5);
+    CHECK(sketch.rank(3) == Approx(0.4));
+    CHECK(values == std::list<int>{ 5, 1, 4, 2, 3 });
+
+    lz::QuantileSketch<int> empty;
+    CHECK(empty.empty());
+}
+
+TEST_CASE("Quantile sketch approximations", "[QuantileSketch][Basic functionality]") {
+    constexpr int count = 100000;
+    constexpr double tolerance = 0.02;
+    std::vector<int> values(count);
+    std::iota(values.begin(), values.end(), 0);
+    std::shuffle(values.begin(), values.end(), std::mt19937(42));
+
+    SECTION("Quantiles") {
+        auto sketch = lz::quantileSketch(values);
+        CHECK(sketch.count() == static_cast<std::size_t>(count));
+        CHECK(sketch.retained() < 1000);
+        for (const double q : { 0.01, 0.25, 0.5, 0.75, 0.99 }) {
+            CHECK(std::abs(sketch.quantile(q) - q * count) < tolerance * count);
+        }
+        CHECK(sketch.rank(count / 2) == Approx(0.5).margin(tolerance));
+    }
+
+    SECTION("Merging") {
+        lz::QuantileSketch<int> first;
+        lz::QuantileSketch<int> second(200, {}, 1);
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            (i % 3 == 0 ? first : second).insert(values[i]);
+        }
+        first.merge(second);
+        CHECK(first.count() == static_cast<std::size_t>(count));
+        CHECK(first.retained() < 1000);
+        CHECK(std::abs(first.quantile(0.5) - count / 2) < tolerance * count);
+    }
+
+    SECTION("Custom comparer") {
+        lz::QuantileSketch<int, std::greater<int>> sketch;
+        for (const int value : values) {
+            sketch.insert(value);
+        }
+        CHECK(std::abs(sketch.quantile(0.1) - 0.9 * count) < tolerance * count);
+    }
+}
@@ -1,6 +1,7 @@
 #include <Lz/Random.hpp>
 #include <catch2/catch.hpp>
 #include <list>
+#include <thread>
 
 TEST_CASE("Random should be random", "[Random][Basic functionality]") {
     constexpr std::size_t size = 5;
@@ -119,3 +120,161 @@ TEST_CASE("Random to containers", "[Random][To container]") {
         CHECK(actual.size() == size);
     }
 }
+
+TEST_CASE("Random from multiple threads", "[Random][Threads]") {
+    constexpr std::size_t size = 1000;
+    const auto random = lz::random(0, 100, size);
+    std::vector<std::vector<int>> results(4);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        threads.emplace_back([&random, &results, i] { results[i] = random.toVector(); });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    for (const std::vector<int>& result : results) {
+        REQUIRE(result.size() == size);
+        CHECK(std::all_of(result.begin(), result.end(), [](const int i) { return i >= 0 && i <= 100; }));
+    }
+
+    SECTION("Every thread has its own engine") {
+        using Engine = lz::ThreadLocalEngine<std::mt19937>;
+        const std::mt19937* otherEngine = nullptr;
+        std::thread([&otherEngine] { otherEngine = &Engine::engine(); }).join();
+        CHECK(otherEngine != &Engine::engine());
+    }
+}
+
+TEST_CASE("Small random engines", "[Random][Engines]") {
+    SECTION("SplitMix64") {
+        lz::SplitMix64 gen(0);
+        CHECK(gen() == 0xE220A8397B1DCDAFULL);
+        lz::SplitMix64 skipped(0);
+        skipped.discard(1);
+        CHECK(skipped == gen);
+    }
+
+    SECTION("PCG32") {
+        lz::Pcg32 gen(42, 54);
+        CHECK(gen() == 0xA15C02B7u);
+        CHECK(gen() == 0x7B47F409u);
+        CHECK(gen() == 0xBA1D3330u);
+
+        lz::Pcg32 stepped(1, 2);
+        lz::Pcg32 skipped(1, 2);
+        for (int i = 0; i < 1000; ++i) {
+            stepped();
+        }
+        skipped.discard(1000);
+        CHECK(stepped == skipped);
+        CHECK(lz::Pcg32(1, 2) != lz::Pcg32(1, 3));
+    }
+
+    SECTION("xoshiro256**") {
+        lz::Xoshiro256StarStar a(7);
+        lz::Xoshiro256StarStar b(7);
+        CHECK(a() == b());
+        b.jump();
+        CHECK(a != b);
+        std::seed_seq seedSeq{ 1, 2, 3 };
+        lz::Xoshiro256StarStar seeded(seedSeq);
+        CHECK(seeded != lz::Xoshiro256StarStar());
+    }
+
+    SECTION("Copies") {
+        lz::SplitMix64 splitMix(3);
+        lz::SplitMix64 splitMixCopy(splitMix);
+        CHECK(splitMixCopy == splitMix);
+        lz::Xoshiro256StarStar xoshiro(3);
+        lz::Xoshiro256StarStar xoshiroCopy(xoshiro);
+        CHECK(xoshiroCopy() == xoshiro());
+        lz::Pcg32 pcg(3, 4);
+        lz::Pcg32 pcgCopy(pcg);
+        CHECK(pcgCopy() == pcg());
+        std::seed_seq seedSeq{ 4, 5 };
+        CHECK(lz::Pcg32(seedSeq) != pcg);
+    }
+
+    SECTION("As generator of lz::random") {
+        lz::Xoshiro256StarStar gen(lz::randomSeed());
+        std::uniform_int_distribution<int> dist(1, 6);
+        const auto dice = lz::random(dist, gen, 100).toVector();
+        CHECK(dice.size() == 100);
+        CHECK(std::all_of(dice.begin(), dice.end(), [](const int i) { return i >= 1 && i <= 6; }));
+
+        lz::ThreadLocalEngine<lz::Pcg32> threadGen;
+        std::uniform_real_distribution<double> unit;
+        const auto values = lz::random(unit, threadGen, 10).toVector();
+        CHECK(std::all_of(values.begin(), values.end(), [](const double d) { return d >= 0. && d < 1.; }));
+        CHECK(lz::randomSeed() != lz::randomSeed());
+    }
+}
+
+TEST_CASE("Random while true", "[Random][Basic functionality]") {
+    const auto random = lz::random(0, 10);
+    CHECK(random.begin() != random.end());
+
+    std::size_t counter = 0;
+    for (const int i : random) {
+        CHECK((i >= 0 && i <= 10));
+        if (++counter == 100) {
+            break;
+        }
+    }
+    CHECK(counter == 100);
+
+    lz::Pcg32 gen(7);
+    const auto custom = lz::random(lz::FastUniformDistribution<int>(1, 6), gen);
+    auto it = custom.begin();
+    std::advance(it, 50);
+    CHECK(it != custom.end());
+    CHECK(std::distance(custom.begin(), std::next(custom.begin(), 50)) == 50);
+}
+
+TEST_CASE("Random fill", "[Random][Fill]") {
+    std::vector<int> values(500);
+    const auto random = lz::random(-5, 5, 3);
+    random.fillTo(values);
+    CHECK(std::all_of(values.begin(), values.end(), [](const int i) { return i >= -5 && i <= 5; }));
+    std::array<double, 4> doubles{};
+    lz::random(2., 3.).fillTo(doubles.begin(), doubles.end());
+    CHECK(std::all_of(doubles.begin(), doubles.end(), [](const double d) { return d >= 2. && d <= 3.; }));
+}
+
+TEST_CASE("Fast uniform distribution", "[Random][Fast uniform]") {
+    SECTION("Same numbers on every platform") {
+        // Lemire's method takes the upper 32 bits of output * bound: 0xA15C02B7 * 100 >> 32 == 63, 0x7B47F409 * 100 >> 32 == 48
+        lz::Pcg32 pcg(42, 54);
+        const lz::FastUniformDistribution<unsigned> percentages(0, 99);
+        CHECK(lz::random(percentages, pcg, 5).toVector() == std::vector<unsigned>{ 63, 48, 72, 51, 74 });
+
+        lz::Xoshiro256StarStar xoshiro(1234);
+        const lz::FastUniformDistribution<int> dice(1, 6);
+        CHECK(lz::random(dice, xoshiro, 10).toVector() == std::vector<int>{ 1, 6, 5, 6, 1, 6, 3, 2, 4, 4 });
+    }
+
+    SECTION("Bounds") {
+        std::mt19937 gen(3);
+        const lz::FastUniformDistribution<signed char> bytes(-128, 127);
+        const auto values = lz::random(bytes, gen, 2000).toVector();
+        CHECK(std::find(values.begin(), values.end(), static_cast<signed char>(-128)) != values.end());
+        CHECK(std::find(values.begin(), values.end(), static_cast<signed char>(127)) != values.end());
+
+        const lz::FastUniformDistribution<std::int64_t> large(-5, std::int64_t{ 1 } << 62);
+        const auto largeValues = lz::random(large, gen, 100).toVector();
+        CHECK(std::all_of(largeValues.begin(), largeValues.end(),
+                          [](const std::int64_t i) { return i >= -5 && i <= (std::int64_t{ 1 } << 62); }));
+
+        const lz::FastUniformDistribution<std::uint64_t> full(0, (std::numeric_limits<std::uint64_t>::max)());
+        CHECK(full(gen) != full(gen));
+
+        const lz::FastUniformDistribution<float> unit(0.f, 1.f);
+        const auto floats = lz::random(unit, gen, 1000).toVector();
+        CHECK(std::all_of(floats.begin(), floats.end(), [](const float f) { return f >= 0.f && f < 1.f; }));
+
+        lz::Xoshiro256StarStar xoshiro;
+        const lz::FastUniformDistribution<double> doubles(-2., 2.);
+        const auto doubleValues = lz::random(doubles, xoshiro, 1000).toVector();
+        CHECK(std::all_of(doubleValues.begin(), doubleValues.end(), [](const double d) { return d >= -2. && d < 2.; }));
+    }
+}
@@ -1,6 +1,7 @@
 #include <Lz/Range.hpp>
 #include <catch2/catch.hpp>
 #include <list>
+#include <vector>
 
 TEST_CASE("Range changing and creating elements", "[Range][Basic functionality]") {
     SECTION("Looping upwards") {
@@ -92,6 +93,11 @@ TEST_CASE("Range binary operations", "[Range][Binary ops]") {
 
         CHECK(range.end() - (it + 1) == 9);
         CHECK(fRange.end() - (fIt + 1) == 20);
+
+        auto exactStep = lz::range(0, 9, 3);
+        CHECK(exactStep.end() - exactStep.begin() == 3);
+        auto partialStep = lz::range(0, 10, 3);
+        CHECK(partialStep.end() - partialStep.begin() == 4);
     }
 
     SECTION("Operator[]()") {
@@ -120,6 +126,53 @@ TEST_CASE("Range binary operations", "[Range][Binary ops]") {
 
 }
 
+TEST_CASE("Range values are computed from their index", "[Range][Basic functionality]") {
+    SECTION("Floating point ranges don't drift") {
+        auto tenths = lz::range(0., 1., .1);
+        auto values = tenths.toVector();
+        REQUIRE(values.size() == 10);
+        for (std::size_t i = 0; i != values.size(); ++i) {
+            CHECK(values[i] == static_cast<double>(i) * .1);
+            CHECK(tenths.begin()[static_cast<std::ptrdiff_t>(i)] == values[i]);
+        }
+        CHECK(std::distance(tenths.begin(), tenths.end()) == 10);
+    }
+
+    SECTION("Distances are signed") {
+        auto range = lz::range(10, 0, -3);
+        CHECK(range.toVector() == std::vector<int>{ 10, 7, 4, 1 });
+        CHECK(range.end() - range.begin() == 4);
+        CHECK(range.begin() - range.end() == -4);
+        CHECK(*(range.end() - 1) == 1);
+    }
+
+    SECTION("Integral ranges whose length doesn't fit in their type") {
+        auto wide = lz::range(-2000000000, 2000000000, 7);
+        CHECK(wide.end() - wide.begin() == 571428572);
+        CHECK(*(wide.end() - 1) == 1999999997);
+        auto bytes = lz::range<unsigned char>(250, 255);
+        CHECK(bytes.toVector() == std::vector<unsigned char>{ 250, 251, 252, 253, 254 });
+    }
+
+    SECTION("Splitting over threads gives the same values") {
+        lz::ThreadPool pool(3);
+        auto range = lz::range(-3., 5., .01);
+        CHECK(range.toVector(lz::execution::pool(pool)) == range.toVector());
+    }
+}
+
+TEST_CASE("Linspace", "[Range][Basic functionality]") {
+    CHECK(lz::linspace(0., 1., 5).toVector() == std::vector<double>{ 0., .25, .5, .75, 1. });
+    CHECK(lz::linspace(1.f, 0.f, 3).toVector() == std::vector<float>{ 1.f, .5f, 0.f });
+    CHECK(lz::linspace(2., 3., 1).toVector() == std::vector<double>{ 2. });
+    CHECK(lz::linspace(2., 3., 0).toVector().empty());
+
+    auto grid = lz::linspace(-1., 1., 201);
+    CHECK(grid.end() - grid.begin() == 201);
+    CHECK(grid.begin()[100] == 0.);
+    CHECK(*(grid.end() - 1) == Approx(1.));
+}
+
 TEST_CASE("Range to containers", "[Range][To container]") {
     constexpr int size = 10;
     auto range = lz::range(size);
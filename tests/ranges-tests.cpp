@@ -0,0 +1,103 @@
+#include <Lz/Lz.hpp>
+#include <catch2/catch.hpp>
+
+#ifdef LZ_HAS_RANGES
+#    include <Lz/Generator.hpp>
+#    include <algorithm>
+#    include <list>
+#    include <ranges>
+#    include <vector>
+
+namespace {
+auto timesTwo = [](int i) {
+    return i * 2;
+};
+
+auto isEven = [](int i) {
+    return i % 2 == 0;
+};
+
+using Vector = std::vector<int>;
+using List = std::list<int>;
+
+using MapView = decltype(lz::map(std::declval<Vector&>(), timesTwo));
+using FilterView = decltype(lz::filter(std::declval<Vector&>(), isEven));
+using ZipView = decltype(lz::zip(std::declval<Vector&>(), std::declval<Vector&>()));
+using EnumerateView = decltype(lz::enumerate(std::declval<Vector&>()));
+using ChunksView = decltype(lz::chunks(std::declval<Vector&>(), 2));
+using ConcatView = decltype(lz::concat(std::declval<Vector&>(), std::declval<Vector&>()));
+using RotateView = decltype(lz::rotate(std::declval<Vector&>(), 1));
+using TakeView = decltype(lz::take(std::declval<Vector&>(), 2));
+using RangeView = decltype(lz::range(10));
+using MapListView = decltype(lz::map(std::declval<List&>(), timesTwo));
+using IterView = decltype(lz::toIter(std::declval<Vector&>()));
+using ConcatAllView = decltype(lz::concatAll(std::declval<std::vector<Vector>&>()));
+} // namespace
+
+static_assert(std::ranges::random_access_range<MapView> && std::ranges::view<MapView>);
+static_assert(std::ranges::random_access_range<ZipView> && std::ranges::view<ZipView>);
+static_assert(std::ranges::random_access_range<EnumerateView> && std::ranges::view<EnumerateView>);
+static_assert(std::ranges::random_access_range<ChunksView> && std::ranges::view<ChunksView>);
+static_assert(std::ranges::random_access_range<ConcatView> && std::ranges::view<ConcatView>);
+static_assert(std::ranges::random_access_range<RotateView> && std::ranges::view<RotateView>);
+static_assert(std::ranges::random_access_range<RangeView> && std::ranges::view<RangeView>);
+static_assert(std::ranges::random_access_range<ConcatAllView> && std::ranges::sized_range<ConcatAllView>);
+static_assert(std::ranges::forward_range<FilterView> && std::ranges::view<FilterView>);
+static_assert(std::ranges::bidirectional_range<MapListView> && std::ranges::view<MapListView>);
+static_assert(std::ranges::contiguous_range<TakeView> && std::ranges::contiguous_range<IterView>);
+
+static_assert(std::ranges::borrowed_range<MapView> && std::ranges::borrowed_range<FilterView>);
+#    ifdef __cpp_lib_coroutine
+static_assert(std::ranges::view<lz::Generator<int>> && !std::ranges::borrowed_range<lz::Generator<int>>);
+#    endif // __cpp_lib_coroutine
+
+static_assert(std::ranges::sized_range<MapView> && std::ranges::sized_range<ZipView>);
+static_assert(!std::ranges::sized_range<FilterView> && !std::ranges::sized_range<MapListView>);
+static_assert(!std::sized_sentinel_for<std::ranges::iterator_t<MapListView>, std::ranges::iterator_t<MapListView>>);
+
+TEST_CASE("Ranges interoperability", "[Ranges][Basic functionality]") {
+    Vector vec = { 1, 2, 3, 4, 5, 6 };
+
+    SECTION("Should not be wrapped by std::views::all") {
+        auto mapped = lz::map(vec, timesTwo);
+        static_assert(std::is_same_v<std::views::all_t<decltype(mapped)&>, MapView>);
+        static_assert(std::is_same_v<std::views::all_t<decltype(mapped)>, MapView>);
+    }
+
+    SECTION("Should compose with std::views") {
+        auto pipeline = lz::filter(vec, isEven) | std::views::transform(timesTwo) | std::views::take(2);
+        CHECK(std::ranges::equal(pipeline, Vector{ 4, 8 }));
+
+        auto reversed = lz::map(vec, timesTwo) | std::views::reverse;
+        CHECK(std::ranges::equal(reversed, Vector{ 12, 10, 8, 6, 4, 2 }));
+
+        CHECK(std::ranges::equal(lz::map(vec, timesTwo) | std::views::drop(4), Vector{ 10, 12 }));
+    }
+
+    SECTION("Should work with std::ranges algorithms") {
+        auto zipped = lz::zip(vec, lz::range(6));
+        CHECK(std::ranges::distance(zipped) == 6);
+        CHECK(std::ranges::size(lz::map(vec, timesTwo)) == 6);
+        CHECK(std::ranges::distance(lz::filter(vec, isEven)) == 3);
+
+        Vector copied(3);
+        std::ranges::copy(lz::take(vec, 3), copied.begin());
+        CHECK(copied == Vector{ 1, 2, 3 });
+
+        std::ranges::sort(lz::rotate(vec, 2));
+        CHECK(vec == Vector{ 5, 6, 1, 2, 3, 4 });
+    }
+
+    SECTION("Should not dangle when the view is a temporary") {
+        auto found = std::ranges::find(lz::map(vec, timesTwo), 8);
+        static_assert(!std::is_same_v<decltype(found), std::ranges::dangling>);
+        CHECK(*found == 8);
+    }
+
+    SECTION("Should have random access iterators from both sides") {
+        auto mapped = lz::map(vec, timesTwo);
+        CHECK(2 + mapped.begin() == mapped.begin() + 2);
+        CHECK(*(1 + lz::range(10).begin()) == 1);
+    }
+}
+#endif // LZ_HAS_RANGES
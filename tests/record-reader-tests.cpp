@@ -0,0 +1,106 @@
+#include <Lz/RecordReader.hpp>
+#include <catch2/catch.hpp>
+#include <cstdio>
+#include <sstream>
+#include <vector>
+
+#ifndef _WIN32
+#    include <unistd.h>
+#endif // _WIN32
+
+namespace {
+template<class Iterable>
+std::vector<std::string> toStrings(Iterable&& iterable) {
+    std::vector<std::string> result;
+    for (auto&& s : iterable) {
+        result.emplace_back(s.data(), s.size());
+    }
+    return result;
+}
+} // namespace
+
+TEST_CASE("Reading records from a stream", "[Record reader][Basic functionality]") {
+    SECTION("Records within and across blocks") {
+        for (std::size_t blockSize : { 1, 3, 4, 1024 }) {
+            std::istringstream stream("one\ntwo\n\nthree long record\nlast");
+            CHECK(toStrings(lz::readRecords(stream, '\n', blockSize)) ==
+                  std::vector<std::string>{ "one", "two", "", "three long record", "last" });
+        }
+    }
+
+    SECTION("Trailing separator and empty streams") {
+        std::istringstream trailing("a;b;");
+        CHECK(toStrings(lz::readRecords(trailing, ';', 2)) == std::vector<std::string>{ "a", "b" });
+        std::istringstream empty;
+        auto records = lz::readRecords(empty);
+        CHECK(records.begin() == records.end());
+    }
+
+    SECTION("Keeping records") {
+        std::istringstream stream("x\ny\nz");
+        auto records = lz::readRecords<std::string>(stream, '\n', 2);
+        const std::vector<std::string> kept(records.begin(), records.end());
+        CHECK(kept == std::vector<std::string>{ "x", "y", "z" });
+    }
+}
+
+#ifndef _WIN32
+TEST_CASE("Reading records from a file descriptor", "[Record reader][File descriptor]") {
+    int fileDescriptors[2];
+    REQUIRE(::pipe(fileDescriptors) == 0);
+    const std::string data = "first\nsecond\nthird\n";
+    REQUIRE(::write(fileDescriptors[1], data.data(), data.size()) == static_cast<ssize_t>(data.size()));
+    ::close(fileDescriptors[1]);
+    CHECK(toStrings(lz::readRecords(fileDescriptors[0], '\n', 4)) == std::vector<std::string>{ "first", "second", "third" });
+    ::close(fileDescriptors[0]);
+}
+#endif // _WIN32
+
+#ifndef _WIN32
+TEST_CASE("Reading records from a file with reads in flight", "[Record reader][Read ahead]") {
+    std::FILE* file = std::tmpfile();
+    REQUIRE(file != nullptr);
+    std::string data;
+    std::vector<std::string> expected;
+    for (int i = 0; i < 5000; ++i) {
+        expected.push_back("record " + std::to_string(i));
+        data += expected.back();
+        data += '\n';
+    }
+    REQUIRE(std::fwrite(data.data(), 1, data.size(), file) == data.size());
+    REQUIRE(std::fflush(file) == 0);
+    const int fileDescriptor = ::fileno(file);
+
+    SECTION("Blocks smaller and larger than records") {
+        for (std::size_t blockSize : { 5, 64, 4096, 1 << 20 }) {
+            REQUIRE(::lseek(fileDescriptor, 0, SEEK_SET) == 0);
+            CHECK(toStrings(lz::readRecordsAsync(fileDescriptor, '\n', blockSize, 4)) == expected);
+        }
+    }
+
+    SECTION("From the current offset") {
+        REQUIRE(::lseek(fileDescriptor, static_cast<off_t>(expected.front().size() + 1), SEEK_SET) > 0);
+        const auto records = toStrings(lz::readRecordsAsync(fileDescriptor, '\n', 100, 3));
+        CHECK(records == std::vector<std::string>(expected.begin() + 1, expected.end()));
+    }
+
+    SECTION("Stopping early") {
+        REQUIRE(::lseek(fileDescriptor, 0, SEEK_SET) == 0);
+        auto records = lz::readRecordsAsync(fileDescriptor, '\n', 16, 8);
+        CHECK(std::string(records.begin()->data(), records.begin()->size()) == "record 0");
+    }
+
+    SECTION("Pipes are read one block at a time") {
+        int fileDescriptors[2];
+        REQUIRE(::pipe(fileDescriptors) == 0);
+        const std::string piped = "first\nsecond\nthird\n";
+        REQUIRE(::write(fileDescriptors[1], piped.data(), piped.size()) == static_cast<ssize_t>(piped.size()));
+        ::close(fileDescriptors[1]);
+        CHECK(toStrings(lz::readRecordsAsync(fileDescriptors[0], '\n', 4)) ==
+              std::vector<std::string>{ "first", "second", "third" });
+        ::close(fileDescriptors[0]);
+    }
+
+    std::fclose(file);
+}
+#endif // _WIN32
@@ -1,4 +1,6 @@
+#include <Lz/Concatenate.hpp>
 #include <Lz/Repeat.hpp>
+#include <Lz/Take.hpp>
 #include <array>
 #include <catch2/catch.hpp>
 #include <list>
@@ -22,6 +24,26 @@ TEST_CASE("Repeat changing and creating elements", "[Repeat][Basic functionality
     }
 }
 
+TEST_CASE("Repeat while true", "[Repeat][Basic functionality]") {
+    auto repeater = lz::repeat(20);
+    auto it = repeater.begin();
+    CHECK(it != repeater.end());
+    std::advance(it, 1000);
+    CHECK(it != repeater.end());
+    CHECK(*it == 20);
+
+    std::size_t counter = 0;
+    for (int i : repeater) {
+        CHECK(i == 20);
+        if (++counter == 100) {
+            break;
+        }
+    }
+    CHECK(counter == 100);
+    CHECK(lz::take(repeater, 3).toVector() == std::vector<int>{ 20, 20, 20 });
+    CHECK(repeater.end() - repeater.begin() > 0);
+}
+
 TEST_CASE("Repeat binary operations", "[Repeat][Binary ops]") {
     const int amount = 5;
     auto repeater = lz::repeat(20, amount);
@@ -100,6 +122,15 @@ TEST_CASE("Repeat to containers", "[Repeat][To container]") {
         CHECK(lst.size() == times);
     }
 
+    SECTION("To string and padded vector") {
+        CHECK(lz::repeat('x', 3).to<std::string>() == "xxx");
+        std::vector<int> values = { 1, 2, 3 };
+        std::vector<int> padded = lz::concat(values, lz::repeat(0, 5)).toVector();
+        CHECK(padded == std::vector<int>{ 1, 2, 3, 0, 0, 0, 0, 0 });
+        std::vector<int> prefilled = repeater.to<std::vector<int>>(std::size_t{ 2 });
+        CHECK(prefilled == std::vector<int>{ 20, 20, 20, 20, 20, 0, 0 });
+    }
+
     SECTION("To map") {
         std::map<int, int> actual = repeater.toMap([](const int i) { return i; });
         std::map<int, int> expected;
@@ -0,0 +1,129 @@
+#include "Lz/Map.hpp"
+#include "Lz/RingBuffer.hpp"
+
+#include <catch2/catch.hpp>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+TEST_CASE("SPSC ring buffer", "[RingBuffer][Basic functionality]") {
+    lz::SpscRingBuffer<int> ring(6);
+    CHECK(ring.capacity() == 8);
+    CHECK(ring.empty());
+
+    SECTION("Push and pop") {
+        for (int i = 0; i < 8; ++i) {
+            CHECK(ring.tryPush(i));
+        }
+        CHECK_FALSE(ring.tryPush(8));
+        CHECK(ring.size() == 8);
+        int value = -1;
+        CHECK(ring.tryPop(value));
+        CHECK(value == 0);
+        CHECK(ring.tryPush(8));
+        CHECK(ring.readable().toVector() == std::vector<int>{ 1, 2, 3, 4, 5, 6, 7, 8 });
+    }
+
+    SECTION("Readable view over the wrap around") {
+        std::vector<int> values = { 1, 2, 3, 4, 5, 6 };
+        CHECK(ring.tryPushRange(values.begin(), values.end()) == values.end());
+        ring.consume(5);
+        CHECK(ring.tryPushRange(values.begin(), values.end()) == values.end());
+        auto pending = ring.readable();
+        CHECK(pending.size() == 7);
+        CHECK(pending.toVector() == std::vector<int>{ 6, 1, 2, 3, 4, 5, 6 });
+        CHECK(lz::map(pending, [](const int i) { return i * 2; }).toVector() ==
+              std::vector<int>{ 12, 2, 4, 6, 8, 10, 12 });
+        ring.consume(pending.size());
+        CHECK(ring.empty());
+        CHECK(ring.readable().toVector().empty());
+    }
+
+    SECTION("Writable view") {
+        auto free = ring.writable();
+        CHECK(free.size() == 8);
+        std::iota(free.begin(), free.end(), 10);
+        ring.produce(3);
+        CHECK(ring.readable().toVector() == std::vector<int>{ 10, 11, 12 });
+        CHECK(ring.writable().size() == 5);
+    }
+
+    SECTION("Pushing more than fits") {
+        std::vector<int> values(12, 1);
+        CHECK(ring.tryPushRange(values.begin(), values.end()) == values.begin() + 8);
+        CHECK(ring.writable().size() == 0);
+    }
+}
+
+TEST_CASE("SPSC ring buffer between threads", "[RingBuffer][Basic functionality]") {
+    constexpr int count = 100000;
+    lz::SpscRingBuffer<int> ring(256);
+    long long sum = 0;
+    int received = 0;
+    std::thread consumer([&] {
+        while (received != count) {
+            auto pending = ring.readable();
+            for (const int value : pending) {
+                sum += value;
+            }
+            received += static_cast<int>(pending.size());
+            ring.consume(pending.size());
+        }
+    });
+    for (int i = 0; i < count;) {
+        if (ring.tryPush(i)) {
+            ++i;
+        }
+    }
+    consumer.join();
+    CHECK(sum == static_cast<long long>(count) * (count - 1) / 2);
+}
+
+TEST_CASE("MPMC queue", "[RingBuffer][Basic functionality]") {
+    lz::MpmcQueue<int> queue(4);
+    CHECK(queue.capacity() == 4);
+
+    SECTION("Push and pop") {
+        for (int i = 0; i < 4; ++i) {
+            CHECK(queue.tryPush(i));
+        }
+        CHECK_FALSE(queue.tryPush(4));
+        std::vector<int> out;
+        CHECK(queue.tryPopInto(std::back_inserter(out), 3) == 3);
+        CHECK(out == std::vector<int>{ 0, 1, 2 });
+        int value = -1;
+        CHECK(queue.tryPop(value));
+        CHECK(value == 3);
+        CHECK_FALSE(queue.tryPop(value));
+    }
+
+    SECTION("Several producers and consumers") {
+        constexpr int perProducer = 20000;
+        lz::MpmcQueue<int> shared(128);
+        std::atomic<long long> sum{ 0 };
+        std::atomic<int> received{ 0 };
+        std::vector<std::thread> threads;
+        for (int p = 0; p < 2; ++p) {
+            threads.emplace_back([&shared] {
+                for (int i = 1; i <= perProducer;) {
+                    if (shared.tryPush(i)) {
+                        ++i;
+                    }
+                }
+            });
+            threads.emplace_back([&] {
+                int value = 0;
+                while (received.load() != 2 * perProducer) {
+                    if (shared.tryPop(value)) {
+                        sum += value;
+                        ++received;
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        CHECK(sum == 2LL * perProducer * (perProducer + 1) / 2);
+    }
+}
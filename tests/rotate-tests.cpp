@@ -1,4 +1,5 @@
 #include "Lz/FunctionTools.hpp"
+#include "Lz/Lz.hpp"
 #include "Lz/Rotate.hpp"
 
 #include <catch2/catch.hpp>
@@ -156,3 +157,34 @@ TEST_CASE("Rotate to containers", "[Rotate][To container]") {
         CHECK(map == std::unordered_map<int, int>{ { 3, 3 }, { 4, 4 }, { 5, 5 }, { 6, 6 }, { 1, 1 }, { 2, 2 } });
     }
 }
+
+TEST_CASE("Rotate as two segments", "[Rotate][Basic functionality]") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5, 6 };
+
+    SECTION("All rotations") {
+        for (std::ptrdiff_t count = 0; count <= 6; ++count) {
+            std::vector<int> expected = vec;
+            std::rotate(expected.begin(), expected.begin() + count % 6, expected.end());
+            auto rotator = lz::rotate(vec, count);
+            CHECK(rotator.toVector() == expected);
+            std::vector<int> copied;
+            rotator.copyTo(std::back_inserter(copied));
+            CHECK(copied == expected);
+            CHECK(lz::reduce(rotator, 0, std::plus<int>()) == 21);
+        }
+    }
+
+    SECTION("Parts of a rotation") {
+        auto rotator = lz::rotate(vec, 4);
+        auto begin = rotator.begin();
+        CHECK(lz::toIterRange(begin + 1, begin + 4).toVector() == std::vector<int>{ 6, 1, 2 });
+        CHECK(lz::toIterRange(begin + 3, begin + 5).toVector() == std::vector<int>{ 2, 3 });
+        CHECK(lz::toIterRange(begin + 2, begin + 2).toVector().empty());
+    }
+
+    SECTION("Stopping early") {
+        auto rotator = lz::rotate(vec, 3);
+        CHECK(lz::contains(rotator, 2));
+        CHECK_FALSE(lz::contains(rotator, 7));
+    }
+}
@@ -0,0 +1,102 @@
+#include <Lz/Lz.hpp>
+#include <Lz/RunLength.hpp>
+#include <catch2/catch.hpp>
+#include <forward_list>
+#include <string>
+#include <tuple>
+#include <vector>
+
+TEST_CASE("Rle basic functionality", "[Rle][Basic functionality]") {
+    std::vector<int> values = { 1, 1, 1, 2, 3, 3, 1 };
+    using Runs = std::vector<std::pair<int, std::size_t>>;
+
+    SECTION("Should yield every run with its length") {
+        CHECK(lz::rle(values).toVector() == Runs{ { 1, 3 }, { 2, 1 }, { 3, 2 }, { 1, 1 } });
+        std::vector<int> empty;
+        CHECK(lz::rle(empty).toVector().empty());
+        CHECK(lz::rle(std::vector<int>{ 4, 4 }).toVector() == Runs{ { 4, 2 } });
+    }
+
+    SECTION("Should refer to the first element of a run") {
+        auto runs = lz::rle(values);
+        auto it = runs.begin();
+        ++it;
+        CHECK(&it->first == &values[3]);
+        it->first = 20;
+        CHECK(values[3] == 20);
+    }
+
+    SECTION("Should count runs of forward iterators") {
+        std::forward_list<char> list = { 'a', 'b', 'b', 'b', 'c', 'c' };
+        CHECK(lz::rle(list).toVector() == std::vector<std::pair<char, std::size_t>>{ { 'a', 1 }, { 'b', 3 }, { 'c', 2 } });
+    }
+
+    SECTION("With a custom comparer") {
+        std::vector<std::string> words = { "a", "b", "cd", "ef", "g" };
+        auto runs = lz::rle(words, [](const std::string& a, const std::string& b) { return a.size() == b.size(); });
+        CHECK(runs.toVector() == std::vector<std::pair<std::string, std::size_t>>{ { "a", 2 }, { "cd", 2 }, { "g", 1 } });
+    }
+}
+
+TEST_CASE("Unrle basic functionality", "[Unrle][Basic functionality]") {
+    std::vector<std::pair<char, int>> runs = { { 'a', 3 }, { 'b', 0 }, { 'c', 1 }, { 'd', 2 }, { 'e', 0 } };
+    auto expanded = lz::unrle(runs);
+
+    SECTION("Should expand every run and skip empty runs") {
+        CHECK(expanded.toString() == "aaacdd");
+        CHECK(expanded.distance() == 6);
+        std::vector<std::pair<char, int>> empty = { { 'a', 0 } };
+        CHECK(lz::unrle(empty).begin() == lz::unrle(empty).end());
+    }
+
+    SECTION("Should be by reference") {
+        *expanded.begin() = 'z';
+        CHECK(runs[0].first == 'z');
+    }
+
+    SECTION("Should accept tuples") {
+        std::vector<std::tuple<int, std::size_t>> tuples = { std::make_tuple(1, 2), std::make_tuple(2, 1) };
+        CHECK(lz::unrle(tuples).toVector() == std::vector<int>{ 1, 1, 2 });
+    }
+
+    SECTION("Should fill copyTo destinations") {
+        std::string copied(6, ' ');
+        expanded.copyTo(copied.begin());
+        CHECK(copied == "aaacdd");
+
+        std::vector<char> vec = expanded.toVector();
+        CHECK(vec == std::vector<char>{ 'a', 'a', 'a', 'c', 'd', 'd' });
+
+        auto it = expanded.begin();
+        ++it;
+        std::vector<char> tail;
+        lz::IterView<decltype(it)>(it, expanded.end()).copyTo(std::back_inserter(tail));
+        CHECK(tail == std::vector<char>{ 'a', 'a', 'c', 'd', 'd' });
+    }
+
+    SECTION("Should be usable in push based loops") {
+        CHECK(lz::toIter(expanded).count('d') == 2);
+        CHECK(lz::toIter(expanded).countIf([](char c) { return c != 'c'; }) == 5);
+        CHECK(lz::indexOf(expanded, 'c') == 3);
+    }
+}
+
+TEST_CASE("Rle round trip", "[Rle][Unrle]") {
+    std::vector<unsigned char> status(1000);
+    for (std::size_t i = 0; i != status.size(); ++i) {
+        status[i] = static_cast<unsigned char>(i / 37 % 3);
+    }
+
+    auto runs = lz::rle(status);
+    CHECK(runs.distance() == 28);
+    CHECK(lz::unrle(runs).toVector() == status);
+    CHECK(lz::toIter(status).rle().unrle().toVector() == status);
+
+    std::vector<unsigned char> copied(status.size());
+    lz::unrle(runs).copyTo(copied.begin());
+    CHECK(copied == status);
+
+    std::vector<int> repeated(5);
+    lz::repeat(7, 5).copyTo(repeated.begin());
+    CHECK(repeated == std::vector<int>{ 7, 7, 7, 7, 7 });
+}
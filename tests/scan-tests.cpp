@@ -0,0 +1,139 @@
+#include "Lz/Scan.hpp"
+
+#include <catch2/catch.hpp>
+#include <limits>
+#include <list>
+#include <numeric>
+#include <sstream>
+#include <string>
+
+TEST_CASE("Scan changing and creating elements", "[Scan][Basic functionality]") {
+    std::vector<int> v = { 1, 2, 3, 4 };
+
+    SECTION("Inclusive") {
+        auto scan = lz::inclusiveScan(v);
+        CHECK(scan.toVector() == std::vector<int>{ 1, 3, 6, 10 });
+        CHECK(scan.size() == 4);
+        CHECK(lz::inclusiveScan(v, std::multiplies<int>()).toVector() == std::vector<int>{ 1, 2, 6, 24 });
+    }
+
+    SECTION("Exclusive") {
+        auto scan = lz::exclusiveScan(v, 0);
+        CHECK(scan.toVector() == std::vector<int>{ 0, 1, 3, 6 });
+        CHECK(scan.size() == 4);
+        CHECK(lz::exclusiveScan(v, std::string(), [](std::string s, int i) { return s += std::to_string(i); }).toVector() ==
+              std::vector<std::string>{ "", "1", "12", "123" });
+    }
+
+    SECTION("Empty") {
+        std::vector<int> empty;
+        CHECK(lz::inclusiveScan(empty).begin() == lz::inclusiveScan(empty).end());
+        CHECK(lz::exclusiveScan(empty, 5).toVector().empty());
+    }
+
+    SECTION("Input and forward iterables") {
+        std::istringstream stream("1 2 3");
+        auto fromStream = lz::inclusiveScanRange(std::istream_iterator<int>(stream), std::istream_iterator<int>());
+        CHECK(fromStream.toVector() == std::vector<int>{ 1, 3, 6 });
+
+        std::list<int> list = { 4, 3, 2 };
+        CHECK(lz::exclusiveScan(list, 1).toVector() == std::vector<int>{ 1, 5, 8 });
+    }
+}
+
+TEST_CASE("Scan binary operations", "[Scan][Binary ops]") {
+    std::vector<int> v = { 1, 2, 3 };
+    auto scan = lz::inclusiveScan(v);
+    auto begin = scan.begin();
+
+    SECTION("Operator++") {
+        CHECK(*begin == 1);
+        ++begin;
+        CHECK(*begin == 3);
+        CHECK(*begin++ == 3);
+        CHECK(*begin == 6);
+        ++begin;
+        CHECK(begin == scan.end());
+    }
+
+    SECTION("Operator== & operator!=") {
+        CHECK(begin != scan.end());
+        CHECK(begin == scan.begin());
+    }
+}
+
+TEST_CASE("Parallel scan", "[Scan][Basic functionality]") {
+    std::vector<long long> values(100000);
+    std::iota(values.begin(), values.end(), -500LL);
+    const auto pool = lz::execution::pool(4);
+
+    SECTION("Inclusive") {
+        std::vector<long long> expected(values.size());
+        std::partial_sum(values.begin(), values.end(), expected.begin());
+        std::vector<long long> out(values.size());
+        CHECK(lz::inclusiveScanTo(values, out.begin(), std::plus<long long>(), pool) == out.end());
+        CHECK(out == expected);
+        CHECK(lz::inclusiveScan(values).toVector() == expected);
+
+        std::list<long long> list(values.begin(), values.end());
+        std::fill(out.begin(), out.end(), 0);
+        lz::inclusiveScanTo(list, out.begin(), std::plus<long long>(), pool);
+        CHECK(out == expected);
+    }
+
+    SECTION("Exclusive") {
+        std::vector<long long> expected(values.size());
+        long long sum = 7;
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            expected[i] = sum;
+            sum += values[i];
+        }
+        std::vector<long long> out(values.size());
+        CHECK(lz::exclusiveScanTo(values, out.begin(), 7LL, std::plus<long long>(), pool) == out.end());
+        CHECK(out == expected);
+        CHECK(lz::exclusiveScan(values, 7LL).toVector() == expected);
+    }
+
+    SECTION("Sums in the type of the initial value") {
+        const std::vector<int> large(20000, (std::numeric_limits<int>::max)());
+        std::vector<long long> expected(large.size());
+        for (std::size_t i = 0; i < large.size(); ++i) {
+            expected[i] = static_cast<long long>(i) * (std::numeric_limits<int>::max)();
+        }
+        std::vector<long long> out(large.size());
+        lz::exclusiveScanTo(large, out.begin(), 0LL, std::plus<long long>(), pool);
+        CHECK(out == expected);
+#ifndef LZ_HAS_CXX_11
+        std::fill(out.begin(), out.end(), 0);
+        lz::exclusiveScanTo(large, out.begin(), 0LL, std::plus<>(), pool);
+        CHECK(out == expected);
+#endif
+    }
+
+    SECTION("Associative, non commutative operations") {
+        std::vector<std::string> words(5000);
+        for (std::size_t i = 0; i < words.size(); ++i) {
+            words[i] = std::to_string(i % 10);
+        }
+        const auto append = [](std::string a, const std::string& b) {
+            return a += b;
+        };
+        std::vector<std::string> out(words.size());
+        lz::inclusiveScanTo(words, out.begin(), append, pool);
+        CHECK(out == lz::inclusiveScan(words, append).toVector());
+        lz::exclusiveScanTo(words, out.begin(), std::string("x"), append, pool);
+        CHECK(out == lz::exclusiveScan(words, std::string("x"), append).toVector());
+    }
+
+    SECTION("Small and empty") {
+        std::vector<long long> empty;
+        std::vector<long long> out(1);
+        CHECK(lz::inclusiveScanTo(empty, out.begin(), std::plus<long long>(), pool) == out.begin());
+        CHECK(lz::exclusiveScanTo(empty, out.begin(), 1LL, std::plus<long long>(), pool) == out.begin());
+        std::vector<long long> one = { 3 };
+        lz::exclusiveScanTo(one, out.begin(), 1LL, std::plus<long long>(), pool);
+        CHECK(out[0] == 1);
+        lz::inclusiveScanTo(one, out.begin(), std::plus<long long>(), pool);
+        CHECK(out[0] == 3);
+    }
+}
@@ -0,0 +1,137 @@
+#include <Lz/SetOperations.hpp>
+#include <algorithm>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <deque>
+#include <forward_list>
+#include <iterator>
+#include <list>
+
+namespace {
+template<class Iterable>
+std::vector<int> toInts(const Iterable& iterable) {
+    return std::vector<int>(iterable.begin(), iterable.end());
+}
+} // namespace
+
+TEST_CASE("Set operations changing and creating elements", "[SetOperations][Basic functionality]") {
+    std::vector<int> a = { 1, 2, 2, 2, 4, 6, 8, 9 };
+    std::vector<int> b = { 2, 2, 3, 4, 4, 9, 10 };
+
+    SECTION("Should behave like the std::set_* algorithms") {
+        std::vector<int> expected;
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        CHECK(toInts(lz::setIntersection(a, b)) == expected);
+        expected.clear();
+        std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        CHECK(toInts(lz::setUnion(a, b)) == expected);
+        expected.clear();
+        std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        CHECK(toInts(lz::setDifference(a, b)) == expected);
+        expected.clear();
+        std::set_symmetric_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        CHECK(toInts(lz::setSymmetricDifference(a, b)) == expected);
+    }
+
+    SECTION("Should work with forward iterators") {
+        std::forward_list<int> fa(a.begin(), a.end());
+        std::list<int> lb(b.begin(), b.end());
+        CHECK(toInts(lz::setIntersection(fa, lb)) == std::vector<int>{ 2, 2, 4, 9 });
+        CHECK(toInts(lz::setDifference(fa, lb)) == std::vector<int>{ 1, 2, 6, 8 });
+    }
+
+    SECTION("Should handle empty sequences") {
+        std::vector<int> none;
+        CHECK(lz::setIntersection(a, none).begin() == lz::setIntersection(a, none).end());
+        CHECK(toInts(lz::setUnion(none, b)) == b);
+        CHECK(toInts(lz::setDifference(a, none)) == a);
+        CHECK(toInts(lz::setSymmetricDifference(none, b)) == b);
+        auto empty = lz::setUnion(none, none);
+        CHECK(empty.begin() == empty.end());
+    }
+
+    SECTION("Should use the compare function") {
+        std::vector<int> descA = { 9, 7, 5, 3 };
+        std::vector<int> descB = { 8, 7, 3, 1 };
+        CHECK(toInts(lz::setIntersection(descA, descB, std::greater<int>())) == std::vector<int>{ 7, 3 });
+        CHECK(toInts(lz::setUnion(descA, descB, std::greater<int>())) == std::vector<int>{ 9, 8, 7, 5, 3, 1 });
+    }
+
+    SECTION("Should yield references to the first sequence") {
+        for (int& i : lz::setIntersection(a, b)) {
+            i = 0;
+        }
+        CHECK(a == std::vector<int>{ 1, 0, 0, 2, 0, 6, 8, 0 });
+    }
+}
+
+TEST_CASE("Set operations galloping", "[SetOperations][Basic functionality]") {
+    std::vector<std::uint32_t> common;
+    for (std::uint32_t i = 0; i < 5000; i += 3) {
+        common.push_back(i);
+    }
+    std::vector<std::uint32_t> rare = { 0, 1, 3, 299, 300, 3000, 4998, 4999, 6000 };
+
+    const auto check = [](const std::vector<std::uint32_t>& x, const std::vector<std::uint32_t>& y) {
+        std::vector<std::uint32_t> expected;
+        std::set_intersection(x.begin(), x.end(), y.begin(), y.end(), std::back_inserter(expected));
+        CHECK(lz::setIntersection(x, y).toVector() == expected);
+        expected.clear();
+        std::set_difference(x.begin(), x.end(), y.begin(), y.end(), std::back_inserter(expected));
+        CHECK(lz::setDifference(x, y).toVector() == expected);
+    };
+
+    SECTION("Should skip through a long contiguous sequence") {
+        check(rare, common);
+        check(common, rare);
+        CHECK(lz::setIntersection(rare, common).toVector() == std::vector<std::uint32_t>{ 0, 3, 300, 3000, 4998 });
+    }
+
+    SECTION("Should skip through every distance") {
+        for (std::uint32_t step = 1; step < 200; step += 7) {
+            std::vector<std::uint32_t> sparse;
+            for (std::uint32_t i = 1; i < 5000; i += step * step) {
+                sparse.push_back(i);
+            }
+            check(sparse, common);
+            check(common, sparse);
+        }
+    }
+
+    SECTION("Should skip through a random access sequence that is not contiguous") {
+        std::deque<int> ints(common.begin(), common.end());
+        std::vector<int> lookups = { 3, 4, 4000, 4002 };
+        CHECK(toInts(lz::setIntersection(lookups, ints)) == std::vector<int>{ 3, 4002 });
+        CHECK(toInts(lz::setDifference(lookups, ints)) == std::vector<int>{ 4, 4000 });
+    }
+}
+
+TEST_CASE("Set operations binary operations", "[SetOperations][Binary ops]") {
+    std::vector<int> a = { 1, 3, 5 };
+    std::vector<int> b = { 2, 3, 4 };
+    auto unified = lz::setUnion(a, b);
+    auto it = unified.begin();
+
+    SECTION("Operator++") {
+        CHECK(*it == 1);
+        ++it;
+        CHECK(*it == 2);
+        ++it;
+        CHECK(*it == 3);
+        ++it;
+        CHECK(*it == 4);
+        ++it;
+        CHECK(*it == 5);
+        ++it;
+        CHECK(it == unified.end());
+    }
+
+    SECTION("Operator== & operator!=") {
+        CHECK(it == unified.begin());
+        CHECK(it != unified.end());
+        it++;
+        CHECK(it != unified.begin());
+        CHECK(std::distance(unified.begin(), unified.end()) == 5);
+        CHECK(std::distance(lz::setIntersection(a, b).begin(), lz::setIntersection(a, b).end()) == 1);
+    }
+}
@@ -0,0 +1,72 @@
+#include "Lz/Map.hpp"
+#include "Lz/Statistics.hpp"
+
+#include <catch2/catch.hpp>
+#include <list>
+#include <numeric>
+#include <vector>
+
+TEST_CASE("Statistics of a sequence", "[Statistics][Basic functionality]") {
+    std::vector<int> values = { 2, 4, 4, 4, 5, 5, 7, 9 };
+
+    SECTION("All statistics at once") {
+        const auto statistics = lz::stats(values);
+        CHECK(statistics.count() == 8);
+        CHECK(statistics.sum() == 40);
+        CHECK(statistics.minimum() == 2);
+        CHECK(statistics.maximum() == 9);
+        CHECK(statistics.mean() == Approx(5));
+        CHECK(statistics.variance() == Approx(4));
+        CHECK(statistics.sampleVariance() == Approx(32. / 7.));
+        CHECK(statistics.standardDeviation() == Approx(2));
+    }
+
+    SECTION("Chains are evaluated once") {
+        int calls = 0;
+        auto map = lz::map(values, [&calls](const int i) {
+            ++calls;
+            return i * 2;
+        });
+        const auto statistics = lz::stats(map);
+        CHECK(calls == 8);
+        CHECK(statistics.maximum() == 18);
+        CHECK(statistics.mean() == Approx(10));
+    }
+
+    SECTION("Empty") {
+        const auto statistics = lz::stats(std::vector<double>());
+        CHECK(statistics.empty());
+        CHECK(statistics.sum() == 0);
+        CHECK(statistics.mean() == 0);
+        CHECK(statistics.variance() == 0);
+    }
+
+    SECTION("Merging") {
+        lz::Statistics<int> first = lz::stats(std::vector<int>{ 2, 4, 4 });
+        first.merge(lz::stats(std::list<int>{ 4, 5, 5, 7, 9 }));
+        first.merge(lz::Statistics<int>());
+        CHECK(first.count() == 8);
+        CHECK(first.minimum() == 2);
+        CHECK(first.maximum() == 9);
+        CHECK(first.variance() == Approx(4));
+    }
+}
+
+TEST_CASE("Statistics on a thread pool", "[Statistics][Basic functionality]") {
+    std::vector<double> values(100000);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = 1e9 + static_cast<double>(i % 100);
+    }
+    const auto expected = lz::stats(values);
+    CHECK(expected.variance() == Approx(833.25));
+
+    const auto parallel = lz::stats(values, lz::execution::pool(4));
+    CHECK(parallel.count() == expected.count());
+    CHECK(parallel.minimum() == expected.minimum());
+    CHECK(parallel.maximum() == expected.maximum());
+    CHECK(parallel.mean() == Approx(expected.mean()));
+    CHECK(parallel.variance() == Approx(expected.variance()));
+
+    std::list<double> list(values.begin(), values.end());
+    CHECK(lz::stats(list, lz::execution::pool(4)).variance() == Approx(833.25));
+}
@@ -1,7 +1,9 @@
 #include <Lz/StringSplitter.hpp>
 #include <catch2/catch.hpp>
 #include <fmt/format.h>
+#include <array>
 #include <list>
+#include <vector>
 
 TEST_CASE("String splitter changing and creating elements", "[String splitter][Basic functionality]") {
     const std::string toSplit = "Hello  world  test  123  ";
@@ -137,3 +139,120 @@ TEST_CASE("String splitter to containers", "[String splitter][To container]") {
         CHECK(actual == expected);
     }
 }
+
+namespace {
+std::vector<std::string> splitWithFind(const std::string& string, const std::string& delimiter) {
+    std::vector<std::string> result;
+    std::size_t current = 0;
+    for (std::size_t pos = string.find(delimiter); pos != std::string::npos; pos = string.find(delimiter, current)) {
+        result.push_back(string.substr(current, pos - current));
+        current = pos + delimiter.size();
+    }
+    if (current != string.size()) {
+        result.push_back(string.substr(current));
+    }
+    return result;
+}
+} // namespace
+
+TEST_CASE("String splitter over dense and sparse delimiters", "[String splitter][Delimiter scanning]") {
+    std::string toSplit;
+    for (std::size_t i = 0; i < 300; ++i) {
+        // Token lengths go from empty to more than two 64 byte blocks, so that both memchr and the match masks are used
+        toSplit += std::string((i * 37) % 150 < 100 ? i % 5 : (i * 37) % 150, static_cast<char>('a' + i % 26));
+        toSplit += i % 3 == 0 ? ",;" : ",";
+    }
+    toSplit += "end";
+
+    SECTION("Single character") {
+        auto splitter = lz::split<std::string>(toSplit, ',');
+        CHECK(std::vector<std::string>(splitter.begin(), splitter.end()) == splitWithFind(toSplit, ","));
+    }
+
+    SECTION("Multiple characters") {
+        auto splitter = lz::split<std::string>(toSplit, std::string(",;"));
+        CHECK(std::vector<std::string>(splitter.begin(), splitter.end()) == splitWithFind(toSplit, ",;"));
+        auto single = lz::split<std::string>(toSplit, std::string(";"));
+        CHECK(std::vector<std::string>(single.begin(), single.end()) == splitWithFind(toSplit, ";"));
+    }
+}
+
+TEST_CASE("String splitter over buffers", "[String splitter][Buffers]") {
+    const char buffer[] = "hello,world,,test";
+    const std::vector<std::string> expected = { "hello", "world", "", "test" };
+
+    SECTION("Pointer and length") {
+        auto splitter = lz::split<std::string>(buffer, sizeof buffer - 1, ',');
+        CHECK(std::vector<std::string>(splitter.begin(), splitter.end()) == expected);
+        auto multiple = lz::split<std::string>(buffer, 11, std::string(",w"));
+        CHECK(std::vector<std::string>(multiple.begin(), multiple.end()) == std::vector<std::string>{ "hello", "orld" });
+    }
+
+    SECTION("Contiguous char ranges") {
+        const std::vector<char> vector(buffer, buffer + sizeof buffer - 1);
+        auto splitter = lz::split<std::string>(vector, ',');
+        CHECK(std::vector<std::string>(splitter.begin(), splitter.end()) == expected);
+
+        const std::array<char, 5> array = { 'a', ';', 'b', ';', 'c' };
+        auto arraySplitter = lz::split<std::string>(array, std::string(";"));
+        CHECK(std::vector<std::string>(arraySplitter.begin(), arraySplitter.end()) == std::vector<std::string>{ "a", "b", "c" });
+    }
+
+    SECTION("Operator-- with a delimiter of multiple characters") {
+        const std::string toSplit = "ab--cd--ef";
+        auto splitter = lz::split<std::string>(toSplit, std::string("--"));
+        auto it = splitter.end();
+        --it;
+        CHECK(*it == "ef");
+        --it;
+        CHECK(*it == "cd");
+        --it;
+        CHECK(*it == "ab");
+        CHECK(it == splitter.begin());
+    }
+
+#ifdef LZ_HAS_STRING_VIEW
+    SECTION("Temporary string views") {
+        auto splitter = lz::split(std::string_view(buffer), ',');
+        static_assert(std::is_same<decltype(*splitter.begin()), std::string_view>::value, "Tokens should be string views");
+        CHECK(std::vector<std::string_view>(splitter.begin(), splitter.end()) ==
+              std::vector<std::string_view>{ "hello", "world", "", "test" });
+    }
+#endif // LZ_HAS_STRING_VIEW
+}
+
+TEST_CASE("Splitting on a set of characters", "[String splitter][Char set]") {
+    const std::string toSplit = " hello,\tworld;; test ";
+
+    SECTION("Keeping empty substrings") {
+        auto splitter = lz::splitAny<std::string>(toSplit, " \t,;");
+        CHECK(std::vector<std::string>(splitter.begin(), splitter.end()) ==
+              std::vector<std::string>{ "", "hello", "", "world", "", "", "test", "" });
+    }
+
+    SECTION("Collapsing consecutive delimiters") {
+        auto splitter = lz::splitAny<std::string>(toSplit, " \t,;", true);
+        CHECK(std::vector<std::string>(splitter.begin(), splitter.end()) == std::vector<std::string>{ "hello", "world", "test" });
+        const std::string delimitersOnly = " ;; ";
+        auto onlyDelimiters = lz::splitAny<std::string>(delimitersOnly, " ;", true);
+        CHECK(onlyDelimiters.begin() == onlyDelimiters.end());
+    }
+
+    SECTION("Same as splitting on a single character") {
+        const std::string csv = "a,bb,,ccc,";
+        auto single = lz::split<std::string>(csv, ',');
+        auto set = lz::splitAny<std::string>(csv, ",");
+        CHECK(std::vector<std::string>(single.begin(), single.end()) == std::vector<std::string>(set.begin(), set.end()));
+        const std::string emptyString;
+        auto empty = lz::splitAny<std::string>(emptyString, ",");
+        auto emptySingle = lz::split<std::string>(emptyString, ',');
+        CHECK(empty.begin() == empty.end());
+        CHECK(emptySingle.begin() == emptySingle.end());
+    }
+
+    SECTION("Buffers and character sets with any character") {
+        const char buffer[] = { 'a', '\0', 'b', '\xff', 'c' };
+        auto splitter = lz::splitAny<std::string>(buffer, sizeof buffer, lz::CharSet("\0\xff", 2));
+        CHECK(std::vector<std::string>(splitter.begin(), splitter.end()) == std::vector<std::string>{ "a", "b", "c" });
+    }
+}
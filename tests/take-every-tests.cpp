@@ -1,6 +1,8 @@
+#include <Lz/Lz.hpp>
 #include <Lz/TakeEvery.hpp>
 #include <array>
 #include <catch2/catch.hpp>
+#include <cstdint>
 #include <list>
 
 TEST_CASE("TakeEvery changing and creating elements", "[TakeEvery][Basic functionality]") {
@@ -130,6 +132,43 @@ TEST_CASE("TakeEvery binary operations", "[TakeEvery][Binary ops]") {
     }
 }
 
+TEST_CASE("TakeEvery strided loops", "[TakeEvery][Basic functionality]") {
+    // Strides of at least a cache line are prefetched
+    std::vector<std::int64_t> samples(1001);
+    for (std::size_t i = 0; i < samples.size(); ++i) {
+        samples[i] = static_cast<std::int64_t>(i);
+    }
+
+    SECTION("Copy") {
+        auto downsampled = lz::takeEvery(samples, 16, 3);
+        std::vector<std::int64_t> expected;
+        for (std::size_t i = 3; i < samples.size(); i += 16) {
+            expected.push_back(samples[i]);
+        }
+        CHECK(downsampled.toVector() == expected);
+
+        std::vector<std::int64_t> copied(expected.size());
+        downsampled.copyTo(copied.begin());
+        CHECK(copied == expected);
+    }
+
+    SECTION("Sum") {
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i < samples.size(); i += 16) {
+            sum += samples[i];
+        }
+        CHECK(lz::toIter(samples).takeEvery(16).sum() == sum);
+        CHECK(lz::toIter(samples).takeEvery(2).sum() == 250500);
+    }
+
+    SECTION("Stops early") {
+        auto downsampled = lz::toIter(samples).takeEvery(16);
+        CHECK(downsampled.all([](const std::int64_t i) { return i < 1000; }));
+        CHECK(!downsampled.all([](const std::int64_t i) { return i < 500; }));
+        CHECK(lz::takeEvery(samples, 16, 1001).toVector().empty());
+    }
+}
+
 TEST_CASE("TakeEvery to containers", "[TakeEvery][To container]") {
     constexpr std::size_t size = 4;
     std::array<int, size> array = { 1, 2, 3, 4 };
@@ -52,6 +52,34 @@ TEST_CASE("Take changing and creating elements", "[Take][Basic functionality]")
     }
 }
 
+TEST_CASE("Take counts elements of forward sequences", "[Take][Basic functionality]") {
+    std::list<int> list = { 1, 2, 3, 4, 5 };
+
+    SECTION("Take") {
+        auto taken = lz::take(list, 3);
+        static_assert(std::is_same<decltype(taken), lz::Take<std::list<int>::iterator>>::value, "Take must be counted");
+        CHECK(taken.toVector() == std::vector<int>{ 1, 2, 3 });
+        CHECK(taken.size() == 3);
+        CHECK(std::distance(taken.begin(), taken.end()) == 3);
+        CHECK(lz::take(list, 10).toVector() == std::vector<int>{ 1, 2, 3, 4, 5 });
+        CHECK(lz::take(list, 10).size() == 5);
+        CHECK(lz::take(list, 0).toVector().empty());
+    }
+
+    SECTION("Slice and drop") {
+        CHECK(lz::slice(list, 1, 3).toVector() == std::vector<int>{ 2, 3 });
+        CHECK(lz::slice(list, 4, 10).toVector() == std::vector<int>{ 5 });
+        CHECK(lz::drop(list, 2).toVector() == std::vector<int>{ 3, 4, 5 });
+        CHECK(lz::drop(list, 10).toVector().empty());
+    }
+
+    SECTION("Size hint") {
+        auto taken = lz::take(list, 3);
+        CHECK(taken.sizeHint().lower == 1);
+        CHECK(taken.sizeHint().upper == 3);
+    }
+}
+
 TEST_CASE("Take binary operations", "[Take][Binary ops]") {
     constexpr std::size_t size = 3;
     std::array<int, size> array = { 1, 2, 3 };
@@ -0,0 +1,152 @@
+#include "Lz/Lz.hpp"
+#include "catch2/catch.hpp"
+
+#include <Lz/Chunks.hpp>
+#include <atomic>
+#include <list>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+TEST_CASE("Thread pool parallel for", "[ThreadPool][Basic functionality]") {
+    lz::ThreadPool pool(4);
+    CHECK(pool.threadCount() == 4);
+
+    SECTION("Every task is run exactly once") {
+        for (const std::size_t taskCount : { 0u, 1u, 3u, 4u, 1000u }) {
+            std::vector<std::atomic<int>> runs(taskCount);
+            for (std::atomic<int>& run : runs) {
+                run = 0;
+            }
+            pool.parallelFor(taskCount, [&runs](const std::size_t i) { ++runs[i]; });
+            CHECK(std::all_of(runs.begin(), runs.end(), [](const std::atomic<int>& run) { return run == 1; }));
+        }
+    }
+
+    SECTION("Uneven tasks are stolen") {
+        std::atomic<std::size_t> sum(0);
+        pool.parallelFor(64, [&sum](const std::size_t i) {
+            if (i < 4) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+            sum += i;
+        });
+        CHECK(sum == 64 * 63 / 2);
+    }
+
+    SECTION("Exceptions are rethrown and the pool stays usable") {
+        CHECK_THROWS_AS(pool.parallelFor(100,
+                                         [](const std::size_t i) {
+                                             if (i == 42) {
+                                                 throw std::runtime_error("task failed");
+                                             }
+                                         }),
+                        std::runtime_error);
+        std::atomic<std::size_t> count(0);
+        pool.parallelFor(100, [&count](std::size_t) { ++count; });
+        CHECK(count == 100);
+    }
+
+    SECTION("Nested loops run on the calling thread") {
+        std::atomic<std::size_t> count(0);
+        pool.parallelFor(8, [&](std::size_t) { pool.parallelFor(8, [&count](std::size_t) { ++count; }); });
+        CHECK(count == 64);
+    }
+
+    SECTION("Loops from multiple threads") {
+        std::atomic<std::size_t> count(0);
+        std::thread other([&] { pool.parallelFor(500, [&count](std::size_t) { ++count; }); });
+        pool.parallelFor(500, [&count](std::size_t) { ++count; });
+        other.join();
+        CHECK(count == 1000);
+    }
+
+    SECTION("Pinned threads") {
+        lz::ThreadPool pinned(3, true);
+        CHECK(pinned.threadCount() == 3);
+        std::atomic<std::size_t> count(0);
+        pinned.parallelFor(100, [&count](std::size_t) { ++count; });
+        CHECK(count == 100);
+    }
+
+    SECTION("Single thread") {
+        lz::ThreadPool single(1);
+        CHECK(single.threadCount() == 1);
+        std::size_t count = 0;
+        single.parallelFor(10, [&count](std::size_t) { ++count; });
+        CHECK(count == 10);
+    }
+}
+
+TEST_CASE("Pool execution policy", "[ThreadPool][Basic functionality]") {
+    std::vector<int> values(10000);
+    std::iota(values.begin(), values.end(), 0);
+    const auto square = [](const int i) {
+        return i * i;
+    };
+    std::vector<int> expected(values.size());
+    std::transform(values.begin(), values.end(), expected.begin(), square);
+
+    SECTION("Shared pools") {
+        CHECK(&lz::execution::pool(3).pool() == &lz::execution::pool(3).pool());
+        CHECK(lz::execution::pool(3).pool().threadCount() == 3);
+        lz::ThreadPool pool(2);
+        CHECK(&lz::execution::pool(pool).pool() == &pool);
+    }
+
+    SECTION("To vector") {
+        CHECK(lz::map(values, square).toVector(lz::execution::pool(4)) == expected);
+        CHECK(lz::toIter(values).toVector(lz::execution::pool()) == values);
+
+        std::list<int> list(values.begin(), values.end());
+        CHECK(lz::toIter(list).toVector(lz::execution::pool(4)) == values);
+    }
+
+    SECTION("To vector with default initialized elements") {
+        using Allocator = lz::DefaultInitAllocator<int>;
+        const std::vector<int, Allocator> squares = lz::map(values, square).toVector(Allocator(), lz::execution::pool(4));
+        CHECK(squares.size() == expected.size());
+        CHECK(std::equal(squares.begin(), squares.end(), expected.begin()));
+
+        std::list<int> list(values.begin(), values.end());
+        const std::vector<int, Allocator> copied = lz::toIter(list).toVector(Allocator(), lz::execution::pool(4));
+        CHECK(copied.size() == values.size());
+        CHECK(std::equal(copied.begin(), copied.end(), values.begin()));
+
+        std::vector<std::string, lz::DefaultInitAllocator<std::string>> strings(2);
+        strings.emplace_back(3, 'x');
+        CHECK(strings == decltype(strings){ "", "", "xxx" });
+    }
+
+    SECTION("Copy and transform") {
+        std::vector<int> copied(values.size());
+        lz::toIter(values).copyTo(copied.begin(), lz::execution::pool(4));
+        CHECK(copied == values);
+
+        std::vector<int> transformed(values.size());
+        lz::toIter(values).transformTo(transformed.begin(), square, lz::execution::pool(4));
+        CHECK(transformed == expected);
+
+        std::list<int> list;
+        lz::toIter(values).copyTo(std::back_inserter(list), lz::execution::pool(4));
+        CHECK(std::equal(list.begin(), list.end(), values.begin()));
+    }
+
+    SECTION("For each") {
+        std::atomic<long long> sum(0);
+        lz::toIter(values).forEach([&sum](const int i) { sum += i; }, lz::execution::pool(4));
+        CHECK(sum == std::accumulate(values.begin(), values.end(), 0LL));
+    }
+
+    SECTION("Parallel for each chunk") {
+        std::atomic<long long> sum(0);
+        lz::parallelForEachChunk(
+            values, 100,
+            [&sum](lz::Chunk<std::vector<int>::iterator> chunk) {
+                sum += std::accumulate(chunk.begin(), chunk.end(), 0LL);
+            },
+            lz::execution::pool(4));
+        CHECK(sum == std::accumulate(values.begin(), values.end(), 0LL));
+    }
+}
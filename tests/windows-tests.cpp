@@ -0,0 +1,109 @@
+#include <Lz/Windows.hpp>
+#include <catch2/catch.hpp>
+#include <forward_list>
+#include <list>
+#include <numeric>
+#include <vector>
+
+TEST_CASE("Windows changing and creating elements", "[Windows][Basic functionality]") {
+    std::vector<int> values = { 1, 2, 3, 4, 5 };
+
+    SECTION("Every window") {
+        auto windows = lz::windows(values, 3);
+        std::vector<std::vector<int>> result;
+        for (auto window : windows) {
+            result.push_back(window.toVector());
+        }
+        CHECK(result == std::vector<std::vector<int>>{ { 1, 2, 3 }, { 2, 3, 4 }, { 3, 4, 5 } });
+        CHECK(windows.size() == 3);
+    }
+
+    SECTION("Windows point into the sequence") {
+        auto windows = lz::windows(values, 2);
+        auto it = windows.begin();
+        ++it;
+        CHECK(it->begin() == values.begin() + 1);
+        CHECK(it->end() == values.begin() + 3);
+    }
+
+    SECTION("Shorter than a window") {
+        CHECK(lz::windows(values, 6).begin() == lz::windows(values, 6).end());
+        CHECK(lz::windows(values, 6).size() == 0);
+        CHECK(lz::windows(values, 5).size() == 1);
+        std::vector<int> empty;
+        CHECK(lz::windows(empty, 1).size() == 0);
+    }
+
+    SECTION("Forward iterators") {
+        std::forward_list<int> list(values.begin(), values.end());
+        std::vector<int> lastElements;
+        for (auto window : lz::windows(list, 4)) {
+            lastElements.push_back(*std::next(window.begin(), 3));
+        }
+        CHECK(lastElements == std::vector<int>{ 4, 5 });
+    }
+}
+
+TEST_CASE("Windows binary operations", "[Windows][Binary ops]") {
+    std::vector<int> values = { 1, 2, 3, 4, 5 };
+    auto windows = lz::windows(values, 2);
+
+    SECTION("Operator--") {
+        auto it = windows.end();
+        --it;
+        CHECK(it->toVector() == std::vector<int>{ 4, 5 });
+        std::list<int> list(values.begin(), values.end());
+        auto listWindows = lz::windows(list, 2);
+        auto listIt = listWindows.end();
+        --listIt;
+        CHECK(listIt->toVector() == std::vector<int>{ 4, 5 });
+    }
+
+    SECTION("Random access") {
+        CHECK((windows.begin() + 3)->toVector() == std::vector<int>{ 4, 5 });
+        CHECK(windows.begin()[1].toVector() == std::vector<int>{ 2, 3 });
+        CHECK(windows.end() - windows.begin() == 4);
+        CHECK(windows.begin() + 4 == windows.end());
+        CHECK(windows.begin() < windows.end());
+        CHECK((windows.end() - 1)->toVector() == std::vector<int>{ 4, 5 });
+    }
+}
+
+TEST_CASE("Sliding aggregates", "[Windows][Basic functionality]") {
+    std::vector<int> values = { 4, 2, 12, 3, 8, 8, 1, 5 };
+
+    SECTION("Sum") {
+        CHECK(lz::slidingSum(values, 3).toVector() == std::vector<int>{ 18, 17, 23, 19, 17, 14 });
+        CHECK(lz::slidingSum(values, 1).toVector() == values);
+        CHECK(lz::slidingSum(values, 8).toVector() == std::vector<int>{ 43 });
+        CHECK(lz::slidingSum(values, 9).toVector().empty());
+        std::forward_list<int> list(values.begin(), values.end());
+        CHECK(lz::slidingSum(list, 2).toVector() == std::vector<int>{ 6, 14, 15, 11, 16, 9, 6 });
+    }
+
+    SECTION("Min and max") {
+        CHECK(lz::slidingMin(values, 3).toVector() == std::vector<int>{ 2, 2, 3, 3, 1, 1 });
+        CHECK(lz::slidingMax(values, 3).toVector() == std::vector<int>{ 12, 12, 12, 8, 8, 8 });
+        CHECK(lz::slidingMin(values, 1).toVector() == values);
+        CHECK(lz::slidingMax(values, 8).toVector() == std::vector<int>{ 12 });
+        CHECK(lz::slidingMax(values, 9).toVector().empty());
+        std::vector<int> empty;
+        CHECK(lz::slidingMin(empty, 2).toVector().empty());
+    }
+
+    SECTION("Matches the windows") {
+        std::vector<int> series;
+        for (int i = 0; i < 500; ++i) {
+            series.push_back((i * 7919) % 101 - 50);
+        }
+        std::vector<int> sums, minimums, maximums;
+        for (auto window : lz::windows(series, 17)) {
+            sums.push_back(std::accumulate(window.begin(), window.end(), 0));
+            minimums.push_back(*std::min_element(window.begin(), window.end()));
+            maximums.push_back(*std::max_element(window.begin(), window.end()));
+        }
+        CHECK(lz::slidingSum(series, 17).toVector() == sums);
+        CHECK(lz::slidingMin(series, 17).toVector() == minimums);
+        CHECK(lz::slidingMax(series, 17).toVector() == maximums);
+    }
+}
@@ -1,3 +1,4 @@
+#include <Lz/Lz.hpp>
 #include <Lz/Zip.hpp>
 #include <catch2/catch.hpp>
 #include <list>
@@ -191,3 +192,60 @@ TEST_CASE("Zip to containers", "[Zip][To container]") {
         CHECK(actual == expected);
     }
 }
+
+TEST_CASE("Zip contiguous", "[Zip contiguous][Basic functionality]") {
+    std::vector<int> a = { 1, 2, 3, 4 };
+    std::array<float, 3> b = { 1.f, 2.f, 3.f };
+    const std::string c = "abcde";
+    auto zipper = lz::zipContiguous(a, b, c);
+
+    static_assert(std::is_same<decltype(*zipper.begin()), std::tuple<int&, float&, const char&>>::value,
+                  "Zip contiguous should yield references");
+
+    SECTION("Should stop at smallest container") {
+        CHECK(zipper.end() - zipper.begin() == 3);
+        CHECK(std::distance(zipper.begin(), zipper.end()) == 3);
+        CHECK(*--zipper.end() == std::make_tuple(3, 3.f, 'c'));
+    }
+
+    SECTION("Should be by ref") {
+        std::size_t i = 0;
+        for (auto tup : zipper) {
+            CHECK(&std::get<0>(tup) == &a[i]);
+            CHECK(&std::get<1>(tup) == &b[i]);
+            CHECK(&std::get<2>(tup) == &c[i]);
+            ++i;
+        }
+        CHECK(i == 3);
+    }
+
+    SECTION("Random access") {
+        auto begin = zipper.begin();
+        CHECK(begin[2] == std::make_tuple(3, 3.f, 'c'));
+        CHECK(*(begin + 1) == std::make_tuple(2, 2.f, 'b'));
+        CHECK(begin < begin + 1);
+        CHECK(begin + 3 == zipper.end());
+        CHECK((zipper.end() - 3) == begin);
+    }
+
+    SECTION("Empty") {
+        std::vector<int> empty;
+        auto emptyZip = lz::zipContiguous(a, empty);
+        CHECK(emptyZip.begin() == emptyZip.end());
+    }
+
+    SECTION("Same elements as zip") {
+        CHECK(zipper.toVector() == lz::zip(a, b, c).toVector());
+    }
+
+    SECTION("Modify through a push based loop") {
+        std::vector<float> velocities = { 1.f, 2.f, 3.f, 4.f };
+        std::vector<float> positions(velocities.size(), 10.f);
+        auto step = lz::zipContiguous(positions, velocities);
+        auto move = [](std::tuple<float&, float&> particle) {
+            std::get<0>(particle) += std::get<1>(particle);
+        };
+        lz::toIter(step).forEach(move);
+        CHECK(positions == std::vector<float>{ 11.f, 12.f, 13.f, 14.f });
+    }
+}